@@ -0,0 +1,69 @@
+#!/usr/bin/env python3
+
+import json
+import os
+import sys
+
+from hyriseBenchmarkCore import *
+
+def main():
+
+  # Not testing the options that the CH-benCHmark shares with the TPC-C and TPC-H benchmarks. With one analytical
+  # client per query, each of the 22 CH queries is started once right away, while a transactional client runs the
+  # TPC-C transactions.
+
+  return_error = False
+
+  arguments = {}
+  arguments["--scale"] = "1"
+  arguments["--time"] = "120"
+  arguments["--scheduler"] = "true"
+  arguments["--clients"] = "1"
+  arguments["--analytical_clients"] = "22"
+  arguments["--output"] = "'json_output_ch.txt'"
+
+  benchmark = initialize(arguments, "hyriseBenchmarkCH", True)
+
+  benchmark.expect_exact("Running in multi-threaded mode using all available cores")
+  benchmark.expect_exact("Running benchmark in 'Shuffled' mode")
+  benchmark.expect_exact("CH-benCHmark scale factor (number of warehouses) is 1")
+  benchmark.expect_exact("22 analytical client(s) run concurrently to the transactional client(s)")
+  benchmark.expect_exact("Results for New-Order")
+  benchmark.expect_exact("-> Executed")
+  for query_id in range(1, 23):
+    benchmark.expect_exact("Results for CH-Q" + str(query_id) + "\r\n")
+    benchmark.expect_exact("-> Executed")
+  benchmark.expect_exact("QphH: ")
+  benchmark.expect_exact("tpmC: ")
+
+  close_benchmark(benchmark)
+  check_exit_status(benchmark)
+
+  output_filename = arguments["--output"].replace("'", "")
+  if not os.path.isfile(output_filename):
+    print ("ERROR: Cannot find output file " + arguments["--output"])
+    sys.exit(1)
+
+  with open(output_filename) as f:
+    output = json.load(f)
+  os.remove(output_filename)
+
+  return_error = check_json(output["context"]["scale_factor"], int(arguments["--scale"]), "Scale factor doesn't match with JSON:", return_error)
+  return_error = check_json(output["context"]["analytical_clients"], int(arguments["--analytical_clients"]), "Analytical client count doesn't match with JSON:", return_error)
+  return_error = check_json(len(output["benchmarks"]), 5 + 22, "Item count doesn't match with JSON:", return_error)
+
+  for benchmark_result in output["benchmarks"]:
+    if not benchmark_result["successful_runs"]:
+      print("ERROR: " + benchmark_result["name"] + " did not run successfully")
+      return_error = True
+
+  for metric in ["tpmC", "QphH"]:
+    if metric not in output["summary"] or output["summary"][metric] <= 0:
+      print("ERROR: " + metric + " is not reported")
+      return_error = True
+
+  if return_error:
+    sys.exit(1)
+
+if __name__ == '__main__':
+  main()
@@ -0,0 +1,62 @@
+#include "ch/ch_table_generator.hpp"
+
+#include "benchmark_runner.hpp"
+#include "ch/ch_benchmark_item_runner.hpp"
+#include "cli_config_parser.hpp"
+
+using namespace opossum;  // NOLINT
+
+/**
+ * This benchmark measures Hyrise's performance on the mixed workload of the CH-benCHmark (Cole et al., "The mixed
+ * workload CH-benCHmark", DBTest 2011). The TPC-C transactions (see tpcc_benchmark.cpp) run concurrently with 22
+ * analytical queries adapted from TPC-H, which read the same, continuously updated tables plus the SUPPLIER, NATION,
+ * and REGION tables. The transactional and the analytical clients are configured separately (--clients and
+ * --analytical_clients), so that the influence of the analytical queries on the transactional throughput (tpmC) and
+ * vice versa (QphH) can be measured.
+ *
+ * The limitations of our TPC-C implementation apply here as well. In particular, we do not claim to report correctly
+ * calculated tpmC or QphH. Modifications of the queries are documented in ch_queries.cpp.
+ *
+ * main() is mostly concerned with parsing the CLI options while BenchmarkRunner.run() performs the actual benchmark
+ * logic.
+ */
+
+int main(int argc, char* argv[]) {
+  auto cli_options = BenchmarkRunner::get_basic_cli_options("CH-benCHmark");
+
+  // clang-format off
+  cli_options.add_options()
+    ("s,scale", "Scale factor (warehouses)", cxxopts::value<size_t>()->default_value("1")) // NOLINT
+    ("analytical_clients", "Number of clients running the analytical queries concurrently to the --clients clients running the TPC-C transactions", cxxopts::value<uint32_t>()->default_value("1")); // NOLINT
+  // clang-format on
+
+  // Parse command line args
+  const auto cli_parse_result = cli_options.parse(argc, argv);
+
+  if (CLIConfigParser::print_help_if_requested(cli_options, cli_parse_result)) return 0;
+
+  const auto num_warehouses = cli_parse_result["scale"].as<size_t>();
+  const auto analytical_clients = cli_parse_result["analytical_clients"].as<uint32_t>();
+
+  const auto config = std::make_shared<BenchmarkConfig>(CLIConfigParser::parse_cli_options(cli_parse_result));
+
+  // Transactions and queries only run concurrently if they are shuffled. Also, verification is not possible for the
+  // same reason as in the TPC-C benchmark.
+  Assert(config->benchmark_mode == BenchmarkMode::Shuffled, "The CH-benCHmark can only be run in shuffled mode");
+  Assert(!config->verify, "Cannot run verification for the CH-benCHmark");
+
+  auto context = BenchmarkRunner::create_context(*config);
+
+  std::cout << "- CH-benCHmark scale factor (number of warehouses) is " << num_warehouses << std::endl;
+  std::cout << "- " << analytical_clients << " analytical client(s) run concurrently to the transactional client(s)"
+            << std::endl;
+
+  // Add CH-specific information
+  context.emplace("scale_factor", num_warehouses);
+  context.emplace("analytical_clients", analytical_clients);
+
+  // Run the benchmark
+  auto item_runner = std::make_unique<CHBenchmarkItemRunner>(config, num_warehouses, analytical_clients);
+  BenchmarkRunner(*config, std::move(item_runner), std::make_unique<CHTableGenerator>(num_warehouses, config), context)
+      .run();
+}
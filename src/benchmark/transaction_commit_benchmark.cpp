@@ -0,0 +1,51 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "benchmark/benchmark.h"
+#include "concurrency/transaction_context.hpp"
+#include "hyrise.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+/**
+ * Measures the commit throughput for an increasing number of threads that commit concurrently. Each transaction
+ * inserts a single row, so that it has to acquire and publish a commit id (see TransactionManager::_publish_commit).
+ */
+static void BM_TransactionCommit(benchmark::State& state) {  // NOLINT
+  const auto table_name = std::string{"commit_benchmark_table"};
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}};
+
+  // All threads wait for each other before entering and after leaving the benchmark loop
+  if (state.thread_index == 0) {
+    Hyrise::get().storage_manager.add_table(
+        table_name, std::make_shared<Table>(column_definitions, TableType::Data, Chunk::DEFAULT_SIZE, UseMvcc::Yes));
+  }
+
+  const auto values = std::make_shared<Table>(column_definitions, TableType::Data);
+  values->append({1});
+  const auto table_wrapper = std::make_shared<TableWrapper>(values);
+  table_wrapper->execute();
+
+  for (auto _ : state) {
+    const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+    const auto insert = std::make_shared<Insert>(table_name, table_wrapper);
+    insert->set_transaction_context(transaction_context);
+    insert->execute();
+    transaction_context->commit();
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+
+  if (state.thread_index == 0) {
+    Hyrise::reset();
+  }
+}
+BENCHMARK(BM_TransactionCommit)
+    ->ThreadRange(1, static_cast<int>(std::max(std::thread::hardware_concurrency(), 1u)))
+    ->UseRealTime();
+
+}  // namespace opossum
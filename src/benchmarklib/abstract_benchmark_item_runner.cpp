@@ -78,4 +78,13 @@ const std::vector<int>& AbstractBenchmarkItemRunner::weights() const {
   return empty_vector;
 }
 
+std::vector<AbstractBenchmarkItemRunner::ItemGroup> AbstractBenchmarkItemRunner::item_groups() const {
+  return {ItemGroup{"All", items(), _config->clients}};
+}
+
+nlohmann::json AbstractBenchmarkItemRunner::summary_metrics(const std::vector<BenchmarkItemResult>& /*results*/,
+                                                            const Duration /*duration*/) const {
+  return nlohmann::json::object();
+}
+
 }  // namespace opossum
@@ -5,6 +5,8 @@
 #include <string>
 #include <vector>
 
+#include <nlohmann/json.hpp>
+
 #include "benchmark_item_result.hpp"
 #include "benchmark_sql_executor.hpp"
 #include "strong_typedef.hpp"
@@ -52,6 +54,23 @@ class AbstractBenchmarkItemRunner {
   // the TPC-C benchmark, where not all transactions are executed equally often.
   virtual const std::vector<int>& weights() const;
 
+  // A set of items run by its own simulated clients in BenchmarkMode::Shuffled
+  struct ItemGroup {
+    std::string name;
+    std::vector<BenchmarkItemID> items;
+    uint32_t clients;
+  };
+
+  // Returns the groups of items that are run concurrently, but with separate numbers of clients (e.g., transactional
+  // and analytical items in the CH-benCHmark). Within a group, items are picked randomly according to their weights.
+  // By default, all items form a single group run by BenchmarkConfig::clients clients.
+  virtual std::vector<ItemGroup> item_groups() const;
+
+  // Returns benchmark-specific metrics (e.g., tpmC) that are printed and added to the summary of the report.
+  // @param results holds one entry per BenchmarkItemID, @param duration is the time in which they were measured.
+  virtual nlohmann::json summary_metrics(const std::vector<BenchmarkItemResult>& results,
+                                         const Duration duration) const;
+
  protected:
   // Executes the benchmark item with the given ID. BenchmarkItemRunners should not use the SQL pipeline directly,
   // but use the provided BenchmarkSQLExecutor. That class not only tracks the execution metrics and provides them
@@ -3,6 +3,7 @@
 #include "benchmark_config.hpp"
 #include "benchmark_table_encoder.hpp"
 #include "hyrise.hpp"
+#include "import_export/binary/binary_parser.hpp"
 #include "import_export/binary/binary_writer.hpp"
 #include "operators/sort.hpp"
 #include "operators/table_wrapper.hpp"
@@ -10,6 +11,7 @@
 #include "storage/index/group_key/group_key_index.hpp"
 #include "storage/segment_iterate.hpp"
 #include "utils/format_duration.hpp"
+#include "utils/list_directory.hpp"
 #include "utils/timer.hpp"
 
 namespace opossum {
@@ -274,4 +276,18 @@ AbstractTableGenerator::SortOrderByTable AbstractTableGenerator::_sort_order_by_
 void AbstractTableGenerator::_add_constraints(
     std::unordered_map<std::string, BenchmarkTableInfo>& table_info_by_name) const {}
 
+bool AbstractTableGenerator::_cached_tables_are_usable(const std::string& cache_directory) const {
+  if (!_benchmark_config->cache_binary_tables || !std::filesystem::is_directory(cache_directory)) return false;
+
+  for (const auto& table_file : list_directory(cache_directory)) {
+    if (!BinaryParser::has_current_format(table_file)) {
+      std::cout << "- Cached tables in " << cache_directory << " were written in an outdated format, regenerating them"
+                << std::endl;
+      return false;
+    }
+  }
+
+  return true;
+}
+
 }  // namespace opossum
@@ -76,6 +76,10 @@ class AbstractTableGenerator {
   // Optionally, the benchmark may add constraints once the tables are generated / loaded from binary
   virtual void _add_constraints(std::unordered_map<std::string, BenchmarkTableInfo>& table_info_by_name) const;
 
+  // Returns whether binary caching is enabled and the given directory contains cached tables that can be loaded. If
+  // any of them was written in an outdated format, the tables are regenerated and the cache is overwritten.
+  bool _cached_tables_are_usable(const std::string& cache_directory) const;
+
   const std::shared_ptr<BenchmarkConfig> _benchmark_config;
 };
 
@@ -10,7 +10,11 @@ BenchmarkConfig::BenchmarkConfig(const BenchmarkMode init_benchmark_mode, const
                                  const bool init_enable_scheduler, const uint32_t init_cores,
                                  const uint32_t init_clients, const bool init_enable_visualization,
                                  const bool init_verify, const bool init_cache_binary_tables,
-                                 const bool init_sql_metrics)
+                                 const bool init_sql_metrics, const bool init_hardware_counters,
+                                 const std::optional<double>& init_arrival_rate,
+                                 const ArrivalProcess init_arrival_process,
+                                 const std::optional<Duration>& init_latency_slo,
+                                 const std::optional<Duration>& init_optimizer_time_budget)
     : benchmark_mode(init_benchmark_mode),
       chunk_size(init_chunk_size),
       encoding_config(init_encoding_config),
@@ -25,7 +29,12 @@ BenchmarkConfig::BenchmarkConfig(const BenchmarkMode init_benchmark_mode, const
       enable_visualization(init_enable_visualization),
       verify(init_verify),
       cache_binary_tables(init_cache_binary_tables),
-      sql_metrics(init_sql_metrics) {}
+      sql_metrics(init_sql_metrics),
+      hardware_counters(init_hardware_counters),
+      arrival_rate(init_arrival_rate),
+      arrival_process(init_arrival_process),
+      latency_slo(init_latency_slo),
+      optimizer_time_budget(init_optimizer_time_budget) {}
 
 BenchmarkConfig BenchmarkConfig::get_default_config() { return BenchmarkConfig(); }
 
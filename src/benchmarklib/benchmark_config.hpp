@@ -13,6 +13,12 @@ namespace opossum {
  */
 enum class BenchmarkMode { Ordered, Shuffled };
 
+/**
+ * Inter-arrival times of items in open-loop runs (see BenchmarkConfig::arrival_rate). "Poisson" draws exponentially
+ * distributed gaps, "Constant" issues items at fixed intervals.
+ */
+enum class ArrivalProcess { Poisson, Constant };
+
 using Duration = std::chrono::high_resolution_clock::duration;
 using TimePoint = std::chrono::high_resolution_clock::time_point;
 
@@ -23,7 +29,10 @@ class BenchmarkConfig {
                   const Duration& max_duration, const Duration& warmup_duration,
                   const std::optional<std::string>& output_file_path, const bool enable_scheduler, const uint32_t cores,
                   const uint32_t clients, const bool enable_visualization, const bool verify,
-                  const bool cache_binary_tables, const bool sql_metrics);
+                  const bool cache_binary_tables, const bool sql_metrics, const bool hardware_counters,
+                  const std::optional<double>& arrival_rate, const ArrivalProcess arrival_process,
+                  const std::optional<Duration>& latency_slo,
+                  const std::optional<Duration>& optimizer_time_budget);
 
   static BenchmarkConfig get_default_config();
 
@@ -43,6 +52,21 @@ class BenchmarkConfig {
   bool cache_binary_tables = false;  // Defaults to false for internal use, but the CLI sets it to true by default
   bool sql_metrics = false;
 
+  // Measure hardware performance counters per operator (see HardwareCounters). They are reported as part of the SQL
+  // metrics and in the visualized PQPs.
+  bool hardware_counters = false;
+
+  // If set, items are issued open-loop at this rate (items per second), independently of whether previous items have
+  // finished. Otherwise, `clients` items are run in a closed loop.
+  std::optional<double> arrival_rate = std::nullopt;
+  ArrivalProcess arrival_process = ArrivalProcess::Poisson;
+
+  // If set, the arrival rate is swept to find the maximum throughput at which the p99 latency meets this SLO
+  std::optional<Duration> latency_slo = std::nullopt;
+
+  // If set, optimizer rules are skipped once they are expected to exceed this budget (see Optimizer)
+  std::optional<Duration> optimizer_time_budget = std::nullopt;
+
  private:
   BenchmarkConfig() = default;
 };
@@ -4,6 +4,7 @@
 
 #include "benchmark_config.hpp"
 #include "benchmark_item_run_result.hpp"
+#include "latency_histogram.hpp"
 
 namespace opossum {
 
@@ -22,6 +23,10 @@ struct BenchmarkItemResult {
   // the entire benchmark.
   Duration duration{0};
 
+  // Latencies of the successful runs. In open-loop runs, the latency is measured from the time at which the run was
+  // supposed to be issued, so that it includes the time spent waiting for previous runs (coordinated omission).
+  LatencyHistogram latency_histogram;
+
   // The *optional* is set if the verification was executed; the *bool* is true if the verification succeeded.
   std::atomic<std::optional<bool>> verification_passed{std::nullopt};
 };
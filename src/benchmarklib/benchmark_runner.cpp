@@ -15,6 +15,7 @@
 #include "storage/chunk.hpp"
 #include "tpch/tpch_table_generator.hpp"
 #include "utils/format_duration.hpp"
+#include "utils/hardware_counters.hpp"
 #include "utils/sqlite_wrapper.hpp"
 #include "utils/timer.hpp"
 #include "version.hpp"
@@ -48,6 +49,19 @@ BenchmarkRunner::BenchmarkRunner(const BenchmarkConfig& config,
     Hyrise::get().set_scheduler(scheduler);
   }
 
+  if (config.optimizer_time_budget) {
+    Hyrise::get().default_optimizer_time_budget =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(*config.optimizer_time_budget);
+  }
+
+  if (config.hardware_counters) {
+    HardwareCounters::set_enabled(true);
+    if (!HardwareCounters::read()) {
+      std::cout << "- Hardware performance counters are not available (see /proc/sys/kernel/perf_event_paranoid)"
+                << std::endl;
+    }
+  }
+
   _table_generator->generate_and_store();
 
   _benchmark_item_runner->on_tables_loaded();
@@ -74,26 +88,14 @@ BenchmarkRunner::BenchmarkRunner(const BenchmarkConfig& config,
 void BenchmarkRunner::run() {
   std::cout << "- Starting Benchmark..." << std::endl;
 
-  _benchmark_start = std::chrono::steady_clock::now();
-
-  const auto& items = _benchmark_item_runner->items();
-  if (!items.empty()) {
-    _results = std::vector<BenchmarkItemResult>{*std::max_element(items.begin(), items.end()) + 1u};
-  }
-
-  switch (_config.benchmark_mode) {
-    case BenchmarkMode::Ordered: {
-      _benchmark_ordered();
-      break;
-    }
-    case BenchmarkMode::Shuffled: {
-      _benchmark_shuffled();
-      break;
-    }
+  _arrival_rate = _config.arrival_rate;
+  if (_config.latency_slo) {
+    _sweep_arrival_rate();
+  } else {
+    _benchmark();
   }
 
-  auto benchmark_end = std::chrono::steady_clock::now();
-  _total_run_duration = benchmark_end - _benchmark_start;
+  const auto& items = _benchmark_item_runner->items();
 
   // Create report
   if (_config.output_file_path) {
@@ -114,6 +116,19 @@ void BenchmarkRunner::run() {
       if (!_results[item_id].unsuccessful_runs.empty()) {
         std::cout << "  -> " << _results[item_id].unsuccessful_runs.size() << " additional runs failed" << std::endl;
       }
+      if (_arrival_rate) {
+        const auto& latency_histogram = _results[item_id].latency_histogram;
+        std::cout << "  -> Latency p50: " << format_duration(latency_histogram.percentile(50.0))
+                  << ", p99: " << format_duration(latency_histogram.percentile(99.0))
+                  << ", p99.9: " << format_duration(latency_histogram.percentile(99.9)) << std::endl;
+      }
+    }
+  }
+
+  if (!_config.verify && !_config.enable_visualization) {
+    const auto summary_metrics = _benchmark_item_runner->summary_metrics(_results, _measured_duration());
+    for (const auto& [metric, value] : summary_metrics.items()) {
+      std::cout << "- " << metric << ": " << value << std::endl;
     }
   }
 
@@ -137,22 +152,107 @@ void BenchmarkRunner::run() {
   }
 }
 
-void BenchmarkRunner::_benchmark_shuffled() {
-  auto item_ids = _benchmark_item_runner->items();
+void BenchmarkRunner::_benchmark() {
+  _benchmark_start = std::chrono::steady_clock::now();
 
-  if (const auto& weights = _benchmark_item_runner->weights(); !weights.empty()) {
-    auto item_ids_weighted = std::vector<BenchmarkItemID>{};
-    for (const auto& selected_item_id : item_ids) {
-      const auto item_weight = weights.at(selected_item_id);
-      item_ids_weighted.resize(item_ids_weighted.size() + item_weight, selected_item_id);
+  const auto& items = _benchmark_item_runner->items();
+  if (!items.empty()) {
+    _results = std::vector<BenchmarkItemResult>{*std::max_element(items.begin(), items.end()) + 1u};
+    _running_clients_by_item = std::vector<std::atomic_uint>(_results.size());
+  }
+
+  switch (_config.benchmark_mode) {
+    case BenchmarkMode::Ordered: {
+      _benchmark_ordered();
+      break;
+    }
+    case BenchmarkMode::Shuffled: {
+      _benchmark_shuffled();
+      break;
     }
-    item_ids = item_ids_weighted;
   }
 
-  auto item_ids_shuffled = std::vector<BenchmarkItemID>{};
+  auto benchmark_end = std::chrono::steady_clock::now();
+  _total_run_duration = benchmark_end - _benchmark_start;
+}
 
-  for (const auto& item_id : item_ids) {
-    _warmup(item_id);
+void BenchmarkRunner::_sweep_arrival_rate() {
+  // Stop once the highest sustainable and the lowest unsustainable rate are this close or after MAX_STEPS measurements
+  constexpr auto PRECISION = 1.05;
+  constexpr auto MAX_STEPS = 16;
+
+  auto max_sustainable_rate = std::optional<double>{};
+  auto min_unsustainable_rate = std::optional<double>{};
+
+  for (auto step = 0; step < MAX_STEPS; ++step) {
+    std::cout << "- Measuring an arrival rate of " << *_arrival_rate << " items/s" << std::endl;
+    _benchmark();
+
+    const auto latency_histogram = _total_latency_histogram();
+    const auto p99_latency = latency_histogram->percentile(99.0);
+    const auto throughput =
+        static_cast<double>(latency_histogram->count()) / std::chrono::duration<double>(_measured_duration()).count();
+    const auto slo_met = latency_histogram->count() > 0 && p99_latency <= *_config.latency_slo;
+
+    std::cout << "  -> p99 latency of " << format_duration(p99_latency) << " at " << throughput << " items/s - SLO "
+              << (slo_met ? "met" : "missed") << std::endl;
+    _sweep_steps.push_back(nlohmann::json{{"arrival_rate", *_arrival_rate},
+                                          {"items_per_second", throughput},
+                                          {"latency", latency_histogram->to_json()},
+                                          {"slo_met", slo_met}});
+
+    if (slo_met) {
+      max_sustainable_rate = _arrival_rate;
+    } else {
+      min_unsustainable_rate = _arrival_rate;
+    }
+
+    // Double (or halve) the rate until the SLO is missed (or met) for the first time, then search between the two
+    if (!min_unsustainable_rate) {
+      *_arrival_rate *= 2.0;
+    } else if (!max_sustainable_rate) {
+      *_arrival_rate /= 2.0;
+    } else if (*min_unsustainable_rate / *max_sustainable_rate > PRECISION) {
+      _arrival_rate = (*max_sustainable_rate + *min_unsustainable_rate) / 2.0;
+    } else {
+      break;
+    }
+  }
+
+  _max_sustainable_arrival_rate = max_sustainable_rate;
+  if (!max_sustainable_rate) {
+    std::cout << "- No measured arrival rate met the SLO" << std::endl;
+    return;
+  }
+
+  std::cout << "- Maximum sustainable arrival rate is " << *max_sustainable_rate << " items/s" << std::endl;
+
+  // Report the results of the maximum sustainable rate
+  if (*_arrival_rate != *max_sustainable_rate) {
+    _arrival_rate = max_sustainable_rate;
+    std::cout << "- Measuring an arrival rate of " << *_arrival_rate << " items/s for the results" << std::endl;
+    _benchmark();
+  }
+}
+
+void BenchmarkRunner::_benchmark_shuffled() {
+  const auto item_groups = _benchmark_item_runner->item_groups();
+  const auto& weights = _benchmark_item_runner->weights();
+
+  // The items of each group, repeated according to their weights
+  auto item_ids_by_group = std::vector<std::vector<BenchmarkItemID>>(item_groups.size());
+  for (auto group_id = size_t{0}; group_id < item_groups.size(); ++group_id) {
+    auto& item_ids = item_ids_by_group[group_id];
+    for (const auto& selected_item_id : item_groups[group_id].items) {
+      const auto item_weight = weights.empty() ? 1 : weights.at(selected_item_id);
+      item_ids.resize(item_ids.size() + item_weight, selected_item_id);
+    }
+  }
+
+  for (const auto& item_ids : item_ids_by_group) {
+    for (const auto& item_id : item_ids) {
+      _warmup(item_id);
+    }
   }
 
   // For shuffling the item order
@@ -161,23 +261,55 @@ void BenchmarkRunner::_benchmark_shuffled() {
 
   Assert(_currently_running_clients == 0, "Did not expect any clients to run at this time");
 
+  // Picks the next item from @param item_ids_shuffled, which is refilled from @param item_ids once all were run
+  const auto next_item_id = [&](std::vector<BenchmarkItemID>& item_ids_shuffled,
+                                const std::vector<BenchmarkItemID>& item_ids) {
+    if (item_ids_shuffled.empty()) {
+      item_ids_shuffled = item_ids;
+      std::shuffle(item_ids_shuffled.begin(), item_ids_shuffled.end(), random_generator);
+    }
+
+    const auto item_id = item_ids_shuffled.back();
+    item_ids_shuffled.pop_back();
+    return item_id;
+  };
+
+  _total_finished_runs = 0;
   _state = BenchmarkState{_config.max_duration};
 
-  while (_state.keep_running() && (_config.max_runs < 0 || _total_finished_runs.load(std::memory_order_relaxed) <
-                                                               static_cast<size_t>(_config.max_runs))) {
-    // We want to only schedule as many items simultaneously as we have simulated clients
-    if (_currently_running_clients.load(std::memory_order_relaxed) < _config.clients) {
-      if (item_ids_shuffled.empty()) {
-        item_ids_shuffled = item_ids;
-        std::shuffle(item_ids_shuffled.begin(), item_ids_shuffled.end(), random_generator);
-      }
+  if (_arrival_rate) {
+    // Open-loop runs do not simulate clients, so the items of all groups are mixed
+    auto item_ids = std::vector<BenchmarkItemID>{};
+    for (const auto& group_item_ids : item_ids_by_group) {
+      item_ids.insert(item_ids.end(), group_item_ids.begin(), group_item_ids.end());
+    }
+    auto item_ids_shuffled = std::vector<BenchmarkItemID>{};
+    _issue_open_loop([&]() { return next_item_id(item_ids_shuffled, item_ids); });
+  } else {
+    auto item_ids_shuffled_by_group = std::vector<std::vector<BenchmarkItemID>>(item_groups.size());
+
+    while (_state.keep_running() && (_config.max_runs < 0 || _total_finished_runs.load(std::memory_order_relaxed) <
+                                                                 static_cast<size_t>(_config.max_runs))) {
+      // We want to only schedule as many items of a group simultaneously as the group has simulated clients
+      auto scheduled_item = false;
+      for (auto group_id = size_t{0}; group_id < item_groups.size(); ++group_id) {
+        const auto& item_ids = item_ids_by_group[group_id];
+        if (item_ids.empty()) continue;
+
+        auto running_clients = uint32_t{0};
+        for (const auto& item_id : item_groups[group_id].items) {
+          running_clients += _running_clients_by_item[item_id].load(std::memory_order_relaxed);
+        }
 
-      const auto item_id = item_ids_shuffled.back();
-      item_ids_shuffled.pop_back();
+        if (running_clients < item_groups[group_id].clients) {
+          _schedule_item_run(next_item_id(item_ids_shuffled_by_group[group_id], item_ids));
+          scheduled_item = true;
+        }
+      }
 
-      _schedule_item_run(item_id);
-    } else {
-      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      if (!scheduled_item) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      }
     }
   }
   _state.set_done();
@@ -205,18 +337,27 @@ void BenchmarkRunner::_benchmark_ordered() {
 
     _state = BenchmarkState{_config.max_duration};
 
-    while (_state.keep_running() &&
-           (_config.max_runs < 0 || (result.successful_runs.size() + result.unsuccessful_runs.size()) <
-                                        static_cast<size_t>(_config.max_runs))) {
-      // We want to only schedule as many items simultaneously as we have simulated clients
-      if (_currently_running_clients.load(std::memory_order_relaxed) < _config.clients) {
-        _schedule_item_run(item_id);
-      } else {
-        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    if (_arrival_rate) {
+      _issue_open_loop([item_id]() { return item_id; });
+    } else {
+      while (_state.keep_running() &&
+             (_config.max_runs < 0 || (result.successful_runs.size() + result.unsuccessful_runs.size()) <
+                                          static_cast<size_t>(_config.max_runs))) {
+        // We want to only schedule as many items simultaneously as we have simulated clients
+        if (_currently_running_clients.load(std::memory_order_relaxed) < _config.clients) {
+          _schedule_item_run(item_id);
+        } else {
+          std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
       }
     }
     _state.set_done();
 
+    // Wait for the rest of the tasks that didn't make it in time - they will not count toward the results, unless they
+    // were issued open-loop
+    Hyrise::get().scheduler()->wait_for_all_tasks();
+    Assert(_currently_running_clients == 0, "All runs must be finished at this point");
+
     result.duration = _state.benchmark_duration;
     const auto duration_of_all_runs_ns =
         static_cast<float>(std::chrono::duration_cast<std::chrono::nanoseconds>(_state.benchmark_duration).count());
@@ -232,36 +373,71 @@ void BenchmarkRunner::_benchmark_ordered() {
       if (!result.unsuccessful_runs.empty()) {
         std::cout << "  -> " << result.unsuccessful_runs.size() << " additional runs failed" << std::endl;
       }
+      if (_arrival_rate) {
+        std::cout << "  -> Latency p50: " << format_duration(result.latency_histogram.percentile(50.0))
+                  << ", p99: " << format_duration(result.latency_histogram.percentile(99.0))
+                  << ", p99.9: " << format_duration(result.latency_histogram.percentile(99.9)) << std::endl;
+      }
     }
+  }
+}
 
-    // Wait for the rest of the tasks that didn't make it in time - they will not count toward the results
-    Hyrise::get().scheduler()->wait_for_all_tasks();
-    Assert(_currently_running_clients == 0, "All runs must be finished at this point");
+void BenchmarkRunner::_issue_open_loop(const std::function<BenchmarkItemID()>& next_item_id) {
+  std::random_device random_device;
+  std::mt19937 random_generator(random_device());
+  auto interarrival_time_distribution = std::exponential_distribution<double>{*_arrival_rate};
+
+  auto issued_runs = int64_t{0};
+  auto next_arrival = std::chrono::steady_clock::now();
+
+  while (_state.keep_running() && (_config.max_runs < 0 || issued_runs < _config.max_runs)) {
+    const auto now = std::chrono::steady_clock::now();
+    if (now < next_arrival) {
+      // Wake up for the next arrival, but check regularly whether the time is up
+      std::this_thread::sleep_until(std::min(next_arrival, now + std::chrono::milliseconds(10)));
+      continue;
+    }
+
+    // If the previous runs are late (e.g., because the scheduler is disabled and runs are executed immediately), the
+    // next run is issued immediately, but its latency is still measured from its planned arrival.
+    _schedule_item_run(next_item_id(), next_arrival);
+    ++issued_runs;
+
+    const auto interarrival_time = _config.arrival_process == ArrivalProcess::Poisson
+                                       ? interarrival_time_distribution(random_generator)
+                                       : 1.0 / *_arrival_rate;
+    next_arrival += std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::duration<double>{interarrival_time});
   }
 }
 
-void BenchmarkRunner::_schedule_item_run(const BenchmarkItemID item_id) {
+void BenchmarkRunner::_schedule_item_run(const BenchmarkItemID item_id,
+                                         const std::optional<std::chrono::steady_clock::time_point>& intended_start) {
   _currently_running_clients++;
+  _running_clients_by_item[item_id]++;
   BenchmarkItemResult& result = _results[item_id];
 
   auto task = std::make_shared<JobTask>(
-      [&, item_id]() {
+      [&, item_id, intended_start]() {
         const auto run_start = std::chrono::steady_clock::now();
         auto [success, metrics, any_run_verification_failed] = _benchmark_item_runner->execute_item(item_id);
         const auto run_end = std::chrono::steady_clock::now();
 
         --_currently_running_clients;
+        --_running_clients_by_item[item_id];
         ++_total_finished_runs;
 
         // If result.verification_passed was previously unset, set it; otherwise only invalidate it if the run failed.
         result.verification_passed = result.verification_passed.load().value_or(true) && !any_run_verification_failed;
 
-        if (!_state.is_done()) {  // To prevent items from adding their result after the time is up
+        // To prevent items from adding their result after the time is up. Open-loop runs were issued in time.
+        if (!_state.is_done() || intended_start) {
           if (!_config.sql_metrics) metrics.clear();
           const auto item_result =
               BenchmarkItemRunResult{run_start - _benchmark_start, run_end - run_start, std::move(metrics)};
           if (success) {
             result.successful_runs.push_back(item_result);
+            result.latency_histogram.record(run_end - intended_start.value_or(run_start));
           } else {
             result.unsuccessful_runs.push_back(item_result);
           }
@@ -291,16 +467,36 @@ void BenchmarkRunner::_warmup(const BenchmarkItemID item_id) {
     }
   }
 
+  _state.set_done();
+
+  // Wait for the rest of the tasks that didn't make it in time
+  Hyrise::get().scheduler()->wait_for_all_tasks();
+  Assert(_currently_running_clients == 0, "All runs must be finished at this point");
+
   // Clear the results
   _results[item_id].successful_runs = {};
   _results[item_id].unsuccessful_runs = {};
   _results[item_id].duration = {};
+  _results[item_id].latency_histogram.clear();
+}
 
-  _state.set_done();
+Duration BenchmarkRunner::_measured_duration() const {
+  // For Ordered, the items were run one after another. For Shuffled, all items share the same duration.
+  auto measured_duration = Duration{0};
+  for (const auto item_id : _benchmark_item_runner->items()) {
+    measured_duration = _config.benchmark_mode == BenchmarkMode::Ordered
+                            ? measured_duration + _results[item_id].duration
+                            : _results[item_id].duration;
+  }
+  return measured_duration;
+}
 
-  // Wait for the rest of the tasks that didn't make it in time
-  Hyrise::get().scheduler()->wait_for_all_tasks();
-  Assert(_currently_running_clients == 0, "All runs must be finished at this point");
+std::unique_ptr<LatencyHistogram> BenchmarkRunner::_total_latency_histogram() const {
+  auto latency_histogram = std::make_unique<LatencyHistogram>();
+  for (const auto item_id : _benchmark_item_runner->items()) {
+    latency_histogram->add(_results[item_id].latency_histogram);
+  }
+  return latency_histogram;
 }
 
 void BenchmarkRunner::_create_report(std::ostream& stream) const {
@@ -321,13 +517,32 @@ void BenchmarkRunner::_create_report(std::ostream& stream) const {
                                                       {"statements", nlohmann::json::array()}};
 
           for (const auto& sql_statement_metrics : pipeline_metrics.statement_metrics) {
+            auto rule_metrics_json = nlohmann::json::array();
+            for (const auto& rule_metrics : sql_statement_metrics->optimizer_rule_metrics) {
+              rule_metrics_json.push_back(nlohmann::json{{"rule_name", rule_metrics.rule_name},
+                                                         {"duration", rule_metrics.duration.count()},
+                                                         {"skipped", rule_metrics.skipped}});
+            }
+
             auto sql_statement_metrics_json =
                 nlohmann::json{{"sql_translation_duration", sql_statement_metrics->sql_translation_duration.count()},
                                {"optimization_duration", sql_statement_metrics->optimization_duration.count()},
+                               {"optimizer_rule_durations", rule_metrics_json},
                                {"lqp_translation_duration", sql_statement_metrics->lqp_translation_duration.count()},
                                {"plan_execution_duration", sql_statement_metrics->plan_execution_duration.count()},
                                {"query_plan_cache_hit", sql_statement_metrics->query_plan_cache_hit}};
 
+            if (!sql_statement_metrics->hardware_counters_by_operator.empty()) {
+              auto hardware_counters_json = nlohmann::json::object();
+              for (const auto& [operator_name, counters] : sql_statement_metrics->hardware_counters_by_operator) {
+                hardware_counters_json[operator_name] = nlohmann::json{{"cycles", counters.cycles},
+                                                                       {"instructions", counters.instructions},
+                                                                       {"llc_misses", counters.llc_misses},
+                                                                       {"branch_misses", counters.branch_misses}};
+              }
+              sql_statement_metrics_json["hardware_counters"] = hardware_counters_json;
+            }
+
             pipeline_metrics_json["statements"].push_back(sql_statement_metrics_json);
           }
 
@@ -365,6 +580,7 @@ void BenchmarkRunner::_create_report(std::ostream& stream) const {
                                    ? reported_item_duration_ns / static_cast<float>(result.successful_runs.size())
                                    : std::nanf("");
     benchmark["avg_real_time_per_iteration"] = time_per_item;
+    benchmark["latency"] = result.latency_histogram.to_json();
 
     benchmarks.push_back(benchmark);
   }
@@ -377,13 +593,26 @@ void BenchmarkRunner::_create_report(std::ostream& stream) const {
 
   nlohmann::json summary{
       {"table_size_in_bytes", table_size},
-      {"total_duration", std::chrono::duration_cast<std::chrono::nanoseconds>(_total_run_duration).count()}};
+      {"total_duration", std::chrono::duration_cast<std::chrono::nanoseconds>(_total_run_duration).count()},
+      {"latency", _total_latency_histogram()->to_json()}};
+  summary.update(_benchmark_item_runner->summary_metrics(_results, _measured_duration()));
 
   nlohmann::json report{{"context", _context},
                         {"benchmarks", benchmarks},
                         {"summary", summary},
                         {"table_generation", _table_generator->metrics}};
 
+  // The benchmarks and the summary above show the results of the maximum sustainable arrival rate (or of the last
+  // measured rate if the SLO was never met)
+  if (_config.latency_slo) {
+    report["sweep"] = nlohmann::json{
+        {"latency_slo", std::chrono::duration_cast<std::chrono::nanoseconds>(*_config.latency_slo).count()},
+        {"slo_percentile", 99.0},
+        {"max_sustainable_arrival_rate",
+         _max_sustainable_arrival_rate ? nlohmann::json(*_max_sustainable_arrival_rate) : nlohmann::json()},
+        {"steps", _sweep_steps}};
+  }
+
   stream << std::setw(2) << report << std::endl;
 }
 
@@ -400,10 +629,12 @@ cxxopts::Options BenchmarkRunner::get_basic_cli_options(const std::string& bench
   // some point. The way this is solved here is not really nice, but as the TPC-C benchmark binary has just a main
   // method and not a class, retrieving this default value properly would require some major refactoring of how
   // benchmarks interact with the BenchmarkRunner. At this moment, that does not seem to be worth the effort.
-  const auto default_mode = (benchmark_name == "TPC-C Benchmark" ? "Shuffled" : "Ordered");
+  // The same applies to the CH-benCHmark, which runs TPC-C transactions and analytical queries concurrently.
+  const auto is_tpcc_based = benchmark_name == "TPC-C Benchmark" || benchmark_name == "CH-benCHmark";
+  const auto default_mode = (is_tpcc_based ? "Shuffled" : "Ordered");
 
   // TPC-C does not support binary caching
-  const auto default_dont_cache_binary_tables = (benchmark_name == "TPC-C Benchmark" ? "true" : "false");
+  const auto default_dont_cache_binary_tables = (is_tpcc_based ? "true" : "false");
 
   // clang-format off
   cli_options.add_options()
@@ -424,7 +655,12 @@ cxxopts::Options BenchmarkRunner::get_basic_cli_options(const std::string& bench
     ("visualize", "Create a visualization image of one LQP and PQP for each query, do not properly run the benchmark", cxxopts::value<bool>()->default_value("false")) // NOLINT
     ("verify", "Verify each query by comparing it with the SQLite result", cxxopts::value<bool>()->default_value("false")) // NOLINT
     ("dont_cache_binary_tables", "Do not cache tables as binary files for faster loading on subsequent runs", cxxopts::value<bool>()->default_value(default_dont_cache_binary_tables)) // NOLINT
-    ("sql_metrics", "Track SQL metrics (parse time etc.) for each SQL query and add it to the output JSON (see -o)", cxxopts::value<bool>()->default_value("false")); // NOLINT
+    ("sql_metrics", "Track SQL metrics (parse time etc.) for each SQL query and add it to the output JSON (see -o)", cxxopts::value<bool>()->default_value("false")) // NOLINT
+    ("hardware_counters", "Measure cycles, instructions, LLC misses, and branch misses per operator using perf_event_open. Added to the SQL metrics and visualizations", cxxopts::value<bool>()->default_value("false")) // NOLINT
+    ("arrival_rate", "Issue items open-loop at this rate (items/s) instead of using --clients. 0 means closed loop", cxxopts::value<double>()->default_value("0")) // NOLINT
+    ("arrival_process", "Inter-arrival times for --arrival_rate: Poisson or Constant", cxxopts::value<std::string>()->default_value("Poisson")) // NOLINT
+    ("slo", "p99 latency SLO in milliseconds. If set, sweeps the arrival rate (starting at --arrival_rate) to find the maximum sustainable throughput", cxxopts::value<uint64_t>()->default_value("0")) // NOLINT
+    ("optimizer_time_budget", "Time budget for optimizing a statement in microseconds. Optimizer rules that are expected to exceed it are skipped. 0 means no budget", cxxopts::value<uint64_t>()->default_value("0")); // NOLINT
   // clang-format on
 
   return cli_options;
@@ -462,7 +698,18 @@ nlohmann::json BenchmarkRunner::create_context(const BenchmarkConfig& config) {
       {"using_scheduler", config.enable_scheduler},
       {"cores", config.cores},
       {"clients", config.clients},
+      {"arrival_rate", config.arrival_rate ? nlohmann::json(*config.arrival_rate) : nlohmann::json()},
+      {"arrival_process", config.arrival_process == ArrivalProcess::Poisson ? "Poisson" : "Constant"},
+      {"latency_slo", config.latency_slo ? nlohmann::json(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                                               *config.latency_slo)
+                                                               .count())
+                                         : nlohmann::json()},
+      {"optimizer_time_budget",
+       config.optimizer_time_budget
+           ? nlohmann::json(std::chrono::duration_cast<std::chrono::nanoseconds>(*config.optimizer_time_budget).count())
+           : nlohmann::json()},
       {"verify", config.verify},
+      {"hardware_counters", config.hardware_counters},
       {"time_unit", "ns"},
       {"GIT-HASH", GIT_HEAD_SHA1 + std::string(GIT_IS_DIRTY ? "-dirty" : "")}};
 }
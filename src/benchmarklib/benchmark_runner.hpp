@@ -4,6 +4,7 @@
 
 #include <atomic>
 #include <chrono>
+#include <functional>
 #include <iostream>
 #include <optional>
 #include <unordered_map>
@@ -16,6 +17,7 @@
 #include "abstract_table_generator.hpp"
 #include "benchmark_item_result.hpp"
 #include "benchmark_state.hpp"
+#include "latency_histogram.hpp"
 #include "logical_query_plan/abstract_lqp_node.hpp"
 #include "operators/abstract_operator.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
@@ -34,6 +36,10 @@ class SQLiteWrapper;
 // The BenchmarkRunner is the main class for the benchmark framework. It gets initialized by the benchmark binaries
 // (e.g., tpch_benchmark.cpp). They then hand over the control to the BenchmarkRunner (inversion of control), which
 // calls the supplied table generator, runs and times the benchmark items, and reports the benchmark results.
+//
+// By default, `clients` items run in a closed loop, i.e., a new item is only issued once a previous one finished. If
+// an arrival rate is configured, items are issued open-loop instead. In that mode, latencies are measured from the
+// time at which an item was supposed to be issued, so that they include queueing delays.
 class BenchmarkRunner : Noncopyable {
  public:
   BenchmarkRunner(const BenchmarkConfig& config, std::unique_ptr<AbstractBenchmarkItemRunner> benchmark_item_runner,
@@ -49,6 +55,12 @@ class BenchmarkRunner : Noncopyable {
   std::shared_ptr<SQLiteWrapper> sqlite_wrapper;
 
  private:
+  // Run the benchmark in the configured BenchmarkMode. Resets previous results.
+  void _benchmark();
+
+  // Run the benchmark with increasing arrival rates to find the maximum rate at which the p99 latency meets the SLO
+  void _sweep_arrival_rate();
+
   // Run benchmark in BenchmarkMode::Shuffled mode
   void _benchmark_shuffled();
 
@@ -58,9 +70,22 @@ class BenchmarkRunner : Noncopyable {
   // Execute warmup run of a benchmark item
   void _warmup(const BenchmarkItemID item_id);
 
+  // Issues the items returned by @param next_item_id at _arrival_rate until the time is up or max_runs items have been
+  // issued
+  void _issue_open_loop(const std::function<BenchmarkItemID()>& next_item_id);
+
   // Schedules a run of the specified for execution. After execution, the result is updated. If the scheduler is
-  // disabled, the item is executed immediately.
-  void _schedule_item_run(const BenchmarkItemID item_id);
+  // disabled, the item is executed immediately. For open-loop runs, @param intended_start is the time at which the run
+  // was supposed to start. It is the begin of the measured latency and the run counts towards the results even if it
+  // finishes after the time is up.
+  void _schedule_item_run(const BenchmarkItemID item_id,
+                          const std::optional<std::chrono::steady_clock::time_point>& intended_start = std::nullopt);
+
+  // The time in which the results were measured (i.e., excluding warmup)
+  Duration _measured_duration() const;
+
+  // Latencies of all items
+  std::unique_ptr<LatencyHistogram> _total_latency_histogram() const;
 
   // Create a report in roughly the same format as google benchmarks do when run with --benchmark_format=json
   void _create_report(std::ostream& stream) const;
@@ -82,10 +107,21 @@ class BenchmarkRunner : Noncopyable {
   std::chrono::steady_clock::time_point _benchmark_start;
   Duration _total_run_duration{};
 
+  // The arrival rate (items/s) of open-loop runs, std::nullopt for closed-loop runs. Modified by sweeps.
+  std::optional<double> _arrival_rate;
+
+  // One entry per arrival rate measured by _sweep_arrival_rate()
+  nlohmann::json _sweep_steps = nlohmann::json::array();
+  std::optional<double> _max_sustainable_arrival_rate;
+
   // The atomic uints are modified by other threads when finishing an item, to keep track of when we can
   // let a simulated client schedule the next item, as well as the total number of finished items so far
   std::atomic_uint _currently_running_clients{0};
 
+  // The number of running clients per item, used to limit the clients of each item group (see
+  // AbstractBenchmarkItemRunner::item_groups())
+  std::vector<std::atomic_uint> _running_clients_by_item;
+
   // For BenchmarkMode::Shuffled, we count the number of runs executed across all items. This also includes items that
   // were unsuccessful (e.g., because of transaction aborts).
   std::atomic_uint _total_finished_runs{0};
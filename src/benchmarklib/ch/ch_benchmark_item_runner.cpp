@@ -0,0 +1,75 @@
+#include "ch_benchmark_item_runner.hpp"
+
+#include <string>
+#include <vector>
+
+#include "ch_queries.hpp"
+
+namespace opossum {
+
+namespace {
+
+constexpr auto TRANSACTION_COUNT = size_t{5};
+constexpr auto NEW_ORDER_ITEM_ID = BenchmarkItemID{1};
+
+}  // namespace
+
+CHBenchmarkItemRunner::CHBenchmarkItemRunner(const std::shared_ptr<BenchmarkConfig>& config, int num_warehouses,
+                                             uint32_t analytical_clients)
+    : TPCCBenchmarkItemRunner(config, num_warehouses),
+      _analytical_clients(analytical_clients),
+      _weights(TPCCBenchmarkItemRunner::weights()) {
+  // The queries are only weighted against each other, as they are run by separate clients
+  _weights.resize(TRANSACTION_COUNT + ch_queries.size(), 1);
+}
+
+const std::vector<BenchmarkItemID>& CHBenchmarkItemRunner::items() const {
+  static const auto items = [] {
+    auto item_ids = std::vector<BenchmarkItemID>(TRANSACTION_COUNT + ch_queries.size());
+    for (auto item_id = size_t{0}; item_id < item_ids.size(); ++item_id) {
+      item_ids[item_id] = BenchmarkItemID{item_id};
+    }
+    return item_ids;
+  }();
+  return items;
+}
+
+bool CHBenchmarkItemRunner::_on_execute_item(const BenchmarkItemID item_id, BenchmarkSQLExecutor& sql_executor) {
+  if (item_id < TRANSACTION_COUNT) return TPCCBenchmarkItemRunner::_on_execute_item(item_id, sql_executor);
+
+  const auto [status, table] = sql_executor.execute(ch_queries.at(item_id - TRANSACTION_COUNT + 1));
+  return status == SQLPipelineStatus::Success;
+}
+
+std::string CHBenchmarkItemRunner::item_name(const BenchmarkItemID item_id) const {
+  if (item_id < TRANSACTION_COUNT) return TPCCBenchmarkItemRunner::item_name(item_id);
+
+  Assert(item_id < items().size(), "Invalid item_id");
+  return "CH-Q" + std::to_string(item_id - TRANSACTION_COUNT + 1);
+}
+
+const std::vector<int>& CHBenchmarkItemRunner::weights() const { return _weights; }
+
+std::vector<AbstractBenchmarkItemRunner::ItemGroup> CHBenchmarkItemRunner::item_groups() const {
+  const auto& item_ids = items();
+  const auto first_query = item_ids.begin() + TRANSACTION_COUNT;
+  return {ItemGroup{"Transactional", {item_ids.begin(), first_query}, _config->clients},
+          ItemGroup{"Analytical", {first_query, item_ids.end()}, _analytical_clients}};
+}
+
+nlohmann::json CHBenchmarkItemRunner::summary_metrics(const std::vector<BenchmarkItemResult>& results,
+                                                      const Duration duration) const {
+  const auto seconds = std::chrono::duration<double>{duration}.count();
+  if (seconds == 0.0) return nlohmann::json::object();
+
+  auto query_count = size_t{0};
+  for (auto item_id = TRANSACTION_COUNT; item_id < results.size(); ++item_id) {
+    query_count += results[item_id].successful_runs.size();
+  }
+
+  return nlohmann::json{
+      {"tpmC", static_cast<double>(results[NEW_ORDER_ITEM_ID].successful_runs.size()) / seconds * 60.0},
+      {"QphH", static_cast<double>(query_count) / seconds * 3600.0}};
+}
+
+}  // namespace opossum
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <vector>
+
+#include "tpcc/tpcc_benchmark_item_runner.hpp"
+
+namespace opossum {
+
+/**
+ * Runs the items of the CH-benCHmark: the five TPC-C transactions (items 0 to 4, as in TPCCBenchmarkItemRunner) and
+ * the 22 CH queries (items 5 to 26). The transactions and the queries form separate item groups so that the
+ * transactional and the analytical clients can be configured independently.
+ */
+class CHBenchmarkItemRunner : public TPCCBenchmarkItemRunner {
+ public:
+  CHBenchmarkItemRunner(const std::shared_ptr<BenchmarkConfig>& config, int num_warehouses,
+                        uint32_t analytical_clients);
+
+  std::string item_name(const BenchmarkItemID item_id) const override;
+  const std::vector<BenchmarkItemID>& items() const override;
+
+  const std::vector<int>& weights() const override;
+
+  std::vector<ItemGroup> item_groups() const override;
+
+  // Reports tpmC (successful New-Order transactions per minute) and QphH (successful CH queries per hour)
+  nlohmann::json summary_metrics(const std::vector<BenchmarkItemResult>& results,
+                                 const Duration duration) const override;
+
+ protected:
+  bool _on_execute_item(const BenchmarkItemID item_id, BenchmarkSQLExecutor& sql_executor) override;
+
+  const uint32_t _analytical_clients;
+  std::vector<int> _weights;
+};
+
+}  // namespace opossum
@@ -0,0 +1,558 @@
+#include "ch_queries.hpp"
+
+/**
+ * The queries follow the CH-benCHmark specification (Cole et al., "The mixed workload CH-benCHmark", DBTest 2011).
+ * Changes that apply to all queries:
+ *  1. MOD((S_W_ID * S_I_ID), 10000) and ASCII(SUBSTR(C_STATE, 1, 1)) are precomputed as S_SU_SUPPKEY and C_N_NATIONKEY
+ *     (see CHTableGenerator) so that they can be used as join keys
+ *  2. dates are stored as UNIX timestamps (int)
+ *    a. date literals are replaced with their timestamps (e.g., 1167696000 for '2007-01-02 00:00:00')
+ *    b. the upper bounds 2012-01-02 and 2020-01-01 lie before the dates of the generated data, which uses the current
+ *       time; they are replaced with 2037-01-01 (2114380800) so that, as intended, they do not filter out any data
+ *    c. EXTRACT(YEAR FROM O_ENTRY_D) is approximated as O_ENTRY_D / 31556952 + 1970
+ *  3. nation and region names are upper case as in TPC-H, LIKE patterns are lower case as the generated strings
+ */
+
+namespace {
+
+/**
+ * CH 1
+ *
+ * Original:
+ *
+ * SELECT ol_number, sum(ol_quantity) AS sum_qty, sum(ol_amount) AS sum_amount, avg(ol_quantity) AS avg_qty,
+ *        avg(ol_amount) AS avg_amount, count(*) AS count_order
+ * FROM order_line
+ * WHERE ol_delivery_d > '2007-01-02 00:00:00.000000'
+ * GROUP BY ol_number
+ * ORDER BY ol_number
+ */
+const char* const ch_query_1 =
+    R"(SELECT OL_NUMBER, SUM(OL_QUANTITY) AS SUM_QTY, SUM(OL_AMOUNT) AS SUM_AMOUNT, AVG(OL_QUANTITY) AS AVG_QTY,
+      AVG(OL_AMOUNT) AS AVG_AMOUNT, COUNT(*) AS COUNT_ORDER
+      FROM ORDER_LINE
+      WHERE OL_DELIVERY_D > 1167696000
+      GROUP BY OL_NUMBER
+      ORDER BY OL_NUMBER;)";
+
+/**
+ * CH 2
+ *
+ * Original:
+ *
+ * SELECT su_suppkey, su_name, n_name, i_id, i_name, su_address, su_phone, su_comment
+ * FROM item, supplier, stock, nation, region,
+ *      (SELECT s_i_id AS m_i_id, min(s_quantity) AS m_s_quantity
+ *       FROM stock, supplier, nation, region
+ *       WHERE mod((s_w_id*s_i_id), 10000) = su_suppkey AND su_nationkey = n_nationkey AND n_regionkey = r_regionkey
+ *             AND r_name LIKE 'Europ%'
+ *       GROUP BY s_i_id) m
+ * WHERE i_id = s_i_id AND mod((s_w_id * s_i_id), 10000) = su_suppkey AND su_nationkey = n_nationkey
+ *       AND n_regionkey = r_regionkey AND i_data LIKE '%b' AND r_name LIKE 'Europ%' AND i_id = m_i_id
+ *       AND s_quantity = m_s_quantity
+ * ORDER BY n_name, su_name, i_id
+ */
+const char* const ch_query_2 =
+    R"(SELECT SU_SUPPKEY, SU_NAME, N_NAME, I_ID, I_NAME, SU_ADDRESS, SU_PHONE, SU_COMMENT
+      FROM ITEM, SUPPLIER, STOCK, NATION, REGION,
+        (SELECT S_I_ID AS M_I_ID, MIN(S_QUANTITY) AS M_S_QUANTITY
+         FROM STOCK, SUPPLIER, NATION, REGION
+         WHERE S_SU_SUPPKEY = SU_SUPPKEY AND SU_NATIONKEY = N_NATIONKEY AND N_REGIONKEY = R_REGIONKEY
+         AND R_NAME LIKE 'EUROP%'
+         GROUP BY S_I_ID) M
+      WHERE I_ID = S_I_ID AND S_SU_SUPPKEY = SU_SUPPKEY AND SU_NATIONKEY = N_NATIONKEY AND N_REGIONKEY = R_REGIONKEY
+      AND I_DATA LIKE '%b' AND R_NAME LIKE 'EUROP%' AND I_ID = M_I_ID AND S_QUANTITY = M_S_QUANTITY
+      ORDER BY N_NAME, SU_NAME, I_ID;)";
+
+/**
+ * CH 3
+ *
+ * Original:
+ *
+ * SELECT ol_o_id, ol_w_id, ol_d_id, sum(ol_amount) AS revenue, o_entry_d
+ * FROM customer, new_order, orders, order_line
+ * WHERE c_state LIKE 'A%' AND c_id = o_c_id AND c_w_id = o_w_id AND c_d_id = o_d_id AND no_w_id = o_w_id
+ *       AND no_d_id = o_d_id AND no_o_id = o_id AND ol_w_id = o_w_id AND ol_d_id = o_d_id AND ol_o_id = o_id
+ *       AND o_entry_d > '2007-01-02 00:00:00.000000'
+ * GROUP BY ol_o_id, ol_w_id, ol_d_id, o_entry_d
+ * ORDER BY revenue DESC, o_entry_d
+ */
+const char* const ch_query_3 =
+    R"(SELECT OL_O_ID, OL_W_ID, OL_D_ID, SUM(OL_AMOUNT) AS REVENUE, O_ENTRY_D
+      FROM CUSTOMER, NEW_ORDER, "ORDER", ORDER_LINE
+      WHERE C_STATE LIKE 'a%' AND C_ID = O_C_ID AND C_W_ID = O_W_ID AND C_D_ID = O_D_ID AND NO_W_ID = O_W_ID
+      AND NO_D_ID = O_D_ID AND NO_O_ID = O_ID AND OL_W_ID = O_W_ID AND OL_D_ID = O_D_ID AND OL_O_ID = O_ID
+      AND O_ENTRY_D > 1167696000
+      GROUP BY OL_O_ID, OL_W_ID, OL_D_ID, O_ENTRY_D
+      ORDER BY REVENUE DESC, O_ENTRY_D;)";
+
+/**
+ * CH 4
+ *
+ * Original:
+ *
+ * SELECT o_ol_cnt, count(*) AS order_count
+ * FROM orders
+ * WHERE o_entry_d >= '2007-01-02 00:00:00.000000' AND o_entry_d < '2012-01-02 00:00:00.000000'
+ *       AND EXISTS (SELECT * FROM order_line
+ *                   WHERE o_id = ol_o_id AND o_w_id = ol_w_id AND o_d_id = ol_d_id AND ol_delivery_d >= o_entry_d)
+ * GROUP BY o_ol_cnt
+ * ORDER BY o_ol_cnt
+ */
+const char* const ch_query_4 =
+    R"(SELECT O_OL_CNT, COUNT(*) AS ORDER_COUNT
+      FROM "ORDER"
+      WHERE O_ENTRY_D >= 1167696000 AND O_ENTRY_D < 2114380800
+      AND EXISTS (SELECT * FROM ORDER_LINE
+                  WHERE O_ID = OL_O_ID AND O_W_ID = OL_W_ID AND O_D_ID = OL_D_ID AND OL_DELIVERY_D >= O_ENTRY_D)
+      GROUP BY O_OL_CNT
+      ORDER BY O_OL_CNT;)";
+
+/**
+ * CH 5
+ *
+ * Original:
+ *
+ * SELECT n_name, sum(ol_amount) AS revenue
+ * FROM customer, orders, order_line, stock, supplier, nation, region
+ * WHERE c_id = o_c_id AND c_w_id = o_w_id AND c_d_id = o_d_id AND ol_o_id = o_id AND ol_w_id = o_w_id
+ *       AND ol_d_id = o_d_id AND ol_w_id = s_w_id AND ol_i_id = s_i_id AND mod((s_w_id * s_i_id), 10000) = su_suppkey
+ *       AND ascii(substr(c_state, 1, 1)) = su_nationkey AND su_nationkey = n_nationkey AND n_regionkey = r_regionkey
+ *       AND r_name = 'Europe' AND o_entry_d >= '2007-01-02 00:00:00.000000'
+ * GROUP BY n_name
+ * ORDER BY revenue DESC
+ */
+const char* const ch_query_5 =
+    R"(SELECT N_NAME, SUM(OL_AMOUNT) AS REVENUE
+      FROM CUSTOMER, "ORDER", ORDER_LINE, STOCK, SUPPLIER, NATION, REGION
+      WHERE C_ID = O_C_ID AND C_W_ID = O_W_ID AND C_D_ID = O_D_ID AND OL_O_ID = O_ID AND OL_W_ID = O_W_ID
+      AND OL_D_ID = O_D_ID AND OL_W_ID = S_W_ID AND OL_I_ID = S_I_ID AND S_SU_SUPPKEY = SU_SUPPKEY
+      AND C_N_NATIONKEY = SU_NATIONKEY AND SU_NATIONKEY = N_NATIONKEY AND N_REGIONKEY = R_REGIONKEY
+      AND R_NAME = 'EUROPE' AND O_ENTRY_D >= 1167696000
+      GROUP BY N_NAME
+      ORDER BY REVENUE DESC;)";
+
+/**
+ * CH 6
+ *
+ * Original:
+ *
+ * SELECT sum(ol_amount) AS revenue
+ * FROM order_line
+ * WHERE ol_delivery_d >= '1999-01-01 00:00:00.000000' AND ol_delivery_d < '2020-01-01 00:00:00.000000'
+ *       AND ol_quantity BETWEEN 1 AND 100000
+ */
+const char* const ch_query_6 =
+    R"(SELECT SUM(OL_AMOUNT) AS REVENUE
+      FROM ORDER_LINE
+      WHERE OL_DELIVERY_D >= 915148800 AND OL_DELIVERY_D < 2114380800 AND OL_QUANTITY BETWEEN 1 AND 100000;)";
+
+/**
+ * CH 7
+ *
+ * Original:
+ *
+ * SELECT su_nationkey AS supp_nation, substr(c_state, 1, 1) AS cust_nation, extract(year FROM o_entry_d) AS l_year,
+ *        sum(ol_amount) AS revenue
+ * FROM supplier, stock, order_line, orders, customer, nation n1, nation n2
+ * WHERE ol_supply_w_id = s_w_id AND ol_i_id = s_i_id AND mod((s_w_id * s_i_id), 10000) = su_suppkey
+ *       AND ol_w_id = o_w_id AND ol_d_id = o_d_id AND ol_o_id = o_id AND c_id = o_c_id AND c_w_id = o_w_id
+ *       AND c_d_id = o_d_id AND su_nationkey = n1.n_nationkey AND ascii(substr(c_state, 1, 1)) = n2.n_nationkey
+ *       AND ((n1.n_name = 'Germany' AND n2.n_name = 'Cambodia') OR (n1.n_name = 'Cambodia' AND n2.n_name = 'Germany'))
+ *       AND ol_delivery_d BETWEEN '2007-01-02 00:00:00.000000' AND '2012-01-02 00:00:00.000000'
+ * GROUP BY su_nationkey, substr(c_state, 1, 1), extract(year FROM o_entry_d)
+ * ORDER BY su_nationkey, cust_nation, l_year
+ */
+const char* const ch_query_7 =
+    R"(SELECT SU_NATIONKEY AS SUPP_NATION, SUBSTR(C_STATE, 1, 1) AS CUST_NATION, O_ENTRY_D / 31556952 + 1970 AS L_YEAR,
+      SUM(OL_AMOUNT) AS REVENUE
+      FROM SUPPLIER, STOCK, ORDER_LINE, "ORDER", CUSTOMER, NATION N1, NATION N2
+      WHERE OL_SUPPLY_W_ID = S_W_ID AND OL_I_ID = S_I_ID AND S_SU_SUPPKEY = SU_SUPPKEY
+      AND OL_W_ID = O_W_ID AND OL_D_ID = O_D_ID AND OL_O_ID = O_ID AND C_ID = O_C_ID AND C_W_ID = O_W_ID
+      AND C_D_ID = O_D_ID AND SU_NATIONKEY = N1.N_NATIONKEY AND C_N_NATIONKEY = N2.N_NATIONKEY
+      AND ((N1.N_NAME = 'GERMANY' AND N2.N_NAME = 'CAMBODIA') OR (N1.N_NAME = 'CAMBODIA' AND N2.N_NAME = 'GERMANY'))
+      AND OL_DELIVERY_D BETWEEN 1167696000 AND 2114380800
+      GROUP BY SU_NATIONKEY, SUBSTR(C_STATE, 1, 1), O_ENTRY_D / 31556952 + 1970
+      ORDER BY SUPP_NATION, CUST_NATION, L_YEAR;)";
+
+/**
+ * CH 8
+ *
+ * Original:
+ *
+ * SELECT extract(year FROM o_entry_d) AS l_year,
+ *        sum(CASE WHEN n2.n_name = 'Germany' THEN ol_amount ELSE 0 END) / sum(ol_amount) AS mkt_share
+ * FROM item, supplier, stock, order_line, orders, customer, nation n1, nation n2, region
+ * WHERE i_id = s_i_id AND ol_i_id = s_i_id AND ol_supply_w_id = s_w_id AND mod((s_w_id * s_i_id), 10000) = su_suppkey
+ *       AND ol_w_id = o_w_id AND ol_d_id = o_d_id AND ol_o_id = o_id AND c_id = o_c_id AND c_w_id = o_w_id
+ *       AND c_d_id = o_d_id AND n1.n_nationkey = ascii(substr(c_state, 1, 1)) AND n1.n_regionkey = r_regionkey
+ *       AND ol_i_id < 1000 AND r_name = 'Europe' AND su_nationkey = n2.n_nationkey
+ *       AND o_entry_d BETWEEN '2007-01-02 00:00:00.000000' AND '2012-01-02 00:00:00.000000' AND i_data LIKE '%b'
+ *       AND i_id = ol_i_id
+ * GROUP BY extract(year FROM o_entry_d)
+ * ORDER BY l_year
+ */
+const char* const ch_query_8 =
+    R"(SELECT O_ENTRY_D / 31556952 + 1970 AS L_YEAR,
+      SUM(CASE WHEN N2.N_NAME = 'GERMANY' THEN OL_AMOUNT ELSE 0 END) / SUM(OL_AMOUNT) AS MKT_SHARE
+      FROM ITEM, SUPPLIER, STOCK, ORDER_LINE, "ORDER", CUSTOMER, NATION N1, NATION N2, REGION
+      WHERE I_ID = S_I_ID AND OL_I_ID = S_I_ID AND OL_SUPPLY_W_ID = S_W_ID AND S_SU_SUPPKEY = SU_SUPPKEY
+      AND OL_W_ID = O_W_ID AND OL_D_ID = O_D_ID AND OL_O_ID = O_ID AND C_ID = O_C_ID AND C_W_ID = O_W_ID
+      AND C_D_ID = O_D_ID AND N1.N_NATIONKEY = C_N_NATIONKEY AND N1.N_REGIONKEY = R_REGIONKEY
+      AND OL_I_ID < 1000 AND R_NAME = 'EUROPE' AND SU_NATIONKEY = N2.N_NATIONKEY
+      AND O_ENTRY_D BETWEEN 1167696000 AND 2114380800 AND I_DATA LIKE '%b' AND I_ID = OL_I_ID
+      GROUP BY O_ENTRY_D / 31556952 + 1970
+      ORDER BY L_YEAR;)";
+
+/**
+ * CH 9
+ *
+ * Original:
+ *
+ * SELECT n_name, extract(year FROM o_entry_d) AS l_year, sum(ol_amount) AS sum_profit
+ * FROM item, stock, supplier, order_line, orders, nation
+ * WHERE ol_i_id = s_i_id AND ol_supply_w_id = s_w_id AND mod((s_w_id * s_i_id), 10000) = su_suppkey
+ *       AND ol_w_id = o_w_id AND ol_d_id = o_d_id AND ol_o_id = o_id AND ol_i_id = i_id AND su_nationkey = n_nationkey
+ *       AND i_data LIKE '%BB'
+ * GROUP BY n_name, extract(year FROM o_entry_d)
+ * ORDER BY n_name, l_year DESC
+ */
+const char* const ch_query_9 =
+    R"(SELECT N_NAME, O_ENTRY_D / 31556952 + 1970 AS L_YEAR, SUM(OL_AMOUNT) AS SUM_PROFIT
+      FROM ITEM, STOCK, SUPPLIER, ORDER_LINE, "ORDER", NATION
+      WHERE OL_I_ID = S_I_ID AND OL_SUPPLY_W_ID = S_W_ID AND S_SU_SUPPKEY = SU_SUPPKEY
+      AND OL_W_ID = O_W_ID AND OL_D_ID = O_D_ID AND OL_O_ID = O_ID AND OL_I_ID = I_ID AND SU_NATIONKEY = N_NATIONKEY
+      AND I_DATA LIKE '%bb'
+      GROUP BY N_NAME, O_ENTRY_D / 31556952 + 1970
+      ORDER BY N_NAME, L_YEAR DESC;)";
+
+/**
+ * CH 10
+ *
+ * Original:
+ *
+ * SELECT c_id, c_last, sum(ol_amount) AS revenue, c_city, c_phone, n_name
+ * FROM customer, orders, order_line, nation
+ * WHERE c_id = o_c_id AND c_w_id = o_w_id AND c_d_id = o_d_id AND ol_w_id = o_w_id AND ol_d_id = o_d_id
+ *       AND ol_o_id = o_id AND o_entry_d >= '2007-01-02 00:00:00.000000' AND o_entry_d <= ol_delivery_d
+ *       AND n_nationkey = ascii(substr(c_state, 1, 1))
+ * GROUP BY c_id, c_last, c_city, c_phone, n_name
+ * ORDER BY revenue DESC
+ */
+const char* const ch_query_10 =
+    R"(SELECT C_ID, C_LAST, SUM(OL_AMOUNT) AS REVENUE, C_CITY, C_PHONE, N_NAME
+      FROM CUSTOMER, "ORDER", ORDER_LINE, NATION
+      WHERE C_ID = O_C_ID AND C_W_ID = O_W_ID AND C_D_ID = O_D_ID AND OL_W_ID = O_W_ID AND OL_D_ID = O_D_ID
+      AND OL_O_ID = O_ID AND O_ENTRY_D >= 1167696000 AND O_ENTRY_D <= OL_DELIVERY_D AND N_NATIONKEY = C_N_NATIONKEY
+      GROUP BY C_ID, C_LAST, C_CITY, C_PHONE, N_NAME
+      ORDER BY REVENUE DESC;)";
+
+/**
+ * CH 11
+ *
+ * Original:
+ *
+ * SELECT s_i_id, sum(s_order_cnt) AS ordercount
+ * FROM stock, supplier, nation
+ * WHERE mod((s_w_id * s_i_id), 10000) = su_suppkey AND su_nationkey = n_nationkey AND n_name = 'Germany'
+ * GROUP BY s_i_id
+ * HAVING sum(s_order_cnt) > (SELECT sum(s_order_cnt) * .005
+ *                            FROM stock, supplier, nation
+ *                            WHERE mod((s_w_id * s_i_id), 10000) = su_suppkey AND su_nationkey = n_nationkey
+ *                                  AND n_name = 'Germany')
+ * ORDER BY ordercount DESC
+ */
+const char* const ch_query_11 =
+    R"(SELECT S_I_ID, SUM(S_ORDER_CNT) AS ORDERCOUNT
+      FROM STOCK, SUPPLIER, NATION
+      WHERE S_SU_SUPPKEY = SU_SUPPKEY AND SU_NATIONKEY = N_NATIONKEY AND N_NAME = 'GERMANY'
+      GROUP BY S_I_ID
+      HAVING SUM(S_ORDER_CNT) > (SELECT SUM(S_ORDER_CNT) * .005
+                                 FROM STOCK, SUPPLIER, NATION
+                                 WHERE S_SU_SUPPKEY = SU_SUPPKEY AND SU_NATIONKEY = N_NATIONKEY
+                                 AND N_NAME = 'GERMANY')
+      ORDER BY ORDERCOUNT DESC;)";
+
+/**
+ * CH 12
+ *
+ * Original:
+ *
+ * SELECT o_ol_cnt, sum(CASE WHEN o_carrier_id = 1 OR o_carrier_id = 2 THEN 1 ELSE 0 END) AS high_line_count,
+ *        sum(CASE WHEN o_carrier_id <> 1 AND o_carrier_id <> 2 THEN 1 ELSE 0 END) AS low_line_count
+ * FROM orders, order_line
+ * WHERE ol_w_id = o_w_id AND ol_d_id = o_d_id AND ol_o_id = o_id AND o_entry_d <= ol_delivery_d
+ *       AND ol_delivery_d < '2020-01-01 00:00:00.000000'
+ * GROUP BY o_ol_cnt
+ * ORDER BY o_ol_cnt
+ */
+const char* const ch_query_12 =
+    R"(SELECT O_OL_CNT, SUM(CASE WHEN O_CARRIER_ID = 1 OR O_CARRIER_ID = 2 THEN 1 ELSE 0 END) AS HIGH_LINE_COUNT,
+      SUM(CASE WHEN O_CARRIER_ID <> 1 AND O_CARRIER_ID <> 2 THEN 1 ELSE 0 END) AS LOW_LINE_COUNT
+      FROM "ORDER", ORDER_LINE
+      WHERE OL_W_ID = O_W_ID AND OL_D_ID = O_D_ID AND OL_O_ID = O_ID AND O_ENTRY_D <= OL_DELIVERY_D
+      AND OL_DELIVERY_D < 2114380800
+      GROUP BY O_OL_CNT
+      ORDER BY O_OL_CNT;)";
+
+/**
+ * CH 13
+ *
+ * Original:
+ *
+ * SELECT c_count, count(*) AS custdist
+ * FROM (SELECT c_id, count(o_id)
+ *       FROM customer LEFT OUTER JOIN orders ON (c_w_id = o_w_id AND c_d_id = o_d_id AND c_id = o_c_id
+ *                                                AND o_carrier_id > 8)
+ *       GROUP BY c_id) AS c_orders (c_id, c_count)
+ * GROUP BY c_count
+ * ORDER BY custdist DESC, c_count DESC
+ *
+ * Changes:
+ *  1. Column alias lists are not supported, the count is aliased in the subquery (as in TPC-H 13)
+ *  2. c_id is not unique across districts, so the customers are grouped by their full key
+ */
+const char* const ch_query_13 =
+    R"(SELECT C_COUNT, COUNT(*) AS CUSTDIST
+      FROM (SELECT C_W_ID, C_D_ID, C_ID, COUNT(O_ID) AS C_COUNT
+            FROM CUSTOMER LEFT OUTER JOIN "ORDER" ON C_W_ID = O_W_ID AND C_D_ID = O_D_ID AND C_ID = O_C_ID
+                                                AND O_CARRIER_ID > 8
+            GROUP BY C_W_ID, C_D_ID, C_ID) AS C_ORDERS
+      GROUP BY C_COUNT
+      ORDER BY CUSTDIST DESC, C_COUNT DESC;)";
+
+/**
+ * CH 14
+ *
+ * Original:
+ *
+ * SELECT 100.00 * sum(CASE WHEN i_data LIKE 'PR%' THEN ol_amount ELSE 0 END) / (1 + sum(ol_amount)) AS promo_revenue
+ * FROM order_line, item
+ * WHERE ol_i_id = i_id AND ol_delivery_d >= '2007-01-02 00:00:00.000000'
+ *       AND ol_delivery_d < '2020-01-02 00:00:00.000000'
+ */
+const char* const ch_query_14 =
+    R"(SELECT 100.00 * SUM(CASE WHEN I_DATA LIKE 'pr%' THEN OL_AMOUNT ELSE 0 END) / (1 + SUM(OL_AMOUNT))
+      AS PROMO_REVENUE
+      FROM ORDER_LINE, ITEM
+      WHERE OL_I_ID = I_ID AND OL_DELIVERY_D >= 1167696000 AND OL_DELIVERY_D < 2114380800;)";
+
+/**
+ * CH 15
+ *
+ * Original:
+ *
+ * WITH revenue (supplier_no, total_revenue) AS (
+ *      SELECT mod((s_w_id * s_i_id), 10000) AS supplier_no, sum(ol_amount) AS total_revenue
+ *      FROM order_line, stock
+ *      WHERE ol_i_id = s_i_id AND ol_supply_w_id = s_w_id AND ol_delivery_d >= '2007-01-02 00:00:00.000000'
+ *      GROUP BY mod((s_w_id * s_i_id), 10000))
+ * SELECT su_suppkey, su_name, su_address, su_phone, total_revenue
+ * FROM supplier, revenue
+ * WHERE su_suppkey = supplier_no AND total_revenue = (SELECT max(total_revenue) FROM revenue)
+ * ORDER BY su_suppkey
+ *
+ * Changes:
+ *  1. WITH is not supported. Unlike TPC-H 15, the revenue is not created as a view, as views are global and the
+ *     query might run in multiple clients at the same time. Instead, the subquery is inlined twice.
+ */
+const char* const ch_query_15 =
+    R"(SELECT SU_SUPPKEY, SU_NAME, SU_ADDRESS, SU_PHONE, TOTAL_REVENUE
+      FROM SUPPLIER,
+        (SELECT S_SU_SUPPKEY AS SUPPLIER_NO, SUM(OL_AMOUNT) AS TOTAL_REVENUE
+         FROM ORDER_LINE, STOCK
+         WHERE OL_I_ID = S_I_ID AND OL_SUPPLY_W_ID = S_W_ID AND OL_DELIVERY_D >= 1167696000
+         GROUP BY S_SU_SUPPKEY) AS REVENUE
+      WHERE SU_SUPPKEY = SUPPLIER_NO AND TOTAL_REVENUE = (
+        SELECT MAX(TOTAL_REVENUE) FROM
+          (SELECT S_SU_SUPPKEY AS SUPPLIER_NO, SUM(OL_AMOUNT) AS TOTAL_REVENUE
+           FROM ORDER_LINE, STOCK
+           WHERE OL_I_ID = S_I_ID AND OL_SUPPLY_W_ID = S_W_ID AND OL_DELIVERY_D >= 1167696000
+           GROUP BY S_SU_SUPPKEY) AS MAX_REVENUE)
+      ORDER BY SU_SUPPKEY;)";
+
+/**
+ * CH 16
+ *
+ * Original:
+ *
+ * SELECT i_name, substr(i_data, 1, 3) AS brand, i_price,
+ *        count(DISTINCT (mod((s_w_id * s_i_id), 10000))) AS supplier_cnt
+ * FROM stock, item
+ * WHERE i_id = s_i_id AND i_data NOT LIKE 'zz%'
+ *       AND (mod((s_w_id * s_i_id), 10000) NOT IN (SELECT su_suppkey FROM supplier WHERE su_comment LIKE '%bad%'))
+ * GROUP BY i_name, substr(i_data, 1, 3), i_price
+ * ORDER BY supplier_cnt DESC
+ */
+const char* const ch_query_16 =
+    R"(SELECT I_NAME, SUBSTR(I_DATA, 1, 3) AS BRAND, I_PRICE, COUNT(DISTINCT S_SU_SUPPKEY) AS SUPPLIER_CNT
+      FROM STOCK, ITEM
+      WHERE I_ID = S_I_ID AND I_DATA NOT LIKE 'zz%'
+      AND S_SU_SUPPKEY NOT IN (SELECT SU_SUPPKEY FROM SUPPLIER WHERE SU_COMMENT LIKE '%bad%')
+      GROUP BY I_NAME, SUBSTR(I_DATA, 1, 3), I_PRICE
+      ORDER BY SUPPLIER_CNT DESC;)";
+
+/**
+ * CH 17
+ *
+ * Original:
+ *
+ * SELECT sum(ol_amount) / 2.0 AS avg_yearly
+ * FROM order_line, (SELECT i_id, avg(ol_quantity) AS a
+ *                   FROM item, order_line
+ *                   WHERE i_data LIKE '%b' AND ol_i_id = i_id
+ *                   GROUP BY i_id) t
+ * WHERE ol_i_id = t.i_id AND ol_quantity < t.a
+ */
+const char* const ch_query_17 =
+    R"(SELECT SUM(OL_AMOUNT) / 2.0 AS AVG_YEARLY
+      FROM ORDER_LINE, (SELECT I_ID, AVG(OL_QUANTITY) AS A
+                        FROM ITEM, ORDER_LINE
+                        WHERE I_DATA LIKE '%b' AND OL_I_ID = I_ID
+                        GROUP BY I_ID) T
+      WHERE OL_I_ID = T.I_ID AND OL_QUANTITY < T.A;)";
+
+/**
+ * CH 18
+ *
+ * Original:
+ *
+ * SELECT c_last, c_id, o_id, o_entry_d, o_ol_cnt, sum(ol_amount) AS amount_sum
+ * FROM customer, orders, order_line
+ * WHERE c_id = o_c_id AND c_w_id = o_w_id AND c_d_id = o_d_id AND ol_w_id = o_w_id AND ol_d_id = o_d_id
+ *       AND ol_o_id = o_id
+ * GROUP BY o_id, o_w_id, o_d_id, c_id, c_last, o_entry_d, o_ol_cnt
+ * HAVING sum(ol_amount) > 200
+ * ORDER BY amount_sum DESC, o_entry_d
+ */
+const char* const ch_query_18 =
+    R"(SELECT C_LAST, C_ID, O_ID, O_ENTRY_D, O_OL_CNT, SUM(OL_AMOUNT) AS AMOUNT_SUM
+      FROM CUSTOMER, "ORDER", ORDER_LINE
+      WHERE C_ID = O_C_ID AND C_W_ID = O_W_ID AND C_D_ID = O_D_ID AND OL_W_ID = O_W_ID AND OL_D_ID = O_D_ID
+      AND OL_O_ID = O_ID
+      GROUP BY O_ID, O_W_ID, O_D_ID, C_ID, C_LAST, O_ENTRY_D, O_OL_CNT
+      HAVING SUM(OL_AMOUNT) > 200
+      ORDER BY AMOUNT_SUM DESC, O_ENTRY_D;)";
+
+/**
+ * CH 19
+ *
+ * Original:
+ *
+ * SELECT sum(ol_amount) AS revenue
+ * FROM order_line, item
+ * WHERE (ol_i_id = i_id AND i_data LIKE '%a' AND ol_quantity >= 1 AND ol_quantity <= 10
+ *        AND i_price BETWEEN 1 AND 400000 AND ol_w_id IN (1, 2, 3))
+ *    OR (ol_i_id = i_id AND i_data LIKE '%b' AND ol_quantity >= 1 AND ol_quantity <= 10
+ *        AND i_price BETWEEN 1 AND 400000 AND ol_w_id IN (1, 2, 4))
+ *    OR (ol_i_id = i_id AND i_data LIKE '%c' AND ol_quantity >= 1 AND ol_quantity <= 10
+ *        AND i_price BETWEEN 1 AND 400000 AND ol_w_id IN (1, 5, 3))
+ *
+ * Changes:
+ *  1. The join predicate ol_i_id = i_id is factored out of the disjunction so that it is not planned as a cross join
+ */
+const char* const ch_query_19 =
+    R"(SELECT SUM(OL_AMOUNT) AS REVENUE
+      FROM ORDER_LINE, ITEM
+      WHERE OL_I_ID = I_ID AND (
+         (I_DATA LIKE '%a' AND OL_QUANTITY >= 1 AND OL_QUANTITY <= 10
+          AND I_PRICE BETWEEN 1 AND 400000 AND OL_W_ID IN (1, 2, 3))
+      OR (I_DATA LIKE '%b' AND OL_QUANTITY >= 1 AND OL_QUANTITY <= 10
+          AND I_PRICE BETWEEN 1 AND 400000 AND OL_W_ID IN (1, 2, 4))
+      OR (I_DATA LIKE '%c' AND OL_QUANTITY >= 1 AND OL_QUANTITY <= 10
+          AND I_PRICE BETWEEN 1 AND 400000 AND OL_W_ID IN (1, 5, 3)));)";
+
+/**
+ * CH 20
+ *
+ * Original:
+ *
+ * SELECT su_name, su_address
+ * FROM supplier, nation
+ * WHERE su_suppkey IN (SELECT mod(s_i_id * s_w_id, 10000)
+ *                      FROM stock, order_line
+ *                      WHERE s_i_id IN (SELECT i_id FROM item WHERE i_data LIKE 'co%') AND ol_i_id = s_i_id
+ *                            AND ol_delivery_d > '2010-05-23 12:00:00'
+ *                      GROUP BY s_i_id, s_w_id, s_quantity
+ *                      HAVING 2 * s_quantity > sum(ol_quantity))
+ *       AND su_nationkey = n_nationkey AND n_name = 'Germany'
+ * ORDER BY su_name
+ *
+ * Changes:
+ *  1. S_SU_SUPPKEY is added to the GROUP BY columns (it is functionally dependent on s_i_id and s_w_id)
+ */
+const char* const ch_query_20 =
+    R"(SELECT SU_NAME, SU_ADDRESS
+      FROM SUPPLIER, NATION
+      WHERE SU_SUPPKEY IN (SELECT S_SU_SUPPKEY
+                           FROM STOCK, ORDER_LINE
+                           WHERE S_I_ID IN (SELECT I_ID FROM ITEM WHERE I_DATA LIKE 'co%') AND OL_I_ID = S_I_ID
+                           AND OL_DELIVERY_D > 1274616000
+                           GROUP BY S_I_ID, S_W_ID, S_QUANTITY, S_SU_SUPPKEY
+                           HAVING 2 * S_QUANTITY > SUM(OL_QUANTITY))
+      AND SU_NATIONKEY = N_NATIONKEY AND N_NAME = 'GERMANY'
+      ORDER BY SU_NAME;)";
+
+/**
+ * CH 21
+ *
+ * Original:
+ *
+ * SELECT su_name, count(*) AS numwait
+ * FROM supplier, order_line l1, orders, stock, nation
+ * WHERE ol_o_id = o_id AND ol_w_id = o_w_id AND ol_d_id = o_d_id AND ol_w_id = s_w_id AND ol_i_id = s_i_id
+ *       AND mod((s_w_id * s_i_id), 10000) = su_suppkey AND l1.ol_delivery_d > o_entry_d
+ *       AND NOT EXISTS (SELECT * FROM order_line l2
+ *                       WHERE l2.ol_o_id = l1.ol_o_id AND l2.ol_w_id = l1.ol_w_id AND l2.ol_d_id = l1.ol_d_id
+ *                             AND l2.ol_delivery_d > l1.ol_delivery_d)
+ *       AND su_nationkey = n_nationkey AND n_name = 'Germany'
+ * GROUP BY su_name
+ * ORDER BY numwait DESC, su_name
+ */
+const char* const ch_query_21 =
+    R"(SELECT SU_NAME, COUNT(*) AS NUMWAIT
+      FROM SUPPLIER, ORDER_LINE L1, "ORDER", STOCK, NATION
+      WHERE L1.OL_O_ID = O_ID AND L1.OL_W_ID = O_W_ID AND L1.OL_D_ID = O_D_ID AND L1.OL_W_ID = S_W_ID
+      AND L1.OL_I_ID = S_I_ID AND S_SU_SUPPKEY = SU_SUPPKEY AND L1.OL_DELIVERY_D > O_ENTRY_D
+      AND NOT EXISTS (SELECT * FROM ORDER_LINE L2
+                      WHERE L2.OL_O_ID = L1.OL_O_ID AND L2.OL_W_ID = L1.OL_W_ID AND L2.OL_D_ID = L1.OL_D_ID
+                      AND L2.OL_DELIVERY_D > L1.OL_DELIVERY_D)
+      AND SU_NATIONKEY = N_NATIONKEY AND N_NAME = 'GERMANY'
+      GROUP BY SU_NAME
+      ORDER BY NUMWAIT DESC, SU_NAME;)";
+
+/**
+ * CH 22
+ *
+ * Original:
+ *
+ * SELECT substr(c_state, 1, 1) AS country, count(*) AS numcust, sum(c_balance) AS totacctbal
+ * FROM customer
+ * WHERE substr(c_phone, 1, 1) IN ('1', '2', '3', '4', '5', '6', '7')
+ *       AND c_balance > (SELECT avg(c_balance) FROM customer
+ *                        WHERE c_balance > 0.00 AND substr(c_phone, 1, 1) IN ('1', '2', '3', '4', '5', '6', '7'))
+ *       AND NOT EXISTS (SELECT * FROM orders WHERE o_c_id = c_id AND o_w_id = c_w_id AND o_d_id = c_d_id)
+ * GROUP BY substr(c_state, 1, 1)
+ * ORDER BY substr(c_state, 1, 1)
+ */
+const char* const ch_query_22 =
+    R"(SELECT SUBSTR(C_STATE, 1, 1) AS COUNTRY, COUNT(*) AS NUMCUST, SUM(C_BALANCE) AS TOTACCTBAL
+      FROM CUSTOMER
+      WHERE SUBSTR(C_PHONE, 1, 1) IN ('1', '2', '3', '4', '5', '6', '7')
+      AND C_BALANCE > (SELECT AVG(C_BALANCE) FROM CUSTOMER
+                       WHERE C_BALANCE > 0.00 AND SUBSTR(C_PHONE, 1, 1) IN ('1', '2', '3', '4', '5', '6', '7'))
+      AND NOT EXISTS (SELECT * FROM "ORDER" WHERE O_C_ID = C_ID AND O_W_ID = C_W_ID AND O_D_ID = C_D_ID)
+      GROUP BY SUBSTR(C_STATE, 1, 1)
+      ORDER BY COUNTRY;)";
+
+}  // namespace
+
+namespace opossum {
+
+const std::map<size_t, const char*> ch_queries = {
+    {1, ch_query_1},   {2, ch_query_2},   {3, ch_query_3},   {4, ch_query_4},   {5, ch_query_5},   {6, ch_query_6},
+    {7, ch_query_7},   {8, ch_query_8},   {9, ch_query_9},   {10, ch_query_10}, {11, ch_query_11}, {12, ch_query_12},
+    {13, ch_query_13}, {14, ch_query_14}, {15, ch_query_15}, {16, ch_query_16}, {17, ch_query_17}, {18, ch_query_18},
+    {19, ch_query_19}, {20, ch_query_20}, {21, ch_query_21}, {22, ch_query_22}};
+
+}  // namespace opossum
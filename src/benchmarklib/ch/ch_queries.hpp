@@ -0,0 +1,14 @@
+#pragma once
+
+#include <cstdlib>
+#include <map>
+
+namespace opossum {
+
+/**
+ * Contains the 22 analytical queries of the CH-benCHmark, which are adapted from the TPC-H queries to run on the
+ * TPC-C schema. Use ordered map to have queries sorted by query id.
+ */
+extern const std::map<size_t, const char*> ch_queries;
+
+}  // namespace opossum
@@ -0,0 +1,194 @@
+#include "ch_table_generator.hpp"
+
+#include <array>
+#include <functional>
+#include <string_view>
+#include <utility>
+
+#include "storage/chunk.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+namespace {
+
+constexpr auto NUM_SUPPLIERS = int32_t{10'000};
+
+// The nation keys are the ASCII codes of the characters that C_STATE may start with (see ASCII(SUBSTR(C_STATE, 1, 1))
+// in the CH queries)
+constexpr auto NATION_KEY_CHARACTERS =
+    std::string_view{"0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz"};
+
+const auto REGION_NAMES = std::array<std::string, 5>{"AFRICA", "AMERICA", "ASIA", "EUROPE", "MIDDLE EAST"};
+
+// Names and region keys of the 62 nations
+const auto NATIONS = std::array<std::pair<std::string, int32_t>, NATION_KEY_CHARACTERS.size()>{{
+    {"ALGERIA", 0},      {"CAMEROON", 0},     {"EGYPT", 0},        {"ETHIOPIA", 0},       {"GHANA", 0},
+    {"KENYA", 0},        {"MOROCCO", 0},      {"MOZAMBIQUE", 0},   {"NIGERIA", 0},        {"SENEGAL", 0},
+    {"SOUTH AFRICA", 0}, {"TANZANIA", 0},     {"ARGENTINA", 1},    {"BOLIVIA", 1},        {"BRAZIL", 1},
+    {"CANADA", 1},       {"CHILE", 1},        {"COLOMBIA", 1},     {"CUBA", 1},           {"ECUADOR", 1},
+    {"MEXICO", 1},       {"PERU", 1},         {"UNITED STATES", 1}, {"URUGUAY", 1},       {"BANGLADESH", 2},
+    {"CAMBODIA", 2},     {"CHINA", 2},        {"INDIA", 2},        {"INDONESIA", 2},      {"JAPAN", 2},
+    {"MALAYSIA", 2},     {"NEPAL", 2},        {"PAKISTAN", 2},     {"PHILIPPINES", 2},    {"SOUTH KOREA", 2},
+    {"THAILAND", 2},     {"VIETNAM", 2},      {"AUSTRIA", 3},      {"BELGIUM", 3},        {"FRANCE", 3},
+    {"GERMANY", 3},      {"GREECE", 3},       {"IRELAND", 3},      {"ITALY", 3},          {"NETHERLANDS", 3},
+    {"POLAND", 3},       {"PORTUGAL", 3},     {"ROMANIA", 3},      {"RUSSIA", 3},         {"SPAIN", 3},
+    {"BAHRAIN", 4},      {"IRAN", 4},         {"IRAQ", 4},         {"ISRAEL", 4},         {"JORDAN", 4},
+    {"KUWAIT", 4},       {"LEBANON", 4},      {"OMAN", 4},         {"QATAR", 4},          {"SAUDI ARABIA", 4},
+    {"SYRIA", 4},        {"TURKEY", 4},
+}};
+
+std::shared_ptr<Table> create_table(const TableColumnDefinitions& column_definitions,
+                                    const std::vector<Segments>& segments_by_chunk, const ChunkOffset chunk_size) {
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data, chunk_size, UseMvcc::Yes);
+  for (const auto& segments : segments_by_chunk) {
+    const auto mvcc_data = std::make_shared<MvccData>(segments.front()->size(), CommitID{0});
+    table->append_chunk(segments, mvcc_data);
+  }
+  return table;
+}
+
+// Returns a copy of @param table with an additional int column whose values are computed from each chunk of the table
+std::shared_ptr<Table> add_column(const std::shared_ptr<Table>& table, const std::string& column_name,
+                                  const std::function<pmr_vector<int32_t>(const Chunk&)>& generate_values) {
+  auto column_definitions = table->column_definitions();
+  column_definitions.emplace_back(column_name, DataType::Int, false);
+
+  auto extended_table =
+      std::make_shared<Table>(column_definitions, TableType::Data, table->target_chunk_size(), UseMvcc::Yes);
+  const auto chunk_count = table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+
+    auto segments = Segments{};
+    for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+      segments.emplace_back(chunk->get_segment(column_id));
+    }
+    segments.emplace_back(std::make_shared<ValueSegment<int32_t>>(generate_values(*chunk)));
+
+    extended_table->append_chunk(segments, std::make_shared<MvccData>(chunk->size(), CommitID{0}));
+  }
+  extended_table->set_allow_in_place_updates(table->allows_in_place_updates());
+
+  return extended_table;
+}
+
+// The tables are freshly generated and not yet encoded
+template <typename T>
+const pmr_vector<T>& values(const Chunk& chunk, const ColumnID column_id) {
+  return static_cast<const ValueSegment<T>&>(*chunk.get_segment(column_id)).values();
+}
+
+}  // namespace
+
+std::shared_ptr<Table> CHTableGenerator::generate_supplier_table() {
+  auto cardinalities = std::make_shared<std::vector<size_t>>(std::initializer_list<size_t>{NUM_SUPPLIERS});
+
+  /**
+   * indices[0] = supplier
+   */
+  std::vector<Segments> segments_by_chunk;
+  TableColumnDefinitions column_definitions;
+
+  // MOD((S_W_ID * S_I_ID), 10000) starts at 0
+  _add_column<int32_t>(segments_by_chunk, column_definitions, "SU_SUPPKEY", cardinalities,
+                       [&](std::vector<size_t> indices) { return indices[0]; });
+  _add_column<pmr_string>(segments_by_chunk, column_definitions, "SU_NAME", cardinalities,
+                          [&](std::vector<size_t> indices) {
+                            auto name = std::to_string(indices[0]);
+                            return pmr_string{"Supplier#" + std::string(9 - name.size(), '0') + name};
+                          });
+  _add_column<pmr_string>(segments_by_chunk, column_definitions, "SU_ADDRESS", cardinalities,
+                          [&](std::vector<size_t>) { return pmr_string{_random_gen.astring(10, 40)}; });
+  _add_column<int32_t>(segments_by_chunk, column_definitions, "SU_NATIONKEY", cardinalities, [&](std::vector<size_t>) {
+    return NATION_KEY_CHARACTERS[_random_gen.random_number(0, NATION_KEY_CHARACTERS.size() - 1)];
+  });
+  _add_column<pmr_string>(segments_by_chunk, column_definitions, "SU_PHONE", cardinalities,
+                          [&](std::vector<size_t>) { return pmr_string{_random_gen.nstring(15, 15)}; });
+  _add_column<float>(segments_by_chunk, column_definitions, "SU_ACCTBAL", cardinalities, [&](std::vector<size_t>) {
+    return static_cast<float>(_random_gen.random_number(-99'999, 999'999)) / 100.f;
+  });
+  _add_column<pmr_string>(segments_by_chunk, column_definitions, "SU_COMMENT", cardinalities,
+                          [&](std::vector<size_t>) { return pmr_string{_random_gen.astring(25, 100)}; });
+
+  return create_table(column_definitions, segments_by_chunk, _benchmark_config->chunk_size);
+}
+
+std::shared_ptr<Table> CHTableGenerator::generate_nation_table() {
+  auto cardinalities = std::make_shared<std::vector<size_t>>(std::initializer_list<size_t>{NATIONS.size()});
+
+  /**
+   * indices[0] = nation
+   */
+  std::vector<Segments> segments_by_chunk;
+  TableColumnDefinitions column_definitions;
+
+  _add_column<int32_t>(segments_by_chunk, column_definitions, "N_NATIONKEY", cardinalities,
+                       [&](std::vector<size_t> indices) { return NATION_KEY_CHARACTERS[indices[0]]; });
+  _add_column<pmr_string>(segments_by_chunk, column_definitions, "N_NAME", cardinalities,
+                          [&](std::vector<size_t> indices) { return pmr_string{NATIONS[indices[0]].first}; });
+  _add_column<int32_t>(segments_by_chunk, column_definitions, "N_REGIONKEY", cardinalities,
+                       [&](std::vector<size_t> indices) { return NATIONS[indices[0]].second; });
+  _add_column<pmr_string>(segments_by_chunk, column_definitions, "N_COMMENT", cardinalities,
+                          [&](std::vector<size_t>) { return pmr_string{_random_gen.astring(31, 114)}; });
+
+  return create_table(column_definitions, segments_by_chunk, _benchmark_config->chunk_size);
+}
+
+std::shared_ptr<Table> CHTableGenerator::generate_region_table() {
+  auto cardinalities = std::make_shared<std::vector<size_t>>(std::initializer_list<size_t>{REGION_NAMES.size()});
+
+  /**
+   * indices[0] = region
+   */
+  std::vector<Segments> segments_by_chunk;
+  TableColumnDefinitions column_definitions;
+
+  _add_column<int32_t>(segments_by_chunk, column_definitions, "R_REGIONKEY", cardinalities,
+                       [&](std::vector<size_t> indices) { return indices[0]; });
+  _add_column<pmr_string>(segments_by_chunk, column_definitions, "R_NAME", cardinalities,
+                          [&](std::vector<size_t> indices) { return pmr_string{REGION_NAMES[indices[0]]}; });
+  _add_column<pmr_string>(segments_by_chunk, column_definitions, "R_COMMENT", cardinalities,
+                          [&](std::vector<size_t>) { return pmr_string{_random_gen.astring(31, 115)}; });
+
+  return create_table(column_definitions, segments_by_chunk, _benchmark_config->chunk_size);
+}
+
+std::unordered_map<std::string, BenchmarkTableInfo> CHTableGenerator::generate() {
+  auto table_info_by_name = TPCCTableGenerator::generate();
+
+  auto& customer_table = table_info_by_name.at("CUSTOMER").table;
+  const auto c_state_column_id = customer_table->column_id_by_name("C_STATE");
+  customer_table = add_column(customer_table, "C_N_NATIONKEY", [&](const Chunk& chunk) {
+    auto nation_keys = pmr_vector<int32_t>{};
+    nation_keys.reserve(chunk.size());
+    for (const auto& c_state : values<pmr_string>(chunk, c_state_column_id)) {
+      nation_keys.emplace_back(static_cast<unsigned char>(c_state.front()));
+    }
+    return nation_keys;
+  });
+
+  auto& stock_table = table_info_by_name.at("STOCK").table;
+  const auto s_i_id_column_id = stock_table->column_id_by_name("S_I_ID");
+  const auto s_w_id_column_id = stock_table->column_id_by_name("S_W_ID");
+  stock_table = add_column(stock_table, "S_SU_SUPPKEY", [&](const Chunk& chunk) {
+    const auto& s_i_ids = values<int32_t>(chunk, s_i_id_column_id);
+    const auto& s_w_ids = values<int32_t>(chunk, s_w_id_column_id);
+
+    auto supplier_keys = pmr_vector<int32_t>{};
+    supplier_keys.reserve(chunk.size());
+    for (auto chunk_offset = size_t{0}; chunk_offset < s_i_ids.size(); ++chunk_offset) {
+      supplier_keys.emplace_back((s_w_ids[chunk_offset] * s_i_ids[chunk_offset]) % NUM_SUPPLIERS);
+    }
+    return supplier_keys;
+  });
+
+  table_info_by_name.emplace("SUPPLIER", BenchmarkTableInfo{generate_supplier_table()});
+  table_info_by_name.emplace("NATION", BenchmarkTableInfo{generate_nation_table()});
+  table_info_by_name.emplace("REGION", BenchmarkTableInfo{generate_region_table()});
+
+  return table_info_by_name;
+}
+
+}  // namespace opossum
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "tpcc/tpcc_table_generator.hpp"
+
+namespace opossum {
+
+/**
+ * Generates the tables of the CH-benCHmark (Cole et al., "The mixed workload CH-benCHmark", DBTest 2011): the TPC-C
+ * tables plus SUPPLIER, NATION, and REGION from TPC-H.
+ *
+ * The CH queries join STOCK and CUSTOMER with these tables using MOD((S_W_ID * S_I_ID), 10000) = SU_SUPPKEY and
+ * ASCII(SUBSTR(C_STATE, 1, 1)) = N_NATIONKEY. As ASCII() is not supported, both keys are stored as additional columns
+ * (S_SU_SUPPKEY and C_N_NATIONKEY) at the end of the TPC-C tables. The TPC-C transactions do not use them.
+ */
+class CHTableGenerator : public TPCCTableGenerator {
+ public:
+  using TPCCTableGenerator::TPCCTableGenerator;
+
+  std::shared_ptr<Table> generate_supplier_table();
+
+  std::shared_ptr<Table> generate_nation_table();
+
+  std::shared_ptr<Table> generate_region_table();
+
+  std::unordered_map<std::string, BenchmarkTableInfo> generate() override;
+};
+
+}  // namespace opossum
@@ -129,10 +129,54 @@ BenchmarkConfig CLIConfigParser::parse_cli_options(const cxxopts::ParseResult& p
     std::cout << "- Not tracking SQL metrics" << std::endl;
   }
 
+  const auto hardware_counters = parse_result["hardware_counters"].as<bool>();
+  if (hardware_counters) {
+    Assert(sql_metrics || enable_visualization, "--hardware_counters requires --sql_metrics or --visualize.");
+    std::cout << "- Measuring hardware performance counters per operator" << std::endl;
+  }
+
+  std::optional<double> arrival_rate;
+  if (const auto arrival_rate_value = parse_result["arrival_rate"].as<double>(); arrival_rate_value != 0.0) {
+    Assert(arrival_rate_value > 0.0, "Invalid value for --arrival_rate");
+    arrival_rate = arrival_rate_value;
+  }
+
+  const auto arrival_process_str = parse_result["arrival_process"].as<std::string>();
+  auto arrival_process = ArrivalProcess::Poisson;
+  if (arrival_process_str == "Poisson") {
+    arrival_process = ArrivalProcess::Poisson;
+  } else if (arrival_process_str == "Constant") {
+    arrival_process = ArrivalProcess::Constant;
+  } else {
+    throw std::runtime_error("Invalid arrival process: '" + arrival_process_str + "'");
+  }
+
+  std::optional<Duration> latency_slo;
+  if (const auto slo_ms = parse_result["slo"].as<uint64_t>(); slo_ms > 0) {
+    latency_slo = std::chrono::duration_cast<Duration>(std::chrono::milliseconds{slo_ms});
+    if (!arrival_rate) arrival_rate = 1.0;
+    std::cout << "- Sweeping the arrival rate for the maximum throughput with a p99 latency of at most " << slo_ms
+              << " ms, starting at " << *arrival_rate << " items/s" << std::endl;
+  } else if (arrival_rate) {
+    std::cout << "- Issuing items open-loop at " << *arrival_rate << " items/s (" << arrival_process_str
+              << " arrivals)" << std::endl;
+  }
+
+  std::optional<Duration> optimizer_time_budget;
+  if (const auto budget_us = parse_result["optimizer_time_budget"].as<uint64_t>(); budget_us > 0) {
+    optimizer_time_budget = std::chrono::duration_cast<Duration>(std::chrono::microseconds{budget_us});
+    std::cout << "- Limiting the optimization of each statement to " << budget_us << " us" << std::endl;
+  }
+
+  if (arrival_rate && clients != default_config.clients) {
+    PerformanceWarning("'--clients' specified but ignored, because items are issued open-loop");
+  }
+
   return BenchmarkConfig{
-      benchmark_mode,  chunk_size,          *encoding_config, indexes, max_runs, timeout_duration,
-      warmup_duration, output_file_path,    enable_scheduler, cores,   clients,  enable_visualization,
-      verify,          cache_binary_tables, sql_metrics};
+      benchmark_mode,  chunk_size,          *encoding_config, indexes,           max_runs,     timeout_duration,
+      warmup_duration, output_file_path,    enable_scheduler, cores,             clients,      enable_visualization,
+      verify,          cache_binary_tables, sql_metrics,      hardware_counters, arrival_rate, arrival_process,
+      latency_slo,     optimizer_time_budget};
 }
 
 EncodingConfig CLIConfigParser::parse_encoding_config(const std::string& encoding_file_str) {
@@ -58,7 +58,7 @@ std::unordered_map<std::string, BenchmarkTableInfo> FileBasedTableGenerator::gen
 
   /**
    * 2. Check for "out of date" binary files, i.e., whether both a binary and textual file exists AND the
-   *    binary file is older than the textual file.
+   *    binary file is older than the textual file or was written in an outdated format.
    */
   for (auto& [table_name, table_info] : table_info_by_name) {
     if (table_info.binary_file_path && table_info.text_file_path) {
@@ -69,6 +69,10 @@ std::unordered_map<std::string, BenchmarkTableInfo> FileBasedTableGenerator::gen
         std::cout << "-  Binary file '" << (*table_info.binary_file_path)
                   << "' is out of date and needs to be re-exported" << std::endl;
         table_info.binary_file_out_of_date = true;
+      } else if (!BinaryParser::has_current_format(*table_info.binary_file_path)) {
+        std::cout << "-  Binary file '" << (*table_info.binary_file_path)
+                  << "' was written in an outdated format and needs to be re-exported" << std::endl;
+        table_info.binary_file_out_of_date = true;
       }
     }
   }
@@ -0,0 +1,124 @@
+#include "latency_histogram.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <string>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+constexpr auto SUB_BUCKET_HALF_COUNT = size_t{1} << 6;
+
+}  // namespace
+
+LatencyHistogram::LatencyHistogram()
+    : _bucket_counts(_bucket_index(std::numeric_limits<uint64_t>::max()) + 1) {
+  static_assert(SUB_BUCKET_HALF_COUNT == size_t{1} << (SUB_BUCKET_BITS - 1));
+}
+
+void LatencyHistogram::record(const Duration latency) {
+  const auto value = static_cast<uint64_t>(
+      std::max(std::chrono::duration_cast<std::chrono::nanoseconds>(latency).count(), int64_t{0}));
+
+  _bucket_counts[_bucket_index(value)].fetch_add(1, std::memory_order_relaxed);
+  _count.fetch_add(1, std::memory_order_relaxed);
+  _sum.fetch_add(value, std::memory_order_relaxed);
+
+  auto previous_max = _max.load(std::memory_order_relaxed);
+  while (previous_max < value && !_max.compare_exchange_weak(previous_max, value, std::memory_order_relaxed)) {
+  }
+}
+
+void LatencyHistogram::add(const LatencyHistogram& other) {
+  for (auto bucket_index = size_t{0}; bucket_index < _bucket_counts.size(); ++bucket_index) {
+    _bucket_counts[bucket_index] += other._bucket_counts[bucket_index].load();
+  }
+  _count += other._count.load();
+  _sum += other._sum.load();
+  _max = std::max(_max.load(), other._max.load());
+}
+
+void LatencyHistogram::clear() {
+  for (auto& bucket_count : _bucket_counts) {
+    bucket_count = 0;
+  }
+  _count = 0;
+  _sum = 0;
+  _max = 0;
+}
+
+size_t LatencyHistogram::count() const { return _count.load(); }
+
+Duration LatencyHistogram::mean() const {
+  const auto count = _count.load();
+  if (count == 0) return Duration{0};
+  return std::chrono::duration_cast<Duration>(std::chrono::nanoseconds{_sum.load() / count});
+}
+
+Duration LatencyHistogram::max() const {
+  return std::chrono::duration_cast<Duration>(std::chrono::nanoseconds{_max.load()});
+}
+
+Duration LatencyHistogram::percentile(const double percentile) const {
+  Assert(percentile >= 0.0 && percentile <= 100.0, "Percentile must be in [0, 100]");
+
+  const auto count = _count.load();
+  if (count == 0) return Duration{0};
+
+  // The rank of the requested value among all recorded values, starting at 1
+  const auto rank = std::max(static_cast<uint64_t>(std::ceil(percentile / 100.0 * static_cast<double>(count))),
+                             uint64_t{1});
+
+  auto seen_count = uint64_t{0};
+  for (auto bucket_index = size_t{0}; bucket_index < _bucket_counts.size(); ++bucket_index) {
+    seen_count += _bucket_counts[bucket_index].load();
+    if (seen_count >= rank) {
+      // The upper bound of the bucket might exceed the largest recorded value
+      const auto value = std::min(_bucket_upper_bound(bucket_index), _max.load());
+      return std::chrono::duration_cast<Duration>(std::chrono::nanoseconds{value});
+    }
+  }
+
+  return max();
+}
+
+nlohmann::json LatencyHistogram::to_json() const {
+  const auto to_ns = [](const Duration duration) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+  };
+
+  return nlohmann::json{{"count", count()},
+                        {"mean", to_ns(mean())},
+                        {"p50", to_ns(percentile(50.0))},
+                        {"p90", to_ns(percentile(90.0))},
+                        {"p99", to_ns(percentile(99.0))},
+                        {"p99.9", to_ns(percentile(99.9))},
+                        {"p99.99", to_ns(percentile(99.99))},
+                        {"max", to_ns(max())}};
+}
+
+size_t LatencyHistogram::_bucket_index(const uint64_t value) {
+  const auto significant_bits = static_cast<int>(std::bit_width(value));
+  const auto shift = static_cast<size_t>(std::max(significant_bits, SUB_BUCKET_BITS) - SUB_BUCKET_BITS);
+  if (shift == 0) return value;
+
+  // value >> shift is in [SUB_BUCKET_HALF_COUNT, 2 * SUB_BUCKET_HALF_COUNT)
+  return shift * SUB_BUCKET_HALF_COUNT + (value >> shift);
+}
+
+uint64_t LatencyHistogram::_bucket_upper_bound(const size_t bucket_index) {
+  if (bucket_index < 2 * SUB_BUCKET_HALF_COUNT) return bucket_index;
+
+  const auto shift = bucket_index / SUB_BUCKET_HALF_COUNT - 1;
+  const auto sub_bucket = static_cast<uint64_t>(bucket_index - shift * SUB_BUCKET_HALF_COUNT);
+
+  // For the last bucket, this intentionally overflows to the maximum uint64_t
+  return ((sub_bucket + 1) << shift) - 1;
+}
+
+}  // namespace opossum
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <atomic>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "benchmark_config.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Records latencies in logarithmic buckets, similar to an HdrHistogram. Values below 2^SUB_BUCKET_BITS ns are stored
+ * exactly. Above, each power of two is split into 2^(SUB_BUCKET_BITS - 1) linear buckets, so that reported
+ * percentiles are at most 1/64 (~1.6%) above the actual value. Unlike storing all runs, memory consumption is
+ * independent of the number of recorded values. record() can be called concurrently.
+ */
+class LatencyHistogram : private Noncopyable {
+ public:
+  LatencyHistogram();
+
+  void record(const Duration latency);
+
+  // Adds the latencies recorded by @param other. Not thread-safe.
+  void add(const LatencyHistogram& other);
+
+  // Not thread-safe
+  void clear();
+
+  size_t count() const;
+  Duration mean() const;
+  Duration max() const;
+
+  // Returns the (upper bound of the bucket of the) latency below which @param percentile percent of the recorded
+  // latencies lie, e.g., percentile(99.9). Returns 0 if no latencies were recorded.
+  Duration percentile(const double percentile) const;
+
+  // The count, mean, max, and the percentiles reported in benchmark results (p50, p90, p99, p99.9, p99.99) in ns
+  nlohmann::json to_json() const;
+
+ private:
+  static constexpr auto SUB_BUCKET_BITS = 7;
+
+  static size_t _bucket_index(const uint64_t value);
+  static uint64_t _bucket_upper_bound(const size_t bucket_index);
+
+  std::vector<std::atomic<uint64_t>> _bucket_counts;
+  std::atomic<uint64_t> _count{0};
+  std::atomic<uint64_t> _sum{0};
+  std::atomic<uint64_t> _max{0};
+};
+
+}  // namespace opossum
@@ -522,6 +522,13 @@ std::unordered_map<std::string, BenchmarkTableInfo> TPCCTableGenerator::generate
   auto order_table = generate_order_table(order_line_counts);
   auto order_line_table = generate_order_line_table(order_line_counts);
 
+  // Most TPC-C updates only change a few counters (e.g., S_QUANTITY or D_NEXT_O_ID) of wide rows. Updating them in
+  // place keeps the tables from growing with every transaction.
+  for (const auto& table : {item_table, warehouse_table, stock_table, district_table, customer_table, history_table,
+                            new_order_table, order_table, order_line_table}) {
+    table->set_allow_in_place_updates(true);
+  }
+
   return std::unordered_map<std::string, BenchmarkTableInfo>({{"ITEM", BenchmarkTableInfo{item_table}},
                                                               {"WAREHOUSE", BenchmarkTableInfo{warehouse_table}},
                                                               {"STOCK", BenchmarkTableInfo{stock_table}},
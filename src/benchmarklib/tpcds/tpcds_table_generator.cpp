@@ -273,7 +273,7 @@ std::unordered_map<std::string, BenchmarkTableInfo> TpcdsTableGenerator::generat
 
   // try to load cached tables
   const auto cache_directory = "tpcds_cached_tables/sf-" + std::to_string(_scale_factor);  // NOLINT
-  if (_benchmark_config->cache_binary_tables && std::filesystem::is_directory(cache_directory)) {
+  if (_cached_tables_are_usable(cache_directory)) {
     for (const auto& table_file : list_directory(cache_directory)) {
       const auto table_name = table_file.stem();
       auto timer = Timer{};
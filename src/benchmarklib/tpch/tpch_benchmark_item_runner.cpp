@@ -79,7 +79,7 @@ void TPCHBenchmarkItemRunner::on_tables_loaded() {
     const auto indexed_column_ids = std::vector<ColumnID>{ColumnID{0}};
     Assert(!first_chunk->get_indexes(indexed_column_ids).empty(), "Index was lost");
   }
-  Assert(!orders_table->get_soft_unique_constraints().empty(), "Constraints were lost");
+  Assert(!orders_table->get_unique_constraints().empty(), "Constraints were lost");
 
   if (_use_prepared_statements) {
     std::cout << " - Preparing queries" << std::endl;
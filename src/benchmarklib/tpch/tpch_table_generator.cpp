@@ -125,7 +125,7 @@ std::unordered_map<std::string, BenchmarkTableInfo> TPCHTableGenerator::generate
          "Due to tpch_dbgen limitations, only scale factors less than one can have a fractional part.");
 
   const auto cache_directory = std::string{"tpch_cached_tables/sf-"} + std::to_string(_scale_factor);  // NOLINT
-  if (_benchmark_config->cache_binary_tables && std::filesystem::is_directory(cache_directory)) {
+  if (_cached_tables_are_usable(cache_directory)) {
     std::unordered_map<std::string, BenchmarkTableInfo> table_info_by_name;
 
     for (const auto& table_file : list_directory(cache_directory)) {
@@ -417,12 +417,12 @@ int Console::_help(const std::string&) {
   out("  generate_tpcds SCALE_FACTOR [CHUNK_SIZE] - Generate all TPC-DS tables\n");
   out("  load FILEPATH [TABLENAME [ENCODING]]    - Load table from disk specified by filepath FILEPATH, store it with name TABLENAME\n");  // NOLINT
   out("                                               The import type is chosen by the type of FILEPATH.\n");
-  out("                                                 Supported types: '.bin', '.csv', '.tbl'\n");
+  out("                                                 Supported types: '.arrow', '.bin', '.csv', '.feather', '.tbl'\n");  // NOLINT
   out("                                               If no table name is specified, the filename without extension is used\n");  // NOLINT
   out(encoding_options + "\n");  // NOLINT
   out("  export TABLENAME FILEPATH               - Export table named TABLENAME from storage manager to filepath FILEPATH\n");  // NOLINT
   out("                                               The export type is chosen by the type of FILEPATH.\n");
-  out("                                                 Supported types: '.bin', '.csv'\n");
+  out("                                                 Supported types: '.arrow', '.bin', '.csv', '.feather'\n");
   out("  script SCRIPTFILE                       - Execute script specified by SCRIPTFILE\n");
   out("  print TABLENAME                         - Fully print the given table (including MVCC data)\n");
   out("  visualize [options] [SQL]               - Visualize a SQL query\n");
@@ -1,6 +1,8 @@
 #include "cxxopts.hpp"
 
+#include "hyrise.hpp"
 #include "server/server.hpp"
+#include "sql/query_statistics_store.hpp"
 
 cxxopts::Options get_server_cli_options() {
   cxxopts::Options cli_options("./hyriseServer", "Starts Hyrise server in order to accept network requests.");
@@ -11,6 +13,7 @@ cxxopts::Options get_server_cli_options() {
     ("address", "Specify the address to run on", cxxopts::value<std::string>()->default_value("0.0.0.0"))  // NOLINT
     ("p,port", "Specify the port number. 0 means randomly select an available one. If no port is specified, the the server will start on PostgreSQL's official port", cxxopts::value<uint16_t>()->default_value("5432"))  // NOLINT
     ("execution_info", "Send execution information after statement execution", cxxopts::value<bool>()->default_value("false")) // NOLINT
+    ("query_statistics", "Record execution statistics per normalized SQL statement, see meta_query_statistics", cxxopts::value<bool>()->default_value("false")) // NOLINT
     ;  // NOLINT
   // clang-format on
 
@@ -35,6 +38,10 @@ int main(int argc, char* argv[]) {
 
   Assert(!error, "Not a valid IPv4 address: " + parsed_options["address"].as<std::string>() + ", terminating...");
 
+  if (parsed_options["query_statistics"].as<bool>()) {
+    opossum::Hyrise::get().default_query_statistics_store = std::make_shared<opossum::QueryStatisticsStore>();
+  }
+
   auto server = opossum::Server{address, port, static_cast<opossum::SendExecutionInfo>(execution_info)};
   server.run();
 
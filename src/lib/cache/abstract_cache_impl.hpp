@@ -58,6 +58,9 @@ class AbstractCacheImpl {
   // Remove all elements from the cache.
   virtual void clear() = 0;
 
+  // Remove the element at the given key, if any.
+  virtual void erase(const Key& key) = 0;
+
   // Resize to the given capacity.
   virtual void resize(size_t capacity) = 0;
 
@@ -67,6 +67,21 @@ class Cache {
     _impl->clear();
   }
 
+  // Purges all entries for which the predicate, called with the key and the value, returns true.
+  template <typename Predicate>
+  void erase_if(const Predicate& predicate) {
+    std::unique_lock<std::shared_mutex> lock(_mutex);
+
+    auto erased_keys = std::vector<Key>{};
+    for (auto it = _impl->begin(); it != _impl->end(); ++it) {
+      if (predicate(it->first, it->second)) erased_keys.emplace_back(it->first);
+    }
+
+    for (const auto& key : erased_keys) {
+      _impl->erase(key);
+    }
+  }
+
   void resize(size_t capacity) {
     std::unique_lock<std::shared_mutex> lock(_mutex);
     _impl->resize(capacity);
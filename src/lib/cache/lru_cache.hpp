@@ -5,6 +5,7 @@
 #include <utility>
 
 #include "abstract_cache_impl.hpp"
+#include "utils/assert.hpp"
 
 namespace opossum {
 
@@ -78,6 +79,14 @@ class LRUCache : public AbstractCacheImpl<Key, Value> {
     _map.clear();
   }
 
+  void erase(const Key& key) {
+    auto it = _map.find(key);
+    if (it == _map.end()) return;
+
+    _list.erase(it->second);
+    _map.erase(it);
+  }
+
   void resize(size_t capacity) {
     while (_map.size() > capacity) {
       _evict();
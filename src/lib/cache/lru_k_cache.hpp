@@ -136,6 +136,14 @@ class LRUKCache : public AbstractCacheImpl<Key, Value> {
     _queue.clear();
   }
 
+  void erase(const Key& key) {
+    auto it = _map.find(key);
+    if (it == _map.end()) return;
+
+    _queue.erase(it->second);
+    _map.erase(it);
+  }
+
   void resize(size_t capacity) {
     while (_queue.size() > capacity) {
       _evict();
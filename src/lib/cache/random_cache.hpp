@@ -85,6 +85,20 @@ class RandomCache : public AbstractCacheImpl<Key, Value> {
     _map.clear();
   }
 
+  void erase(const Key& key) {
+    auto it = _map.find(key);
+    if (it == _map.end()) return;
+
+    // Move the last element into the gap, so that the indices of the other elements remain valid.
+    const auto index = it->second;
+    _map.erase(it);
+    if (index != _list.size() - 1) {
+      _list[index] = std::move(_list.back());
+      _map[_list[index].first] = index;
+    }
+    _list.pop_back();
+  }
+
   void resize(size_t capacity) {
     while (_list.size() > capacity) {
       _evict();
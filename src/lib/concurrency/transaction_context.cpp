@@ -3,7 +3,6 @@
 #include <future>
 #include <memory>
 
-#include "commit_context.hpp"
 #include "hyrise.hpp"
 #include "operators/abstract_read_write_operator.hpp"
 #include "utils/assert.hpp"
@@ -15,10 +14,10 @@ TransactionContext::TransactionContext(const TransactionID transaction_id, const
     : _transaction_id{transaction_id},
       _snapshot_commit_id{snapshot_commit_id},
       _is_auto_commit{is_auto_commit},
+      _snapshot_slot_epoch{Hyrise::get().transaction_manager._snapshot_slot_epoch()},
+      _snapshot_slot{Hyrise::get().transaction_manager._register_transaction(snapshot_commit_id)},
       _phase{TransactionPhase::Active},
-      _num_active_operators{0} {
-  Hyrise::get().transaction_manager._register_transaction(snapshot_commit_id);
-}
+      _num_active_operators{0} {}
 
 TransactionContext::~TransactionContext() {
   DebugAssert(([this]() {
@@ -51,7 +50,7 @@ TransactionContext::~TransactionContext() {
    * Tell the TransactionManager, which keeps track of active snapshot-commit-ids,
    * that this transaction has finished.
    */
-  Hyrise::get().transaction_manager._deregister_transaction(_snapshot_commit_id);
+  Hyrise::get().transaction_manager._deregister_transaction(_snapshot_slot, _snapshot_slot_epoch);
 }
 
 TransactionID TransactionContext::transaction_id() const { return _transaction_id; }
@@ -59,24 +58,33 @@ CommitID TransactionContext::snapshot_commit_id() const { return _snapshot_commi
 AutoCommit TransactionContext::is_auto_commit() const { return _is_auto_commit; }
 
 CommitID TransactionContext::commit_id() const {
-  Assert(_commit_context, "TransactionContext cid only available after commit context has been created.");
+  Assert(_commit_id, "TransactionContext cid only available after a commit id has been assigned.");
 
-  return _commit_context->commit_id();
+  return *_commit_id;
 }
 
 TransactionPhase TransactionContext::phase() const { return _phase; }
 
+std::optional<RollbackReason> TransactionContext::rollback_reason() const {
+  // Only read once the transaction has been rolled back, see _mark_as_rolled_back()
+  const auto phase = _phase.load();
+  if (phase != TransactionPhase::RolledBackByUser && phase != TransactionPhase::RolledBackAfterConflict) {
+    return std::nullopt;
+  }
+  return _rollback_reason;
+}
+
 bool TransactionContext::aborted() const {
   const auto phase = _phase.load();
   return (phase == TransactionPhase::Conflicted) || (phase == TransactionPhase::RolledBackAfterConflict);
 }
 
 void TransactionContext::rollback(RollbackReason rollback_reason) {
-  if (rollback_reason == RollbackReason::Conflict) {
-    _mark_as_conflicted();
-  } else {
+  if (rollback_reason == RollbackReason::User) {
     // We directly go to RolledBackByUser, skipping Conflicted
     Assert(_num_active_operators == 0, "For a user-initiated rollback, no operators should be active");
+  } else {
+    _mark_as_conflicted();
   }
 
   for (const auto& op : _read_write_operators) {
@@ -112,6 +120,10 @@ void TransactionContext::commit() {
   commit_async(callback);
 
   committed_future.wait();
+
+  // Materialized views are maintained eagerly, i.e., a maintenance is scheduled right after their base tables were
+  // modified. Failures of the maintenance do not affect this transaction.
+  Hyrise::get().storage_manager.maintain_materialized_views();
 }
 
 void TransactionContext::_mark_as_conflicted() {
@@ -129,10 +141,12 @@ void TransactionContext::_mark_as_rolled_back(RollbackReason rollback_reason) {
               }()),
               "All read/write operators need to have been rolled back.");
 
+  // Set before the transition, so that it is visible to everyone who observes the final phase
+  _rollback_reason = rollback_reason;
+
   if (rollback_reason == RollbackReason::User) {
     _transition(TransactionPhase::Active, TransactionPhase::RolledBackByUser);
   } else {
-    DebugAssert(rollback_reason == RollbackReason::Conflict, "Invalid RollbackReason");
     _transition(TransactionPhase::Conflicted, TransactionPhase::RolledBackAfterConflict);
   }
 }
@@ -150,7 +164,7 @@ void TransactionContext::_prepare_commit() {
 
   _wait_for_active_operators_to_finish();
 
-  _commit_context = Hyrise::get().transaction_manager._new_commit_context();
+  _commit_id = Hyrise::get().transaction_manager._new_commit_id();
 }
 
 void TransactionContext::_mark_as_pending_and_try_commit(const std::function<void(TransactionID)>& callback) {
@@ -163,7 +177,8 @@ void TransactionContext::_mark_as_pending_and_try_commit(const std::function<voi
               "All read/write operators need to have been committed.");
 
   auto context_weak_ptr = std::weak_ptr<TransactionContext>{this->shared_from_this()};
-  _commit_context->make_pending(_transaction_id, [context_weak_ptr, callback](auto transaction_id) {
+  const auto transaction_id = _transaction_id;
+  Hyrise::get().transaction_manager._publish_commit(*_commit_id, [context_weak_ptr, callback, transaction_id]() {
     // If the transaction context still exists, set its phase to Committed.
     if (auto context_ptr = context_weak_ptr.lock()) {
       context_ptr->_transition(TransactionPhase::Committing, TransactionPhase::Committed);
@@ -171,8 +186,6 @@ void TransactionContext::_mark_as_pending_and_try_commit(const std::function<voi
 
     if (callback) callback(transaction_id);
   });
-
-  Hyrise::get().transaction_manager._try_increment_last_commit_id(_commit_context);
 }
 
 void TransactionContext::on_operator_started() { ++_num_active_operators; }
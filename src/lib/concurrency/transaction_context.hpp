@@ -3,14 +3,15 @@
 #include <atomic>
 #include <condition_variable>
 #include <memory>
+#include <optional>
 #include <vector>
 
+#include "transaction_manager.hpp"
 #include "types.hpp"
 
 namespace opossum {
 
 class AbstractReadWriteOperator;
-class CommitContext;
 
 /**
  * @brief Overview of the different transaction phases
@@ -101,11 +102,16 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
   /**
    * Aborts and rolls back the transaction.
    * @param rollback_reason specifies whether the rollback happens due to an explicit ROLLBACK command by
-   * the database user or due to a transaction conflict. We need to know this in order to transition into
-   * the correct transaction phase.
+   * the database user or due to a failure (a transaction conflict or an exceeded memory limit). We need to know this
+   * in order to transition into the correct transaction phase.
    */
   void rollback(RollbackReason rollback_reason);
 
+  /**
+   * Returns the reason passed to rollback() once the transaction has been rolled back, std::nullopt otherwise
+   */
+  std::optional<RollbackReason> rollback_reason() const;
+
   /**
    * Commits the transaction.
    *
@@ -116,7 +122,7 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
   /**
    * Commits the transaction.
    *
-   * Blocks until transaction is actually committed.
+   * Blocks until transaction is actually committed. Then, materialized views on the modified tables are maintained.
    */
   void commit();
 
@@ -200,10 +206,15 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
   const CommitID _snapshot_commit_id;
   const AutoCommit _is_auto_commit;
 
+  // Slot in the TransactionManager's registry of active snapshot-commit-ids and the epoch in which it was claimed
+  const uint64_t _snapshot_slot_epoch;
+  TransactionManager::SnapshotSlot& _snapshot_slot;
+
   std::vector<std::shared_ptr<AbstractReadWriteOperator>> _read_write_operators;
 
   std::atomic<TransactionPhase> _phase;
-  std::shared_ptr<CommitContext> _commit_context;
+  std::optional<CommitID> _commit_id;
+  std::optional<RollbackReason> _rollback_reason;
 
   std::atomic_size_t _num_active_operators;
 
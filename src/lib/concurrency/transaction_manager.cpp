@@ -1,6 +1,8 @@
 #include "transaction_manager.hpp"
 
-#include "commit_context.hpp"
+#include <algorithm>
+#include <thread>
+
 #include "storage/mvcc_data.hpp"
 #include "transaction_context.hpp"
 #include "utils/assert.hpp"
@@ -10,113 +12,191 @@ namespace opossum {
 TransactionManager::TransactionManager()
     : _next_transaction_id{INITIAL_TRANSACTION_ID},
       _last_commit_id{INITIAL_COMMIT_ID},
-      _last_commit_context{std::make_shared<CommitContext>(INITIAL_COMMIT_ID)} {}
+      _next_commit_id{INITIAL_COMMIT_ID + 1},
+      _commit_slots(COMMIT_SLOT_COUNT),
+      _snapshot_slots{std::make_unique<SnapshotSlotBlock>()} {
+  _reset_commit_slots();
+}
 
 TransactionManager::~TransactionManager() {
-  Assert(_active_snapshot_commit_ids.empty(),
+  Assert(_active_snapshot_commit_ids().empty(),
          "Some transactions do not seem to have finished yet as they are still registered as active.");
+
+  auto* block = _snapshot_slots->next.load();
+  while (block) {
+    auto* next_block = block->next.load();
+    delete block;
+    block = next_block;
+  }
 }
 
 TransactionManager& TransactionManager::operator=(TransactionManager&& transaction_manager) noexcept {
   _next_transaction_id = transaction_manager._next_transaction_id.load();
   _last_commit_id = transaction_manager._last_commit_id.load();
-  _last_commit_context = transaction_manager._last_commit_context;
-  _active_snapshot_commit_ids = transaction_manager._active_snapshot_commit_ids;
+  _next_commit_id = transaction_manager._next_commit_id.load();
+  DebugAssert(_next_commit_id == _last_commit_id + 1,
+              "Cannot replace the TransactionManager while commits are pending.");
+  _reset_commit_slots();
+
+  // The slot blocks are kept, so that slots handed out before remain valid. Only their contents are replaced. The
+  // new epoch prevents transactions registered before from freeing the slots of newer transactions.
+  ++_current_snapshot_slot_epoch;
+  for (auto* block = _snapshot_slots.get(); block; block = block->next.load()) {
+    for (auto& slot : block->slots) {
+      slot.snapshot_commit_id = FREE_SNAPSHOT_SLOT;
+    }
+  }
+  for (const auto snapshot_commit_id : transaction_manager._active_snapshot_commit_ids()) {
+    _register_transaction(snapshot_commit_id);
+  }
+
   return *this;
 }
 
 CommitID TransactionManager::last_commit_id() const { return _last_commit_id; }
 
 std::shared_ptr<TransactionContext> TransactionManager::new_transaction_context(const AutoCommit auto_commit) {
-  const TransactionID snapshot_commit_id = _last_commit_id;
-  return std::make_shared<TransactionContext>(_next_transaction_id++, snapshot_commit_id, auto_commit);
+  const auto transaction_id = _next_transaction_id++;
+
+  // The TransactionContext registers its snapshot-commit-id. If a commit was published between reading the last
+  // commit id and the registration, a concurrent get_lowest_snapshot_commit_id() might have missed the registration
+  // and returned a newer commit id. Thus, we re-read the last commit id after registering and retry with the new one
+  // if it has changed.
+  while (true) {
+    const auto snapshot_commit_id = _last_commit_id.load();
+    auto transaction_context = std::make_shared<TransactionContext>(transaction_id, snapshot_commit_id, auto_commit);
+    if (_last_commit_id.load() == snapshot_commit_id) return transaction_context;
+  }
 }
 
-void TransactionManager::_register_transaction(const CommitID snapshot_commit_id) {
-  std::unique_lock<std::mutex> lock(_mutex_active_snapshot_commit_ids);
-  _active_snapshot_commit_ids.insert(snapshot_commit_id);
+TransactionManager::SnapshotSlot& TransactionManager::_register_transaction(const CommitID snapshot_commit_id) {
+  DebugAssert(snapshot_commit_id != FREE_SNAPSHOT_SLOT, "Invalid snapshot commit id");
+
+  // Threads start probing at different positions. As a thread usually finishes a transaction before starting the next
+  // one, it will mostly find its previous slot free again.
+  static thread_local const auto first_slot_id =
+      std::hash<std::thread::id>{}(std::this_thread::get_id()) % SNAPSHOT_SLOTS_PER_BLOCK;
+
+  auto* block = _snapshot_slots.get();
+  while (true) {
+    for (auto probe_id = size_t{0}; probe_id < SNAPSHOT_SLOTS_PER_BLOCK; ++probe_id) {
+      auto& slot = block->slots[(first_slot_id + probe_id) % SNAPSHOT_SLOTS_PER_BLOCK];
+      auto expected = FREE_SNAPSHOT_SLOT;
+      if (slot.snapshot_commit_id.load(std::memory_order_relaxed) == FREE_SNAPSHOT_SLOT &&
+          slot.snapshot_commit_id.compare_exchange_strong(expected, snapshot_commit_id)) {
+        return slot;
+      }
+    }
+
+    // All slots of this block are occupied. Continue with the next block or append one if there is none. If another
+    // thread appended a block in the meantime, we use that one instead.
+    auto* next_block = block->next.load();
+    if (!next_block) {
+      auto new_block = std::make_unique<SnapshotSlotBlock>();
+      if (block->next.compare_exchange_strong(next_block, new_block.get())) {
+        next_block = new_block.release();
+      }
+    }
+    block = next_block;
+  }
 }
 
-void TransactionManager::_deregister_transaction(const CommitID snapshot_commit_id) {
-  std::unique_lock<std::mutex> lock(_mutex_active_snapshot_commit_ids);
+void TransactionManager::_deregister_transaction(SnapshotSlot& slot, const uint64_t snapshot_slot_epoch) {
+  // The slot was already freed when the TransactionManager was replaced and might have been handed out again
+  if (snapshot_slot_epoch != _current_snapshot_slot_epoch.load()) return;
 
-  auto it = std::find(_active_snapshot_commit_ids.begin(), _active_snapshot_commit_ids.end(), snapshot_commit_id);
+  slot.snapshot_commit_id.store(FREE_SNAPSHOT_SLOT);
+}
 
-  if (it != _active_snapshot_commit_ids.end()) {
-    _active_snapshot_commit_ids.erase(it);
-    return;
-  }
+uint64_t TransactionManager::_snapshot_slot_epoch() const { return _current_snapshot_slot_epoch.load(); }
 
-  Assert(
-      it == _active_snapshot_commit_ids.end(),
-      "Could not find snapshot_commit_id in TransactionManager's _active_snapshot_commit_ids. Therefore, the removal "
-      "failed and the function should not have been called.");
+std::unordered_multiset<CommitID> TransactionManager::_active_snapshot_commit_ids() const {
+  auto snapshot_commit_ids = std::unordered_multiset<CommitID>{};
+  for (const auto* block = _snapshot_slots.get(); block; block = block->next.load()) {
+    for (const auto& slot : block->slots) {
+      const auto snapshot_commit_id = slot.snapshot_commit_id.load();
+      if (snapshot_commit_id != FREE_SNAPSHOT_SLOT) snapshot_commit_ids.insert(snapshot_commit_id);
+    }
+  }
+  return snapshot_commit_ids;
 }
 
 std::optional<CommitID> TransactionManager::get_lowest_active_snapshot_commit_id() const {
-  std::unique_lock<std::mutex> lock(_mutex_active_snapshot_commit_ids);
+  auto lowest_snapshot_commit_id = FREE_SNAPSHOT_SLOT;
+  for (const auto* block = _snapshot_slots.get(); block; block = block->next.load()) {
+    for (const auto& slot : block->slots) {
+      lowest_snapshot_commit_id = std::min(lowest_snapshot_commit_id, slot.snapshot_commit_id.load());
+    }
+  }
 
-  if (_active_snapshot_commit_ids.empty()) {
+  if (lowest_snapshot_commit_id == FREE_SNAPSHOT_SLOT) {
     return std::nullopt;
   }
 
-  auto it = std::min_element(_active_snapshot_commit_ids.begin(), _active_snapshot_commit_ids.end());
-  return *it;
+  return lowest_snapshot_commit_id;
 }
 
-/**
- * Logic of the lock-free algorithm
- *
- * Let’s say n threads call this method simultaneously. They all enter the main while-loop.
- * Eventually they reach the point where they try to set the successor of _last_commit_context
- * (pointed to by current_context). Only one of them will succeed and will be able to pass the
- * following if statement. The rest continues with the loop and will now try to get the latest
- * context, which does not have a successor. As long as the thread that succeeded setting
- * the next commit context has not finished updating _last_commit_context, they are stuck in
- * the small while-loop. As soon as it is done, _last_commit_context will point to a commit
- * context with no successor and they will be able to leave this loop.
- */
-std::shared_ptr<CommitContext> TransactionManager::_new_commit_context() {
-  auto current_context = std::atomic_load(&_last_commit_context);
-  auto next_context = std::shared_ptr<CommitContext>();
-
-  auto success = false;
-  while (!success) {
-    while (current_context->has_next()) {
-      current_context = std::atomic_load(&_last_commit_context);
-    }
-
-    next_context = std::make_shared<CommitContext>(current_context->commit_id() + 1u);
-
-    success = current_context->try_set_next(next_context);
+CommitID TransactionManager::get_lowest_snapshot_commit_id() const {
+  // The last commit id is read before the slots are scanned, see new_transaction_context
+  const auto last_commit_id = _last_commit_id.load();
+  return std::min(last_commit_id, get_lowest_active_snapshot_commit_id().value_or(last_commit_id));
+}
 
-    if (!success) continue;
+CommitID TransactionManager::_new_commit_id() { return _next_commit_id++; }
 
-    /**
-     * Only one thread at a time can ever reach this code since only one thread
-     * succeeds to set _last_commit_context’s successor.
-     */
-    success = std::atomic_compare_exchange_strong(&_last_commit_context, &current_context, next_context);
+void TransactionManager::_publish_commit(const CommitID commit_id, const std::function<void()>& callback) {
+  auto& slot = _commit_slots[commit_id % COMMIT_SLOT_COUNT];
 
-    Assert(success, "Invariant violated.");
+  // Wait until the commit that used the slot before has been published
+  while (slot.next_commit_id.load() != commit_id) {
+    std::this_thread::yield();
   }
 
-  return next_context;
+  // The callback must be set before the commit is marked as pending, as another thread might publish it right away
+  slot.callback = callback;
+  slot.pending_commit_id = commit_id;
+
+  _publish_pending_commits();
 }
 
-void TransactionManager::_try_increment_last_commit_id(const std::shared_ptr<CommitContext>& context) {
-  auto current_context = context;
+void TransactionManager::_publish_pending_commits() {
+  while (true) {
+    auto last_commit_id = _last_commit_id.load();
+
+    // Find the longest run of pending commits that directly follows the last published commit
+    auto published_commit_id = last_commit_id;
+    while (published_commit_id - last_commit_id < COMMIT_SLOT_COUNT) {
+      const auto& slot = _commit_slots[(published_commit_id + 1) % COMMIT_SLOT_COUNT];
+      if (slot.pending_commit_id.load() != published_commit_id + 1) break;
+      ++published_commit_id;
+    }
 
-  while (current_context->is_pending()) {
-    auto expected_last_commit_id = current_context->commit_id() - 1;
+    if (published_commit_id == last_commit_id) return;
 
-    if (!_last_commit_id.compare_exchange_strong(expected_last_commit_id, current_context->commit_id())) return;
+    // If the compare-and-swap fails, another thread has published (some of) these commits. As the commit following
+    // its run might be ours, we need to check again.
+    if (!_last_commit_id.compare_exchange_strong(last_commit_id, published_commit_id)) continue;
 
-    current_context->fire_callback();
+    // Only this thread can get here for the commit ids of the run
+    for (auto commit_id = last_commit_id + 1; commit_id <= published_commit_id; ++commit_id) {
+      auto& slot = _commit_slots[commit_id % COMMIT_SLOT_COUNT];
+      const auto callback = std::move(slot.callback);
+      slot.callback = nullptr;
+      slot.pending_commit_id = FREE_COMMIT_SLOT;
+      slot.next_commit_id = commit_id + static_cast<CommitID>(COMMIT_SLOT_COUNT);
 
-    if (!current_context->has_next()) return;
+      if (callback) callback();
+    }
+  }
+}
 
-    current_context = current_context->next();
+void TransactionManager::_reset_commit_slots() {
+  const auto next_commit_id = _next_commit_id.load();
+  for (auto commit_id = next_commit_id; commit_id < next_commit_id + COMMIT_SLOT_COUNT; ++commit_id) {
+    auto& slot = _commit_slots[commit_id % COMMIT_SLOT_COUNT];
+    slot.next_commit_id = commit_id;
+    slot.pending_commit_id = FREE_COMMIT_SLOT;
+    slot.callback = nullptr;
   }
 }
 
@@ -1,10 +1,13 @@
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <functional>
+#include <limits>
 #include <memory>
-#include <mutex>
+#include <optional>
 #include <unordered_set>
+#include <vector>
 
 #include "types.hpp"
 
@@ -32,13 +35,13 @@
  * transaction context.
  *
  * TransactionContext contains data used by a transaction, mainly its ID, the snapshot commit ID explained above, and,
- * when it enters the commit phase, the TransactionManager gives it a CommitContext, which contains
- * a new commit ID that is used to make its changes visible to others.
+ * when it enters the commit phase, a new commit ID that is used to make its changes visible to others. The commit IDs
+ * become visible (i.e., the last commit ID is advanced) in the order in which they were handed out, see
+ * TransactionManager::_publish_commit.
  */
 
 namespace opossum {
 
-class CommitContext;
 class TransactionContext;
 
 /**
@@ -66,6 +69,12 @@ class TransactionManager : public Noncopyable {
    */
   std::optional<CommitID> get_lowest_active_snapshot_commit_id() const;
 
+  /**
+   * Returns a commit id that is not newer than the snapshot-commit-id of any active transaction or of any transaction
+   * that is created later. Changes committed up to this commit id are visible to all of them.
+   */
+  CommitID get_lowest_snapshot_commit_id() const;
+
  private:
   TransactionManager();
   ~TransactionManager();
@@ -75,17 +84,66 @@ class TransactionManager : public Noncopyable {
 
   TransactionManager& operator=(TransactionManager&& transaction_manager) noexcept;
 
-  std::shared_ptr<CommitContext> _new_commit_context();
-  void _try_increment_last_commit_id(const std::shared_ptr<CommitContext>& context);
+  /**
+   * Commit pipeline
+   *
+   * Commit ids are handed out by an atomic increment. Once a transaction has written its commit id into the MVCC data,
+   * it publishes the commit by marking its slot in a ring of COMMIT_SLOT_COUNT slots (indexed by commit id) as
+   * pending. The last commit id may only be advanced to a commit id once all earlier commits are pending as well. Thus,
+   * after marking its own slot, a transaction scans the ring, starting at the last commit id, for the longest run of
+   * pending commits and advances the last commit id past the entire run with a single compare-and-swap. The thread
+   * whose compare-and-swap succeeds fires the callbacks of the run, frees its slots, and scans again, as further
+   * commits might have become pending in the meantime. Other threads do not wait for it. This way, a slow committer
+   * only delays the visibility of later commits, and a batch of commits becomes visible at once.
+   *
+   * A slot is reused for commit id + COMMIT_SLOT_COUNT after the commit has been published. If more transactions are
+   * committing at the same time, the later ones wait for their slot to be freed.
+   */
+  CommitID _new_commit_id();
+  void _publish_commit(const CommitID commit_id, const std::function<void()>& callback);
+  void _publish_pending_commits();
+  void _reset_commit_slots();
+
+  static constexpr auto COMMIT_SLOT_COUNT = size_t{1024};
+  static constexpr auto FREE_COMMIT_SLOT = std::numeric_limits<CommitID>::max();
+
+  struct alignas(64) CommitSlot {
+    // Commit id that may use the slot next, i.e., the previous commit id that used this slot + COMMIT_SLOT_COUNT
+    std::atomic<CommitID> next_commit_id{FREE_COMMIT_SLOT};
+    // Set to the commit id once the commit is ready to be published
+    std::atomic<CommitID> pending_commit_id{FREE_COMMIT_SLOT};
+    // Called after the commit has been published. Written before pending_commit_id is set.
+    std::function<void()> callback;
+  };
 
   /**
-   * The TransactionManager keeps track of issued snapshot-commit-ids,
-   * which are in use by unfinished transactions.
-   * The following two functions are used to keep the multiset of active
-   * snapshot-commit-ids up to date.
+   * The TransactionManager keeps track of issued snapshot-commit-ids, which are in use by unfinished transactions.
+   * Each unfinished transaction occupies a slot that holds its snapshot-commit-id. Registering a transaction claims a
+   * free slot with a compare-and-swap (starting at a per-thread position, so that concurrent threads rarely compete
+   * for the same slot), deregistering releases it with a single store. Neither takes a lock, which is important as
+   * every TransactionContext does both. get_lowest_active_snapshot_commit_id, which is called rarely, scans all slots.
+   *
+   * The slots are organized in a linked list of blocks. A new block is only appended if all slots are occupied. Blocks
+   * are never freed before the TransactionManager is destroyed, so the returned slots remain valid.
+   *
+   * Replacing the TransactionManager (i.e., Hyrise::reset()) frees all slots and increments the slot epoch. A
+   * TransactionContext that outlives the reset deregisters with the epoch of its registration, so that it does not
+   * free a slot that now belongs to a different transaction.
    */
-  void _register_transaction(CommitID snapshot_commit_id);
-  void _deregister_transaction(CommitID snapshot_commit_id);
+  static constexpr auto FREE_SNAPSHOT_SLOT = std::numeric_limits<CommitID>::max();
+  static constexpr auto SNAPSHOT_SLOTS_PER_BLOCK = size_t{256};
+
+  struct alignas(64) SnapshotSlot {
+    // Slots are padded to a cache line so that transactions on different cores do not invalidate each other's slots
+    std::atomic<CommitID> snapshot_commit_id{FREE_SNAPSHOT_SLOT};
+  };
+
+  SnapshotSlot& _register_transaction(CommitID snapshot_commit_id);
+  void _deregister_transaction(SnapshotSlot& slot, const uint64_t snapshot_slot_epoch);
+  uint64_t _snapshot_slot_epoch() const;
+
+  // Returns the snapshot-commit-ids of all unfinished transactions
+  std::unordered_multiset<CommitID> _active_snapshot_commit_ids() const;
 
   std::atomic<TransactionID> _next_transaction_id;
 
@@ -94,9 +152,15 @@ class TransactionManager : public Noncopyable {
   // been there "from the beginning of time".
   static constexpr auto INITIAL_COMMIT_ID = CommitID{1};
 
-  std::shared_ptr<CommitContext> _last_commit_context;
+  std::atomic<CommitID> _next_commit_id;
+  std::vector<CommitSlot> _commit_slots;
+
+  struct SnapshotSlotBlock {
+    std::array<SnapshotSlot, SNAPSHOT_SLOTS_PER_BLOCK> slots;
+    std::atomic<SnapshotSlotBlock*> next{nullptr};
+  };
 
-  mutable std::mutex _mutex_active_snapshot_commit_ids;
-  std::unordered_multiset<CommitID> _active_snapshot_commit_ids;
+  std::unique_ptr<SnapshotSlotBlock> _snapshot_slots;
+  std::atomic<uint64_t> _current_snapshot_slot_epoch{0};
 };
 }  // namespace opossum
@@ -39,11 +39,17 @@ const boost::bimap<EncodingType, std::string> encoding_type_to_string = make_bim
     {EncodingType::FixedStringDictionary, "FixedStringDictionary"},
     {EncodingType::FrameOfReference, "FrameOfReference"},
     {EncodingType::LZ4, "LZ4"},
+    {EncodingType::FSST, "FSST"},
+    {EncodingType::FrontCodedDictionary, "FrontCodedDictionary"},
     {EncodingType::Unencoded, "Unencoded"},
 });
 
 const boost::bimap<FileType, std::string> file_type_to_string = make_bimap<FileType, std::string>(
-    {{FileType::Tbl, "Tbl"}, {FileType::Csv, "Csv"}, {FileType::Binary, "Binary"}, {FileType::Auto, "Auto"}});
+    {{FileType::Tbl, "Tbl"},
+     {FileType::Csv, "Csv"},
+     {FileType::Binary, "Binary"},
+     {FileType::Arrow, "Arrow"},
+     {FileType::Auto, "Auto"}});
 
 const boost::bimap<LogLevel, std::string> log_level_to_string = make_bimap<LogLevel, std::string>(
     {{LogLevel::Debug, "Debug"}, {LogLevel::Info, "Info"}, {LogLevel::Warning, "Warning"}});
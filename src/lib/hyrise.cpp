@@ -1,5 +1,10 @@
 #include "hyrise.hpp"
 
+#include "optimizer/optimizer_rule_statistics.hpp"
+#include "sql/query_statistics_store.hpp"
+#include "statistics/cardinality_feedback_store.hpp"
+#include "statistics/subplan_statistics_cache.hpp"
+
 namespace opossum {
 
 Hyrise::Hyrise() {
@@ -20,6 +25,7 @@ Hyrise::Hyrise() {
   settings_manager = SettingsManager{};
   log_manager = LogManager{};
   topology = Topology{};
+  optimizer_rule_statistics = std::make_shared<OptimizerRuleStatistics>();
   _scheduler = std::make_shared<ImmediateExecutionScheduler>();
 }
 
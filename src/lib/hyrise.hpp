@@ -1,5 +1,8 @@
 #pragma once
 
+#include <chrono>
+#include <optional>
+
 #include "boost/container/pmr/memory_resource.hpp"
 #include "concurrency/transaction_manager.hpp"
 #include "scheduler/immediate_execution_scheduler.hpp"
@@ -16,6 +19,11 @@ namespace opossum {
 
 class AbstractScheduler;
 class BenchmarkRunner;
+class CardinalityFeedbackStore;
+class OptimizerRuleStatistics;
+class QueryStatisticsStore;
+class SQLResultCache;
+class SubplanStatisticsCache;
 
 // This should be the only singleton in the src/lib world. It provides a unified way of accessing components like the
 // storage manager, the transaction manager, and more. Encapsulating this in one class avoids the static initialization
@@ -52,6 +60,33 @@ class Hyrise : public Singleton<Hyrise> {
   std::shared_ptr<SQLPhysicalPlanCache> default_pqp_cache;
   std::shared_ptr<SQLLogicalPlanCache> default_lqp_cache;
 
+  // Result cache used by the SQLPipelineBuilder if `with_result_cache()` is not used. It is opt-in, i.e., nullptr
+  // unless set by the user.
+  std::shared_ptr<SQLResultCache> default_result_cache;
+
+  // Cache of estimated statistics that is shared between queries, used by the CardinalityEstimator. It is opt-in,
+  // i.e., nullptr unless set by the user, as its entries hold deep copies of the estimated subplans.
+  std::shared_ptr<SubplanStatisticsCache> default_subplan_statistics_cache;
+
+  // Selectivities observed when executing queries, used by the CardinalityEstimator. It is opt-in, i.e., nullptr unless
+  // set by the user, as recording the selectivities re-estimates the predicates and joins of each executed plan.
+  std::shared_ptr<CardinalityFeedbackStore> default_cardinality_feedback_store;
+
+  // Execution statistics of SQL statements, exposed by the meta_query_statistics table. It is opt-in, i.e., nullptr
+  // unless set by the user, as the store keeps an entry for each distinct normalized statement.
+  std::shared_ptr<QueryStatisticsStore> default_query_statistics_store;
+
+  // Memory limit in bytes for each SQL statement, used by the SQLPipelineBuilder if `with_memory_limit()` is not used.
+  // std::nullopt (the default) means that statements are not limited.
+  std::optional<size_t> default_statement_memory_limit;
+
+  // Time budget of the optimizers created by Optimizer::create_default_optimizer() (see Optimizer). std::nullopt (the
+  // default) means that all optimizer rules are applied.
+  std::optional<std::chrono::nanoseconds> default_optimizer_time_budget;
+
+  // Durations of the optimizer rules, shared by all optimizers with a time budget. Always set.
+  std::shared_ptr<OptimizerRuleStatistics> optimizer_rule_statistics;
+
   // The BenchmarkRunner is available here so that non-benchmark components can add information to the benchmark
   // result JSON.
   std::weak_ptr<BenchmarkRunner> benchmark_runner;
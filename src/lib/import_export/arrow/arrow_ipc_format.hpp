@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+namespace opossum::arrow_ipc {
+
+/**
+ * Definitions of the Arrow IPC file format (also known as Feather V2) that are used by ArrowIpcWriter and
+ * ArrowIpcParser. See https://arrow.apache.org/docs/format/Columnar.html#ipc-file-format and the FlatBuffers schemas
+ * Schema.fbs, Message.fbs, and File.fbs in https://github.com/apache/arrow/tree/master/format. The field enums list the
+ * ids of the fields in the FlatBuffers tables.
+ *
+ * A file has the following layout:
+ *
+ *   MAGIC, padded to 8 bytes
+ *   Schema message
+ *   Dictionary batch messages
+ *   Record batch messages
+ *   End-of-stream marker (CONTINUATION_MARKER, 0)
+ *   Footer (FlatBuffers table with the schema and the positions of all batches)
+ *   Footer length (int32)
+ *   MAGIC
+ *
+ * Each message starts with CONTINUATION_MARKER and the length of its FlatBuffers metadata, which is padded to 8 bytes.
+ * The metadata is followed by the message body, which contains the buffers of the arrays, each padded to 8 bytes.
+ */
+
+constexpr auto MAGIC = std::string_view{"ARROW1"};
+constexpr auto CONTINUATION_MARKER = uint32_t{0xFFFFFFFF};
+constexpr auto ALIGNMENT = size_t{8};
+
+enum class MetadataVersion : int16_t { V4 = 3, V5 = 4 };
+
+enum class MessageHeader : uint8_t { Schema = 1, DictionaryBatch = 2, RecordBatch = 3 };
+
+// Only the types that are supported by Hyrise are listed
+enum class Type : uint8_t { Int = 2, FloatingPoint = 3, Utf8 = 5, LargeUtf8 = 20 };
+
+enum class Precision : int16_t { Half = 0, Single = 1, Double = 2 };
+
+enum class Endianness : int16_t { Little = 0, Big = 1 };
+
+enum class MessageField : uint16_t { Version = 0, HeaderType = 1, Header = 2, BodyLength = 3 };
+
+enum class SchemaField : uint16_t { Endianness = 0, Fields = 1 };
+
+enum class FieldField : uint16_t { Name = 0, Nullable = 1, TypeType = 2, Type = 3, Dictionary = 4, Children = 5 };
+
+enum class IntField : uint16_t { BitWidth = 0, IsSigned = 1 };
+
+enum class FloatingPointField : uint16_t { Precision = 0 };
+
+enum class DictionaryEncodingField : uint16_t { Id = 0, IndexType = 1, IsOrdered = 2 };
+
+enum class RecordBatchField : uint16_t { Length = 0, Nodes = 1, Buffers = 2, Compression = 3 };
+
+enum class DictionaryBatchField : uint16_t { Id = 0, Data = 1, IsDelta = 2 };
+
+enum class FooterField : uint16_t { Version = 0, Schema = 1, Dictionaries = 2, RecordBatches = 3 };
+
+// FlatBuffers structs, which are stored inline with the same layout as the C++ structs
+
+struct FieldNode {
+  int64_t length;
+  int64_t null_count;
+};
+
+struct Buffer {
+  int64_t offset;
+  int64_t length;
+};
+
+struct Block {
+  int64_t offset;
+  int32_t metadata_length;
+  int64_t body_length;
+};
+
+static_assert(sizeof(FieldNode) == 16 && sizeof(Buffer) == 16 && sizeof(Block) == 24, "Unexpected struct layout");
+
+}  // namespace opossum::arrow_ipc
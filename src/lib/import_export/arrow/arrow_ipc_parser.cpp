@@ -0,0 +1,490 @@
+#include "arrow_ipc_parser.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "import_export/arrow/arrow_ipc_format.hpp"
+#include "import_export/arrow/flatbuffer.hpp"
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "storage/vector_compression/vector_compression.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Physical type of the values of an Arrow array. Strings use the bit width for their offsets.
+struct ArrowType {
+  arrow_ipc::Type type;
+  int32_t bit_width;
+  bool is_signed;
+};
+
+struct ArrowColumn {
+  std::string name;
+  DataType data_type;
+  bool nullable;
+  ArrowType value_type;
+  std::optional<int64_t> dictionary_id;
+  ArrowType index_type;
+};
+
+// Calls the functor with the C++ type that corresponds to the given Arrow number type
+template <typename Functor>
+void resolve_number_type(const ArrowType& type, const Functor& functor) {
+  if (type.type == arrow_ipc::Type::FloatingPoint) {
+    type.bit_width == 32 ? functor(hana::type_c<float>) : functor(hana::type_c<double>);
+    return;
+  }
+
+  switch (type.bit_width) {
+    case 8:
+      type.is_signed ? functor(hana::type_c<int8_t>) : functor(hana::type_c<uint8_t>);
+      return;
+    case 16:
+      type.is_signed ? functor(hana::type_c<int16_t>) : functor(hana::type_c<uint16_t>);
+      return;
+    case 32:
+      type.is_signed ? functor(hana::type_c<int32_t>) : functor(hana::type_c<uint32_t>);
+      return;
+    case 64:
+      type.is_signed ? functor(hana::type_c<int64_t>) : functor(hana::type_c<uint64_t>);
+      return;
+  }
+  FailInput("Unsupported Arrow integer bit width " + std::to_string(type.bit_width));
+}
+
+ArrowType read_type(const FlatBufferTable& field, const std::string& name) {
+  const auto type_type = field.scalar(arrow_ipc::FieldField::TypeType, uint8_t{0});
+  const auto type = field.table(arrow_ipc::FieldField::Type);
+
+  switch (static_cast<arrow_ipc::Type>(type_type)) {
+    case arrow_ipc::Type::Int:
+      AssertInput(type, "Missing integer type of Arrow column " + name);
+      return {arrow_ipc::Type::Int, type->scalar(arrow_ipc::IntField::BitWidth, int32_t{0}),
+              type->scalar(arrow_ipc::IntField::IsSigned, uint8_t{0}) != 0};
+    case arrow_ipc::Type::FloatingPoint: {
+      AssertInput(type, "Missing floating point type of Arrow column " + name);
+      const auto precision = type->scalar(arrow_ipc::FloatingPointField::Precision, arrow_ipc::Precision::Half);
+      AssertInput(precision == arrow_ipc::Precision::Single || precision == arrow_ipc::Precision::Double,
+                  "Half precision floats are not supported (column " + name + ")");
+      return {arrow_ipc::Type::FloatingPoint, precision == arrow_ipc::Precision::Single ? 32 : 64, true};
+    }
+    case arrow_ipc::Type::Utf8:
+      return {arrow_ipc::Type::Utf8, 32, true};
+    case arrow_ipc::Type::LargeUtf8:
+      return {arrow_ipc::Type::LargeUtf8, 64, true};
+  }
+  FailInput("Unsupported Arrow type " + std::to_string(type_type) + " of column " + name);
+}
+
+DataType data_type_from_arrow_type(const ArrowType& type, const std::string& name) {
+  switch (type.type) {
+    case arrow_ipc::Type::Int:
+      AssertInput(type.bit_width == 8 || type.bit_width == 16 || type.bit_width == 32 || type.bit_width == 64,
+                  "Unsupported integer bit width of Arrow column " + name);
+      AssertInput(type.bit_width < 64 || type.is_signed, "Unsigned 64 bit integers are not supported (column " + name +
+                                                             ")");
+      return type.bit_width < 32 || (type.bit_width == 32 && type.is_signed) ? DataType::Int : DataType::Long;
+    case arrow_ipc::Type::FloatingPoint:
+      return type.bit_width == 32 ? DataType::Float : DataType::Double;
+    case arrow_ipc::Type::Utf8:
+    case arrow_ipc::Type::LargeUtf8:
+      return DataType::String;
+  }
+  Fail("Invalid Arrow type");
+}
+
+std::vector<ArrowColumn> read_columns(const FlatBufferTable& schema) {
+  AssertInput(schema.scalar(arrow_ipc::SchemaField::Endianness, arrow_ipc::Endianness::Little) ==
+                  arrow_ipc::Endianness::Little,
+              "Big-endian Arrow files are not supported");
+
+  auto columns = std::vector<ArrowColumn>{};
+  for (const auto& field : schema.table_vector(arrow_ipc::SchemaField::Fields)) {
+    auto column = ArrowColumn{};
+    column.name = std::string{field.string(arrow_ipc::FieldField::Name)};
+    column.nullable = field.scalar(arrow_ipc::FieldField::Nullable, uint8_t{0}) != 0;
+    column.value_type = read_type(field, column.name);
+    column.data_type = data_type_from_arrow_type(column.value_type, column.name);
+
+    if (const auto dictionary = field.table(arrow_ipc::FieldField::Dictionary)) {
+      column.dictionary_id = dictionary->scalar(arrow_ipc::DictionaryEncodingField::Id, int64_t{0});
+      // Indices are int32 unless specified otherwise
+      column.index_type = {arrow_ipc::Type::Int, 32, true};
+      if (const auto index_type = dictionary->table(arrow_ipc::DictionaryEncodingField::IndexType)) {
+        column.index_type = {arrow_ipc::Type::Int, index_type->scalar(arrow_ipc::IntField::BitWidth, int32_t{0}),
+                             index_type->scalar(arrow_ipc::IntField::IsSigned, uint8_t{0}) != 0};
+      }
+    }
+
+    columns.emplace_back(std::move(column));
+  }
+  return columns;
+}
+
+class InputFile {
+ public:
+  explicit InputFile(const std::string& filename) : _stream(filename, std::ios::binary) {
+    _stream.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+    _stream.seekg(0, std::ios::end);
+    _size = static_cast<size_t>(_stream.tellg());
+  }
+
+  size_t size() const { return _size; }
+
+  void read(const size_t position, void* data, const size_t size) {
+    AssertInput(position <= _size && size <= _size - position, "Arrow file is truncated");
+    _stream.seekg(static_cast<std::streamoff>(position));
+    _stream.read(static_cast<char*>(data), static_cast<std::streamsize>(size));
+  }
+
+  template <typename T>
+  T read_value(const size_t position) {
+    auto value = T{};
+    read(position, &value, sizeof(T));
+    return value;
+  }
+
+  std::string read_string(const size_t position, const size_t size) {
+    auto string = std::string(size, '\0');
+    read(position, string.data(), size);
+    return string;
+  }
+
+ private:
+  std::ifstream _stream;
+  size_t _size;
+};
+
+// An encapsulated message, i.e., its FlatBuffers metadata and the position of its body in the file
+struct Message {
+  FlatBufferTable header() const {
+    const auto header = FlatBufferTable::root(metadata).table(arrow_ipc::MessageField::Header);
+    AssertInput(header, "Arrow message has no header");
+    return *header;
+  }
+
+  std::string metadata;
+  size_t body_position;
+  size_t body_length;
+};
+
+Message read_message(InputFile& file, const arrow_ipc::Block& block, const arrow_ipc::MessageHeader header_type) {
+  AssertInput(block.offset >= 0 && block.metadata_length >= 0 && block.body_length >= 0, "Invalid Arrow block");
+
+  auto position = static_cast<size_t>(block.offset);
+  auto metadata_length = file.read_value<uint32_t>(position);
+  position += sizeof(uint32_t);
+  // Files written before Arrow 0.15 do not contain the continuation marker
+  if (metadata_length == arrow_ipc::CONTINUATION_MARKER) {
+    metadata_length = file.read_value<uint32_t>(position);
+    position += sizeof(uint32_t);
+  }
+
+  auto message = Message{};
+  message.metadata = file.read_string(position, metadata_length);
+  message.body_position = static_cast<size_t>(block.offset) + static_cast<size_t>(block.metadata_length);
+  message.body_length = static_cast<size_t>(block.body_length);
+  AssertInput(message.body_position <= file.size() && message.body_length <= file.size() - message.body_position,
+              "Arrow file is truncated");
+
+  const auto message_table = FlatBufferTable::root(message.metadata);
+  AssertInput(message_table.scalar(arrow_ipc::MessageField::Version, arrow_ipc::MetadataVersion::V4) >=
+                  arrow_ipc::MetadataVersion::V4,
+              "Arrow files written before Arrow 1.0 are not supported");
+  AssertInput(message_table.scalar(arrow_ipc::MessageField::HeaderType, arrow_ipc::MessageHeader{}) == header_type,
+              "Unexpected Arrow message type");
+  return message;
+}
+
+// Reads the arrays of a record batch in the order of the nodes and buffers
+class RecordBatchReader {
+ public:
+  RecordBatchReader(InputFile& file, const FlatBufferTable& record_batch, const Message& message)
+      : _file(file),
+        _nodes(record_batch.vector<arrow_ipc::FieldNode>(arrow_ipc::RecordBatchField::Nodes)),
+        _buffers(record_batch.vector<arrow_ipc::Buffer>(arrow_ipc::RecordBatchField::Buffers)),
+        _body_position(message.body_position),
+        _body_length(message.body_length) {
+    AssertInput(!record_batch.table(arrow_ipc::RecordBatchField::Compression),
+                "Compressed Arrow files are not supported, write them with compression='uncompressed'");
+    length = record_batch.scalar(arrow_ipc::RecordBatchField::Length, int64_t{0});
+    AssertInput(length >= 0, "Invalid Arrow record batch length");
+  }
+
+  arrow_ipc::FieldNode next_node() {
+    AssertInput(_node_idx < _nodes.size(), "Arrow record batch has too few nodes");
+    const auto node = _nodes[_node_idx++];
+    AssertInput(node.length >= 0 && node.null_count >= 0 && node.null_count <= node.length, "Invalid Arrow node");
+    return node;
+  }
+
+  // Returns the null values of the array, or an empty vector if the array contains no NULLs
+  pmr_vector<bool> read_null_values(const arrow_ipc::FieldNode& node) {
+    const auto [position, size] = _next_buffer();
+    if (node.null_count == 0) return {};
+
+    const auto length = static_cast<size_t>(node.length);
+    AssertInput(size >= (length + 7) / 8, "Arrow validity bitmap is too small");
+    const auto bitmap = _file.read_string(position, (length + 7) / 8);
+
+    auto null_values = pmr_vector<bool>(length);
+    for (auto index = size_t{0}; index < length; ++index) {
+      null_values[index] = !((static_cast<uint8_t>(bitmap[index / 8]) >> (index % 8)) & 1u);
+    }
+    return null_values;
+  }
+
+  template <typename T>
+  pmr_vector<T> read_values(const size_t count, const ArrowType& type) {
+    if constexpr (std::is_same_v<T, pmr_string>) {
+      return _read_strings(count, type);
+    } else {
+      return _read_numbers<T>(count, type);
+    }
+  }
+
+  int64_t length;
+
+ private:
+  std::pair<size_t, size_t> _next_buffer() {
+    AssertInput(_buffer_idx < _buffers.size(), "Arrow record batch has too few buffers");
+    const auto buffer = _buffers[_buffer_idx++];
+    AssertInput(buffer.offset >= 0 && buffer.length >= 0 && static_cast<size_t>(buffer.offset) <= _body_length &&
+                    static_cast<size_t>(buffer.length) <= _body_length - static_cast<size_t>(buffer.offset),
+                "Invalid Arrow buffer");
+    return {_body_position + static_cast<size_t>(buffer.offset), static_cast<size_t>(buffer.length)};
+  }
+
+  template <typename T>
+  pmr_vector<T> _read_numbers(const size_t count, const ArrowType& type) {
+    const auto [position, size] = _next_buffer();
+    auto values = pmr_vector<T>(count);
+
+    resolve_number_type(type, [&, position = position, size = size](const auto source_type_t) {
+      using SourceType = typename decltype(source_type_t)::type;
+      AssertInput(size >= count * sizeof(SourceType), "Arrow value buffer is too small");
+
+      if constexpr (std::is_same_v<SourceType, T>) {
+        // The layouts match, so the values are read directly into the segment's vector
+        _file.read(position, values.data(), count * sizeof(T));
+      } else {
+        auto source_values = std::vector<SourceType>(count);
+        _file.read(position, source_values.data(), count * sizeof(SourceType));
+        std::transform(source_values.cbegin(), source_values.cend(), values.begin(),
+                       [](const auto value) { return static_cast<T>(value); });
+      }
+    });
+
+    return values;
+  }
+
+  pmr_vector<pmr_string> _read_strings(const size_t count, const ArrowType& type) {
+    // Empty arrays may omit the offsets
+    if (count == 0) {
+      _next_buffer();
+      _next_buffer();
+      return {};
+    }
+
+    const auto offsets = _read_numbers<int64_t>(count + 1, {arrow_ipc::Type::Int, type.bit_width, true});
+    const auto [position, size] = _next_buffer();
+    const auto data = _file.read_string(position, size);
+
+    auto values = pmr_vector<pmr_string>(count);
+    for (auto index = size_t{0}; index < count; ++index) {
+      const auto begin = offsets[index];
+      const auto end = offsets[index + 1];
+      AssertInput(begin >= 0 && begin <= end && static_cast<size_t>(end) <= data.size(),
+                  "Invalid Arrow string offsets");
+      values[index] = pmr_string{data.data() + begin, static_cast<size_t>(end - begin)};
+    }
+    return values;
+  }
+
+  InputFile& _file;
+  const std::vector<arrow_ipc::FieldNode> _nodes;
+  const std::vector<arrow_ipc::Buffer> _buffers;
+  const size_t _body_position;
+  const size_t _body_length;
+  size_t _node_idx{0};
+  size_t _buffer_idx{0};
+};
+
+// Creates a DictionarySegment that contains only those values of the Arrow dictionary that are used by the chunk
+template <typename T>
+std::shared_ptr<BaseSegment> create_dictionary_segment(const pmr_vector<T>& dictionary,
+                                                       const pmr_vector<int64_t>& indices,
+                                                       const pmr_vector<bool>& null_values) {
+  const auto row_count = indices.size();
+  auto used_indices = std::vector<size_t>{};
+  auto is_used = std::vector<bool>(dictionary.size());
+  for (auto row_idx = size_t{0}; row_idx < row_count; ++row_idx) {
+    if (!null_values.empty() && null_values[row_idx]) continue;
+
+    const auto index = indices[row_idx];
+    AssertInput(index >= 0 && static_cast<size_t>(index) < dictionary.size(), "Invalid Arrow dictionary index");
+    if (!is_used[index]) {
+      is_used[index] = true;
+      used_indices.emplace_back(index);
+    }
+  }
+
+  // Arrow dictionaries are neither necessarily sorted nor free of duplicates
+  std::sort(used_indices.begin(), used_indices.end(),
+            [&](const auto lhs, const auto rhs) { return dictionary[lhs] < dictionary[rhs]; });
+  auto chunk_dictionary = std::make_shared<pmr_vector<T>>();
+  chunk_dictionary->reserve(used_indices.size());
+  auto value_ids = std::vector<uint32_t>(dictionary.size());
+  for (const auto index : used_indices) {
+    if (chunk_dictionary->empty() || chunk_dictionary->back() != dictionary[index]) {
+      chunk_dictionary->emplace_back(dictionary[index]);
+    }
+    value_ids[index] = static_cast<uint32_t>(chunk_dictionary->size() - 1);
+  }
+
+  const auto null_value_id = static_cast<uint32_t>(chunk_dictionary->size());
+  auto attribute_vector = pmr_vector<uint32_t>(row_count);
+  for (auto row_idx = size_t{0}; row_idx < row_count; ++row_idx) {
+    attribute_vector[row_idx] =
+        !null_values.empty() && null_values[row_idx] ? null_value_id : value_ids[indices[row_idx]];
+  }
+
+  const auto compressed_attribute_vector = std::shared_ptr<const BaseCompressedVector>(
+      compress_vector(attribute_vector, VectorCompressionType::FixedSizeByteAligned, {}, {null_value_id}));
+  return std::make_shared<DictionarySegment<T>>(chunk_dictionary, compressed_attribute_vector);
+}
+
+}  // namespace
+
+namespace opossum {
+
+std::shared_ptr<Table> ArrowIpcParser::parse(const std::string& filename) {
+  auto file = InputFile{filename};
+
+  // The file starts with the padded magic and ends with the footer, its length, and the magic
+  const auto magic_size = arrow_ipc::MAGIC.size();
+  AssertInput(file.size() >= arrow_ipc::ALIGNMENT + sizeof(int32_t) + magic_size &&
+                  file.read_string(0, magic_size) == arrow_ipc::MAGIC &&
+                  file.read_string(file.size() - magic_size, magic_size) == arrow_ipc::MAGIC,
+              filename + " is not an Arrow IPC file");
+  const auto footer_length_position = file.size() - magic_size - sizeof(int32_t);
+  const auto footer_length = file.read_value<int32_t>(footer_length_position);
+  AssertInput(footer_length > 0 && static_cast<size_t>(footer_length) <= footer_length_position - arrow_ipc::ALIGNMENT,
+              "Invalid Arrow footer length");
+  const auto footer_data = file.read_string(footer_length_position - footer_length, footer_length);
+  const auto footer = FlatBufferTable::root(footer_data);
+
+  const auto schema = footer.table(arrow_ipc::FooterField::Schema);
+  AssertInput(schema, "Arrow file has no schema");
+  const auto columns = read_columns(*schema);
+  const auto column_count = columns.size();
+  AssertInput(column_count > 0, "Arrow file has no columns");
+
+  auto column_definitions = TableColumnDefinitions{};
+  auto dictionary_columns = std::unordered_map<int64_t, ColumnID>{};
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    const auto& column = columns[column_id];
+    column_definitions.emplace_back(column.name, column.data_type, column.nullable);
+    if (column.dictionary_id) dictionary_columns.emplace(*column.dictionary_id, column_id);
+  }
+
+  // Dictionaries are stored as ValueSegments of the column's data type. Delta batches extend a dictionary.
+  auto dictionaries = std::unordered_map<int64_t, std::shared_ptr<BaseSegment>>{};
+  for (const auto& block : footer.vector<arrow_ipc::Block>(arrow_ipc::FooterField::Dictionaries)) {
+    const auto message = read_message(file, block, arrow_ipc::MessageHeader::DictionaryBatch);
+    const auto dictionary_batch = message.header();
+    const auto id = dictionary_batch.scalar(arrow_ipc::DictionaryBatchField::Id, int64_t{0});
+    const auto column_iter = dictionary_columns.find(id);
+    AssertInput(column_iter != dictionary_columns.end(), "Unknown Arrow dictionary id " + std::to_string(id));
+    const auto& column = columns[column_iter->second];
+
+    const auto record_batch = dictionary_batch.table(arrow_ipc::DictionaryBatchField::Data);
+    AssertInput(record_batch, "Arrow dictionary batch has no data");
+    auto reader = RecordBatchReader{file, *record_batch, message};
+    const auto node = reader.next_node();
+    AssertInput(reader.read_null_values(node).empty(), "NULL values in Arrow dictionaries are not supported");
+
+    resolve_data_type(column.data_type, [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      auto values = reader.read_values<ColumnDataType>(node.length, column.value_type);
+
+      auto& dictionary = dictionaries[id];
+      if (dictionary && dictionary_batch.scalar(arrow_ipc::DictionaryBatchField::IsDelta, uint8_t{0})) {
+        auto& dictionary_values = static_cast<ValueSegment<ColumnDataType>&>(*dictionary).values();
+        dictionary_values.insert(dictionary_values.end(), std::make_move_iterator(values.begin()),
+                                 std::make_move_iterator(values.end()));
+      } else {
+        dictionary = std::make_shared<ValueSegment<ColumnDataType>>(std::move(values));
+      }
+    });
+  }
+
+  auto chunks = std::vector<Segments>{};
+  auto max_chunk_size = size_t{Chunk::DEFAULT_SIZE};
+  for (const auto& block : footer.vector<arrow_ipc::Block>(arrow_ipc::FooterField::RecordBatches)) {
+    const auto message = read_message(file, block, arrow_ipc::MessageHeader::RecordBatch);
+    const auto record_batch = message.header();
+    auto reader = RecordBatchReader{file, record_batch, message};
+    const auto row_count = static_cast<size_t>(reader.length);
+    AssertInput(row_count < std::numeric_limits<ChunkOffset>::max(), "Arrow record batch is too large");
+
+    auto segments = Segments{};
+    for (const auto& column : columns) {
+      const auto node = reader.next_node();
+      AssertInput(static_cast<size_t>(node.length) == row_count, "Arrow array length does not match record batch");
+      auto null_values = reader.read_null_values(node);
+      AssertInput(null_values.empty() || column.nullable, "Arrow column " + column.name + " is not nullable");
+
+      resolve_data_type(column.data_type, [&](const auto data_type_t) {
+        using ColumnDataType = typename decltype(data_type_t)::type;
+
+        if (column.dictionary_id) {
+          const auto dictionary_iter = dictionaries.find(*column.dictionary_id);
+          AssertInput(dictionary_iter != dictionaries.end(), "Missing Arrow dictionary for column " + column.name);
+          const auto& dictionary = static_cast<const ValueSegment<ColumnDataType>&>(*dictionary_iter->second);
+          const auto indices = reader.read_values<int64_t>(row_count, column.index_type);
+          segments.emplace_back(create_dictionary_segment(dictionary.values(), indices, null_values));
+          return;
+        }
+
+        auto values = reader.read_values<ColumnDataType>(row_count, column.value_type);
+        if (!column.nullable) {
+          segments.emplace_back(std::make_shared<ValueSegment<ColumnDataType>>(std::move(values)));
+          return;
+        }
+        if (null_values.empty()) null_values.resize(row_count);
+        segments.emplace_back(
+            std::make_shared<ValueSegment<ColumnDataType>>(std::move(values), std::move(null_values)));
+      });
+    }
+
+    if (row_count == 0) continue;
+    max_chunk_size = std::max(max_chunk_size, row_count);
+    chunks.emplace_back(std::move(segments));
+  }
+
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data,
+                                             static_cast<ChunkOffset>(max_chunk_size), UseMvcc::Yes);
+  for (auto& segments : chunks) {
+    const auto mvcc_data = std::make_shared<MvccData>(segments.front()->size(), CommitID{0});
+    table->append_chunk(segments, mvcc_data);
+    table->last_chunk()->finalize();
+  }
+  return table;
+}
+
+}  // namespace opossum
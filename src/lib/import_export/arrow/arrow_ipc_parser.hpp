@@ -0,0 +1,27 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+namespace opossum {
+
+class Table;
+
+/**
+ * Reads an Arrow IPC file (Feather V2) as written by ArrowIpcWriter, pyarrow (pyarrow.feather.write_table with
+ * compression="uncompressed"), pandas, or other Arrow implementations. The format is described in arrow_ipc_format.hpp.
+ *
+ * Each record batch becomes a chunk. Dictionary arrays become DictionarySegments that contain only the values used by
+ * the chunk, all other arrays become ValueSegments. Buffers whose layout matches that of the segment are read directly
+ * into the segment without an intermediate copy.
+ *
+ * Signed integers of up to 32 bits and unsigned integers of up to 16 bits are read as int, signed 64 bit and unsigned
+ * 32 bit integers as long, float32 as float, float64 as double, and utf8 and large_utf8 as string. Other types,
+ * compressed buffers, and big-endian files are not supported.
+ */
+class ArrowIpcParser {
+ public:
+  static std::shared_ptr<Table> parse(const std::string& filename);
+};
+
+}  // namespace opossum
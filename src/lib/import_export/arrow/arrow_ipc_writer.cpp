@@ -0,0 +1,432 @@
+#include "arrow_ipc_writer.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <list>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "import_export/arrow/arrow_ipc_format.hpp"
+#include "import_export/arrow/flatbuffer.hpp"
+#include "resolve_type.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+size_t padding_size(const size_t size) {
+  return (arrow_ipc::ALIGNMENT - size % arrow_ipc::ALIGNMENT) % arrow_ipc::ALIGNMENT;
+}
+
+// The nodes and buffers of the arrays of a record batch. Buffers are either owned by the body or point to the data of a
+// segment, which is written without copying it first.
+class RecordBatchBody {
+ public:
+  void add_node(const size_t length, const size_t null_count) {
+    _nodes.push_back({static_cast<int64_t>(length), static_cast<int64_t>(null_count)});
+  }
+
+  void add_buffer(const void* data, const size_t size) {
+    _buffers.push_back({_length, static_cast<int64_t>(size)});
+    _pieces.emplace_back(static_cast<const char*>(data), size);
+    _length += static_cast<int64_t>(size + padding_size(size));
+  }
+
+  void add_owned_buffer(std::string&& data) {
+    _owned_buffers.emplace_back(std::move(data));
+    add_buffer(_owned_buffers.back().data(), _owned_buffers.back().size());
+  }
+
+  const std::vector<arrow_ipc::FieldNode>& nodes() const { return _nodes; }
+  const std::vector<arrow_ipc::Buffer>& buffers() const { return _buffers; }
+  int64_t length() const { return _length; }
+
+  void write(std::ofstream& stream) const {
+    static constexpr char padding[arrow_ipc::ALIGNMENT] = {};
+    for (const auto& [data, size] : _pieces) {
+      stream.write(data, static_cast<std::streamsize>(size));
+      stream.write(padding, static_cast<std::streamsize>(padding_size(size)));
+    }
+  }
+
+ private:
+  std::vector<arrow_ipc::FieldNode> _nodes;
+  std::vector<arrow_ipc::Buffer> _buffers;
+  std::vector<std::pair<const char*, size_t>> _pieces;
+  std::list<std::string> _owned_buffers;
+  int64_t _length{0};
+};
+
+// Arrow marks valid (i.e., non-NULL) values with a set bit, starting with the least significant bit
+void set_valid(std::string& validity, const size_t index) {
+  validity[index / 8] |= static_cast<char>(1u << (index % 8));
+}
+
+template <typename T>
+void add_array(RecordBatchBody& body, const BaseSegment& segment) {
+  const auto row_count = segment.size();
+  auto validity = std::string((row_count + 7) / 8, '\0');
+  auto null_count = size_t{0};
+
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    auto offsets = std::vector<int32_t>(row_count + 1);
+    auto data = std::string{};
+
+    auto row_idx = size_t{0};
+    segment_iterate<T>(segment, [&](const auto& position) {
+      if (position.is_null()) {
+        ++null_count;
+      } else {
+        set_valid(validity, row_idx);
+        data.append(position.value());
+        Assert(data.size() <= static_cast<size_t>(std::numeric_limits<int32_t>::max()),
+               "String data of a chunk exceeds 2 GB, use a smaller chunk size");
+      }
+      ++row_idx;
+      offsets[row_idx] = static_cast<int32_t>(data.size());
+    });
+
+    body.add_node(row_count, null_count);
+    body.add_owned_buffer(null_count > 0 ? std::move(validity) : std::string{});
+    auto offset_bytes = std::string(offsets.size() * sizeof(int32_t), '\0');
+    std::memcpy(offset_bytes.data(), offsets.data(), offset_bytes.size());
+    body.add_owned_buffer(std::move(offset_bytes));
+    body.add_owned_buffer(std::move(data));
+  } else {
+    // The values of a ValueSegment are written directly from the segment
+    const auto value_segment = dynamic_cast<const ValueSegment<T>*>(&segment);
+    auto values = std::string(value_segment ? 0 : row_count * sizeof(T), '\0');
+
+    auto row_idx = size_t{0};
+    segment_iterate<T>(segment, [&](const auto& position) {
+      if (position.is_null()) {
+        ++null_count;
+      } else {
+        set_valid(validity, row_idx);
+        if (!value_segment) {
+          const auto value = position.value();
+          std::memcpy(values.data() + row_idx * sizeof(T), &value, sizeof(T));
+        }
+      }
+      ++row_idx;
+    });
+
+    body.add_node(row_count, null_count);
+    body.add_owned_buffer(null_count > 0 ? std::move(validity) : std::string{});
+    if (value_segment) {
+      body.add_buffer(value_segment->values().data(), row_count * sizeof(T));
+    } else {
+      body.add_owned_buffer(std::move(values));
+    }
+  }
+}
+
+// Writes the attribute vector of the segment as indices into the merged dictionary
+template <typename T>
+void add_dictionary_indices(RecordBatchBody& body, const DictionarySegment<T>& segment,
+                            const pmr_vector<T>& merged_dictionary) {
+  const auto& dictionary = *segment.dictionary();
+  const auto null_value_id = segment.null_value_id();
+
+  // Both dictionaries are sorted, so the indices of the values are found in a single pass
+  auto merged_indices = std::vector<int32_t>(dictionary.size());
+  auto merged_index = size_t{0};
+  for (auto value_id = size_t{0}; value_id < dictionary.size(); ++value_id) {
+    while (merged_dictionary[merged_index] < dictionary[value_id]) ++merged_index;
+    merged_indices[value_id] = static_cast<int32_t>(merged_index);
+  }
+
+  const auto row_count = segment.size();
+  auto validity = std::string((row_count + 7) / 8, '\0');
+  auto null_count = size_t{0};
+  auto indices = std::string(row_count * sizeof(int32_t), '\0');
+  const auto indices_data = reinterpret_cast<int32_t*>(indices.data());
+
+  resolve_compressed_vector_type(*segment.attribute_vector(), [&](const auto& attribute_vector) {
+    auto row_idx = size_t{0};
+    for (auto iter = attribute_vector.cbegin(); iter != attribute_vector.cend(); ++iter, ++row_idx) {
+      const auto value_id = static_cast<ValueID::base_type>(*iter);
+      if (value_id == null_value_id) {
+        ++null_count;
+      } else {
+        set_valid(validity, row_idx);
+        indices_data[row_idx] = merged_indices[value_id];
+      }
+    }
+  });
+
+  body.add_node(row_count, null_count);
+  body.add_owned_buffer(null_count > 0 ? std::move(validity) : std::string{});
+  body.add_owned_buffer(std::move(indices));
+}
+
+// Returns the union of the dictionaries of the column if all of its segments are DictionarySegments
+template <typename T>
+std::shared_ptr<ValueSegment<T>> merge_dictionaries(const Table& table, const ColumnID column_id) {
+  auto merged_dictionary = pmr_vector<T>{};
+  auto has_dictionary_segments = false;
+
+  const auto chunk_count = table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    const auto dictionary_segment =
+        std::dynamic_pointer_cast<const DictionarySegment<T>>(chunk->get_segment(column_id));
+    if (!dictionary_segment) return nullptr;
+
+    const auto& dictionary = *dictionary_segment->dictionary();
+    merged_dictionary.insert(merged_dictionary.end(), dictionary.cbegin(), dictionary.cend());
+    has_dictionary_segments = true;
+  }
+  if (!has_dictionary_segments) return nullptr;
+
+  std::sort(merged_dictionary.begin(), merged_dictionary.end());
+  merged_dictionary.erase(std::unique(merged_dictionary.begin(), merged_dictionary.end()), merged_dictionary.end());
+  Assert(merged_dictionary.size() <= static_cast<size_t>(std::numeric_limits<int32_t>::max()),
+         "Dictionary of column " + table.column_name(column_id) + " is too large for int32 indices");
+
+  return std::make_shared<ValueSegment<T>>(std::move(merged_dictionary));
+}
+
+FlatBufferBuilder::Offset build_int_type(FlatBufferBuilder& builder, const int32_t bit_width) {
+  builder.start_table();
+  builder.add_scalar(arrow_ipc::IntField::BitWidth, bit_width);
+  builder.add_scalar(arrow_ipc::IntField::IsSigned, uint8_t{1});
+  return builder.end_table();
+}
+
+FlatBufferBuilder::Offset build_schema(FlatBufferBuilder& builder, const Table& table,
+                                       const std::vector<std::shared_ptr<BaseSegment>>& dictionaries) {
+  auto fields = std::vector<FlatBufferBuilder::Offset>{};
+
+  const auto column_count = table.column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    const auto name = builder.create_string(table.column_name(column_id));
+
+    auto type_type = arrow_ipc::Type{};
+    auto type = FlatBufferBuilder::Offset{};
+    switch (table.column_data_type(column_id)) {
+      case DataType::Int:
+      case DataType::Long:
+        type_type = arrow_ipc::Type::Int;
+        type = build_int_type(builder, table.column_data_type(column_id) == DataType::Int ? 32 : 64);
+        break;
+      case DataType::Float:
+      case DataType::Double:
+        type_type = arrow_ipc::Type::FloatingPoint;
+        builder.start_table();
+        builder.add_scalar(arrow_ipc::FloatingPointField::Precision,
+                           table.column_data_type(column_id) == DataType::Float ? arrow_ipc::Precision::Single
+                                                                                : arrow_ipc::Precision::Double);
+        type = builder.end_table();
+        break;
+      case DataType::String:
+        type_type = arrow_ipc::Type::Utf8;
+        builder.start_table();
+        type = builder.end_table();
+        break;
+      case DataType::Null:
+        Fail("Cannot write columns of type NULL");
+    }
+
+    auto dictionary_encoding = FlatBufferBuilder::Offset{};
+    if (dictionaries[column_id]) {
+      const auto index_type = build_int_type(builder, 32);
+      builder.start_table();
+      builder.add_scalar(arrow_ipc::DictionaryEncodingField::Id, static_cast<int64_t>(column_id));
+      builder.add_offset(arrow_ipc::DictionaryEncodingField::IndexType, index_type);
+      builder.add_scalar(arrow_ipc::DictionaryEncodingField::IsOrdered, uint8_t{1});
+      dictionary_encoding = builder.end_table();
+    }
+
+    const auto children = builder.create_offset_vector({});
+
+    builder.start_table();
+    builder.add_offset(arrow_ipc::FieldField::Name, name);
+    builder.add_scalar(arrow_ipc::FieldField::Nullable, static_cast<uint8_t>(table.column_is_nullable(column_id)));
+    builder.add_scalar(arrow_ipc::FieldField::TypeType, type_type);
+    builder.add_offset(arrow_ipc::FieldField::Type, type);
+    if (dictionaries[column_id]) builder.add_offset(arrow_ipc::FieldField::Dictionary, dictionary_encoding);
+    builder.add_offset(arrow_ipc::FieldField::Children, children);
+    fields.emplace_back(builder.end_table());
+  }
+
+  const auto fields_vector = builder.create_offset_vector(fields);
+  builder.start_table();
+  builder.add_offset(arrow_ipc::SchemaField::Fields, fields_vector);
+  return builder.end_table();
+}
+
+FlatBufferBuilder::Offset build_record_batch(FlatBufferBuilder& builder, const size_t row_count,
+                                             const RecordBatchBody& body) {
+  const auto nodes = builder.create_vector(body.nodes());
+  const auto buffers = builder.create_vector(body.buffers());
+
+  builder.start_table();
+  builder.add_scalar(arrow_ipc::RecordBatchField::Length, static_cast<int64_t>(row_count));
+  builder.add_offset(arrow_ipc::RecordBatchField::Nodes, nodes);
+  builder.add_offset(arrow_ipc::RecordBatchField::Buffers, buffers);
+  return builder.end_table();
+}
+
+std::string build_message(FlatBufferBuilder& builder, const arrow_ipc::MessageHeader header_type,
+                          const FlatBufferBuilder::Offset header, const int64_t body_length) {
+  builder.start_table();
+  builder.add_scalar(arrow_ipc::MessageField::BodyLength, body_length);
+  builder.add_offset(arrow_ipc::MessageField::Header, header);
+  builder.add_scalar(arrow_ipc::MessageField::Version, arrow_ipc::MetadataVersion::V5);
+  builder.add_scalar(arrow_ipc::MessageField::HeaderType, header_type);
+  return builder.finish(builder.end_table());
+}
+
+class OutputFile {
+ public:
+  explicit OutputFile(const std::string& filename) : _stream(filename, std::ios::binary) {
+    _stream.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+  }
+
+  template <typename T>
+  void write_value(const T value) {
+    write(&value, sizeof(T));
+  }
+
+  void write(const void* data, const size_t size) {
+    _stream.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+    _position += size;
+  }
+
+  void write_padding() {
+    static constexpr char padding[arrow_ipc::ALIGNMENT] = {};
+    write(padding, padding_size(_position));
+  }
+
+  // Writes an encapsulated message and returns its position for the footer
+  arrow_ipc::Block write_message(const std::string& metadata, const RecordBatchBody& body) {
+    auto block = arrow_ipc::Block{};
+    block.offset = static_cast<int64_t>(_position);
+
+    const auto padded_metadata_length = metadata.size() + padding_size(metadata.size());
+    write_value(arrow_ipc::CONTINUATION_MARKER);
+    write_value(static_cast<int32_t>(padded_metadata_length));
+    write(metadata.data(), metadata.size());
+    write_padding();
+    block.metadata_length = static_cast<int32_t>(_position - block.offset);
+
+    body.write(_stream);
+    _position += body.length();
+    block.body_length = body.length();
+
+    return block;
+  }
+
+ private:
+  std::ofstream _stream;
+  size_t _position{0};
+};
+
+}  // namespace
+
+namespace opossum {
+
+void ArrowIpcWriter::write(const Table& table, const std::string& filename) {
+  auto file = OutputFile{filename};
+  file.write(arrow_ipc::MAGIC.data(), arrow_ipc::MAGIC.size());
+  file.write_padding();
+
+  const auto column_count = table.column_count();
+  auto dictionaries = std::vector<std::shared_ptr<BaseSegment>>(column_count);
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    resolve_data_type(table.column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      dictionaries[column_id] = merge_dictionaries<ColumnDataType>(table, column_id);
+    });
+  }
+
+  {
+    auto builder = FlatBufferBuilder{};
+    const auto schema = build_schema(builder, table, dictionaries);
+    file.write_message(build_message(builder, arrow_ipc::MessageHeader::Schema, schema, 0), RecordBatchBody{});
+  }
+
+  auto dictionary_blocks = std::vector<arrow_ipc::Block>{};
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    const auto& dictionary = dictionaries[column_id];
+    if (!dictionary) continue;
+
+    auto body = RecordBatchBody{};
+    resolve_data_type(table.column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      add_array<ColumnDataType>(body, *dictionary);
+    });
+
+    auto builder = FlatBufferBuilder{};
+    const auto record_batch = build_record_batch(builder, dictionary->size(), body);
+    builder.start_table();
+    builder.add_scalar(arrow_ipc::DictionaryBatchField::Id, static_cast<int64_t>(column_id));
+    builder.add_offset(arrow_ipc::DictionaryBatchField::Data, record_batch);
+    const auto dictionary_batch = builder.end_table();
+    const auto metadata =
+        build_message(builder, arrow_ipc::MessageHeader::DictionaryBatch, dictionary_batch, body.length());
+    dictionary_blocks.emplace_back(file.write_message(metadata, body));
+  }
+
+  auto record_batch_blocks = std::vector<arrow_ipc::Block>{};
+  const auto chunk_count = table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk || chunk->size() == 0) continue;
+
+    auto body = RecordBatchBody{};
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      const auto& segment = *chunk->get_segment(column_id);
+      resolve_data_type(table.column_data_type(column_id), [&](const auto data_type_t) {
+        using ColumnDataType = typename decltype(data_type_t)::type;
+        if (dictionaries[column_id]) {
+          const auto& dictionary = static_cast<const ValueSegment<ColumnDataType>&>(*dictionaries[column_id]);
+          add_dictionary_indices(body, static_cast<const DictionarySegment<ColumnDataType>&>(segment),
+                                 dictionary.values());
+        } else {
+          add_array<ColumnDataType>(body, segment);
+        }
+      });
+    }
+
+    auto builder = FlatBufferBuilder{};
+    const auto record_batch = build_record_batch(builder, chunk->size(), body);
+    const auto metadata = build_message(builder, arrow_ipc::MessageHeader::RecordBatch, record_batch, body.length());
+    record_batch_blocks.emplace_back(file.write_message(metadata, body));
+  }
+
+  // End-of-stream marker
+  file.write_value(arrow_ipc::CONTINUATION_MARKER);
+  file.write_value(int32_t{0});
+
+  auto builder = FlatBufferBuilder{};
+  const auto schema = build_schema(builder, table, dictionaries);
+  const auto dictionaries_vector = builder.create_vector(dictionary_blocks);
+  const auto record_batches_vector = builder.create_vector(record_batch_blocks);
+  builder.start_table();
+  builder.add_offset(arrow_ipc::FooterField::Schema, schema);
+  builder.add_offset(arrow_ipc::FooterField::Dictionaries, dictionaries_vector);
+  builder.add_offset(arrow_ipc::FooterField::RecordBatches, record_batches_vector);
+  builder.add_scalar(arrow_ipc::FooterField::Version, arrow_ipc::MetadataVersion::V5);
+  const auto footer = builder.finish(builder.end_table());
+
+  file.write(footer.data(), footer.size());
+  file.write_value(static_cast<int32_t>(footer.size()));
+  file.write(arrow_ipc::MAGIC.data(), arrow_ipc::MAGIC.size());
+}
+
+}  // namespace opossum
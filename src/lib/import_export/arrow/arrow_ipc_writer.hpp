@@ -0,0 +1,26 @@
+#pragma once
+
+#include <string>
+
+namespace opossum {
+
+class Table;
+
+/**
+ * Writes a table as an Arrow IPC file (Feather V2), which can be read by pyarrow (pyarrow.feather.read_table), pandas,
+ * Spark, and other Arrow implementations. The format is described in arrow_ipc_format.hpp.
+ *
+ * Each chunk becomes a record batch. A column whose segments are all DictionarySegments is written as a dictionary
+ * array. As the IPC file format allows only a single dictionary per column, the dictionary is the union of the
+ * dictionaries of all chunks. The values of ValueSegments are written directly from the segments, other segments are
+ * materialized first.
+ *
+ * The types are mapped as follows: int -> int32, long -> int64, float -> float32, double -> float64, string -> utf8.
+ * The buffers are not compressed.
+ */
+class ArrowIpcWriter {
+ public:
+  static void write(const Table& table, const std::string& filename);
+};
+
+}  // namespace opossum
@@ -0,0 +1,132 @@
+#include "flatbuffer.hpp"
+
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace opossum {
+
+FlatBufferBuilder::Offset FlatBufferBuilder::create_string(const std::string_view string) {
+  // Strings are stored like vectors of bytes, followed by a null terminator
+  _pre_align(string.size() + 1, sizeof(uint32_t));
+  _reversed_data.push_back('\0');
+  _push_bytes(string.data(), string.size());
+  _push_scalar(static_cast<uint32_t>(string.size()));
+  return _size();
+}
+
+FlatBufferBuilder::Offset FlatBufferBuilder::create_offset_vector(const std::vector<Offset>& offsets) {
+  _pre_align(offsets.size() * sizeof(uint32_t), sizeof(uint32_t));
+  for (auto offset_iter = offsets.rbegin(); offset_iter != offsets.rend(); ++offset_iter) {
+    _push_offset(*offset_iter);
+  }
+  _push_scalar(static_cast<uint32_t>(offsets.size()));
+  return _size();
+}
+
+void FlatBufferBuilder::start_table() {
+  _table_fields.clear();
+  _table_end = _size();
+}
+
+FlatBufferBuilder::Offset FlatBufferBuilder::end_table() {
+  // The table starts with the offset of its vtable, which is written once the vtable's position is known
+  _push_scalar(int32_t{0});
+  const auto table_offset = _size();
+
+  auto field_count = uint16_t{0};
+  for (const auto& [field_id, field_offset] : _table_fields) {
+    field_count = std::max(field_count, static_cast<uint16_t>(field_id + 1));
+  }
+
+  // The vtable contains its own size, the size of the table, and the positions of the fields within the table
+  auto field_positions = std::vector<uint16_t>(field_count);
+  for (const auto& [field_id, field_offset] : _table_fields) {
+    field_positions[field_id] = static_cast<uint16_t>(table_offset - field_offset);
+  }
+  for (auto position_iter = field_positions.rbegin(); position_iter != field_positions.rend(); ++position_iter) {
+    _push_scalar(*position_iter);
+  }
+  _push_scalar(static_cast<uint16_t>(table_offset - _table_end));
+  _push_scalar(static_cast<uint16_t>((2 + field_count) * sizeof(uint16_t)));
+  const auto vtable_offset = _size();
+
+  // The vtable precedes the table, so the signed distance from the table to the vtable is positive
+  const auto vtable_distance = static_cast<int32_t>(vtable_offset - table_offset);
+  for (auto byte_idx = size_t{0}; byte_idx < sizeof(int32_t); ++byte_idx) {
+    _reversed_data[table_offset - 1 - byte_idx] = static_cast<char>((vtable_distance >> (8 * byte_idx)) & 0xFF);
+  }
+
+  _table_fields.clear();
+  return table_offset;
+}
+
+std::string FlatBufferBuilder::finish(const Offset root_table) {
+  _pre_align(sizeof(uint32_t), _minimum_alignment);
+  _push_offset(root_table);
+  return std::string{_reversed_data.rbegin(), _reversed_data.rend()};
+}
+
+FlatBufferBuilder::Offset FlatBufferBuilder::_size() const { return static_cast<Offset>(_reversed_data.size()); }
+
+void FlatBufferBuilder::_pre_align(const size_t length, const size_t alignment) {
+  _minimum_alignment = std::max(_minimum_alignment, alignment);
+  const auto padding = (alignment - ((_reversed_data.size() + length) % alignment)) % alignment;
+  _reversed_data.append(padding, '\0');
+}
+
+void FlatBufferBuilder::_push_bytes(const void* data, const size_t size) {
+  const auto bytes = static_cast<const char*>(data);
+  _reversed_data.append(std::make_reverse_iterator(bytes + size), std::make_reverse_iterator(bytes));
+}
+
+void FlatBufferBuilder::_push_offset(const Offset offset) {
+  // Offsets are relative to their own position and point towards the end of the buffer
+  _pre_align(0, sizeof(uint32_t));
+  _push_scalar(static_cast<uint32_t>(_size() + sizeof(uint32_t) - offset));
+}
+
+FlatBufferTable FlatBufferTable::root(const std::string_view buffer) {
+  // The buffer starts with the offset of the root table
+  AssertInput(buffer.size() >= sizeof(uint32_t), "Invalid FlatBuffers data");
+  auto root_position = uint32_t{0};
+  std::memcpy(&root_position, buffer.data(), sizeof(uint32_t));
+  return FlatBufferTable{buffer, root_position};
+}
+
+FlatBufferTable::FlatBufferTable(const std::string_view buffer, const size_t position)
+    : _buffer(buffer), _position(position) {
+  const auto vtable_distance = static_cast<int64_t>(_read<int32_t>(position));
+  const auto vtable_position = static_cast<int64_t>(position) - vtable_distance;
+  AssertInput(vtable_position >= 0 && vtable_position < static_cast<int64_t>(buffer.size()),
+              "Invalid FlatBuffers vtable");
+  _vtable_position = static_cast<size_t>(vtable_position);
+  _vtable_size = _read<uint16_t>(_vtable_position);
+}
+
+std::optional<size_t> FlatBufferTable::_field_position(const uint16_t field_id) const {
+  const auto entry_position = (2 + static_cast<size_t>(field_id)) * sizeof(uint16_t);
+  if (entry_position >= _vtable_size) return std::nullopt;
+
+  const auto field_offset = _read<uint16_t>(_vtable_position + entry_position);
+  if (field_offset == 0) return std::nullopt;
+  return _position + field_offset;
+}
+
+size_t FlatBufferTable::_follow_offset(const size_t position) const {
+  const auto target = position + _read<uint32_t>(position);
+  AssertInput(target < _buffer.size(), "Invalid FlatBuffers offset");
+  return target;
+}
+
+std::pair<size_t, size_t> FlatBufferTable::_vector(const size_t position, const size_t element_size) const {
+  const auto vector_position = _follow_offset(position);
+  const auto length = static_cast<size_t>(_read<uint32_t>(vector_position));
+  const auto data_position = vector_position + sizeof(uint32_t);
+  AssertInput(data_position <= _buffer.size() && length <= (_buffer.size() - data_position) / element_size,
+              "Invalid FlatBuffers vector");
+  return {data_position, length};
+}
+
+}  // namespace opossum
@@ -0,0 +1,172 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+/**
+ * Minimal implementation of the FlatBuffers binary format (https://google.github.io/flatbuffers/), which Arrow uses for
+ * the metadata of its IPC format. Only tables, strings, and vectors of scalars, structs, and tables are supported,
+ * which is sufficient for the Arrow schema and message definitions. Fields are addressed by their id, i.e., their
+ * position in the .fbs file.
+ *
+ * Like the reference implementation, the builder writes the buffer back to front. Thus, objects have to be created
+ * before the tables that refer to them, and only one table can be built at a time.
+ */
+class FlatBufferBuilder {
+ public:
+  // Objects are referenced by their distance from the end of the buffer
+  using Offset = uint32_t;
+
+  Offset create_string(const std::string_view string);
+
+  // T has to be a scalar or a struct with the layout of the FlatBuffers struct
+  template <typename T>
+  Offset create_vector(const std::vector<T>& values) {
+    static_assert(std::is_trivially_copyable_v<T>, "Only scalars and structs can be stored inline");
+    const auto size = values.size() * sizeof(T);
+    _pre_align(size, sizeof(uint32_t));
+    _pre_align(size, alignof(T));
+    _push_bytes(values.data(), size);
+    _push_scalar(static_cast<uint32_t>(values.size()));
+    return _size();
+  }
+
+  Offset create_offset_vector(const std::vector<Offset>& offsets);
+
+  void start_table();
+
+  template <typename Field, typename T>
+  void add_scalar(const Field field, const T value) {
+    static_assert(std::is_arithmetic_v<T> || std::is_enum_v<T>, "Only scalars are supported");
+    _push_scalar(value);
+    _table_fields.emplace_back(static_cast<uint16_t>(field), _size());
+  }
+
+  template <typename Field>
+  void add_offset(const Field field, const Offset offset) {
+    _push_offset(offset);
+    _table_fields.emplace_back(static_cast<uint16_t>(field), _size());
+  }
+
+  Offset end_table();
+
+  // Returns the buffer with the given root table
+  std::string finish(const Offset root_table);
+
+ private:
+  Offset _size() const;
+
+  // Adds padding so that the size is a multiple of the alignment once the given number of bytes has been added
+  void _pre_align(const size_t length, const size_t alignment);
+
+  // Adds bytes in front of the current buffer
+  void _push_bytes(const void* data, const size_t size);
+
+  template <typename T>
+  void _push_scalar(const T value) {
+    _pre_align(0, sizeof(T));
+    _push_bytes(&value, sizeof(T));
+  }
+
+  void _push_offset(const Offset offset);
+
+  // The buffer is stored in reverse order, so that prepending is cheap
+  std::string _reversed_data;
+  size_t _minimum_alignment{1};
+
+  // Field ids of the current table and the offsets of their values
+  std::vector<std::pair<uint16_t, Offset>> _table_fields;
+  Offset _table_end{0};
+};
+
+/**
+ * Reads a table of a FlatBuffers buffer. All accesses are bounds checked, as the buffer is read from a file.
+ */
+class FlatBufferTable {
+ public:
+  // Returns the root table of the buffer. The buffer has to outlive the table.
+  static FlatBufferTable root(const std::string_view buffer);
+
+  template <typename T, typename Field>
+  T scalar(const Field field, const T default_value) const {
+    const auto position = _field_position(static_cast<uint16_t>(field));
+    return position ? _read<T>(*position) : default_value;
+  }
+
+  template <typename Field>
+  std::optional<FlatBufferTable> table(const Field field) const {
+    const auto position = _field_position(static_cast<uint16_t>(field));
+    if (!position) return std::nullopt;
+    return FlatBufferTable{_buffer, _follow_offset(*position)};
+  }
+
+  template <typename Field>
+  std::string_view string(const Field field) const {
+    const auto position = _field_position(static_cast<uint16_t>(field));
+    if (!position) return {};
+    const auto [data_position, length] = _vector(*position, 1);
+    return _buffer.substr(data_position, length);
+  }
+
+  // Returns the elements of a vector of scalars or structs
+  template <typename T, typename Field>
+  std::vector<T> vector(const Field field) const {
+    static_assert(std::is_trivially_copyable_v<T>, "Only scalars and structs are stored inline");
+    const auto position = _field_position(static_cast<uint16_t>(field));
+    if (!position) return {};
+    const auto [data_position, length] = _vector(*position, sizeof(T));
+    auto values = std::vector<T>(length);
+    std::memcpy(values.data(), _buffer.data() + data_position, length * sizeof(T));
+    return values;
+  }
+
+  template <typename Field>
+  std::vector<FlatBufferTable> table_vector(const Field field) const {
+    const auto position = _field_position(static_cast<uint16_t>(field));
+    if (!position) return {};
+    const auto [data_position, length] = _vector(*position, sizeof(uint32_t));
+    auto tables = std::vector<FlatBufferTable>{};
+    tables.reserve(length);
+    for (auto index = size_t{0}; index < length; ++index) {
+      tables.emplace_back(FlatBufferTable{_buffer, _follow_offset(data_position + index * sizeof(uint32_t))});
+    }
+    return tables;
+  }
+
+ private:
+  FlatBufferTable(const std::string_view buffer, const size_t position);
+
+  std::optional<size_t> _field_position(const uint16_t field_id) const;
+
+  // Returns the position that the offset stored at the given position refers to
+  size_t _follow_offset(const size_t position) const;
+
+  // Returns the position of the first element and the number of elements of the vector referred to by the offset at
+  // the given position
+  std::pair<size_t, size_t> _vector(const size_t position, const size_t element_size) const;
+
+  template <typename T>
+  T _read(const size_t position) const {
+    AssertInput(position <= _buffer.size() && sizeof(T) <= _buffer.size() - position, "Invalid FlatBuffers data");
+    auto value = T{};
+    std::memcpy(&value, _buffer.data() + position, sizeof(T));
+    return value;
+  }
+
+  std::string_view _buffer;
+  size_t _position;
+  size_t _vtable_position;
+  uint16_t _vtable_size;
+};
+
+}  // namespace opossum
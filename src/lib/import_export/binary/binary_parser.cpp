@@ -1,16 +1,26 @@
 #include "binary_parser.hpp"
 
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cerrno>
 #include <cstdint>
+#include <cstring>
+#include <exception>
 #include <fstream>
 #include <memory>
 #include <numeric>
 #include <optional>
+#include <streambuf>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "constant_mappings.hpp"
 #include "hyrise.hpp"
+#include "import_export/binary/binary_writer.hpp"
 #include "resolve_type.hpp"
+#include "scheduler/job_task.hpp"
 #include "storage/chunk.hpp"
 #include "storage/encoding_type.hpp"
 #include "storage/vector_compression/fixed_size_byte_aligned/fixed_size_byte_aligned_vector.hpp"
@@ -19,23 +29,111 @@
 
 #include "utils/assert.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Closes the file descriptor when leaving the scope
+class FileDescriptor {
+ public:
+  explicit FileDescriptor(const std::string& filename) : value(open(filename.c_str(), O_RDONLY)) {
+    Assert(value != -1, "Could not open " + filename + ": " + std::strerror(errno));
+  }
+
+  ~FileDescriptor() { close(value); }
+
+  FileDescriptor(const FileDescriptor&) = delete;
+  FileDescriptor& operator=(const FileDescriptor&) = delete;
+
+  const int value;
+};
+
+// Reads a part of the file with positional reads, which allows multiple tasks to read from the same file descriptor
+std::string read_at(const int file_descriptor, uint64_t offset, const uint64_t size) {
+  auto data = std::string(size, '\0');
+  auto read_size = uint64_t{0};
+  while (read_size < size) {
+    const auto read_bytes =
+        pread(file_descriptor, data.data() + read_size, size - read_size, static_cast<off_t>(offset));
+    if (read_bytes == -1 && errno == EINTR) continue;
+    Assert(read_bytes != -1, std::string{"Could not read binary file: "} + std::strerror(errno));
+    Assert(read_bytes != 0, "Binary file is truncated");
+
+    read_size += read_bytes;
+    offset += read_bytes;
+  }
+  return data;
+}
+
+// Allows reading data that is already in memory through an std::istream without copying it
+class MemoryStreambuf : public std::streambuf {
+ public:
+  explicit MemoryStreambuf(std::string& data) { setg(data.data(), data.data(), data.data() + data.size()); }
+};
+
+}  // namespace
+
 namespace opossum {
 
-std::shared_ptr<Table> BinaryParser::parse(const std::string& filename) {
+std::shared_ptr<Table> BinaryParser::parse(const std::string& filename,
+                                           const std::optional<std::vector<ColumnID>>& column_ids) {
   std::ifstream file;
   file.open(filename, std::ios::binary);
   file.exceptions(std::ifstream::failbit | std::ifstream::badbit);
 
-  auto [table, chunk_count] = _read_header(file);
-  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
-    _import_chunk(file, table);
+  const auto [header_table, chunk_count] = _read_header(file);
+  const auto column_count = header_table->column_count();
+  const auto directory = _read_values<uint64_t>(file, chunk_count * (column_count + size_t{2}));
+  file.close();
+
+  auto loaded_column_ids = std::vector<ColumnID>{};
+  auto column_definitions = TableColumnDefinitions{};
+  if (column_ids) {
+    Assert(!column_ids->empty(), "At least one column has to be loaded");
+    loaded_column_ids = *column_ids;
+    for (const auto column_id : loaded_column_ids) {
+      Assert(column_id < column_count, "Column " + std::to_string(column_id) + " does not exist in " + filename);
+      column_definitions.emplace_back(header_table->column_definitions()[column_id]);
+    }
+  } else {
+    loaded_column_ids.resize(column_count);
+    std::iota(loaded_column_ids.begin(), loaded_column_ids.end(), ColumnID{0});
+    column_definitions = header_table->column_definitions();
+  }
+
+  // Each chunk is read by its own task
+  const auto file_descriptor = FileDescriptor{filename};
+  auto chunks = std::vector<Segments>(chunk_count);
+  auto exceptions = std::vector<std::exception_ptr>(chunk_count);
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  tasks.reserve(chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto directory_entry = directory.data() + chunk_id * (column_count + size_t{2});
+    tasks.emplace_back(std::make_shared<JobTask>([&, chunk_id, directory_entry]() {
+      try {
+        chunks[chunk_id] = _import_chunk(file_descriptor.value, directory_entry, *header_table, loaded_column_ids);
+      } catch (...) {
+        exceptions[chunk_id] = std::current_exception();
+      }
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(tasks);
+
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, header_table->target_chunk_size(),
+                                             UseMvcc::Yes);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    if (exceptions[chunk_id]) std::rethrow_exception(exceptions[chunk_id]);
+
+    const auto mvcc_data = std::make_shared<MvccData>(chunks[chunk_id].front()->size(), CommitID{0});
+    table->append_chunk(chunks[chunk_id], mvcc_data);
+    table->last_chunk()->finalize();
   }
 
   return table;
 }
 
 template <typename T>
-pmr_vector<T> BinaryParser::_read_values(std::ifstream& file, const size_t count) {
+pmr_vector<T> BinaryParser::_read_values(std::istream& file, const size_t count) {
   pmr_vector<T> values(count);
   file.read(reinterpret_cast<char*>(values.data()), values.size() * sizeof(T));
   return values;
@@ -43,19 +141,19 @@ pmr_vector<T> BinaryParser::_read_values(std::ifstream& file, const size_t count
 
 // specialized implementation for string values
 template <>
-pmr_vector<pmr_string> BinaryParser::_read_values(std::ifstream& file, const size_t count) {
+pmr_vector<pmr_string> BinaryParser::_read_values(std::istream& file, const size_t count) {
   return _read_string_values(file, count);
 }
 
 // specialized implementation for bool values
 template <>
-pmr_vector<bool> BinaryParser::_read_values(std::ifstream& file, const size_t count) {
+pmr_vector<bool> BinaryParser::_read_values(std::istream& file, const size_t count) {
   pmr_vector<BoolAsByteType> readable_bools(count);
   file.read(reinterpret_cast<char*>(readable_bools.data()), readable_bools.size() * sizeof(BoolAsByteType));
   return pmr_vector<bool>(readable_bools.begin(), readable_bools.end());
 }
 
-pmr_vector<pmr_string> BinaryParser::_read_string_values(std::ifstream& file, const size_t count) {
+pmr_vector<pmr_string> BinaryParser::_read_string_values(std::istream& file, const size_t count) {
   const auto string_lengths = _read_values<size_t>(file, count);
   const auto total_length = std::accumulate(string_lengths.cbegin(), string_lengths.cend(), static_cast<size_t>(0));
   const auto buffer = _read_values<char>(file, total_length);
@@ -71,14 +169,25 @@ pmr_vector<pmr_string> BinaryParser::_read_string_values(std::ifstream& file, co
   return values;
 }
 
+bool BinaryParser::has_current_format(const std::string& filename) {
+  auto file = std::ifstream{filename, std::ios::binary};
+  auto magic = std::string(BinaryWriter::MAGIC.size(), '\0');
+  file.read(magic.data(), static_cast<std::streamsize>(magic.size()));
+  return file && magic == BinaryWriter::MAGIC;
+}
+
 template <typename T>
-T BinaryParser::_read_value(std::ifstream& file) {
+T BinaryParser::_read_value(std::istream& file) {
   T result;
   file.read(reinterpret_cast<char*>(&result), sizeof(T));
   return result;
 }
 
-std::pair<std::shared_ptr<Table>, ChunkID> BinaryParser::_read_header(std::ifstream& file) {
+std::pair<std::shared_ptr<Table>, ChunkID> BinaryParser::_read_header(std::istream& file) {
+  auto magic = std::string(BinaryWriter::MAGIC.size(), '\0');
+  file.read(magic.data(), static_cast<std::streamsize>(magic.size()));
+  Assert(magic == BinaryWriter::MAGIC, "Not a binary table file or written in an outdated format, please recreate it");
+
   const auto chunk_size = _read_value<ChunkOffset>(file);
   const auto chunk_count = _read_value<ChunkID>(file);
   const auto column_count = _read_value<ColumnID>(file);
@@ -98,21 +207,32 @@ std::pair<std::shared_ptr<Table>, ChunkID> BinaryParser::_read_header(std::ifstr
   return std::make_pair(table, chunk_count);
 }
 
-void BinaryParser::_import_chunk(std::ifstream& file, std::shared_ptr<Table>& table) {
-  const auto row_count = _read_value<ChunkOffset>(file);
+Segments BinaryParser::_import_chunk(const int file_descriptor, const uint64_t* directory_entry, const Table& table,
+                                     const std::vector<ColumnID>& column_ids) {
+  const auto row_count_data = read_at(file_descriptor, directory_entry[0], sizeof(ChunkOffset));
+  auto row_count = ChunkOffset{0};
+  std::memcpy(&row_count, row_count_data.data(), sizeof(ChunkOffset));
 
+  // Only the selected segments are read, each with a single positional read, and deserialized from memory
   Segments output_segments;
-  for (ColumnID column_id{0}; column_id < table->column_count(); ++column_id) {
-    output_segments.push_back(
-        _import_segment(file, row_count, table->column_data_type(column_id), table->column_is_nullable(column_id)));
+  for (const auto column_id : column_ids) {
+    const auto segment_begin = directory_entry[column_id + size_t{1}];
+    const auto segment_end = directory_entry[column_id + size_t{2}];
+    Assert(segment_begin <= segment_end, "Invalid chunk directory in binary file");
+
+    auto segment_data = read_at(file_descriptor, segment_begin, segment_end - segment_begin);
+    auto segment_buffer = MemoryStreambuf{segment_data};
+    auto segment_stream = std::istream{&segment_buffer};
+    segment_stream.exceptions(std::istream::failbit | std::istream::badbit);
+
+    output_segments.push_back(_import_segment(segment_stream, row_count, table.column_data_type(column_id),
+                                              table.column_is_nullable(column_id)));
   }
 
-  const auto mvcc_data = std::make_shared<MvccData>(row_count, CommitID{0});
-  table->append_chunk(output_segments, mvcc_data);
-  table->last_chunk()->finalize();
+  return output_segments;
 }
 
-std::shared_ptr<BaseSegment> BinaryParser::_import_segment(std::ifstream& file, ChunkOffset row_count,
+std::shared_ptr<BaseSegment> BinaryParser::_import_segment(std::istream& file, ChunkOffset row_count,
                                                            DataType data_type, bool is_nullable) {
   std::shared_ptr<BaseSegment> result;
   resolve_data_type(data_type, [&](auto type) {
@@ -124,7 +244,7 @@ std::shared_ptr<BaseSegment> BinaryParser::_import_segment(std::ifstream& file,
 }
 
 template <typename ColumnDataType>
-std::shared_ptr<BaseSegment> BinaryParser::_import_segment(std::ifstream& file, ChunkOffset row_count,
+std::shared_ptr<BaseSegment> BinaryParser::_import_segment(std::istream& file, ChunkOffset row_count,
                                                            bool is_nullable) {
   const auto column_type = _read_value<EncodingType>(file);
 
@@ -151,13 +271,27 @@ std::shared_ptr<BaseSegment> BinaryParser::_import_segment(std::ifstream& file,
       }
     case EncodingType::LZ4:
       return _import_lz4_segment<ColumnDataType>(file, row_count);
+    case EncodingType::FSST:
+      if constexpr (encoding_supports_data_type(enum_c<EncodingType, EncodingType::FSST>,
+                                                hana::type_c<ColumnDataType>)) {
+        return _import_fsst_segment(file, row_count);
+      } else {
+        Fail("Unsupported data type for FSST encoding");
+      }
+    case EncodingType::FrontCodedDictionary:
+      if constexpr (encoding_supports_data_type(enum_c<EncodingType, EncodingType::FrontCodedDictionary>,
+                                                hana::type_c<ColumnDataType>)) {
+        return _import_front_coded_dictionary_segment(file, row_count);
+      } else {
+        Fail("Unsupported data type for FrontCodedDictionary encoding");
+      }
   }
 
   Fail("Invalid EncodingType");
 }
 
 template <typename T>
-std::shared_ptr<ValueSegment<T>> BinaryParser::_import_value_segment(std::ifstream& file, ChunkOffset row_count,
+std::shared_ptr<ValueSegment<T>> BinaryParser::_import_value_segment(std::istream& file, ChunkOffset row_count,
                                                                      bool is_nullable) {
   if (is_nullable) {
     auto nullables = _read_values<bool>(file, row_count);
@@ -170,7 +304,7 @@ std::shared_ptr<ValueSegment<T>> BinaryParser::_import_value_segment(std::ifstre
 }
 
 template <typename T>
-std::shared_ptr<DictionarySegment<T>> BinaryParser::_import_dictionary_segment(std::ifstream& file,
+std::shared_ptr<DictionarySegment<T>> BinaryParser::_import_dictionary_segment(std::istream& file,
                                                                                ChunkOffset row_count) {
   const auto attribute_vector_width = _read_value<AttributeVectorWidth>(file);
   const auto dictionary_size = _read_value<ValueID>(file);
@@ -182,7 +316,7 @@ std::shared_ptr<DictionarySegment<T>> BinaryParser::_import_dictionary_segment(s
 }
 
 std::shared_ptr<FixedStringDictionarySegment<pmr_string>> BinaryParser::_import_fixed_string_dictionary_segment(
-    std::ifstream& file, ChunkOffset row_count) {
+    std::istream& file, ChunkOffset row_count) {
   const auto attribute_vector_width = _read_value<AttributeVectorWidth>(file);
   const auto dictionary_size = _read_value<ValueID>(file);
   auto dictionary = _import_fixed_string_vector(file, dictionary_size);
@@ -191,8 +325,24 @@ std::shared_ptr<FixedStringDictionarySegment<pmr_string>> BinaryParser::_import_
   return std::make_shared<FixedStringDictionarySegment<pmr_string>>(dictionary, attribute_vector);
 }
 
+std::shared_ptr<FrontCodedDictionarySegment<pmr_string>> BinaryParser::_import_front_coded_dictionary_segment(
+    std::istream& file, ChunkOffset row_count) {
+  const auto attribute_vector_width = _read_value<AttributeVectorWidth>(file);
+  const auto dictionary_size = _read_value<ValueID>(file);
+  const auto block_count =
+      (dictionary_size + FrontCodedStringVector::BLOCK_SIZE - 1) / FrontCodedStringVector::BLOCK_SIZE;
+  auto block_offsets = _read_values<uint32_t>(file, block_count);
+  const auto data_size = _read_value<uint32_t>(file);
+  auto data = _read_values<char>(file, data_size);
+  auto dictionary =
+      std::make_shared<FrontCodedStringVector>(std::move(data), std::move(block_offsets), dictionary_size);
+  auto attribute_vector = _import_attribute_vector(file, row_count, attribute_vector_width);
+
+  return std::make_shared<FrontCodedDictionarySegment<pmr_string>>(dictionary, attribute_vector);
+}
+
 template <typename T>
-std::shared_ptr<RunLengthSegment<T>> BinaryParser::_import_run_length_segment(std::ifstream& file,
+std::shared_ptr<RunLengthSegment<T>> BinaryParser::_import_run_length_segment(std::istream& file,
                                                                               ChunkOffset row_count) {
   const auto size = _read_value<uint32_t>(file);
   const auto values = std::make_shared<pmr_vector<T>>(_read_values<T>(file, size));
@@ -203,7 +353,7 @@ std::shared_ptr<RunLengthSegment<T>> BinaryParser::_import_run_length_segment(st
 }
 
 template <typename T>
-std::shared_ptr<FrameOfReferenceSegment<T>> BinaryParser::_import_frame_of_reference_segment(std::ifstream& file,
+std::shared_ptr<FrameOfReferenceSegment<T>> BinaryParser::_import_frame_of_reference_segment(std::istream& file,
                                                                                              ChunkOffset row_count) {
   const auto attribute_vector_width = _read_value<AttributeVectorWidth>(file);
   const auto block_count = _read_value<uint32_t>(file);
@@ -221,7 +371,7 @@ std::shared_ptr<FrameOfReferenceSegment<T>> BinaryParser::_import_frame_of_refer
 }
 
 template <typename T>
-std::shared_ptr<LZ4Segment<T>> BinaryParser::_import_lz4_segment(std::ifstream& file, ChunkOffset row_count) {
+std::shared_ptr<LZ4Segment<T>> BinaryParser::_import_lz4_segment(std::istream& file, ChunkOffset row_count) {
   const auto num_elements = _read_value<uint32_t>(file);
   const auto block_count = _read_value<uint32_t>(file);
 
@@ -257,29 +407,64 @@ std::shared_ptr<LZ4Segment<T>> BinaryParser::_import_lz4_segment(std::ifstream&
 
   const auto string_offsets_size = _read_value<uint32_t>(file);
 
+  auto string_offsets = std::unique_ptr<const BaseCompressedVector>{};
   if (string_offsets_size > 0) {
     const auto string_offsets_data_size = _read_value<uint32_t>(file);
 
     // so far, only SimdBp128 compression is supported
-    auto string_offsets =
+    string_offsets =
         std::make_unique<SimdBp128Vector>(_read_values<uint128_t>(file, string_offsets_data_size), string_offsets_size);
+  }
 
+  const auto block_statistics_count = _read_value<uint32_t>(file);
+  auto block_statistics = std::optional<LZ4BlockStatistics<T>>{};
+  if (block_statistics_count > 0) {
+    auto first_chunk_offsets = _read_values<ChunkOffset>(file, block_statistics_count);
+    auto null_value_counts = _read_values<ChunkOffset>(file, block_statistics_count);
+    auto minima = _read_values<T>(file, block_statistics_count);
+    auto maxima = _read_values<T>(file, block_statistics_count);
+    block_statistics = LZ4BlockStatistics<T>{std::move(first_chunk_offsets), std::move(null_value_counts),
+                                             std::move(minima), std::move(maxima)};
+  }
+
+  if (string_offsets || std::is_same<T, pmr_string>::value) {
     return std::make_shared<LZ4Segment<T>>(std::move(lz4_blocks), std::move(null_values), std::move(dictionary),
                                            std::move(string_offsets), block_size, last_block_size, compressed_size,
-                                           num_elements);
+                                           num_elements, std::move(block_statistics));
   } else {
-    if (std::is_same<T, pmr_string>::value) {
-      return std::make_shared<LZ4Segment<T>>(std::move(lz4_blocks), std::move(null_values), std::move(dictionary),
-                                             nullptr, block_size, last_block_size, compressed_size, num_elements);
-    } else {
-      return std::make_shared<LZ4Segment<T>>(std::move(lz4_blocks), std::move(null_values), std::move(dictionary),
-                                             block_size, last_block_size, compressed_size, num_elements);
-    }
+    return std::make_shared<LZ4Segment<T>>(std::move(lz4_blocks), std::move(null_values), std::move(dictionary),
+                                           block_size, last_block_size, compressed_size, num_elements,
+                                           std::move(block_statistics));
   }
 }
 
+std::shared_ptr<FSSTSegment<pmr_string>> BinaryParser::_import_fsst_segment(std::istream& file,
+                                                                           ChunkOffset row_count) {
+  const auto offset_vector_width = _read_value<AttributeVectorWidth>(file);
+
+  const auto symbol_count = _read_value<uint32_t>(file);
+  auto symbol_lengths = _read_values<uint8_t>(file, symbol_count);
+  auto symbols = _read_values<char>(file, symbol_count * FSSTSymbolTable::MAX_SYMBOL_LENGTH);
+  auto symbol_table = FSSTSymbolTable{std::move(symbols), std::move(symbol_lengths)};
+
+  const auto compressed_values_size = _read_value<uint32_t>(file);
+  auto compressed_values = _read_values<uint8_t>(file, compressed_values_size);
+
+  const auto null_values_stored = _read_value<BoolAsByteType>(file);
+  std::optional<pmr_vector<bool>> null_values;
+  if (null_values_stored) {
+    null_values = pmr_vector<bool>(_read_values<bool>(file, row_count));
+  }
+
+  // The offset vector stores one offset more than there are rows, see FSSTSegment.
+  auto offsets = _import_offset_value_vector(file, row_count + 1, offset_vector_width);
+
+  return std::make_shared<FSSTSegment<pmr_string>>(std::move(compressed_values), std::move(offsets),
+                                                   std::move(null_values), std::move(symbol_table));
+}
+
 std::shared_ptr<BaseCompressedVector> BinaryParser::_import_attribute_vector(
-    std::ifstream& file, ChunkOffset row_count, AttributeVectorWidth attribute_vector_width) {
+    std::istream& file, ChunkOffset row_count, AttributeVectorWidth attribute_vector_width) {
   switch (attribute_vector_width) {
     case 1:
       return std::make_shared<FixedSizeByteAlignedVector<uint8_t>>(_read_values<uint8_t>(file, row_count));
@@ -293,7 +478,7 @@ std::shared_ptr<BaseCompressedVector> BinaryParser::_import_attribute_vector(
 }
 
 std::unique_ptr<const BaseCompressedVector> BinaryParser::_import_offset_value_vector(
-    std::ifstream& file, ChunkOffset row_count, AttributeVectorWidth attribute_vector_width) {
+    std::istream& file, ChunkOffset row_count, AttributeVectorWidth attribute_vector_width) {
   switch (attribute_vector_width) {
     case 1:
       return std::make_unique<FixedSizeByteAlignedVector<uint8_t>>(_read_values<uint8_t>(file, row_count));
@@ -306,7 +491,7 @@ std::unique_ptr<const BaseCompressedVector> BinaryParser::_import_offset_value_v
   }
 }
 
-std::shared_ptr<FixedStringVector> BinaryParser::_import_fixed_string_vector(std::ifstream& file, const size_t count) {
+std::shared_ptr<FixedStringVector> BinaryParser::_import_fixed_string_vector(std::istream& file, const size_t count) {
   const auto string_length = _read_value<uint32_t>(file);
   pmr_vector<char> values(string_length * count);
   file.read(values.data(), values.size());
@@ -1,6 +1,6 @@
 #pragma once
 
-#include <fstream>
+#include <istream>
 #include <memory>
 #include <optional>
 #include <string>
@@ -11,7 +11,9 @@
 #include "storage/dictionary_segment.hpp"
 #include "storage/encoding_type.hpp"
 #include "storage/fixed_string_dictionary_segment.hpp"
+#include "storage/front_coded_dictionary_segment.hpp"
 #include "storage/frame_of_reference_segment.hpp"
+#include "storage/fsst_segment.hpp"
 #include "storage/lz4_segment.hpp"
 #include "storage/run_length_segment.hpp"
 #include "storage/table.hpp"
@@ -28,15 +30,26 @@ class BinaryParser {
   /*
    * Reads the given binary file. The file must be in the following form:
    *
-   * --------------
-   * |   Header   |
-   * |------------|
-   * |   Chunks¹  |
-   * --------------
+   * --------------------
+   * |      Header      |
+   * |------------------|
+   * | Chunk directory¹ |
+   * |------------------|
+   * |      Chunks²     |
+   * --------------------
    *
-   * ¹ Zero or more chunks
+   * ¹ File offsets of the chunks and their segments, see BinaryWriter::write
+   * ² Zero or more chunks
+   *
+   * The chunks are read concurrently by scheduler tasks with positional reads. If column_ids are given, only the
+   * segments of these columns are read and the table consists of these columns in the given order.
    */
-  static std::shared_ptr<Table> parse(const std::string& filename);
+  static std::shared_ptr<Table> parse(const std::string& filename,
+                                      const std::optional<std::vector<ColumnID>>& column_ids = std::nullopt);
+
+  // Returns whether the given file starts with the header of the current format (see BinaryWriter::MAGIC). Files
+  // written by earlier versions cannot be parsed and have to be recreated.
+  static bool has_current_format(const std::string& filename);
 
  private:
   /*
@@ -44,11 +57,10 @@ class BinaryParser {
    * Creates an empty table from the extracted information and
    * returns that table and the number of chunks.
    */
-  static std::pair<std::shared_ptr<Table>, ChunkID> _read_header(std::ifstream& file);
+  static std::pair<std::shared_ptr<Table>, ChunkID> _read_header(std::istream& file);
 
   /*
-   * Creates a chunk from chunk information from the given file and adds it to the given table.
-   * The chunk information has the following form:
+   * Reads the segments of the given columns of a chunk from the file. The chunk information has the following form:
    *
    * ----------------
    * |  Row count   |
@@ -57,54 +69,63 @@ class BinaryParser {
    * ----------------
    *
    * ¹Number of columns is provided in the binary header
+   *
+   * The directory entry contains the offsets of the chunk, of its segments, and of its end. The data types of the
+   * columns are taken from the table that was created from the header.
    */
-  static void _import_chunk(std::ifstream& file, std::shared_ptr<Table>& table);
+  static Segments _import_chunk(const int file_descriptor, const uint64_t* directory_entry, const Table& table,
+                                const std::vector<ColumnID>& column_ids);
 
   // Calls the right _import_column<ColumnDataType> depending on the given data_type.
-  static std::shared_ptr<BaseSegment> _import_segment(std::ifstream& file, ChunkOffset row_count, DataType data_type,
+  static std::shared_ptr<BaseSegment> _import_segment(std::istream& file, ChunkOffset row_count, DataType data_type,
                                                       bool is_nullable);
 
   template <typename ColumnDataType>
   // Reads the column type from the given file and chooses a segment import function from it.
-  static std::shared_ptr<BaseSegment> _import_segment(std::ifstream& file, ChunkOffset row_count, bool is_nullable);
+  static std::shared_ptr<BaseSegment> _import_segment(std::istream& file, ChunkOffset row_count, bool is_nullable);
 
   template <typename T>
-  static std::shared_ptr<ValueSegment<T>> _import_value_segment(std::ifstream& file, ChunkOffset row_count,
+  static std::shared_ptr<ValueSegment<T>> _import_value_segment(std::istream& file, ChunkOffset row_count,
                                                                 bool is_nullable);
   template <typename T>
-  static std::shared_ptr<DictionarySegment<T>> _import_dictionary_segment(std::ifstream& file, ChunkOffset row_count);
+  static std::shared_ptr<DictionarySegment<T>> _import_dictionary_segment(std::istream& file, ChunkOffset row_count);
 
   static std::shared_ptr<FixedStringDictionarySegment<pmr_string>> _import_fixed_string_dictionary_segment(
-      std::ifstream& file, ChunkOffset row_count);
+      std::istream& file, ChunkOffset row_count);
+
+  static std::shared_ptr<FrontCodedDictionarySegment<pmr_string>> _import_front_coded_dictionary_segment(
+      std::istream& file, ChunkOffset row_count);
 
   template <typename T>
-  static std::shared_ptr<RunLengthSegment<T>> _import_run_length_segment(std::ifstream& file, ChunkOffset row_count);
+  static std::shared_ptr<RunLengthSegment<T>> _import_run_length_segment(std::istream& file, ChunkOffset row_count);
 
   template <typename T>
-  static std::shared_ptr<FrameOfReferenceSegment<T>> _import_frame_of_reference_segment(std::ifstream& file,
+  static std::shared_ptr<FrameOfReferenceSegment<T>> _import_frame_of_reference_segment(std::istream& file,
                                                                                         ChunkOffset row_count);
   template <typename T>
-  static std::shared_ptr<LZ4Segment<T>> _import_lz4_segment(std::ifstream& file, ChunkOffset row_count);
+  static std::shared_ptr<LZ4Segment<T>> _import_lz4_segment(std::istream& file, ChunkOffset row_count);
+
+  static std::shared_ptr<FSSTSegment<pmr_string>> _import_fsst_segment(std::istream& file, ChunkOffset row_count);
 
   // Calls the _import_attribute_vector<uintX_t> function that corresponds to the given attribute_vector_width.
-  static std::shared_ptr<BaseCompressedVector> _import_attribute_vector(std::ifstream& file, ChunkOffset row_count,
+  static std::shared_ptr<BaseCompressedVector> _import_attribute_vector(std::istream& file, ChunkOffset row_count,
                                                                         AttributeVectorWidth attribute_vector_width);
 
   static std::unique_ptr<const BaseCompressedVector> _import_offset_value_vector(
-      std::ifstream& file, ChunkOffset row_count, AttributeVectorWidth attribute_vector_width);
+      std::istream& file, ChunkOffset row_count, AttributeVectorWidth attribute_vector_width);
 
-  static std::shared_ptr<FixedStringVector> _import_fixed_string_vector(std::ifstream& file, const size_t count);
+  static std::shared_ptr<FixedStringVector> _import_fixed_string_vector(std::istream& file, const size_t count);
 
   // Reads row_count many values from type T and returns them in a vector
   template <typename T>
-  static pmr_vector<T> _read_values(std::ifstream& file, const size_t count);
+  static pmr_vector<T> _read_values(std::istream& file, const size_t count);
 
   // Reads row_count many strings from input file. String lengths are encoded in type T.
-  static pmr_vector<pmr_string> _read_string_values(std::ifstream& file, const size_t count);
+  static pmr_vector<pmr_string> _read_string_values(std::istream& file, const size_t count);
 
   // Reads a single value of type T from the input file.
   template <typename T>
-  static T _read_value(std::ifstream& file);
+  static T _read_value(std::istream& file);
 };
 
 }  // namespace opossum
@@ -1,9 +1,17 @@
 #include "binary_writer.hpp"
 
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
 #include <cstring>
-#include <fstream>
+#include <exception>
+#include <list>
 #include <memory>
+#include <sstream>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "storage/encoding_type.hpp"
@@ -13,25 +21,27 @@
 #include "storage/vector_compression/fixed_size_byte_aligned/fixed_size_byte_aligned_vector.hpp"
 
 #include "constant_mappings.hpp"
+#include "hyrise.hpp"
 #include "resolve_type.hpp"
+#include "scheduler/job_task.hpp"
 #include "types.hpp"
 
 namespace {
 
 using namespace opossum;  // NOLINT
 
-// Writes the content of the vector to the ofstream
+// Writes the content of the vector to the ostream
 template <typename T, typename Alloc>
-void export_values(std::ofstream& ofstream, const std::vector<T, Alloc>& values);
+void export_values(std::ostream& ostream, const std::vector<T, Alloc>& values);
 
-/* Writes the given strings to the ofstream. First an array of string lengths is written. After that the strings are
+/* Writes the given strings to the ostream. First an array of string lengths is written. After that the strings are
  * written without any gaps between them.
  * In order to reduce the number of memory allocations we iterate twice over the string vector.
  * After the first iteration we know the number of byte that must be written to the file and can construct a buffer of
  * this size.
  * This approach is indeed faster than a dynamic approach with a stringstream.
  */
-void export_string_values(std::ofstream& ofstream, const pmr_vector<pmr_string>& values) {
+void export_string_values(std::ostream& ostream, const pmr_vector<pmr_string>& values) {
   pmr_vector<size_t> string_lengths(values.size());
   size_t total_length = 0;
 
@@ -41,7 +51,7 @@ void export_string_values(std::ofstream& ofstream, const pmr_vector<pmr_string>&
     total_length += values[i].size();
   }
 
-  export_values(ofstream, string_lengths);
+  export_values(ostream, string_lengths);
 
   // We do not have to iterate over values if all strings are empty.
   if (total_length == 0) return;
@@ -54,59 +64,150 @@ void export_string_values(std::ofstream& ofstream, const pmr_vector<pmr_string>&
     start += str.size();
   }
 
-  export_values(ofstream, buffer);
+  export_values(ostream, buffer);
 }
 
 template <typename T, typename Alloc>
-void export_values(std::ofstream& ofstream, const std::vector<T, Alloc>& values) {
-  ofstream.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+void export_values(std::ostream& ostream, const std::vector<T, Alloc>& values) {
+  ostream.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
 }
 
-void export_values(std::ofstream& ofstream, const FixedStringVector& values) {
-  ofstream.write(values.data(), values.size() * values.string_length());
+void export_values(std::ostream& ostream, const FixedStringVector& values) {
+  ostream.write(values.data(), values.size() * values.string_length());
 }
 
 // specialized implementation for string values
 template <>
-void export_values(std::ofstream& ofstream, const pmr_vector<pmr_string>& values) {
-  export_string_values(ofstream, values);
+void export_values(std::ostream& ostream, const pmr_vector<pmr_string>& values) {
+  export_string_values(ostream, values);
 }
 
 // specialized implementation for bool values
 template <typename Alloc>
-void export_values(std::ofstream& ofstream, const std::vector<bool, Alloc>& values) {
+void export_values(std::ostream& ostream, const std::vector<bool, Alloc>& values) {
   // Cast to fixed-size format used in binary file
   const auto writable_bools = pmr_vector<BoolAsByteType>(values.begin(), values.end());
-  export_values(ofstream, writable_bools);
+  export_values(ostream, writable_bools);
 }
 
-// Writes a shallow copy of the given value to the ofstream
+// Writes a shallow copy of the given value to the ostream
 template <typename T>
-void export_value(std::ofstream& ofstream, const T& value) {
-  ofstream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+void export_value(std::ostream& ostream, const T& value) {
+  ostream.write(reinterpret_cast<const char*>(&value), sizeof(T));
 }
 
+// A file that is written with positional writes, so that the chunks can be written at their offsets
+class OutputFile {
+ public:
+  explicit OutputFile(const std::string& filename)
+      : _file_descriptor(open(filename.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644)) {
+    Assert(_file_descriptor != -1, "Could not open " + filename + ": " + std::strerror(errno));
+  }
+
+  ~OutputFile() { close(_file_descriptor); }
+
+  OutputFile(const OutputFile&) = delete;
+  OutputFile& operator=(const OutputFile&) = delete;
+
+  void write_at(std::string_view data, uint64_t offset) {
+    while (!data.empty()) {
+      const auto written_bytes = pwrite(_file_descriptor, data.data(), data.size(), static_cast<off_t>(offset));
+      if (written_bytes == -1 && errno == EINTR) continue;
+      Assert(written_bytes > 0, std::string{"Could not write binary file: "} + std::strerror(errno));
+
+      data.remove_prefix(written_bytes);
+      offset += written_bytes;
+    }
+  }
+
+ private:
+  const int _file_descriptor;
+};
+
 }  // namespace
 
 namespace opossum {
 
 void BinaryWriter::write(const Table& table, const std::string& filename) {
-  std::ofstream ofstream;
-  ofstream.exceptions(std::ofstream::failbit | std::ofstream::badbit);
-  ofstream.open(filename, std::ios::binary);
+  auto file = OutputFile{filename};
+
+  auto header = std::ostringstream{};
+  _write_header(table, header);
+  const auto header_size = static_cast<uint64_t>(header.tellp());
+
+  // The directory is written last, once the offsets of all chunks are known
+  const auto chunk_count = table.chunk_count();
+  const auto directory_entry_size = table.column_count() + size_t{2};
+  auto directory = std::vector<uint64_t>(chunk_count * directory_entry_size);
+  auto offset = header_size + directory.size() * sizeof(uint64_t);
+
+  // A chunk that is serialized by a task. A list is used to keep the references of the tasks valid.
+  struct SerializedChunk {
+    std::ostringstream data;
+    std::vector<uint64_t> segment_offsets;
+    std::exception_ptr exception;
+    std::shared_ptr<AbstractTask> task;
+  };
+  auto serialized_chunks = std::list<SerializedChunk>{};
+
+  // Writes the oldest serialized chunk to the file and adds its offsets to the directory
+  auto written_chunk_count = size_t{0};
+  const auto write_oldest_chunk = [&]() {
+    auto& serialized_chunk = serialized_chunks.front();
+    Hyrise::get().scheduler()->wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{serialized_chunk.task});
+    if (serialized_chunk.exception) std::rethrow_exception(serialized_chunk.exception);
+
+    const auto data = serialized_chunk.data.str();
+    file.write_at(data, offset);
+
+    const auto directory_entry = directory.begin() + written_chunk_count * directory_entry_size;
+    *directory_entry = offset;
+    std::transform(serialized_chunk.segment_offsets.cbegin(), serialized_chunk.segment_offsets.cend(),
+                   directory_entry + 1, [&](const auto segment_offset) { return offset + segment_offset; });
+
+    offset += data.size();
+    ++written_chunk_count;
+    serialized_chunks.pop_front();
+  };
+
+  try {
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      auto& serialized_chunk = serialized_chunks.emplace_back();
+      serialized_chunk.task = std::make_shared<JobTask>([&table, &serialized_chunk, chunk_id]() {
+        try {
+          serialized_chunk.segment_offsets = _write_chunk(table, serialized_chunk.data, chunk_id);
+        } catch (...) {
+          serialized_chunk.exception = std::current_exception();
+        }
+      });
+      serialized_chunk.task->schedule();
 
-  _write_header(table, ofstream);
+      // Bound the memory by writing the oldest chunk. Chunks are written in the order of their ids.
+      if (serialized_chunks.size() > MAX_CHUNKS_IN_FLIGHT) write_oldest_chunk();
+    }
 
-  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); chunk_id++) {
-    _write_chunk(table, ofstream, chunk_id);
+    while (!serialized_chunks.empty()) {
+      write_oldest_chunk();
+    }
+  } catch (...) {
+    // The tasks refer to the serialized chunks, so they have to finish before the chunks are destroyed
+    for (const auto& serialized_chunk : serialized_chunks) {
+      Hyrise::get().scheduler()->wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{serialized_chunk.task});
+    }
+    throw;
   }
+
+  export_values(header, directory);
+  file.write_at(header.str(), 0);
 }
 
-void BinaryWriter::_write_header(const Table& table, std::ofstream& ofstream) {
+void BinaryWriter::_write_header(const Table& table, std::ostream& ostream) {
+  ostream.write(MAGIC.data(), MAGIC.size());
+
   const auto target_chunk_size = table.type() == TableType::Data ? table.target_chunk_size() : Chunk::DEFAULT_SIZE;
-  export_value(ofstream, static_cast<ChunkOffset>(target_chunk_size));
-  export_value(ofstream, static_cast<ChunkID::base_type>(table.chunk_count()));
-  export_value(ofstream, static_cast<ColumnID::base_type>(table.column_count()));
+  export_value(ostream, static_cast<ChunkOffset>(target_chunk_size));
+  export_value(ostream, static_cast<ChunkID::base_type>(table.chunk_count()));
+  export_value(ostream, static_cast<ColumnID::base_type>(table.column_count()));
 
   pmr_vector<pmr_string> column_types(table.column_count());
   pmr_vector<pmr_string> column_names(table.column_count());
@@ -118,38 +219,51 @@ void BinaryWriter::_write_header(const Table& table, std::ofstream& ofstream) {
     column_names[column_id] = table.column_name(column_id);
     columns_are_nullable[column_id] = table.column_is_nullable(column_id);
   }
-  export_values(ofstream, column_types);
-  export_values(ofstream, columns_are_nullable);
-  export_string_values(ofstream, column_names);
+  export_values(ostream, column_types);
+  export_values(ostream, columns_are_nullable);
+  export_string_values(ostream, column_names);
 }
 
-void BinaryWriter::_write_chunk(const Table& table, std::ofstream& ofstream, const ChunkID& chunk_id) {
+std::vector<uint64_t> BinaryWriter::_write_chunk(const Table& table, std::ostream& ostream, const ChunkID& chunk_id) {
   const auto chunk = table.get_chunk(chunk_id);
   Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
-  export_value(ofstream, static_cast<ChunkOffset>(chunk->size()));
+  const auto chunk_begin = ostream.tellp();
+  export_value(ostream, static_cast<ChunkOffset>(chunk->size()));
 
   // Iterating over all segments of this chunk and exporting them
+  auto segment_offsets = std::vector<uint64_t>{};
+  segment_offsets.reserve(chunk->column_count() + 1);
   for (ColumnID column_id{0}; column_id < chunk->column_count(); column_id++) {
-    resolve_data_and_segment_type(
-        *chunk->get_segment(column_id),
-        [&](const auto data_type_t, const auto& resolved_segment) { _write_segment(resolved_segment, ofstream); });
+    segment_offsets.emplace_back(ostream.tellp() - chunk_begin);
+    resolve_data_and_segment_type(*chunk->get_segment(column_id), [&](const auto data_type_t,
+                                                                       const auto& resolved_segment) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      if constexpr (std::is_same_v<std::decay_t<decltype(resolved_segment)>, VersionedSegment<ColumnDataType>>) {
+        _write_segment(resolved_segment, table.column_is_nullable(column_id), ostream);
+      } else {
+        _write_segment(resolved_segment, ostream);
+      }
+    });
   }
+  segment_offsets.emplace_back(ostream.tellp() - chunk_begin);
+
+  return segment_offsets;
 }
 
 template <typename T>
-void BinaryWriter::_write_segment(const ValueSegment<T>& value_segment, std::ofstream& ofstream) {
-  export_value(ofstream, EncodingType::Unencoded);
+void BinaryWriter::_write_segment(const ValueSegment<T>& value_segment, std::ostream& ostream) {
+  export_value(ostream, EncodingType::Unencoded);
 
   if (value_segment.is_nullable()) {
-    export_values(ofstream, value_segment.null_values());
+    export_values(ostream, value_segment.null_values());
   }
 
-  export_values(ofstream, value_segment.values());
+  export_values(ostream, value_segment.values());
 }
 
-void BinaryWriter::_write_segment(const ReferenceSegment& reference_segment, std::ofstream& ofstream) {
+void BinaryWriter::_write_segment(const ReferenceSegment& reference_segment, std::ostream& ostream) {
   // We materialize reference segments and save them as value segments
-  export_value(ofstream, EncodingType::Unencoded);
+  export_value(ostream, EncodingType::Unencoded);
 
   if (reference_segment.size() == 0) return;
   resolve_data_type(reference_segment.data_type(), [&](auto type) {
@@ -166,158 +280,242 @@ void BinaryWriter::_write_segment(const ReferenceSegment& reference_segment, std
         values << value.value();
       });
 
-      export_values(ofstream, string_lengths);
-      ofstream << values.rdbuf();
+      export_values(ostream, string_lengths);
+      ostream << values.rdbuf();
 
     } else {
       // Unfortunately, we have to iterate over all values of the reference segment
       // to materialize its contents. Then we can write them to the file
-      iterable.for_each([&](const auto& value) { export_value(ofstream, value.value()); });
+      iterable.for_each([&](const auto& value) { export_value(ostream, value.value()); });
     }
   });
 }
 
 template <typename T>
-void BinaryWriter::_write_segment(const DictionarySegment<T>& dictionary_segment, std::ofstream& ofstream) {
-  export_value(ofstream, EncodingType::Dictionary);
+void BinaryWriter::_write_segment(const VersionedSegment<T>& versioned_segment, const bool column_is_nullable,
+                                  std::ostream& ostream) {
+  // We materialize versioned segments and save them as value segments
+  auto values = pmr_vector<T>(versioned_segment.size());
+  auto null_values = pmr_vector<bool>(versioned_segment.size());
+  segment_iterate<T>(versioned_segment, [&](const auto& position) {
+    if (position.is_null()) {
+      null_values[position.chunk_offset()] = true;
+    } else {
+      values[position.chunk_offset()] = position.value();
+    }
+  });
+
+  if (column_is_nullable) {
+    _write_segment(ValueSegment<T>{std::move(values), std::move(null_values)}, ostream);
+  } else {
+    _write_segment(ValueSegment<T>{std::move(values)}, ostream);
+  }
+}
+
+template <typename T>
+void BinaryWriter::_write_segment(const DictionarySegment<T>& dictionary_segment, std::ostream& ostream) {
+  export_value(ostream, EncodingType::Dictionary);
 
   // Write attribute vector width
   const auto attribute_vector_width = _compressed_vector_width<T>(dictionary_segment);
-  export_value(ofstream, static_cast<AttributeVectorWidth>(attribute_vector_width));
+  export_value(ostream, static_cast<AttributeVectorWidth>(attribute_vector_width));
 
   // Write the dictionary size and dictionary
-  export_value(ofstream, static_cast<ValueID::base_type>(dictionary_segment.dictionary()->size()));
-  export_values(ofstream, *dictionary_segment.dictionary());
+  export_value(ostream, static_cast<ValueID::base_type>(dictionary_segment.dictionary()->size()));
+  export_values(ostream, *dictionary_segment.dictionary());
 
   // Write attribute vector
-  _export_compressed_vector(ofstream, *dictionary_segment.compressed_vector_type(),
+  _export_compressed_vector(ostream, *dictionary_segment.compressed_vector_type(),
                             *dictionary_segment.attribute_vector());
 }
 
 template <typename T>
 void BinaryWriter::_write_segment(const FixedStringDictionarySegment<T>& fixed_string_dictionary_segment,
-                                  std::ofstream& ofstream) {
-  export_value(ofstream, EncodingType::FixedStringDictionary);
+                                  std::ostream& ostream) {
+  export_value(ostream, EncodingType::FixedStringDictionary);
 
   // Write attribute vector width
   const auto attribute_vector_width = _compressed_vector_width<T>(fixed_string_dictionary_segment);
-  export_value(ofstream, static_cast<AttributeVectorWidth>(attribute_vector_width));
+  export_value(ostream, static_cast<AttributeVectorWidth>(attribute_vector_width));
 
   // Write the dictionary size, string length and dictionary
   const auto dictionary_size = fixed_string_dictionary_segment.fixed_string_dictionary()->size();
   const auto string_length = fixed_string_dictionary_segment.fixed_string_dictionary()->string_length();
-  export_value(ofstream, static_cast<ValueID::base_type>(dictionary_size));
-  export_value(ofstream, static_cast<uint32_t>(string_length));
-  export_values(ofstream, *fixed_string_dictionary_segment.fixed_string_dictionary());
+  export_value(ostream, static_cast<ValueID::base_type>(dictionary_size));
+  export_value(ostream, static_cast<uint32_t>(string_length));
+  export_values(ostream, *fixed_string_dictionary_segment.fixed_string_dictionary());
 
   // Write attribute vector
-  _export_compressed_vector(ofstream, *fixed_string_dictionary_segment.compressed_vector_type(),
+  _export_compressed_vector(ostream, *fixed_string_dictionary_segment.compressed_vector_type(),
                             *fixed_string_dictionary_segment.attribute_vector());
 }
 
 template <typename T>
-void BinaryWriter::_write_segment(const RunLengthSegment<T>& run_length_segment, std::ofstream& ofstream) {
-  export_value(ofstream, EncodingType::RunLength);
+void BinaryWriter::_write_segment(const FrontCodedDictionarySegment<T>& front_coded_dictionary_segment,
+                                  std::ostream& ostream) {
+  export_value(ostream, EncodingType::FrontCodedDictionary);
+
+  // Write attribute vector width
+  const auto attribute_vector_width = _compressed_vector_width<T>(front_coded_dictionary_segment);
+  export_value(ostream, static_cast<AttributeVectorWidth>(attribute_vector_width));
+
+  // Write the dictionary size, the block offsets, and the encoded dictionary
+  const auto& dictionary = *front_coded_dictionary_segment.front_coded_dictionary();
+  export_value(ostream, static_cast<ValueID::base_type>(dictionary.size()));
+  export_values(ostream, dictionary.block_offsets());
+  export_value(ostream, static_cast<uint32_t>(dictionary.data().size()));
+  export_values(ostream, dictionary.data());
+
+  // Write attribute vector
+  _export_compressed_vector(ostream, *front_coded_dictionary_segment.compressed_vector_type(),
+                            *front_coded_dictionary_segment.attribute_vector());
+}
+
+template <typename T>
+void BinaryWriter::_write_segment(const RunLengthSegment<T>& run_length_segment, std::ostream& ostream) {
+  export_value(ostream, EncodingType::RunLength);
 
   // Write size and values
-  export_value(ofstream, static_cast<uint32_t>(run_length_segment.values()->size()));
-  export_values(ofstream, *run_length_segment.values());
+  export_value(ostream, static_cast<uint32_t>(run_length_segment.values()->size()));
+  export_values(ostream, *run_length_segment.values());
 
   // Write NULL values
-  export_values(ofstream, *run_length_segment.null_values());
+  export_values(ostream, *run_length_segment.null_values());
 
   // Write end positions
-  export_values(ofstream, *run_length_segment.end_positions());
+  export_values(ostream, *run_length_segment.end_positions());
 }
 
 template <>
 void BinaryWriter::_write_segment(const FrameOfReferenceSegment<int32_t>& frame_of_reference_segment,
-                                  std::ofstream& ofstream) {
-  export_value(ofstream, EncodingType::FrameOfReference);
+                                  std::ostream& ostream) {
+  export_value(ostream, EncodingType::FrameOfReference);
 
   // Write attribute vector width
   const auto offset_value_vector_width = _compressed_vector_width<int32_t>(frame_of_reference_segment);
-  export_value(ofstream, static_cast<AttributeVectorWidth>(offset_value_vector_width));
+  export_value(ostream, static_cast<AttributeVectorWidth>(offset_value_vector_width));
 
   // Write number of blocks and block minima
-  export_value(ofstream, static_cast<uint32_t>(frame_of_reference_segment.block_minima().size()));
-  export_values(ofstream, frame_of_reference_segment.block_minima());
+  export_value(ostream, static_cast<uint32_t>(frame_of_reference_segment.block_minima().size()));
+  export_values(ostream, frame_of_reference_segment.block_minima());
 
   // Write flag if optional NULL value vector is written
-  export_value(ofstream, static_cast<BoolAsByteType>(frame_of_reference_segment.null_values().has_value()));
+  export_value(ostream, static_cast<BoolAsByteType>(frame_of_reference_segment.null_values().has_value()));
   if (frame_of_reference_segment.null_values()) {
     // Write NULL values
-    export_values(ofstream, *frame_of_reference_segment.null_values());
+    export_values(ostream, *frame_of_reference_segment.null_values());
   }
 
   // Write offset values
-  _export_compressed_vector(ofstream, *frame_of_reference_segment.compressed_vector_type(),
+  _export_compressed_vector(ostream, *frame_of_reference_segment.compressed_vector_type(),
                             frame_of_reference_segment.offset_values());
 }
 
 template <typename T>
-void BinaryWriter::_write_segment(const LZ4Segment<T>& lz4_segment, std::ofstream& ofstream) {
-  export_value(ofstream, EncodingType::LZ4);
+void BinaryWriter::_write_segment(const LZ4Segment<T>& lz4_segment, std::ostream& ostream) {
+  export_value(ostream, EncodingType::LZ4);
 
   // Write num elements (rows in segment)
-  export_value(ofstream, static_cast<uint32_t>(lz4_segment.size()));
+  export_value(ostream, static_cast<uint32_t>(lz4_segment.size()));
 
   // Write number of blocks
-  export_value(ofstream, static_cast<uint32_t>(lz4_segment.lz4_blocks().size()));
+  export_value(ostream, static_cast<uint32_t>(lz4_segment.lz4_blocks().size()));
 
   if (lz4_segment.lz4_blocks().empty()) {
     // No blocks at all: write just last block size = 0
-    export_value(ofstream, uint32_t{0});
+    export_value(ostream, uint32_t{0});
   } else {
     // if more than one block, write decompressed block size
     if (lz4_segment.lz4_blocks().size() > 1) {
-      export_value(ofstream, static_cast<uint32_t>(lz4_segment.block_size()));
+      export_value(ostream, static_cast<uint32_t>(lz4_segment.block_size()));
     }
     // Write last decompressed block size
-    export_value(ofstream, static_cast<uint32_t>(lz4_segment.last_block_size()));
+    export_value(ostream, static_cast<uint32_t>(lz4_segment.last_block_size()));
   }
 
   // Write compressed size for each LZ4 Block
   for (const auto& lz4_block : lz4_segment.lz4_blocks()) {
-    export_value(ofstream, static_cast<uint32_t>(lz4_block.size()));
+    export_value(ostream, static_cast<uint32_t>(lz4_block.size()));
   }
 
   // Write LZ4 Blocks
   for (const auto& lz4_block : lz4_segment.lz4_blocks()) {
-    export_values(ofstream, lz4_block);
+    export_values(ostream, lz4_block);
   }
 
   if (lz4_segment.null_values()) {
     // Write NULL value size
-    export_value(ofstream, static_cast<uint32_t>(lz4_segment.null_values()->size()));
+    export_value(ostream, static_cast<uint32_t>(lz4_segment.null_values()->size()));
     // Write NULL values
-    export_values(ofstream, *lz4_segment.null_values());
+    export_values(ostream, *lz4_segment.null_values());
   } else {
     // No NULL values
-    export_value(ofstream, uint32_t{0});
+    export_value(ostream, uint32_t{0});
   }
 
   // Write dictionary size
-  export_value(ofstream, static_cast<uint32_t>(lz4_segment.dictionary().size()));
+  export_value(ostream, static_cast<uint32_t>(lz4_segment.dictionary().size()));
 
   // Write dictionary
-  export_values(ofstream, lz4_segment.dictionary());
+  export_values(ostream, lz4_segment.dictionary());
 
   if (lz4_segment.string_offsets() && *lz4_segment.string_offsets()) {
     // Write string_offset size
-    export_value(ofstream, static_cast<uint32_t>((*lz4_segment.string_offsets())->size()));
+    export_value(ostream, static_cast<uint32_t>((*lz4_segment.string_offsets())->size()));
     // Write string_offset data_size
-    export_value(ofstream,
+    export_value(ostream,
                  static_cast<uint32_t>(
                      dynamic_cast<const SimdBp128Vector&>(*lz4_segment.string_offsets().value()).data().size()));
     // Write string offsets
-    _export_compressed_vector(ofstream, *lz4_segment.compressed_vector_type(), *lz4_segment.string_offsets().value());
+    _export_compressed_vector(ostream, *lz4_segment.compressed_vector_type(), *lz4_segment.string_offsets().value());
   } else {
     // Write string_offset size = 0
-    export_value(ofstream, uint32_t{0});
+    export_value(ostream, uint32_t{0});
+  }
+
+  if (lz4_segment.block_statistics()) {
+    // Write block statistics count and the statistics
+    const auto& block_statistics = *lz4_segment.block_statistics();
+    export_value(ostream, static_cast<uint32_t>(block_statistics.minima.size()));
+    export_values(ostream, block_statistics.first_chunk_offsets);
+    export_values(ostream, block_statistics.null_value_counts);
+    export_values(ostream, block_statistics.minima);
+    export_values(ostream, block_statistics.maxima);
+  } else {
+    // Write block statistics count = 0
+    export_value(ostream, uint32_t{0});
   }
 }
 
+template <typename T>
+void BinaryWriter::_write_segment(const FSSTSegment<T>& fsst_segment, std::ostream& ostream) {
+  export_value(ostream, EncodingType::FSST);
+
+  // Write offset vector width
+  const auto offset_vector_width = _compressed_vector_width<T>(fsst_segment);
+  export_value(ostream, static_cast<AttributeVectorWidth>(offset_vector_width));
+
+  // Write the symbol table
+  const auto& symbol_table = fsst_segment.symbol_table();
+  export_value(ostream, static_cast<uint32_t>(symbol_table.symbol_count()));
+  export_values(ostream, symbol_table.symbol_lengths());
+  export_values(ostream, symbol_table.symbols());
+
+  // Write the compressed values
+  export_value(ostream, static_cast<uint32_t>(fsst_segment.compressed_values().size()));
+  export_values(ostream, fsst_segment.compressed_values());
+
+  // Write flag if optional NULL value vector is written
+  export_value(ostream, static_cast<BoolAsByteType>(fsst_segment.null_values().has_value()));
+  if (fsst_segment.null_values()) {
+    // Write NULL values
+    export_values(ostream, *fsst_segment.null_values());
+  }
+
+  // Write offset values
+  _export_compressed_vector(ostream, *fsst_segment.compressed_vector_type(), fsst_segment.offsets());
+}
+
 template <typename T>
 uint32_t BinaryWriter::_compressed_vector_width(const BaseEncodedSegment& base_encoded_segment) {
   uint32_t vector_width = 0u;
@@ -340,20 +538,20 @@ uint32_t BinaryWriter::_compressed_vector_width(const BaseEncodedSegment& base_e
   return vector_width;
 }
 
-void BinaryWriter::_export_compressed_vector(std::ofstream& ofstream, const CompressedVectorType type,
+void BinaryWriter::_export_compressed_vector(std::ostream& ostream, const CompressedVectorType type,
                                              const BaseCompressedVector& compressed_vector) {
   switch (type) {
     case CompressedVectorType::FixedSize4ByteAligned:
-      export_values(ofstream, dynamic_cast<const FixedSizeByteAlignedVector<uint32_t>&>(compressed_vector).data());
+      export_values(ostream, dynamic_cast<const FixedSizeByteAlignedVector<uint32_t>&>(compressed_vector).data());
       return;
     case CompressedVectorType::FixedSize2ByteAligned:
-      export_values(ofstream, dynamic_cast<const FixedSizeByteAlignedVector<uint16_t>&>(compressed_vector).data());
+      export_values(ostream, dynamic_cast<const FixedSizeByteAlignedVector<uint16_t>&>(compressed_vector).data());
       return;
     case CompressedVectorType::FixedSize1ByteAligned:
-      export_values(ofstream, dynamic_cast<const FixedSizeByteAlignedVector<uint8_t>&>(compressed_vector).data());
+      export_values(ostream, dynamic_cast<const FixedSizeByteAlignedVector<uint8_t>&>(compressed_vector).data());
       return;
     case CompressedVectorType::SimdBp128:
-      export_values(ofstream, dynamic_cast<const SimdBp128Vector&>(compressed_vector).data());
+      export_values(ostream, dynamic_cast<const SimdBp128Vector&>(compressed_vector).data());
       return;
     default:
       Fail("Any other type should have been caught before.");
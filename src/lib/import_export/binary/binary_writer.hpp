@@ -1,16 +1,21 @@
 #pragma once
 
 #include <memory>
+#include <ostream>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "storage/dictionary_segment.hpp"
 #include "storage/fixed_string_dictionary_segment.hpp"
+#include "storage/front_coded_dictionary_segment.hpp"
 #include "storage/frame_of_reference_segment.hpp"
+#include "storage/fsst_segment.hpp"
 #include "storage/lz4_segment.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/run_length_segment.hpp"
 #include "storage/value_segment.hpp"
+#include "storage/versioned_segment.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
@@ -20,14 +25,39 @@ enum class CompressedVectorType : uint8_t;
 
 class BinaryWriter {
  public:
+  /**
+   * Writes the table in the following form:
+   *
+   * --------------------
+   * |      Header      |
+   * |------------------|
+   * | Chunk directory¹ |
+   * |------------------|
+   * |      Chunks²     |
+   * --------------------
+   *
+   * ¹ For each chunk, the file offsets of the chunk, of each of its segments, and of the end of the chunk
+   *   (uint64_t array, Chunk count * (Column count + 2) * 8 bytes). The directory allows readers to load chunks and
+   *   individual segments independently of each other.
+   * ² Zero or more chunks
+   *
+   * The chunks are serialized concurrently by scheduler tasks and written in the order of their ids with positional
+   * writes. At most MAX_CHUNKS_IN_FLIGHT serialized chunks are kept in memory.
+   */
   static void write(const Table& table, const std::string& filename);
 
+  // Identifies the revision of the file format. Files without the chunk directory do not start with it.
+  static constexpr auto MAGIC = std::string_view{"HYRBIN02"};
+
+  static constexpr auto MAX_CHUNKS_IN_FLIGHT = size_t{64};
+
  private:
   /**
-   * This methods writes the header of this table into the given ofstream.
+   * This methods writes the header of this table into the given ostream.
    *
    * Description                 | Type                                | Size in bytes
    * --------------------------------------------------------------------------------------------------------
+   * Magic                       | char array                          | 8
    * Chunk size                  | ChunkOffset                         | 4
    * Chunk count                 | ChunkID                             | 4
    * Column count                | ColumnID                            | 2
@@ -36,10 +66,10 @@ class BinaryWriter {
    * Column name lengths         | size_t array                        | Column Count * 1
    * Column names                | std::string array                   | Sum of lengths of all names
    */
-  static void _write_header(const Table& table, std::ofstream& ofstream);
+  static void _write_header(const Table& table, std::ostream& ostream);
 
   /**
-   * Writes the contents of the chunk into the given ofstream.
+   * Writes the contents of the chunk into the given ostream.
    * First, it creates a chunk header with the following contents:
    *
    * Description                 | Type                                | Size in bytes
@@ -48,8 +78,10 @@ class BinaryWriter {
    *
    * Next, it dumps the contents of the segments in the respective format (depending on the type
    * of the segment, such as ValueSegment, ReferenceSegment, DictionarySegment, RunLengthSegment).
+   *
+   * Returns the offsets of the segments relative to the start of the chunk, followed by the size of the chunk.
    */
-  static void _write_chunk(const Table& table, std::ofstream& ofstream, const ChunkID& chunk_id);
+  static std::vector<uint64_t> _write_chunk(const Table& table, std::ostream& ostream, const ChunkID& chunk_id);
 
   /**
    * ValueSegments are dumped with the following layout:
@@ -70,7 +102,7 @@ class BinaryWriter {
    * °: This field is writen if the type of the column is NOT a string
    */
   template <typename T>
-  static void _write_segment(const ValueSegment<T>& value_segment, std::ofstream& ofstream);
+  static void _write_segment(const ValueSegment<T>& value_segment, std::ostream& ostream);
 
   /**
    * ReferenceSegments are dumped with the following layout, which is similar to value segments:
@@ -88,7 +120,15 @@ class BinaryWriter {
    * ^: These fields are only written if the type of the column IS a string.
    * °: This field is writen if the type of the column is NOT a string
    */
-  static void _write_segment(const ReferenceSegment& reference_segment, std::ofstream& ofstream);
+  static void _write_segment(const ReferenceSegment& reference_segment, std::ostream& ostream);
+
+  /**
+   * VersionedSegments are materialized and dumped with the layout of value segments. As the main segment might not
+   * tell whether the column is nullable, this is passed explicitly.
+   */
+  template <typename T>
+  static void _write_segment(const VersionedSegment<T>& versioned_segment, const bool column_is_nullable,
+                             std::ostream& ostream);
 
   /**
    * DictionarySegments are dumped with the following layout:
@@ -110,7 +150,7 @@ class BinaryWriter {
    * °: This field is written if the type of the column is NOT a string
    */
   template <typename T>
-  static void _write_segment(const DictionarySegment<T>& dictionary_segment, std::ofstream& ofstream);
+  static void _write_segment(const DictionarySegment<T>& dictionary_segment, std::ostream& ostream);
 
   /**
    * FixedStringDictionarySegments are dumped with the following layout:
@@ -129,7 +169,27 @@ class BinaryWriter {
    */
   template <typename T>
   static void _write_segment(const FixedStringDictionarySegment<T>& fixed_string_dictionary_segment,
-                             std::ofstream& ofstream);
+                             std::ostream& ostream);
+
+  /**
+   * FrontCodedDictionarySegments are dumped with the following layout:
+   *
+   * Description                 | Type                                | Size in bytes
+   * --------------------------------------------------------------------------------------------------------
+   * Encoding Type               | EncodingType                        | 1
+   * Width of attribute vector   | AttributeVectorWidth                | 1
+   * Size of dictionary vector   | ValueID                             | 4
+   * Block offsets               | vector<uint32_t>                    | ceil(Dictionary size / block size) * 4
+   * Size of encoded dictionary  | uint32_t                            | 4
+   * Encoded dictionary          | char array                          | Size of encoded dictionary
+   * Attribute vector values     | uintX                               | Rows * width of attribute vector
+   *
+   * Please note that the number of rows are written in the header of the chunk.
+   * The type of the column can be found in the global header of the file.
+   */
+  template <typename T>
+  static void _write_segment(const FrontCodedDictionarySegment<T>& front_coded_dictionary_segment,
+                             std::ostream& ostream);
 
   /**
    * RunLengthSegments are dumped with the following layout:
@@ -146,7 +206,7 @@ class BinaryWriter {
    * The type of the column can be found in the global header of the file.
    */
   template <typename T>
-  static void _write_segment(const RunLengthSegment<T>& run_length_segment, std::ofstream& ofstream);
+  static void _write_segment(const RunLengthSegment<T>& run_length_segment, std::ostream& ostream);
 
   /**
    * FrameOfReferenceSegments are dumped with the following layout:
@@ -167,7 +227,7 @@ class BinaryWriter {
    * ¹: This field is only written when the optional NULL values are stored
    */
   template <typename T>
-  static void _write_segment(const FrameOfReferenceSegment<T>& frame_of_reference_segment, std::ofstream& ofstream);
+  static void _write_segment(const FrameOfReferenceSegment<T>& frame_of_reference_segment, std::ostream& ostream);
 
   /**
    * LZ4Segments are dumped with the following layout:
@@ -188,6 +248,11 @@ class BinaryWriter {
    * string offset size          | uint32_t                            | 4
    * string offset data size³    | uint32_t                            | 4
    * string offset³              | uint32_t                            | size * 4
+   * Block statistics count      | uint32_t                            | 4
+   * Block first chunk offsets⁴  | vector<ChunkOffset>                 | Block statistics count * 4
+   * Block NULL value counts⁴    | vector<ChunkOffset>                 | Block statistics count * 4
+   * Block minima⁴               | vector<T>                           | Block statistics count * sizeof(T)
+   * Block maxima⁴               | vector<T>                           | Block statistics count * sizeof(T)
    *
    * Please note that the number of rows are written in the header of the chunk.
    * The type of the column can be found in the global header of the file.
@@ -196,15 +261,41 @@ class BinaryWriter {
    *    size of the single block or 0 if there are no blocks
    * ²: This field is only written if NULL values' size is not 0
    * ³: These fields are only written if string offset size is not 0
+   * ⁴: These fields are only written if the block statistics count is not 0. For strings, the minima and maxima are
+   *    written like the values of a ValueSegment (i.e., the string lengths followed by the characters).
+   */
+  template <typename T>
+  static void _write_segment(const LZ4Segment<T>& lz4_segment, std::ostream& ostream);
+
+  /**
+   * FSSTSegments are dumped with the following layout:
+   *
+   * Description                 | Type                                | Size in bytes
+   * --------------------------------------------------------------------------------------------------------
+   * Encoding Type               | EncodingType                        | 1
+   * Width of offset vector      | AttributeVectorWidth                | 1
+   * Number of symbols           | uint32_t                            | 4
+   * Symbol lengths              | vector<uint8_t>                     | Number of symbols * 1
+   * Symbols                     | vector<char>                        | Number of symbols * 8
+   * Compressed values size      | uint32_t                            | 4
+   * Compressed values           | vector<uint8_t>                     | Compressed values size * 1
+   * Stores NULL values          | bool (stored as BoolAsByteType)     | 1
+   * NULL values¹                | vector<bool> (BoolAsByteType)       | Rows * 1
+   * Offset values               | uintX                               | (Rows + 1) * width of offset vector
+   *
+   * Please note that the number of rows are written in the header of the chunk.
+   * The type of the column can be found in the global header of the file.
+   *
+   * ¹: This field is only written when the optional NULL values are stored
    */
   template <typename T>
-  static void _write_segment(const LZ4Segment<T>& lz4_segment, std::ofstream& ofstream);
+  static void _write_segment(const FSSTSegment<T>& fsst_segment, std::ostream& ostream);
 
   template <typename T>
   static uint32_t _compressed_vector_width(const BaseEncodedSegment& base_encoded_segment);
 
   // Chooses the right Compressed Vector depending on the CompressedVectorType and exports it.
-  static void _export_compressed_vector(std::ofstream& ofstream, const CompressedVectorType type,
+  static void _export_compressed_vector(std::ostream& ostream, const CompressedVectorType type,
                                         const BaseCompressedVector& compressed_vector);
 
   template <typename T>
@@ -15,6 +15,7 @@
 #include "import_export/csv/csv_meta.hpp"
 #include "resolve_type.hpp"
 #include "scheduler/job_task.hpp"
+#include "storage/chunk_encoder.hpp"
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
 #include "utils/load_table.hpp"
@@ -22,7 +23,23 @@
 namespace opossum {
 
 std::shared_ptr<Table> CsvParser::parse(const std::string& filename, const ChunkOffset chunk_size,
-                                        const std::optional<CsvMeta>& csv_meta) {
+                                        const std::optional<CsvMeta>& csv_meta,
+                                        const std::optional<SegmentEncodingSpec>& encoding_spec) {
+  return _parse(filename, chunk_size, csv_meta, encoding_spec, READ_BUFFER_SIZE);
+}
+
+std::vector<std::shared_ptr<AbstractTask>> CsvParser::schedule_parsing_tasks(
+    std::string_view csv_content, const Table& table, const CsvMeta& meta, std::list<ParsedChunk>& parsed_chunks,
+    const std::shared_ptr<AbstractTask>& successor) {
+  std::vector<std::shared_ptr<AbstractTask>> tasks;
+  _schedule_parsing_tasks(csv_content, table, meta, parsed_chunks, tasks, false, std::nullopt, successor);
+  return tasks;
+}
+
+std::shared_ptr<Table> CsvParser::_parse(const std::string& filename, const ChunkOffset chunk_size,
+                                         const std::optional<CsvMeta>& csv_meta,
+                                         const std::optional<SegmentEncodingSpec>& encoding_spec,
+                                         const size_t read_buffer_size) {
   // If no meta info is given as a parameter, look for a json file
   CsvMeta meta;
   if (csv_meta == std::nullopt) {
@@ -31,8 +48,6 @@ std::shared_ptr<Table> CsvParser::parse(const std::string& filename, const Chunk
     meta = *csv_meta;
   }
 
-  auto escaped_linebreak = std::string(1, meta.config.delimiter_escape) + std::string(1, meta.config.delimiter);
-
   auto table = _create_table_from_meta(chunk_size, meta);
 
   std::ifstream csvfile{filename};
@@ -45,58 +60,131 @@ std::shared_ptr<Table> CsvParser::parse(const std::string& filename, const Chunk
     std::getline(csvfile, line);
     Assert(line.find('\r') == std::string::npos, "Windows encoding is not supported, use dos2unix");
   }
-
-  /**
-   * Load the whole file(!) into a std::string using the, hopefully, fastest method to do so.
-   * TODO(anybody) Maybe use mmap() in the future. The current approach needs to have the entire file in RAM, mmap might
-   *               be cleverer, dunno.
-   */
-  csvfile.seekg(0, std::ios::end);
-  const auto csvfile_size = csvfile.tellg();
-  std::string content(csvfile_size, ' ');
   csvfile.seekg(0);
-  csvfile.read(content.data(), csvfile_size);
 
-  // make sure content ends with a delimiter for better row processing later
-  if (content.back() != meta.config.delimiter) content.push_back(meta.config.delimiter);
+  // A buffer of the file content and the chunks that are parsed from it. Lists are used to keep the references of the
+  // tasks valid.
+  struct CsvBuffer {
+    std::string content;
+    std::list<ParsedChunk> parsed_chunks;
+    std::vector<std::shared_ptr<AbstractTask>> tasks;
+  };
+  std::list<CsvBuffer> buffers;
+
+  const auto append_parsed_chunks = [&](CsvBuffer& buffer) {
+    Hyrise::get().scheduler()->wait_for_tasks(buffer.tasks);
+
+    for (auto& parsed_chunk : buffer.parsed_chunks) {
+      if (parsed_chunk.exception) std::rethrow_exception(parsed_chunk.exception);
+
+      auto& segments = parsed_chunk.segments;
+      DebugAssert(!segments.empty(), "Empty chunks shouldn't occur when importing CSV");
+      const auto mvcc_data = std::make_shared<MvccData>(segments.front()->size(), CommitID{0});
+      table->append_chunk(segments, mvcc_data);
+      table->last_chunk()->finalize();
+    }
+  };
+
+  try {
+    // Rows of the previous buffer that did not fill an entire chunk
+    auto remaining_content = std::string{};
+
+    while (true) {
+      auto content = std::move(remaining_content);
+      const auto previous_size = content.size();
+      content.resize(previous_size + read_buffer_size);
+      csvfile.read(content.data() + previous_size, static_cast<std::streamsize>(read_buffer_size));
+      content.resize(previous_size + static_cast<size_t>(csvfile.gcount()));
+
+      const auto is_last_buffer = !csvfile;
+      if (content.empty()) break;
+
+      // make sure content ends with a delimiter for better row processing later
+      if (is_last_buffer && content.back() != meta.config.delimiter) content.push_back(meta.config.delimiter);
+
+      auto& buffer = buffers.emplace_back();
+      buffer.content = std::move(content);
+      const auto parsed_bytes = _schedule_parsing_tasks(buffer.content, *table, meta, buffer.parsed_chunks,
+                                                        buffer.tasks, !is_last_buffer, encoding_spec);
+
+      if (parsed_bytes == 0) {
+        // The buffer does not contain a full chunk yet
+        remaining_content = std::move(buffer.content);
+        buffers.pop_back();
+      } else {
+        remaining_content = buffer.content.substr(parsed_bytes);
+      }
+
+      // Bound the memory by waiting for the oldest buffer. Its chunks are appended in the order of the rows.
+      while (buffers.size() > MAX_BUFFERS_IN_FLIGHT) {
+        append_parsed_chunks(buffers.front());
+        buffers.pop_front();
+      }
 
-  std::string_view content_view{content.c_str(), content.size()};
+      if (is_last_buffer) break;
+    }
 
-  // Save chunks in list to avoid memory relocation
-  std::list<Segments> segments_by_chunks;
-  std::vector<std::shared_ptr<AbstractTask>> tasks;
+    for (auto& buffer : buffers) {
+      append_parsed_chunks(buffer);
+    }
+  } catch (...) {
+    // The tasks refer to the buffers, so they have to finish before the buffers are destroyed
+    for (auto& buffer : buffers) {
+      Hyrise::get().scheduler()->wait_for_tasks(buffer.tasks);
+    }
+    throw;
+  }
+
+  return table;
+}
+
+size_t CsvParser::_schedule_parsing_tasks(std::string_view csv_content, const Table& table, const CsvMeta& meta,
+                                          std::list<ParsedChunk>& parsed_chunks,
+                                          std::vector<std::shared_ptr<AbstractTask>>& tasks,
+                                          const bool full_chunks_only,
+                                          const std::optional<SegmentEncodingSpec>& encoding_spec,
+                                          const std::shared_ptr<AbstractTask>& successor) {
+  const auto escaped_linebreak = std::string(1, meta.config.delimiter_escape) + std::string(1, meta.config.delimiter);
+
+  auto parsed_bytes = size_t{0};
   std::vector<size_t> field_ends;
-  std::mutex append_chunk_mutex;
-  while (_find_fields_in_chunk(content_view, *table, field_ends, meta)) {
+  while (true) {
+    const auto row_count = _find_fields_in_chunk(csv_content, table, field_ends, meta);
+    if (row_count == 0 || (full_chunks_only && row_count < table.target_chunk_size())) break;
+
     // create empty chunk
-    segments_by_chunks.emplace_back();
-    auto& segments = segments_by_chunks.back();
+    parsed_chunks.emplace_back();
+    auto& parsed_chunk = parsed_chunks.back();
 
     // Only pass the part of the string that is actually needed to the parsing task
-    std::string_view relevant_content = content_view.substr(0, field_ends.back());
+    std::string_view relevant_content = csv_content.substr(0, field_ends.back());
 
     // Remove processed part of the csv content
-    content_view = content_view.substr(field_ends.back() + 1);
+    csv_content = csv_content.substr(field_ends.back() + 1);
+    parsed_bytes += field_ends.back() + 1;
 
     // create and start parsing task to fill chunk
-    tasks.emplace_back(std::make_shared<JobTask>([relevant_content, field_ends, &table, &segments, &meta,
-                                                  &escaped_linebreak, &append_chunk_mutex]() {
-      _parse_into_chunk(relevant_content, field_ends, *table, segments, meta, escaped_linebreak, append_chunk_mutex);
-    }));
+    tasks.emplace_back(std::make_shared<JobTask>(
+        [relevant_content, field_ends, &table, &parsed_chunk, &meta, escaped_linebreak, encoding_spec]() {
+          try {
+            _parse_into_chunk(relevant_content, field_ends, table, parsed_chunk.segments, meta, escaped_linebreak);
+
+            if (encoding_spec) {
+              const auto column_count = table.column_count();
+              for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+                auto& segment = parsed_chunk.segments[column_id];
+                segment = ChunkEncoder::encode_segment(segment, table.column_data_type(column_id), *encoding_spec);
+              }
+            }
+          } catch (...) {
+            parsed_chunk.exception = std::current_exception();
+          }
+        }));
+    if (successor) tasks.back()->set_as_predecessor_of(successor);
     tasks.back()->schedule();
   }
 
-  Hyrise::get().scheduler()->wait_for_tasks(tasks);
-
-  for (auto& segments : segments_by_chunks) {
-    DebugAssert(!segments.empty(), "Empty chunks shouldn't occur when importing CSV");
-    const auto mvcc_data = std::make_shared<MvccData>(segments.front()->size(), CommitID{0});
-    table->append_chunk(segments, mvcc_data);
-  }
-
-  table->last_chunk()->finalize();
-
-  return table;
+  return parsed_bytes;
 }
 
 std::shared_ptr<Table> CsvParser::create_table_from_meta_file(const std::string& filename,
@@ -122,19 +210,21 @@ std::shared_ptr<Table> CsvParser::_create_table_from_meta(const ChunkOffset chun
   return std::make_shared<Table>(column_definitions, TableType::Data, chunk_size, UseMvcc::Yes);
 }
 
-bool CsvParser::_find_fields_in_chunk(std::string_view csv_content, const Table& table, std::vector<size_t>& field_ends,
-                                      const CsvMeta& meta) {
+size_t CsvParser::_find_fields_in_chunk(std::string_view csv_content, const Table& table,
+                                        std::vector<size_t>& field_ends, const CsvMeta& meta) {
   field_ends.clear();
   if (csv_content.empty()) {
-    return false;
+    return 0;
   }
 
   std::string search_for{meta.config.separator, meta.config.delimiter, meta.config.quote};
 
   size_t from = 0;
-  unsigned int rows = 0;
+  size_t rows = 0;
   unsigned int field_count = 1;
   bool in_quotes = false;
+  // Number of fields that belong to complete rows. The content might end within a row if it is read in buffers.
+  size_t complete_row_field_count = 0;
   while (rows < table.target_chunk_size()) {
     // Find either of row separator, column delimiter, quote identifier
     auto pos = csv_content.find_first_of(search_for, from);
@@ -156,7 +246,8 @@ bool CsvParser::_find_fields_in_chunk(std::string_view csv_content, const Table&
     }
 
     // Determine if delimiter marks end of row or is part of the (string) value
-    if (elem == meta.config.delimiter && !in_quotes) {
+    const auto is_row_end = elem == meta.config.delimiter && !in_quotes;
+    if (is_row_end) {
       DebugAssert(field_count == static_cast<size_t>(table.column_count()),
                   "Number of CSV fields does not match number of columns.");
       ++rows;
@@ -170,14 +261,16 @@ bool CsvParser::_find_fields_in_chunk(std::string_view csv_content, const Table&
 
     ++field_count;
     field_ends.push_back(pos);
+    if (is_row_end) complete_row_field_count = field_ends.size();
   }
 
-  return true;
+  field_ends.resize(complete_row_field_count);
+  return rows;
 }
 
 size_t CsvParser::_parse_into_chunk(std::string_view csv_chunk, const std::vector<size_t>& field_ends,
                                     const Table& table, Segments& segments, const CsvMeta& meta,
-                                    const std::string& escaped_linebreak, std::mutex& append_chunk_mutex) {
+                                    const std::string& escaped_linebreak) {
   // For each csv column, create a CsvConverter which builds up a ValueSegment
   const auto column_count = table.column_count();
   const auto row_count = field_ends.size() / column_count;
@@ -221,12 +314,10 @@ size_t CsvParser::_parse_into_chunk(std::string_view csv_chunk, const std::vecto
                            std::to_string(column_id) + ":\n" + exception.what());
   }
 
-  // Transform the field_offsets to segments and add segments to chunk.
-  {
-    std::lock_guard<std::mutex> lock(append_chunk_mutex);
-    for (auto& converter : converters) {
-      segments.push_back(converter->finish());
-    }
+  // Transform the field_offsets to segments and add segments to chunk. Each task fills the segments of its own chunk,
+  // so no synchronization is needed.
+  for (auto& converter : converters) {
+    segments.push_back(converter->finish());
   }
 
   return row_count;
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <exception>
+#include <list>
 #include <memory>
 #include <optional>
 #include <string>
@@ -7,9 +9,11 @@
 #include <vector>
 
 #include "import_export/csv/csv_meta.hpp"
+#include "storage/encoding_type.hpp"
 
 namespace opossum {
 
+class AbstractTask;
 class Table;
 class Chunk;
 
@@ -21,23 +25,73 @@ class Chunk;
  * For non-RFC 4180, all linebreaks within quoted strings are further escaped with an escape character.
  * For the structure of the meta csv file see export_csv.hpp
  *
- * This parser reads the whole csv file and iterates over it to separate the data into chunks that are aligned with the
- * csv rows.
- * Each data chunk is parsed and converted into a opossum chunk. In the end all chunks are combined to the final table.
+ * This parser reads the csv file in buffers of READ_BUFFER_SIZE bytes and iterates over each buffer to separate the
+ * data into chunks that are aligned with the csv rows. Each data chunk is parsed and converted into an opossum chunk by
+ * a task, while the next buffer is read. Rows that do not fill an entire chunk are carried over to the next buffer, so
+ * that all chunks but the last one are full. As at most MAX_BUFFERS_IN_FLIGHT buffers are parsed at the same time, the
+ * memory needed for the file content does not depend on the file size.
  */
 class CsvParser {
  public:
+  // The result of a parsing task (see schedule_parsing_tasks)
+  struct ParsedChunk {
+    Segments segments;
+
+    // Set if the rows could not be parsed. The tasks do not throw, as the exception would not reach the caller.
+    std::exception_ptr exception;
+  };
+
   /*
    * @param filename      Path to the input file.
    * @param csv_meta      Custom csv meta information which will be used instead of the default "filename" + ".json" meta.
+   * @param encoding_spec Optional. If set, the parsing tasks encode the segments of the chunks. The encoding has to
+   *                      support the data types of all columns.
    * @returns             The table that was created from the csv file.
    */
   static std::shared_ptr<Table> parse(const std::string& filename, const ChunkOffset chunk_size = Chunk::DEFAULT_SIZE,
-                                      const std::optional<CsvMeta>& csv_meta = std::nullopt);
+                                      const std::optional<CsvMeta>& csv_meta = std::nullopt,
+                                      const std::optional<SegmentEncodingSpec>& encoding_spec = std::nullopt);
   static std::shared_ptr<Table> create_table_from_meta_file(const std::string& filename,
                                                             const ChunkOffset chunk_size = Chunk::DEFAULT_SIZE);
 
+  /*
+   * Schedules tasks that parse the rows of the csv content in parallel. Each task parses up to target_chunk_size rows
+   * and fills a new element of \p parsed_chunks. This is also used for csv data that is not read from a file (see
+   * CopyDataParser).
+   *
+   * @param csv_content    Complete csv rows, ending with a row delimiter.
+   * @param table          Empty table with the columns of the csv.
+   * @param parsed_chunks  List to which the parsed chunks are appended in the order of the rows.
+   * @param successor      If set, each task becomes a predecessor of this task, which the caller schedules afterwards.
+   * @returns              The scheduled tasks. All parameters have to outlive them.
+   */
+  static std::vector<std::shared_ptr<AbstractTask>> schedule_parsing_tasks(
+      std::string_view csv_content, const Table& table, const CsvMeta& meta, std::list<ParsedChunk>& parsed_chunks,
+      const std::shared_ptr<AbstractTask>& successor = nullptr);
+
  protected:
+  friend class CsvParserTest;
+
+  static constexpr auto READ_BUFFER_SIZE = size_t{32'000'000};
+  static constexpr auto MAX_BUFFERS_IN_FLIGHT = size_t{16};
+
+  static std::shared_ptr<Table> _parse(const std::string& filename, const ChunkOffset chunk_size,
+                                       const std::optional<CsvMeta>& csv_meta,
+                                       const std::optional<SegmentEncodingSpec>& encoding_spec,
+                                       const size_t read_buffer_size);
+
+  /*
+   * Schedules the parsing tasks (see schedule_parsing_tasks) and appends them to \p tasks.
+   *
+   * @param full_chunks_only  If true, rows that do not fill an entire chunk are not parsed.
+   * @returns                 The number of bytes of \p csv_content that are parsed by the tasks.
+   */
+  static size_t _schedule_parsing_tasks(std::string_view csv_content, const Table& table, const CsvMeta& meta,
+                                        std::list<ParsedChunk>& parsed_chunks,
+                                        std::vector<std::shared_ptr<AbstractTask>>& tasks, const bool full_chunks_only,
+                                        const std::optional<SegmentEncodingSpec>& encoding_spec,
+                                        const std::shared_ptr<AbstractTask>& successor = nullptr);
+
   /*
    * Use the meta information stored in _meta to create a new table with according column description.
    */
@@ -47,10 +101,10 @@ class CsvParser {
    * @param      csv_content String_view on the remaining content of the CSV.
    * @param      table       Empty table created by _process_meta_file.
    * @param[out] field_ends  Empty vector, to be filled with positions of the field ends for one chunk found in \p
-   * csv_content.
-   * @returns                False if \p csv_content is empty or chunk_size set to 0, True otherwise.
+   * csv_content. Fields of an incomplete last row are not included.
+   * @returns                The number of complete rows found, at most the target chunk size of \p table.
    */
-  static bool _find_fields_in_chunk(std::string_view csv_content, const Table& table, std::vector<size_t>& field_ends,
+  static size_t _find_fields_in_chunk(std::string_view csv_content, const Table& table, std::vector<size_t>& field_ends,
                                     const CsvMeta& meta);
 
   /*
@@ -61,8 +115,7 @@ class CsvParser {
    * @returns               The number of rows in the chunk
    */
   static size_t _parse_into_chunk(std::string_view csv_chunk, const std::vector<size_t>& field_ends, const Table& table,
-                                  Segments& segments, const CsvMeta& meta, const std::string& escaped_linebreak,
-                                  std::mutex& append_chunk_mutex);
+                                  Segments& segments, const CsvMeta& meta, const std::string& escaped_linebreak);
 
   /*
    * @param field The field that needs to be modified to be RFC 4180 compliant.
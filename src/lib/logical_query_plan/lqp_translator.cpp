@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <boost/hana/for_each.hpp>
@@ -22,6 +23,7 @@
 #include "expression/abstract_expression.hpp"
 #include "expression/abstract_predicate_expression.hpp"
 #include "expression/expression_utils.hpp"
+#include "expression/logical_expression.hpp"
 #include "expression/lqp_column_expression.hpp"
 #include "expression/lqp_subquery_expression.hpp"
 #include "expression/pqp_column_expression.hpp"
@@ -66,9 +68,11 @@
 #include "projection_node.hpp"
 #include "sort_node.hpp"
 #include "static_table_node.hpp"
+#include "storage/index/table_hash/table_hash_index.hpp"
 #include "stored_table_node.hpp"
 #include "union_node.hpp"
 #include "update_node.hpp"
+#include "utils/column_ids_after_pruning.hpp"
 
 using namespace std::string_literals;  // NOLINT
 
@@ -151,7 +155,8 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_stored_table_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
   const auto stored_table_node = std::dynamic_pointer_cast<StoredTableNode>(node);
   return std::make_shared<GetTable>(stored_table_node->table_name, stored_table_node->pruned_chunk_ids(),
-                                    stored_table_node->pruned_column_ids());
+                                    stored_table_node->pruned_column_ids(),
+                                    stored_table_node->chunk_pruning_column_ids());
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node(
@@ -184,6 +189,11 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_in
   // Our IndexScan implementation does not work on reference segments yet.
   Assert(node->left_input()->type == LQPNodeType::StoredTable, "IndexScan must follow a StoredTableNode.");
 
+  // Prefer a point lookup in a TableHashIndex, which does not have to look at every chunk
+  if (const auto index_lookup = _translate_predicate_node_to_table_hash_index_lookup(node, input_operator)) {
+    return index_lookup;
+  }
+
   const auto predicate = std::dynamic_pointer_cast<AbstractPredicateExpression>(node->predicate());
   Assert(predicate, "Expected predicate");
   Assert(!predicate->arguments.empty(), "Expected arguments");
@@ -237,6 +247,49 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_in
   return std::make_shared<UnionAll>(index_scan, table_scan);
 }
 
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_table_hash_index_lookup(
+    const std::shared_ptr<PredicateNode>& node, const std::shared_ptr<AbstractOperator>& input_operator) const {
+  // The predicate has to be a conjunction of `column = value` predicates
+  auto values_by_column_id = std::unordered_map<ColumnID, AllTypeVariant>{};
+  for (const auto& predicate : flatten_logical_expressions(node->predicate(), LogicalOperator::And)) {
+    const auto operator_predicates = OperatorScanPredicate::from_expression(*predicate, *node);
+    if (!operator_predicates || operator_predicates->size() != 1) return nullptr;
+
+    const auto& operator_predicate = operator_predicates->front();
+    if (operator_predicate.predicate_condition != PredicateCondition::Equals) return nullptr;
+    if (!is_variant(operator_predicate.value)) return nullptr;
+    // Predicates like `a = 1 AND a = 2` are not handled
+    const auto& value = boost::get<AllTypeVariant>(operator_predicate.value);
+    if (!values_by_column_id.emplace(operator_predicate.column_id, value).second) return nullptr;
+  }
+
+  const auto stored_table_node = std::static_pointer_cast<StoredTableNode>(node->left_input());
+  const auto table = Hyrise::get().storage_manager.get_table(stored_table_node->table_name);
+  const auto column_id_mapping =
+      column_ids_after_pruning(table->column_count(), stored_table_node->pruned_column_ids());
+
+  // Look for an index that covers exactly the columns of the predicate
+  for (const auto& table_hash_index : table->table_hash_indexes()) {
+    if (table_hash_index->column_ids().size() != values_by_column_id.size()) continue;
+
+    auto column_ids = std::vector<ColumnID>{};
+    auto values = std::vector<AllTypeVariant>{};
+    for (const auto stored_column_id : table_hash_index->column_ids()) {
+      const auto column_id = column_id_mapping[stored_column_id];
+      if (!column_id || !values_by_column_id.count(*column_id)) break;
+
+      column_ids.emplace_back(*column_id);
+      values.emplace_back(values_by_column_id[*column_id]);
+    }
+
+    if (column_ids.size() == values_by_column_id.size()) {
+      return std::make_shared<IndexScan>(input_operator, column_ids, values);
+    }
+  }
+
+  return nullptr;
+}
+
 std::shared_ptr<TableScan> LQPTranslator::_translate_predicate_node_to_table_scan(
     const std::shared_ptr<PredicateNode>& node, const std::shared_ptr<AbstractOperator>& input_operator) const {
   return std::make_shared<TableScan>(input_operator, _translate_expression(node->predicate(), node->left_input()));
@@ -49,6 +49,18 @@ void StoredTableNode::set_pruned_column_ids(const std::vector<ColumnID>& pruned_
 
 const std::vector<ColumnID>& StoredTableNode::pruned_column_ids() const { return _pruned_column_ids; }
 
+void StoredTableNode::set_chunk_pruning_column_ids(const std::vector<ColumnID>& chunk_pruning_column_ids) {
+  DebugAssert(std::is_sorted(chunk_pruning_column_ids.begin(), chunk_pruning_column_ids.end()),
+              "Expected sorted vector of ColumnIDs");
+  DebugAssert(std::adjacent_find(chunk_pruning_column_ids.begin(), chunk_pruning_column_ids.end()) ==
+                  chunk_pruning_column_ids.end(),
+              "Expected vector of unique ColumnIDs");
+
+  _chunk_pruning_column_ids = chunk_pruning_column_ids;
+}
+
+const std::vector<ColumnID>& StoredTableNode::chunk_pruning_column_ids() const { return _chunk_pruning_column_ids; }
+
 std::string StoredTableNode::description(const DescriptionMode mode) const {
   const auto stored_table = Hyrise::get().storage_manager.get_table(table_name);
 
@@ -137,6 +149,9 @@ size_t StoredTableNode::_on_shallow_hash() const {
   for (const auto& pruned_column_id : _pruned_column_ids) {
     boost::hash_combine(hash, static_cast<size_t>(pruned_column_id));
   }
+  for (const auto& chunk_pruning_column_id : _chunk_pruning_column_ids) {
+    boost::hash_combine(hash, static_cast<size_t>(chunk_pruning_column_id));
+  }
   return hash;
 }
 
@@ -144,13 +159,15 @@ std::shared_ptr<AbstractLQPNode> StoredTableNode::_on_shallow_copy(LQPNodeMappin
   const auto copy = make(table_name);
   copy->set_pruned_chunk_ids(_pruned_chunk_ids);
   copy->set_pruned_column_ids(_pruned_column_ids);
+  copy->set_chunk_pruning_column_ids(_chunk_pruning_column_ids);
   return copy;
 }
 
 bool StoredTableNode::_on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const {
   const auto& stored_table_node = static_cast<const StoredTableNode&>(rhs);
   return table_name == stored_table_node.table_name && _pruned_chunk_ids == stored_table_node._pruned_chunk_ids &&
-         _pruned_column_ids == stored_table_node._pruned_column_ids;
+         _pruned_column_ids == stored_table_node._pruned_column_ids &&
+         _chunk_pruning_column_ids == stored_table_node._chunk_pruning_column_ids;
 }
 
 }  // namespace opossum
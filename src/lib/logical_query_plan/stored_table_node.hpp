@@ -34,6 +34,12 @@ class StoredTableNode : public EnableMakeForLQPNode<StoredTableNode>, public Abs
 
   void set_pruned_column_ids(const std::vector<ColumnID>& pruned_column_ids);
   const std::vector<ColumnID>& pruned_column_ids() const;
+
+  // ColumnIDs (of the stored Table, i.e., ignoring column pruning) whose pruning statistics were used to prune the
+  // chunks. GetTable keeps a pruned chunk if the values of one of these columns were updated in place since (see
+  // ColumnVersionStore::has_stale_pruning_statistics).
+  void set_chunk_pruning_column_ids(const std::vector<ColumnID>& chunk_pruning_column_ids);
+  const std::vector<ColumnID>& chunk_pruning_column_ids() const;
   /** @} */
 
   std::vector<IndexStatistics> indexes_statistics() const;
@@ -57,6 +63,7 @@ class StoredTableNode : public EnableMakeForLQPNode<StoredTableNode>, public Abs
   mutable std::optional<std::vector<std::shared_ptr<AbstractExpression>>> _column_expressions;
   std::vector<ChunkID> _pruned_chunk_ids;
   std::vector<ColumnID> _pruned_column_ids;
+  std::vector<ColumnID> _chunk_pruning_column_ids;
 };
 
 }  // namespace opossum
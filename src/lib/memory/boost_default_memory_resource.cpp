@@ -1,17 +1,47 @@
+#include <algorithm>
 #include <cstddef>
 #include <cstdlib>
 #include <iostream>
+#include <memory>
+#include <new>
 
 #include <boost/container/pmr/memory_resource.hpp>
 #include <boost/core/no_exceptions_support.hpp>
 
+#include "memory/memory_tracker.hpp"
+
 namespace boost::container::pmr {
 
+namespace {
+
+// Each allocation is preceded by a header that holds the MemoryTracker it was charged to (if any), so that the memory
+// is credited to the same tracker when it is freed, even if a different MemoryTrackingScope is active by then. The
+// header is padded so that the returned memory keeps the alignment guaranteed by malloc.
+using AllocationHeader = std::shared_ptr<opossum::MemoryTracker>;
+constexpr auto ALLOCATION_HEADER_SIZE = std::max(sizeof(AllocationHeader), alignof(std::max_align_t));
+
+}  // namespace
+
 class default_resource_impl : public memory_resource {  // NOLINT
  public:
-  void* do_allocate(std::size_t bytes, std::size_t alignment) override { return std::malloc(bytes); }  // NOLINT
+  // Allocations are attributed to the MemoryTracker of the calling thread's MemoryTrackingScope, if any
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override {  // NOLINT
+    auto* allocation = static_cast<std::byte*>(std::malloc(ALLOCATION_HEADER_SIZE + bytes));  // NOLINT
+    if (!allocation) return nullptr;
+
+    new (allocation) AllocationHeader{opossum::MemoryTrackingScope::track_allocation(bytes)};
+    return allocation + ALLOCATION_HEADER_SIZE;
+  }
+
+  void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override {  // NOLINT
+    auto* allocation = static_cast<std::byte*>(p) - ALLOCATION_HEADER_SIZE;
+
+    auto* header = std::launder(reinterpret_cast<AllocationHeader*>(allocation));
+    if (*header) (*header)->deallocate(bytes);
+    header->~AllocationHeader();
 
-  void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override { std::free(p); }  // NOLINT
+    std::free(allocation);  // NOLINT
+  }
 
   [[nodiscard]] bool do_is_equal(const memory_resource& other) const BOOST_NOEXCEPT override { return &other == this; }
 };
@@ -0,0 +1,93 @@
+#include "memory_tracker.hpp"
+
+#include <algorithm>
+
+namespace opossum {
+
+namespace {
+
+thread_local MemoryTrackingScope* current_scope = nullptr;  // NOLINT
+
+}  // namespace
+
+MemoryTracker::MemoryTracker(const std::shared_ptr<MemoryTracker>& parent, const std::optional<size_t>& limit)
+    : _parent(parent), _limit(limit) {}
+
+// The counters are not used to synchronize other data, so relaxed atomics suffice. This keeps the overhead on each
+// allocation low.
+void MemoryTracker::allocate(const size_t bytes) {
+  const auto current_usage =
+      _current_usage.fetch_add(static_cast<int64_t>(bytes), std::memory_order_relaxed) + static_cast<int64_t>(bytes);
+
+  auto peak_usage = _peak_usage.load(std::memory_order_relaxed);
+  while (current_usage > peak_usage &&
+         !_peak_usage.compare_exchange_weak(peak_usage, current_usage, std::memory_order_relaxed)) {
+  }
+
+  if (_parent) _parent->allocate(bytes);
+}
+
+void MemoryTracker::deallocate(const size_t bytes) {
+  _current_usage.fetch_sub(static_cast<int64_t>(bytes), std::memory_order_relaxed);
+  if (_parent) _parent->deallocate(bytes);
+}
+
+size_t MemoryTracker::current_usage() const {
+  return static_cast<size_t>(std::max(_current_usage.load(std::memory_order_relaxed), int64_t{0}));
+}
+
+size_t MemoryTracker::peak_usage() const { return static_cast<size_t>(_peak_usage.load(std::memory_order_relaxed)); }
+
+const std::optional<size_t>& MemoryTracker::limit() const { return _limit; }
+
+std::optional<size_t> MemoryTracker::available_memory() const {
+  auto available_memory = _parent ? _parent->available_memory() : std::nullopt;
+  if (_limit) {
+    const auto own_available_memory = *_limit - std::min(*_limit, current_usage());
+    available_memory = std::min(available_memory.value_or(own_available_memory), own_available_memory);
+  }
+  return available_memory;
+}
+
+bool MemoryTracker::limit_exceeded() const {
+  if (_limit && peak_usage() > *_limit) return true;
+  return _parent && _parent->limit_exceeded();
+}
+
+bool MemoryTracker::report_limit_exceeded() {
+  if (!limit_exceeded()) return false;
+  return !_limit_exceeded_reported.test_and_set();
+}
+
+MemoryTrackingScope::MemoryTrackingScope(const std::shared_ptr<MemoryTracker>& tracker)
+    : _tracker(tracker), _parent(current_scope) {
+  current_scope = this;
+}
+
+MemoryTrackingScope::~MemoryTrackingScope() { current_scope = _parent; }
+
+std::shared_ptr<MemoryTracker> MemoryTrackingScope::current_tracker() {
+  return current_scope ? current_scope->_tracker : nullptr;
+}
+
+bool MemoryTrackingScope::exceeds_available_memory(const size_t bytes) {
+  if (!current_scope || !current_scope->_tracker) return false;
+
+  const auto available_memory = current_scope->_tracker->available_memory();
+  return available_memory && bytes > *available_memory;
+}
+
+void MemoryTrackingScope::abort_if_limit_exceeded() {
+  if (current_scope && current_scope->_tracker && current_scope->_tracker->limit_exceeded()) {
+    throw MemoryLimitExceededException{"Memory limit exceeded"};
+  }
+}
+
+std::shared_ptr<MemoryTracker> MemoryTrackingScope::track_allocation(const size_t bytes) {
+  if (!current_scope || !current_scope->_tracker) return nullptr;
+
+  current_scope->_tracker->allocate(bytes);
+  return current_scope->_tracker;
+}
+
+}  // namespace opossum
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Accounts for the memory that is allocated through the default memory resource (see boost_default_memory_resource.cpp)
+ * while a MemoryTrackingScope for the tracker is active. As all pmr containers (e.g., PosLists, materialized join
+ * columns, the hash tables of JoinHash and AggregateHash) use that resource unless told otherwise, this covers most
+ * intermediate data of operators. Plain std containers are not tracked.
+ *
+ * Trackers form a hierarchy: Each operator that is executed on behalf of a tracked SQLPipelineStatement has its own
+ * tracker, whose parent is the tracker of the statement. Allocations are added to a tracker and all of its ancestors.
+ *
+ * Memory is credited to the tracker that it was charged to, no matter which scope is active when it is freed. For
+ * this, the default memory resource stores the tracker in front of each allocation, which also keeps the tracker alive
+ * until all memory charged to it has been freed.
+ *
+ * A tracker may have a limit. Exceeding it does not make allocations fail, as the allocating threads could not handle
+ * that gracefully. Instead, operators query available_memory() to reduce their footprint, memory-intensive operators
+ * abort between their phases (see MemoryTrackingScope::abort_if_limit_exceeded()), and the OperatorTask fails the
+ * statement once the limit has been exceeded.
+ */
+class MemoryTracker : private Noncopyable {
+ public:
+  explicit MemoryTracker(const std::shared_ptr<MemoryTracker>& parent = nullptr,
+                         const std::optional<size_t>& limit = std::nullopt);
+
+  void allocate(const size_t bytes);
+  void deallocate(const size_t bytes);
+
+  // Bytes currently allocated, clamped to 0
+  size_t current_usage() const;
+  size_t peak_usage() const;
+
+  const std::optional<size_t>& limit() const;
+
+  // Smallest remaining budget of this tracker and its ancestors, std::nullopt if none of them has a limit
+  std::optional<size_t> available_memory() const;
+
+  // Returns true if the peak usage of this tracker or one of its ancestors exceeded its limit
+  bool limit_exceeded() const;
+
+  // Like limit_exceeded(), but returns true only for the first caller, so that the violation is handled only once
+  bool report_limit_exceeded();
+
+ private:
+  const std::shared_ptr<MemoryTracker> _parent;
+  const std::optional<size_t> _limit;
+
+  std::atomic<int64_t> _current_usage{0};
+  std::atomic<int64_t> _peak_usage{0};
+  std::atomic_flag _limit_exceeded_reported = ATOMIC_FLAG_INIT;
+};
+
+// Thrown by MemoryTrackingScope::abort_if_limit_exceeded() and caught by the OperatorTask
+class MemoryLimitExceededException : public std::runtime_error {
+ public:
+  using std::runtime_error::runtime_error;
+};
+
+/**
+ * Attributes the allocations and deallocations of the calling thread during its lifetime to the given tracker. Scopes
+ * nest: An inner scope (even one without a tracker) takes precedence over the outer ones until it ends.
+ */
+class MemoryTrackingScope : private Noncopyable {
+ public:
+  explicit MemoryTrackingScope(const std::shared_ptr<MemoryTracker>& tracker);
+  ~MemoryTrackingScope();
+
+  // The tracker of the innermost active scope of the calling thread, if any. Tasks capture it when they are created so
+  // that their allocations are attributed to the operator or statement that created them.
+  static std::shared_ptr<MemoryTracker> current_tracker();
+
+  // Returns true if allocating @param bytes would exceed the memory limit of the current tracker or of one of its
+  // ancestors. Operators use this to choose a less memory-intensive strategy.
+  static bool exceeds_available_memory(const size_t bytes);
+
+  // Throws a MemoryLimitExceededException if the current tracker or one of its ancestors exceeded its limit. Operators
+  // call this between their phases so that they stop before allocating even more memory. Only call it from the thread
+  // that executes the operator, not from the JobTasks spawned by it, as exceptions must not escape worker threads.
+  static void abort_if_limit_exceeded();
+
+  // Called by the default memory resource. Returns the tracker that the allocation was charged to, which has to be
+  // credited with the memory when it is freed.
+  static std::shared_ptr<MemoryTracker> track_allocation(const size_t bytes);
+
+ private:
+  std::shared_ptr<MemoryTracker> _tracker;
+  MemoryTrackingScope* _parent;
+};
+
+}  // namespace opossum
@@ -9,10 +9,12 @@
 #include "concurrency/transaction_context.hpp"
 #include "logical_query_plan/base_non_query_node.hpp"
 #include "logical_query_plan/dummy_table_node.hpp"
+#include "memory/memory_tracker.hpp"
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
 #include "utils/format_bytes.hpp"
 #include "utils/format_duration.hpp"
+#include "utils/hardware_counters.hpp"
 #include "utils/print_directed_acyclic_graph.hpp"
 #include "utils/timer.hpp"
 #include "utils/tracing/probes.hpp"
@@ -34,28 +36,55 @@ void AbstractOperator::execute() {
 
   Timer performance_timer;
 
-  auto transaction_context = this->transaction_context();
-
-  if (transaction_context) {
-    /**
-     * Do not execute Operators if transaction has been aborted.
-     * Not doing so is crucial in order to make sure no other
-     * tasks of the Transaction run while the Rollback happens.
-     */
-    if (transaction_context->aborted()) {
-      return;
+  // JobTasks spawned by the operator pick up the accumulator from the scope and add their counters to it
+  const auto hardware_counter_accumulator =
+      HardwareCounters::is_enabled() ? std::make_shared<HardwareCounterAccumulator>() : nullptr;
+
+  // Likewise for the memory allocated by the operator, which is also charged to the statement's tracker. Operators of
+  // untracked statements do not pay for the tracking.
+  const auto statement_memory_tracker = MemoryTrackingScope::current_tracker();
+  const auto memory_tracker =
+      statement_memory_tracker ? std::make_shared<MemoryTracker>(statement_memory_tracker) : nullptr;
+
+  {
+    const auto hardware_counter_scope = HardwareCounterScope{hardware_counter_accumulator};
+    const auto memory_tracking_scope = MemoryTrackingScope{memory_tracker};
+
+    auto transaction_context = this->transaction_context();
+
+    if (transaction_context) {
+      /**
+       * Do not execute Operators if transaction has been aborted.
+       * Not doing so is crucial in order to make sure no other
+       * tasks of the Transaction run while the Rollback happens.
+       */
+      if (transaction_context->aborted()) {
+        return;
+      }
+      transaction_context->on_operator_started();
+      try {
+        _output = _on_execute(transaction_context);
+      } catch (const MemoryLimitExceededException&) {
+        // The OperatorTask rolls back the transaction, which waits for all active operators to finish
+        transaction_context->on_operator_finished();
+        throw;
+      }
+      transaction_context->on_operator_finished();
+    } else {
+      _output = _on_execute(nullptr);
     }
-    transaction_context->on_operator_started();
-    _output = _on_execute(transaction_context);
-    transaction_context->on_operator_finished();
-  } else {
-    _output = _on_execute(nullptr);
-  }
 
-  // release any temporary data if possible
-  _on_cleanup();
+    // release any temporary data if possible
+    _on_cleanup();
+  }
 
   _performance_data->walltime = performance_timer.lap();
+  if (hardware_counter_accumulator) {
+    _performance_data->hardware_counters = hardware_counter_accumulator->counters();
+  }
+  if (memory_tracker) {
+    _performance_data->peak_memory_usage = memory_tracker->peak_usage();
+  }
   _performance_data->executed = true;
   if (_output) {
     _performance_data->has_output = true;
@@ -1,5 +1,6 @@
 #include "aggregate_hash.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <memory>
 #include <optional>
@@ -14,6 +15,7 @@
 #include "constant_mappings.hpp"
 #include "expression/pqp_column_expression.hpp"
 #include "hyrise.hpp"
+#include "memory/memory_tracker.hpp"
 #include "resolve_type.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/job_task.hpp"
@@ -105,7 +107,9 @@ template <typename ColumnDataType, typename AggregateType>
 struct AggregateResultContext : SegmentVisitorContext {
   using AggregateResultAllocator = PolymorphicAllocator<AggregateResults<ColumnDataType, AggregateType>>;
 
-  AggregateResultContext() : results(AggregateResultAllocator{&buffer}) {}
+  // Allocates from the monotonic buffer unless @param memory_resource is given
+  explicit AggregateResultContext(boost::container::pmr::memory_resource* memory_resource = nullptr)
+      : results(AggregateResultAllocator{memory_resource ? memory_resource : &buffer}) {}
 
   boost::container::pmr::monotonic_buffer_resource buffer;
   AggregateResults<ColumnDataType, AggregateType> results;
@@ -113,8 +117,9 @@ struct AggregateResultContext : SegmentVisitorContext {
 
 template <typename ColumnDataType, typename AggregateType, typename AggregateKey>
 struct AggregateContext : public AggregateResultContext<ColumnDataType, AggregateType> {
-  AggregateContext() {
-    auto allocator = AggregateResultIdMapAllocator<AggregateKey>{&this->buffer};
+  explicit AggregateContext(boost::container::pmr::memory_resource* memory_resource = nullptr)
+      : AggregateResultContext<ColumnDataType, AggregateType>(memory_resource) {
+    auto allocator = AggregateResultIdMapAllocator<AggregateKey>{memory_resource ? memory_resource : &this->buffer};
 
     // Unused if AggregateKey == EmptyAggregateKey, but we initialize it anyway to reduce the number of diverging code
     // paths.
@@ -437,9 +442,24 @@ void AggregateHash::_aggregate() {
     Hyrise::get().scheduler()->wait_for_tasks(jobs);
   }
 
+  // Stop between the phases and chunks if the statement exceeded its memory limit in the meantime (see MemoryTracker)
+  MemoryTrackingScope::abort_if_limit_exceeded();
+
   /*
   AGGREGATION PHASE
   */
+
+  // The monotonic buffers of the aggregate contexts do not release memory when the result vectors and hash maps grow.
+  // If the statement's memory limit leaves little room, we use the default memory resource instead, which frees the
+  // memory of outgrown allocations but is slower. In the worst case, each row forms its own group.
+  const auto memory_per_group = sizeof(AggregateKey) + sizeof(AggregateResultId) + 2 * sizeof(AggregateKeyEntry);
+  const auto expected_result_memory =
+      input_table->row_count() * std::max(_aggregates.size(), size_t{1}) * memory_per_group;
+  if (MemoryTrackingScope::exceeds_available_memory(2 * expected_result_memory)) {
+    PerformanceWarning("Memory limit prevents monotonic buffers in hash aggregate");
+    _context_memory_resource = boost::container::pmr::get_default_resource();
+  }
+
   _contexts_per_column = std::vector<std::shared_ptr<SegmentVisitorContext>>(_aggregates.size());
 
   if (_aggregates.empty()) {
@@ -450,7 +470,8 @@ void AggregateHash::_aggregate() {
 
     We choose int8_t for column type and aggregate type because it's small.
     */
-    auto context = std::make_shared<AggregateContext<DistinctColumnType, DistinctAggregateType, AggregateKey>>();
+    auto context = std::make_shared<AggregateContext<DistinctColumnType, DistinctAggregateType, AggregateKey>>(
+        _context_memory_resource);
     _contexts_per_column.push_back(context);
   }
 
@@ -468,7 +489,8 @@ void AggregateHash::_aggregate() {
     if (input_column_id == INVALID_COLUMN_ID) {
       Assert(aggregate->aggregate_function == AggregateFunction::Count, "Only COUNT may have an invalid ColumnID");
       // SELECT COUNT(*) - we know the template arguments, so we don't need a visitor
-      auto context = std::make_shared<AggregateContext<CountColumnType, CountAggregateType, AggregateKey>>();
+      auto context = std::make_shared<AggregateContext<CountColumnType, CountAggregateType, AggregateKey>>(
+          _context_memory_resource);
       _contexts_per_column[aggregate_idx] = context;
       continue;
     }
@@ -483,6 +505,8 @@ void AggregateHash::_aggregate() {
     const auto chunk_in = input_table->get_chunk(chunk_id);
     if (!chunk_in) continue;
 
+    MemoryTrackingScope::abort_if_limit_exceeded();
+
     // Sometimes, gcc is really bad at accessing loop conditions only once, so we cache that here.
     const auto input_chunk_size = chunk_in->size();
 
@@ -939,43 +963,43 @@ std::shared_ptr<SegmentVisitorContext> AggregateHash::_create_aggregate_context(
       case AggregateFunction::Min:
         context = std::make_shared<AggregateContext<
             ColumnDataType, typename AggregateTraits<ColumnDataType, AggregateFunction::Min>::AggregateType,
-            AggregateKey>>();
+            AggregateKey>>(_context_memory_resource);
         break;
       case AggregateFunction::Max:
         context = std::make_shared<AggregateContext<
             ColumnDataType, typename AggregateTraits<ColumnDataType, AggregateFunction::Max>::AggregateType,
-            AggregateKey>>();
+            AggregateKey>>(_context_memory_resource);
         break;
       case AggregateFunction::Sum:
         context = std::make_shared<AggregateContext<
             ColumnDataType, typename AggregateTraits<ColumnDataType, AggregateFunction::Sum>::AggregateType,
-            AggregateKey>>();
+            AggregateKey>>(_context_memory_resource);
         break;
       case AggregateFunction::Avg:
         context = std::make_shared<AggregateContext<
             ColumnDataType, typename AggregateTraits<ColumnDataType, AggregateFunction::Avg>::AggregateType,
-            AggregateKey>>();
+            AggregateKey>>(_context_memory_resource);
         break;
       case AggregateFunction::Count:
         context = std::make_shared<AggregateContext<
             ColumnDataType, typename AggregateTraits<ColumnDataType, AggregateFunction::Count>::AggregateType,
-            AggregateKey>>();
+            AggregateKey>>(_context_memory_resource);
         break;
       case AggregateFunction::CountDistinct:
         context = std::make_shared<AggregateContext<
             ColumnDataType, typename AggregateTraits<ColumnDataType, AggregateFunction::CountDistinct>::AggregateType,
-            AggregateKey>>();
+            AggregateKey>>(_context_memory_resource);
         break;
       case AggregateFunction::StandardDeviationSample:
         context = std::make_shared<AggregateContext<
             ColumnDataType,
             typename AggregateTraits<ColumnDataType, AggregateFunction::StandardDeviationSample>::AggregateType,
-            AggregateKey>>();
+            AggregateKey>>(_context_memory_resource);
         break;
       case AggregateFunction::Any:
         context = std::make_shared<AggregateContext<
             ColumnDataType, typename AggregateTraits<ColumnDataType, AggregateFunction::Any>::AggregateType,
-            AggregateKey>>();
+            AggregateKey>>(_context_memory_resource);
         break;
     }
   });
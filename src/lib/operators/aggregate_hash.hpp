@@ -136,6 +136,9 @@ class AggregateHash : public AbstractAggregateOperator {
 
   std::vector<std::shared_ptr<BaseValueSegment>> _groupby_segments;
   std::vector<std::shared_ptr<SegmentVisitorContext>> _contexts_per_column;
+
+  // Memory resource for the results of the aggregate contexts. If nullptr, each context uses its own monotonic buffer.
+  boost::container::pmr::memory_resource* _context_memory_resource{nullptr};
 };
 
 }  // namespace opossum
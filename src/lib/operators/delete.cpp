@@ -20,6 +20,8 @@ const std::string& Delete::name() const {
   return name;
 }
 
+const std::vector<std::shared_ptr<MvccData>>& Delete::modified_mvcc_data() const { return _modified_mvcc_data; }
+
 std::shared_ptr<const Table> Delete::_on_execute(std::shared_ptr<TransactionContext> context) {
   _referencing_table = input_table_left();
 
@@ -57,6 +59,10 @@ std::shared_ptr<const Table> Delete::_on_execute(std::shared_ptr<TransactionCont
         auto mvcc_data = referenced_chunk->mvcc_data();
         DebugAssert(mvcc_data, "Delete cannot operate on a table without MVCC data");
 
+        if (_modified_mvcc_data.empty() || _modified_mvcc_data.back() != mvcc_data) {
+          _modified_mvcc_data.emplace_back(mvcc_data);
+        }
+
         DebugAssert(
             Validate::is_row_visible(
                 context->transaction_id(), context->snapshot_commit_id(), mvcc_data->get_tid(row_id.chunk_offset),
@@ -80,6 +86,12 @@ std::shared_ptr<const Table> Delete::_on_execute(std::shared_ptr<TransactionCont
             _mark_as_failed();
             return nullptr;
           }
+        } else if (mvcc_data->column_versions.has_conflicting_version(row_id.chunk_offset, _transaction_id,
+                                                                      context->snapshot_commit_id())) {
+          // The row is being updated in place by another transaction or was updated after our snapshot. As the row is
+          // locked by us now, it is unlocked on rollback.
+          _mark_as_failed();
+          return nullptr;
         }
       }
     }
@@ -99,10 +111,14 @@ void Delete::_on_commit_records(const CommitID commit_id) {
     for (const auto row_id : *referencing_segment->pos_list()) {
       const auto referenced_chunk = referenced_table->get_chunk(row_id.chunk_id);
 
-      referenced_chunk->mvcc_data()->set_end_cid(row_id.chunk_offset, commit_id);
+      const auto mvcc_data = referenced_chunk->mvcc_data();
+      mvcc_data->set_end_cid(row_id.chunk_offset, commit_id);
+      mvcc_data->update_last_commit_id(commit_id);
       referenced_chunk->increase_invalid_row_count(1);
       // We do not unlock the rows so subsequent transactions properly fail when attempting to update these rows.
     }
+
+    referenced_table->update_last_commit_id(commit_id);
   }
 }
 
@@ -10,6 +10,8 @@
 
 namespace opossum {
 
+struct MvccData;
+
 /**
  * Operator that marks the rows referenced by its input table as MVCC-expired.
  * Assumption: The input has been validated before.
@@ -20,6 +22,10 @@ class Delete : public AbstractReadWriteOperator {
 
   const std::string& name() const override;
 
+  // MVCC data of the chunks in which rows were deleted. Validate uses this to decide for which chunks it can skip the
+  // per-row visibility check.
+  const std::vector<std::shared_ptr<MvccData>>& modified_mvcc_data() const;
+
  protected:
   std::shared_ptr<const Table> _on_execute(std::shared_ptr<TransactionContext> context) override;
   std::shared_ptr<AbstractOperator> _on_deep_copy(
@@ -32,5 +38,6 @@ class Delete : public AbstractReadWriteOperator {
  private:
   TransactionID _transaction_id;
   std::shared_ptr<const Table> _referencing_table;
+  std::vector<std::shared_ptr<MvccData>> _modified_mvcc_data;
 };
 }  // namespace opossum
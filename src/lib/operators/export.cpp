@@ -3,6 +3,7 @@
 #include <boost/algorithm/string.hpp>
 
 #include "hyrise.hpp"
+#include "import_export/arrow/arrow_ipc_writer.hpp"
 #include "import_export/binary/binary_writer.hpp"
 #include "import_export/csv/csv_writer.hpp"
 #include "utils/assert.hpp"
@@ -34,6 +35,9 @@ std::shared_ptr<const Table> Export::_on_execute() {
     case FileType::Binary:
       BinaryWriter::write(*input_table_left(), _filename);
       break;
+    case FileType::Arrow:
+      ArrowIpcWriter::write(*input_table_left(), _filename);
+      break;
     case FileType::Auto:
     case FileType::Tbl:
       Fail("Export: Exporting file type is not supported.");
@@ -15,11 +15,13 @@ namespace opossum {
 GetTable::GetTable(const std::string& name) : GetTable(name, {}, {}) {}
 
 GetTable::GetTable(const std::string& name, const std::vector<ChunkID>& pruned_chunk_ids,
-                   const std::vector<ColumnID>& pruned_column_ids)
+                   const std::vector<ColumnID>& pruned_column_ids,
+                   const std::vector<ColumnID>& chunk_pruning_column_ids)
     : AbstractReadOnlyOperator(OperatorType::GetTable),
       _name(name),
       _pruned_chunk_ids(pruned_chunk_ids),
-      _pruned_column_ids(pruned_column_ids) {
+      _pruned_column_ids(pruned_column_ids),
+      _chunk_pruning_column_ids(chunk_pruning_column_ids) {
   // Check pruned_chunk_ids
   DebugAssert(std::is_sorted(_pruned_chunk_ids.begin(), _pruned_chunk_ids.end()), "Expected sorted vector of ChunkIDs");
   DebugAssert(std::adjacent_find(_pruned_chunk_ids.begin(), _pruned_chunk_ids.end()) == _pruned_chunk_ids.end(),
@@ -60,10 +62,12 @@ const std::vector<ChunkID>& GetTable::pruned_chunk_ids() const { return _pruned_
 
 const std::vector<ColumnID>& GetTable::pruned_column_ids() const { return _pruned_column_ids; }
 
+const std::vector<ColumnID>& GetTable::chunk_pruning_column_ids() const { return _chunk_pruning_column_ids; }
+
 std::shared_ptr<AbstractOperator> GetTable::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
-  return std::make_shared<GetTable>(_name, _pruned_chunk_ids, _pruned_column_ids);
+  return std::make_shared<GetTable>(_name, _pruned_chunk_ids, _pruned_column_ids, _chunk_pruning_column_ids);
 }
 
 void GetTable::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
@@ -93,15 +97,21 @@ std::shared_ptr<const Table> GetTable::_on_execute() {
   auto excluded_chunk_ids = std::vector<ChunkID>{};
   auto pruned_chunk_ids_iter = _pruned_chunk_ids.begin();
   for (ChunkID stored_chunk_id{0}; stored_chunk_id < chunk_count; ++stored_chunk_id) {
-    // Check whether the Chunk is pruned
+    const auto chunk = stored_table->get_chunk(stored_chunk_id);
+
+    // Check whether the Chunk is pruned. Chunks are kept if the values of a column that was used for pruning them
+    // were updated in place, as the pruning statistics do not reflect the updated values.
     if (pruned_chunk_ids_iter != _pruned_chunk_ids.end() && *pruned_chunk_ids_iter == stored_chunk_id) {
       ++pruned_chunk_ids_iter;
-      excluded_chunk_ids.emplace_back(stored_chunk_id);
-      continue;
+      if (!chunk || !chunk->has_mvcc_data() ||
+          std::none_of(_chunk_pruning_column_ids.begin(), _chunk_pruning_column_ids.end(), [&](const auto column_id) {
+            return chunk->mvcc_data()->column_versions.has_stale_pruning_statistics(column_id);
+          })) {
+        excluded_chunk_ids.emplace_back(stored_chunk_id);
+        continue;
+      }
     }
 
-    const auto chunk = stored_table->get_chunk(stored_chunk_id);
-
     // Skip chunks that were physically deleted
     if (!chunk) {
       excluded_chunk_ids.emplace_back(stored_chunk_id);
@@ -155,6 +165,11 @@ std::shared_ptr<const Table> GetTable::_on_execute() {
   /**
    * Build the output Table, omitting pruned Chunks and Columns as well as deleted Chunks
    */
+  const auto transaction_id =
+      transaction_context_is_set() ? transaction_context()->transaction_id() : INVALID_TRANSACTION_ID;
+  const auto snapshot_commit_id = transaction_context_is_set() ? transaction_context()->snapshot_commit_id()
+                                                               : Hyrise::get().transaction_manager.last_commit_id();
+
   auto output_chunks = std::vector<std::shared_ptr<Chunk>>{chunk_count - excluded_chunk_ids.size()};
   auto output_chunks_iter = output_chunks.begin();
 
@@ -175,7 +190,13 @@ std::shared_ptr<const Table> GetTable::_on_execute() {
     const auto& current_chunk_order = stored_chunk->ordered_by();
     std::optional<std::pair<ColumnID, OrderByMode>> adapted_chunk_order;
 
-    if (_pruned_column_ids.empty()) {
+    // For columns with values that were updated in place (see ColumnVersionStore), the values that are visible to
+    // this transaction are overlaid on the stored segments (see VersionedSegment)
+    const auto versioned_column_ids = stored_chunk->has_mvcc_data()
+                                          ? stored_chunk->mvcc_data()->column_versions.versioned_column_ids()
+                                          : std::vector<ColumnID>{};
+
+    if (_pruned_column_ids.empty() && versioned_column_ids.empty()) {
       *output_chunks_iter = stored_chunk;
     } else {
       auto output_segments = Segments{stored_table->column_count() - _pruned_column_ids.size()};
@@ -190,13 +211,22 @@ std::shared_ptr<const Table> GetTable::_on_execute() {
           continue;
         }
 
-        if (current_chunk_order && current_chunk_order->first == stored_column_id) {
+        if (std::binary_search(versioned_column_ids.begin(), versioned_column_ids.end(), stored_column_id)) {
+          *output_segments_iter = stored_chunk->mvcc_data()->column_versions.visible_segment(
+              *stored_chunk, stored_column_id, stored_table->column_data_type(stored_column_id), transaction_id,
+              snapshot_commit_id);
+        } else {
+          *output_segments_iter = stored_chunk->get_segment(stored_column_id);
+        }
+
+        // The order is lost if the values of the sorted column were replaced
+        if (current_chunk_order && current_chunk_order->first == stored_column_id &&
+            *output_segments_iter == stored_chunk->get_segment(stored_column_id)) {
           const auto columns_pruned_so_far = std::distance(_pruned_column_ids.begin(), pruned_column_ids_iter);
           adapted_chunk_order = {ColumnID{static_cast<uint16_t>(stored_column_id - columns_pruned_so_far)},
                                  current_chunk_order->second};
         }
 
-        *output_segments_iter = stored_chunk->get_segment(stored_column_id);
         auto indexes = stored_chunk->get_indexes({*output_segments_iter});
         if (!indexes.empty()) {
           output_indexes.insert(std::end(output_indexes), std::begin(indexes), std::end(indexes));
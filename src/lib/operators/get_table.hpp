@@ -23,9 +23,11 @@ class GetTable : public AbstractReadOnlyOperator {
   // Convenience constructor without pruning info
   explicit GetTable(const std::string& name);
 
-  // Constructor with pruning info
+  // Constructor with pruning info. If chunk_pruning_column_ids is given, a pruned chunk is kept if the values of one
+  // of these columns were updated in place after the chunk was pruned (see StoredTableNode::chunk_pruning_column_ids).
   GetTable(const std::string& name, const std::vector<ChunkID>& pruned_chunk_ids,
-           const std::vector<ColumnID>& pruned_column_ids);
+           const std::vector<ColumnID>& pruned_column_ids,
+           const std::vector<ColumnID>& chunk_pruning_column_ids = {});
 
   const std::string& name() const override;
   std::string description(DescriptionMode description_mode) const override;
@@ -33,6 +35,7 @@ class GetTable : public AbstractReadOnlyOperator {
   const std::string& table_name() const;
   const std::vector<ChunkID>& pruned_chunk_ids() const;
   const std::vector<ColumnID>& pruned_column_ids() const;
+  const std::vector<ColumnID>& chunk_pruning_column_ids() const;
 
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_input_left,
@@ -46,5 +49,6 @@ class GetTable : public AbstractReadOnlyOperator {
   const std::string _name;
   const std::vector<ChunkID> _pruned_chunk_ids;
   const std::vector<ColumnID> _pruned_column_ids;
+  const std::vector<ColumnID> _chunk_pruning_column_ids;
 };
 }  // namespace opossum
@@ -3,6 +3,7 @@
 #include <boost/algorithm/string.hpp>
 
 #include "hyrise.hpp"
+#include "import_export/arrow/arrow_ipc_parser.hpp"
 #include "import_export/binary/binary_parser.hpp"
 #include "import_export/csv/csv_parser.hpp"
 #include "utils/assert.hpp"
@@ -46,6 +47,9 @@ std::shared_ptr<const Table> Import::_on_execute() {
     case FileType::Binary:
       table = BinaryParser::parse(filename);
       break;
+    case FileType::Arrow:
+      table = ArrowIpcParser::parse(filename);
+      break;
     case FileType::Auto:
       Fail("File type should have been determined previously.");
   }
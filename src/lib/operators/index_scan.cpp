@@ -6,10 +6,13 @@
 
 #include "hyrise.hpp"
 
+#include "operators/get_table.hpp"
+
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/job_task.hpp"
 
 #include "storage/index/abstract_index.hpp"
+#include "storage/index/table_hash/table_hash_index.hpp"
 #include "storage/reference_segment.hpp"
 
 #include "utils/assert.hpp"
@@ -24,7 +27,17 @@ IndexScan::IndexScan(const std::shared_ptr<const AbstractOperator>& in, const Se
       _left_column_ids{left_column_ids},
       _predicate_condition{predicate_condition},
       _right_values{right_values},
-      _right_values2{right_values2} {}
+      _right_values2{right_values2},
+      _uses_table_hash_index{false} {}
+
+IndexScan::IndexScan(const std::shared_ptr<const AbstractOperator>& in, const std::vector<ColumnID>& left_column_ids,
+                     const std::vector<AllTypeVariant>& right_values)
+    : AbstractReadOnlyOperator{OperatorType::IndexScan, in},
+      _index_type{SegmentIndexType::Invalid},
+      _left_column_ids{left_column_ids},
+      _predicate_condition{PredicateCondition::Equals},
+      _right_values{right_values},
+      _uses_table_hash_index{true} {}
 
 const std::string& IndexScan::name() const {
   static const auto name = std::string{"IndexScan"};
@@ -36,6 +49,8 @@ std::shared_ptr<const Table> IndexScan::_on_execute() {
 
   _validate_input();
 
+  if (_uses_table_hash_index) return _lookup_table_hash_index();
+
   _out_table = std::make_shared<Table>(_in_table->column_definitions(), TableType::References);
 
   std::mutex output_mutex;
@@ -67,6 +82,9 @@ std::shared_ptr<const Table> IndexScan::_on_execute() {
 std::shared_ptr<AbstractOperator> IndexScan::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
+  if (_uses_table_hash_index) {
+    return std::make_shared<IndexScan>(copied_input_left, _left_column_ids, _right_values);
+  }
   return std::make_shared<IndexScan>(copied_input_left, _index_type, _left_column_ids, _predicate_condition,
                                      _right_values, _right_values2);
 }
@@ -109,6 +127,11 @@ void IndexScan::_validate_input() {
   }
 
   Assert(_in_table->type() == TableType::Data, "IndexScan only supports persistent tables right now.");
+
+  if (_uses_table_hash_index) {
+    Assert(_predicate_condition == PredicateCondition::Equals, "TableHashIndex only supports equality lookups.");
+    Assert(std::dynamic_pointer_cast<const GetTable>(input_left()), "TableHashIndex lookups require GetTable input.");
+  }
 }
 
 RowIDPosList IndexScan::_scan_chunk(const ChunkID chunk_id) {
@@ -201,4 +224,57 @@ RowIDPosList IndexScan::_scan_chunk(const ChunkID chunk_id) {
   return matches_out;
 }
 
+std::shared_ptr<const Table> IndexScan::_lookup_table_hash_index() {
+  const auto get_table = std::static_pointer_cast<const GetTable>(input_left());
+  const auto stored_table = Hyrise::get().storage_manager.get_table(get_table->table_name());
+
+  // Map the columns of the GetTable output to the columns of the stored table
+  const auto& pruned_column_ids = get_table->pruned_column_ids();
+  auto stored_column_ids = std::vector<ColumnID>{};
+  stored_column_ids.reserve(_in_table->column_count());
+  for (auto stored_column_id = ColumnID{0}; stored_column_id < stored_table->column_count(); ++stored_column_id) {
+    if (!std::binary_search(pruned_column_ids.begin(), pruned_column_ids.end(), stored_column_id)) {
+      stored_column_ids.emplace_back(stored_column_id);
+    }
+  }
+
+  auto index_column_ids = std::vector<ColumnID>{};
+  index_column_ids.reserve(_left_column_ids.size());
+  for (const auto column_id : _left_column_ids) {
+    index_column_ids.emplace_back(stored_column_ids[column_id]);
+  }
+
+  const auto index = stored_table->get_table_hash_index(index_column_ids);
+  Assert(index, "TableHashIndex on the specified columns not found.");
+
+  auto row_ids = index->lookup(_right_values);
+
+  // Do not return rows that the GetTable would not have returned either. Rows of chunks that the GetTable skipped
+  // because they were (logically) deleted are not visible anyway and are removed by the Validate operator.
+  const auto& pruned_chunk_ids = get_table->pruned_chunk_ids();
+  row_ids.erase(std::remove_if(row_ids.begin(), row_ids.end(),
+                               [&](const auto& row_id) {
+                                 return std::binary_search(pruned_chunk_ids.begin(), pruned_chunk_ids.end(),
+                                                           row_id.chunk_id) ||
+                                        !stored_table->get_chunk(row_id.chunk_id);
+                               }),
+                row_ids.end());
+
+  _out_table = std::make_shared<Table>(_in_table->column_definitions(), TableType::References);
+  if (row_ids.empty()) return _out_table;
+
+  // Keep the output in the order of the stored table, as a TableScan would
+  std::sort(row_ids.begin(), row_ids.end());
+  const auto matches_out = std::make_shared<RowIDPosList>(row_ids.begin(), row_ids.end());
+  if (row_ids.front().chunk_id == row_ids.back().chunk_id) matches_out->guarantee_single_chunk();
+
+  auto segments = Segments{};
+  for (auto column_id = ColumnID{0}; column_id < _in_table->column_count(); ++column_id) {
+    segments.push_back(std::make_shared<ReferenceSegment>(stored_table, stored_column_ids[column_id], matches_out));
+  }
+  _out_table->append_chunk(segments);
+
+  return _out_table;
+}
+
 }  // namespace opossum
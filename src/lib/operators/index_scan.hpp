@@ -18,6 +18,10 @@ class AbstractTask;
  * Operator that performs a predicate search using indexes
  *
  * Note: Scans only the set of chunks passed to the constructor
+ *
+ * If constructed without a SegmentIndexType, the IndexScan performs an equality lookup on the TableHashIndex of the
+ * stored table instead of using the chunk indexes. In that case, the input has to be a GetTable operator and the
+ * output references the stored table. Rows of chunks pruned by the GetTable are not returned.
  */
 class IndexScan : public AbstractReadOnlyOperator {
  public:
@@ -25,6 +29,10 @@ class IndexScan : public AbstractReadOnlyOperator {
             const std::vector<ColumnID>& left_column_ids, const PredicateCondition predicate_condition,
             const std::vector<AllTypeVariant>& right_values, const std::vector<AllTypeVariant>& right_values2 = {});
 
+  // Point lookup `left_column_ids[i] = right_values[i]` for all i using the TableHashIndex on these columns
+  IndexScan(const std::shared_ptr<const AbstractOperator>& in, const std::vector<ColumnID>& left_column_ids,
+            const std::vector<AllTypeVariant>& right_values);
+
   const std::string& name() const final;
 
   // If set, only the specified chunks will be scanned. See TableScan::excluded_chunk_ids for usage.
@@ -41,6 +49,7 @@ class IndexScan : public AbstractReadOnlyOperator {
   void _validate_input();
   std::shared_ptr<AbstractTask> _create_job_and_schedule(const ChunkID chunk_id, std::mutex& output_mutex);
   RowIDPosList _scan_chunk(const ChunkID chunk_id);
+  std::shared_ptr<const Table> _lookup_table_hash_index();
 
  private:
   const SegmentIndexType _index_type;
@@ -48,6 +57,7 @@ class IndexScan : public AbstractReadOnlyOperator {
   const PredicateCondition _predicate_condition;
   const std::vector<AllTypeVariant> _right_values;
   const std::vector<AllTypeVariant> _right_values2;
+  const bool _uses_table_hash_index;
 
   std::shared_ptr<const Table> _in_table;
   std::shared_ptr<Table> _out_table;
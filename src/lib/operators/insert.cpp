@@ -9,6 +9,7 @@
 #include "hyrise.hpp"
 #include "resolve_type.hpp"
 #include "storage/base_encoded_segment.hpp"
+#include "storage/index/table_hash/table_hash_index.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/value_segment.hpp"
 #include "utils/assert.hpp"
@@ -213,9 +214,77 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
     }
   }
 
+  /**
+   * 3. Add the new rows to the TableHashIndexes of the target Table. Until the transaction commits, the rows are
+   *    invisible to other transactions and are filtered when validating the lookup results. If the transaction is
+   *    rolled back, the entries remain until the chunk is physically deleted.
+   */
+  for (const auto& table_hash_index : _target_table->table_hash_indexes()) {
+    for (const auto& target_chunk_range : _target_chunk_ranges) {
+      const auto target_chunk = _target_table->get_chunk(target_chunk_range.chunk_id);
+      table_hash_index->insert_rows(*target_chunk, target_chunk_range.chunk_id, target_chunk_range.begin_chunk_offset,
+                                    target_chunk_range.end_chunk_offset);
+    }
+  }
+
+  /**
+   * 4. Check the enforced unique constraints of the target Table. As the new rows were added to the TableHashIndexes
+   *    before, two transactions that concurrently insert the same key always see each other's rows. Any other row with
+   *    the same key that might still be (or become) visible is treated as a conflict, so that the transaction is
+   *    rolled back.
+   */
+  if (!_satisfies_unique_constraints(context->transaction_id())) {
+    _mark_as_failed();
+  }
+
   return nullptr;
 }
 
+bool Insert::_satisfies_unique_constraints(const TransactionID transaction_id) const {
+  for (const auto& constraint : _target_table->get_unique_constraints()) {
+    if (constraint.is_enforced == IsEnforced::No) continue;
+
+    const auto table_hash_index = _target_table->get_table_hash_index(constraint.columns);
+    Assert(table_hash_index, "Enforced constraint is not backed by a TableHashIndex");
+
+    for (const auto& target_chunk_range : _target_chunk_ranges) {
+      const auto target_chunk = _target_table->get_chunk(target_chunk_range.chunk_id);
+      const auto keys = table_hash_index->materialize_keys(*target_chunk, target_chunk_range.begin_chunk_offset,
+                                                           target_chunk_range.end_chunk_offset);
+
+      for (auto chunk_offset = target_chunk_range.begin_chunk_offset;
+           chunk_offset < target_chunk_range.end_chunk_offset; ++chunk_offset) {
+        // Rows with NULL values are neither indexed nor constrained
+        const auto& key = keys[chunk_offset - target_chunk_range.begin_chunk_offset];
+        if (!key) continue;
+
+        const auto inserted_row_id = RowID{target_chunk_range.chunk_id, chunk_offset};
+        for (const auto& row_id : table_hash_index->lookup(*key)) {
+          if (row_id == inserted_row_id) continue;
+
+          const auto chunk = _target_table->get_chunk(row_id.chunk_id);
+          if (!chunk) continue;
+
+          // Rows that are deleted (committed or rolled back), deleted by this transaction, or inserted and deleted
+          // again by this transaction (tid reset to INVALID_TRANSACTION_ID by Delete) do not conflict. All other rows
+          // are either visible, inserted by this transaction, or being inserted/deleted by a concurrent transaction.
+          const auto& mvcc_data = chunk->mvcc_data();
+          if (mvcc_data->get_end_cid(row_id.chunk_offset) != MvccData::MAX_COMMIT_ID) continue;
+
+          const auto row_tid = mvcc_data->get_tid(row_id.chunk_offset);
+          const auto begin_cid = mvcc_data->get_begin_cid(row_id.chunk_offset);
+          if (row_tid == transaction_id && begin_cid != MvccData::MAX_COMMIT_ID) continue;
+          if (row_tid == INVALID_TRANSACTION_ID && begin_cid == MvccData::MAX_COMMIT_ID) continue;
+
+          return false;
+        }
+      }
+    }
+  }
+
+  return true;
+}
+
 void Insert::_on_commit_records(const CommitID cid) {
   for (const auto& target_chunk_range : _target_chunk_ranges) {
     const auto target_chunk = _target_table->get_chunk(target_chunk_range.chunk_id);
@@ -227,9 +296,13 @@ void Insert::_on_commit_records(const CommitID cid) {
       mvcc_data->set_tid(chunk_offset, 0u, std::memory_order_relaxed);
     }
 
+    mvcc_data->update_last_commit_id(cid);
+
     // This fence ensures that the changes to TID (which are not sequentially consistent) are visible to other threads.
     std::atomic_thread_fence(std::memory_order_release);
   }
+
+  _target_table->update_last_commit_id(cid);
 }
 
 void Insert::_on_rollback_records() {
@@ -36,6 +36,9 @@ class Insert : public AbstractReadWriteOperator {
   void _on_rollback_records() override;
 
  private:
+  // Checks the inserted rows against the enforced unique constraints of the target table
+  bool _satisfies_unique_constraints(const TransactionID transaction_id) const;
+
   const std::string _target_table_name;
 
   // Ranges of rows to which the inserted values are written
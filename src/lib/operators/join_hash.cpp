@@ -13,6 +13,7 @@
 #include "hyrise.hpp"
 #include "join_hash/join_hash_steps.hpp"
 #include "join_hash/join_hash_traits.hpp"
+#include "memory/memory_tracker.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/job_task.hpp"
 #include "type_comparison.hpp"
@@ -187,6 +188,16 @@ std::shared_ptr<const Table> JoinHash::_on_execute() {
         if (!_radix_bits) {
           _radix_bits =
               calculate_radix_bits<BuildColumnDataType>(build_input_table->row_count(), probe_input_table->row_count());
+
+          // Radix partitioning copies both materialized inputs. If the statement's memory limit does not leave room
+          // for that copy, we rather accept cache misses in a large hash table than failing the statement.
+          const auto radix_partitioning_memory =
+              build_input_table->row_count() * sizeof(PartitionedElement<BuildColumnDataType>) +
+              probe_input_table->row_count() * sizeof(PartitionedElement<ProbeColumnDataType>);
+          if (*_radix_bits > 0 && MemoryTrackingScope::exceeds_available_memory(radix_partitioning_memory)) {
+            PerformanceWarning("Memory limit prevents radix partitioning in hash join");
+            _radix_bits = 0;
+          }
         }
 
         // It needs to be ensured that the build partition does not get too large, because the
@@ -338,6 +349,9 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
           build_side_bloom_filter);
     }
 
+    // Stop between the phases if the statement exceeded its memory limit in the meantime (see MemoryTracker)
+    MemoryTrackingScope::abort_if_limit_exceeded();
+
     /**
      * 2. Perform radix partitioning for build and probe sides. The bloom filters are not used in this step. Future work
      *    could use them on the build side to exclude them for values that are not seen on the probe side. That would
@@ -386,6 +400,8 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
       radix_probe_column = std::move(materialized_probe_column);
     }
 
+    MemoryTrackingScope::abort_if_limit_exceeded();
+
     /**
      * 3. Build hash tables.
      *    In the case of semi or anti joins, we do not need to track all rows on the hashed side, just one per value.
@@ -404,6 +420,8 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
                                                        probe_side_bloom_filter);
     }
 
+    MemoryTrackingScope::abort_if_limit_exceeded();
+
     // Short cut for AntiNullAsTrue
     //   If there is any NULL value on the build side, do not bother probing as no tuples can be emitted
     //   anyway (as long as JoinHash/AntiNullAsTrue doesn't support secondary predicates). Doing this early out
@@ -428,12 +446,16 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     build_side_pos_lists.resize(partition_count);
     probe_side_pos_lists.resize(partition_count);
 
-    // simple heuristic: half of the rows of the probe relation will match
+    // simple heuristic: half of the rows of the probe relation will match. The reservation is skipped if it might
+    // exceed the memory limit of the statement.
     const size_t result_rows_per_partition =
         _probe_input_table->row_count() > 0 ? _probe_input_table->row_count() / partition_count / 2 : 0;
-    for (size_t i = 0; i < partition_count; i++) {
-      build_side_pos_lists[i].reserve(result_rows_per_partition);
-      probe_side_pos_lists[i].reserve(result_rows_per_partition);
+    const auto reserved_memory = 2 * partition_count * result_rows_per_partition * sizeof(RowID);
+    if (!MemoryTrackingScope::exceeds_available_memory(reserved_memory)) {
+      for (size_t i = 0; i < partition_count; i++) {
+        build_side_pos_lists[i].reserve(result_rows_per_partition);
+        probe_side_pos_lists[i].reserve(result_rows_per_partition);
+      }
     }
 
     switch (_mode) {
@@ -476,6 +498,8 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     radix_build_column.clear();
     radix_probe_column.clear();
 
+    MemoryTrackingScope::abort_if_limit_exceeded();
+
     /**
      * 5. Write output Table
      */
@@ -48,15 +48,17 @@ struct PartitionedElement {
 template <typename T>
 struct Partition {
   // Initializing the partition vector takes some time. This is not necessary, because it will be overwritten anyway.
-  // The uninitialized_vector behaves like a regular std::vector, but the entries are initially invalid.
-  std::conditional_t<std::is_trivially_destructible_v<T>, uninitialized_vector<PartitionedElement<T>>,
-                     std::vector<PartitionedElement<T>>>
+  // The uninitialized_vector behaves like a regular std::vector, but the entries are initially invalid. Both use the
+  // default memory resource so that the materialized data is accounted for by the MemoryTracker.
+  std::conditional_t<std::is_trivially_destructible_v<T>,
+                     uninitialized_vector<PartitionedElement<T>, PolymorphicAllocator<PartitionedElement<T>>>,
+                     pmr_vector<PartitionedElement<T>>>
       elements;
 
   // Bit vector to store NULL flags - not using uninitialized_vector because it is not specialized for bool.
   // It is stored independently of the elements as adding a single bit to PartitionedElement would cause memory waste
   // due to padding.
-  std::vector<bool> null_values;
+  pmr_vector<bool> null_values;
 };
 
 // This alias is used in two phases:
@@ -81,7 +83,8 @@ class PosHashTable {
   // of the offset does not limit the number of rows in the partition but the number of distinct values. If we end up
   // with a partition that has more values, the partitioning algorithm is at fault.
   using Offset = uint32_t;
-  using HashTable = ska::bytell_hash_map<HashedType, Offset>;
+  using HashTable = ska::bytell_hash_map<HashedType, Offset, std::hash<HashedType>, std::equal_to<HashedType>,
+                                         PolymorphicAllocator<std::pair<HashedType, Offset>>>;
 
   // The small_vector holds the first n values in local storage and only resorts to heap storage after that. 1 is chosen
   // as n because in many cases, we join on primary key attributes where by definition we have only one match on the
@@ -142,7 +145,7 @@ class PosHashTable {
 
   // For a value seen on the probe side, return an iterator into the matching positions on the build side
   template <typename InputType>
-  const std::vector<SmallPosList>::const_iterator find(const InputType& value) const {
+  const pmr_vector<SmallPosList>::const_iterator find(const InputType& value) const {
     DebugAssert(_mode == JoinHashBuildMode::AllPositions, "find is invalid for SinglePosition mode, use contains");
 
     const auto casted_value = static_cast<HashedType>(value);
@@ -172,13 +175,13 @@ class PosHashTable {
     }
   }
 
-  const std::vector<SmallPosList>::const_iterator begin() const { return _pos_lists.begin(); }
+  const pmr_vector<SmallPosList>::const_iterator begin() const { return _pos_lists.begin(); }
 
-  const std::vector<SmallPosList>::const_iterator end() const { return _pos_lists.end(); }
+  const pmr_vector<SmallPosList>::const_iterator end() const { return _pos_lists.end(); }
 
  private:
   HashTable _hash_table;
-  std::vector<SmallPosList> _pos_lists;
+  pmr_vector<SmallPosList> _pos_lists;
   JoinHashBuildMode _mode;
   std::optional<std::vector<std::pair<HashedType, Offset>>> _values{std::nullopt};
 };
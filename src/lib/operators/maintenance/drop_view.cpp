@@ -26,9 +26,13 @@ std::shared_ptr<AbstractOperator> DropView::_on_deep_copy(
 void DropView::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
 
 std::shared_ptr<const Table> DropView::_on_execute() {
+  auto& storage_manager = Hyrise::get().storage_manager;
+
   // If IF EXISTS is not set and the view is not found, StorageManager throws an exception
-  if (!if_exists || Hyrise::get().storage_manager.has_view(view_name)) {
-    Hyrise::get().storage_manager.drop_view(view_name);
+  if (storage_manager.has_materialized_view(view_name)) {
+    storage_manager.drop_materialized_view(view_name);
+  } else if (!if_exists || storage_manager.has_view(view_name)) {
+    storage_manager.drop_view(view_name);
   }
 
   return std::make_shared<Table>(TableColumnDefinitions{{"OK", DataType::Int, false}}, TableType::Data);  // Dummy table
@@ -2,6 +2,7 @@
 
 #include <string>
 
+#include "utils/format_bytes.hpp"
 #include "utils/format_duration.hpp"
 
 namespace opossum {
@@ -14,12 +15,19 @@ void OperatorPerformanceData::output_to_stream(std::ostream& stream, Description
 
   if (!has_output) {
     stream << "executed, but no output";
-    return;
+  } else {
+    stream << output_row_count << " row(s) in ";
+    stream << output_chunk_count << " chunk(s), ";
+    stream << format_duration(std::chrono::duration_cast<std::chrono::nanoseconds>(walltime));
+  }
+
+  if (peak_memory_usage > 0) {
+    stream << ", " << format_bytes(peak_memory_usage) << " peak memory";
   }
 
-  stream << output_row_count << " row(s) in ";
-  stream << output_chunk_count << " chunk(s), ";
-  stream << format_duration(std::chrono::duration_cast<std::chrono::nanoseconds>(walltime));
+  if (hardware_counters) {
+    stream << ", " << *hardware_counters;
+  }
 }
 
 std::ostream& operator<<(std::ostream& stream, const OperatorPerformanceData& performance_data) {
@@ -2,9 +2,11 @@
 
 #include <chrono>
 #include <iostream>
+#include <optional>
 #include <string>
 
 #include "types.hpp"
+#include "utils/hardware_counters.hpp"
 
 namespace opossum {
 
@@ -22,6 +24,14 @@ struct OperatorPerformanceData : public Noncopyable {
   uint64_t output_row_count{0};
   uint64_t output_chunk_count{0};
 
+  // Peak of the memory allocated through the default memory resource by the operator and its JobTasks while it was
+  // executed, including its output (see MemoryTracker). Only measured if the statement that executes the operator
+  // tracks its memory.
+  size_t peak_memory_usage{0};
+
+  // Only set if HardwareCounters are enabled and available. Includes the JobTasks spawned by the operator.
+  std::optional<HardwareCounters> hardware_counters;
+
   virtual void output_to_stream(std::ostream& stream,
                                 DescriptionMode description_mode = DescriptionMode::SingleLine) const;
 };
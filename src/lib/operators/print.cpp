@@ -11,10 +11,12 @@
 
 #include "constant_mappings.hpp"
 #include "operators/table_wrapper.hpp"
+#include "resolve_type.hpp"
 #include "storage/base_encoded_segment.hpp"
 #include "storage/base_segment.hpp"
 #include "storage/base_value_segment.hpp"
 #include "storage/reference_segment.hpp"
+#include "storage/versioned_segment.hpp"
 #include "utils/performance_warning.hpp"
 
 namespace {
@@ -219,6 +221,14 @@ std::string Print::_segment_type(const std::shared_ptr<BaseSegment>& segment) {
         segment_type += "LZ4";
         break;
       }
+      case EncodingType::FSST: {
+        segment_type += "FSS";
+        break;
+      }
+      case EncodingType::FrontCodedDictionary: {
+        segment_type += "FCD";
+        break;
+      }
     }
     if (encoded_segment->compressed_vector_type()) {
       switch (*encoded_segment->compressed_vector_type()) {
@@ -241,7 +251,13 @@ std::string Print::_segment_type(const std::shared_ptr<BaseSegment>& segment) {
       }
     }
   } else {
-    Fail("Unknown segment type");
+    auto is_versioned_segment = false;
+    resolve_data_type(segment->data_type(), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      is_versioned_segment = static_cast<bool>(std::dynamic_pointer_cast<VersionedSegment<ColumnDataType>>(segment));
+    });
+    Assert(is_versioned_segment, "Unknown segment type");
+    segment_type += "VerS";
   }
   segment_type += ">";
   return segment_type;
@@ -102,7 +102,7 @@ std::shared_ptr<const Table> Projection::_on_execute() {
           const auto reference_segment = std::dynamic_pointer_cast<ReferenceSegment>(segment);
           DebugAssert(reference_segment, "Expected ReferenceSegment");
 
-          // If the ReferenceSegment references a single (FixedString)DictionarySegment, do not materialize it as a
+          // If the ReferenceSegment references a single dictionary-encoded segment, do not materialize it as a
           // ValueSegment, but re-use its dictionary and only copy the value ids.
           auto referenced_dictionary_segment = std::shared_ptr<BaseDictionarySegment>{};
 
@@ -115,7 +115,8 @@ std::shared_ptr<const Table> Projection::_on_execute() {
           }
 
           if (referenced_dictionary_segment) {
-            // Resolving the BaseDictionarySegment so that we can handle both regular and fixed-string dictionaries
+            // Resolving the BaseDictionarySegment so that we can handle regular, fixed-string, and front-coded
+            // dictionaries
             resolve_encoded_segment_type<ColumnDataType>(
                 *referenced_dictionary_segment, [&](const auto& typed_segment) {
                   using DictionarySegmentType = std::decay_t<decltype(typed_segment)>;
@@ -153,6 +154,14 @@ std::shared_ptr<const Table> Projection::_on_execute() {
 
                     output_segments[column_id] = std::make_shared<FixedStringDictionarySegment<ColumnDataType>>(
                         dictionary, std::move(compressed_attribute_vector));
+                  } else if constexpr (std::is_same_v<DictionarySegmentType,  // NOLINT - lint.sh wants {} on same line
+                                                      FrontCodedDictionarySegment<ColumnDataType>>) {
+                    const auto compressed_attribute_vector =
+                        materialize_filtered_attribute_vector(typed_segment, pos_list);
+                    const auto& dictionary = typed_segment.front_coded_dictionary();
+
+                    output_segments[column_id] = std::make_shared<FrontCodedDictionarySegment<ColumnDataType>>(
+                        dictionary, std::move(compressed_attribute_vector));
                   } else {
                     Fail("Referenced segment was dynamically casted to BaseDictionarySegment, but resolve failed");
                   }
@@ -5,9 +5,11 @@
 #include <type_traits>
 
 #include "expression/between_expression.hpp"
+#include "lz4_block_scan.hpp"
 #include "sorted_segment_search.hpp"
 #include "storage/chunk.hpp"
 #include "storage/create_iterable_from_segment.hpp"
+#include "storage/lz4_segment.hpp"
 #include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/table.hpp"
@@ -44,6 +46,9 @@ void ColumnBetweenTableScanImpl::_scan_non_reference_segment(
     // Select optimized or generic scanning implementation based on segment type
     if (const auto* dictionary_segment = dynamic_cast<const BaseDictionarySegment*>(&segment)) {
       _scan_dictionary_segment(*dictionary_segment, chunk_id, matches, position_filter);
+    } else if (const auto* encoded_segment = dynamic_cast<const BaseEncodedSegment*>(&segment);
+               encoded_segment && encoded_segment->encoding_type() == EncodingType::LZ4 && !position_filter) {
+      _scan_lz4_segment(segment, chunk_id, matches);
     } else {
       _scan_generic_segment(segment, chunk_id, matches, position_filter);
     }
@@ -139,6 +144,43 @@ void ColumnBetweenTableScanImpl::_scan_dictionary_segment(
   });
 }
 
+void ColumnBetweenTableScanImpl::_scan_lz4_segment(const BaseSegment& segment, const ChunkID chunk_id,
+                                                   RowIDPosList& matches) const {
+  resolve_data_type(segment.data_type(), [&](const auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    const auto& lz4_segment = static_cast<const LZ4Segment<ColumnDataType>&>(segment);
+    if (!lz4_segment.block_statistics()) {
+      _scan_generic_segment(segment, chunk_id, matches, nullptr);
+      return;
+    }
+
+    const auto typed_left_value = boost::get<ColumnDataType>(left_value);
+    const auto typed_right_value = boost::get<ColumnDataType>(right_value);
+    const auto lower_inclusive = is_lower_inclusive_between(predicate_condition);
+    const auto upper_inclusive = is_upper_inclusive_between(predicate_condition);
+
+    const auto above_lower_bound = [&](const ColumnDataType& segment_value) {
+      return lower_inclusive ? !(segment_value < typed_left_value) : typed_left_value < segment_value;
+    };
+    const auto below_upper_bound = [&](const ColumnDataType& segment_value) {
+      return upper_inclusive ? !(typed_right_value < segment_value) : segment_value < typed_right_value;
+    };
+
+    // As the range is convex, all values of a block match iff its minimum and maximum match
+    const auto classify_block = [&](const ColumnDataType& minimum, const ColumnDataType& maximum) {
+      if (!above_lower_bound(maximum) || !below_upper_bound(minimum)) return LZ4BlockMatch::None;
+      if (above_lower_bound(minimum) && below_upper_bound(maximum)) return LZ4BlockMatch::All;
+      return LZ4BlockMatch::Some;
+    };
+
+    const auto comparator = [&](const ColumnDataType& segment_value) {
+      return above_lower_bound(segment_value) && below_upper_bound(segment_value);
+    };
+    scan_lz4_segment_blocks(lz4_segment, chunk_id, matches, classify_block, comparator);
+  });
+}
+
 void ColumnBetweenTableScanImpl::_scan_sorted_segment(const BaseSegment& segment, const ChunkID chunk_id,
                                                       RowIDPosList& matches,
                                                       const std::shared_ptr<const AbstractPosList>& position_filter,
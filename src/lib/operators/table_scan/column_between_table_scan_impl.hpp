@@ -43,6 +43,9 @@ class ColumnBetweenTableScanImpl : public AbstractDereferencedColumnTableScanImp
   void _scan_dictionary_segment(const BaseDictionarySegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
                                 const std::shared_ptr<const AbstractPosList>& position_filter) const;
 
+  // Scan on LZ4Segments that skips blocks based on their minima and maxima
+  void _scan_lz4_segment(const BaseSegment& segment, const ChunkID chunk_id, RowIDPosList& matches) const;
+
   void _scan_sorted_segment(const BaseSegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
                             const std::shared_ptr<const AbstractPosList>& position_filter,
                             const OrderByMode order_by_mode) const;
@@ -11,20 +11,33 @@
 #include <vector>
 
 #include "storage/create_iterable_from_segment.hpp"
+#include "storage/fsst_segment.hpp"
 #include "storage/resolve_encoded_segment_type.hpp"
 #include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/value_segment.hpp"
 #include "storage/value_segment/value_segment_iterable.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
 
 namespace opossum {
 
+namespace {
+
+std::optional<pmr_string> prefix_of_pattern(const pmr_string& pattern) {
+  const auto pattern_variant = LikeMatcher::pattern_string_to_pattern_variant(pattern);
+  if (!std::holds_alternative<LikeMatcher::StartsWithPattern>(pattern_variant)) return std::nullopt;
+  return std::get<LikeMatcher::StartsWithPattern>(pattern_variant).string;
+}
+
+}  // namespace
+
 ColumnLikeTableScanImpl::ColumnLikeTableScanImpl(const std::shared_ptr<const Table>& in_table, const ColumnID column_id,
                                                  const PredicateCondition init_predicate_condition,
                                                  const pmr_string& pattern)
     : AbstractDereferencedColumnTableScanImpl{in_table, column_id, init_predicate_condition},
       _matcher{pattern},
-      _invert_results(predicate_condition == PredicateCondition::NotLike) {}
+      _invert_results(predicate_condition == PredicateCondition::NotLike),
+      _prefix{prefix_of_pattern(pattern)} {}
 
 std::string ColumnLikeTableScanImpl::description() const { return "ColumnLike"; }
 
@@ -37,6 +50,9 @@ void ColumnLikeTableScanImpl::_scan_non_reference_segment(
       dictionary_segment &&
       (!position_filter || dictionary_segment->unique_values_count() <= position_filter->size())) {
     _scan_dictionary_segment(*dictionary_segment, chunk_id, matches, position_filter);
+  } else if (const auto* fsst_segment = dynamic_cast<const FSSTSegment<pmr_string>*>(&segment);
+             fsst_segment && _prefix) {
+    _scan_fsst_segment(*fsst_segment, *_prefix, chunk_id, matches, position_filter);
   } else {
     _scan_generic_segment(segment, chunk_id, matches, position_filter);
   }
@@ -76,6 +92,9 @@ void ColumnLikeTableScanImpl::_scan_dictionary_segment(
   if (segment.encoding_type() == EncodingType::Dictionary) {
     const auto& typed_segment = static_cast<const DictionarySegment<pmr_string>&>(segment);
     result = _find_matches_in_dictionary(*typed_segment.dictionary());
+  } else if (segment.encoding_type() == EncodingType::FrontCodedDictionary) {
+    const auto& typed_segment = static_cast<const FrontCodedDictionarySegment<pmr_string>&>(segment);
+    result = _find_matches_in_dictionary(*typed_segment.front_coded_dictionary());
   } else {
     const auto& typed_segment = static_cast<const FixedStringDictionarySegment<pmr_string>&>(segment);
     result = _find_matches_in_dictionary(*typed_segment.fixed_string_dictionary());
@@ -110,6 +129,48 @@ void ColumnLikeTableScanImpl::_scan_dictionary_segment(
   });
 }
 
+void ColumnLikeTableScanImpl::_scan_fsst_segment(
+    const FSSTSegment<pmr_string>& segment, const pmr_string& prefix, const ChunkID chunk_id, RowIDPosList& matches,
+    const std::shared_ptr<const AbstractPosList>& position_filter) const {
+  // Instead of decompressing each value, we only decode codes until the prefix is covered or a mismatch is found.
+  const auto& symbol_table = segment.symbol_table();
+  const auto* compressed_values = segment.compressed_values().data();
+  const auto& null_values = segment.null_values();
+
+  resolve_compressed_vector_type(segment.offsets(), [&](const auto& offsets) {
+    auto offset_decompressor = offsets.create_decompressor();
+
+    const auto row_matches = [&](const ChunkOffset chunk_offset) {
+      if (null_values && (*null_values)[chunk_offset]) return false;
+
+      const auto begin = offset_decompressor.get(chunk_offset);
+      const auto end = offset_decompressor.get(chunk_offset + 1);
+      return symbol_table.starts_with(compressed_values + begin, compressed_values + end, prefix) != _invert_results;
+    };
+
+    if (position_filter) {
+      segment.access_counter[SegmentAccessCounter::access_type(*position_filter)] += position_filter->size();
+
+      auto offset_in_poslist = ChunkOffset{0};
+      for (const auto& row_id : *position_filter) {
+        if (row_matches(row_id.chunk_offset)) {
+          matches.emplace_back(RowID{chunk_id, offset_in_poslist});
+        }
+        ++offset_in_poslist;
+      }
+    } else {
+      segment.access_counter[SegmentAccessCounter::AccessType::Sequential] += segment.size();
+
+      const auto segment_size = segment.size();
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment_size; ++chunk_offset) {
+        if (row_matches(chunk_offset)) {
+          matches.emplace_back(RowID{chunk_id, chunk_offset});
+        }
+      }
+    }
+  });
+}
+
 template <typename D>
 std::pair<size_t, std::vector<bool>> ColumnLikeTableScanImpl::_find_matches_in_dictionary(const D& dictionary) const {
   auto result = std::pair<size_t, std::vector<bool>>{};
@@ -2,6 +2,7 @@
 
 #include <map>
 #include <memory>
+#include <optional>
 #include <regex>
 #include <string>
 #include <utility>
@@ -17,6 +18,9 @@ namespace opossum {
 
 class Table;
 
+template <typename T>
+class FSSTSegment;
+
 /**
  * @brief Implements a column scan using the LIKE operator
  *
@@ -25,6 +29,7 @@ class Table;
  * - For dictionary segments, we check the values in the dictionary and store the matches in a vector
  *   in order to avoid having to look up each value ID of the attribute vector in the dictionary. This also
  *   enables us to detect if all or none of the values in the segment satisfy the expression.
+ * - For FSST segments and prefix patterns (e.g., 'abc%'), only the codes needed to cover the prefix are decoded
  *
  * Performance Notes: Uses std::regex as a slow fallback and resorts to much faster Pattern matchers for special cases,
  *                    e.g., StartsWithPattern. 
@@ -44,6 +49,8 @@ class ColumnLikeTableScanImpl : public AbstractDereferencedColumnTableScanImpl {
                              const std::shared_ptr<const AbstractPosList>& position_filter) const;
   void _scan_dictionary_segment(const BaseDictionarySegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
                                 const std::shared_ptr<const AbstractPosList>& position_filter) const;
+  void _scan_fsst_segment(const FSSTSegment<pmr_string>& segment, const pmr_string& prefix, const ChunkID chunk_id,
+                          RowIDPosList& matches, const std::shared_ptr<const AbstractPosList>& position_filter) const;
 
   /**
    * Used for dictionary segments
@@ -56,6 +63,9 @@ class ColumnLikeTableScanImpl : public AbstractDereferencedColumnTableScanImpl {
 
   // For NOT LIKE support
   const bool _invert_results;
+
+  // Set if the pattern is a simple prefix pattern (e.g., 'abc%'), used for FSST segments
+  const std::optional<pmr_string> _prefix;
 };
 
 }  // namespace opossum
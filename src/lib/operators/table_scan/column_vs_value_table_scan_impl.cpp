@@ -1,15 +1,20 @@
 #include "column_vs_value_table_scan_impl.hpp"
 
+#include <cstring>
 #include <memory>
 #include <utility>
 #include <vector>
 
+#include "lz4_block_scan.hpp"
 #include "sorted_segment_search.hpp"
 #include "storage/base_dictionary_segment.hpp"
 #include "storage/create_iterable_from_segment.hpp"
+#include "storage/fsst_segment.hpp"
+#include "storage/lz4_segment.hpp"
 #include "storage/resolve_encoded_segment_type.hpp"
 #include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
 #include "storage/segment_iterate.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
 
 #include "resolve_type.hpp"
 #include "type_comparison.hpp"
@@ -40,6 +45,13 @@ void ColumnVsValueTableScanImpl::_scan_non_reference_segment(
     // Select optimized or generic scanning implementation based on segment type
     if (const auto* dictionary_segment = dynamic_cast<const BaseDictionarySegment*>(&segment)) {
       _scan_dictionary_segment(*dictionary_segment, chunk_id, matches, position_filter);
+    } else if (const auto* fsst_segment = dynamic_cast<const FSSTSegment<pmr_string>*>(&segment);
+               fsst_segment && (predicate_condition == PredicateCondition::Equals ||
+                                predicate_condition == PredicateCondition::NotEquals)) {
+      _scan_fsst_segment(*fsst_segment, chunk_id, matches, position_filter);
+    } else if (const auto* encoded_segment = dynamic_cast<const BaseEncodedSegment*>(&segment);
+               encoded_segment && encoded_segment->encoding_type() == EncodingType::LZ4 && !position_filter) {
+      _scan_lz4_segment(segment, chunk_id, matches);
     } else {
       _scan_generic_segment(segment, chunk_id, matches, position_filter);
     }
@@ -140,6 +152,111 @@ void ColumnVsValueTableScanImpl::_scan_dictionary_segment(
   });
 }
 
+void ColumnVsValueTableScanImpl::_scan_fsst_segment(
+    const FSSTSegment<pmr_string>& segment, const ChunkID chunk_id, RowIDPosList& matches,
+    const std::shared_ptr<const AbstractPosList>& position_filter) const {
+  // The search value is compressed once using the segment's symbol table. Since FSST compression is deterministic, a
+  // stored value equals the search value iff their codes are equal. Thus, no value has to be decompressed.
+  const auto search_codes = segment.compress_value(boost::get<pmr_string>(value));
+  const auto search_codes_size = search_codes.size();
+  const auto* compressed_values = segment.compressed_values().data();
+  const auto& null_values = segment.null_values();
+  const auto expected_result = predicate_condition == PredicateCondition::Equals;
+
+  resolve_compressed_vector_type(segment.offsets(), [&](const auto& offsets) {
+    auto offset_decompressor = offsets.create_decompressor();
+
+    const auto row_matches = [&](const ChunkOffset chunk_offset) {
+      if (null_values && (*null_values)[chunk_offset]) return false;
+
+      const auto begin = offset_decompressor.get(chunk_offset);
+      const auto end = offset_decompressor.get(chunk_offset + 1);
+      const auto codes_equal = end - begin == search_codes_size &&
+                               std::memcmp(compressed_values + begin, search_codes.data(), search_codes_size) == 0;
+      return codes_equal == expected_result;
+    };
+
+    if (position_filter) {
+      segment.access_counter[SegmentAccessCounter::access_type(*position_filter)] += position_filter->size();
+
+      // As for all filtered scans, the chunk offset of a match is its position within the position filter
+      auto offset_in_poslist = ChunkOffset{0};
+      for (const auto& row_id : *position_filter) {
+        if (row_matches(row_id.chunk_offset)) {
+          matches.emplace_back(RowID{chunk_id, offset_in_poslist});
+        }
+        ++offset_in_poslist;
+      }
+    } else {
+      segment.access_counter[SegmentAccessCounter::AccessType::Sequential] += segment.size();
+
+      const auto segment_size = segment.size();
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment_size; ++chunk_offset) {
+        if (row_matches(chunk_offset)) {
+          matches.emplace_back(RowID{chunk_id, chunk_offset});
+        }
+      }
+    }
+  });
+}
+
+void ColumnVsValueTableScanImpl::_scan_lz4_segment(const BaseSegment& segment, const ChunkID chunk_id,
+                                                   RowIDPosList& matches) const {
+  resolve_data_type(segment.data_type(), [&](const auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    const auto& lz4_segment = static_cast<const LZ4Segment<ColumnDataType>&>(segment);
+    if (!lz4_segment.block_statistics()) {
+      _scan_generic_segment(segment, chunk_id, matches, nullptr);
+      return;
+    }
+
+    const auto typed_value = boost::get<ColumnDataType>(value);
+
+    // Decide from a block's minimum and maximum whether none or all of its values satisfy the predicate
+    const auto classify_block = [&](const ColumnDataType& minimum, const ColumnDataType& maximum) {
+      auto matches_none = false;
+      auto matches_all = false;
+      switch (predicate_condition) {
+        case PredicateCondition::Equals:
+          matches_none = typed_value < minimum || maximum < typed_value;
+          matches_all = minimum == typed_value && maximum == typed_value;
+          break;
+        case PredicateCondition::NotEquals:
+          matches_none = minimum == typed_value && maximum == typed_value;
+          matches_all = typed_value < minimum || maximum < typed_value;
+          break;
+        case PredicateCondition::LessThan:
+          matches_none = !(minimum < typed_value);
+          matches_all = maximum < typed_value;
+          break;
+        case PredicateCondition::LessThanEquals:
+          matches_none = typed_value < minimum;
+          matches_all = !(typed_value < maximum);
+          break;
+        case PredicateCondition::GreaterThan:
+          matches_none = !(typed_value < maximum);
+          matches_all = typed_value < minimum;
+          break;
+        case PredicateCondition::GreaterThanEquals:
+          matches_none = maximum < typed_value;
+          matches_all = !(minimum < typed_value);
+          break;
+        default:
+          Fail("Unsupported comparison type encountered");
+      }
+      return matches_none ? LZ4BlockMatch::None : matches_all ? LZ4BlockMatch::All : LZ4BlockMatch::Some;
+    };
+
+    with_comparator(predicate_condition, [&](auto predicate_comparator) {
+      const auto comparator = [&](const ColumnDataType& segment_value) {
+        return predicate_comparator(segment_value, typed_value);
+      };
+      scan_lz4_segment_blocks(lz4_segment, chunk_id, matches, classify_block, comparator);
+    });
+  });
+}
+
 void ColumnVsValueTableScanImpl::_scan_sorted_segment(const BaseSegment& segment, const ChunkID chunk_id,
                                                       RowIDPosList& matches,
                                                       const std::shared_ptr<const AbstractPosList>& position_filter,
@@ -14,6 +14,11 @@
 
 namespace opossum {
 
+template <typename T>
+class FSSTSegment;
+template <typename T>
+class LZ4Segment;
+
 /**
  * @brief Compares one column to a literal (i.e., an AllTypeVariant)
  *
@@ -21,6 +26,8 @@ namespace opossum {
  * - For dictionary segments, we basically look up the value ID of the constant value in the dictionary
  *   in order to avoid having to look up each value ID of the attribute vector in the dictionary. This also
  *   enables us to detect if all or none of the values in the segment satisfy the expression.
+ * - For FSST segments, (in)equality is evaluated on the compressed codes without decompressing the values
+ * - For LZ4 segments, the per-block minima and maxima are used to decompress only blocks that might contain matches
  */
 class ColumnVsValueTableScanImpl : public AbstractDereferencedColumnTableScanImpl {
  public:
@@ -39,6 +46,9 @@ class ColumnVsValueTableScanImpl : public AbstractDereferencedColumnTableScanImp
                              const std::shared_ptr<const AbstractPosList>& position_filter) const;
   void _scan_dictionary_segment(const BaseDictionarySegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
                                 const std::shared_ptr<const AbstractPosList>& position_filter) const;
+  void _scan_fsst_segment(const FSSTSegment<pmr_string>& segment, const ChunkID chunk_id, RowIDPosList& matches,
+                          const std::shared_ptr<const AbstractPosList>& position_filter) const;
+  void _scan_lz4_segment(const BaseSegment& segment, const ChunkID chunk_id, RowIDPosList& matches) const;
 
   void _scan_sorted_segment(const BaseSegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
                             const std::shared_ptr<const AbstractPosList>& position_filter,
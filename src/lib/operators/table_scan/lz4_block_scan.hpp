@@ -0,0 +1,60 @@
+#pragma once
+
+#include "storage/lz4_segment.hpp"
+#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "storage/segment_access_counter.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// Result of comparing a predicate to the minimum and maximum of an LZ4 block
+enum class LZ4BlockMatch { None, All, Some };
+
+/**
+ * Scans an LZ4Segment block by block using its block statistics (see LZ4BlockStatistics). For each block,
+ * classify_block(minimum, maximum) states whether none, all, or possibly some of the block's non-NULL values match.
+ * Only blocks of the latter category are decompressed and scanned with the comparator. The matches are appended in the
+ * order of their chunk offsets. The segment is expected to have block statistics.
+ */
+template <typename T, typename BlockClassifier, typename Comparator>
+void scan_lz4_segment_blocks(const LZ4Segment<T>& segment, const ChunkID chunk_id, RowIDPosList& matches,
+                             const BlockClassifier& classify_block, const Comparator& comparator) {
+  const auto& block_statistics = *segment.block_statistics();
+  const auto& null_values = segment.null_values();
+  const auto block_count = block_statistics.first_chunk_offsets.size();
+
+  for (auto block_index = size_t{0}; block_index < block_count; ++block_index) {
+    const auto begin_chunk_offset = block_statistics.first_chunk_offsets[block_index];
+    const auto end_chunk_offset =
+        block_index + 1 < block_count ? block_statistics.first_chunk_offsets[block_index + 1] : segment.size();
+    const auto null_value_count = block_statistics.null_value_counts[block_index];
+
+    // NULL values never match, so blocks with only NULL values (or no rows at all) can be skipped
+    if (end_chunk_offset - begin_chunk_offset == null_value_count) continue;
+
+    const auto block_match = classify_block(block_statistics.minima[block_index], block_statistics.maxima[block_index]);
+    if (block_match == LZ4BlockMatch::None) continue;
+
+    if (block_match == LZ4BlockMatch::All) {
+      // All non-NULL values match. The NULL values are known without decompressing the block.
+      for (auto chunk_offset = begin_chunk_offset; chunk_offset < end_chunk_offset; ++chunk_offset) {
+        if (null_value_count == 0 || !(*null_values)[chunk_offset]) {
+          matches.emplace_back(RowID{chunk_id, chunk_offset});
+        }
+      }
+      continue;
+    }
+
+    const auto values = segment.decompress_block_values(block_index);
+    segment.access_counter[SegmentAccessCounter::AccessType::Sequential] += end_chunk_offset - begin_chunk_offset;
+
+    for (auto chunk_offset = begin_chunk_offset; chunk_offset < end_chunk_offset; ++chunk_offset) {
+      if (null_value_count > 0 && (*null_values)[chunk_offset]) continue;
+      if (comparator(values[chunk_offset - begin_chunk_offset])) {
+        matches.emplace_back(RowID{chunk_id, chunk_offset});
+      }
+    }
+  }
+}
+
+}  // namespace opossum
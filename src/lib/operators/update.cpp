@@ -1,18 +1,47 @@
 #include "update.hpp"
 
+#include <algorithm>
+#include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "concurrency/transaction_context.hpp"
 #include "delete.hpp"
+#include "expression/pqp_column_expression.hpp"
 #include "hyrise.hpp"
 #include "insert.hpp"
+#include "projection.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/job_task.hpp"
 #include "storage/reference_segment.hpp"
+#include "storage/segment_iterate.hpp"
 #include "table_wrapper.hpp"
 #include "utils/assert.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+template <typename T>
+std::vector<std::optional<T>> materialize_column(const Table& table, const ColumnID column_id) {
+  auto values = std::vector<std::optional<T>>{};
+  values.reserve(table.row_count());
+
+  const auto chunk_count = table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    segment_iterate<T>(*table.get_chunk(chunk_id)->get_segment(column_id), [&](const auto& position) {
+      values.emplace_back(position.is_null() ? std::nullopt : std::optional<T>{position.value()});
+    });
+  }
+
+  return values;
+}
+
+}  // namespace
+
 namespace opossum {
 
 Update::Update(const std::string& table_to_update_name, const std::shared_ptr<AbstractOperator>& fields_to_update_op,
@@ -35,7 +64,21 @@ std::shared_ptr<const Table> Update::_on_execute(std::shared_ptr<TransactionCont
   DebugAssert(input_table_left()->column_data_types() == input_table_right()->column_data_types(),
               "Update required identical layouts from its input tables");
 
-  // 1. Delete obsolete data with the Delete operator.
+  // 1. If the table allows in-place updates, determine the columns whose values are changed. If all of them can be
+  //    updated in place, store the new values in the ColumnVersionStores of the updated chunks. This neither copies
+  //    the unchanged columns nor moves the rows.
+  if (_table_supports_in_place_update(*table_to_update)) {
+    const auto updated_values = _updated_values();
+    if (!updated_values.empty() && _columns_support_in_place_update(*table_to_update, updated_values)) {
+      _table_updated_in_place = table_to_update;
+      if (!_update_in_place(*context, updated_values)) {
+        _mark_as_failed();
+      }
+      return nullptr;
+    }
+  }
+
+  // 2. Otherwise, delete obsolete data with the Delete operator.
   //    Delete doesn't accept empty input data
   if (input_table_left()->row_count() > 0) {
     _delete = std::make_shared<Delete>(_input_left);
@@ -48,15 +91,213 @@ std::shared_ptr<const Table> Update::_on_execute(std::shared_ptr<TransactionCont
     }
   }
 
-  // 2. Insert new data with the Insert operator.
+  // 3. Insert new data with the Insert operator.
   _insert = std::make_shared<Insert>(_table_to_update_name, _input_right);
   _insert->set_transaction_context(context);
   _insert->execute();
-  // Insert cannot fail in the MVCC sense, no check necessary
+
+  // Insert fails if the new data violates an enforced unique constraint
+  if (_insert->execute_failed()) {
+    _mark_as_failed();
+  }
 
   return nullptr;
 }
 
+std::map<ColumnID, std::vector<AllTypeVariant>> Update::_updated_values() const {
+  auto updated_values = std::map<ColumnID, std::vector<AllTypeVariant>>{};
+
+  // The SQLTranslator computes the new values with a Projection on top of the rows to update. Columns that this
+  // Projection forwards unchanged are not set by the update, so their values do not need to be compared. For other
+  // inputs, all columns are compared.
+  const auto projection = std::dynamic_pointer_cast<const Projection>(_input_right);
+  const auto forwards_columns = projection && projection->input_left() == _input_left;
+
+  const auto& left_table = *input_table_left();
+  const auto& right_table = *input_table_right();
+  for (auto column_id = ColumnID{0}; column_id < left_table.column_count(); ++column_id) {
+    if (forwards_columns) {
+      const auto column_expression =
+          std::dynamic_pointer_cast<const PQPColumnExpression>(projection->expressions[column_id]);
+      if (column_expression && column_expression->column_id == column_id) continue;
+    }
+
+    resolve_data_type(left_table.column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      const auto old_values = materialize_column<ColumnDataType>(left_table, column_id);
+      const auto new_values = materialize_column<ColumnDataType>(right_table, column_id);
+      if (old_values == new_values) return;
+
+      auto& column_values = updated_values[column_id];
+      column_values.reserve(new_values.size());
+      for (const auto& value : new_values) {
+        column_values.emplace_back(value ? AllTypeVariant{*value} : NULL_VALUE);
+      }
+    });
+  }
+
+  return updated_values;
+}
+
+bool Update::_table_supports_in_place_update(const Table& table_to_update) const {
+  if (!table_to_update.allows_in_place_updates()) return false;
+
+  // Lookups in TableHashIndexes (and thus enforced constraints) reference the main segments directly
+  if (!table_to_update.table_hash_indexes().empty()) return false;
+
+  // The rows to update are identified by the ReferenceSegments of the first input. They have to reference all columns
+  // of the (unpruned) table in their original order.
+  const auto& left_table = *input_table_left();
+  if (left_table.type() != TableType::References || left_table.column_count() != table_to_update.column_count()) {
+    return false;
+  }
+
+  const auto chunk_count = left_table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = left_table.get_chunk(chunk_id);
+    for (auto column_id = ColumnID{0}; column_id < left_table.column_count(); ++column_id) {
+      const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(chunk->get_segment(column_id));
+      if (!reference_segment || reference_segment->referenced_column_id() != column_id ||
+          reference_segment->referenced_table()->column_count() != table_to_update.column_count()) {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+bool Update::_columns_support_in_place_update(
+    const Table& table_to_update, const std::map<ColumnID, std::vector<AllTypeVariant>>& updated_values) const {
+  // Only fixed-width values are updated in place. Updating variable-length values in place would not save much
+  // compared to inserting a new row.
+  for (const auto& [column_id, values] : updated_values) {
+    if (table_to_update.column_data_type(column_id) == DataType::String) return false;
+  }
+
+  // Indexes are built on the main segments and would miss the new values
+  for (const auto& index_statistics : table_to_update.indexes_statistics()) {
+    for (const auto& [column_id, values] : updated_values) {
+      const auto& index_column_ids = index_statistics.column_ids;
+      if (std::find(index_column_ids.begin(), index_column_ids.end(), column_id) != index_column_ids.end()) {
+        return false;
+      }
+    }
+  }
+
+  const auto table_chunk_count = table_to_update.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < table_chunk_count; ++chunk_id) {
+    const auto chunk = table_to_update.get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    for (const auto& [column_id, values] : updated_values) {
+      if (!chunk->get_indexes(std::vector<ColumnID>{column_id}).empty()) return false;
+    }
+  }
+
+  return true;
+}
+
+bool Update::_update_in_place(const TransactionContext& context,
+                              const std::map<ColumnID, std::vector<AllTypeVariant>>& updated_values) {
+  _transaction_id = context.transaction_id();
+
+  const auto& left_table = *input_table_left();
+  auto row_idx = size_t{0};
+
+  const auto chunk_count = left_table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto reference_segment =
+        std::static_pointer_cast<const ReferenceSegment>(left_table.get_chunk(chunk_id)->get_segment(ColumnID{0}));
+    const auto& referenced_table = reference_segment->referenced_table();
+
+    for (const auto& row_id : *reference_segment->pos_list()) {
+      const auto referenced_chunk = referenced_table->get_chunk(row_id.chunk_id);
+      const auto mvcc_data = referenced_chunk->mvcc_data();
+      DebugAssert(mvcc_data, "Update cannot operate on a table without MVCC data");
+
+      // A row with a foreign tid is being deleted by another transaction
+      const auto row_tid = mvcc_data->get_tid(row_id.chunk_offset);
+      if (row_tid != INVALID_TRANSACTION_ID && row_tid != _transaction_id) return false;
+
+      auto column_values = std::vector<std::pair<ColumnID, AllTypeVariant>>{};
+      column_values.reserve(updated_values.size());
+      for (const auto& [column_id, values] : updated_values) {
+        column_values.emplace_back(column_id, values[row_idx]);
+      }
+      ++row_idx;
+
+      if (!mvcc_data->column_versions.try_add_versions(row_id.chunk_offset, column_values, _transaction_id,
+                                                       context.snapshot_commit_id())) {
+        return false;
+      }
+      if (_versioned_mvcc_data.empty() || _versioned_mvcc_data.back() != mvcc_data) {
+        _versioned_mvcc_data.emplace_back(mvcc_data);
+      }
+
+      // A concurrent Delete might have locked the row in the meantime. As Delete checks for versions after locking
+      // the row, at least one of both detects the conflict.
+      if (mvcc_data->get_tid(row_id.chunk_offset) != row_tid) return false;
+    }
+  }
+
+  return true;
+}
+
+void Update::_on_commit_records(const CommitID cid) {
+  // In-place updates. Otherwise, the commit happens in the Insert and Delete operators.
+  for (const auto& mvcc_data : _versioned_mvcc_data) {
+    mvcc_data->column_versions.commit_versions(_transaction_id, cid);
+    mvcc_data->update_last_commit_id(cid);
+  }
+
+  if (!_table_updated_in_place) return;
+  _table_updated_in_place->update_last_commit_id(cid);
+
+  // Merging re-encodes the updated segments, which is too expensive for the commit path. Thus, the merge is done by a
+  // separate task. Chunks for which a merge is already scheduled are skipped.
+  auto merged_mvcc_data = std::vector<std::shared_ptr<MvccData>>{};
+  for (const auto& mvcc_data : _versioned_mvcc_data) {
+    if (mvcc_data->column_versions.should_merge() && mvcc_data->column_versions.try_schedule_merge()) {
+      merged_mvcc_data.emplace_back(mvcc_data);
+    }
+  }
+  if (merged_mvcc_data.empty()) return;
+
+  const auto weak_table = std::weak_ptr<Table>{_table_updated_in_place};
+  const auto task = std::make_shared<JobTask>([weak_table, merged_mvcc_data]() {
+    // The updated chunks are identified by their MvccData, as the input might reference chunks that GetTable created
+    // for them. The table might have been dropped in the meantime.
+    const auto table = weak_table.lock();
+    if (table) {
+      const auto lowest_snapshot_commit_id = Hyrise::get().transaction_manager.get_lowest_snapshot_commit_id();
+      const auto chunk_count = table->chunk_count();
+      for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+        const auto chunk = table->get_chunk(chunk_id);
+        if (!chunk || chunk->is_mutable() || !chunk->has_mvcc_data() ||
+            std::find(merged_mvcc_data.begin(), merged_mvcc_data.end(), chunk->mvcc_data()) == merged_mvcc_data.end()) {
+          continue;
+        }
+
+        chunk->mvcc_data()->column_versions.merge(*chunk, table->column_data_types(), lowest_snapshot_commit_id);
+      }
+    }
+
+    for (const auto& mvcc_data : merged_mvcc_data) {
+      mvcc_data->column_versions.finish_scheduled_merge();
+    }
+  });
+  task->schedule();
+}
+
+void Update::_on_rollback_records() {
+  // In-place updates. Otherwise, the rollback happens in the Insert and Delete operators.
+  for (const auto& mvcc_data : _versioned_mvcc_data) {
+    mvcc_data->column_versions.rollback_versions(_transaction_id);
+  }
+}
+
 std::shared_ptr<AbstractOperator> Update::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -11,6 +12,7 @@ namespace opossum {
 
 class Delete;
 class Insert;
+struct MvccData;
 
 /**
  * Operator that updates a subset of columns of a number of rows and from one table with values supplied in another.
@@ -20,6 +22,13 @@ class Insert;
  * The second input table must have the exact same column layout and number of rows as the first table and contains the
  * data that is used to update the rows specified by the first table.
  *
+ * If the table allows in-place updates and all columns whose values change are fixed-width columns without indexes
+ * (and the table has no TableHashIndex), the new values are stored in the ColumnVersionStores of the updated chunks
+ * and the rows keep their position. Otherwise, the old rows are deleted and the new ones are inserted at the end of
+ * the table. After committing, the Update schedules a task that merges the versions of the updated immutable chunks
+ * that have accumulated enough versions (see ColumnVersionStore::should_merge), so that the stores do not grow
+ * without bound even if the MvccDeletePlugin is not loaded.
+ *
  * Assumption: The input has been validated before.
  *
  * Note: Update does not support null values at the moment
@@ -38,15 +47,32 @@ class Update : public AbstractReadWriteOperator {
       const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
 
-  // Commit happens in Insert and Delete operators
-  void _on_commit_records(const CommitID cid) override {}
+  void _on_commit_records(const CommitID cid) override;
+  void _on_rollback_records() override;
+
+  // Returns the new values of the columns whose values are changed by the update. Only the columns that the update
+  // sets are materialized and compared.
+  std::map<ColumnID, std::vector<AllTypeVariant>> _updated_values() const;
+
+  // Checks the preconditions that do not depend on the updated columns. These are checked first, so that updates of
+  // tables that do not allow in-place updates do not pay for materializing the new values.
+  bool _table_supports_in_place_update(const Table& table_to_update) const;
 
-  // Rollback happens in Insert and Delete operators
-  void _on_rollback_records() override {}
+  bool _columns_support_in_place_update(const Table& table_to_update,
+                                        const std::map<ColumnID, std::vector<AllTypeVariant>>& updated_values) const;
+
+  // Returns false on a write-write conflict
+  bool _update_in_place(const TransactionContext& context,
+                        const std::map<ColumnID, std::vector<AllTypeVariant>>& updated_values);
 
  protected:
   const std::string _table_to_update_name;
   std::shared_ptr<Delete> _delete;
   std::shared_ptr<Insert> _insert;
+
+  // MVCC data of the chunks whose values were updated in place
+  std::vector<std::shared_ptr<MvccData>> _versioned_mvcc_data;
+  std::shared_ptr<Table> _table_updated_in_place;
+  TransactionID _transaction_id{INVALID_TRANSACTION_ID};
 };
 }  // namespace opossum
@@ -1,5 +1,9 @@
 #include "validate.hpp"
 
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
 #include <memory>
 #include <string>
 #include <utility>
@@ -9,6 +13,7 @@
 #include "hyrise.hpp"
 #include "operators/delete.hpp"
 #include "scheduler/job_task.hpp"
+#include "storage/mvcc_data.hpp"
 #include "storage/pos_lists/entire_chunk_pos_list.hpp"
 #include "storage/reference_segment.hpp"
 #include "utils/assert.hpp"
@@ -47,12 +52,62 @@ bool Validate::_is_entire_chunk_visible(const std::shared_ptr<const Chunk>& chun
               "_is_entire_chunk_visible cannot be called on reference chunks.");
 
   const auto& mvcc_data = chunk->mvcc_data();
+  if (_mvcc_data_with_own_deletes.count(mvcc_data.get())) return false;
+
   const auto max_begin_cid = mvcc_data->max_begin_cid;
   if (!max_begin_cid) return false;
 
   return snapshot_commit_id >= max_begin_cid && chunk->invalid_row_count() == 0;
 }
 
+void Validate::_append_visible_rows(const MvccData& mvcc_data, const ChunkID chunk_id, const ChunkOffset row_count,
+                                    const TransactionID our_tid, const CommitID snapshot_commit_id,
+                                    RowIDPosList& pos_list) {
+  auto chunk_offset = ChunkOffset{0};
+
+#ifdef __AVX2__
+  static_assert(sizeof(copyable_atomic<TransactionID>) == sizeof(TransactionID),
+                "The tids are read as a plain TransactionID array");
+
+  // Same as the accessors of MvccData, we rely on aligned 32-bit reads being atomic on x64 (which also holds for the
+  // individual elements of vector loads). The tids of other transactions never change the result, as only our own tid
+  // is compared to the row's tid, and our own tids are only written by our own (preceding) operators.
+  const auto* const tids = reinterpret_cast<const TransactionID*>(mvcc_data._tids.data());
+  const auto* const begin_cids = mvcc_data._begin_cids.data();
+  const auto* const end_cids = mvcc_data._end_cids.data();
+
+  const auto our_tids = _mm256_set1_epi32(static_cast<int32_t>(our_tid));
+  const auto snapshot_commit_ids = _mm256_set1_epi32(static_cast<int32_t>(snapshot_commit_id));
+
+  for (; chunk_offset + 8 <= row_count; chunk_offset += 8) {
+    const auto row_tids = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(tids + chunk_offset));
+    const auto row_begin_cids = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(begin_cids + chunk_offset));
+    const auto row_end_cids = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(end_cids + chunk_offset));
+
+    // AVX2 has no unsigned comparison, so we compute snapshot_commit_id >= cid as max(snapshot_commit_id, cid) ==
+    // snapshot_commit_id. The combination is the same as in is_row_visible.
+    const auto begin_cid_reached =
+        _mm256_cmpeq_epi32(_mm256_max_epu32(snapshot_commit_ids, row_begin_cids), snapshot_commit_ids);
+    const auto end_cid_reached =
+        _mm256_cmpeq_epi32(_mm256_max_epu32(snapshot_commit_ids, row_end_cids), snapshot_commit_ids);
+    const auto is_own_row = _mm256_cmpeq_epi32(row_tids, our_tids);
+    const auto is_visible = _mm256_andnot_si256(end_cid_reached, _mm256_xor_si256(begin_cid_reached, is_own_row));
+
+    auto visible_mask = static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(is_visible)));
+    while (visible_mask) {
+      pos_list.emplace_back(RowID{chunk_id, chunk_offset + static_cast<ChunkOffset>(__builtin_ctz(visible_mask))});
+      visible_mask &= visible_mask - 1;
+    }
+  }
+#endif
+
+  for (; chunk_offset < row_count; ++chunk_offset) {
+    if (opossum::is_row_visible(our_tid, snapshot_commit_id, chunk_offset, mvcc_data)) {
+      pos_list.emplace_back(RowID{chunk_id, chunk_offset});
+    }
+  }
+}
+
 Validate::Validate(const std::shared_ptr<AbstractOperator>& in)
     : AbstractReadOnlyOperator(OperatorType::Validate, in) {}
 
@@ -98,13 +153,20 @@ std::shared_ptr<const Table> Validate::_on_execute(std::shared_ptr<TransactionCo
   // (3) the highest begin_cid in the chunk is lower than/equal to the snapshot_cid of the transaction
   //     (the max_begin_cid is stored in the chunk, not determined by the ValidateOperator),
   // (4) no rows in the chunk have been invalidated before this transaction was started,
-  // (5) the current transaction has no in-flight deletes.
+  // (5) the current transaction has no in-flight deletes in the chunk.
   const auto& read_write_operators = transaction_context->read_write_operators();
   for (const auto& read_write_operator : read_write_operators) {
-    if (read_write_operator->type() == OperatorType::Delete) {
+    if (read_write_operator->type() != OperatorType::Delete) continue;
+
+    // Deletes that have not (successfully) finished executing might still lock rows in any chunk
+    if (read_write_operator->state() != ReadWriteOperatorState::Executed) {
       _can_use_chunk_shortcut = false;
       break;
     }
+
+    for (const auto& mvcc_data : static_cast<const Delete&>(*read_write_operator).modified_mvcc_data()) {
+      _mvcc_data_with_own_deletes.emplace(mvcc_data.get());
+    }
   }
 
   while (job_end_chunk_id < chunk_count) {
@@ -217,13 +279,7 @@ void Validate::_validate_chunks(const std::shared_ptr<const Table>& in_table, co
         const auto mvcc_data = chunk_in->mvcc_data();
         RowIDPosList temp_pos_list;
         temp_pos_list.guarantee_single_chunk();
-        // Generate pos_list_out.
-        auto chunk_size = chunk_in->size();  // The compiler fails to optimize this in the for clause :(
-        for (auto i = 0u; i < chunk_size; i++) {
-          if (opossum::is_row_visible(our_tid, snapshot_commit_id, i, *mvcc_data)) {
-            temp_pos_list.emplace_back(RowID{chunk_id, i});
-          }
-        }
+        _append_visible_rows(*mvcc_data, chunk_id, chunk_in->size(), our_tid, snapshot_commit_id, temp_pos_list);
         pos_list_out = std::make_shared<const RowIDPosList>(std::move(temp_pos_list));
       }
 
@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 #include "abstract_read_only_operator.hpp"
@@ -10,6 +11,9 @@
 
 namespace opossum {
 
+class RowIDPosList;
+struct MvccData;
+
 /**
  * Validates visibility of records of a table
  * within the context of a given transaction
@@ -37,8 +41,17 @@ class Validate : public AbstractReadOnlyOperator {
   // _can_use_chunk_shortcut is true. Consult _on_execute() for more details on the conditions.
   bool _is_entire_chunk_visible(const std::shared_ptr<const Chunk>& chunk, const CommitID snapshot_commit_id) const;
 
+  // Appends the visible rows among the first row_count rows of a chunk to the pos list. Uses AVX2 if available.
+  static void _append_visible_rows(const MvccData& mvcc_data, const ChunkID chunk_id, const ChunkOffset row_count,
+                                   const TransactionID our_tid, const CommitID snapshot_commit_id,
+                                   RowIDPosList& pos_list);
+
   bool _can_use_chunk_shortcut = true;
 
+  // Chunks in which the current transaction has deleted rows. These rows are invisible to the transaction even though
+  // their end_cid is not yet set, so these chunks cannot be entirely visible.
+  std::unordered_set<const MvccData*> _mvcc_data_with_own_deletes;
+
  protected:
   std::shared_ptr<const Table> _on_execute(std::shared_ptr<TransactionContext> transaction_context) override;
   std::shared_ptr<const Table> _on_execute() override;
@@ -12,10 +12,31 @@
 
 namespace opossum {
 
+DpCcp::DpCcp(const size_t max_csg_cmp_pair_count) : _max_csg_cmp_pair_count(max_csg_cmp_pair_count) {}
+
 std::shared_ptr<AbstractLQPNode> DpCcp::operator()(const JoinGraph& join_graph,
                                                    const std::shared_ptr<AbstractCostEstimator>& cost_estimator) {
   Assert(!join_graph.vertices.empty(), "Code below relies on the JoinGraph having vertices");
 
+  /**
+   * 0. Enumerate the CsgCmpPairs, i.e., the candidate joins, first, so that we can give up before building any plans
+   *    if there are too many of them (see step 4 for how they are used).
+   */
+  std::vector<std::pair<size_t, size_t>> enumerate_ccp_edges;
+  for (const auto& edge : join_graph.edges) {
+    // EnumerateCcp only deals with binary join predicates
+    if (edge.vertex_set.count() != 2) continue;
+
+    const auto first_vertex_idx = edge.vertex_set.find_first();
+    const auto second_vertex_idx = edge.vertex_set.find_next(first_vertex_idx);
+
+    enumerate_ccp_edges.emplace_back(first_vertex_idx, second_vertex_idx);
+  }
+
+  auto enumerate_ccp = EnumerateCcp{join_graph.vertices.size(), enumerate_ccp_edges, _max_csg_cmp_pair_count};
+  const auto csg_cmp_pairs = enumerate_ccp();
+  if (enumerate_ccp.budget_exceeded()) return nullptr;
+
   // No std::unordered_map, since hashing of JoinGraphVertexSet is not (efficiently) possible because
   // boost::dynamic_bitset hides the data necessary for doing so efficiently.
   auto best_plan = std::map<JoinGraphVertexSet, std::shared_ptr<AbstractLQPNode>>{};
@@ -84,24 +105,10 @@ std::shared_ptr<AbstractLQPNode> DpCcp::operator()(const JoinGraph& join_graph,
   }
 
   /**
-   * 4. Prepare EnumerateCcp: Transform the JoinGraph's vertex-to-vertex edges into index pairs
-   */
-  std::vector<std::pair<size_t, size_t>> enumerate_ccp_edges;
-  for (const auto& edge : join_graph.edges) {
-    // EnumerateCcp only deals with binary join predicates
-    if (edge.vertex_set.count() != 2) continue;
-
-    const auto first_vertex_idx = edge.vertex_set.find_first();
-    const auto second_vertex_idx = edge.vertex_set.find_next(first_vertex_idx);
-
-    enumerate_ccp_edges.emplace_back(first_vertex_idx, second_vertex_idx);
-  }
-
-  /**
-   * 5. Actual DpCcp algorithm: Enumerate the CsgCmpPairs; build candidate plans; update best_plan if the candidate plan
-   *                            is cheaper than the cheapest currently known plan for a particular subset of vertices.
+   * 4. Actual DpCcp algorithm: Iterate over the CsgCmpPairs; build candidate plans; update best_plan if the candidate
+   *                            plan is cheaper than the cheapest currently known plan for a particular subset of
+   *                            vertices.
    */
-  const auto csg_cmp_pairs = EnumerateCcp{join_graph.vertices.size(), enumerate_ccp_edges}();  // NOLINT
   for (const auto& csg_cmp_pair : csg_cmp_pairs) {
     const auto best_plan_left_iter = best_plan.find(csg_cmp_pair.first);
     const auto best_plan_right_iter = best_plan.find(csg_cmp_pair.second);
@@ -123,7 +130,7 @@ std::shared_ptr<AbstractLQPNode> DpCcp::operator()(const JoinGraph& join_graph,
   }
 
   /**
-   * 6. Build vertex set with all vertices and return the plan for it - this will be the best plan for the entire join
+   * 5. Build vertex set with all vertices and return the plan for it - this will be the best plan for the entire join
    *    graph.
    */
   boost::dynamic_bitset<> all_vertices_set{join_graph.vertices.size()};
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <limits>
+
 #include "abstract_join_ordering_algorithm.hpp"
 
 namespace opossum {
@@ -17,9 +19,14 @@ class JoinGraph;
  * DpCcp is driven by EnumerateCcp which enumerates all candidate join operations.
  *
  * Local predicates are pushed down and sorted by increasing cost.
+ *
+ * The optimization time is dominated by the number of enumerated CsgCmpPairs (i.e., candidate joins), which grows
+ * exponentially for dense JoinGraphs. DpCcp gives up if there are more than max_csg_cmp_pair_count of them.
  */
 class DpCcp final : public AbstractJoinOrderingAlgorithm {
  public:
+  explicit DpCcp(const size_t max_csg_cmp_pair_count = std::numeric_limits<size_t>::max());
+
   /**
    * @param join_graph                      A JoinGraph for a part of an LQP with further subplans as vertices. DpCcp is
    *                                        only applied to this particular JoinGraph and doesn't modify the subplans in
@@ -28,9 +35,14 @@ class DpCcp final : public AbstractJoinOrderingAlgorithm {
    * @return                                An LQP consisting of
    *                                            * the operations from the JoinGraph in an optimal order
    *                                            * the subplans from the vertices below them
+   *                                        or nullptr if the JoinGraph has more than max_csg_cmp_pair_count
+   *                                        CsgCmpPairs.
    */
   std::shared_ptr<AbstractLQPNode> operator()(const JoinGraph& join_graph,
                                               const std::shared_ptr<AbstractCostEstimator>& cost_estimator);
+
+ private:
+  const size_t _max_csg_cmp_pair_count;
 };
 
 }  // namespace opossum
@@ -17,8 +17,9 @@
 
 namespace opossum {
 
-EnumerateCcp::EnumerateCcp(const size_t num_vertices, std::vector<std::pair<size_t, size_t>> edges)
-    : _num_vertices(num_vertices), _edges(std::move(edges)) {
+EnumerateCcp::EnumerateCcp(const size_t num_vertices, std::vector<std::pair<size_t, size_t>> edges,
+                           const size_t max_csg_cmp_pair_count)
+    : _num_vertices(num_vertices), _edges(std::move(edges)), _max_csg_cmp_pair_count(max_csg_cmp_pair_count) {
   // DPccp should not be used for queries with a table count on the scale of 64 because of complexity reasons
   Assert(num_vertices < sizeof(unsigned long) * 8, "Too many vertices, EnumerateCcp relies on to_ulong()");  // NOLINT
 
@@ -53,11 +54,15 @@ std::vector<std::pair<JoinGraphVertexSet, JoinGraphVertexSet>> EnumerateCcp::ope
     auto start_vertex_set = JoinGraphVertexSet(_num_vertices);
     start_vertex_set.set(forward_vertex_idx);
     _enumerate_cmp(start_vertex_set);
+    if (_budget_exceeded) return {};
 
     std::vector<JoinGraphVertexSet> csgs;
     _enumerate_csg_recursive(csgs, start_vertex_set, _exclusion_set(forward_vertex_idx));
+    if (_budget_exceeded) return {};
+
     for (const auto& csg : csgs) {
       _enumerate_cmp(csg);
+      if (_budget_exceeded) return {};
     }
   }
 
@@ -94,7 +99,18 @@ void EnumerateCcp::_enumerate_csg_recursive(std::vector<JoinGraphVertexSet>& csg
    * For each newly found connected subgraph, calls itself recursively.
    */
 
+  if (_budget_exceeded) return;
+
   const auto neighborhood = _neighborhood(vertex_set, exclusion_set);
+
+  // Each connected subgraph is part of at least one CsgCmpPair, so there cannot be fewer CsgCmpPairs than connected
+  // subgraphs. Stop before materializing the (potentially 2^n) subsets of a large neighborhood.
+  const auto neighborhood_subset_count = (size_t{1} << neighborhood.count()) - 1;
+  if (neighborhood_subset_count > _max_csg_cmp_pair_count - csgs.size()) {
+    _budget_exceeded = true;
+    return;
+  }
+
   const auto neighborhood_subsets = _non_empty_subsets(neighborhood);
   const auto extended_exclusion_set = exclusion_set | neighborhood;
 
@@ -128,19 +144,26 @@ void EnumerateCcp::_enumerate_cmp(const JoinGraphVertexSet& primary_vertex_set)
     auto cmp_vertex_set = JoinGraphVertexSet(_num_vertices);
     cmp_vertex_set.set(*iter);
 
-    _csg_cmp_pairs.emplace_back(std::make_pair(primary_vertex_set, cmp_vertex_set));
-
     const auto extended_exclusion_set = exclusion_set | (_exclusion_set(*iter) & neighborhood);
 
     std::vector<JoinGraphVertexSet> csgs;
     _enumerate_csg_recursive(csgs, cmp_vertex_set, extended_exclusion_set);
 
+    // The single-vertex complement and all complements found by _enumerate_csg_recursive() form a CsgCmpPair each
+    if (_budget_exceeded || csgs.size() + 1 > _max_csg_cmp_pair_count - _csg_cmp_pairs.size()) {
+      _budget_exceeded = true;
+      return;
+    }
+
+    _csg_cmp_pairs.emplace_back(std::make_pair(primary_vertex_set, cmp_vertex_set));
     for (const auto& csg : csgs) {
       _csg_cmp_pairs.emplace_back(std::make_pair(primary_vertex_set, csg));
     }
   }
 }
 
+bool EnumerateCcp::budget_exceeded() const { return _budget_exceeded; }
+
 JoinGraphVertexSet EnumerateCcp::_exclusion_set(const size_t vertex_idx) const {
   /**
    * All vertices with an index lower than `vertex_idx`
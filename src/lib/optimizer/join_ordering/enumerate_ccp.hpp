@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <limits>
 #include <optional>
 #include <utility>
 #include <vector>
@@ -51,14 +52,21 @@ using CsgCmpPair = std::pair<JoinGraphVertexSet, JoinGraphVertexSet>;
  *          -> a single vertex or
  *          -> a subgraph for which **all possible subdivisions have been enumerated before**. This fact is essential
  *              for dynamic programming to work.
+ *
+ * The number of CsgCmpPairs grows exponentially for dense JoinGraphs. If more than max_csg_cmp_pair_count CsgCmpPairs
+ * exist, the enumeration stops as soon as this is known, returns no CsgCmpPairs and budget_exceeded() returns true.
  */
 class EnumerateCcp final {
  public:
-  EnumerateCcp(const size_t num_vertices, std::vector<std::pair<size_t, size_t>> edges);
+  EnumerateCcp(const size_t num_vertices, std::vector<std::pair<size_t, size_t>> edges,
+               const size_t max_csg_cmp_pair_count = std::numeric_limits<size_t>::max());
 
   // Corresponds to EnumerateCsg in the paper
   std::vector<CsgCmpPair> operator()();
 
+  // Whether operator() stopped because the JoinGraph has more than max_csg_cmp_pair_count CsgCmpPairs
+  bool budget_exceeded() const;
+
  private:
   // Corresponds to EnumerateCsgRec in the paper
   void _enumerate_csg_recursive(std::vector<JoinGraphVertexSet>& csgs, const JoinGraphVertexSet& vertex_set,
@@ -80,6 +88,8 @@ class EnumerateCcp final {
 
   const size_t _num_vertices;
   const std::vector<std::pair<size_t, size_t>> _edges;
+  const size_t _max_csg_cmp_pair_count;
+  bool _budget_exceeded{false};
 
   std::vector<std::pair<JoinGraphVertexSet, JoinGraphVertexSet>> _csg_cmp_pairs;
 
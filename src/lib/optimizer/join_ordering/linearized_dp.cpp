@@ -0,0 +1,281 @@
+#include "linearized_dp.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "cost_estimation/abstract_cost_estimator.hpp"
+#include "join_graph.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "statistics/abstract_cardinality_estimator.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+/**
+ * A (possibly compound) element of a sequence in IKKBZ. `cardinality_factor` (T in the literature) is the factor by
+ * which the cardinality of the intermediate result grows when joining the vertices of the element, `cost` (C) is the
+ * sum of the intermediate cardinalities produced by them, relative to the input cardinality. Doubles are used since
+ * the products of many cardinalities easily exceed the range of floats.
+ */
+struct IkkbzElement {
+  double rank() const { return (cardinality_factor - 1.0) / cost; }
+
+  // Returns the compound element of this element followed by `other`
+  IkkbzElement followed_by(const IkkbzElement& other) const {
+    auto vertices = this->vertices;
+    vertices.insert(vertices.end(), other.vertices.begin(), other.vertices.end());
+    return {std::move(vertices), cardinality_factor * other.cardinality_factor,
+            cost + cardinality_factor * other.cost};
+  }
+
+  std::vector<size_t> vertices;
+  double cardinality_factor;
+  double cost;
+};
+
+using IkkbzSequence = std::vector<IkkbzElement>;
+
+// Merges sequences that are sorted by rank into a single sequence sorted by rank
+IkkbzSequence merge_by_rank(std::vector<IkkbzSequence>&& sequences) {
+  auto merged_sequence = IkkbzSequence{};
+  for (auto& sequence : sequences) {
+    merged_sequence.insert(merged_sequence.end(), std::make_move_iterator(sequence.begin()),
+                           std::make_move_iterator(sequence.end()));
+  }
+
+  // Elements with equal rank keep their order, so the order within each input sequence is preserved
+  std::stable_sort(merged_sequence.begin(), merged_sequence.end(),
+                   [](const auto& lhs, const auto& rhs) { return lhs.rank() < rhs.rank(); });
+  return merged_sequence;
+}
+
+// Builds the sequence, sorted by rank, for the subtree of the spanning tree that is rooted at `vertex_idx`
+IkkbzSequence subtree_sequence(const size_t vertex_idx, const size_t parent_vertex_idx, const float selectivity,
+                               const std::vector<float>& cardinalities,
+                               const std::vector<std::vector<std::pair<size_t, float>>>& tree_edges) {
+  auto child_sequences = std::vector<IkkbzSequence>{};
+  for (const auto& [child_vertex_idx, child_selectivity] : tree_edges[vertex_idx]) {
+    if (child_vertex_idx == parent_vertex_idx) continue;
+    child_sequences.emplace_back(
+        subtree_sequence(child_vertex_idx, vertex_idx, child_selectivity, cardinalities, tree_edges));
+  }
+  auto children_sequence = merge_by_rank(std::move(child_sequences));
+
+  // The vertex has to precede all vertices of its subtree. If it has a higher rank than the first of them, the order
+  // by rank would be violated. In that case, both are combined into a compound element ("normalization").
+  const auto cardinality_factor = static_cast<double>(selectivity) * cardinalities[vertex_idx];
+  auto element = IkkbzElement{{vertex_idx}, cardinality_factor, cardinality_factor};
+  auto children_sequence_begin = children_sequence.begin();
+  while (children_sequence_begin != children_sequence.end() && children_sequence_begin->rank() < element.rank()) {
+    element = element.followed_by(*children_sequence_begin);
+    ++children_sequence_begin;
+  }
+
+  auto sequence = IkkbzSequence{std::move(element)};
+  sequence.insert(sequence.end(), std::make_move_iterator(children_sequence_begin),
+                  std::make_move_iterator(children_sequence.end()));
+  return sequence;
+}
+
+}  // namespace
+
+namespace opossum {
+
+std::shared_ptr<AbstractLQPNode> LinearizedDp::operator()(
+    const JoinGraph& join_graph, const std::shared_ptr<AbstractCostEstimator>& cost_estimator) {
+  Assert(!join_graph.vertices.empty(), "Code below relies on the JoinGraph having vertices");
+
+  const auto vertex_count = join_graph.vertices.size();
+  const auto& cardinality_estimator = cost_estimator->cardinality_estimator;
+
+  /**
+   * 1. Build the plans of the single vertices, with the local predicates on top of them. Place the uncorrelated
+   *    predicates (think "6 > 4": not referencing any vertex) on top of the largest vertex: they are either False or
+   *    True for *all* rows, so if one of them is False, we avoid processing the vertex' many rows in later joins.
+   */
+  auto vertex_plans = std::vector<std::shared_ptr<AbstractLQPNode>>(vertex_count);
+  auto vertex_cardinalities = std::vector<float>(vertex_count);
+  for (auto vertex_idx = size_t{0}; vertex_idx < vertex_count; ++vertex_idx) {
+    vertex_cardinalities[vertex_idx] = cardinality_estimator->estimate_cardinality(join_graph.vertices[vertex_idx]);
+  }
+
+  auto uncorrelated_predicates = std::vector<std::shared_ptr<AbstractExpression>>{};
+  for (const auto& edge : join_graph.edges) {
+    if (!edge.vertex_set.none()) continue;
+    uncorrelated_predicates.insert(uncorrelated_predicates.end(), edge.predicates.begin(), edge.predicates.end());
+  }
+  const auto largest_vertex_idx = static_cast<size_t>(std::distance(
+      vertex_cardinalities.begin(), std::max_element(vertex_cardinalities.begin(), vertex_cardinalities.end())));
+
+  for (auto vertex_idx = size_t{0}; vertex_idx < vertex_count; ++vertex_idx) {
+    auto vertex_plan = join_graph.vertices[vertex_idx];
+    if (vertex_idx == largest_vertex_idx) {
+      for (const auto& uncorrelated_predicate : uncorrelated_predicates) {
+        vertex_plan = PredicateNode::make(uncorrelated_predicate, vertex_plan);
+      }
+    }
+
+    vertex_plans[vertex_idx] =
+        _add_predicates_to_plan(vertex_plan, join_graph.find_local_predicates(vertex_idx), cost_estimator);
+    // Cardinalities below one would turn the selectivities and ranks of IKKBZ meaningless
+    vertex_cardinalities[vertex_idx] =
+        std::max(cardinality_estimator->estimate_cardinality(vertex_plans[vertex_idx]), 1.0f);
+  }
+
+  /**
+   * 2. Determine the neighborhood of each vertex and the selectivity of joining each pair of neighbors. Only binary
+   *    edges make vertices neighbors, hyperedges are applied once all of their vertices are joined. The
+   *    JoinGraphBuilder guarantees that the JoinGraph is connected by binary edges (using cross join edges if
+   *    necessary).
+   */
+  auto neighborhoods = std::vector<JoinGraphVertexSet>(vertex_count, JoinGraphVertexSet{vertex_count});
+  auto selectivities = std::vector<std::vector<float>>(vertex_count, std::vector<float>(vertex_count, 1.0f));
+  for (const auto& edge : join_graph.edges) {
+    if (edge.vertex_set.count() != 2) continue;
+
+    const auto first_vertex_idx = edge.vertex_set.find_first();
+    const auto second_vertex_idx = edge.vertex_set.find_next(first_vertex_idx);
+    neighborhoods[first_vertex_idx].set(second_vertex_idx);
+    neighborhoods[second_vertex_idx].set(first_vertex_idx);
+
+    const auto join_plan = _add_join_to_plan(vertex_plans[first_vertex_idx], vertex_plans[second_vertex_idx],
+                                             edge.predicates, cost_estimator);
+    const auto selectivity =
+        std::clamp(cardinality_estimator->estimate_cardinality(join_plan) /
+                       (vertex_cardinalities[first_vertex_idx] * vertex_cardinalities[second_vertex_idx]),
+                   std::numeric_limits<float>::min(), 1.0f);
+    selectivities[first_vertex_idx][second_vertex_idx] = selectivity;
+    selectivities[second_vertex_idx][first_vertex_idx] = selectivity;
+  }
+
+  /**
+   * 3. Build a minimum spanning tree (Prim's algorithm) that prefers selective edges, as IKKBZ requires a tree-shaped
+   *    JoinGraph. The remaining edges are still considered when building the plans in step 5.
+   */
+  auto tree_edges = std::vector<std::vector<std::pair<size_t, float>>>(vertex_count);
+  auto in_tree = JoinGraphVertexSet{vertex_count};
+  in_tree.set(0);
+  while (!in_tree.all()) {
+    auto best_edge = std::optional<std::pair<size_t, size_t>>{};
+    for (auto tree_vertex_idx = in_tree.find_first(); tree_vertex_idx != JoinGraphVertexSet::npos;
+         tree_vertex_idx = in_tree.find_next(tree_vertex_idx)) {
+      const auto candidates = neighborhoods[tree_vertex_idx] - in_tree;
+      for (auto vertex_idx = candidates.find_first(); vertex_idx != JoinGraphVertexSet::npos;
+           vertex_idx = candidates.find_next(vertex_idx)) {
+        if (!best_edge ||
+            selectivities[tree_vertex_idx][vertex_idx] < selectivities[best_edge->first][best_edge->second]) {
+          best_edge = std::make_pair(tree_vertex_idx, vertex_idx);
+        }
+      }
+    }
+    Assert(best_edge, "JoinGraph is not connected by binary edges");
+
+    const auto [tree_vertex_idx, vertex_idx] = *best_edge;
+    const auto selectivity = selectivities[tree_vertex_idx][vertex_idx];
+    tree_edges[tree_vertex_idx].emplace_back(vertex_idx, selectivity);
+    tree_edges[vertex_idx].emplace_back(tree_vertex_idx, selectivity);
+    in_tree.set(vertex_idx);
+  }
+
+  /**
+   * 4. Linearize the vertices with IKKBZ
+   */
+  const auto order = _linearize(vertex_cardinalities, tree_edges);
+
+  /**
+   * 5. Dynamic programming over the subchains of the order. best_plans[begin][end] holds the cheapest plan (and its
+   *    cost) for joining the vertices order[begin] to order[end], or nullptr if they are not connected.
+   */
+  auto best_plans = std::vector<std::vector<std::pair<std::shared_ptr<AbstractLQPNode>, Cost>>>(
+      vertex_count, std::vector<std::pair<std::shared_ptr<AbstractLQPNode>, Cost>>(vertex_count));
+  auto subchain_vertex_sets = std::vector<std::vector<JoinGraphVertexSet>>(
+      vertex_count, std::vector<JoinGraphVertexSet>(vertex_count, JoinGraphVertexSet{vertex_count}));
+  for (auto begin = size_t{0}; begin < vertex_count; ++begin) {
+    const auto& vertex_plan = vertex_plans[order[begin]];
+    best_plans[begin][begin] = {vertex_plan, cost_estimator->estimate_plan_cost(vertex_plan)};
+
+    for (auto end = begin; end < vertex_count; ++end) {
+      if (end > begin) subchain_vertex_sets[begin][end] = subchain_vertex_sets[begin][end - 1];
+      subchain_vertex_sets[begin][end].set(order[end]);
+    }
+  }
+
+  for (auto length = size_t{2}; length <= vertex_count; ++length) {
+    for (auto begin = size_t{0}; begin + length <= vertex_count; ++begin) {
+      const auto end = begin + length - 1;
+      auto& best_plan = best_plans[begin][end];
+
+      for (auto split = begin; split < end; ++split) {
+        const auto& left_plan = best_plans[begin][split].first;
+        const auto& right_plan = best_plans[split + 1][end].first;
+        if (!left_plan || !right_plan) continue;
+
+        const auto& left_vertex_set = subchain_vertex_sets[begin][split];
+        const auto& right_vertex_set = subchain_vertex_sets[split + 1][end];
+        auto left_neighborhood = JoinGraphVertexSet{vertex_count};
+        for (auto vertex_idx = left_vertex_set.find_first(); vertex_idx != JoinGraphVertexSet::npos;
+             vertex_idx = left_vertex_set.find_next(vertex_idx)) {
+          left_neighborhood |= neighborhoods[vertex_idx];
+        }
+        if (!left_neighborhood.intersects(right_vertex_set)) continue;
+
+        const auto join_predicates = join_graph.find_join_predicates(left_vertex_set, right_vertex_set);
+        const auto candidate_plan = _add_join_to_plan(left_plan, right_plan, join_predicates, cost_estimator);
+        const auto candidate_cost = cost_estimator->estimate_plan_cost(candidate_plan);
+        if (!best_plan.first || candidate_cost < best_plan.second) {
+          best_plan = {candidate_plan, candidate_cost};
+        }
+      }
+    }
+  }
+
+  // Every prefix of the IKKBZ order is connected, so there is at least the left-deep plan along the order
+  const auto& result_plan = best_plans[0][vertex_count - 1].first;
+  Assert(result_plan, "No plan for all vertices generated. Maybe JoinGraph isn't connected?");
+
+  return result_plan;
+}
+
+std::vector<size_t> LinearizedDp::_linearize(const std::vector<float>& cardinalities,
+                                             const std::vector<std::vector<std::pair<size_t, float>>>& tree_edges) {
+  const auto vertex_count = cardinalities.size();
+
+  /**
+   * Each vertex is tried as the first relation of the order. The subtrees of the root are turned into sequences sorted
+   * by rank, which are then merged. The order with the lowest sum of intermediate cardinalities wins.
+   */
+  auto best_order = std::vector<size_t>{};
+  auto best_cost = std::numeric_limits<double>::infinity();
+  for (auto root_vertex_idx = size_t{0}; root_vertex_idx < vertex_count; ++root_vertex_idx) {
+    auto child_sequences = std::vector<IkkbzSequence>{};
+    for (const auto& [child_vertex_idx, selectivity] : tree_edges[root_vertex_idx]) {
+      child_sequences.emplace_back(
+          subtree_sequence(child_vertex_idx, root_vertex_idx, selectivity, cardinalities, tree_edges));
+    }
+
+    auto order = std::vector<size_t>{root_vertex_idx};
+    auto cardinality = static_cast<double>(cardinalities[root_vertex_idx]);
+    auto cost = 0.0;
+    for (const auto& element : merge_by_rank(std::move(child_sequences))) {
+      order.insert(order.end(), element.vertices.begin(), element.vertices.end());
+      cost += cardinality * element.cost;
+      cardinality *= element.cardinality_factor;
+    }
+
+    if (cost < best_cost || best_order.empty()) {
+      best_order = std::move(order);
+      best_cost = cost;
+    }
+  }
+
+  DebugAssert(best_order.size() == vertex_count, "IKKBZ did not order all vertices, is the spanning tree connected?");
+  return best_order;
+}
+
+}  // namespace opossum
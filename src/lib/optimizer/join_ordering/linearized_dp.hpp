@@ -0,0 +1,58 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "abstract_join_ordering_algorithm.hpp"
+
+namespace opossum {
+
+class AbstractCostEstimator;
+class JoinGraph;
+
+/**
+ * Join ordering algorithm for large JoinGraphs, described as "linearized DP" in "Adaptive Optimization of Very Large
+ * Join Queries" (Neumann and Radke, SIGMOD 2018) https://dl.acm.org/doi/10.1145/3183713.3183733
+ *
+ * DpCcp enumerates all connected subgraphs of the JoinGraph, which becomes infeasible for large or dense JoinGraphs.
+ * GreedyOperatorOrdering is fast, but often far from the optimal plan. LinearizedDp sits in between:
+ *
+ *   1. The vertices are brought into a linear order by running IKKBZ on a minimum spanning tree of the JoinGraph, where
+ *      the edges are weighted by their selectivity. IKKBZ finds the optimal left-deep order for tree-shaped JoinGraphs
+ *      under the C_out cost function (sum of intermediate cardinalities) in polynomial time.
+ *   2. A dynamic programming over all subchains (i.e., ranges of consecutive vertices) of that order finds the
+ *      cheapest bushy plan that joins only adjacent subchains. Subchains that are not connected in the JoinGraph are
+ *      skipped so that no unnecessary cross joins are introduced.
+ *
+ * This needs O(n^3) candidate joins instead of the exponential number of DpCcp, while still exploring bushy plans and
+ * all edges (including those not in the spanning tree and hyperedges). Like DpCcp, it only handles inner and cross
+ * joins; outer joins are vertices of the JoinGraph and thus not reordered.
+ */
+class LinearizedDp final : public AbstractJoinOrderingAlgorithm {
+ public:
+  /**
+   * @param join_graph      A JoinGraph for a part of an LQP with further subplans as vertices. LinearizedDp is only
+   *                        applied to this particular JoinGraph and doesn't modify the subplans in the vertices.
+   * @return                An LQP consisting of
+   *                         * the operations from the JoinGraph in the cheapest order found
+   *                         * the subplans from the vertices below them
+   */
+  std::shared_ptr<AbstractLQPNode> operator()(const JoinGraph& join_graph,
+                                              const std::shared_ptr<AbstractCostEstimator>& cost_estimator);
+
+ protected:
+  friend class LinearizedDpTest;
+
+  /**
+   * IKKBZ: Returns the order of the vertices that minimizes the sum of the intermediate cardinalities of a left-deep
+   * plan joining the vertices along the given spanning tree.
+   *
+   * @param cardinalities   Estimated cardinality of each vertex
+   * @param tree_edges      For each vertex, the vertices that it is connected with in the spanning tree and the
+   *                        selectivity of that connection
+   */
+  static std::vector<size_t> _linearize(const std::vector<float>& cardinalities,
+                                        const std::vector<std::vector<std::pair<size_t, float>>>& tree_edges);
+};
+
+}  // namespace opossum
@@ -6,7 +6,9 @@
 #include "cost_estimation/cost_estimator_logical.hpp"
 #include "expression/expression_utils.hpp"
 #include "expression/lqp_subquery_expression.hpp"
+#include "hyrise.hpp"
 #include "logical_query_plan/logical_plan_root_node.hpp"
+#include "optimizer_rule_statistics.hpp"
 #include "strategy/between_composition_rule.hpp"
 #include "strategy/chunk_pruning_rule.hpp"
 #include "strategy/column_pruning_rule.hpp"
@@ -16,6 +18,7 @@
 #include "strategy/index_scan_rule.hpp"
 #include "strategy/join_ordering_rule.hpp"
 #include "strategy/join_predicate_ordering_rule.hpp"
+#include "strategy/materialized_view_rule.hpp"
 #include "strategy/predicate_merge_rule.hpp"
 #include "strategy/predicate_placement_rule.hpp"
 #include "strategy/predicate_reordering_rule.hpp"
@@ -90,7 +93,12 @@ void collect_subquery_expressions_by_lqp(SubqueryExpressionsByLQP& subquery_expr
 namespace opossum {
 
 std::shared_ptr<Optimizer> Optimizer::create_default_optimizer() {
-  const auto optimizer = std::make_shared<Optimizer>();
+  const auto optimizer =
+      std::make_shared<Optimizer>(std::make_shared<CostEstimatorLogical>(std::make_shared<CardinalityEstimator>()),
+                                  Hyrise::get().default_optimizer_time_budget);
+
+  // Run first, as materialized views are matched against the unoptimized plan
+  optimizer->add_rule(std::make_unique<MaterializedViewRule>());
 
   optimizer->add_rule(std::make_unique<DependentGroupByReductionRule>());
 
@@ -147,14 +155,18 @@ std::shared_ptr<Optimizer> Optimizer::create_default_optimizer() {
   return optimizer;
 }
 
-Optimizer::Optimizer(const std::shared_ptr<AbstractCostEstimator>& cost_estimator) : _cost_estimator(cost_estimator) {}
+Optimizer::Optimizer(const std::shared_ptr<AbstractCostEstimator>& cost_estimator,
+                     const std::optional<std::chrono::nanoseconds>& time_budget)
+    : _cost_estimator(cost_estimator), _time_budget(time_budget) {}
 
 void Optimizer::add_rule(std::unique_ptr<AbstractRule> rule) {
   rule->cost_estimator = _cost_estimator;
   _rules.emplace_back(std::move(rule));
 }
 
-std::shared_ptr<AbstractLQPNode> Optimizer::optimize(std::shared_ptr<AbstractLQPNode> input) const {
+std::shared_ptr<AbstractLQPNode> Optimizer::optimize(
+    std::shared_ptr<AbstractLQPNode> input,
+    const std::shared_ptr<std::vector<OptimizerRuleMetrics>>& rule_metrics) const {
   // We cannot allow multiple owners of the LQP as one owner could decide to optimize the plan and others might hold a
   // pointer to a node that is not even part of the plan anymore after optimization. Thus, callers of this method need
   // to relinquish their ownership (i.e., move their shared_ptr into the method) and take ownership of the resulting
@@ -168,8 +180,30 @@ std::shared_ptr<AbstractLQPNode> Optimizer::optimize(std::shared_ptr<AbstractLQP
 
   if constexpr (HYRISE_DEBUG) validate_lqp(root_node);
 
+  const auto optimization_begin = std::chrono::steady_clock::now();
+
+  // Only Optimizers with a time budget use the process-wide rule statistics
+  const auto rule_statistics = _time_budget ? Hyrise::get().optimizer_rule_statistics : nullptr;
+
   for (const auto& rule : _rules) {
+    const auto rule_begin = std::chrono::steady_clock::now();
+
+    if (rule_statistics) {
+      const auto expected_rule_duration =
+          rule_statistics->average_duration(rule->name()).value_or(std::chrono::nanoseconds{});
+      if (rule_begin - optimization_begin + expected_rule_duration > *_time_budget) {
+        if (rule_metrics) rule_metrics->emplace_back(OptimizerRuleMetrics{rule->name(), {}, true});
+        continue;
+      }
+    }
+
     _apply_rule(*rule, root_node);
+
+    const auto rule_duration =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - rule_begin);
+    if (rule_statistics) rule_statistics->record(rule->name(), rule_duration);
+    if (rule_metrics) rule_metrics->emplace_back(OptimizerRuleMetrics{rule->name(), rule_duration, false});
+
     if constexpr (HYRISE_DEBUG) validate_lqp(root_node);
   }
 
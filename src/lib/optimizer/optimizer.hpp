@@ -1,7 +1,10 @@
 #pragma once
 
 #include <algorithm>
+#include <chrono>
 #include <memory>
+#include <optional>
+#include <string>
 #include <vector>
 
 #include "cost_estimation/cost_estimator_logical.hpp"
@@ -13,26 +16,49 @@ namespace opossum {
 class AbstractRule;
 class AbstractLQPNode;
 
+struct OptimizerRuleMetrics {
+  std::string rule_name;
+  std::chrono::nanoseconds duration{};
+
+  // Set if the rule was not applied because it was not expected to finish within the Optimizer's time budget
+  bool skipped{false};
+};
+
 /**
  * Applies optimization rules to an LQP.
  * On each invocation of optimize(), these Batches are applied in the same order as they were added
  * to the Optimizer.
  *
- * Optimizer::create_default_optimizer() creates the Optimizer with the default rule set.
+ * Optimizer::create_default_optimizer() creates the Optimizer with the default rule set and the time budget
+ * configured in Hyrise::default_optimizer_time_budget.
  */
 class Optimizer final {
  public:
   static std::shared_ptr<Optimizer> create_default_optimizer();
 
+  /**
+   * @param time_budget   Limits the time spent in optimize(). Rules are never interrupted. Instead, a rule is skipped if
+   *                      the time spent so far plus the average time the rule took in previous optimize() calls exceeds
+   *                      the budget. The averages are taken from Hyrise::optimizer_rule_statistics, which is shared by
+   *                      all Optimizers with a budget. As rules only perform semantics-preserving transformations, the
+   *                      result is a valid, if less optimized, plan. Without a budget, all rules are always applied and
+   *                      their durations are not recorded.
+   */
   explicit Optimizer(const std::shared_ptr<AbstractCostEstimator>& cost_estimator =
-                         std::make_shared<CostEstimatorLogical>(std::make_shared<CardinalityEstimator>()));
+                         std::make_shared<CostEstimatorLogical>(std::make_shared<CardinalityEstimator>()),
+                     const std::optional<std::chrono::nanoseconds>& time_budget = std::nullopt);
 
   /**
    * Add @param rule to the Optimizers rule set. The rule will be set to use the Optimizer's _cost_estimator
    */
   void add_rule(std::unique_ptr<AbstractRule> rule);
 
-  std::shared_ptr<AbstractLQPNode> optimize(std::shared_ptr<AbstractLQPNode> input) const;
+  /**
+   * @param rule_metrics    If set, the duration of each rule (including rules that were skipped) is appended to it
+   */
+  std::shared_ptr<AbstractLQPNode> optimize(
+      std::shared_ptr<AbstractLQPNode> input,
+      const std::shared_ptr<std::vector<OptimizerRuleMetrics>>& rule_metrics = nullptr) const;
 
   static void validate_lqp(const std::shared_ptr<AbstractLQPNode>& root_node);
 
@@ -40,6 +66,8 @@ class Optimizer final {
   std::vector<std::unique_ptr<AbstractRule>> _rules;
   std::shared_ptr<AbstractCostEstimator> _cost_estimator;
 
+  const std::optional<std::chrono::nanoseconds> _time_budget;
+
   void _apply_rule(const AbstractRule& rule, const std::shared_ptr<AbstractLQPNode>& root_node) const;
 };
 
@@ -0,0 +1,30 @@
+#include "optimizer_rule_statistics.hpp"
+
+#include <mutex>
+
+namespace opossum {
+
+std::optional<std::chrono::nanoseconds> OptimizerRuleStatistics::average_duration(const std::string& rule_name) const {
+  const auto lock = std::shared_lock<std::shared_mutex>{_mutex};
+
+  const auto durations_iter = _durations_by_rule.find(rule_name);
+  if (durations_iter == _durations_by_rule.end()) return std::nullopt;
+
+  const auto& durations = durations_iter->second;
+  return durations.total / durations.count;
+}
+
+void OptimizerRuleStatistics::record(const std::string& rule_name, const std::chrono::nanoseconds duration) {
+  const auto lock = std::unique_lock<std::shared_mutex>{_mutex};
+
+  auto& durations = _durations_by_rule[rule_name];
+  durations.total += duration;
+  ++durations.count;
+}
+
+void OptimizerRuleStatistics::clear() {
+  const auto lock = std::unique_lock<std::shared_mutex>{_mutex};
+  _durations_by_rule.clear();
+}
+
+}  // namespace opossum
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <chrono>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Process-wide durations of the optimizer rules, used by Optimizers with a time budget to estimate whether a rule fits
+ * into the remaining budget. Optimizers are created per statement (see Optimizer::create_default_optimizer), so the
+ * durations have to outlive them. Durations are keyed by the rule name, i.e., multiple instances of the same rule
+ * share their statistics.
+ *
+ * The statistics are thread-safe.
+ */
+class OptimizerRuleStatistics : private Noncopyable {
+ public:
+  // Returns std::nullopt if no duration was recorded for @param rule_name yet
+  std::optional<std::chrono::nanoseconds> average_duration(const std::string& rule_name) const;
+
+  void record(const std::string& rule_name, const std::chrono::nanoseconds duration);
+
+  void clear();
+
+ private:
+  struct RuleDurations {
+    std::chrono::nanoseconds total{};
+    size_t count{0};
+  };
+
+  std::unordered_map<std::string, RuleDurations> _durations_by_rule;
+  mutable std::shared_mutex _mutex;
+};
+
+}  // namespace opossum
@@ -13,6 +13,9 @@ class AbstractRule {
  public:
   virtual ~AbstractRule() = default;
 
+  // Name of the rule, e.g., for reporting how much time the Optimizer spent in it
+  virtual std::string name() const = 0;
+
   /**
    * This function applies the concrete Optimizer Rule to an LQP.
    * apply_to() is intended to be called recursively by the concrete rule.
@@ -348,6 +348,10 @@ void BetweenCompositionRule::_replace_predicates(const std::vector<std::shared_p
   }
 }
 
+std::string BetweenCompositionRule::name() const {
+  return "BetweenCompositionRule";
+}
+
 void BetweenCompositionRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) const {
   if (node->type == LQPNodeType::Predicate) {
     std::vector<std::shared_ptr<PredicateNode>> predicate_nodes;
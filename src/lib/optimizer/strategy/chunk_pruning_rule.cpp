@@ -16,11 +16,16 @@
 #include "statistics/statistics_objects/min_max_filter.hpp"
 #include "statistics/statistics_objects/range_filter.hpp"
 #include "statistics/table_statistics.hpp"
+#include "storage/mvcc_data.hpp"
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
 
+std::string ChunkPruningRule::name() const {
+  return "ChunkPruningRule";
+}
+
 void ChunkPruningRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) const {
   // we only want to follow chains of predicates
   if (node->type != LQPNodeType::Predicate) {
@@ -62,10 +67,15 @@ void ChunkPruningRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) co
   auto table = Hyrise::get().storage_manager.get_table(stored_table->table_name);
 
   std::set<ChunkID> pruned_chunk_ids;
+  auto chunk_pruning_column_ids = std::set<ColumnID>{stored_table->chunk_pruning_column_ids().begin(),
+                                                     stored_table->chunk_pruning_column_ids().end()};
   for (auto& predicate : predicate_nodes) {
-    auto new_exclusions = _compute_exclude_list(*table, *predicate->predicate(), stored_table);
+    auto new_exclusions =
+        _compute_exclude_list(*table, *predicate->predicate(), stored_table, chunk_pruning_column_ids);
     pruned_chunk_ids.insert(new_exclusions.begin(), new_exclusions.end());
   }
+  stored_table->set_chunk_pruning_column_ids(
+      std::vector<ColumnID>(chunk_pruning_column_ids.begin(), chunk_pruning_column_ids.end()));
 
   // wanted side effect of using sets: pruned_chunk_ids vector is sorted
   auto& already_pruned_chunk_ids = stored_table->pruned_chunk_ids();
@@ -80,7 +90,8 @@ void ChunkPruningRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) co
 }
 
 std::set<ChunkID> ChunkPruningRule::_compute_exclude_list(const Table& table, const AbstractExpression& predicate,
-                                                          const std::shared_ptr<StoredTableNode>& stored_table_node) {
+                                                          const std::shared_ptr<StoredTableNode>& stored_table_node,
+                                                          std::set<ColumnID>& chunk_pruning_column_ids) {
   // Hacky:
   // `table->table_statistics()` contains AttributeStatistics for all columns, even those that are pruned in
   // `stored_table_node`.
@@ -141,8 +152,15 @@ std::set<ChunkID> ChunkPruningRule::_compute_exclude_list(const Table& table, co
       const auto pruning_statistics = chunk->pruning_statistics();
       if (!pruning_statistics) continue;
 
+      // The statistics do not reflect values that were updated in place (see ColumnVersionStore)
+      if (chunk->has_mvcc_data() &&
+          chunk->mvcc_data()->column_versions.has_stale_pruning_statistics(operator_predicate.column_id)) {
+        continue;
+      }
+
       const auto segment_statistics = (*pruning_statistics)[operator_predicate.column_id];
       if (_can_prune(*segment_statistics, condition, *value, value2)) {
+        chunk_pruning_column_ids.emplace(operator_predicate.column_id);
         const auto& already_pruned_chunk_ids = stored_table_node->pruned_chunk_ids();
         if (std::find(already_pruned_chunk_ids.begin(), already_pruned_chunk_ids.end(), chunk_id) ==
             already_pruned_chunk_ids.end()) {
@@ -26,11 +26,14 @@ class Table;
  */
 class ChunkPruningRule : public AbstractRule {
  public:
+  std::string name() const override;
   void apply_to(const std::shared_ptr<AbstractLQPNode>& node) const override;
 
  protected:
+  // Also adds the ColumnIDs whose pruning statistics were used to prune chunks to chunk_pruning_column_ids
   static std::set<ChunkID> _compute_exclude_list(const Table& table, const AbstractExpression& predicate,
-                                                 const std::shared_ptr<StoredTableNode>& stored_table_node);
+                                                 const std::shared_ptr<StoredTableNode>& stored_table_node,
+                                                 std::set<ColumnID>& chunk_pruning_column_ids);
 
   // Check whether any of the statistics objects available for this Segment identify the predicate as prunable
   static bool _can_prune(const BaseAttributeStatistics& base_segment_statistics,
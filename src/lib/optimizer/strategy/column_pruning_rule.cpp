@@ -256,7 +256,7 @@ void try_join_to_semi_rewrite(
       if (!stored_table_node) return false;
 
       const auto& table = Hyrise::get().storage_manager.get_table(stored_table_node->table_name);
-      for (const auto& table_constraint : table->get_soft_unique_constraints()) {
+      for (const auto& table_constraint : table->get_unique_constraints()) {
         // This currently does not handle multi-column constraints, but that should be easy to add once needed.
         if (table_constraint.columns.size() > 1) continue;
         if (table_constraint.columns[0] == column->original_column_id) {
@@ -319,6 +319,10 @@ void prune_projection_node(
 
 }  // namespace
 
+std::string ColumnPruningRule::name() const {
+  return "ColumnPruningRule";
+}
+
 void ColumnPruningRule::apply_to(const std::shared_ptr<AbstractLQPNode>& lqp) const {
   // For each node, required_expressions_by_node will hold the expressions either needed by this node or by one of its
   // successors (i.e., nodes to which this node is an input). After collecting this information, we walk through all
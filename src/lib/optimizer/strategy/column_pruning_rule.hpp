@@ -20,6 +20,7 @@ class AbstractLQPNode;
 //     exported.
 class ColumnPruningRule : public AbstractRule {
  public:
+  std::string name() const override;
   void apply_to(const std::shared_ptr<AbstractLQPNode>& lqp) const override;
 };
 
@@ -84,6 +84,10 @@ bool reduce_group_by_columns_for_constraint(const TableConstraintDefinition& tab
 
 namespace opossum {
 
+std::string DependentGroupByReductionRule::name() const {
+  return "DependentGroupByReductionRule";
+}
+
 void DependentGroupByReductionRule::apply_to(const std::shared_ptr<AbstractLQPNode>& lqp) const {
   // Store a copy of the root's column expressions.
   const auto root_column_expressions = lqp->column_expressions();
@@ -132,7 +136,7 @@ void DependentGroupByReductionRule::apply_to(const std::shared_ptr<AbstractLQPNo
       auto unique_columns = std::set<ColumnID>();
 
       const auto& table = Hyrise::get().storage_manager.get_table(stored_table_node->table_name);
-      const auto& table_constraints = table->get_soft_unique_constraints();
+      const auto& table_constraints = table->get_unique_constraints();
       if (table_constraints.empty()) {
         // early exit for current table if no constraints are set
         continue;
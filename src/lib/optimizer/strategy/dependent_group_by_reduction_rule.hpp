@@ -44,6 +44,7 @@ class StoredTableNode;
  */
 class DependentGroupByReductionRule : public AbstractRule {
  public:
+  std::string name() const override;
   void apply_to(const std::shared_ptr<AbstractLQPNode>& lqp) const override;
 };
 
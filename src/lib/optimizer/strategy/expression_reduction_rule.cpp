@@ -17,6 +17,10 @@ namespace opossum {
 
 using namespace opossum::expression_functional;  // NOLINT
 
+std::string ExpressionReductionRule::name() const {
+  return "ExpressionReductionRule";
+}
+
 void ExpressionReductionRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) const {
   Assert(node->type == LQPNodeType::Root, "ExpressionReductionRule needs root to hold onto");
 
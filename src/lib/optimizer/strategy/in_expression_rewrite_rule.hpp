@@ -25,6 +25,8 @@ class InExpressionRewriteRule : public AbstractRule {
   // With the auto strategy, IN expressions with MIN_ELEMENTS_FOR_JOIN or more are rewritten into semi joins.
   constexpr static auto MIN_ELEMENTS_FOR_JOIN = 20;
 
+  std::string name() const override;
+
   void apply_to(const std::shared_ptr<AbstractLQPNode>& node) const override;
 
   // Instead of using the automatic behavior described above, the three strategies may be chosen explicitly, too. This
@@ -4,18 +4,24 @@
 #include <iostream>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "all_parameter_variant.hpp"
 #include "constant_mappings.hpp"
 #include "cost_estimation/abstract_cost_estimator.hpp"
+#include "expression/expression_utils.hpp"
+#include "expression/logical_expression.hpp"
+#include "hyrise.hpp"
 #include "logical_query_plan/abstract_lqp_node.hpp"
 #include "logical_query_plan/lqp_utils.hpp"
 #include "logical_query_plan/predicate_node.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
 #include "operators/operator_scan_predicate.hpp"
 #include "statistics/cardinality_estimator.hpp"
+#include "storage/index/table_hash/table_hash_index.hpp"
 #include "utils/assert.hpp"
+#include "utils/column_ids_after_pruning.hpp"
 
 namespace opossum {
 
@@ -28,10 +34,26 @@ constexpr float INDEX_SCAN_SELECTIVITY_THRESHOLD = 0.01f;
 // The number is taken from: Fast Lookups for In-Memory Column Stores: Group-Key Indices, Lookup and Maintenance.
 constexpr float INDEX_SCAN_ROW_COUNT_THRESHOLD = 1000.0f;
 
+std::string IndexScanRule::name() const {
+  return "IndexScanRule";
+}
+
 void IndexScanRule::apply_to(const std::shared_ptr<AbstractLQPNode>& root) const {
   DebugAssert(cost_estimator, "IndexScanRule requires cost estimator to be set");
   Assert(root->type == LQPNodeType::Root, "ExpressionReductionRule needs root to hold onto");
 
+  auto stored_table_nodes = std::vector<std::shared_ptr<StoredTableNode>>{};
+  visit_lqp(root, [&](const auto& node) {
+    if (node->type == LQPNodeType::StoredTable) {
+      stored_table_nodes.emplace_back(std::static_pointer_cast<StoredTableNode>(node));
+    }
+    return LQPVisitation::VisitInputs;
+  });
+
+  for (const auto& stored_table_node : stored_table_nodes) {
+    _apply_table_hash_index_lookups(stored_table_node);
+  }
+
   visit_lqp(root, [&](const auto& node) {
     if (node->type == LQPNodeType::Predicate) {
       const auto& child = node->left_input();
@@ -53,6 +75,74 @@ void IndexScanRule::apply_to(const std::shared_ptr<AbstractLQPNode>& root) const
   });
 }
 
+void IndexScanRule::_apply_table_hash_index_lookups(const std::shared_ptr<StoredTableNode>& stored_table_node) {
+  const auto table = Hyrise::get().storage_manager.get_table(stored_table_node->table_name);
+  if (table->table_hash_indexes().empty()) return;
+
+  const auto column_id_mapping =
+      column_ids_after_pruning(table->column_count(), stored_table_node->pruned_column_ids());
+
+  // Copy the outputs, as we modify the LQP below
+  const auto outputs = stored_table_node->outputs();
+  for (const auto& output : outputs) {
+    // Collect the PredicateNodes that are applied to the table before any other operation. As all predicates of such
+    // a chain are applied to the rows before they reach the end of the chain, the predicates can be reordered.
+    // However, as other nodes might consume the result of a node with multiple outputs, the chain ends there.
+    auto chain = std::vector<std::shared_ptr<AbstractLQPNode>>{};
+    auto predicate_nodes_by_column_id = std::unordered_map<ColumnID, std::shared_ptr<PredicateNode>>{};
+    for (auto node = output; node->type == LQPNodeType::Predicate || node->type == LQPNodeType::Validate;
+         node = node->outputs().front()) {
+      chain.emplace_back(node);
+
+      if (const auto predicate_node = std::dynamic_pointer_cast<PredicateNode>(node)) {
+        const auto operator_predicates =
+            OperatorScanPredicate::from_expression(*predicate_node->predicate(), *predicate_node);
+        if (operator_predicates && operator_predicates->size() == 1) {
+          const auto& operator_predicate = operator_predicates->front();
+          if (operator_predicate.predicate_condition == PredicateCondition::Equals &&
+              is_variant(operator_predicate.value) &&
+              !variant_is_null(boost::get<AllTypeVariant>(operator_predicate.value))) {
+            // If there are multiple predicates on the same column, the first one is used for the lookup
+            predicate_nodes_by_column_id.emplace(operator_predicate.column_id, predicate_node);
+          }
+        }
+      }
+
+      if (node->output_count() != 1) break;
+    }
+
+    if (chain.empty()) continue;
+
+    for (const auto& table_hash_index : table->table_hash_indexes()) {
+      auto key_predicate_nodes = std::vector<std::shared_ptr<PredicateNode>>{};
+      for (const auto stored_column_id : table_hash_index->column_ids()) {
+        const auto column_id = column_id_mapping[stored_column_id];
+        if (!column_id) break;
+
+        const auto predicate_node_iter = predicate_nodes_by_column_id.find(*column_id);
+        if (predicate_node_iter == predicate_nodes_by_column_id.end()) break;
+        key_predicate_nodes.emplace_back(predicate_node_iter->second);
+      }
+      if (key_predicate_nodes.size() != table_hash_index->column_ids().size()) continue;
+
+      // Merge the predicates on the key columns into a single PredicateNode directly above the StoredTableNode
+      auto key_predicates = std::vector<std::shared_ptr<AbstractExpression>>{};
+      for (const auto& key_predicate_node : key_predicate_nodes) {
+        key_predicates.emplace_back(key_predicate_node->predicate());
+      }
+
+      const auto lookup_node = PredicateNode::make(inflate_logical_expressions(key_predicates, LogicalOperator::And));
+      lookup_node->scan_type = ScanType::IndexScan;
+      lqp_insert_node(chain.front(), LQPInputSide::Left, lookup_node);
+
+      for (const auto& key_predicate_node : key_predicate_nodes) {
+        lqp_remove_node(key_predicate_node);
+      }
+      break;
+    }
+  }
+}
+
 bool IndexScanRule::_is_index_scan_applicable(const IndexStatistics& index_statistics,
                                               const std::shared_ptr<PredicateNode>& predicate_node) const {
   if (!_is_single_segment_index(index_statistics)) return false;
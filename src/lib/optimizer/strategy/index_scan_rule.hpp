@@ -12,6 +12,7 @@ namespace opossum {
 
 class AbstractLQPNode;
 class PredicateNode;
+class StoredTableNode;
 
 /**
  * This optimizer rule finds PredicateNodes whose inputs are StoredTableNodes. These PredicateNodes are candidates
@@ -23,13 +24,20 @@ class PredicateNode;
  * not supported. We also assume that if chunks have an index, all of them are of the same type, we do not mix GroupKey
  * and ART indexes. In addition, chains of IndexScans are not possible since an IndexScan's input must be a GetTable.
  * Currently, only GroupKeyIndexes are supported.
+ *
+ * Independently of the selectivity, conjunctions of `column = value` predicates that cover all columns of a
+ * TableHashIndex are turned into a point lookup. For this, the rule looks at the chain of PredicateNodes (and
+ * ValidateNodes) above a StoredTableNode, merges the matching predicates into a single PredicateNode directly on top
+ * of the StoredTableNode, and sets its ScanType to IndexScan.
  */
 
 class IndexScanRule : public AbstractRule {
  public:
+  std::string name() const override;
   void apply_to(const std::shared_ptr<AbstractLQPNode>& root) const override;
 
  protected:
+  static void _apply_table_hash_index_lookups(const std::shared_ptr<StoredTableNode>& stored_table_node);
   bool _is_index_scan_applicable(const IndexStatistics& index_statistics,
                                  const std::shared_ptr<PredicateNode>& predicate_node) const;
   static bool _is_single_segment_index(const IndexStatistics& index_statistics);
@@ -6,6 +6,7 @@
 #include "optimizer/join_ordering/dp_ccp.hpp"
 #include "optimizer/join_ordering/greedy_operator_ordering.hpp"
 #include "optimizer/join_ordering/join_graph.hpp"
+#include "optimizer/join_ordering/linearized_dp.hpp"
 #include "statistics/abstract_cardinality_estimator.hpp"
 #include "statistics/cardinality_estimation_cache.hpp"
 #include "statistics/table_statistics.hpp"
@@ -13,6 +14,10 @@
 
 namespace opossum {
 
+std::string JoinOrderingRule::name() const {
+  return "JoinOrderingRule";
+}
+
 void JoinOrderingRule::apply_to(const std::shared_ptr<AbstractLQPNode>& root) const {
   DebugAssert(cost_estimator, "JoinOrderingRule requires cost estimator to be set");
 
@@ -65,12 +70,16 @@ std::shared_ptr<AbstractLQPNode> JoinOrderingRule::_perform_join_ordering_recurs
 
   /**
    * Select and call the actual Join Ordering Algorithm
-   * Simple heuristic: Use DpCcp for any query with less than X tables and GOO for everything more complex
+   * Use DpCcp if the JoinGraph is small enough for an exhaustive search, LinearizedDp if its polynomial number of
+   * candidate joins is affordable, and GOO for everything more complex.
    */
-  // TODO(anybody) Increase X once our costing/cardinality estimation is faster/uses internal caching
   auto result_lqp = std::shared_ptr<AbstractLQPNode>{};
-  if (join_graph->vertices.size() < 9) {
-    result_lqp = DpCcp{}(*join_graph, caching_cost_estimator);  // NOLINT - doesn't like `{}()`
+  if (join_graph->vertices.size() <= MAX_LINEARIZED_DP_VERTEX_COUNT) {
+    // DpCcp returns nullptr if the JoinGraph has too many candidate joins
+    result_lqp = DpCcp{MAX_DP_CCP_CSG_CMP_PAIR_COUNT}(*join_graph, caching_cost_estimator);  // NOLINT
+    if (!result_lqp) {
+      result_lqp = LinearizedDp{}(*join_graph, caching_cost_estimator);  // NOLINT - doesn't like `{}()`
+    }
   } else {
     result_lqp = GreedyOperatorOrdering{}(*join_graph, caching_cost_estimator);  // NOLINT - doesn't like `{}()`
   }
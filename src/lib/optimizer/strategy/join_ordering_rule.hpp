@@ -10,13 +10,21 @@ class AbstractCostEstimator;
 
 /**
  * A rule that brings join operations into a (supposedly) efficient order.
- * Currently only the order of inner joins is modified using a single underlying algorithm, DpCcp.
- *
- * TODO(anybody) Use a different join ordering algorithm, such as GreedyOperatorOrdering, if there are too many join
- *               operations for DPccp to handle efficiently.
+ * Currently only the order of inner joins is modified. Depending on the size of the JoinGraph, one of three algorithms
+ * is used, in the spirit of "Adaptive Optimization of Very Large Join Queries" (Neumann and Radke, SIGMOD 2018):
+ *   - DpCcp, which finds the optimal plan, if it needs to consider at most MAX_DP_CCP_CSG_CMP_PAIR_COUNT candidate
+ *     joins. This covers, e.g., all JoinGraphs with up to eight vertices and chains of up to 30 vertices.
+ *   - LinearizedDp, which needs O(n^3) candidate joins, for up to MAX_LINEARIZED_DP_VERTEX_COUNT vertices.
+ *   - GreedyOperatorOrdering for even larger JoinGraphs.
+ * These budgets bound the optimization time of queries with many joins.
  */
 class JoinOrderingRule : public AbstractRule {
  public:
+  static constexpr auto MAX_DP_CCP_CSG_CMP_PAIR_COUNT = size_t{5'000};
+  static constexpr auto MAX_LINEARIZED_DP_VERTEX_COUNT = size_t{32};
+
+  std::string name() const override;
+
   void apply_to(const std::shared_ptr<AbstractLQPNode>& root) const override;
 
  private:
@@ -12,6 +12,10 @@
 
 namespace opossum {
 
+std::string JoinPredicateOrderingRule::name() const {
+  return "JoinPredicateOrderingRule";
+}
+
 void JoinPredicateOrderingRule::apply_to(const std::shared_ptr<AbstractLQPNode>& root) const {
   visit_lqp(root, [&](const auto& node) {
     // Check if this is a multi predicate join.
@@ -18,6 +18,7 @@ namespace opossum {
  */
 class JoinPredicateOrderingRule : public AbstractRule {
  public:
+  std::string name() const override;
   void apply_to(const std::shared_ptr<AbstractLQPNode>& root) const override;
 };
 
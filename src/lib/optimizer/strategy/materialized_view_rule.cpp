@@ -0,0 +1,133 @@
+#include "materialized_view_rule.hpp"
+
+#include <algorithm>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "expression/expression_utils.hpp"
+#include "hyrise.hpp"
+#include "logical_query_plan/alias_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
+#include "storage/materialized_view.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+thread_local auto scoped_snapshot_commit_id = std::optional<CommitID>{};
+thread_local auto scope_used_views = false;
+
+struct Candidate {
+  std::shared_ptr<const AbstractLQPNode> node;
+
+  // For each column of the node, the column of the view that stores it
+  std::vector<ColumnID> view_column_ids;
+};
+
+std::vector<Candidate> find_candidates(const std::shared_ptr<AbstractLQPNode>& view_lqp) {
+  auto candidates = std::vector<Candidate>{};
+  const auto view_expressions = view_lqp->column_expressions();
+
+  auto node = view_lqp;
+  // Replacing single stored tables by views gains nothing
+  while (node && node->type != LQPNodeType::Validate && node->type != LQPNodeType::StoredTable) {
+    auto candidate = Candidate{node, {}};
+    for (const auto& expression : node->column_expressions()) {
+      const auto view_expression_iter =
+          std::find_if(view_expressions.begin(), view_expressions.end(),
+                       [&](const auto& view_expression) { return *view_expression == *expression; });
+      if (view_expression_iter == view_expressions.end()) break;
+
+      candidate.view_column_ids.emplace_back(
+          static_cast<ColumnID>(std::distance(view_expressions.begin(), view_expression_iter)));
+    }
+    if (candidate.view_column_ids.size() == node->column_expressions().size()) {
+      candidates.emplace_back(std::move(candidate));
+    }
+
+    if (node->type != LQPNodeType::Alias && node->type != LQPNodeType::Projection) break;
+    node = node->left_input();
+  }
+
+  return candidates;
+}
+
+}  // namespace
+
+namespace opossum {
+
+MaterializedViewRule::SnapshotScope::SnapshotScope(const CommitID snapshot_commit_id)
+    : _previous_snapshot_commit_id(scoped_snapshot_commit_id), _previously_used_views(scope_used_views) {
+  scoped_snapshot_commit_id = snapshot_commit_id;
+  scope_used_views = false;
+}
+
+MaterializedViewRule::SnapshotScope::~SnapshotScope() {
+  scoped_snapshot_commit_id = _previous_snapshot_commit_id;
+  scope_used_views = _previously_used_views;
+}
+
+bool MaterializedViewRule::SnapshotScope::used_views() const { return scope_used_views; }
+
+std::string MaterializedViewRule::name() const {
+  return "MaterializedViewRule";
+}
+
+void MaterializedViewRule::apply_to(const std::shared_ptr<AbstractLQPNode>& root) const {
+  // Views must not be read while they are computed. Without a snapshot, the rule cannot tell whether the contents of a
+  // view match what the executing transaction would see in the base tables.
+  if (MaterializedView::is_maintaining() || !scoped_snapshot_commit_id) return;
+
+  auto view_candidates = std::vector<std::pair<std::string, std::vector<Candidate>>>{};
+  for (const auto& [view_name, materialized_view] : Hyrise::get().storage_manager.materialized_views()) {
+    if (!materialized_view || !materialized_view->is_up_to_date(*scoped_snapshot_commit_id)) continue;
+
+    view_candidates.emplace_back(view_name, find_candidates(materialized_view->view->lqp));
+  }
+  if (view_candidates.empty()) return;
+
+  visit_lqp(root, [&](const auto& node) {
+    for (const auto& [view_name, candidates] : view_candidates) {
+      for (const auto& candidate : candidates) {
+        if (!(*node == *candidate.node)) continue;
+
+        const auto stored_table_node = StoredTableNode::make(view_name);
+        const auto view_columns = stored_table_node->column_expressions();
+        const auto node_columns = node->column_expressions();
+
+        // Keep the names of the columns, as they might be the output of the query
+        auto expressions = std::vector<std::shared_ptr<AbstractExpression>>{};
+        auto aliases = std::vector<std::string>{};
+        auto expression_mapping = ExpressionUnorderedMap<std::shared_ptr<AbstractExpression>>{};
+        for (auto column_id = ColumnID{0}; column_id < node_columns.size(); ++column_id) {
+          const auto& view_column = view_columns[candidate.view_column_ids[column_id]];
+          expressions.emplace_back(view_column);
+          aliases.emplace_back(node->type == LQPNodeType::Alias
+                                   ? static_cast<const AliasNode&>(*node).aliases[column_id]
+                                   : node_columns[column_id]->as_column_name());
+          expression_mapping.emplace(node_columns[column_id], view_column);
+        }
+
+        lqp_replace_node(node, AliasNode::make(expressions, aliases, ValidateNode::make(stored_table_node)));
+        scope_used_views = true;
+
+        // Let the nodes above refer to the columns of the view
+        visit_lqp(root, [&](const auto& other_node) {
+          for (auto& expression : other_node->node_expressions) {
+            expression_deep_replace(expression, expression_mapping);
+          }
+          return LQPVisitation::VisitInputs;
+        });
+
+        return LQPVisitation::DoNotVisitInputs;
+      }
+    }
+
+    return LQPVisitation::VisitInputs;
+  });
+}
+
+}  // namespace opossum
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "abstract_rule.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+
+/**
+ * Rewrites plans to read materialized views (see MaterializedView) instead of computing them. A subplan is replaced if
+ * it equals the LQP of a materialized view or one of the nodes below the view's top-most aliases and projections, as
+ * long as all of the subplan's columns are stored in the view. For example, for the view
+ *
+ *   v: SELECT a, SUM(b) AS s FROM t GROUP BY a
+ *
+ * the aggregate of "SELECT SUM(b), a FROM t GROUP BY a HAVING SUM(b) > 10" is replaced by a read of v.
+ *
+ * Views are only used while a SnapshotScope is alive and only if their visible contents reflect the base tables as of
+ * the snapshot of the executing transaction. Views never contain uncommitted modifications. Thus, the
+ * SQLPipelineStatement opens a SnapshotScope only for auto-commit transactions, which cannot have modified anything
+ * before the statement is optimized. Statements within explicit transactions do not use views.
+ */
+class MaterializedViewRule : public AbstractRule {
+ public:
+  // Sets the snapshot of the transaction that will execute the plans optimized on the current thread while in scope
+  class SnapshotScope : private Noncopyable {
+   public:
+    explicit SnapshotScope(const CommitID snapshot_commit_id);
+    ~SnapshotScope();
+
+    // Whether a view was used in this scope. Such plans are only valid for this snapshot and must not be cached.
+    bool used_views() const;
+
+   private:
+    const std::optional<CommitID> _previous_snapshot_commit_id;
+    const bool _previously_used_views;
+  };
+
+  std::string name() const override;
+  void apply_to(const std::shared_ptr<AbstractLQPNode>& root) const override;
+};
+
+}  // namespace opossum
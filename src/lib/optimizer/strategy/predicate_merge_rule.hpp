@@ -20,6 +20,7 @@ namespace opossum {
  */
 class PredicateMergeRule : public AbstractRule {
  public:
+  std::string name() const override;
   void apply_to(const std::shared_ptr<AbstractLQPNode>& root) const override;
 
   size_t minimum_union_count{4};
@@ -17,6 +17,10 @@
 
 namespace opossum {
 
+std::string PredicatePlacementRule::name() const {
+  return "PredicatePlacementRule";
+}
+
 void PredicatePlacementRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) const {
   // The traversal functions require the existence of a root of the LQP, so make sure we have that
   const auto root_node = node->type == LQPNodeType::Root ? node : LogicalPlanRootNode::make(node);
@@ -20,6 +20,7 @@ class PredicateNode;
  */
 class PredicatePlacementRule : public AbstractRule {
  public:
+  std::string name() const override;
   void apply_to(const std::shared_ptr<AbstractLQPNode>& node) const override;
 
  private:
@@ -45,6 +45,10 @@ bool is_predicate_style_node(const std::shared_ptr<AbstractLQPNode>& node) {
 
 namespace opossum {
 
+std::string PredicateReorderingRule::name() const {
+  return "PredicateReorderingRule";
+}
+
 void PredicateReorderingRule::apply_to(const std::shared_ptr<AbstractLQPNode>& root) const {
   DebugAssert(cost_estimator, "PredicateReorderingRule requires cost estimator to be set");
   Assert(root->type == LQPNodeType::Root, "PredicateReorderingRule needs root to hold onto");
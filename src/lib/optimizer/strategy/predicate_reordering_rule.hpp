@@ -25,6 +25,7 @@ class PredicateNode;
  */
 class PredicateReorderingRule : public AbstractRule {
  public:
+  std::string name() const override;
   void apply_to(const std::shared_ptr<AbstractLQPNode>& root) const override;
 
  private:
@@ -9,6 +9,10 @@ namespace opossum {
 
 PredicateSplitUpRule::PredicateSplitUpRule(const bool split_disjunctions) : _split_disjunctions(split_disjunctions) {}
 
+std::string PredicateSplitUpRule::name() const {
+  return "PredicateSplitUpRule";
+}
+
 void PredicateSplitUpRule::apply_to(const std::shared_ptr<AbstractLQPNode>& root) const {
   Assert(root->type == LQPNodeType::Root, "PredicateSplitUpRule needs root to hold onto");
 
@@ -27,6 +27,7 @@ namespace opossum {
 class PredicateSplitUpRule : public AbstractRule {
  public:
   explicit PredicateSplitUpRule(const bool split_disjunctions = true);
+  std::string name() const override;
   void apply_to(const std::shared_ptr<AbstractLQPNode>& root) const override;
 
  private:
@@ -7,6 +7,10 @@
 #include "statistics/abstract_cardinality_estimator.hpp"
 
 namespace opossum {
+std::string SemiJoinReductionRule::name() const {
+  return "SemiJoinReductionRule";
+}
+
 void SemiJoinReductionRule::apply_to(const std::shared_ptr<AbstractLQPNode>& root) const {
   Assert(root->type == LQPNodeType::Root, "ExpressionReductionRule needs root to hold onto");
 
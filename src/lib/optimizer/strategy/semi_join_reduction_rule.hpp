@@ -45,6 +45,7 @@ class PredicateNode;
 
 class SemiJoinReductionRule : public AbstractRule {
  public:
+  std::string name() const override;
   void apply_to(const std::shared_ptr<AbstractLQPNode>& root) const override;
 
   // Defines the minimum selectivity for a semi join reduction to be added. For a candidate location in the LQP with an
@@ -14,6 +14,7 @@
 #include "storage/reference_segment.hpp"
 #include "storage/resolve_encoded_segment_type.hpp"
 #include "storage/value_segment.hpp"
+#include "storage/versioned_segment.hpp"
 #include "utils/assert.hpp"
 
 #include "storage/pos_lists/entire_chunk_pos_list.hpp"
@@ -115,6 +116,7 @@ std::enable_if_t<std::is_same_v<BaseSegment, std::remove_const_t<BaseSegmentType
   using ValueSegmentPtr = ConstOutIfConstIn<BaseSegmentType, ValueSegment<ColumnDataType>>*;
   using ReferenceSegmentPtr = ConstOutIfConstIn<BaseSegmentType, ReferenceSegment>*;
   using EncodedSegmentPtr = ConstOutIfConstIn<BaseSegmentType, BaseEncodedSegment>*;
+  using VersionedSegmentPtr = ConstOutIfConstIn<BaseSegmentType, VersionedSegment<ColumnDataType>>*;
 
   if (const auto value_segment = dynamic_cast<ValueSegmentPtr>(&segment)) {
     functor(*value_segment);
@@ -122,6 +124,8 @@ std::enable_if_t<std::is_same_v<BaseSegment, std::remove_const_t<BaseSegmentType
     functor(*reference_segment);
   } else if (const auto encoded_segment = dynamic_cast<EncodedSegmentPtr>(&segment)) {
     resolve_encoded_segment_type<ColumnDataType>(*encoded_segment, functor);
+  } else if (const auto versioned_segment = dynamic_cast<VersionedSegmentPtr>(&segment)) {
+    functor(*versioned_segment);
   } else {
     Fail("Unrecognized column type encountered.");
   }
@@ -2,6 +2,10 @@
 
 namespace opossum {
 
-void JobTask::_on_execute() { _fn(); }
+void JobTask::_on_execute() {
+  const auto hardware_counter_scope = HardwareCounterScope{_hardware_counter_accumulator};
+  const auto memory_tracking_scope = MemoryTrackingScope{_memory_tracker};
+  _fn();
+}
 
 }  // namespace opossum
@@ -3,6 +3,8 @@
 #include <functional>
 
 #include "abstract_task.hpp"
+#include "memory/memory_tracker.hpp"
+#include "utils/hardware_counters.hpp"
 
 namespace opossum {
 
@@ -37,5 +39,12 @@ class JobTask : public AbstractTask {
 
  private:
   std::function<void()> _fn;
+
+  // Attributes the hardware counters of the job to the operator that created it (if counting is enabled)
+  const std::shared_ptr<HardwareCounterAccumulator> _hardware_counter_accumulator =
+      HardwareCounterScope::current_accumulator();
+
+  // Attributes the memory allocated by the job to the operator that created it
+  const std::shared_ptr<MemoryTracker> _memory_tracker = MemoryTrackingScope::current_tracker();
 };
 }  // namespace opossum
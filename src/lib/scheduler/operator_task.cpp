@@ -55,6 +55,9 @@ std::shared_ptr<OperatorTask> OperatorTask::_add_tasks_from_operator(
 const std::shared_ptr<AbstractOperator>& OperatorTask::get_operator() const { return _op; }
 
 void OperatorTask::_on_execute() {
+  // Also covers the release of the inputs below, which is credited to the statement
+  const auto memory_tracking_scope = MemoryTrackingScope{_memory_tracker};
+
   auto context = _op->transaction_context();
   if (context) {
     switch (context->phase()) {
@@ -81,8 +84,21 @@ void OperatorTask::_on_execute() {
     }
   }
 
+  // Once the statement exceeded its memory limit, its remaining operators are skipped. This also applies to statements
+  // without a transaction, which then fail in the SQLPipelineStatement.
+  if (_memory_tracker && _memory_tracker->limit_exceeded()) {
+    _abort_after_memory_limit_exceeded();
+    return;
+  }
+
   DTRACE_PROBE2(HYRISE, OPERATOR_TASKS, reinterpret_cast<uintptr_t>(_op.get()), reinterpret_cast<uintptr_t>(this));
-  _op->execute();
+  try {
+    _op->execute();
+  } catch (const MemoryLimitExceededException&) {
+    // Memory-intensive operators stop between their phases once the limit is exceeded
+    _abort_after_memory_limit_exceeded();
+    return;
+  }
 
   /**
    * Check whether the operator is a ReadWrite operator, and if it is, whether it failed.
@@ -95,6 +111,12 @@ void OperatorTask::_on_execute() {
     context->rollback(RollbackReason::Conflict);
   }
 
+  // If the statement exceeded its memory limit while the operator was executed, abort it so that the remaining
+  // operators are skipped and the statement fails
+  if (_memory_tracker && _memory_tracker->limit_exceeded()) {
+    _abort_after_memory_limit_exceeded();
+  }
+
   // Get rid of temporary tables that are not needed anymore
   // Because `clear_output` is only called by the successive OperatorTasks, we can be sure that no one cleans up the
   // root (i.e., the final result)
@@ -113,4 +135,13 @@ void OperatorTask::_on_execute() {
     if (!previous_operator_still_needed) predecessor->get_operator()->clear_output();
   }
 }
+
+void OperatorTask::_abort_after_memory_limit_exceeded() {
+  // Only the first task that notices the exceeded limit rolls back the transaction
+  const auto context = _op->transaction_context();
+  if (context && context->phase() == TransactionPhase::Active && _memory_tracker->report_limit_exceeded()) {
+    context->rollback(RollbackReason::OutOfMemory);
+  }
+}
+
 }  // namespace opossum
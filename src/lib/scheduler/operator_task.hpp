@@ -4,6 +4,7 @@
 #include <unordered_map>
 #include <vector>
 
+#include "memory/memory_tracker.hpp"
 #include "scheduler/abstract_task.hpp"
 
 namespace opossum {
@@ -41,6 +42,13 @@ class OperatorTask : public AbstractTask {
       std::unordered_map<std::shared_ptr<AbstractOperator>, std::shared_ptr<OperatorTask>>& task_by_op);
 
  private:
+  // Rolls back the transaction of the operator (if any) with RollbackReason::OutOfMemory
+  void _abort_after_memory_limit_exceeded();
+
   std::shared_ptr<AbstractOperator> _op;
+
+  // Tracks the memory of the statement that created the task (see SQLPipelineStatement::get_tasks()), if any. The
+  // operator's own tracker is a child of it.
+  const std::shared_ptr<MemoryTracker> _memory_tracker = MemoryTrackingScope::current_tracker();
 };
 }  // namespace opossum
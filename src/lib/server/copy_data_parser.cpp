@@ -0,0 +1,271 @@
+#include "copy_data_parser.hpp"
+
+#include <boost/endian/conversion.hpp>
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "hyrise.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Signature, flags field, and header extension length field of the binary format
+constexpr auto BINARY_SIGNATURE = std::string_view{"PGCOPY\n\377\r\n\0", 11};
+constexpr auto BINARY_HEADER_SIZE = BINARY_SIGNATURE.size() + 2 * sizeof(int32_t);
+
+// Bit 16 of the flags field indicates that the rows contain OIDs
+constexpr auto BINARY_HAS_OIDS_FLAG = uint32_t{1} << 16u;
+
+template <typename T>
+T read_big_endian(const char* data) {
+  if constexpr (std::is_floating_point_v<T>) {
+    using IntegerType = std::conditional_t<sizeof(T) == sizeof(uint32_t), uint32_t, uint64_t>;
+    const auto bits = read_big_endian<IntegerType>(data);
+    auto value = T{};
+    std::memcpy(&value, &bits, sizeof(T));
+    return value;
+  } else {
+    auto value = T{};
+    std::memcpy(&value, data, sizeof(T));
+    return boost::endian::big_to_native(value);
+  }
+}
+
+template <typename T>
+T decode_binary_value(const std::string_view value) {
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    return pmr_string{value};
+  } else {
+    AssertInput(value.size() == sizeof(T), "Binary COPY value of " + std::to_string(value.size()) +
+                                               " bytes does not match the column type");
+    return read_big_endian<T>(value.data());
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+CopyDataParser::CopyDataParser(const TableColumnDefinitions& column_definitions, const CopyFormat format,
+                               const ChunkOffset chunk_size)
+    : _format(format), _table(std::make_shared<Table>(column_definitions, TableType::Data, chunk_size)) {
+  // PostgreSQL writes unquoted empty fields for NULL values and accepts quoted numbers. Unquoted "null" strings are
+  // values.
+  _csv_meta.config.null_handling = NullHandling::NullStringAsValue;
+  _csv_meta.config.reject_quoted_nonstrings = false;
+}
+
+CopyDataParser::~CopyDataParser() {
+  if (!_tasks.empty()) Hyrise::get().scheduler()->wait_for_tasks(_tasks);
+}
+
+void CopyDataParser::append(const std::string& data) {
+  _buffer.append(data);
+
+  if (_format == CopyFormat::Csv) {
+    _find_csv_rows();
+  } else {
+    if (!_binary_header_read) _read_binary_header();
+    if (_binary_header_read) _find_binary_rows();
+  }
+
+  if (_complete_rows_end >= PARSING_TASK_BYTES) _schedule_parsing();
+}
+
+std::shared_ptr<Table> CopyDataParser::finish() {
+  if (_format == CopyFormat::Csv) {
+    AssertInput(!_in_quotes, "Unterminated quoted field in COPY data");
+    // Like CsvParser::parse, accept a last row without a delimiter
+    if (_complete_rows_end < _buffer.size()) {
+      _buffer.push_back(_csv_meta.config.delimiter);
+      _complete_rows_end = _buffer.size();
+    }
+  } else {
+    AssertInput(_buffer.empty() || _binary_header_read, "Incomplete header in binary COPY data");
+    AssertInput(_complete_rows_end == _buffer.size() || _binary_trailer_read, "Incomplete row in binary COPY data");
+  }
+
+  _schedule_parsing();
+  Hyrise::get().scheduler()->wait_for_tasks(_tasks);
+  _tasks.clear();
+
+  for (auto& parsed_chunk : _parsed_chunks) {
+    if (parsed_chunk.exception) std::rethrow_exception(parsed_chunk.exception);
+
+    auto& segments = parsed_chunk.segments;
+    if (segments.empty() || segments.front()->size() == 0) continue;
+    _table->append_chunk(segments);
+  }
+  _parsed_chunks.clear();
+  _scheduled_data.clear();
+
+  return _table;
+}
+
+void CopyDataParser::_find_csv_rows() {
+  const auto quote = _csv_meta.config.quote;
+  const auto delimiter = _csv_meta.config.delimiter;
+
+  // Escaped quotes within quoted fields are doubled (quote and escape character are the same), so toggling the state
+  // for each quote character is sufficient.
+  for (; _scanned_bytes < _buffer.size(); ++_scanned_bytes) {
+    const auto character = _buffer[_scanned_bytes];
+    if (character == quote) {
+      _in_quotes = !_in_quotes;
+    } else if (character == delimiter && !_in_quotes) {
+      _complete_rows_end = _scanned_bytes + 1;
+    }
+  }
+}
+
+void CopyDataParser::_read_binary_header() {
+  if (_buffer.size() < BINARY_HEADER_SIZE) return;
+
+  AssertInput(std::string_view{_buffer}.substr(0, BINARY_SIGNATURE.size()) == BINARY_SIGNATURE,
+              "Invalid signature of binary COPY data");
+  const auto flags = read_big_endian<uint32_t>(&_buffer[BINARY_SIGNATURE.size()]);
+  AssertInput(!(flags & BINARY_HAS_OIDS_FLAG), "Binary COPY data with OIDs is not supported");
+
+  const auto extension_length = read_big_endian<uint32_t>(&_buffer[BINARY_SIGNATURE.size() + sizeof(uint32_t)]);
+  if (_buffer.size() < BINARY_HEADER_SIZE + extension_length) return;
+
+  _buffer.erase(0, BINARY_HEADER_SIZE + extension_length);
+  _binary_header_read = true;
+}
+
+void CopyDataParser::_find_binary_rows() {
+  const auto column_count = _table->column_count();
+
+  while (!_binary_trailer_read) {
+    auto position = _scanned_bytes;
+
+    if (position + sizeof(int16_t) > _buffer.size()) return;
+    const auto field_count = read_big_endian<int16_t>(&_buffer[position]);
+    position += sizeof(int16_t);
+
+    // The trailer is a field count of -1. Data after it is ignored.
+    if (field_count == -1) {
+      _binary_trailer_read = true;
+      return;
+    }
+    AssertInput(field_count == column_count, "Number of fields in binary COPY data does not match number of columns");
+
+    for (auto field_idx = int16_t{0}; field_idx < field_count; ++field_idx) {
+      if (position + sizeof(int32_t) > _buffer.size()) return;
+      const auto field_length = read_big_endian<int32_t>(&_buffer[position]);
+      AssertInput(field_length >= -1, "Invalid field length in binary COPY data: " + std::to_string(field_length));
+      position += sizeof(int32_t);
+
+      // NULL values have a length of -1 and no data
+      if (field_length > 0) position += field_length;
+      if (position > _buffer.size()) return;
+    }
+
+    _scanned_bytes = position;
+    _complete_rows_end = position;
+    ++_complete_row_count;
+
+    if (_complete_row_count == _table->target_chunk_size()) _schedule_parsing();
+  }
+}
+
+void CopyDataParser::_schedule_parsing() {
+  if (_complete_rows_end == 0) return;
+
+  auto& data = _scheduled_data.emplace_back(_buffer, 0, _complete_rows_end);
+  _buffer.erase(0, _complete_rows_end);
+  _scanned_bytes -= _complete_rows_end;
+  _complete_rows_end = 0;
+
+  // A COPY may send gigabytes before finish() is called, so the data is not kept until then
+  const auto release_task = std::make_shared<JobTask>([&data]() { std::string{}.swap(data); });
+
+  if (_format == CopyFormat::Csv) {
+    const auto tasks = CsvParser::schedule_parsing_tasks(data, *_table, _csv_meta, _parsed_chunks, release_task);
+    _tasks.insert(_tasks.end(), tasks.begin(), tasks.end());
+  } else {
+    _parsed_chunks.emplace_back();
+    auto& parsed_chunk = _parsed_chunks.back();
+    const auto& table = *_table;
+    const auto row_count = _complete_row_count;
+
+    _tasks.emplace_back(std::make_shared<JobTask>([&data, row_count, &table, &parsed_chunk]() {
+      try {
+        _parse_binary_rows(data, row_count, table, parsed_chunk);
+      } catch (...) {
+        parsed_chunk.exception = std::current_exception();
+      }
+    }));
+    _tasks.back()->set_as_predecessor_of(release_task);
+    _tasks.back()->schedule();
+  }
+
+  release_task->schedule();
+  _tasks.emplace_back(release_task);
+  _complete_row_count = 0;
+}
+
+void CopyDataParser::_parse_binary_rows(const std::string_view data, const size_t row_count, const Table& table,
+                                        CsvParser::ParsedChunk& parsed_chunk) {
+  const auto column_count = table.column_count();
+
+  // Offsets and lengths of the fields, row by row. A length of -1 denotes a NULL value. The rows have been checked by
+  // _find_binary_rows already.
+  auto fields = std::vector<std::pair<size_t, int32_t>>{};
+  fields.reserve(row_count * column_count);
+
+  auto position = size_t{0};
+  for (auto row_idx = size_t{0}; row_idx < row_count; ++row_idx) {
+    position += sizeof(int16_t);
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      const auto field_length = read_big_endian<int32_t>(&data[position]);
+      AssertInput(field_length >= -1, "Invalid field length in binary COPY data: " + std::to_string(field_length));
+      position += sizeof(int32_t);
+      fields.emplace_back(position, field_length);
+      if (field_length > 0) position += field_length;
+    }
+  }
+
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    const auto is_nullable = table.column_is_nullable(column_id);
+
+    resolve_data_type(table.column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      auto values = pmr_vector<ColumnDataType>(row_count);
+      auto null_values = pmr_vector<bool>(is_nullable ? row_count : 0);
+
+      for (auto row_idx = size_t{0}; row_idx < row_count; ++row_idx) {
+        const auto [offset, length] = fields[row_idx * column_count + column_id];
+        if (length == -1) {
+          AssertInput(is_nullable, "NULL value in binary COPY data for non-nullable column " +
+                                       table.column_name(column_id));
+          null_values[row_idx] = true;
+          continue;
+        }
+
+        values[row_idx] = decode_binary_value<ColumnDataType>(data.substr(offset, length));
+      }
+
+      if (is_nullable) {
+        parsed_chunk.segments.push_back(
+            std::make_shared<ValueSegment<ColumnDataType>>(std::move(values), std::move(null_values)));
+      } else {
+        parsed_chunk.segments.push_back(std::make_shared<ValueSegment<ColumnDataType>>(std::move(values)));
+      }
+    });
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <list>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "import_export/csv/csv_parser.hpp"
+#include "server_types.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class AbstractTask;
+
+/**
+ * Parses the data that the client sends for COPY FROM STDIN (see Session). The data arrives in CopyData messages whose
+ * boundaries are not aligned with the rows. Instead of collecting the entire data first, the complete rows received
+ * so far are parsed by tasks in the background as soon as enough data has been received. CSV data is parsed by the
+ * CsvParser. Binary data has the format of PostgreSQL, see
+ * https://www.postgresql.org/docs/12/sql-copy.html#id-1.9.3.55.9.4
+ *
+ * The parsed rows form a table without MVCC data, which is inserted into the target table by the caller.
+ */
+class CopyDataParser : private Noncopyable {
+ public:
+  CopyDataParser(const TableColumnDefinitions& column_definitions, const CopyFormat format,
+                 const ChunkOffset chunk_size = Chunk::DEFAULT_SIZE);
+
+  // Waits for the scheduled tasks, as they refer to the data of the parser
+  ~CopyDataParser();
+
+  void append(const std::string& data);
+
+  // Waits for all parsing tasks and returns the table with the parsed rows. Throws if any rows could not be parsed.
+  std::shared_ptr<Table> finish();
+
+  // Rows are handed to a parsing task once this many bytes of complete rows have been received
+  static constexpr auto PARSING_TASK_BYTES = size_t{4'000'000};
+
+ protected:
+  friend class CopyDataParserTest;
+
+  // Finds the end of the complete rows in _buffer, starting at _scanned_bytes
+  void _find_csv_rows();
+  void _find_binary_rows();
+  void _read_binary_header();
+
+  // Schedules the tasks that parse the complete rows in _buffer and removes them from it
+  void _schedule_parsing();
+
+  static void _parse_binary_rows(std::string_view data, const size_t row_count, const Table& table,
+                                 CsvParser::ParsedChunk& parsed_chunk);
+
+  const CopyFormat _format;
+  std::shared_ptr<Table> _table;
+  CsvMeta _csv_meta;
+
+  // Received data that has not been handed to a parsing task yet
+  std::string _buffer;
+  size_t _scanned_bytes{0};
+  size_t _complete_rows_end{0};
+  size_t _complete_row_count{0};
+  bool _in_quotes{false};
+  bool _binary_header_read{false};
+  bool _binary_trailer_read{false};
+
+  // Data and results of the parsing tasks. Lists are used to keep the references of the tasks valid. Each element of
+  // _scheduled_data is released by a task once the tasks parsing it are done.
+  std::list<std::string> _scheduled_data;
+  std::list<CsvParser::ParsedChunk> _parsed_chunks;
+  std::vector<std::shared_ptr<AbstractTask>> _tasks;
+};
+
+}  // namespace opossum
@@ -6,6 +6,9 @@ namespace opossum {
 // avoid magic numbers.
 static constexpr auto LENGTH_FIELD_SIZE = 4u;
 
+// Special protocol version in the startup packet with which the client requests SSL, which we deny
+static constexpr auto SSL_REQUEST_CODE = 80877103u;
+
 // Documentation of the message types can be found here:
 // https://www.postgresql.org/docs/12/protocol-message-formats.html
 enum class PostgresMessageType : unsigned char {
@@ -22,6 +25,8 @@ enum class PostgresMessageType : unsigned char {
   ReadyForQuery = 'Z',
   RowDescription = 'T',
   DataRow = 'D',
+  CopyInResponse = 'G',
+  CopyOutResponse = 'H',
 
   // Selection of error and notice message fields. All possible fields are documented at:
   // https://www.postgresql.org/docs/12/protocol-error-fields.html
@@ -39,6 +44,11 @@ enum class PostgresMessageType : unsigned char {
   SimpleQueryCommand = 'Q',
   CloseCommand = 'C',
 
+  // Data transfer of COPY FROM STDIN and COPY TO STDOUT. These messages are sent by both the client and the server.
+  CopyData = 'd',
+  CopyDone = 'c',
+  CopyFail = 'f',
+
   // SSL willingness
   SslYes = 'S',
   SslNo = 'N',
@@ -53,5 +63,6 @@ enum class TransactionStatusIndicator : unsigned char {
 
 // SQL error codes
 constexpr char TRANSACTION_CONFLICT[] = "40001";
+constexpr char OUT_OF_MEMORY[] = "53200";
 
 }  // namespace opossum
@@ -1,5 +1,7 @@
 #include "postgres_protocol_handler.hpp"
 
+#include "session_stream.hpp"
+
 namespace opossum {
 
 template <typename SocketType>
@@ -7,21 +9,18 @@ PostgresProtocolHandler<SocketType>::PostgresProtocolHandler(const std::shared_p
     : _read_buffer(socket), _write_buffer(socket) {}
 
 template <typename SocketType>
-uint32_t PostgresProtocolHandler<SocketType>::read_startup_packet_header() {
-  // Special SSL version number that we catch to deny SSL support
-  constexpr auto SSL_REQUEST_CODE = 80877103u;
-
+std::optional<uint32_t> PostgresProtocolHandler<SocketType>::read_startup_packet_header() {
   const auto body_length = _read_buffer.template get_value<uint32_t>();
   const auto protocol_version = _read_buffer.template get_value<uint32_t>();
 
-  // We currently do not support SSL
+  // We currently do not support SSL. The client sends another startup packet once it has received the denial.
   if (protocol_version == SSL_REQUEST_CODE) {
     _ssl_deny();
-    return read_startup_packet_header();
-  } else {
-    // Subtract uint32_t twice, since both packet length and protocol version have been read already
-    return body_length - 2 * LENGTH_FIELD_SIZE;
+    return std::nullopt;
   }
+
+  // Subtract uint32_t twice, since both packet length and protocol version have been read already
+  return body_length - 2 * LENGTH_FIELD_SIZE;
 }
 
 template <typename SocketType>
@@ -64,6 +63,11 @@ PostgresMessageType PostgresProtocolHandler<SocketType>::read_packet_type() {
   return static_cast<PostgresMessageType>(_read_buffer.template get_value<char>());
 }
 
+template <typename SocketType>
+bool PostgresProtocolHandler<SocketType>::has_buffered_data() const {
+  return _read_buffer.size() > 0;
+}
+
 template <typename SocketType>
 std::string PostgresProtocolHandler<SocketType>::read_query_packet() {
   const auto query_length = _read_buffer.template get_value<uint32_t>() - LENGTH_FIELD_SIZE;
@@ -159,6 +163,12 @@ std::pair<std::string, std::string> PostgresProtocolHandler<SocketType>::read_pa
   return {statement_name, query};
 }
 
+template <typename SocketType>
+void PostgresProtocolHandler<SocketType>::skip_packet() {
+  const auto body_length = _read_buffer.template get_value<uint32_t>() - LENGTH_FIELD_SIZE;
+  _read_buffer.get_string(body_length, HasNullTerminator::No);
+}
+
 template <typename SocketType>
 void PostgresProtocolHandler<SocketType>::read_sync_packet() {
   // This packet has no body. Hence, only read and ignore its size.
@@ -227,6 +237,43 @@ std::string PostgresProtocolHandler<SocketType>::read_execute_packet() {
   return portal;
 }
 
+template <typename SocketType>
+void PostgresProtocolHandler<SocketType>::send_copy_in_response(const CopyFormat format, const uint16_t column_count) {
+  _send_copy_response(PostgresMessageType::CopyInResponse, format, column_count);
+  // The client waits for this message before it sends the data
+  _write_buffer.flush();
+}
+
+template <typename SocketType>
+void PostgresProtocolHandler<SocketType>::send_copy_out_response(const CopyFormat format, const uint16_t column_count) {
+  _send_copy_response(PostgresMessageType::CopyOutResponse, format, column_count);
+}
+
+template <typename SocketType>
+void PostgresProtocolHandler<SocketType>::send_copy_data(const std::string& data) {
+  _write_buffer.template put_value(PostgresMessageType::CopyData);
+  _write_buffer.template put_value<uint32_t>(static_cast<uint32_t>(LENGTH_FIELD_SIZE + data.size()));
+  _write_buffer.put_string(data, HasNullTerminator::No);
+}
+
+template <typename SocketType>
+std::string PostgresProtocolHandler<SocketType>::read_copy_data_packet() {
+  const auto data_length = _read_buffer.template get_value<uint32_t>() - LENGTH_FIELD_SIZE;
+  return _read_buffer.get_string(data_length, HasNullTerminator::No);
+}
+
+template <typename SocketType>
+void PostgresProtocolHandler<SocketType>::read_copy_done_packet() {
+  // This packet has no body, only the length field
+  _read_buffer.template get_value<uint32_t>();
+}
+
+template <typename SocketType>
+std::string PostgresProtocolHandler<SocketType>::read_copy_fail_packet() {
+  const auto message_length = _read_buffer.template get_value<uint32_t>() - LENGTH_FIELD_SIZE;
+  return _read_buffer.get_string(message_length);
+}
+
 template <typename SocketType>
 void PostgresProtocolHandler<SocketType>::send_error_message(const ErrorMessage& error_message) {
   _write_buffer.template put_value(PostgresMessageType::ErrorResponse);
@@ -265,6 +312,22 @@ void PostgresProtocolHandler<SocketType>::send_execution_info(const std::string&
   _write_buffer.template put_value('\0');
 }
 
+template <typename SocketType>
+void PostgresProtocolHandler<SocketType>::_send_copy_response(const PostgresMessageType message_type,
+                                                              const CopyFormat format, const uint16_t column_count) {
+  // The format is sent for the entire data and for each column (0 = textual, 1 = binary). Both must match.
+  const auto format_code = static_cast<int16_t>(format == CopyFormat::Binary ? 1 : 0);
+
+  _write_buffer.template put_value(message_type);
+  const auto packet_size = LENGTH_FIELD_SIZE + sizeof(char) + sizeof(uint16_t) + column_count * sizeof(int16_t);
+  _write_buffer.template put_value<uint32_t>(static_cast<uint32_t>(packet_size));
+  _write_buffer.template put_value(static_cast<char>(format_code));
+  _write_buffer.template put_value<uint16_t>(column_count);
+  for (auto column_id = uint16_t{0}; column_id < column_count; ++column_id) {
+    _write_buffer.template put_value<int16_t>(format_code);
+  }
+}
+
 template <typename SocketType>
 void PostgresProtocolHandler<SocketType>::_ssl_deny() {
   // The SSL deny packet has a special format. It does not have a field indicating the packet size.
@@ -272,7 +335,7 @@ void PostgresProtocolHandler<SocketType>::_ssl_deny() {
   _write_buffer.flush();
 }
 
-template class PostgresProtocolHandler<Socket>;
+template class PostgresProtocolHandler<SessionStream>;
 // For testing purposes only. stream_descriptor is used to write data to file
 template class PostgresProtocolHandler<boost::asio::posix::stream_descriptor>;
 
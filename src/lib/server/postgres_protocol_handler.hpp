@@ -1,10 +1,12 @@
 #pragma once
 
+#include <optional>
 #include <unordered_map>
 
 #include "all_type_variant.hpp"
 #include "postgres_message_type.hpp"
 #include "read_buffer.hpp"
+#include "server_types.hpp"
 #include "write_buffer.hpp"
 
 namespace opossum {
@@ -25,8 +27,9 @@ class PostgresProtocolHandler {
  public:
   explicit PostgresProtocolHandler(const std::shared_ptr<SocketType>& socket);
 
-  // Handle the startup packet header returning the body's size
-  uint32_t read_startup_packet_header();
+  // Handle the startup packet header returning the body's size. Returns std::nullopt for an SSL request, which is
+  // denied. The client then sends another startup packet.
+  std::optional<uint32_t> read_startup_packet_header();
   void read_startup_packet_body(const uint32_t size);
 
   // Setup new connection: successful authentication + sending parameters
@@ -39,6 +42,12 @@ class PostgresProtocolHandler {
   // Read first byte of next packet to determine its type
   PostgresMessageType read_packet_type();
 
+  // Returns whether data has been received from the client that has not been read yet
+  bool has_buffered_data() const;
+
+  // Read and discard the remainder of a packet whose type has already been read
+  void skip_packet();
+
   // Read SQL query packet
   std::string read_query_packet();
 
@@ -61,6 +70,14 @@ class PostgresProtocolHandler {
   PreparedStatementDetails read_bind_packet();
   std::string read_execute_packet();
 
+  // Messages for COPY FROM STDIN and COPY TO STDOUT
+  void send_copy_in_response(const CopyFormat format, const uint16_t column_count);
+  void send_copy_out_response(const CopyFormat format, const uint16_t column_count);
+  void send_copy_data(const std::string& data);
+  std::string read_copy_data_packet();
+  void read_copy_done_packet();
+  std::string read_copy_fail_packet();
+
   // Send error message to client if there is an error during parsing or execution
   void send_error_message(const ErrorMessage& error_message);
 
@@ -71,6 +88,8 @@ class PostgresProtocolHandler {
   void force_flush() { _write_buffer.flush(); }
 
  private:
+  void _send_copy_response(const PostgresMessageType message_type, const CopyFormat format,
+                           const uint16_t column_count);
   void _ssl_deny();
   ReadBuffer<SocketType> _read_buffer;
   WriteBuffer<SocketType> _write_buffer;
@@ -1,6 +1,15 @@
 #include "query_handler.hpp"
 
+#include <regex>
+
+#include <boost/algorithm/string.hpp>
+
+#include "expression/expression_utils.hpp"
 #include "expression/value_expression.hpp"
+#include "logical_query_plan/insert_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/static_table_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
 #include "optimizer/optimizer.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "sql/sql_translator.hpp"
@@ -10,10 +19,6 @@ namespace opossum {
 std::pair<ExecutionInformation, std::shared_ptr<TransactionContext>> QueryHandler::execute_pipeline(
     const std::string& query, const SendExecutionInfo send_execution_info,
     const std::shared_ptr<TransactionContext>& transaction_context) {
-  // A simple query command invalidates unnamed statements
-  // See: https://postgresql.org/docs/12/protocol-flow.html#PROTOCOL-FLOW-EXT-QUERY
-  if (Hyrise::get().storage_manager.has_prepared_plan("")) Hyrise::get().storage_manager.drop_prepared_plan("");
-
   DebugAssert(!transaction_context || !transaction_context->is_auto_commit(),
               "Auto-commit transaction contexts should not be passed around this far");
 
@@ -34,27 +39,73 @@ std::pair<ExecutionInformation, std::shared_ptr<TransactionContext>> QueryHandle
       execution_info.pipeline_metrics = stream.str();
     }
   } else if (pipeline_status == SQLPipelineStatus::Failure) {
-    const std::string failed_statement = sql_pipeline.failed_pipeline_statement()->get_sql_string();
-    execution_info.error_message = {{PostgresMessageType::HumanReadableError,
-                                     "Transaction conflict, transaction was rolled back. Following statements might "
-                                     "have still been sent and executed. Failed statement: " +
-                                         failed_statement},
-                                    {PostgresMessageType::SqlstateCodeError, TRANSACTION_CONFLICT}};
+    const auto& failed_pipeline_statement = sql_pipeline.failed_pipeline_statement();
+    const std::string failed_statement = failed_pipeline_statement->get_sql_string();
+    const auto& failed_transaction_context = failed_pipeline_statement->transaction_context();
+    if (failed_transaction_context && failed_transaction_context->rollback_reason() == RollbackReason::OutOfMemory) {
+      execution_info.error_message = {{PostgresMessageType::HumanReadableError,
+                                       "Statement exceeded its memory limit, transaction was rolled back. Failed "
+                                       "statement: " +
+                                           failed_statement},
+                                      {PostgresMessageType::SqlstateCodeError, OUT_OF_MEMORY}};
+    } else {
+      execution_info.error_message = {{PostgresMessageType::HumanReadableError,
+                                       "Transaction conflict, transaction was rolled back. Following statements might "
+                                       "have still been sent and executed. Failed statement: " +
+                                           failed_statement},
+                                      {PostgresMessageType::SqlstateCodeError, TRANSACTION_CONFLICT}};
+    }
   }
   return {execution_info, sql_pipeline.transaction_context()};
 }
 
-void QueryHandler::setup_prepared_plan(const std::string& statement_name, const std::string& query) {
-  // Named prepared statements must be explicitly closed before they can be redefined by another Parse message.
-  // An unnamed prepared statement lasts only until the next Parse statement specifying the unnamed statement as
-  // destination is issued
-  // https://www.postgresql.org/docs/12/protocol-flow.html#PROTOCOL-FLOW-EXT-QUERY
-  if (Hyrise::get().storage_manager.has_prepared_plan(statement_name)) {
-    AssertInput(statement_name.empty(),
-                "Named prepared statements must be explicitly closed before they can be redefined.");
-    Hyrise::get().storage_manager.drop_prepared_plan(statement_name);
+std::optional<CopyStatement> QueryHandler::parse_copy_statement(const std::string& query) {
+  // See https://www.postgresql.org/docs/12/sql-copy.html. Column lists and options other than the format are not
+  // supported.
+  static const auto copy_from_regex =
+      std::regex{R"(^\s*COPY\s+(\w+)\s+FROM\s+STDIN\b([\s\S]*?);?\s*$)", std::regex::icase};
+  static const auto copy_to_regex =
+      std::regex{R"(^\s*COPY\s+(?:(\w+)|\(([\s\S]+)\))\s+TO\s+STDOUT\b([\s\S]*?);?\s*$)", std::regex::icase};
+  // Both the current syntax (`WITH (FORMAT csv)`) and the syntax before PostgreSQL 9.0 (`WITH CSV`) are accepted
+  static const auto options_regex =
+      std::regex{R"(^(?:\s+WITH)?\s*(?:\(\s*FORMAT\s+(\w+)\s*\)|FORMAT\s+(\w+)|(\w+))?\s*$)", std::regex::icase};
+
+  auto copy_statement = CopyStatement{};
+  auto match = std::smatch{};
+  auto options = std::string{};
+
+  if (std::regex_match(query, match, copy_from_regex)) {
+    copy_statement.direction = CopyStatement::Direction::FromStdin;
+    copy_statement.table_name = match[1];
+    options = match[2];
+  } else if (std::regex_match(query, match, copy_to_regex)) {
+    copy_statement.direction = CopyStatement::Direction::ToStdout;
+    copy_statement.query = match[1].matched ? "SELECT * FROM " + match[1].str() : match[2].str();
+    options = match[3];
+  } else {
+    return std::nullopt;
   }
 
+  auto options_match = std::smatch{};
+  AssertInput(std::regex_match(options, options_match, options_regex), "Unsupported options for COPY: " + options);
+
+  auto format = std::string{};
+  for (auto group_idx = size_t{1}; group_idx < options_match.size(); ++group_idx) {
+    if (options_match[group_idx].matched) format = boost::algorithm::to_lower_copy(options_match[group_idx].str());
+  }
+
+  if (format == "csv") {
+    copy_statement.format = CopyFormat::Csv;
+  } else if (format == "binary") {
+    copy_statement.format = CopyFormat::Binary;
+  } else {
+    FailInput("COPY FROM STDIN and COPY TO STDOUT require FORMAT csv or FORMAT binary");
+  }
+
+  return copy_statement;
+}
+
+std::shared_ptr<PreparedStatement> QueryHandler::prepare_statement(const std::string& query) {
   auto pipeline = SQLPipelineBuilder{query}.create_pipeline();
   const auto& lqps = pipeline.get_unoptimized_logical_plans();
 
@@ -67,25 +118,83 @@ void QueryHandler::setup_prepared_plan(const std::string& statement_name, const
   const auto& lqp = lqps[0];
   const auto& translation_info = translation_infos[0].get();
 
-  auto parameter_ids_of_value_placeholders = translation_info.parameter_ids_of_value_placeholders;
-  const auto prepared_plan = std::make_shared<PreparedPlan>(lqp, parameter_ids_of_value_placeholders);
+  auto prepared_statement = std::make_shared<PreparedStatement>();
+  prepared_statement->query = query;
+  prepared_statement->prepared_plan =
+      std::make_shared<PreparedPlan>(lqp, translation_info.parameter_ids_of_value_placeholders);
+  prepared_statement->cacheable = translation_info.cacheable;
 
-  Hyrise::get().storage_manager.add_prepared_plan(statement_name, prepared_plan);
+  // Remember the tables by identity, like the SQLResultCache does, so that DDL statements invalidate the statement.
+  // Tables that are not managed by the StorageManager (i.e., meta tables) are generated on access.
+  const auto& storage_manager = Hyrise::get().storage_manager;
+  const auto add_table = [&](const std::string& table_name) {
+    if (storage_manager.has_table(table_name)) {
+      prepared_statement->tables.emplace_back(table_name, storage_manager.get_table(table_name));
+    }
+  };
+  for (const auto& subplan_root : lqp_find_subplan_roots(lqp)) {
+    visit_lqp(subplan_root, [&](const auto& node) {
+      if (node->type == LQPNodeType::StoredTable) add_table(static_cast<const StoredTableNode&>(*node).table_name);
+      if (node->type == LQPNodeType::Insert) add_table(static_cast<const InsertNode&>(*node).table_name);
+      return LQPVisitation::VisitInputs;
+    });
+  }
+
+  if (prepared_statement->prepared_plan->parameter_ids.empty()) {
+    // Without parameters, the optimizer cannot make better decisions during binding. Non-cacheable statements (e.g.,
+    // those reading meta tables) are optimized on each binding, as the pipeline would not cache their plans either.
+    if (prepared_statement->cacheable) {
+      const auto optimizer = Optimizer::create_default_optimizer();
+      const auto optimized_lqp = optimizer->optimize(lqp->deep_copy());
+      prepared_statement->physical_plan_template = LQPTranslator{}.translate_node(optimized_lqp);
+    }
+  } else if (lqp->type == LQPNodeType::Insert) {
+    // `INSERT INTO t VALUES (...)` is translated to an InsertNode on top of a ProjectionNode with the values, which
+    // projects them from a DummyTableNode (see SQLTranslator::_translate_insert). Values with subqueries are not
+    // handled, as the subqueries cannot refer to the columns of the table with the parameters (see
+    // bind_single_row_inserts).
+    const auto& input = lqp->left_input();
+    if (input->type == LQPNodeType::Projection && input->left_input()->type == LQPNodeType::DummyTable) {
+      auto has_subquery = false;
+      for (const auto& expression : input->node_expressions) {
+        visit_expression(expression, [&](const auto& sub_expression) {
+          if (sub_expression->type == ExpressionType::LQPSubquery) has_subquery = true;
+          return ExpressionVisitation::VisitArguments;
+        });
+      }
+      prepared_statement->is_single_row_insert = !has_subquery;
+    }
+  }
+
+  return prepared_statement;
 }
 
-std::shared_ptr<AbstractOperator> QueryHandler::bind_prepared_plan(const PreparedStatementDetails& statement_details) {
-  AssertInput(Hyrise::get().storage_manager.has_prepared_plan(statement_details.statement_name),
-              "The specified statement does not exist.");
+bool QueryHandler::is_valid(const PreparedStatement& prepared_statement) {
+  const auto& storage_manager = Hyrise::get().storage_manager;
 
-  const auto prepared_plan = Hyrise::get().storage_manager.get_prepared_plan(statement_details.statement_name);
+  for (const auto& [table_name, weak_table] : prepared_statement.tables) {
+    const auto table = weak_table.lock();
+    if (!table || !storage_manager.has_table(table_name) || storage_manager.get_table(table_name) != table) {
+      return false;
+    }
+  }
 
-  auto parameter_expressions = std::vector<std::shared_ptr<AbstractExpression>>{statement_details.parameters.size()};
-  for (auto parameter_idx = size_t{0}; parameter_idx < statement_details.parameters.size(); ++parameter_idx) {
-    parameter_expressions[parameter_idx] =
-        std::make_shared<ValueExpression>(statement_details.parameters[parameter_idx]);
+  return true;
+}
+
+std::shared_ptr<AbstractOperator> QueryHandler::bind_prepared_statement(const PreparedStatement& prepared_statement,
+                                                                        const std::vector<AllTypeVariant>& parameters) {
+  AssertInput(parameters.size() == prepared_statement.prepared_plan->parameter_ids.size(),
+              "Incorrect number of parameters supplied");
+
+  if (prepared_statement.physical_plan_template) return prepared_statement.physical_plan_template->deep_copy();
+
+  auto parameter_expressions = std::vector<std::shared_ptr<AbstractExpression>>{parameters.size()};
+  for (auto parameter_idx = size_t{0}; parameter_idx < parameters.size(); ++parameter_idx) {
+    parameter_expressions[parameter_idx] = std::make_shared<ValueExpression>(parameters[parameter_idx]);
   }
 
-  auto lqp = prepared_plan->instantiate(parameter_expressions);
+  auto lqp = prepared_statement.prepared_plan->instantiate(parameter_expressions);
   const auto optimizer = Optimizer::create_default_optimizer();
   lqp = optimizer->optimize(std::move(lqp));
 
@@ -94,6 +203,40 @@ std::shared_ptr<AbstractOperator> QueryHandler::bind_prepared_plan(const Prepare
   return pqp;
 }
 
+std::shared_ptr<AbstractOperator> QueryHandler::bind_single_row_inserts(
+    const PreparedStatement& prepared_statement, const std::vector<std::vector<AllTypeVariant>>& parameters) {
+  Assert(prepared_statement.is_single_row_insert, "Expected a statement that inserts a single row");
+  Assert(!parameters.empty(), "Expected at least one row to insert");
+
+  const auto& prepared_plan = *prepared_statement.prepared_plan;
+  const auto parameter_count = prepared_plan.parameter_ids.size();
+  for (const auto& row : parameters) {
+    AssertInput(row.size() == parameter_count, "Incorrect number of parameters supplied");
+  }
+
+  // Store the parameters in a table with one row per execution of the statement. The columns have the types of the
+  // parameters (usually strings, as the protocol handler only accepts parameters in text format). They are cast to the
+  // column types of the target table by the projection of the statement.
+  auto column_definitions = TableColumnDefinitions{};
+  for (auto parameter_idx = size_t{0}; parameter_idx < parameter_count; ++parameter_idx) {
+    column_definitions.emplace_back("parameter_" + std::to_string(parameter_idx),
+                                    data_type_from_all_type_variant(parameters[0][parameter_idx]), true);
+  }
+
+  const auto parameter_table = std::make_shared<Table>(column_definitions, TableType::Data);
+  for (const auto& row : parameters) {
+    parameter_table->append(row);
+  }
+
+  // Replace the placeholders with the columns of the parameter table and project the values from it instead of the
+  // DummyTableNode, which has a single row.
+  const auto static_table_node = StaticTableNode::make(parameter_table);
+  const auto lqp = prepared_plan.instantiate(static_table_node->column_expressions());
+  lqp->left_input()->set_left_input(static_table_node);
+
+  return LQPTranslator{}.translate_node(lqp);
+}
+
 std::shared_ptr<const Table> QueryHandler::execute_prepared_plan(
     const std::shared_ptr<AbstractOperator>& physical_plan) {
   const auto tasks = OperatorTask::make_tasks_from_operator(physical_plan);
@@ -1,10 +1,16 @@
 #pragma once
 
+#include <optional>
+#include <string>
+#include <utility>
 #include <variant>
+#include <vector>
+
 #include "hyrise.hpp"
 #include "operators/abstract_operator.hpp"
 #include "postgres_protocol_handler.hpp"
 #include "sql/sql_pipeline.hpp"
+#include "storage/prepared_plan.hpp"
 #include "storage/table.hpp"
 
 namespace opossum {
@@ -20,6 +26,44 @@ struct ExecutionInformation {
   std::optional<std::string> custom_command_complete_message;
 };
 
+// A statement that was prepared using the extended query protocol. Prepared statements only depend on the SQL string
+// and are not modified after their creation, so a session may use one for multiple statement names. They become
+// invalid when a table that they refer to is dropped or replaced (see QueryHandler::is_valid).
+struct PreparedStatement {
+  std::string query;
+
+  std::shared_ptr<PreparedPlan> prepared_plan;
+
+  // The optimized PQP of a cacheable statement without parameters. It is copied for each binding so that the statement
+  // is neither optimized nor translated again. Statements with parameters are optimized for the bound values instead.
+  std::shared_ptr<AbstractOperator> physical_plan_template;
+
+  // The stored tables that the statement reads or modifies
+  std::vector<std::pair<std::string, std::weak_ptr<const Table>>> tables;
+
+  // Whether the statement inserts a single row of parameters (e.g., `INSERT INTO t VALUES (?, ?)`). Multiple executions
+  // of such a statement can be performed by a single Insert operator (see bind_single_row_inserts).
+  bool is_single_row_insert{false};
+
+  // Whether the statement may be reused for the same SQL string, see SQLTranslationInfo
+  bool cacheable{true};
+};
+
+// A `COPY <table> FROM STDIN` or `COPY <table | (query)> TO STDOUT` statement. The SQL parser only supports COPY
+// statements with files. The data of these statements is transferred using the wire protocol instead (see Session).
+struct CopyStatement {
+  enum class Direction { FromStdin, ToStdout };
+
+  Direction direction;
+  CopyFormat format;
+
+  // The target table of COPY FROM STDIN
+  std::string table_name;
+
+  // The query whose result is sent by COPY TO STDOUT
+  std::string query;
+};
+
 // This class manages the interaction between the server and the database component. Furthermore, most of the SQL-based
 // error handling happens in this class.
 class QueryHandler {
@@ -28,9 +72,21 @@ class QueryHandler {
       const std::string& query, const SendExecutionInfo send_execution_info,
       const std::shared_ptr<TransactionContext>& transaction_context);
 
-  static void setup_prepared_plan(const std::string& statement_name, const std::string& query);
+  // Returns the COPY statement if the query transfers data using the wire protocol
+  static std::optional<CopyStatement> parse_copy_statement(const std::string& query);
+
+  static std::shared_ptr<PreparedStatement> prepare_statement(const std::string& query);
+
+  // Returns false if a table that the statement refers to has been dropped or replaced (e.g., by DROP TABLE and CREATE
+  // TABLE) since it was prepared. Its plans refer to the old table and its columns, so it has to be prepared again.
+  static bool is_valid(const PreparedStatement& prepared_statement);
+
+  static std::shared_ptr<AbstractOperator> bind_prepared_statement(const PreparedStatement& prepared_statement,
+                                                                   const std::vector<AllTypeVariant>& parameters);
 
-  static std::shared_ptr<AbstractOperator> bind_prepared_plan(const PreparedStatementDetails& statement_details);
+  // Creates a single PQP that inserts one row per parameter list. Requires is_single_row_insert.
+  static std::shared_ptr<AbstractOperator> bind_single_row_inserts(
+      const PreparedStatement& prepared_statement, const std::vector<std::vector<AllTypeVariant>>& parameters);
 
   static std::shared_ptr<const Table> execute_prepared_plan(const std::shared_ptr<AbstractOperator>& physical_plan);
 
@@ -1,6 +1,115 @@
 #include "result_serializer.hpp"
+
+#include <boost/endian/conversion.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <thread>
+#include <type_traits>
+
+#include "hyrise.hpp"
 #include "lossy_cast.hpp"
 #include "query_handler.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/job_task.hpp"
+#include "session_stream.hpp"
+#include "storage/segment_iterate.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Signature, flags field, and header extension length field of the binary COPY format (see CopyDataParser)
+constexpr auto BINARY_COPY_HEADER = std::string_view{"PGCOPY\n\377\r\n\0\0\0\0\0\0\0\0\0", 19};
+
+template <typename T>
+void append_big_endian(std::string& data, const T value) {
+  if constexpr (std::is_floating_point_v<T>) {
+    using IntegerType = std::conditional_t<sizeof(T) == sizeof(uint32_t), uint32_t, uint64_t>;
+    auto bits = IntegerType{};
+    std::memcpy(&bits, &value, sizeof(T));
+    append_big_endian(data, bits);
+  } else {
+    const auto big_endian_value = boost::endian::native_to_big(value);
+    data.append(reinterpret_cast<const char*>(&big_endian_value), sizeof(T));
+  }
+}
+
+// Quotes string values if necessary. Empty strings are quoted, as unquoted empty fields denote NULL values.
+void append_csv_string(std::string& data, const std::string_view value) {
+  if (!value.empty() && value.find_first_of(",\"\n\r") == std::string_view::npos) {
+    data.append(value);
+    return;
+  }
+
+  data.push_back('"');
+  for (const auto character : value) {
+    if (character == '"') data.push_back('"');
+    data.push_back(character);
+  }
+  data.push_back('"');
+}
+
+std::string serialize_chunk_for_copy(const Table& table, const ChunkID chunk_id, const CopyFormat format) {
+  const auto chunk = table.get_chunk(chunk_id);
+  if (!chunk) return {};
+
+  const auto row_count = chunk->size();
+  const auto column_count = table.column_count();
+
+  // The fields are serialized column by column, as iterating a segment is much faster than accessing its values
+  // one by one.
+  auto fields = std::vector<std::string>(row_count * column_count);
+
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    resolve_data_type(table.column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      segment_iterate<ColumnDataType>(*chunk->get_segment(column_id), [&](const auto& position) {
+        auto& field = fields[position.chunk_offset() * column_count + column_id];
+
+        if (format == CopyFormat::Csv) {
+          if (position.is_null()) return;
+
+          if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+            append_csv_string(field, position.value());
+          } else {
+            field = boost::lexical_cast<std::string>(position.value());
+          }
+        } else {
+          if (position.is_null()) {
+            append_big_endian(field, int32_t{-1});
+            return;
+          }
+
+          if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+            append_big_endian(field, static_cast<int32_t>(position.value().size()));
+            field.append(position.value());
+          } else {
+            append_big_endian(field, static_cast<int32_t>(sizeof(ColumnDataType)));
+            append_big_endian(field, position.value());
+          }
+        }
+      });
+    });
+  }
+
+  auto data = std::string{};
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+    if (format == CopyFormat::Binary) append_big_endian(data, static_cast<int16_t>(column_count));
+
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      if (format == CopyFormat::Csv && column_id > 0) data.push_back(',');
+      data.append(fields[chunk_offset * column_count + column_id]);
+    }
+
+    if (format == CopyFormat::Csv) data.push_back('\n');
+  }
+
+  return data;
+}
+
+}  // namespace
 
 namespace opossum {
 
@@ -90,6 +199,47 @@ void ResultSerializer::send_query_response(
   }
 }
 
+template <typename SocketType>
+void ResultSerializer::send_copy_data(
+    const std::shared_ptr<const Table>& table, const CopyFormat format,
+    const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler) {
+  if (format == CopyFormat::Binary) postgres_protocol_handler->send_copy_data(std::string{BINARY_COPY_HEADER});
+
+  // Serializing all chunks before sending them would require the entire result to be kept in memory twice. Thus, only
+  // a few chunks are serialized at once.
+  const auto chunks_in_flight = std::max(size_t{1}, static_cast<size_t>(std::thread::hardware_concurrency()));
+  auto serialized_chunks = std::vector<std::string>(chunks_in_flight);
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+
+  const auto send_serialized_chunks = [&]() {
+    Hyrise::get().scheduler()->wait_for_tasks(tasks);
+    for (auto chunk_idx = size_t{0}; chunk_idx < tasks.size(); ++chunk_idx) {
+      auto& serialized_chunk = serialized_chunks[chunk_idx];
+      if (!serialized_chunk.empty()) postgres_protocol_handler->send_copy_data(serialized_chunk);
+      serialized_chunk.clear();
+    }
+    tasks.clear();
+  };
+
+  const auto chunk_count = table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    auto& serialized_chunk = serialized_chunks[tasks.size()];
+    tasks.emplace_back(std::make_shared<JobTask>([&table, chunk_id, format, &serialized_chunk]() {
+      serialized_chunk = serialize_chunk_for_copy(*table, chunk_id, format);
+    }));
+    tasks.back()->schedule();
+
+    if (tasks.size() == chunks_in_flight) send_serialized_chunks();
+  }
+  send_serialized_chunks();
+
+  if (format == CopyFormat::Binary) {
+    auto trailer = std::string{};
+    append_big_endian(trailer, int16_t{-1});
+    postgres_protocol_handler->send_copy_data(trailer);
+  }
+}
+
 std::string ResultSerializer::build_command_complete_message(const ExecutionInformation& execution_information,
                                                              const uint64_t row_count) {
   if (execution_information.custom_command_complete_message) {
@@ -122,18 +272,26 @@ std::string ResultSerializer::build_command_complete_message(const OperatorType
   }
 }
 
-template void ResultSerializer::send_table_description<Socket>(const std::shared_ptr<const Table>&,
-                                                               const std::shared_ptr<PostgresProtocolHandler<Socket>>&);
+template void ResultSerializer::send_table_description<SessionStream>(
+    const std::shared_ptr<const Table>&, const std::shared_ptr<PostgresProtocolHandler<SessionStream>>&);
 
 template void ResultSerializer::send_table_description<boost::asio::posix::stream_descriptor>(
     const std::shared_ptr<const Table>&,
     const std::shared_ptr<PostgresProtocolHandler<boost::asio::posix::stream_descriptor>>&);
 
-template void ResultSerializer::send_query_response<Socket>(const std::shared_ptr<const Table>&,
-                                                            const std::shared_ptr<PostgresProtocolHandler<Socket>>&);
+template void ResultSerializer::send_query_response<SessionStream>(
+    const std::shared_ptr<const Table>&, const std::shared_ptr<PostgresProtocolHandler<SessionStream>>&);
 
 template void ResultSerializer::send_query_response<boost::asio::posix::stream_descriptor>(
     const std::shared_ptr<const Table>&,
     const std::shared_ptr<PostgresProtocolHandler<boost::asio::posix::stream_descriptor>>&);
 
+template void ResultSerializer::send_copy_data<SessionStream>(
+    const std::shared_ptr<const Table>&, const CopyFormat,
+    const std::shared_ptr<PostgresProtocolHandler<SessionStream>>&);
+
+template void ResultSerializer::send_copy_data<boost::asio::posix::stream_descriptor>(
+    const std::shared_ptr<const Table>&, const CopyFormat,
+    const std::shared_ptr<PostgresProtocolHandler<boost::asio::posix::stream_descriptor>>&);
+
 }  // namespace opossum
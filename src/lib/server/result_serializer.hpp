@@ -24,6 +24,12 @@ class ResultSerializer {
       const std::shared_ptr<const Table>& table,
       const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler);
 
+  // Send the rows of the table as data of COPY TO STDOUT. Multiple chunks are serialized in parallel, the data is sent
+  // in the order of the rows.
+  template <typename SocketType>
+  static void send_copy_data(const std::shared_ptr<const Table>& table, const CopyFormat format,
+                             const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler);
+
   // Build completion message after query execution containing the statement type and the number of rows affected
   static std::string build_command_complete_message(const ExecutionInformation& execution_information,
                                                     const uint64_t row_count);
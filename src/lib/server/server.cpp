@@ -3,7 +3,9 @@
 #include <pthread.h>
 
 #include <iostream>
+#include <string>
 #include <thread>
+#include <vector>
 
 #include "hyrise.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
@@ -28,47 +30,53 @@ void Server::run() {
   Hyrise::get().default_pqp_cache = std::make_shared<SQLPhysicalPlanCache>();
   Hyrise::get().default_lqp_cache = std::make_shared<SQLLogicalPlanCache>();
 
-  _is_initialized = true;
   _accept_new_session();
+
+  // The current thread is one of the I/O threads
+  auto io_threads = std::vector<std::thread>{};
+  for (auto io_thread_id = size_t{1}; io_thread_id < IO_THREAD_COUNT; ++io_thread_id) {
+    io_threads.emplace_back([&, io_thread_id]() {
+      const auto thread_name = "server_io_" + std::to_string(io_thread_id);
+#ifdef __APPLE__
+      pthread_setname_np(thread_name.c_str());
+#elif __linux__
+      pthread_setname_np(pthread_self(), thread_name.c_str());
+#endif
+      _io_service.run();
+    });
+  }
+
+  _is_initialized = true;
   _io_service.run();
+
+  for (auto& io_thread : io_threads) {
+    io_thread.join();
+  }
 }
 
 void Server::_accept_new_session() {
-  // Create a new session. This will also open a new data socket in order to communicate with the client
+  // Create a new data socket in order to communicate with the client
   // For more information on TCP ports + Asio see:
   // https://www.gamedev.net/forums/topic/586557-boostasio-allowing-multiple-connections-to-a-single-server-socket/
-  auto new_session = std::make_shared<Session>(_io_service, _send_execution_info);
-  _acceptor.async_accept(*(new_session->socket()),
-                         boost::bind(&Server::_start_session, this, new_session, boost::asio::placeholders::error));
+  auto socket = std::make_shared<Socket>(_io_service);
+  _acceptor.async_accept(*socket,
+                         boost::bind(&Server::_start_session, this, socket, boost::asio::placeholders::error));
 }
 
-void Server::_start_session(const std::shared_ptr<Session>& new_session, const boost::system::error_code& error) {
+void Server::_start_session(const std::shared_ptr<Socket>& socket, const boost::system::error_code& error) {
   Assert(!error, error.message());
 
-  std::thread session_thread([session = new_session, &num_running_sessions = this->_num_running_sessions]() mutable {
-    const std::string thread_name = "server_p_" + std::to_string(session->socket()->remote_endpoint().port());
-#ifdef __APPLE__
-    pthread_setname_np(thread_name.c_str());
-#elif __linux__
-    pthread_setname_np(pthread_self(), thread_name.c_str());
-#endif
-
-    ++num_running_sessions;
-
-    session->run();
-
-    // Destroy the session before reducing the number of running sessions. This makes sure that the server has not shut
-    // down yet. In case session.use_count is not yet zero, this makes sure that the destructor is not called in
-    // the detached thread.
-    session.reset();
-    --num_running_sessions;
-  });
+  // The session is owned by its pending operations (see Session::_wait_for_requests). We reduce the number of running
+  // sessions only after the session has been destroyed. This makes sure that the server (including the io_service
+  // used by the session's socket) has not shut down yet.
+  ++_num_running_sessions;
+  const auto session = std::shared_ptr<Session>(new Session(socket, _send_execution_info),
+                                                [&num_running_sessions = _num_running_sessions](Session* session) {
+                                                  delete session;
+                                                  --num_running_sessions;
+                                                });
+  session->start();
 
-  // We ensure that all threads are completed before the server is shut down by tracking the number of running threads
-  // in _num_running_sessions. The alternative would be to store the std::thread objects in some kind of data structure
-  // and call join() on all of them before shutting down the server. This would result in a growing number of completed
-  // threads waiting to be joined and the need for a cleanup procedure.
-  session_thread.detach();
   _accept_new_session();
 }
 
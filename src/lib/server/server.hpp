@@ -10,9 +10,12 @@ namespace opossum {
 
 /* In the following a short description of the classes used for the server implementation.
 
-*  Server - Opens and binds a server socket. Starts a new session per client.
-*  Session - Creates a data socket for client server communication. It is responsible for the message flow and holds
-*            session-specific data.
+*  Server - Opens and binds a server socket. Starts a new session per client. The network I/O of all sessions is
+*           handled by a small pool of I/O threads.
+*  Session - Handles the data socket for client server communication. It is responsible for the message flow and holds
+*            session-specific data. Its requests are handled by tasks on the scheduler.
+*  SessionStream - In-memory stream between the I/O threads and the tasks of a session. It holds the complete messages
+*                  received from the client and the responses that have not been sent yet.
 *  PostgresProtocolHandler - This class operates on the message level. It serializes and de-serializes information from
 *                            messages.
 *  PostgresMessageTypes - Set of different message types supported by Hyrise.
@@ -31,7 +34,7 @@ class Server {
  public:
   Server(const boost::asio::ip::address& address, const uint16_t port, const SendExecutionInfo send_execution_info);
 
-  // Start server to accept new sessions.
+  // Start server to accept new sessions. Blocks until the server is shut down.
   void run();
 
   // Return the port the server is running on.
@@ -49,7 +52,11 @@ class Server {
  private:
   void _accept_new_session();
 
-  void _start_session(const std::shared_ptr<Session>& new_session, const boost::system::error_code& error);
+  void _start_session(const std::shared_ptr<Socket>& socket, const boost::system::error_code& error);
+
+  // Sessions only occupy an I/O thread while waiting for the client, not while handling its requests. Thus, few
+  // threads suffice independently of the number of clients.
+  static constexpr auto IO_THREAD_COUNT = size_t{2};
 
   std::atomic<uint64_t> _num_running_sessions{0};
   boost::asio::io_service _io_service;
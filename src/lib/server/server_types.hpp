@@ -10,4 +10,8 @@ enum class HasNullTerminator : bool { Yes = true, No = false };
 
 enum class SendExecutionInfo : bool { Yes = true, No = false };
 
+// Formats of the data transferred by COPY FROM STDIN and COPY TO STDOUT. The default text format of PostgreSQL is not
+// supported.
+enum class CopyFormat { Csv, Binary };
+
 }  // namespace opossum
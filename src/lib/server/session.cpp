@@ -1,61 +1,168 @@
 #include "session.hpp"
 
+#include <algorithm>
+#include <cstring>
+#include <string_view>
+
 #include "client_disconnect_exception.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
 #include "postgres_message_type.hpp"
 #include "query_handler.hpp"
 #include "result_serializer.hpp"
+#include "scheduler/job_task.hpp"
 
 namespace opossum {
 
-Session::Session(boost::asio::io_service& io_service, const SendExecutionInfo send_execution_info)
-    : _socket(std::make_shared<Socket>(io_service)),
-      _postgres_protocol_handler(std::make_shared<PostgresProtocolHandler<Socket>>(_socket)),
+Session::Session(const std::shared_ptr<Socket>& socket, const SendExecutionInfo send_execution_info)
+    : _socket(socket),
+      _stream(std::make_shared<SessionStream>()),
+      _postgres_protocol_handler(std::make_shared<PostgresProtocolHandler<SessionStream>>(_stream)),
       _send_execution_info(send_execution_info) {}
 
 std::shared_ptr<Socket> Session::socket() { return _socket; }
 
-void Session::run() {
+void Session::start() {
   // Set TCP_NODELAY in order to disable Nagle's algorithm. It handles congestion control in TCP networks. Therefore,
   // small packets are buffered and sent out later as one large packet. This might introduce a delay of up to 40 ms
   // which we have to avoid. Further reading: https://howdoesinternetwork.com/2015/nagles-algorithm
   _socket->set_option(boost::asio::ip::tcp::no_delay(true));
-  _establish_connection();
-  while (!_terminate_session) {
-    try {
-      _handle_request();
-    } catch (const ClientDisconnectException&) {
-      return;
-    } catch (const std::exception& e) {
-      std::cerr << "Exception in session with client port " << _socket->remote_endpoint().port() << ":" << std::endl
-                << e.what() << std::endl;
-      const auto error_message = ErrorMessage{{PostgresMessageType::HumanReadableError, e.what()}};
-      _postgres_protocol_handler->send_error_message(error_message);
-      _postgres_protocol_handler->send_ready_for_query();
-      // In case of an error, an error message has to be send to the client followed by a "ReadyForQuery" message.
-      // Messages that have already been received are processed further. A "sync" message makes the server send another
-      // "ReadyForQuery" message. In order to avoid this, we set this flag for further operations. As soon as a new
-      // query arrives it must be set to false again to ensure correct message flow.
-      _sync_send_after_error = true;
+  _receive_requests();
+}
+
+void Session::_receive_requests() {
+  // The handler keeps the session alive. If the server is shut down or the client disconnects, the handler is either
+  // called with an error or destroyed without being called. In both cases, the session ends.
+  _socket->async_read_some(
+      boost::asio::buffer(_receive_buffer),
+      [session = shared_from_this()](const boost::system::error_code& error, const size_t received_byte_count) {
+        if (error) return;
+
+        // Clients might send messages in parts. Scheduling a task before a message is complete would block a worker
+        // until the client sends the remainder.
+        if (!session->_extract_complete_messages(received_byte_count)) {
+          session->_receive_requests();
+          return;
+        }
+
+        const auto task = std::make_shared<JobTask>([session]() { session->_handle_requests(); });
+        task->schedule();
+      });
+}
+
+bool Session::_extract_complete_messages(const size_t received_byte_count) {
+  _partial_message.append(_receive_buffer.data(), received_byte_count);
+
+  auto complete_byte_count = size_t{0};
+  while (true) {
+    const auto remaining_byte_count = _partial_message.size() - complete_byte_count;
+    const auto type_size = _expect_startup_packet ? size_t{0} : sizeof(PostgresMessageType);
+    if (remaining_byte_count < type_size + LENGTH_FIELD_SIZE) break;
+
+    // The length field includes itself. Invalid lengths are left to the protocol handler, which fails to read the
+    // message and ends the session.
+    auto length = uint32_t{0};
+    std::memcpy(&length, _partial_message.data() + complete_byte_count + type_size, LENGTH_FIELD_SIZE);
+    const auto message_size = type_size + std::max(ntohl(length), uint32_t{LENGTH_FIELD_SIZE});
+    if (remaining_byte_count < message_size) break;
+
+    if (_expect_startup_packet) {
+      auto protocol_version = uint32_t{0};
+      if (message_size >= 2 * LENGTH_FIELD_SIZE) {
+        std::memcpy(&protocol_version, _partial_message.data() + complete_byte_count + LENGTH_FIELD_SIZE,
+                    LENGTH_FIELD_SIZE);
+      }
+      _expect_startup_packet = ntohl(protocol_version) == SSL_REQUEST_CODE;
+    }
+
+    complete_byte_count += message_size;
+  }
+
+  if (complete_byte_count == 0) return false;
+
+  _stream->receive(std::string_view{_partial_message}.substr(0, complete_byte_count));
+  _partial_message.erase(0, complete_byte_count);
+  return true;
+}
+
+void Session::_handle_requests() {
+  try {
+    // If the client has sent multiple messages (e.g., Parse, Bind, Execute, and Sync), they are handled one after
+    // another. The stream only holds complete messages, so reading them does not wait for the client.
+    while (!_terminate_session && (_stream->has_unread_data() || _postgres_protocol_handler->has_buffered_data())) {
+      if (!_connection_established) {
+        _establish_connection();
+        continue;
+      }
+
+      try {
+        _handle_request();
+      } catch (const ClientDisconnectException&) {
+        throw;
+      } catch (const std::exception& e) {
+        _send_error(e.what());
+      }
     }
+  } catch (const ClientDisconnectException&) {
+    return;
+  }
+
+  _send_responses();
+}
+
+void Session::_send_responses() {
+  // The handler keeps the responses alive until they have been written
+  const auto responses = std::make_shared<std::string>(_stream->take_written_data());
+  if (responses->empty()) {
+    if (!_terminate_session) _receive_requests();
+    return;
   }
+
+  boost::asio::async_write(*_socket, boost::asio::buffer(*responses),
+                           [session = shared_from_this(), responses](const boost::system::error_code& error,
+                                                                     const size_t /* written_byte_count */) {
+                             if (error || session->_terminate_session) return;
+                             session->_receive_requests();
+                           });
 }
 
 void Session::_establish_connection() {
   const auto body_length = _postgres_protocol_handler->read_startup_packet_header();
+  if (!body_length) return;
 
   // Currently, the information available in the start up packet body (such as db name, user name) is ignored
-  _postgres_protocol_handler->read_startup_packet_body(body_length);
+  _postgres_protocol_handler->read_startup_packet_body(*body_length);
   _postgres_protocol_handler->send_authentication_response();
   _postgres_protocol_handler->send_parameter("server_version", "12");
   _postgres_protocol_handler->send_parameter("server_encoding", "UTF8");
   _postgres_protocol_handler->send_parameter("client_encoding", "UTF8");
   _postgres_protocol_handler->send_parameter("DateStyle", "ISO, DMY");
   _postgres_protocol_handler->send_ready_for_query();
+  _connection_established = true;
 }
 
 void Session::_handle_request() {
   const auto header = _postgres_protocol_handler->read_packet_type();
 
+  // In the copy-in mode, the client may only send CopyData, CopyDone, CopyFail, Flush, and Sync. Flush and Sync are
+  // ignored, as the client does not know whether the backend is in the copy-in mode yet. Any other message (except for
+  // Terminate) aborts COPY and is discarded.
+  if (_copy_data_parser && header != PostgresMessageType::CopyData && header != PostgresMessageType::CopyDone &&
+      header != PostgresMessageType::CopyFail && header != PostgresMessageType::TerminateCommand) {
+    _postgres_protocol_handler->skip_packet();
+    if (header != PostgresMessageType::SyncCommand && header != PostgresMessageType::FlushCommand) {
+      _send_error("Unexpected message during COPY FROM STDIN");
+    }
+    return;
+  }
+
+  // Collected inserts are performed as soon as a message arrives that does not continue the pipeline of Bind and
+  // Execute messages. If the client terminates the session, they are discarded along with the open transaction.
+  if (header != PostgresMessageType::BindCommand && header != PostgresMessageType::ExecuteCommand &&
+      header != PostgresMessageType::DescribeCommand && header != PostgresMessageType::TerminateCommand) {
+    _execute_pending_inserts();
+  }
+
   switch (header) {
     case PostgresMessageType::TerminateCommand: {
       _terminate_session = true;
@@ -94,6 +201,22 @@ void Session::_handle_request() {
       _handle_execute();
       break;
     }
+    case PostgresMessageType::CopyData: {
+      // CopyData messages that arrive after COPY failed are discarded
+      const auto data = _postgres_protocol_handler->read_copy_data_packet();
+      if (_copy_data_parser) _copy_data_parser->append(data);
+      break;
+    }
+    case PostgresMessageType::CopyDone: {
+      _postgres_protocol_handler->read_copy_done_packet();
+      if (_copy_data_parser) _handle_copy_done();
+      break;
+    }
+    case PostgresMessageType::CopyFail: {
+      const auto message = _postgres_protocol_handler->read_copy_fail_packet();
+      if (_copy_data_parser) FailInput("COPY FROM STDIN failed: " + message);
+      break;
+    }
     default:
       Fail("Unknown packet type");
   }
@@ -102,9 +225,17 @@ void Session::_handle_request() {
 void Session::_handle_simple_query() {
   const auto& query = _postgres_protocol_handler->read_query_packet();
 
-  // A simple query command invalidates unnamed portals
+  // A simple query command invalidates unnamed statements and portals
+  // See: https://postgresql.org/docs/12/protocol-flow.html#PROTOCOL-FLOW-EXT-QUERY
+  _prepared_statements.erase("");
   _portals.erase("");
 
+  const auto copy_statement = QueryHandler::parse_copy_statement(query);
+  if (copy_statement) {
+    _handle_copy_statement(*copy_statement);
+    return;
+  }
+
   ExecutionInformation execution_information;
 
   std::tie(execution_information, _transaction_context) =
@@ -131,9 +262,78 @@ void Session::_handle_simple_query() {
   _postgres_protocol_handler->send_ready_for_query();
 }
 
+void Session::_handle_copy_statement(const CopyStatement& copy_statement) {
+  if (copy_statement.direction == CopyStatement::Direction::FromStdin) {
+    AssertInput(Hyrise::get().storage_manager.has_table(copy_statement.table_name),
+                "Did not find a table with the name " + copy_statement.table_name);
+    const auto table = Hyrise::get().storage_manager.get_table(copy_statement.table_name);
+
+    _copy_data_parser = std::make_unique<CopyDataParser>(table->column_definitions(), copy_statement.format,
+                                                         table->target_chunk_size());
+    _copy_table_name = copy_statement.table_name;
+    _postgres_protocol_handler->send_copy_in_response(copy_statement.format,
+                                                      static_cast<uint16_t>(table->column_count()));
+    // ReadyForQuery is sent after CopyDone
+    return;
+  }
+
+  ExecutionInformation execution_information;
+  std::tie(execution_information, _transaction_context) =
+      QueryHandler::execute_pipeline(copy_statement.query, SendExecutionInfo::No, _transaction_context);
+
+  if (!execution_information.error_message.empty()) {
+    _postgres_protocol_handler->send_error_message(execution_information.error_message);
+    _postgres_protocol_handler->send_ready_for_query();
+    return;
+  }
+
+  const auto& result_table = execution_information.result_table;
+  AssertInput(result_table, "COPY TO STDOUT requires a query with a result");
+
+  _postgres_protocol_handler->send_copy_out_response(copy_statement.format,
+                                                     static_cast<uint16_t>(result_table->column_count()));
+  ResultSerializer::send_copy_data(result_table, copy_statement.format, _postgres_protocol_handler);
+  _postgres_protocol_handler->send_status_message(PostgresMessageType::CopyDone);
+  _postgres_protocol_handler->send_command_complete("COPY " + std::to_string(result_table->row_count()));
+  _postgres_protocol_handler->send_ready_for_query();
+}
+
+void Session::_handle_copy_done() {
+  const auto copy_data_parser = std::move(_copy_data_parser);
+  const auto table = copy_data_parser->finish();
+
+  // Outside of a transaction block, COPY is performed by its own transaction
+  const auto transaction_context = _transaction_context ? _transaction_context
+                                   : Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  const auto insert = std::make_shared<Insert>(_copy_table_name, table_wrapper);
+  insert->set_transaction_context_recursively(transaction_context);
+  QueryHandler::execute_prepared_plan(insert);
+
+  AssertInput(transaction_context->phase() != TransactionPhase::RolledBackAfterConflict,
+              "Transaction conflict during COPY FROM STDIN, transaction was rolled back");
+  if (transaction_context != _transaction_context) transaction_context->commit();
+
+  _postgres_protocol_handler->send_command_complete("COPY " + std::to_string(table->row_count()));
+  _postgres_protocol_handler->send_ready_for_query();
+}
+
 void Session::_handle_parse_command() {
   const auto [statement_name, query] = _postgres_protocol_handler->read_parse_packet();
-  QueryHandler::setup_prepared_plan(statement_name, query);
+
+  // Named prepared statements must be explicitly closed before they can be redefined by another Parse message.
+  // An unnamed prepared statement lasts only until the next Parse statement specifying the unnamed statement as
+  // destination is issued
+  // https://www.postgresql.org/docs/12/protocol-flow.html#PROTOCOL-FLOW-EXT-QUERY
+  const auto statement_it = _prepared_statements.find(statement_name);
+  if (statement_it != _prepared_statements.end()) {
+    AssertInput(statement_name.empty(),
+                "Named prepared statements must be explicitly closed before they can be redefined.");
+    _prepared_statements.erase(statement_it);
+  }
+
+  _prepared_statements[statement_name] = _prepare_statement(query);
 
   _postgres_protocol_handler->send_status_message(PostgresMessageType::ParseComplete);
 
@@ -143,6 +343,32 @@ void Session::_handle_parse_command() {
 void Session::_handle_bind_command() {
   const auto parameters = _postgres_protocol_handler->read_bind_packet();
 
+  const auto statement_it = _prepared_statements.find(parameters.statement_name);
+  auto prepared_statement = statement_it != _prepared_statements.end() ? statement_it->second : nullptr;
+
+  // If a DDL statement has dropped or replaced a table that the statement refers to, it is prepared again
+  if (prepared_statement && !QueryHandler::is_valid(*prepared_statement)) {
+    prepared_statement = _prepare_statement(prepared_statement->query);
+    statement_it->second = prepared_statement;
+  }
+
+  // Collect single-row inserts that are bound to the unnamed portal. If the previously collected statement differs or
+  // its last binding has not been executed, the collected inserts are performed first.
+  if (prepared_statement && prepared_statement->is_single_row_insert && parameters.portal.empty() &&
+      parameters.parameters.size() == prepared_statement->prepared_plan->parameter_ids.size()) {
+    if (_pending_insert_statement != prepared_statement ||
+        _pending_insert_execution_count < _pending_insert_parameters.size()) {
+      _execute_pending_inserts();
+    }
+
+    _portals.erase("");
+    _pending_insert_statement = prepared_statement;
+    _pending_insert_parameters.emplace_back(parameters.parameters);
+    return;
+  }
+
+  _execute_pending_inserts();
+
   // Named portals must be explicitly closed before they can be redefined by another Bind message,
   // but this is not required for the unnamed portal.
   // https://www.postgresql.org/docs/12/static/protocol-flow.html
@@ -157,7 +383,8 @@ void Session::_handle_bind_command() {
   // this nullptr gets replaced by the correct pqp. Before executing the prepared statement we make a check for errors.
   _portals.emplace(parameters.portal, nullptr);
 
-  const auto pqp = QueryHandler::bind_prepared_plan(parameters);
+  AssertInput(prepared_statement, "The specified statement does not exist.");
+  const auto pqp = QueryHandler::bind_prepared_statement(*prepared_statement, parameters.parameters);
 
   _portals[parameters.portal] = pqp;
   _postgres_protocol_handler->send_status_message(PostgresMessageType::BindComplete);
@@ -177,6 +404,13 @@ void Session::_sync() {
 void Session::_handle_execute() {
   const std::string& portal_name = _postgres_protocol_handler->read_execute_packet();
 
+  if (portal_name.empty() && _pending_insert_execution_count < _pending_insert_parameters.size()) {
+    ++_pending_insert_execution_count;
+    return;
+  }
+
+  _execute_pending_inserts();
+
   auto portal_it = _portals.find(portal_name);
   AssertInput(portal_it != _portals.end(), "The specified portal does not exist.");
 
@@ -212,4 +446,88 @@ void Session::_handle_execute() {
       ResultSerializer::build_command_complete_message(physical_plan->type(), row_count));
   // Ready for query + flush will be done after reading sync message
 }
+
+std::shared_ptr<PreparedStatement> Session::_prepare_statement(const std::string& query) {
+  if (_prepared_statement_cache.has(query)) {
+    const auto cached_statement = _prepared_statement_cache.get(query);
+    if (QueryHandler::is_valid(*cached_statement)) return cached_statement;
+    _prepared_statement_cache.erase(query);
+  }
+
+  const auto prepared_statement = QueryHandler::prepare_statement(query);
+  if (prepared_statement->cacheable) _prepared_statement_cache.set(query, prepared_statement);
+  return prepared_statement;
+}
+
+void Session::_execute_pending_inserts() {
+  if (_pending_insert_parameters.empty()) return;
+
+  const auto prepared_statement = std::move(_pending_insert_statement);
+  auto parameters = std::move(_pending_insert_parameters);
+  const auto bind_count = parameters.size();
+  const auto execution_count = _pending_insert_execution_count;
+  parameters.resize(execution_count);
+
+  _pending_insert_statement = nullptr;
+  _pending_insert_parameters.clear();
+  _pending_insert_execution_count = 0;
+
+  if (execution_count > 0) {
+    // The messages of the inserts have already been read, so errors are handled here. As either all or none of the
+    // rows are inserted, a single error is reported for all of them. No response is sent for the individual rows
+    // before the Insert has succeeded.
+    try {
+      const auto physical_plan = QueryHandler::bind_single_row_inserts(*prepared_statement, parameters);
+
+      if (!_transaction_context) {
+        _transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+      }
+      physical_plan->set_transaction_context_recursively(_transaction_context);
+
+      QueryHandler::execute_prepared_plan(physical_plan);
+    } catch (const std::exception& e) {
+      _send_error(e.what());
+      return;
+    }
+
+    // A failed Insert (e.g., due to a violated unique constraint) does not throw, but rolls back the transaction
+    if (_transaction_context->phase() == TransactionPhase::RolledBackAfterConflict) {
+      _transaction_context.reset();
+      _send_error(ErrorMessage{{PostgresMessageType::HumanReadableError,
+                                "Transaction conflict, transaction was rolled back. Failed statement: pipelined "
+                                "inserts of " + std::to_string(execution_count) + " row(s)"},
+                               {PostgresMessageType::SqlstateCodeError, TRANSACTION_CONFLICT}});
+      return;
+    }
+  }
+
+  for (auto bind_idx = size_t{0}; bind_idx < bind_count; ++bind_idx) {
+    _postgres_protocol_handler->send_status_message(PostgresMessageType::BindComplete);
+    if (bind_idx < execution_count) {
+      _postgres_protocol_handler->send_status_message(PostgresMessageType::NoDataResponse);
+      _postgres_protocol_handler->send_command_complete(
+          ResultSerializer::build_command_complete_message(OperatorType::Insert, 1));
+    }
+  }
+}
+
+void Session::_send_error(const std::string& message) {
+  std::cerr << "Exception in session with client port " << _socket->remote_endpoint().port() << ":" << std::endl
+            << message << std::endl;
+  _send_error(ErrorMessage{{PostgresMessageType::HumanReadableError, message}});
+}
+
+void Session::_send_error(const ErrorMessage& error_message) {
+  // An error ends the copy-in mode
+  _copy_data_parser.reset();
+
+  _postgres_protocol_handler->send_error_message(error_message);
+  _postgres_protocol_handler->send_ready_for_query();
+  // In case of an error, an error message has to be send to the client followed by a "ReadyForQuery" message.
+  // Messages that have already been received are processed further. A "sync" message makes the server send
+  // another "ReadyForQuery" message. In order to avoid this, we set this flag for further operations. As soon as
+  // a new query arrives it must be set to false again to ensure correct message flow.
+  _sync_send_after_error = true;
+}
+
 }  // namespace opossum
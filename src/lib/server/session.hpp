@@ -1,9 +1,20 @@
 #pragma once
 
+#include <array>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "cache/lru_cache.hpp"
 #include "concurrency/transaction_context.hpp"
+#include "copy_data_parser.hpp"
 #include "operators/abstract_operator.hpp"
 #include "postgres_protocol_handler.hpp"
+#include "query_handler.hpp"
+#include "ring_buffer_iterator.hpp"
 #include "scheduler/operator_task.hpp"
+#include "session_stream.hpp"
 
 namespace opossum {
 
@@ -12,17 +23,48 @@ namespace opossum {
 // portals used for CURSOR operations are currently not supported by Hyrise. For further documentation see here:
 // https://www.postgresql.org/docs/12/protocol-overview.html#PROTOCOL-QUERY-CONCEPTS
 // Example usage can be found here: https://stackoverflow.com/questions/52479293/postgresql-refcursor-and-portal-name
-class Session {
+//
+// A session does not occupy a thread while it waits for the client. Instead, the server's I/O threads receive the
+// client's data asynchronously until at least one message is complete. The complete messages are then handled by a
+// JobTask on the scheduler, which also executes the queries. The task reads the messages from and writes its responses
+// to an in-memory SessionStream, so it never waits for a slow client. Once the task has handled all complete messages,
+// the responses are sent asynchronously and the session receives further data from the client. Thus, only one task or
+// I/O operation per session is active at any time and the session-specific data needs no synchronization.
+//
+// Prepared statements of the extended query protocol belong to the session. As drivers (e.g., JDBC) parse the same SQL
+// string as the unnamed statement over and over again, the session caches prepared statements by their SQL string.
+// Cached and named statements are prepared again once a DDL statement drops or replaces a table that they refer to.
+// Drivers also pipeline many Bind/Execute pairs of the same INSERT statement before sending a Sync message. Consecutive
+// executions of a statement that inserts a single row are collected and performed by a single Insert operator once a
+// different message arrives. The responses to the collected messages are sent afterwards, in their original order.
+//
+// `COPY ... FROM STDIN` switches the session into the copy-in mode, in which the client sends the rows in CopyData
+// messages. They are parsed while the client is still sending and inserted by a single Insert operator once the client
+// sends CopyDone. `COPY ... TO STDOUT` sends the result of a query in CopyData messages.
+// See https://www.postgresql.org/docs/12/protocol-flow.html#PROTOCOL-COPY
+class Session : public std::enable_shared_from_this<Session> {
  public:
-  explicit Session(boost::asio::io_service& io_service, const SendExecutionInfo send_execution_info);
+  Session(const std::shared_ptr<Socket>& socket, const SendExecutionInfo send_execution_info);
 
-  // Start new session.
-  void run();
+  // Start new session. The session is kept alive by its pending operations until the client disconnects.
+  void start();
 
   std::shared_ptr<Socket> socket();
 
  private:
-  // Establish new connection by exchanging parameters.
+  // Receive data from the client asynchronously. Once messages are complete, schedule _handle_requests.
+  void _receive_requests();
+
+  // Pass the messages that have been received completely to the stream. Returns whether there were any.
+  bool _extract_complete_messages(const size_t received_byte_count);
+
+  // Handle all complete messages that have been received, then send the responses.
+  void _handle_requests();
+
+  // Send the responses written by _handle_requests asynchronously, then receive further requests.
+  void _send_responses();
+
+  // Establish new connection by exchanging parameters. Does nothing but deny SSL if the client requests it.
   void _establish_connection();
 
   // Determine message and call the appropriate method.
@@ -31,6 +73,12 @@ class Session {
   // Execute plain SQL statement.
   void _handle_simple_query();
 
+  // Start COPY FROM STDIN or perform COPY TO STDOUT.
+  void _handle_copy_statement(const CopyStatement& copy_statement);
+
+  // Insert the rows received in the copy-in mode.
+  void _handle_copy_done();
+
   // Parse prepared statement.
   void _handle_parse_command();
 
@@ -43,15 +91,50 @@ class Session {
   // Execute prepared statement and send row description.
   void _handle_execute();
 
+  // Return the prepared statement for the query, which is taken from the cache if it is still valid.
+  std::shared_ptr<PreparedStatement> _prepare_statement(const std::string& query);
+
+  // Execute the collected single-row inserts and send the responses to their Bind and Execute messages.
+  void _execute_pending_inserts();
+
+  // Send an error message, followed by a "ReadyForQuery" message.
+  void _send_error(const std::string& message);
+  void _send_error(const ErrorMessage& error_message);
+
   // Commit current transaction.
   void _sync();
 
   const std::shared_ptr<Socket> _socket;
-  const std::shared_ptr<PostgresProtocolHandler<Socket>> _postgres_protocol_handler;
+  const std::shared_ptr<SessionStream> _stream;
+  const std::shared_ptr<PostgresProtocolHandler<SessionStream>> _postgres_protocol_handler;
+
+  // Written by the I/O threads. _partial_message holds the data of a message that has not been received completely.
+  std::array<char, SERVER_BUFFER_SIZE> _receive_buffer;
+  std::string _partial_message;
+  // Startup packets have no message type. The client sends another one if the server denies its SSL request.
+  bool _expect_startup_packet = true;
+
   const SendExecutionInfo _send_execution_info;
+  bool _connection_established = false;
   bool _terminate_session = false;
   bool _sync_send_after_error = false;
   std::shared_ptr<TransactionContext> _transaction_context;
   std::unordered_map<std::string, std::shared_ptr<AbstractOperator>> _portals;
+  std::unordered_map<std::string, std::shared_ptr<PreparedStatement>> _prepared_statements;
+
+  static constexpr auto PREPARED_STATEMENT_CACHE_CAPACITY = size_t{64};
+  LRUCache<std::string, std::shared_ptr<PreparedStatement>> _prepared_statement_cache{
+      PREPARED_STATEMENT_CACHE_CAPACITY};
+
+  // Single-row inserts that have been bound to the unnamed portal but not yet performed. Only the first
+  // _pending_insert_execution_count of them have been executed by the client. The last one might still await its
+  // Execute message.
+  std::shared_ptr<PreparedStatement> _pending_insert_statement;
+  std::vector<std::vector<AllTypeVariant>> _pending_insert_parameters;
+  size_t _pending_insert_execution_count = 0;
+
+  // Set while the session is in the copy-in mode
+  std::unique_ptr<CopyDataParser> _copy_data_parser;
+  std::string _copy_table_name;
 };
 }  // namespace opossum
@@ -0,0 +1,22 @@
+#include "session_stream.hpp"
+
+#include <utility>
+
+namespace opossum {
+
+void SessionStream::receive(const std::string_view data) {
+  // Drop the data that has been read already so that the buffer does not grow over the session's lifetime
+  _received_data.erase(0, _read_position);
+  _read_position = 0;
+  _received_data.append(data);
+}
+
+bool SessionStream::has_unread_data() const { return _read_position < _received_data.size(); }
+
+std::string SessionStream::take_written_data() {
+  auto written_data = std::string{};
+  std::swap(written_data, _written_data);
+  return written_data;
+}
+
+}  // namespace opossum
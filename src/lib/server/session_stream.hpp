@@ -0,0 +1,57 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+#include <boost/asio.hpp>
+
+namespace opossum {
+
+// In-memory stream that the PostgresProtocolHandler of a Session reads from and writes to. The I/O threads fill it with
+// the complete messages received from the client, and the responses written to it are sent asynchronously once the
+// session's task has handled the messages. Thus, the task never blocks on the network. The stream is only accessed by
+// either an I/O thread or the session's task, never concurrently, so it needs no synchronization.
+class SessionStream {
+ public:
+  // Make data received from the client available for reading
+  void receive(const std::string_view data);
+
+  // Returns whether there is received data that has not been read yet
+  bool has_unread_data() const;
+
+  // Returns the data written since the last call and removes it from the stream
+  std::string take_written_data();
+
+  // Satisfies the SyncReadStream requirements of boost::asio::read. As the session only hands complete messages to the
+  // stream, reading beyond the received data is a protocol violation. It fails like a read from a closed socket.
+  template <typename MutableBufferSequence>
+  size_t read_some(const MutableBufferSequence& buffers, boost::system::error_code& error_code) {
+    const auto bytes_read = boost::asio::buffer_copy(
+        buffers, boost::asio::buffer(_received_data.data() + _read_position, _received_data.size() - _read_position));
+    _read_position += bytes_read;
+
+    error_code = bytes_read == 0 && boost::asio::buffer_size(buffers) > 0 ? boost::asio::error::eof
+                                                                          : boost::system::error_code{};
+    return bytes_read;
+  }
+
+  // Satisfies the SyncWriteStream requirements of boost::asio::write
+  template <typename ConstBufferSequence>
+  size_t write_some(const ConstBufferSequence& buffers, boost::system::error_code& error_code) {
+    const auto previous_size = _written_data.size();
+    const auto bytes_written = boost::asio::buffer_size(buffers);
+    _written_data.resize(previous_size + bytes_written);
+    boost::asio::buffer_copy(boost::asio::buffer(_written_data.data() + previous_size, bytes_written), buffers);
+
+    error_code = {};
+    return bytes_written;
+  }
+
+ private:
+  std::string _received_data;
+  // Position of the first byte in _received_data that has not been read yet
+  size_t _read_position{0};
+  std::string _written_data;
+};
+
+}  // namespace opossum
@@ -1,6 +1,7 @@
 #include "write_buffer.hpp"
 
 #include "client_disconnect_exception.hpp"
+#include "session_stream.hpp"
 
 namespace opossum {
 
@@ -85,7 +86,7 @@ void WriteBuffer<SocketType>::_flush_if_necessary(const size_t bytes_required) {
   }
 }
 
-template class WriteBuffer<Socket>;
+template class WriteBuffer<SessionStream>;
 template class WriteBuffer<boost::asio::posix::stream_descriptor>;
 
 }  // namespace opossum
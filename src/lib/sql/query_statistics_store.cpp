@@ -0,0 +1,179 @@
+#include "query_statistics_store.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <unordered_map>
+#include <utility>
+
+#include "sql/sql_pipeline_statement.hpp"
+
+namespace opossum {
+
+namespace {
+
+std::atomic<uint64_t> next_store_id{0};
+
+bool is_identifier_character(const char character) {
+  return std::isalnum(static_cast<unsigned char>(character)) || character == '_';
+}
+
+bool is_digit(const char character) { return std::isdigit(static_cast<unsigned char>(character)); }
+
+}  // namespace
+
+float QueryStatistics::query_plan_cache_hit_ratio() const {
+  if (calls == 0) return 0.0f;
+  return static_cast<float>(query_plan_cache_hits) / static_cast<float>(calls);
+}
+
+QueryStatisticsStore::QueryStatisticsStore() : _id(next_store_id++) {}
+
+std::string QueryStatisticsStore::normalize_sql(const std::string& sql) {
+  auto normalized = std::string{};
+  normalized.reserve(sql.size());
+
+  const auto length = sql.size();
+  auto needs_space = false;
+  auto index = size_t{0};
+  while (index < length) {
+    const auto character = sql[index];
+
+    // Collapse whitespace. Leading and trailing whitespace is removed.
+    if (std::isspace(static_cast<unsigned char>(character))) {
+      needs_space = !normalized.empty();
+      ++index;
+      continue;
+    }
+    if (needs_space) {
+      normalized += ' ';
+      needs_space = false;
+    }
+
+    if (character == '\'') {
+      // String literal, where '' is an escaped quote
+      ++index;
+      while (index < length) {
+        if (sql[index] == '\'') {
+          if (index + 1 < length && sql[index + 1] == '\'') {
+            index += 2;
+            continue;
+          }
+          ++index;
+          break;
+        }
+        ++index;
+      }
+      normalized += '?';
+    } else if (character == '"') {
+      // Quoted identifiers are kept as they are
+      const auto end = sql.find('"', index + 1);
+      const auto identifier_length = end == std::string::npos ? length - index : end - index + 1;
+      normalized.append(sql, index, identifier_length);
+      index += identifier_length;
+    } else if (is_digit(character) && (normalized.empty() || !is_identifier_character(normalized.back()))) {
+      // Numeric literal, potentially with a fractional part and an exponent (e.g., 1.5e-3). Digits that are part of an
+      // identifier (e.g., t1) are not replaced.
+      while (index < length && (is_digit(sql[index]) || sql[index] == '.')) ++index;
+      if (index < length && (sql[index] == 'e' || sql[index] == 'E')) {
+        auto exponent_index = index + 1;
+        if (exponent_index < length && (sql[exponent_index] == '+' || sql[exponent_index] == '-')) ++exponent_index;
+        if (exponent_index < length && is_digit(sql[exponent_index])) {
+          index = exponent_index;
+          while (index < length && is_digit(sql[index])) ++index;
+        }
+      }
+      normalized += '?';
+    } else {
+      normalized += character;
+      ++index;
+    }
+  }
+
+  return normalized;
+}
+
+void QueryStatisticsStore::record(const std::string& sql, const SQLPipelineStatementMetrics& metrics,
+                                  const uint64_t row_count, const size_t peak_intermediate_memory) {
+  auto& shard = _shard_of_current_thread();
+
+  auto normalized_sql = normalize_sql(sql);
+  auto counters_iter = shard.find(normalized_sql);
+  if (counters_iter == shard.end()) {
+    counters_iter = shard.insert({std::move(normalized_sql), std::make_shared<Counters>()}).first;
+  }
+  auto& counters = *counters_iter->second;
+
+  // As only this thread writes to the shard, the maxima can be updated without compare-and-swap loops
+  const auto update_max = [](auto& maximum, const uint64_t value) {
+    if (value > maximum.load(std::memory_order_relaxed)) maximum.store(value, std::memory_order_relaxed);
+  };
+
+  counters.calls.fetch_add(1, std::memory_order_relaxed);
+  if (metrics.query_plan_cache_hit) counters.query_plan_cache_hits.fetch_add(1, std::memory_order_relaxed);
+  counters.rows_returned.fetch_add(row_count, std::memory_order_relaxed);
+
+  const auto durations = std::array<std::chrono::nanoseconds, DURATION_COUNT>{
+      metrics.sql_translation_duration + metrics.optimization_duration + metrics.lqp_translation_duration +
+          metrics.plan_execution_duration,
+      metrics.sql_translation_duration, metrics.optimization_duration, metrics.lqp_translation_duration,
+      metrics.plan_execution_duration};
+  for (auto duration_id = size_t{0}; duration_id < DURATION_COUNT; ++duration_id) {
+    const auto nanoseconds = static_cast<uint64_t>(durations[duration_id].count());
+    counters.total_nanoseconds[duration_id].fetch_add(nanoseconds, std::memory_order_relaxed);
+    update_max(counters.max_nanoseconds[duration_id], nanoseconds);
+  }
+
+  update_max(counters.peak_intermediate_memory, peak_intermediate_memory);
+}
+
+std::vector<QueryStatistics> QueryStatisticsStore::statistics() const {
+  auto statistics_by_sql = std::unordered_map<std::string, QueryStatistics>{};
+
+  {
+    const auto lock = std::lock_guard<std::mutex>{_shards_mutex};
+    for (const auto& shard : _shards) {
+      for (const auto& [normalized_sql, counters] : *shard) {
+        auto& statistics = statistics_by_sql[normalized_sql];
+        statistics.normalized_sql = normalized_sql;
+        statistics.calls += counters->calls.load(std::memory_order_relaxed);
+        statistics.query_plan_cache_hits += counters->query_plan_cache_hits.load(std::memory_order_relaxed);
+        statistics.rows_returned += counters->rows_returned.load(std::memory_order_relaxed);
+
+        const auto durations = std::array<QueryStatistics::Durations*, DURATION_COUNT>{
+            &statistics.latency, &statistics.sql_translation, &statistics.optimization, &statistics.lqp_translation,
+            &statistics.plan_execution};
+        for (auto duration_id = size_t{0}; duration_id < DURATION_COUNT; ++duration_id) {
+          const auto total = counters->total_nanoseconds[duration_id].load(std::memory_order_relaxed);
+          const auto max = counters->max_nanoseconds[duration_id].load(std::memory_order_relaxed);
+          durations[duration_id]->total += std::chrono::nanoseconds{total};
+          durations[duration_id]->max = std::max(durations[duration_id]->max, std::chrono::nanoseconds{max});
+        }
+
+        statistics.peak_intermediate_memory = std::max(
+            statistics.peak_intermediate_memory,
+            static_cast<size_t>(counters->peak_intermediate_memory.load(std::memory_order_relaxed)));
+      }
+    }
+  }
+
+  auto result = std::vector<QueryStatistics>{};
+  result.reserve(statistics_by_sql.size());
+  for (auto& entry : statistics_by_sql) {
+    result.emplace_back(std::move(entry.second));
+  }
+  return result;
+}
+
+QueryStatisticsStore::Shard& QueryStatisticsStore::_shard_of_current_thread() {
+  // Threads look up their shard without synchronization. Only registering a new shard takes the lock.
+  thread_local auto shard_by_store_id = std::unordered_map<uint64_t, Shard*>{};
+
+  auto& shard = shard_by_store_id[_id];
+  if (!shard) {
+    const auto lock = std::lock_guard<std::mutex>{_shards_mutex};
+    shard = _shards.emplace_back(std::make_unique<Shard>()).get();
+  }
+  return *shard;
+}
+
+}  // namespace opossum
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <tbb/concurrent_unordered_map.h>
+
+#include "types.hpp"
+
+namespace opossum {
+
+struct SQLPipelineStatementMetrics;
+
+// Execution statistics of all statements that share a normalized SQL string (see QueryStatisticsStore)
+struct QueryStatistics {
+  struct Durations {
+    std::chrono::nanoseconds total{0};
+    std::chrono::nanoseconds max{0};
+  };
+
+  std::string normalized_sql;
+  uint64_t calls{0};
+  uint64_t query_plan_cache_hits{0};
+  uint64_t rows_returned{0};
+
+  // The latency is the sum of the four phases below
+  Durations latency;
+  Durations sql_translation;
+  Durations optimization;
+  Durations lqp_translation;
+  Durations plan_execution;
+
+  // Highest peak memory usage of the operators of a single execution (see SQLPipelineStatementMetrics)
+  size_t peak_intermediate_memory{0};
+
+  // Fraction of the calls whose physical plan was taken from the SQLPhysicalPlanCache
+  float query_plan_cache_hit_ratio() const;
+};
+
+/**
+ * Aggregates the metrics of successfully executed SQLPipelineStatements per normalized SQL string, similar to
+ * PostgreSQL's pg_stat_statements. The statistics are exposed by the meta_query_statistics table. Statements are only
+ * recorded if a store is set as Hyrise::default_query_statistics_store.
+ *
+ * Statements are normalized by replacing numeric and string literals with '?' and collapsing whitespace, so that
+ * `SELECT * FROM t WHERE a = 5` and `SELECT * FROM t  WHERE a = 7` share an entry.
+ *
+ * Recording happens for every statement and thus must be cheap. Each thread records into its own shard, which is only
+ * written by that thread. Within a shard, entries are never removed and their counters are atomics. Thus, recording
+ * does not take any lock once the thread has recorded a statement with the same normalized SQL before. Readers merge
+ * the shards of all threads. They might observe a statement's counters while they are being updated, i.e., statistics
+ * are not a consistent snapshot.
+ */
+class QueryStatisticsStore : private Noncopyable {
+ public:
+  QueryStatisticsStore();
+
+  static std::string normalize_sql(const std::string& sql);
+
+  // @param peak_intermediate_memory is the peak memory usage of the statement's operators
+  void record(const std::string& sql, const SQLPipelineStatementMetrics& metrics, const uint64_t row_count,
+              const size_t peak_intermediate_memory);
+
+  // One entry per normalized SQL string, in no particular order
+  std::vector<QueryStatistics> statistics() const;
+
+ private:
+  // The duration counters are indexed in the same order as the QueryStatistics members
+  static constexpr auto DURATION_COUNT = size_t{5};
+
+  struct Counters {
+    std::atomic<uint64_t> calls{0};
+    std::atomic<uint64_t> query_plan_cache_hits{0};
+    std::atomic<uint64_t> rows_returned{0};
+    std::array<std::atomic<uint64_t>, DURATION_COUNT> total_nanoseconds{};
+    std::array<std::atomic<uint64_t>, DURATION_COUNT> max_nanoseconds{};
+    std::atomic<uint64_t> peak_intermediate_memory{0};
+  };
+
+  // Only the owning thread inserts entries and updates counters. tbb::concurrent_unordered_map allows readers to
+  // iterate over the entries concurrently.
+  using Shard = tbb::concurrent_unordered_map<std::string, std::shared_ptr<Counters>>;
+
+  Shard& _shard_of_current_thread();
+
+  // Identifies the store in the thread-local shard lookup. Ids are never reused so that shards of destroyed stores
+  // are never accessed.
+  const uint64_t _id;
+
+  std::vector<std::unique_ptr<Shard>> _shards;
+  mutable std::mutex _shards_mutex;
+};
+
+}  // namespace opossum
@@ -18,9 +18,13 @@ namespace opossum {
 SQLPipeline::SQLPipeline(const std::string& sql, const std::shared_ptr<TransactionContext>& transaction_context,
                          const UseMvcc use_mvcc, const std::shared_ptr<Optimizer>& optimizer,
                          const std::shared_ptr<SQLPhysicalPlanCache>& init_pqp_cache,
-                         const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache)
+                         const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache,
+                         const std::shared_ptr<SQLResultCache>& init_result_cache,
+                         const std::optional<size_t>& init_memory_limit)
     : pqp_cache(init_pqp_cache),
       lqp_cache(init_lqp_cache),
+      result_cache(init_result_cache),
+      memory_limit(init_memory_limit),
       _sql(sql),
       _transaction_context(transaction_context),
       _optimizer(optimizer) {
@@ -82,8 +86,9 @@ SQLPipeline::SQLPipeline(const std::string& sql, const std::shared_ptr<Transacti
     const auto statement_string = boost::trim_copy(sql.substr(sql_string_offset, statement_string_length));
     sql_string_offset += statement_string_length;
 
-    auto pipeline_statement = std::make_shared<SQLPipelineStatement>(statement_string, std::move(parsed_statement),
-                                                                     use_mvcc, optimizer, pqp_cache, lqp_cache);
+    auto pipeline_statement = std::make_shared<SQLPipelineStatement>(
+        statement_string, std::move(parsed_statement), use_mvcc, optimizer, pqp_cache, lqp_cache, result_cache,
+        memory_limit);
     _sql_pipeline_statements.emplace_back(std::move(pipeline_statement));
   }
 
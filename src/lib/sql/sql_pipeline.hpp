@@ -35,7 +35,9 @@ class SQLPipeline : public Noncopyable {
   SQLPipeline(const std::string& sql, const std::shared_ptr<TransactionContext>& transaction_context,
               const UseMvcc use_mvcc, const std::shared_ptr<Optimizer>& optimizer,
               const std::shared_ptr<SQLPhysicalPlanCache>& init_pqp_cache,
-              const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache);
+              const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache,
+              const std::shared_ptr<SQLResultCache>& init_result_cache,
+              const std::optional<size_t>& init_memory_limit);
 
   // Returns the original SQL string
   const std::string& get_sql() const;
@@ -95,6 +97,8 @@ class SQLPipeline : public Noncopyable {
 
   const std::shared_ptr<SQLPhysicalPlanCache> pqp_cache;
   const std::shared_ptr<SQLLogicalPlanCache> lqp_cache;
+  const std::shared_ptr<SQLResultCache> result_cache;
+  const std::optional<size_t> memory_limit;
 
  private:
   friend class SQLPipelineStatementTest;
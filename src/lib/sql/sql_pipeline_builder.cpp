@@ -5,7 +5,11 @@
 namespace opossum {
 
 SQLPipelineBuilder::SQLPipelineBuilder(const std::string& sql)
-    : _sql(sql), _pqp_cache(Hyrise::get().default_pqp_cache), _lqp_cache(Hyrise::get().default_lqp_cache) {}
+    : _sql(sql),
+      _pqp_cache(Hyrise::get().default_pqp_cache),
+      _lqp_cache(Hyrise::get().default_lqp_cache),
+      _result_cache(Hyrise::get().default_result_cache),
+      _memory_limit(Hyrise::get().default_statement_memory_limit) {}
 
 SQLPipelineBuilder& SQLPipelineBuilder::with_mvcc(const UseMvcc use_mvcc) {
   _use_mvcc = use_mvcc;
@@ -35,12 +39,23 @@ SQLPipelineBuilder& SQLPipelineBuilder::with_lqp_cache(const std::shared_ptr<SQL
   return *this;
 }
 
+SQLPipelineBuilder& SQLPipelineBuilder::with_result_cache(const std::shared_ptr<SQLResultCache>& result_cache) {
+  _result_cache = result_cache;
+  return *this;
+}
+
+SQLPipelineBuilder& SQLPipelineBuilder::with_memory_limit(const std::optional<size_t>& memory_limit) {
+  _memory_limit = memory_limit;
+  return *this;
+}
+
 SQLPipelineBuilder& SQLPipelineBuilder::disable_mvcc() { return with_mvcc(UseMvcc::No); }
 
 SQLPipeline SQLPipelineBuilder::create_pipeline() const {
   DTRACE_PROBE1(HYRISE, CREATE_PIPELINE, reinterpret_cast<uintptr_t>(this));
   auto optimizer = _optimizer ? _optimizer : Optimizer::create_default_optimizer();
-  auto pipeline = SQLPipeline(_sql, _transaction_context, _use_mvcc, optimizer, _pqp_cache, _lqp_cache);
+  auto pipeline = SQLPipeline(_sql, _transaction_context, _use_mvcc, optimizer, _pqp_cache, _lqp_cache, _result_cache,
+                              _memory_limit);
   DTRACE_PROBE3(HYRISE, PIPELINE_CREATION_DONE, pipeline.get_sql_per_statement().size(), _sql.c_str(),
                 reinterpret_cast<uintptr_t>(this));
   return pipeline;
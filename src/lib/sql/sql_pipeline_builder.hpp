@@ -1,11 +1,13 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 
 #include "types.hpp"
 
 #include "sql/sql_plan_cache.hpp"
+#include "sql/sql_result_cache.hpp"
 #include "sql_pipeline.hpp"
 #include "sql_pipeline_statement.hpp"
 
@@ -28,6 +30,8 @@ class Optimizer;
  * Defaults:
  *  - MVCC is enabled
  *  - The default Optimizer (Optimizer::create_default_optimizer()) is used.
+ *  - The caches are Hyrise's default caches. By default, there is no result cache.
+ *  - The memory limit per statement is Hyrise's default_statement_memory_limit. By default, there is no limit.
  *
  * Favour this interface over calling the SQLPipeline[Statement] constructors with their long parameter list.
  * See SQLPipeline[Statement] doc for these classes, in short SQLPipeline ist for queries with multiple statement,
@@ -42,6 +46,10 @@ class SQLPipelineBuilder final {
   SQLPipelineBuilder& with_transaction_context(const std::shared_ptr<TransactionContext>& transaction_context);
   SQLPipelineBuilder& with_pqp_cache(const std::shared_ptr<SQLPhysicalPlanCache>& pqp_cache);
   SQLPipelineBuilder& with_lqp_cache(const std::shared_ptr<SQLLogicalPlanCache>& lqp_cache);
+  SQLPipelineBuilder& with_result_cache(const std::shared_ptr<SQLResultCache>& result_cache);
+
+  // Limits the memory of each statement in bytes (see SQLPipelineStatement). std::nullopt disables the limit.
+  SQLPipelineBuilder& with_memory_limit(const std::optional<size_t>& memory_limit);
 
   /**
    * Short for with_mvcc(UseMvcc::No)
@@ -58,6 +66,8 @@ class SQLPipelineBuilder final {
   std::shared_ptr<Optimizer> _optimizer;
   std::shared_ptr<SQLPhysicalPlanCache> _pqp_cache;
   std::shared_ptr<SQLLogicalPlanCache> _lqp_cache;
+  std::shared_ptr<SQLResultCache> _result_cache;
+  std::optional<size_t> _memory_limit;
 };
 
 }  // namespace opossum
@@ -2,6 +2,7 @@
 
 #include <fstream>
 #include <iomanip>
+#include <optional>
 #include <utility>
 
 #include <boost/algorithm/string.hpp>
@@ -19,7 +20,10 @@
 #include "operators/maintenance/drop_table.hpp"
 #include "operators/maintenance/drop_view.hpp"
 #include "optimizer/optimizer.hpp"
+#include "optimizer/strategy/materialized_view_rule.hpp"
 #include "scheduler/job_task.hpp"
+#include "statistics/cardinality_feedback_store.hpp"
+#include "sql/query_statistics_store.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "sql/sql_plan_cache.hpp"
 #include "sql/sql_translator.hpp"
@@ -31,14 +35,21 @@ namespace opossum {
 SQLPipelineStatement::SQLPipelineStatement(const std::string& sql, std::shared_ptr<hsql::SQLParserResult> parsed_sql,
                                            const UseMvcc use_mvcc, const std::shared_ptr<Optimizer>& optimizer,
                                            const std::shared_ptr<SQLPhysicalPlanCache>& init_pqp_cache,
-                                           const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache)
+                                           const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache,
+                                           const std::shared_ptr<SQLResultCache>& init_result_cache,
+                                           const std::optional<size_t>& init_memory_limit)
     : pqp_cache(init_pqp_cache),
       lqp_cache(init_lqp_cache),
+      result_cache(init_result_cache),
+      memory_limit(init_memory_limit),
       _sql_string(sql),
       _use_mvcc(use_mvcc),
       _optimizer(optimizer),
       _parsed_sql_statement(std::move(parsed_sql)),
-      _metrics(std::make_shared<SQLPipelineStatementMetrics>()) {
+      _metrics(std::make_shared<SQLPipelineStatementMetrics>()),
+      _memory_tracker(memory_limit || Hyrise::get().default_query_statistics_store
+                          ? std::make_shared<MemoryTracker>(nullptr, memory_limit)
+                          : nullptr) {
   Assert(!_parsed_sql_statement || _parsed_sql_statement->size() == 1,
          "SQLPipelineStatement must hold exactly one SQL statement");
   DebugAssert(!_sql_string.empty(), "An SQLPipelineStatement should always contain a SQL statement string for caching");
@@ -136,10 +147,24 @@ const std::shared_ptr<AbstractLQPNode>& SQLPipelineStatement::get_optimized_logi
   // As the unoptimized LQP is only used for visualization, we can afford to recreate it if necessary.
   _unoptimized_logical_plan = nullptr;
 
-  _optimized_logical_plan = _optimizer->optimize(std::move(unoptimized_lqp));
+  // Materialized views are only used if their contents match the snapshot of the executing transaction. Plans that
+  // read them are therefore not cached. As with the SQLResultCache, statements within an explicit transaction do not
+  // use views, because they might have to see the transaction's own uncommitted modifications.
+  auto materialized_view_scope = std::optional<MaterializedViewRule::SnapshotScope>{};
+  if (_transaction_context && _transaction_context->is_auto_commit()) {
+    materialized_view_scope.emplace(_transaction_context->snapshot_commit_id());
+  }
+
+  const auto rule_metrics = std::make_shared<std::vector<OptimizerRuleMetrics>>();
+  _optimized_logical_plan = _optimizer->optimize(std::move(unoptimized_lqp), rule_metrics);
+
+  if (materialized_view_scope && materialized_view_scope->used_views()) {
+    _translation_info.cacheable = false;
+  }
 
   const auto done = std::chrono::high_resolution_clock::now();
   _metrics->optimization_duration = std::chrono::duration_cast<std::chrono::nanoseconds>(done - started);
+  _metrics->optimizer_rule_metrics = std::move(*rule_metrics);
 
   // Cache newly created plan for the according sql statement
   if (lqp_cache && _translation_info.cacheable) {
@@ -209,6 +234,9 @@ const std::vector<std::shared_ptr<AbstractTask>>& SQLPipelineStatement::get_task
     _tasks = _get_transaction_tasks();
   } else {
     _precheck_ddl_operators(get_physical_plan());
+
+    // The tasks capture the tracker (if any) so that the memory of the operators is charged to this statement
+    const auto memory_tracking_scope = MemoryTrackingScope{_memory_tracker};
     auto operator_tasks = OperatorTask::make_tasks_from_operator(get_physical_plan());
     _tasks = std::vector<std::shared_ptr<AbstractTask>>(operator_tasks.cbegin(), operator_tasks.cend());
   }
@@ -241,8 +269,11 @@ std::vector<std::shared_ptr<AbstractTask>> SQLPipelineStatement::_get_transactio
 }
 
 std::pair<SQLPipelineStatus, const std::shared_ptr<const Table>&> SQLPipelineStatement::get_result_table() {
-  // Returns true if a transaction was set and that transaction was rolled back.
+  // Returns true if a transaction was set and that transaction was rolled back or if the statement exceeded its memory
+  // limit, in which case its remaining operators were skipped (see OperatorTask).
   const auto has_failed = [&]() {
+    if (_memory_tracker && _memory_tracker->limit_exceeded()) return true;
+
     if (_transaction_context) {
       DebugAssert(_transaction_context->phase() == TransactionPhase::Active ||
                       _transaction_context->phase() == TransactionPhase::RolledBackByUser ||
@@ -262,6 +293,19 @@ std::pair<SQLPipelineStatus, const std::shared_ptr<const Table>&> SQLPipelineSta
     return {SQLPipelineStatus::Success, _result_table};
   }
 
+  const auto uses_result_cache = _uses_result_cache();
+  if (uses_result_cache) {
+    if (const auto cached_result = result_cache->try_get(get_optimized_logical_plan())) {
+      _result_table = cached_result;
+      _metrics->result_cache_hit = true;
+
+      // The auto-commit transaction context might have been created already (e.g., by get_tasks())
+      if (_transaction_context) _transaction_context->commit();
+      _record_statistics();
+      return {SQLPipelineStatus::Success, _result_table};
+    }
+  }
+
   const auto& tasks = get_tasks();
 
   const auto started = std::chrono::high_resolution_clock::now();
@@ -271,6 +315,11 @@ std::pair<SQLPipelineStatus, const std::shared_ptr<const Table>&> SQLPipelineSta
 
   Hyrise::get().scheduler()->schedule_and_wait_for_tasks(tasks);
 
+  if (_memory_tracker) {
+    _metrics->peak_memory_usage = _memory_tracker->peak_usage();
+    _metrics->memory_limit_exceeded = _memory_tracker->limit_exceeded();
+  }
+
   if (has_failed()) {
     return {SQLPipelineStatus::Failure, _result_table};
   }
@@ -296,6 +345,45 @@ std::pair<SQLPipelineStatus, const std::shared_ptr<const Table>&> SQLPipelineSta
 
   if (!_result_table) _query_has_output = false;
 
+  if (HardwareCounters::is_enabled()) {
+    for (const auto& task : tasks) {
+      const auto operator_task = std::dynamic_pointer_cast<const OperatorTask>(task);
+      if (!operator_task) continue;
+
+      const auto& op = operator_task->get_operator();
+      if (const auto& hardware_counters = op->performance_data().hardware_counters) {
+        _metrics->hardware_counters_by_operator[op->name()] += *hardware_counters;
+      }
+    }
+  }
+
+  if (uses_result_cache && _result_table) {
+    result_cache->set(get_optimized_logical_plan(), _result_table, _transaction_context->snapshot_commit_id());
+  }
+
+  // Let later estimations benefit from the cardinalities observed during the execution. Cached plans were copied
+  // without their LQP nodes and cannot be recorded. If the feedback corrected any estimation, the cached plans that
+  // contain the corrected predicates or joins (which include the plan of this statement) may have been optimized
+  // based on the wrong estimation and are evicted. The plans are cached again once their estimations are stable.
+  const auto& cardinality_feedback_store = Hyrise::get().default_cardinality_feedback_store;
+  if (cardinality_feedback_store && !_is_transaction_statement() && !_metrics->query_plan_cache_hit) {
+    const auto changed_signatures = cardinality_feedback_store->record(_physical_plan);
+    if (!changed_signatures.empty()) {
+      if (pqp_cache) {
+        pqp_cache->erase_if([&](const auto& /* sql_string */, const auto& cached_pqp) {
+          return CardinalityFeedbackStore::contains_signature(cached_pqp, changed_signatures);
+        });
+      }
+      if (lqp_cache) {
+        lqp_cache->erase_if([&](const auto& /* sql_string */, const auto& cached_lqp) {
+          return CardinalityFeedbackStore::contains_signature(cached_lqp, changed_signatures);
+        });
+      }
+    }
+  }
+
+  _record_statistics();
+
   DTRACE_PROBE8(HYRISE, SUMMARY, _sql_string.c_str(), _metrics->sql_translation_duration.count(),
                 _metrics->optimization_duration.count(), _metrics->lqp_translation_duration.count(),
                 _metrics->plan_execution_duration.count(), _metrics->query_plan_cache_hit, get_tasks().size(),
@@ -340,11 +428,14 @@ void SQLPipelineStatement::_precheck_ddl_operators(const std::shared_ptr<Abstrac
       const auto drop_table = std::dynamic_pointer_cast<DropTable>(pqp);
       AssertInput(drop_table->if_exists || storage_manager.has_table(drop_table->table_name),
                   "There is no table '" + drop_table->table_name + "'.");
+      AssertInput(!storage_manager.has_materialized_view(drop_table->table_name),
+                  "'" + drop_table->table_name + "' is a materialized view, use DROP VIEW instead.");
       break;
     }
     case OperatorType::DropView: {
       const auto drop_view = std::dynamic_pointer_cast<DropView>(pqp);
-      AssertInput(drop_view->if_exists || storage_manager.has_view(drop_view->view_name),
+      AssertInput(drop_view->if_exists || storage_manager.has_view(drop_view->view_name) ||
+                      storage_manager.has_materialized_view(drop_view->view_name),
                   "There is no view '" + drop_view->view_name + "'.");
       break;
     }
@@ -363,4 +454,21 @@ bool SQLPipelineStatement::_is_transaction_statement() {
   return get_parsed_sql_statement()->getStatements().front()->isType(hsql::kStmtTransaction);
 }
 
+void SQLPipelineStatement::_record_statistics() {
+  const auto& query_statistics_store = Hyrise::get().default_query_statistics_store;
+  if (!query_statistics_store) return;
+
+  const auto row_count = _result_table ? _result_table->row_count() : uint64_t{0};
+  query_statistics_store->record(_sql_string, *_metrics, row_count, _metrics->peak_memory_usage);
+}
+
+bool SQLPipelineStatement::_uses_result_cache() {
+  // Statements within an explicit transaction might see their own uncommitted changes, and without MVCC, the snapshot
+  // of a result is unknown.
+  if (!result_cache || _use_mvcc == UseMvcc::No || _is_transaction_statement()) return false;
+  if (_transaction_context && !_transaction_context->is_auto_commit()) return false;
+
+  return SQLResultCache::is_cacheable(get_optimized_logical_plan());
+}
+
 }  // namespace opossum
@@ -1,19 +1,24 @@
 #pragma once
 
+#include <map>
 #include <memory>
+#include <optional>
 #include <string>
 
 #include "SQLParserResult.h"
 #include "cache/cache.hpp"
 #include "concurrency/transaction_context.hpp"
 #include "logical_query_plan/lqp_translator.hpp"
+#include "memory/memory_tracker.hpp"
 #include "optimizer/optimizer.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/job_task.hpp"
 #include "scheduler/operator_task.hpp"
 #include "sql/sql_translator.hpp"
 #include "sql_plan_cache.hpp"
+#include "sql_result_cache.hpp"
 #include "storage/table.hpp"
+#include "utils/hardware_counters.hpp"
 
 namespace opossum {
 
@@ -21,10 +26,20 @@ namespace opossum {
 struct SQLPipelineStatementMetrics {
   std::chrono::nanoseconds sql_translation_duration{};
   std::chrono::nanoseconds optimization_duration{};
+  std::vector<OptimizerRuleMetrics> optimizer_rule_metrics;
   std::chrono::nanoseconds lqp_translation_duration{};
   std::chrono::nanoseconds plan_execution_duration{};
 
   bool query_plan_cache_hit = false;
+  bool result_cache_hit = false;
+
+  // Only filled if HardwareCounters are enabled. Operators with the same name are summed up.
+  std::map<std::string, HardwareCounters> hardware_counters_by_operator;
+
+  // Peak memory allocated by the operators during the execution (see MemoryTracker). Only tracked if the statement has
+  // a memory limit or if query statistics are recorded.
+  size_t peak_memory_usage{0};
+  bool memory_limit_exceeded{false};
 };
 
 enum class SQLPipelineStatus {
@@ -49,6 +64,18 @@ enum class SQLPipelineStatus {
  *  If a physical plan for an SQL statement is in the SQLPhysicalPlanCache, it will be used instead of translating the
  *  optimized LQP (get_optimized_logical_plans()) into a PQP. Thus, in this case, the optimized LQP and PQP could be
  *  different.
+ *
+ * NOTE:
+ *  If an SQLResultCache is passed, the results of read-only statements that are not part of an explicit transaction
+ *  are retrieved from and stored in it. In case of a hit, no tasks are executed.
+ *
+ * NOTE:
+ *  If a memory_limit is given or query statistics are recorded, the memory allocated by the operators is tracked (see
+ *  MemoryTracker and SQLPipelineStatementMetrics). With a memory_limit, memory-intensive operators try to reduce
+ *  their footprint when the limit is approached. Once it is exceeded, the remaining operators are skipped, the
+ *  transaction (if any) is rolled back with RollbackReason::OutOfMemory, and the statement fails
+ *  (SQLPipelineStatus::Failure). As allocations do not fail, the limit can be exceeded by the operators that are
+ *  running when it is hit. JoinHash and AggregateHash stop between their phases in that case.
  */
 class SQLPipelineStatement : public Noncopyable {
  public:
@@ -56,7 +83,9 @@ class SQLPipelineStatement : public Noncopyable {
   SQLPipelineStatement(const std::string& sql, std::shared_ptr<hsql::SQLParserResult> parsed_sql,
                        const UseMvcc use_mvcc, const std::shared_ptr<Optimizer>& optimizer,
                        const std::shared_ptr<SQLPhysicalPlanCache>& init_pqp_cache,
-                       const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache);
+                       const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache,
+                       const std::shared_ptr<SQLResultCache>& init_result_cache,
+                       const std::optional<size_t>& init_memory_limit);
 
   // Set the transaction context if this SQLPipelineStatement should not auto-commit.
   void set_transaction_context(const std::shared_ptr<TransactionContext>& transaction_context);
@@ -101,10 +130,18 @@ class SQLPipelineStatement : public Noncopyable {
 
   const std::shared_ptr<SQLPhysicalPlanCache> pqp_cache;
   const std::shared_ptr<SQLLogicalPlanCache> lqp_cache;
+  const std::shared_ptr<SQLResultCache> result_cache;
+  const std::optional<size_t> memory_limit;
 
  private:
   bool _is_transaction_statement();
 
+  // Returns true if the result of this statement may be retrieved from and stored in the result_cache
+  bool _uses_result_cache();
+
+  // Adds the metrics of the successfully executed statement to the default QueryStatisticsStore, if any
+  void _record_statistics();
+
   // Returns the tasks that execute transaction statements
   std::vector<std::shared_ptr<AbstractTask>> _get_transaction_tasks();
 
@@ -131,6 +168,10 @@ class SQLPipelineStatement : public Noncopyable {
 
   std::shared_ptr<SQLPipelineStatementMetrics> _metrics;
 
+  // Tracks the memory allocated by the operators of this statement and enforces the memory_limit. nullptr if there is
+  // neither a limit nor a QueryStatisticsStore, as tracking adds overhead to each allocation.
+  const std::shared_ptr<MemoryTracker> _memory_tracker;
+
   // Either a multi-statement transaction context that was passed in using set_transaction_context or an auto-commit
   // transaction context created by the SQLPipelineStatement itself. Might be changed during the execution of this
   // statement, e.g., if it is a BEGIN statement.
@@ -0,0 +1,191 @@
+#include "sql_result_cache.hpp"
+
+#include <algorithm>
+
+#include "cache/gdfs_cache.hpp"
+#include "hyrise.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+SQLResultCache::SQLResultCache(const size_t capacity, const size_t memory_budget)
+    : _capacity(capacity),
+      _memory_budget(memory_budget),
+      _impl(std::make_unique<GDFSCache<LQPKey, std::shared_ptr<Entry>>>(capacity)) {}
+
+bool SQLResultCache::is_cacheable(const std::shared_ptr<AbstractLQPNode>& lqp) {
+  auto cacheable = true;
+
+  for (const auto& subplan_root : lqp_find_subplan_roots(lqp)) {
+    visit_lqp(subplan_root, [&](const auto& node) {
+      switch (node->type) {
+        case LQPNodeType::Aggregate:
+        case LQPNodeType::Alias:
+        case LQPNodeType::DummyTable:
+        case LQPNodeType::Except:
+        case LQPNodeType::Intersect:
+        case LQPNodeType::Join:
+        case LQPNodeType::Limit:
+        case LQPNodeType::Predicate:
+        case LQPNodeType::Projection:
+        case LQPNodeType::Root:
+        case LQPNodeType::Sort:
+        case LQPNodeType::Union:
+        case LQPNodeType::Validate:
+          return LQPVisitation::VisitInputs;
+
+        case LQPNodeType::StoredTable: {
+          // Meta tables are generated on access and do not track their modifications
+          const auto& table_name = static_cast<const StoredTableNode&>(*node).table_name;
+          cacheable &= Hyrise::get().storage_manager.has_table(table_name);
+          return LQPVisitation::VisitInputs;
+        }
+
+        default:
+          // Data modification, DDL, and nodes with tables that are not managed by the StorageManager
+          cacheable = false;
+          return LQPVisitation::DoNotVisitInputs;
+      }
+    });
+
+    if (!cacheable) return false;
+  }
+
+  return true;
+}
+
+std::shared_ptr<const Table> SQLResultCache::try_get(const std::shared_ptr<AbstractLQPNode>& lqp) {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+
+  const auto key = LQPKey{lqp};
+  if (!_impl->has(key)) {
+    ++_miss_count;
+    return nullptr;
+  }
+
+  auto& entry = *_impl->get(key);
+  if (!entry.result || !_is_valid(entry)) {
+    // The cache policies cannot remove single entries. Release the result instead, the entry is replaced by the next
+    // set() for the same plan or evicted.
+    _memory_usage -= entry.memory_usage;
+    entry.result = nullptr;
+    entry.memory_usage = 0;
+    ++_miss_count;
+    return nullptr;
+  }
+
+  ++_hit_count;
+  return entry.result;
+}
+
+void SQLResultCache::set(const std::shared_ptr<AbstractLQPNode>& lqp, const std::shared_ptr<const Table>& result,
+                         const CommitID snapshot_commit_id) {
+  if (!is_cacheable(lqp)) return;
+
+  auto entry = std::make_shared<Entry>();
+  entry->result = result;
+  entry->memory_usage = result->memory_usage(MemoryUsageCalculationMode::Sampled);
+  entry->snapshot_commit_id = snapshot_commit_id;
+  if (entry->memory_usage > _memory_budget) return;
+
+  // The entry is only valid if the tables are not modified after the snapshot. Check this now, too, so that results of
+  // transactions that could not see the latest commits are not cached.
+  auto& storage_manager = Hyrise::get().storage_manager;
+  for (const auto& subplan_root : lqp_find_subplan_roots(lqp)) {
+    visit_lqp(subplan_root, [&](const auto& node) {
+      if (node->type == LQPNodeType::StoredTable) {
+        const auto& table_name = static_cast<const StoredTableNode&>(*node).table_name;
+        entry->tables.emplace_back(table_name, storage_manager.get_table(table_name));
+      }
+      return LQPVisitation::VisitInputs;
+    });
+  }
+  if (!_is_valid(*entry)) return;
+
+  // The key must not be modified by the caller, e.g., by the optimizer of a later statement
+  const auto key = LQPKey{lqp->deep_copy()};
+
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+
+  _impl->set(key, entry, 1.0, static_cast<double>(std::max(entry->memory_usage, size_t{1})));
+
+  // The entry may have replaced an older one for the same plan or the policy may have evicted another entry
+  _memory_usage = 0;
+  for (const auto& [_, cached_entry] : *_impl) {
+    _memory_usage += cached_entry->memory_usage;
+  }
+
+  _enforce_memory_budget();
+}
+
+void SQLResultCache::clear() {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  _impl->clear();
+  _memory_usage = 0;
+}
+
+size_t SQLResultCache::size() const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _impl->size();
+}
+
+size_t SQLResultCache::capacity() const { return _capacity; }
+
+size_t SQLResultCache::memory_usage() const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _memory_usage;
+}
+
+size_t SQLResultCache::memory_budget() const { return _memory_budget; }
+
+size_t SQLResultCache::hit_count() const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _hit_count;
+}
+
+size_t SQLResultCache::miss_count() const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _miss_count;
+}
+
+bool SQLResultCache::LQPKey::operator==(const LQPKey& other) const { return *lqp == *other.lqp; }
+
+bool SQLResultCache::_is_valid(const Entry& entry) {
+  const auto& storage_manager = Hyrise::get().storage_manager;
+
+  for (const auto& [table_name, weak_table] : entry.tables) {
+    const auto table = weak_table.lock();
+    if (!table || !storage_manager.has_table(table_name) || storage_manager.get_table(table_name) != table) {
+      return false;
+    }
+    if (table->last_commit_id() > entry.snapshot_commit_id) return false;
+  }
+
+  return true;
+}
+
+void SQLResultCache::_enforce_memory_budget() {
+  while (_memory_usage > _memory_budget && _impl->size() > 0) {
+    // Let the policy choose the entry to evict by temporarily shrinking the cache
+    _impl->resize(_impl->size() - 1);
+    _impl->resize(_capacity);
+
+    _memory_usage = 0;
+    for (const auto& [_, entry] : *_impl) {
+      _memory_usage += entry->memory_usage;
+    }
+  }
+}
+
+}  // namespace opossum
+
+namespace std {
+
+size_t hash<opossum::SQLResultCache::LQPKey>::operator()(const opossum::SQLResultCache::LQPKey& key) const {
+  return key.lqp->hash();
+}
+
+}  // namespace std
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "cache/abstract_cache_impl.hpp"
+#include "cache/cache.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+class Table;
+
+/**
+ * Opt-in cache for the results of read-only statements. It is used by an SQLPipelineStatement if one is passed to the
+ * SQLPipelineBuilder (see with_result_cache() and Hyrise::default_result_cache).
+ *
+ * Entries are keyed by the optimized LQP of a statement, compared by AbstractLQPNode::operator==(). That is, the key
+ * is normalized by the optimizer. The parameters of prepared statements are part of it, as they are inserted into the
+ * LQP before it is optimized.
+ *
+ * An entry remembers the stored tables that its plan reads and the snapshot in which its result was computed. It
+ * becomes invalid as soon as a transaction that inserted, deleted, or updated rows of one of these tables commits
+ * after that snapshot (see Table::last_commit_id()) or when one of the tables is dropped or replaced. The results of
+ * invalid entries are released on lookup.
+ *
+ * Which entry is evicted when the cache is full is decided by the cache policy (GDFS by default, which prefers to
+ * evict large results). Besides the number of entries, the memory used by the cached results (see
+ * Table::memory_usage()) is bounded.
+ *
+ * The cache is thread-safe.
+ */
+class SQLResultCache : private Noncopyable {
+ public:
+  static constexpr auto DEFAULT_MEMORY_BUDGET = size_t{256} * 1024 * 1024;
+
+  explicit SQLResultCache(const size_t capacity = DefaultCacheCapacity,
+                          const size_t memory_budget = DEFAULT_MEMORY_BUDGET);
+
+  // Results can only be cached for plans that read stored tables and do not modify any data
+  static bool is_cacheable(const std::shared_ptr<AbstractLQPNode>& lqp);
+
+  // Returns nullptr if there is no valid entry for @param lqp
+  std::shared_ptr<const Table> try_get(const std::shared_ptr<AbstractLQPNode>& lqp);
+
+  // @param snapshot_commit_id is the snapshot in which @param result was computed. Does nothing if @param lqp is not
+  // cacheable or if the result alone exceeds the memory budget.
+  void set(const std::shared_ptr<AbstractLQPNode>& lqp, const std::shared_ptr<const Table>& result,
+           const CommitID snapshot_commit_id);
+
+  void clear();
+
+  // Replaces the cache policy by creating a new object of the given cache type, e.g.,
+  // LRUCache<SQLResultCache::LQPKey, std::shared_ptr<SQLResultCache::Entry>>. Removes all entries.
+  template <class cache_t>
+  void replace_cache_impl() {
+    const auto lock = std::lock_guard<std::mutex>{_mutex};
+    _impl = std::make_unique<cache_t>(_capacity);
+    _memory_usage = 0;
+  }
+
+  size_t size() const;
+  size_t capacity() const;
+
+  // In bytes
+  size_t memory_usage() const;
+  size_t memory_budget() const;
+
+  size_t hit_count() const;
+  size_t miss_count() const;
+
+  // Key of the cache policies, which use std::hash and operator==
+  struct LQPKey {
+    std::shared_ptr<AbstractLQPNode> lqp;
+
+    bool operator==(const LQPKey& other) const;
+  };
+
+  struct Entry {
+    std::shared_ptr<const Table> result;
+    size_t memory_usage{0};
+    CommitID snapshot_commit_id{0};
+
+    // The stored tables the result was computed from
+    std::vector<std::pair<std::string, std::weak_ptr<const Table>>> tables;
+  };
+
+ private:
+  static bool _is_valid(const Entry& entry);
+
+  // Evicts entries, as chosen by the cache policy, until the cached results fit into the memory budget. Expects _mutex
+  // to be locked.
+  void _enforce_memory_budget();
+
+  const size_t _capacity;
+  const size_t _memory_budget;
+
+  std::unique_ptr<AbstractCacheImpl<LQPKey, std::shared_ptr<Entry>>> _impl;
+  size_t _memory_usage{0};
+
+  size_t _hit_count{0};
+  size_t _miss_count{0};
+
+  mutable std::mutex _mutex;
+};
+
+}  // namespace opossum
+
+namespace std {
+
+template <>
+struct hash<opossum::SQLResultCache::LQPKey> {
+  size_t operator()(const opossum::SQLResultCache::LQPKey& key) const;
+};
+
+}  // namespace std
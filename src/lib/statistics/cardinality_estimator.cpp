@@ -30,9 +30,11 @@
 #include "resolve_type.hpp"
 #include "statistics/attribute_statistics.hpp"
 #include "statistics/cardinality_estimation_cache.hpp"
+#include "statistics/cardinality_feedback_store.hpp"
 #include "statistics/statistics_objects/equal_distinct_count_histogram.hpp"
 #include "statistics/statistics_objects/generic_histogram.hpp"
 #include "statistics/statistics_objects/generic_histogram_builder.hpp"
+#include "statistics/subplan_statistics_cache.hpp"
 #include "storage/table.hpp"
 #include "table_statistics.hpp"
 #include "utils/assert.hpp"
@@ -65,6 +67,46 @@ std::optional<float> estimate_null_value_ratio_of_column(const TableStatistics&
   return std::nullopt;
 }
 
+// If the selectivity of @param node was observed when an earlier query was executed, scales @param
+// output_table_statistics so that they reflect that selectivity instead of the estimated one
+std::shared_ptr<TableStatistics> apply_cardinality_feedback(
+    const AbstractLQPNode& node, const std::shared_ptr<TableStatistics>& output_table_statistics,
+    const std::shared_ptr<TableStatistics>& left_input_table_statistics,
+    const std::shared_ptr<TableStatistics>& right_input_table_statistics) {
+  const auto& cardinality_feedback_store = Hyrise::get().default_cardinality_feedback_store;
+  if (!cardinality_feedback_store || cardinality_feedback_store->empty()) return output_table_statistics;
+
+  const auto signature = CardinalityFeedbackStore::signature(node);
+  if (!signature) return output_table_statistics;
+
+  const auto selectivity = cardinality_feedback_store->try_get_selectivity(*signature);
+  if (!selectivity) return output_table_statistics;
+
+  // See CardinalityFeedbackStore for what the selectivity refers to
+  auto input_row_count = left_input_table_statistics->row_count;
+  if (node.type == LQPNodeType::Join) {
+    const auto join_mode = static_cast<const JoinNode&>(node).join_mode;
+    if (join_mode != JoinMode::Semi && join_mode != JoinMode::AntiNullAsTrue &&
+        join_mode != JoinMode::AntiNullAsFalse) {
+      input_row_count *= right_input_table_statistics->row_count;
+    }
+  }
+
+  const auto row_count = *selectivity * input_row_count;
+  if (output_table_statistics->row_count == row_count) return output_table_statistics;
+
+  // If nothing was estimated to be left, there is nothing to scale. Keep the AttributeStatistics as they are.
+  auto column_statistics = output_table_statistics->column_statistics;
+  if (output_table_statistics->row_count > 0) {
+    const auto scale = Selectivity{row_count / output_table_statistics->row_count};
+    for (auto& attribute_statistics : column_statistics) {
+      attribute_statistics = attribute_statistics->scaled(scale);
+    }
+  }
+
+  return std::make_shared<TableStatistics>(std::move(column_statistics), row_count);
+}
+
 }  // namespace
 
 namespace opossum {
@@ -113,8 +155,34 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_statistics(
     }
   }
 
+  const auto store_in_cardinality_estimation_cache = [&](const std::shared_ptr<TableStatistics>& table_statistics) {
+    if (join_graph_bitmask) {
+      cardinality_estimation_cache.join_graph_statistics_cache->set(*join_graph_bitmask, lqp->column_expressions(),
+                                                                    table_statistics);
+    }
+
+    if (cardinality_estimation_cache.statistics_by_lqp) {
+      cardinality_estimation_cache.statistics_by_lqp->emplace(lqp, table_statistics);
+    }
+  };
+
+  /**
+   * 2. Lookup in the process-wide SubplanStatisticsCache, which is shared between queries. Only the estimations of
+   *    PredicateNodes and JoinNodes are expensive enough to be worth it.
+   */
+  const auto& subplan_statistics_cache = Hyrise::get().default_subplan_statistics_cache;
+  const auto use_subplan_statistics_cache =
+      subplan_statistics_cache && (lqp->type == LQPNodeType::Predicate || lqp->type == LQPNodeType::Join);
+  if (use_subplan_statistics_cache) {
+    const auto cached_statistics = subplan_statistics_cache->try_get(lqp);
+    if (cached_statistics) {
+      store_in_cardinality_estimation_cache(cached_statistics);
+      return cached_statistics;
+    }
+  }
+
   /**
-   * 2. Cache lookup failed - perform an actual cardinality estimation
+   * 3. Cache lookups failed - perform an actual cardinality estimation
    */
   auto output_table_statistics = std::shared_ptr<TableStatistics>{};
   const auto left_input_table_statistics = lqp->left_input() ? estimate_statistics(lqp->left_input()) : nullptr;
@@ -227,15 +295,20 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_statistics(
   }
 
   /**
-   * 3. Store output_table_statistics in cache
+   * 4. Prefer the selectivities that were observed when executing earlier queries over the estimated ones
    */
-  if (join_graph_bitmask) {
-    cardinality_estimation_cache.join_graph_statistics_cache->set(*join_graph_bitmask, lqp->column_expressions(),
-                                                                  output_table_statistics);
+  if (lqp->type == LQPNodeType::Predicate || lqp->type == LQPNodeType::Join) {
+    output_table_statistics = apply_cardinality_feedback(*lqp, output_table_statistics, left_input_table_statistics,
+                                                         right_input_table_statistics);
   }
 
-  if (cardinality_estimation_cache.statistics_by_lqp) {
-    cardinality_estimation_cache.statistics_by_lqp->emplace(lqp, output_table_statistics);
+  /**
+   * 5. Store output_table_statistics in caches
+   */
+  store_in_cardinality_estimation_cache(output_table_statistics);
+
+  if (use_subplan_statistics_cache) {
+    subplan_statistics_cache->set(lqp, output_table_statistics);
   }
 
   return output_table_statistics;
@@ -0,0 +1,346 @@
+#include "cardinality_feedback_store.hpp"
+
+#include <algorithm>
+#include <set>
+#include <sstream>
+#include <unordered_set>
+
+#include <boost/algorithm/string/join.hpp>
+
+#include "expression/binary_predicate_expression.hpp"
+#include "expression/expression_utils.hpp"
+#include "expression/lqp_column_expression.hpp"
+#include "hyrise.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "operators/abstract_join_operator.hpp"
+#include "operators/abstract_operator.hpp"
+#include "statistics/cardinality_estimator.hpp"
+#include "statistics/subplan_statistics_cache.hpp"
+#include "statistics/table_statistics.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Describes @param predicate so that flipped binary predicates (e.g., `a < b` and `b > a`) are described equally
+std::string normalized_description(const std::shared_ptr<AbstractExpression>& predicate) {
+  const auto binary_predicate = std::dynamic_pointer_cast<BinaryPredicateExpression>(predicate);
+  if (!binary_predicate) return predicate->description(AbstractExpression::DescriptionMode::ColumnName);
+
+  const auto left_description =
+      binary_predicate->left_operand()->description(AbstractExpression::DescriptionMode::ColumnName);
+  const auto right_description =
+      binary_predicate->right_operand()->description(AbstractExpression::DescriptionMode::ColumnName);
+  if (left_description <= right_description) {
+    return predicate->description(AbstractExpression::DescriptionMode::ColumnName);
+  }
+
+  const auto flipped_predicate =
+      BinaryPredicateExpression{flip_predicate_condition(binary_predicate->predicate_condition),
+                                binary_predicate->right_operand(), binary_predicate->left_operand()};
+  return flipped_predicate.description(AbstractExpression::DescriptionMode::ColumnName);
+}
+
+bool is_semi_or_anti_join(const JoinMode join_mode) {
+  return join_mode == JoinMode::Semi || join_mode == JoinMode::AntiNullAsTrue ||
+         join_mode == JoinMode::AntiNullAsFalse;
+}
+
+// Returns whether the selectivities differ by more than CardinalityFeedbackStore::SELECTIVITY_CHANGE_THRESHOLD
+bool differs_noticeably(const Selectivity lhs, const Selectivity rhs) {
+  if (lhs == rhs) return false;
+  if (lhs == 0 || rhs == 0) return true;
+  return std::max(lhs, rhs) / std::min(lhs, rhs) > CardinalityFeedbackStore::SELECTIVITY_CHANGE_THRESHOLD;
+}
+
+// The CardinalityEstimator can only be used for plans whose leaves provide statistics
+bool is_estimable(const std::shared_ptr<AbstractLQPNode>& lqp) {
+  auto estimable = true;
+  visit_lqp(lqp, [&](const auto& node) {
+    if (node->type == LQPNodeType::StoredTable) {
+      const auto& stored_table_node = static_cast<const StoredTableNode&>(*node);
+      estimable &= Hyrise::get().storage_manager.has_table(stored_table_node.table_name);
+    } else if (node->type == LQPNodeType::Mock || node->type == LQPNodeType::Root) {
+      estimable = false;
+    }
+    return estimable ? LQPVisitation::VisitInputs : LQPVisitation::DoNotVisitInputs;
+  });
+  return estimable;
+}
+
+}  // namespace
+
+namespace opossum {
+
+float CardinalityFeedbackStore::Entry::q_error() const {
+  const auto estimated_cardinality = std::max(estimated_selectivity * input_cardinality, 1.0f);
+  const auto actual_cardinality = std::max(actual_selectivity * input_cardinality, 1.0f);
+  return std::max(estimated_cardinality, actual_cardinality) / std::min(estimated_cardinality, actual_cardinality);
+}
+
+CardinalityFeedbackStore::CardinalityFeedbackStore(const size_t capacity) : _capacity(capacity) {}
+
+std::optional<std::string> CardinalityFeedbackStore::signature(const AbstractLQPNode& node) {
+  auto stream = std::stringstream{};
+  auto predicates = std::vector<std::shared_ptr<AbstractExpression>>{};
+
+  if (node.type == LQPNodeType::Predicate) {
+    stream << "Predicate";
+    predicates.emplace_back(static_cast<const PredicateNode&>(node).predicate());
+  } else if (node.type == LQPNodeType::Join) {
+    const auto& join_node = static_cast<const JoinNode&>(node);
+    if (join_node.join_mode == JoinMode::Cross) return std::nullopt;
+    stream << "Join " << join_node.join_mode;
+    predicates = join_node.join_predicates();
+  } else {
+    return std::nullopt;
+  }
+
+  // Sorted, so that the signature does not depend on the order of the tables or predicates
+  auto table_names = std::set<std::string>{};
+  auto predicate_descriptions = std::vector<std::string>{};
+
+  const auto& storage_manager = Hyrise::get().storage_manager;
+  for (const auto& predicate : predicates) {
+    auto keyable = true;
+    visit_expression(predicate, [&](const auto& sub_expression) {
+      // The selectivities of predicates with subqueries or correlated parameters depend on more than the predicate
+      if (sub_expression->type == ExpressionType::LQPSubquery || sub_expression->type == ExpressionType::PQPSubquery ||
+          sub_expression->type == ExpressionType::CorrelatedParameter) {
+        keyable = false;
+        return ExpressionVisitation::DoNotVisitArguments;
+      }
+
+      if (sub_expression->type == ExpressionType::LQPColumn) {
+        const auto original_node = static_cast<const LQPColumnExpression&>(*sub_expression).original_node.lock();
+        if (!original_node || original_node->type != LQPNodeType::StoredTable) {
+          keyable = false;
+          return ExpressionVisitation::DoNotVisitArguments;
+        }
+
+        const auto& table_name = static_cast<const StoredTableNode&>(*original_node).table_name;
+        keyable &= storage_manager.has_table(table_name);
+        table_names.emplace(table_name);
+      }
+
+      return keyable ? ExpressionVisitation::VisitArguments : ExpressionVisitation::DoNotVisitArguments;
+    });
+
+    if (!keyable) return std::nullopt;
+    predicate_descriptions.emplace_back(normalized_description(predicate));
+  }
+
+  if (table_names.empty()) return std::nullopt;
+
+  std::sort(predicate_descriptions.begin(), predicate_descriptions.end());
+  stream << " [" << boost::algorithm::join(table_names, ", ") << "] "
+         << boost::algorithm::join(predicate_descriptions, " AND ");
+  return stream.str();
+}
+
+std::optional<Selectivity> CardinalityFeedbackStore::try_get_selectivity(const std::string& signature) const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+
+  const auto entry_iter = _entry_by_signature.find(signature);
+  if (entry_iter == _entry_by_signature.end()) return std::nullopt;
+
+  return entry_iter->second->actual_selectivity;
+}
+
+std::unordered_set<std::string> CardinalityFeedbackStore::record(const std::shared_ptr<const AbstractOperator>& pqp) {
+  // Collect the operators that were translated from PredicateNodes and JoinNodes. If a node was translated into
+  // multiple operators (e.g., an IndexScan and a TableScan that each process a part of the chunks), their row counts
+  // do not describe the selectivity of the node, so such nodes are skipped.
+  auto operators_by_node = std::unordered_map<std::shared_ptr<const AbstractLQPNode>,
+                                              std::vector<std::shared_ptr<const AbstractOperator>>>{};
+  auto visited_operators = std::unordered_set<std::shared_ptr<const AbstractOperator>>{};
+
+  auto operator_queue = std::vector<std::shared_ptr<const AbstractOperator>>{pqp};
+  while (!operator_queue.empty()) {
+    const auto op = operator_queue.back();
+    operator_queue.pop_back();
+    if (!op || !visited_operators.emplace(op).second) continue;
+
+    if (op->lqp_node && (op->lqp_node->type == LQPNodeType::Predicate || op->lqp_node->type == LQPNodeType::Join)) {
+      operators_by_node[op->lqp_node].emplace_back(op);
+    }
+
+    operator_queue.emplace_back(op->input_left());
+    operator_queue.emplace_back(op->input_right());
+  }
+
+  if (operators_by_node.empty()) return {};
+
+  // The histogram-based estimations of the nodes are obtained with the estimators' static functions, which do not
+  // consider any feedback. Only the statistics of their inputs are estimated regularly.
+  auto cardinality_estimator = CardinalityEstimator{};
+  cardinality_estimator.guarantee_bottom_up_construction();
+
+  auto changed_signatures = std::unordered_set<std::string>{};
+
+  for (const auto& [const_node, operators] : operators_by_node) {
+    if (operators.size() != 1) continue;
+    const auto& op = operators.front();
+
+    const auto is_join = std::dynamic_pointer_cast<const AbstractJoinOperator>(op) != nullptr;
+    if (!is_join && op->type() != OperatorType::TableScan) continue;
+
+    const auto node_signature = signature(*const_node);
+    if (!node_signature) continue;
+
+    const auto node = std::const_pointer_cast<AbstractLQPNode>(const_node);
+    if (!is_estimable(node)) continue;
+
+    const auto& performance_data = op->performance_data();
+    if (!performance_data.executed || !performance_data.has_output) continue;
+
+    const auto& left_performance_data = op->input_left()->performance_data();
+    if (!left_performance_data.has_output) continue;
+
+    auto input_cardinality = static_cast<Cardinality>(left_performance_data.output_row_count);
+    auto estimated_selectivity = Selectivity{1};
+
+    const auto left_input_statistics = cardinality_estimator.estimate_statistics(node->left_input());
+
+    if (is_join) {
+      const auto& join_node = static_cast<const JoinNode&>(*node);
+      const auto right_input_statistics = cardinality_estimator.estimate_statistics(node->right_input());
+      const auto estimated_statistics =
+          CardinalityEstimator::estimate_join_node(join_node, left_input_statistics, right_input_statistics);
+
+      auto estimated_input_cardinality = left_input_statistics->row_count;
+      if (!is_semi_or_anti_join(join_node.join_mode)) {
+        const auto& right_performance_data = op->input_right()->performance_data();
+        if (!right_performance_data.has_output) continue;
+
+        input_cardinality *= static_cast<Cardinality>(right_performance_data.output_row_count);
+        estimated_input_cardinality *= right_input_statistics->row_count;
+      }
+
+      if (estimated_input_cardinality > 0) {
+        estimated_selectivity = estimated_statistics->row_count / estimated_input_cardinality;
+      }
+    } else {
+      const auto& predicate_node = static_cast<const PredicateNode&>(*node);
+      const auto estimated_statistics = CardinalityEstimator::estimate_predicate_node(predicate_node,
+                                                                                      left_input_statistics);
+
+      if (left_input_statistics->row_count > 0) {
+        estimated_selectivity = estimated_statistics->row_count / left_input_statistics->row_count;
+      }
+    }
+
+    // Without input rows, nothing was learned about the selectivity
+    if (input_cardinality == 0) continue;
+
+    const auto actual_selectivity =
+        static_cast<Selectivity>(static_cast<Cardinality>(performance_data.output_row_count) / input_cardinality);
+    if (record(*node_signature, estimated_selectivity, actual_selectivity, input_cardinality)) {
+      changed_signatures.emplace(*node_signature);
+    }
+  }
+
+  // Statistics of subplans with a changed selectivity that were cached before the feedback was known are outdated now
+  const auto& subplan_statistics_cache = Hyrise::get().default_subplan_statistics_cache;
+  if (!changed_signatures.empty() && subplan_statistics_cache) {
+    subplan_statistics_cache->erase_if(
+        [&](const auto& subplan) { return contains_signature(subplan, changed_signatures); });
+  }
+
+  return changed_signatures;
+}
+
+bool CardinalityFeedbackStore::record(const std::string& signature, const Selectivity estimated_selectivity,
+                                      const Selectivity actual_selectivity, const Cardinality input_cardinality) {
+  if (_capacity == 0) return false;
+
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+
+  const auto entry_iter = _entry_by_signature.find(signature);
+  if (entry_iter == _entry_by_signature.end()) {
+    _entries.emplace_front(Entry{signature, 1, estimated_selectivity, actual_selectivity, input_cardinality});
+    _entry_by_signature.emplace(signature, _entries.begin());
+
+    if (_entries.size() > _capacity) {
+      _entry_by_signature.erase(_entries.back().signature);
+      _entries.pop_back();
+    }
+
+    return differs_noticeably(estimated_selectivity, actual_selectivity);
+  }
+
+  const auto list_iter = entry_iter->second;
+  _entries.splice(_entries.begin(), _entries, list_iter);
+
+  auto& entry = *list_iter;
+  const auto previous_selectivity = entry.actual_selectivity;
+
+  ++entry.observation_count;
+  entry.estimated_selectivity = estimated_selectivity;
+  entry.actual_selectivity = actual_selectivity;
+  entry.input_cardinality = input_cardinality;
+
+  return differs_noticeably(previous_selectivity, actual_selectivity);
+}
+
+bool CardinalityFeedbackStore::contains_signature(const std::shared_ptr<AbstractLQPNode>& lqp,
+                                                  const std::unordered_set<std::string>& signatures) {
+  auto found = false;
+  visit_lqp(lqp, [&](const auto& node) {
+    if (found) return LQPVisitation::DoNotVisitInputs;
+
+    const auto node_signature = signature(*node);
+    found = node_signature && signatures.count(*node_signature) > 0;
+    return found ? LQPVisitation::DoNotVisitInputs : LQPVisitation::VisitInputs;
+  });
+  return found;
+}
+
+bool CardinalityFeedbackStore::contains_signature(const std::shared_ptr<const AbstractOperator>& pqp,
+                                                  const std::unordered_set<std::string>& signatures) {
+  auto visited_operators = std::unordered_set<std::shared_ptr<const AbstractOperator>>{};
+
+  auto operator_queue = std::vector<std::shared_ptr<const AbstractOperator>>{pqp};
+  while (!operator_queue.empty()) {
+    const auto op = operator_queue.back();
+    operator_queue.pop_back();
+    if (!op || !visited_operators.emplace(op).second) continue;
+
+    // Operators of plans that were taken from a cache have no LQP node
+    if (op->lqp_node) {
+      const auto node_signature = signature(*op->lqp_node);
+      if (node_signature && signatures.count(*node_signature)) return true;
+    }
+
+    operator_queue.emplace_back(op->input_left());
+    operator_queue.emplace_back(op->input_right());
+  }
+
+  return false;
+}
+
+std::vector<CardinalityFeedbackStore::Entry> CardinalityFeedbackStore::entries() const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return {_entries.begin(), _entries.end()};
+}
+
+void CardinalityFeedbackStore::clear() {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  _entry_by_signature.clear();
+  _entries.clear();
+}
+
+bool CardinalityFeedbackStore::empty() const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _entries.empty();
+}
+
+size_t CardinalityFeedbackStore::size() const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _entries.size();
+}
+
+}  // namespace opossum
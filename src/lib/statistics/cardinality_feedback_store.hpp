@@ -0,0 +1,102 @@
+#pragma once
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+class AbstractOperator;
+
+/**
+ * Process-wide store of the selectivities that predicates and joins actually had when their plans were executed.
+ * The CardinalityEstimator prefers them over its histogram-based estimations, so that queries that are executed
+ * repeatedly do not suffer from the same misestimations (and, e.g., the same bad join order) every time.
+ *
+ * Observations are taken from the OperatorPerformanceData of executed PQPs: The selectivity of a TableScan is its
+ * output row count divided by its input row count. The selectivity of a join is its output row count divided by the
+ * size of the cross product of its inputs (or by the row count of its left input for semi and anti joins).
+ *
+ * Entries are keyed by a signature of the PredicateNode or JoinNode that the operator was translated from. It does
+ * not depend on the concrete LQP and consists of the names of the referenced tables, the join mode, and the
+ * normalized predicates. For example, `a > 5` and `5 < a` on the same table share an entry. Only nodes whose columns
+ * all stem from stored tables have a signature.
+ *
+ * The number of entries is bounded; the least recently observed entry is evicted first. The store is thread-safe.
+ */
+class CardinalityFeedbackStore : private Noncopyable {
+ public:
+  struct Entry {
+    std::string signature;
+    size_t observation_count{0};
+
+    // Both refer to the last observation. The estimated selectivity is the histogram-based one.
+    Selectivity estimated_selectivity{0};
+    Selectivity actual_selectivity{0};
+    Cardinality input_cardinality{0};
+
+    // max(estimated, actual) / min(estimated, actual) output row count, both at least one
+    float q_error() const;
+  };
+
+  static constexpr auto DEFAULT_CAPACITY = size_t{4'096};
+
+  // Observations that differ from the selectivity that estimations were based on by no more than this factor do not
+  // count as a change
+  static constexpr auto SELECTIVITY_CHANGE_THRESHOLD = 1.1f;
+
+  explicit CardinalityFeedbackStore(const size_t capacity = DEFAULT_CAPACITY);
+
+  // Returns std::nullopt if @param node is neither a PredicateNode nor a JoinNode or if it cannot be keyed (see above)
+  static std::optional<std::string> signature(const AbstractLQPNode& node);
+
+  // Returns the most recently observed selectivity for @param signature, if any
+  std::optional<Selectivity> try_get_selectivity(const std::string& signature) const;
+
+  /**
+   * Records the selectivities of all TableScans and joins in the executed @param pqp that were translated from a
+   * PredicateNode or JoinNode. Returns the signatures whose selectivities changed (see below), i.e., those for which
+   * plans that were optimized before are based on outdated estimations. The entries of the default
+   * SubplanStatisticsCache that contain them are evicted, so that later estimations pick up the feedback.
+   */
+  std::unordered_set<std::string> record(const std::shared_ptr<const AbstractOperator>& pqp);
+
+  // Records a single observation. Returns true if the observed selectivity differs noticeably from the one that
+  // estimations were based on before, i.e., from the estimated selectivity for a new entry and from the previously
+  // observed selectivity otherwise.
+  bool record(const std::string& signature, const Selectivity estimated_selectivity,
+              const Selectivity actual_selectivity, const Cardinality input_cardinality);
+
+  // Return whether the plan contains a PredicateNode or JoinNode (or, for PQPs, an operator translated from one) that
+  // has one of the @param signatures. Used to evict cached plans that are based on outdated estimations.
+  static bool contains_signature(const std::shared_ptr<AbstractLQPNode>& lqp,
+                                 const std::unordered_set<std::string>& signatures);
+  static bool contains_signature(const std::shared_ptr<const AbstractOperator>& pqp,
+                                 const std::unordered_set<std::string>& signatures);
+
+  // Most recently observed entry first
+  std::vector<Entry> entries() const;
+
+  void clear();
+
+  bool empty() const;
+  size_t size() const;
+
+ private:
+  const size_t _capacity;
+
+  std::list<Entry> _entries;
+  std::unordered_map<std::string, std::list<Entry>::iterator> _entry_by_signature;
+
+  mutable std::mutex _mutex;
+};
+
+}  // namespace opossum
@@ -0,0 +1,138 @@
+#include "subplan_statistics_cache.hpp"
+
+#include "hyrise.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+SubplanStatisticsCache::SubplanStatisticsCache(const size_t capacity) : _capacity(capacity) {}
+
+std::shared_ptr<TableStatistics> SubplanStatisticsCache::try_get(const std::shared_ptr<AbstractLQPNode>& lqp) {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+
+  const auto entry_iter = _entry_by_lqp.find(lqp);
+  if (entry_iter == _entry_by_lqp.end()) {
+    ++_miss_count;
+    return nullptr;
+  }
+
+  const auto list_iter = entry_iter->second;
+  if (!_is_valid(*list_iter)) {
+    _entry_by_lqp.erase(entry_iter);
+    _entries.erase(list_iter);
+    ++_miss_count;
+    return nullptr;
+  }
+
+  // Move the entry to the front of the LRU list
+  _entries.splice(_entries.begin(), _entries, list_iter);
+  ++_hit_count;
+  return list_iter->table_statistics;
+}
+
+void SubplanStatisticsCache::set(const std::shared_ptr<AbstractLQPNode>& lqp,
+                                 const std::shared_ptr<TableStatistics>& table_statistics) {
+  if (_capacity == 0) return;
+
+  auto base_table_statistics = std::vector<std::pair<std::string, std::weak_ptr<TableStatistics>>>{};
+  auto cacheable = true;
+  visit_lqp(lqp, [&](const auto& node) {
+    if (node->input_count() > 0) return LQPVisitation::VisitInputs;
+
+    // Other leaves (e.g., MockNodes or StaticTableNodes) bring their own statistics, which cannot be tracked. The same
+    // goes for StoredTableNodes whose statistics were modified (e.g., by the ChunkPruningRule).
+    const auto stored_table_node = std::dynamic_pointer_cast<StoredTableNode>(node);
+    if (!stored_table_node || stored_table_node->table_statistics) {
+      cacheable = false;
+      return LQPVisitation::DoNotVisitInputs;
+    }
+
+    const auto& storage_manager = Hyrise::get().storage_manager;
+    if (!storage_manager.has_table(stored_table_node->table_name)) {
+      cacheable = false;
+      return LQPVisitation::DoNotVisitInputs;
+    }
+
+    base_table_statistics.emplace_back(stored_table_node->table_name,
+                                       storage_manager.get_table(stored_table_node->table_name)->table_statistics());
+    return LQPVisitation::DoNotVisitInputs;
+  });
+
+  if (!cacheable) return;
+
+  // Copy the subplan outside of the lock
+  auto entry = Entry{lqp->deep_copy(), table_statistics, std::move(base_table_statistics)};
+
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+
+  const auto entry_iter = _entry_by_lqp.find(lqp);
+  if (entry_iter != _entry_by_lqp.end()) {
+    // Another thread (or an earlier estimation based on outdated statistics) created an entry. Replace it.
+    _entries.erase(entry_iter->second);
+    _entry_by_lqp.erase(entry_iter);
+  }
+
+  _entries.emplace_front(std::move(entry));
+  _entry_by_lqp.emplace(_entries.front().lqp, _entries.begin());
+
+  if (_entries.size() > _capacity) {
+    _entry_by_lqp.erase(_entries.back().lqp);
+    _entries.pop_back();
+  }
+}
+
+void SubplanStatisticsCache::erase_if(const std::function<bool(const std::shared_ptr<AbstractLQPNode>&)>& predicate) {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+
+  for (auto list_iter = _entries.begin(); list_iter != _entries.end();) {
+    if (predicate(list_iter->lqp)) {
+      _entry_by_lqp.erase(list_iter->lqp);
+      list_iter = _entries.erase(list_iter);
+    } else {
+      ++list_iter;
+    }
+  }
+}
+
+void SubplanStatisticsCache::clear() {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  _entry_by_lqp.clear();
+  _entries.clear();
+}
+
+size_t SubplanStatisticsCache::size() const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _entries.size();
+}
+
+size_t SubplanStatisticsCache::capacity() const { return _capacity; }
+
+size_t SubplanStatisticsCache::hit_count() const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _hit_count;
+}
+
+size_t SubplanStatisticsCache::miss_count() const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _miss_count;
+}
+
+bool SubplanStatisticsCache::_is_valid(const Entry& entry) {
+  const auto& storage_manager = Hyrise::get().storage_manager;
+
+  for (const auto& [table_name, weak_table_statistics] : entry.base_table_statistics) {
+    if (!storage_manager.has_table(table_name)) return false;
+
+    const auto table_statistics = weak_table_statistics.lock();
+    if (!table_statistics || table_statistics != storage_manager.get_table(table_name)->table_statistics()) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+}  // namespace opossum
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class TableStatistics;
+
+/**
+ * Process-wide cache of the TableStatistics that the CardinalityEstimator estimated for subplans (currently, plans
+ * rooted in a PredicateNode or JoinNode).
+ *
+ * In contrast to the CardinalityEstimationCache, which lives for a single optimizer invocation at most, this cache is
+ * shared between queries. Workloads often repeat the same query patterns, and thus the same base table predicates and
+ * joins. These are only estimated once.
+ *
+ * The key of the cache is the subplan itself, compared by AbstractLQPNode::operator==(). That is, two subplans share
+ * an entry if they have the same structure and the same predicates, including all literals.
+ *
+ * Only subplans whose leaves are StoredTableNodes using the TableStatistics of their table are cached. An entry
+ * remembers the TableStatistics of the tables it was estimated from. As soon as a table's TableStatistics are
+ * replaced (or the table is dropped), its entries become invalid and are evicted on lookup. The number of entries is
+ * bounded; the least recently used entry is evicted first.
+ *
+ * The cache is thread-safe.
+ */
+class SubplanStatisticsCache : private Noncopyable {
+ public:
+  static constexpr auto DEFAULT_CAPACITY = size_t{4'096};
+
+  explicit SubplanStatisticsCache(const size_t capacity = DEFAULT_CAPACITY);
+
+  // Returns nullptr if there is no valid entry for @param lqp
+  std::shared_ptr<TableStatistics> try_get(const std::shared_ptr<AbstractLQPNode>& lqp);
+
+  // Does nothing if @param lqp cannot be cached (see above)
+  void set(const std::shared_ptr<AbstractLQPNode>& lqp, const std::shared_ptr<TableStatistics>& table_statistics);
+
+  // Evicts the entries whose subplan satisfies @param predicate
+  void erase_if(const std::function<bool(const std::shared_ptr<AbstractLQPNode>&)>& predicate);
+
+  void clear();
+
+  size_t size() const;
+  size_t capacity() const;
+
+  size_t hit_count() const;
+  size_t miss_count() const;
+
+ private:
+  struct Entry {
+    // Deep copy of the subplan, so that the key is not modified when the optimizer continues working on the original
+    std::shared_ptr<AbstractLQPNode> lqp;
+    std::shared_ptr<TableStatistics> table_statistics;
+
+    // The TableStatistics of the stored tables that the estimation was based on
+    std::vector<std::pair<std::string, std::weak_ptr<TableStatistics>>> base_table_statistics;
+  };
+
+  static bool _is_valid(const Entry& entry);
+
+  const size_t _capacity;
+
+  // Most recently used entry first
+  std::list<Entry> _entries;
+  LQPNodeUnorderedMap<std::list<Entry>::iterator> _entry_by_lqp;
+
+  size_t _hit_count{0};
+  size_t _miss_count{0};
+
+  mutable std::mutex _mutex;
+};
+
+}  // namespace opossum
@@ -219,6 +219,8 @@ const std::optional<std::pair<ColumnID, OrderByMode>>& Chunk::ordered_by() const
 
 void Chunk::set_ordered_by(const std::pair<ColumnID, OrderByMode>& ordered_by) { _ordered_by.emplace(ordered_by); }
 
+void Chunk::clear_ordered_by() { _ordered_by.reset(); }
+
 std::optional<CommitID> Chunk::get_cleanup_commit_id() const {
   if (_cleanup_commit_id == 0) {
     // Cleanup-Commit-ID is not yet set
@@ -148,6 +148,9 @@ class Chunk : private Noncopyable {
   const std::optional<std::pair<ColumnID, OrderByMode>>& ordered_by() const;
   void set_ordered_by(const std::pair<ColumnID, OrderByMode>& ordered_by);
 
+  // Called when the values of the sorted column are replaced (see ColumnVersionStore::merge)
+  void clear_ordered_by();
+
   /**
    * Returns the count of deleted/invalidated rows within this chunk resulting from already committed transactions.
    * However, `size() - invalid_row_count()` does not necessarily tell you how many rows are visible for
@@ -0,0 +1,366 @@
+#include "column_version_store.hpp"
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/base_encoded_segment.hpp"
+#include "storage/chunk.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/mvcc_data.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/value_segment.hpp"
+#include "storage/versioned_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Copies the values of the segment into a new ValueSegment and overwrites them with the given values
+std::shared_ptr<BaseSegment> patch_segment(const BaseSegment& segment, const DataType data_type,
+                                           const std::map<ChunkOffset, AllTypeVariant>& patched_values) {
+  auto patched_segment = std::shared_ptr<BaseSegment>{};
+
+  resolve_data_type(data_type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    auto values = pmr_vector<ColumnDataType>(segment.size());
+    auto null_values = pmr_vector<bool>(segment.size());
+    auto has_null_values = false;
+
+    segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+      if (position.is_null()) {
+        null_values[position.chunk_offset()] = true;
+        has_null_values = true;
+      } else {
+        values[position.chunk_offset()] = position.value();
+      }
+    });
+
+    for (const auto& [chunk_offset, value] : patched_values) {
+      if (chunk_offset >= values.size()) break;
+
+      if (variant_is_null(value)) {
+        null_values[chunk_offset] = true;
+        has_null_values = true;
+      } else {
+        values[chunk_offset] = boost::get<ColumnDataType>(value);
+        null_values[chunk_offset] = false;
+      }
+    }
+
+    if (has_null_values) {
+      patched_segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(values), std::move(null_values));
+    } else {
+      patched_segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(values));
+    }
+  });
+
+  return patched_segment;
+}
+
+// Returns whether the values of the segment are sorted according to the given mode. NULLs come first unless the mode
+// says otherwise.
+bool is_sorted(const BaseSegment& segment, const DataType data_type, const OrderByMode order_by_mode) {
+  const auto ascending = order_by_mode == OrderByMode::Ascending || order_by_mode == OrderByMode::AscendingNullsLast;
+  const auto nulls_first = order_by_mode == OrderByMode::Ascending || order_by_mode == OrderByMode::Descending;
+
+  auto sorted = true;
+  resolve_data_type(data_type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    auto previous_value = std::optional<ColumnDataType>{};
+    auto previous_is_null = false;
+    auto is_first = true;
+    segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+      if (!sorted) return;
+
+      if (!is_first) {
+        if (previous_is_null || position.is_null()) {
+          // A NULL may only follow a value if NULLs come last, and vice versa
+          if (previous_is_null != position.is_null() && previous_is_null != nulls_first) sorted = false;
+        } else if (ascending ? position.value() < *previous_value : position.value() > *previous_value) {
+          sorted = false;
+        }
+      }
+
+      is_first = false;
+      previous_is_null = position.is_null();
+      if (!previous_is_null) previous_value = position.value();
+    });
+  });
+
+  return sorted;
+}
+
+}  // namespace
+
+namespace opossum {
+
+bool ColumnVersionStore::try_add_versions(const ChunkOffset chunk_offset,
+                                          const std::vector<std::pair<ColumnID, AllTypeVariant>>& column_values,
+                                          const TransactionID transaction_id, const CommitID snapshot_commit_id) {
+  std::unique_lock lock(_mutex);
+
+  auto& row_versions = _versions[chunk_offset];
+  for (const auto& version : row_versions) {
+    if (version.begin_cid == MvccData::MAX_COMMIT_ID ? version.transaction_id != transaction_id
+                                                     : version.begin_cid > snapshot_commit_id) {
+      return false;
+    }
+  }
+
+  for (const auto& [column_id, value] : column_values) {
+    row_versions.emplace_back(Version{column_id, value, transaction_id, MvccData::MAX_COMMIT_ID});
+
+    if (std::find(_stale_pruning_statistics_column_ids.begin(), _stale_pruning_statistics_column_ids.end(),
+                  column_id) == _stale_pruning_statistics_column_ids.end()) {
+      _stale_pruning_statistics_column_ids.emplace_back(column_id);
+      _has_stale_pruning_statistics = true;
+    }
+  }
+  _version_count += column_values.size();
+
+  return true;
+}
+
+bool ColumnVersionStore::has_conflicting_version(const ChunkOffset chunk_offset, const TransactionID transaction_id,
+                                                 const CommitID snapshot_commit_id) const {
+  if (!has_versions()) return false;
+
+  std::shared_lock lock(_mutex);
+
+  const auto row_versions_iter = _versions.find(chunk_offset);
+  if (row_versions_iter == _versions.end()) return false;
+
+  return std::any_of(row_versions_iter->second.begin(), row_versions_iter->second.end(), [&](const auto& version) {
+    return version.begin_cid == MvccData::MAX_COMMIT_ID ? version.transaction_id != transaction_id
+                                                        : version.begin_cid > snapshot_commit_id;
+  });
+}
+
+void ColumnVersionStore::commit_versions(const TransactionID transaction_id, const CommitID commit_id) {
+  std::unique_lock lock(_mutex);
+
+  for (auto& [chunk_offset, row_versions] : _versions) {
+    for (auto& version : row_versions) {
+      if (version.begin_cid == MvccData::MAX_COMMIT_ID && version.transaction_id == transaction_id) {
+        version.begin_cid = commit_id;
+      }
+    }
+  }
+}
+
+void ColumnVersionStore::rollback_versions(const TransactionID transaction_id) {
+  std::unique_lock lock(_mutex);
+
+  for (auto row_versions_iter = _versions.begin(); row_versions_iter != _versions.end();) {
+    auto& row_versions = row_versions_iter->second;
+    const auto removed_versions_begin =
+        std::remove_if(row_versions.begin(), row_versions.end(), [&](const auto& version) {
+          return version.begin_cid == MvccData::MAX_COMMIT_ID && version.transaction_id == transaction_id;
+        });
+    _version_count -= std::distance(removed_versions_begin, row_versions.end());
+    row_versions.erase(removed_versions_begin, row_versions.end());
+
+    if (row_versions.empty()) {
+      row_versions_iter = _versions.erase(row_versions_iter);
+    } else {
+      ++row_versions_iter;
+    }
+  }
+}
+
+bool ColumnVersionStore::has_versions() const { return _version_count > 0; }
+
+std::shared_ptr<BaseSegment> ColumnVersionStore::visible_segment(const Chunk& chunk, const ColumnID column_id,
+                                                                 const DataType data_type,
+                                                                 const TransactionID transaction_id,
+                                                                 const CommitID snapshot_commit_id) const {
+  if (!has_versions()) return chunk.get_segment(column_id);
+
+  // The segment is retrieved under the lock so that a concurrent merge cannot replace it after we have looked up the
+  // versions (or vice versa).
+  std::shared_lock lock(_mutex);
+
+  const auto segment = chunk.get_segment(column_id);
+  const auto visible_values = _visible_values(column_id, transaction_id, snapshot_commit_id);
+  if (visible_values.empty()) return segment;
+
+  auto versioned_segment = std::shared_ptr<BaseSegment>{};
+  resolve_data_type(data_type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    auto patched_offsets = pmr_vector<ChunkOffset>{};
+    auto patched_values = pmr_vector<ColumnDataType>{};
+    auto patched_null_values = pmr_vector<bool>{};
+    patched_offsets.reserve(visible_values.size());
+    patched_values.reserve(visible_values.size());
+    patched_null_values.reserve(visible_values.size());
+
+    // std::map keeps the offsets sorted
+    for (const auto& [chunk_offset, value] : visible_values) {
+      patched_offsets.emplace_back(chunk_offset);
+      if (variant_is_null(value)) {
+        patched_values.emplace_back();
+        patched_null_values.emplace_back(true);
+      } else {
+        patched_values.emplace_back(boost::get<ColumnDataType>(value));
+        patched_null_values.emplace_back(false);
+      }
+    }
+
+    versioned_segment = std::make_shared<VersionedSegment<ColumnDataType>>(
+        segment, std::move(patched_offsets), std::move(patched_values), std::move(patched_null_values));
+  });
+
+  return versioned_segment;
+}
+
+std::vector<ColumnID> ColumnVersionStore::versioned_column_ids() const {
+  if (!has_versions()) return {};
+
+  std::shared_lock lock(_mutex);
+
+  auto column_ids = std::vector<ColumnID>{};
+  for (const auto& [chunk_offset, row_versions] : _versions) {
+    for (const auto& version : row_versions) {
+      if (std::find(column_ids.begin(), column_ids.end(), version.column_id) == column_ids.end()) {
+        column_ids.emplace_back(version.column_id);
+      }
+    }
+  }
+  std::sort(column_ids.begin(), column_ids.end());
+  return column_ids;
+}
+
+bool ColumnVersionStore::has_stale_pruning_statistics(const ColumnID column_id) const {
+  if (!_has_stale_pruning_statistics) return false;
+
+  std::shared_lock lock(_mutex);
+
+  return std::find(_stale_pruning_statistics_column_ids.begin(), _stale_pruning_statistics_column_ids.end(),
+                   column_id) != _stale_pruning_statistics_column_ids.end();
+}
+
+size_t ColumnVersionStore::merge(Chunk& chunk, const std::vector<DataType>& column_data_types,
+                                 const CommitID lowest_snapshot_commit_id) {
+  Assert(!chunk.is_mutable(), "Cannot merge versions into a mutable chunk, as Insert might still write to it");
+  if (!has_versions()) return 0;
+
+  std::unique_lock lock(_mutex);
+
+  auto merged_values_by_column = std::map<ColumnID, std::map<ChunkOffset, AllTypeVariant>>{};
+  auto merged_version_count = size_t{0};
+
+  for (auto& [chunk_offset, row_versions] : _versions) {
+    // Find the newest version of each column that is visible to all transactions. It and all older versions of the
+    // column are removed.
+    auto merged_columns = std::map<ColumnID, size_t>{};
+    for (auto version_idx = size_t{0}; version_idx < row_versions.size(); ++version_idx) {
+      const auto& version = row_versions[version_idx];
+      if (version.begin_cid == MvccData::MAX_COMMIT_ID || version.begin_cid > lowest_snapshot_commit_id) continue;
+      merged_columns[version.column_id] = version_idx;
+    }
+
+    for (const auto& [column_id, newest_version_idx] : merged_columns) {
+      merged_values_by_column[column_id][chunk_offset] = row_versions[newest_version_idx].value;
+    }
+
+    if (merged_columns.empty()) continue;
+
+    auto remaining_versions = std::vector<Version>{};
+    for (auto version_idx = size_t{0}; version_idx < row_versions.size(); ++version_idx) {
+      const auto merged_column_iter = merged_columns.find(row_versions[version_idx].column_id);
+      if (merged_column_iter == merged_columns.end() || version_idx > merged_column_iter->second) {
+        remaining_versions.emplace_back(std::move(row_versions[version_idx]));
+      }
+    }
+    merged_version_count += row_versions.size() - remaining_versions.size();
+    row_versions = std::move(remaining_versions);
+  }
+
+  for (const auto& [column_id, merged_values] : merged_values_by_column) {
+    const auto segment = chunk.get_segment(column_id);
+    auto merged_segment = patch_segment(*segment, column_data_types[column_id], merged_values);
+
+    if (std::dynamic_pointer_cast<const BaseEncodedSegment>(segment)) {
+      const auto encoding_spec = get_segment_encoding_spec(segment);
+      merged_segment = ChunkEncoder::encode_segment(merged_segment, column_data_types[column_id], encoding_spec);
+    }
+
+    // The merged values of the column the chunk is sorted by might break the sort order. The order is dropped before
+    // the segment is replaced, so that readers do not see the new segment together with the old order.
+    const auto& ordered_by = chunk.ordered_by();
+    if (ordered_by && ordered_by->first == column_id &&
+        !is_sorted(*merged_segment, column_data_types[column_id], ordered_by->second)) {
+      chunk.clear_ordered_by();
+    }
+
+    chunk.replace_segment(column_id, merged_segment);
+  }
+
+  for (auto row_versions_iter = _versions.begin(); row_versions_iter != _versions.end();) {
+    if (row_versions_iter->second.empty()) {
+      row_versions_iter = _versions.erase(row_versions_iter);
+    } else {
+      ++row_versions_iter;
+    }
+  }
+  _version_count -= merged_version_count;
+  _version_count_after_merge = _version_count.load();
+
+  return merged_version_count;
+}
+
+bool ColumnVersionStore::should_merge() const {
+  const auto version_count = _version_count.load();
+  return version_count >= MERGE_THRESHOLD && version_count >= 2 * _version_count_after_merge.load();
+}
+
+bool ColumnVersionStore::try_schedule_merge() { return !_merge_scheduled.exchange(true); }
+
+void ColumnVersionStore::finish_scheduled_merge() { _merge_scheduled = false; }
+
+size_t ColumnVersionStore::memory_usage() const {
+  std::shared_lock lock(_mutex);
+
+  auto bytes = sizeof(*this);
+  for (const auto& [chunk_offset, row_versions] : _versions) {
+    // Approximation of the map node
+    bytes += sizeof(chunk_offset) + sizeof(row_versions) + 4 * sizeof(void*);
+    bytes += row_versions.capacity() * sizeof(Version);
+  }
+  bytes += _stale_pruning_statistics_column_ids.capacity() * sizeof(ColumnID);
+  return bytes;
+}
+
+bool ColumnVersionStore::_is_visible(const Version& version, const TransactionID transaction_id,
+                                     const CommitID snapshot_commit_id) {
+  if (version.begin_cid == MvccData::MAX_COMMIT_ID) return version.transaction_id == transaction_id;
+  return version.begin_cid <= snapshot_commit_id;
+}
+
+std::map<ChunkOffset, AllTypeVariant> ColumnVersionStore::_visible_values(const ColumnID column_id,
+                                                                          const TransactionID transaction_id,
+                                                                          const CommitID snapshot_commit_id) const {
+  auto visible_values = std::map<ChunkOffset, AllTypeVariant>{};
+  for (const auto& [chunk_offset, row_versions] : _versions) {
+    for (auto version_iter = row_versions.rbegin(); version_iter != row_versions.rend(); ++version_iter) {
+      if (version_iter->column_id == column_id && _is_visible(*version_iter, transaction_id, snapshot_commit_id)) {
+        visible_values.emplace(chunk_offset, version_iter->value);
+        break;
+      }
+    }
+  }
+  return visible_values;
+}
+
+}  // namespace opossum
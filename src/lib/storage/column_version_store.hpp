@@ -0,0 +1,119 @@
+#pragma once
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <shared_mutex>  // NOLINT lint thinks this is a C header or something
+#include <utility>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+class Chunk;
+
+/**
+ * Stores the values that were updated in place (see Update) for the rows of a single chunk. The main segments of the
+ * chunk remain untouched, so updating a few columns of a row neither copies the entire row nor moves it to the end of
+ * the table.
+ *
+ * A version becomes visible like an inserted row: to the transaction that created it and, once it is committed, to all
+ * transactions whose snapshot is not older than its commit id. The segments of a chunk with versions are only read
+ * through visible_segment (see GetTable), which overlays the values visible to the given transaction on the main
+ * segment. Versions that are visible to all active transactions are written back into the main segments by merge.
+ * Once should_merge() is true, the Update operator schedules a merge of the (immutable) chunk after it committed
+ * (see try_schedule_merge). The MvccDeletePlugin additionally merges all remaining versions periodically. Versions of
+ * mutable chunks are only merged once the chunk has been finalized.
+ *
+ * The pruning statistics of the chunk are not updated. Instead, the store remembers which columns were ever updated
+ * in place, so that their statistics are not used for chunk pruning anymore (see has_stale_pruning_statistics).
+ *
+ * Uncommitted versions act as row locks for in-place updates. As the Delete operator locks rows through the tid in
+ * MvccData instead, both check for the other kind of lock after acquiring their own.
+ */
+class ColumnVersionStore : private Noncopyable {
+ public:
+  // Adds new values for some columns of a row. Fails if the row has an uncommitted version of a different transaction
+  // or a version that was committed after the snapshot, i.e., on a write-write conflict.
+  bool try_add_versions(const ChunkOffset chunk_offset,
+                        const std::vector<std::pair<ColumnID, AllTypeVariant>>& column_values,
+                        const TransactionID transaction_id, const CommitID snapshot_commit_id);
+
+  // Returns whether the row has a version that conflicts with a write of the given transaction (see try_add_versions)
+  bool has_conflicting_version(const ChunkOffset chunk_offset, const TransactionID transaction_id,
+                               const CommitID snapshot_commit_id) const;
+
+  void commit_versions(const TransactionID transaction_id, const CommitID commit_id);
+  void rollback_versions(const TransactionID transaction_id);
+
+  // Cheap check (no locking) that is used to skip chunks without versions
+  bool has_versions() const;
+
+  /**
+   * Returns the segment of the chunk with the values that are visible to the given transaction. If the column has no
+   * visible versions, this is the main segment itself. Otherwise, it is a VersionedSegment that references the main
+   * segment and only stores the visible versions.
+   */
+  std::shared_ptr<BaseSegment> visible_segment(const Chunk& chunk, const ColumnID column_id, const DataType data_type,
+                                               const TransactionID transaction_id,
+                                               const CommitID snapshot_commit_id) const;
+
+  // Returns the columns for which the store holds versions
+  std::vector<ColumnID> versioned_column_ids() const;
+
+  // Returns whether values of the column were updated in place at any time, even if the versions have been merged
+  // since. The pruning statistics of the chunk might not cover these values.
+  bool has_stale_pruning_statistics(const ColumnID column_id) const;
+
+  /**
+   * Writes the versions that are visible to all transactions with a snapshot of at least lowest_snapshot_commit_id
+   * into new main segments of the (immutable) chunk and removes them. Encoded segments are re-encoded with their
+   * previous encoding. Returns the number of removed versions.
+   */
+  size_t merge(Chunk& chunk, const std::vector<DataType>& column_data_types, const CommitID lowest_snapshot_commit_id);
+
+  // Returns true once MERGE_THRESHOLD versions exist and their number has doubled since the last merge. The latter
+  // prevents repeated merge attempts while a long-running transaction keeps the versions from being merged.
+  bool should_merge() const;
+
+  static constexpr auto MERGE_THRESHOLD = size_t{1'000};
+
+  // Returns true if no merge has been scheduled since the last call of finish_scheduled_merge. The caller is then
+  // responsible for merging the versions and calling finish_scheduled_merge.
+  bool try_schedule_merge();
+  void finish_scheduled_merge();
+
+  size_t memory_usage() const;
+
+ protected:
+  struct Version {
+    ColumnID column_id;
+    AllTypeVariant value;
+    TransactionID transaction_id;
+    CommitID begin_cid;
+  };
+
+  static bool _is_visible(const Version& version, const TransactionID transaction_id,
+                          const CommitID snapshot_commit_id);
+
+  // Returns the newest visible value of the column for each row that has one
+  std::map<ChunkOffset, AllTypeVariant> _visible_values(const ColumnID column_id, const TransactionID transaction_id,
+                                                        const CommitID snapshot_commit_id) const;
+
+  mutable std::shared_mutex _mutex;
+
+  // Versions of a row in the order in which they were created
+  std::map<ChunkOffset, std::vector<Version>> _versions;
+  std::atomic<size_t> _version_count{0};
+  std::atomic<size_t> _version_count_after_merge{0};
+  std::atomic_bool _merge_scheduled{false};
+
+  // Columns that were ever updated in place. Guarded by _mutex, _has_stale_pruning_statistics allows skipping the lock.
+  std::vector<ColumnID> _stale_pruning_statistics_column_ids;
+  std::atomic_bool _has_stale_pruning_statistics{false};
+};
+
+}  // namespace opossum
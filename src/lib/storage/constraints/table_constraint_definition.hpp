@@ -7,19 +7,23 @@
 namespace opossum {
 
 enum class IsPrimaryKey : bool { Yes = true, No = false };
+enum class IsEnforced : bool { Yes = true, No = false };
 
 // Defines a constraint on a table. Can optionally be a PRIMARY KEY, requiring the column(s) to be non-NULL.
-// Constraints are currently NOT ENFORCED.
+// Soft constraints (IsEnforced::No) are NOT ENFORCED. Enforced constraints are backed by a TableHashIndex and checked
+// by the Insert operator (and thus also by Update), see Table::add_unique_constraint.
 
 struct TableConstraintDefinition final {
-  TableConstraintDefinition(std::vector<ColumnID> column_ids, const IsPrimaryKey init_is_primary_key)
-      : columns(std::move(column_ids)), is_primary_key(init_is_primary_key) {
+  TableConstraintDefinition(std::vector<ColumnID> column_ids, const IsPrimaryKey init_is_primary_key,
+                            const IsEnforced init_is_enforced = IsEnforced::No)
+      : columns(std::move(column_ids)), is_primary_key(init_is_primary_key), is_enforced(init_is_enforced) {
     DebugAssert(std::is_sorted(columns.begin(), columns.end()), "Expecting Column IDs to be sorted");
     Assert(std::unique(columns.begin(), columns.end()) == columns.end(), "Expected Column IDs to be unique");
   }
 
   std::vector<ColumnID> columns;
   IsPrimaryKey is_primary_key;
+  IsEnforced is_enforced;
 };
 
 }  // namespace opossum
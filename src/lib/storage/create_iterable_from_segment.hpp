@@ -16,12 +16,21 @@ class RunLengthSegment;
 template <typename T>
 class FixedStringDictionarySegment;
 
+template <typename T>
+class FrontCodedDictionarySegment;
+
 template <typename T, typename>
 class FrameOfReferenceSegment;
 
 template <typename T>
 class LZ4Segment;
 
+template <typename T>
+class FSSTSegment;
+
+template <typename T>
+class VersionedSegment;
+
 class ReferenceSegment;
 template <typename T, EraseReferencedSegmentType>
 class ReferenceSegmentIterable;
@@ -56,6 +65,9 @@ auto create_iterable_from_segment(const RunLengthSegment<T>& segment);
 template <typename T, bool EraseSegmentType = HYRISE_DEBUG>
 auto create_iterable_from_segment(const FixedStringDictionarySegment<T>& segment);
 
+template <typename T, bool EraseSegmentType = HYRISE_DEBUG>
+auto create_iterable_from_segment(const FrontCodedDictionarySegment<T>& segment);
+
 template <typename T, typename Enabled, bool EraseSegmentType = HYRISE_DEBUG>
 auto create_iterable_from_segment(const FrameOfReferenceSegment<T, Enabled>& segment);
 
@@ -68,6 +80,12 @@ auto create_iterable_from_segment(const FrameOfReferenceSegment<T, Enabled>& seg
 template <typename T, bool EraseSegmentType = true>
 auto create_iterable_from_segment(const LZ4Segment<T>& segment);
 
+template <typename T, bool EraseSegmentType = HYRISE_DEBUG>
+auto create_iterable_from_segment(const FSSTSegment<T>& segment);
+
+template <typename T, bool EraseSegmentType = true>
+auto create_iterable_from_segment(const VersionedSegment<T>& segment);
+
 template <typename T, bool EraseSegmentType = HYRISE_DEBUG,
           EraseReferencedSegmentType = (HYRISE_DEBUG ? EraseReferencedSegmentType::Yes
                                                      : EraseReferencedSegmentType::No)>
@@ -2,10 +2,12 @@
 
 #include "storage/dictionary_segment/dictionary_segment_iterable.hpp"
 #include "storage/frame_of_reference_segment/frame_of_reference_segment_iterable.hpp"
+#include "storage/fsst_segment/fsst_segment_iterable.hpp"
 #include "storage/lz4_segment/lz4_segment_iterable.hpp"
 #include "storage/run_length_segment/run_length_segment_iterable.hpp"
 #include "storage/segment_iterables/any_segment_iterable.hpp"
 #include "storage/value_segment/value_segment_iterable.hpp"
+#include "storage/versioned_segment/versioned_segment_iterable.hpp"
 
 namespace opossum {
 
@@ -60,6 +62,20 @@ auto create_iterable_from_segment(const FixedStringDictionarySegment<T>& segment
 #endif
 }
 
+template <typename T, bool EraseSegmentType>
+auto create_iterable_from_segment(const FrontCodedDictionarySegment<T>& segment) {
+#ifdef HYRISE_ERASE_FRONTCODEDDICTIONARY
+  PerformanceWarning("FrontCodedDictionarySegmentIterable erased by compile-time setting");
+  return AnySegmentIterable<T>(DictionarySegmentIterable<T, FrontCodedStringVector>(segment));
+#else
+  if constexpr (EraseSegmentType) {
+    return create_any_segment_iterable<T>(segment);
+  } else {
+    return DictionarySegmentIterable<T, FrontCodedStringVector>{segment};
+  }
+#endif
+}
+
 template <typename T, typename Enabled, bool EraseSegmentType>
 auto create_iterable_from_segment(const FrameOfReferenceSegment<T, Enabled>& segment) {
 #ifdef HYRISE_ERASE_FRAMEOFREFERENCE
@@ -81,4 +97,24 @@ auto create_iterable_from_segment(const LZ4Segment<T>& segment) {
   return AnySegmentIterable<T>(LZ4SegmentIterable<T>(segment));
 }
 
+template <typename T, bool EraseSegmentType>
+auto create_iterable_from_segment(const FSSTSegment<T>& segment) {
+#ifdef HYRISE_ERASE_FSST
+  PerformanceWarning("FSSTSegmentIterable erased by compile-time setting");
+  return AnySegmentIterable<T>(FSSTSegmentIterable<T>(segment));
+#else
+  if constexpr (EraseSegmentType) {
+    return create_any_segment_iterable<T>(segment);
+  } else {
+    return FSSTSegmentIterable<T>{segment};
+  }
+#endif
+}
+
+template <typename T, bool EraseSegmentType>
+auto create_iterable_from_segment(const VersionedSegment<T>& segment) {
+  // VersionedSegment always gets erased as it already iterates over its main segment through an AnySegmentIterable
+  return AnySegmentIterable<T>(VersionedSegmentIterable<T>(segment));
+}
+
 }  // namespace opossum
@@ -7,6 +7,7 @@
 #include "storage/base_segment_encoder.hpp"
 #include "storage/dictionary_segment.hpp"
 #include "storage/fixed_string_dictionary_segment.hpp"
+#include "storage/front_coded_dictionary_segment.hpp"
 #include "storage/segment_iterables/any_segment_iterable.hpp"
 #include "storage/value_segment.hpp"
 #include "storage/vector_compression/base_compressed_vector.hpp"
@@ -92,6 +93,11 @@ class DictionaryEncoder : public SegmentEncoder<DictionaryEncoder<Encoding>> {
       auto fixed_string_dictionary =
           std::make_shared<FixedStringVector>(dictionary->cbegin(), dictionary->cend(), max_string_length, allocator);
       return std::make_shared<FixedStringDictionarySegment<T>>(fixed_string_dictionary, compressed_attribute_vector);
+    } else if constexpr (Encoding == EncodingType::FrontCodedDictionary) {
+      // Encode a segment with a FrontCodedStringVector as dictionary. pmr_string is the only supported type
+      auto front_coded_dictionary =
+          std::make_shared<FrontCodedStringVector>(dictionary->cbegin(), dictionary->cend(), allocator);
+      return std::make_shared<FrontCodedDictionarySegment<T>>(front_coded_dictionary, compressed_attribute_vector);
     } else {
       // Encode a segment with a pmr_vector<T> as dictionary
       return std::make_shared<DictionarySegment<T>>(dictionary, compressed_attribute_vector);
@@ -0,0 +1,129 @@
+#include "front_coded_dictionary_segment.hpp"
+
+#include <memory>
+#include <string>
+
+#include "resolve_type.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
+#include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace opossum {
+
+template <typename T>
+FrontCodedDictionarySegment<T>::FrontCodedDictionarySegment(
+    const std::shared_ptr<const FrontCodedStringVector>& dictionary,
+    const std::shared_ptr<const BaseCompressedVector>& attribute_vector)
+    : BaseDictionarySegment(data_type_from_type<pmr_string>()),
+      _dictionary{dictionary},
+      _attribute_vector{attribute_vector},
+      _decompressor{_attribute_vector->create_base_decompressor()} {}
+
+template <typename T>
+AllTypeVariant FrontCodedDictionarySegment<T>::operator[](const ChunkOffset chunk_offset) const {
+  PerformanceWarning("operator[] used");
+  DebugAssert(chunk_offset != INVALID_CHUNK_OFFSET, "Passed chunk offset must be valid.");
+
+  const auto typed_value = get_typed_value(chunk_offset);
+  if (!typed_value) {
+    return NULL_VALUE;
+  }
+  return *typed_value;
+}
+
+template <typename T>
+std::optional<T> FrontCodedDictionarySegment<T>::get_typed_value(const ChunkOffset chunk_offset) const {
+  DebugAssert(chunk_offset < size(), "ChunkOffset out of bounds.");
+
+  const auto value_id = _decompressor->get(chunk_offset);
+  if (value_id == _dictionary->size()) {
+    return std::nullopt;
+  }
+  return _dictionary->get_string_at(value_id);
+}
+
+template <typename T>
+std::shared_ptr<const FrontCodedStringVector> FrontCodedDictionarySegment<T>::front_coded_dictionary() const {
+  return _dictionary;
+}
+
+template <typename T>
+ChunkOffset FrontCodedDictionarySegment<T>::size() const {
+  return static_cast<ChunkOffset>(_attribute_vector->size());
+}
+
+template <typename T>
+std::shared_ptr<BaseSegment> FrontCodedDictionarySegment<T>::copy_using_allocator(
+    const PolymorphicAllocator<size_t>& alloc) const {
+  auto new_dictionary = std::make_shared<FrontCodedStringVector>(*_dictionary, alloc);
+  auto new_attribute_vector = _attribute_vector->copy_using_allocator(alloc);
+
+  auto copy = std::make_shared<FrontCodedDictionarySegment<T>>(new_dictionary, std::move(new_attribute_vector));
+
+  copy->access_counter = access_counter;
+
+  return copy;
+}
+
+template <typename T>
+size_t FrontCodedDictionarySegment<T>::memory_usage(const MemoryUsageCalculationMode) const {
+  // MemoryUsageCalculationMode ignored as full calculation is efficient.
+  return sizeof(*this) + _dictionary->data_size() + _attribute_vector->data_size();
+}
+
+template <typename T>
+std::optional<CompressedVectorType> FrontCodedDictionarySegment<T>::compressed_vector_type() const {
+  return _attribute_vector->type();
+}
+
+template <typename T>
+EncodingType FrontCodedDictionarySegment<T>::encoding_type() const {
+  return EncodingType::FrontCodedDictionary;
+}
+
+template <typename T>
+ValueID FrontCodedDictionarySegment<T>::lower_bound(const AllTypeVariant& value) const {
+  DebugAssert(!variant_is_null(value), "Null value passed.");
+
+  const auto& typed_value = boost::get<pmr_string>(value);
+
+  const auto position = _dictionary->lower_bound(typed_value);
+  if (position == _dictionary->size()) return INVALID_VALUE_ID;
+  return ValueID{static_cast<ValueID::base_type>(position)};
+}
+
+template <typename T>
+ValueID FrontCodedDictionarySegment<T>::upper_bound(const AllTypeVariant& value) const {
+  DebugAssert(!variant_is_null(value), "Null value passed.");
+
+  const auto& typed_value = boost::get<pmr_string>(value);
+
+  const auto position = _dictionary->upper_bound(typed_value);
+  if (position == _dictionary->size()) return INVALID_VALUE_ID;
+  return ValueID{static_cast<ValueID::base_type>(position)};
+}
+
+template <typename T>
+AllTypeVariant FrontCodedDictionarySegment<T>::value_of_value_id(const ValueID value_id) const {
+  DebugAssert(value_id < _dictionary->size(), "ValueID out of bounds");
+  return _dictionary->get_string_at(value_id);
+}
+
+template <typename T>
+ValueID::base_type FrontCodedDictionarySegment<T>::unique_values_count() const {
+  return static_cast<ValueID::base_type>(_dictionary->size());
+}
+
+template <typename T>
+std::shared_ptr<const BaseCompressedVector> FrontCodedDictionarySegment<T>::attribute_vector() const {
+  return _attribute_vector;
+}
+
+template <typename T>
+ValueID FrontCodedDictionarySegment<T>::null_value_id() const {
+  return ValueID{static_cast<ValueID::base_type>(_dictionary->size())};
+}
+
+template class FrontCodedDictionarySegment<pmr_string>;
+
+}  // namespace opossum
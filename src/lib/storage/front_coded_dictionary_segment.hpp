@@ -0,0 +1,81 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "base_dictionary_segment.hpp"
+#include "front_coded_dictionary_segment/front_coded_string_vector.hpp"
+#include "types.hpp"
+#include "vector_compression/base_compressed_vector.hpp"
+
+namespace opossum {
+
+class BaseCompressedVector;
+
+/**
+ * @brief Segment implementing dictionary encoding for strings with a front-coded dictionary
+ *
+ * Contrary to DictionarySegment<pmr_string>, the sorted dictionary is not stored as a vector of individually
+ * allocated strings but in a single contiguous, front-coded buffer (see FrontCodedStringVector). This reduces the
+ * memory footprint of dictionaries with long or similar strings (e.g., URLs or keys with a common prefix) at the
+ * cost of decoding a few dictionary entries per access.
+ * Uses vector compression schemes for its attribute vector.
+ */
+template <typename T>
+class FrontCodedDictionarySegment : public BaseDictionarySegment {
+ public:
+  explicit FrontCodedDictionarySegment(const std::shared_ptr<const FrontCodedStringVector>& dictionary,
+                                       const std::shared_ptr<const BaseCompressedVector>& attribute_vector);
+
+  // returns an underlying dictionary
+  std::shared_ptr<const FrontCodedStringVector> front_coded_dictionary() const;
+
+  /**
+   * @defgroup BaseSegment interface
+   * @{
+   */
+
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
+
+  std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const;
+
+  ChunkOffset size() const final;
+
+  std::shared_ptr<BaseSegment> copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const final;
+
+  size_t memory_usage(const MemoryUsageCalculationMode = MemoryUsageCalculationMode::Full) const final;
+  /**@}*/
+
+  /**
+   * @defgroup BaseEncodedSegment interface
+   * @{
+   */
+  std::optional<CompressedVectorType> compressed_vector_type() const final;
+  /**@}*/
+
+  /**
+   * @defgroup BaseDictionarySegment interface
+   * @{
+   */
+  EncodingType encoding_type() const final;
+
+  ValueID lower_bound(const AllTypeVariant& value) const final;
+  ValueID upper_bound(const AllTypeVariant& value) const final;
+
+  AllTypeVariant value_of_value_id(const ValueID value_id) const final;
+
+  ValueID::base_type unique_values_count() const final;
+
+  std::shared_ptr<const BaseCompressedVector> attribute_vector() const final;
+
+  ValueID null_value_id() const final;
+
+  /**@}*/
+
+ protected:
+  const std::shared_ptr<const FrontCodedStringVector> _dictionary;
+  const std::shared_ptr<const BaseCompressedVector> _attribute_vector;
+  const std::unique_ptr<BaseVectorDecompressor> _decompressor;
+};
+
+}  // namespace opossum
@@ -0,0 +1,172 @@
+#include "front_coded_string_vector.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <string_view>
+#include <utility>
+
+namespace opossum {
+
+namespace {
+
+void append_length(pmr_vector<char>& data, size_t length) {
+  while (length >= 0x80) {
+    data.push_back(static_cast<char>((length & 0x7F) | 0x80));
+    length >>= 7;
+  }
+  data.push_back(static_cast<char>(length));
+}
+
+size_t read_length(const pmr_vector<char>& data, size_t& offset) {
+  auto length = size_t{0};
+  auto shift = size_t{0};
+  while (true) {
+    const auto byte = static_cast<uint8_t>(data[offset]);
+    ++offset;
+    length |= static_cast<size_t>(byte & 0x7F) << shift;
+    if (!(byte & 0x80)) return length;
+    shift += 7;
+  }
+}
+
+}  // namespace
+
+const pmr_string FrontCodedStringIterator::dereference() const {
+  const auto block_size = FrontCodedStringVector::BLOCK_SIZE;
+
+  if (_decoded_pos == _pos) return _decoded_value;
+
+  // If the previously decoded string is the predecessor of the requested one and both are in the same block, we only
+  // need to decode a single entry. Otherwise, we start decoding at the block head.
+  if (_decoded_pos + 1 != _pos || _pos % block_size == 0) {
+    const auto block_id = _pos / block_size;
+    _next_entry_offset = _vector->_decode_entry(_vector->_block_offsets[block_id], true, _decoded_value);
+    _decoded_pos = block_id * block_size;
+  }
+
+  while (_decoded_pos < _pos) {
+    _next_entry_offset = _vector->_decode_entry(_next_entry_offset, false, _decoded_value);
+    ++_decoded_pos;
+  }
+
+  return _decoded_value;
+}
+
+FrontCodedStringVector::FrontCodedStringVector(pmr_vector<char>&& data, pmr_vector<uint32_t>&& block_offsets,
+                                               const size_t size)
+    : _data{std::move(data)}, _block_offsets{std::move(block_offsets)}, _size{size} {
+  Assert(_block_offsets.size() == (_size + BLOCK_SIZE - 1) / BLOCK_SIZE, "Block offsets do not match size.");
+}
+
+FrontCodedStringVector::FrontCodedStringVector(const FrontCodedStringVector& other,
+                                               const PolymorphicAllocator<char>& allocator)
+    : _data{other._data, allocator}, _block_offsets{other._block_offsets, allocator}, _size{other._size} {}
+
+pmr_string FrontCodedStringVector::get_string_at(const size_t pos) const {
+  DebugAssert(pos < _size, "Position out of bounds.");
+
+  auto value = pmr_string{};
+  const auto block_id = pos / BLOCK_SIZE;
+  auto offset = _decode_entry(_block_offsets[block_id], true, value);
+  for (auto entry_id = block_id * BLOCK_SIZE; entry_id < pos; ++entry_id) {
+    offset = _decode_entry(offset, false, value);
+  }
+
+  return value;
+}
+
+size_t FrontCodedStringVector::lower_bound(const std::string_view value) const {
+  return _bound(value, [](const std::string_view lhs, const std::string_view rhs) { return lhs < rhs; });
+}
+
+size_t FrontCodedStringVector::upper_bound(const std::string_view value) const {
+  return _bound(value, [](const std::string_view lhs, const std::string_view rhs) { return !(rhs < lhs); });
+}
+
+FrontCodedStringIterator FrontCodedStringVector::begin() const noexcept { return cbegin(); }
+
+FrontCodedStringIterator FrontCodedStringVector::end() const noexcept { return cend(); }
+
+FrontCodedStringIterator FrontCodedStringVector::cbegin() const noexcept { return FrontCodedStringIterator{this, 0}; }
+
+FrontCodedStringIterator FrontCodedStringVector::cend() const noexcept { return FrontCodedStringIterator{this, _size}; }
+
+size_t FrontCodedStringVector::size() const { return _size; }
+
+const pmr_vector<char>& FrontCodedStringVector::data() const { return _data; }
+
+const pmr_vector<uint32_t>& FrontCodedStringVector::block_offsets() const { return _block_offsets; }
+
+size_t FrontCodedStringVector::data_size() const {
+  return sizeof(*this) + _data.capacity() + _block_offsets.capacity() * sizeof(uint32_t);
+}
+
+void FrontCodedStringVector::_append(const std::string_view value, const std::string_view previous_value) {
+  if (_size % BLOCK_SIZE == 0) {
+    Assert(_data.size() <= std::numeric_limits<uint32_t>::max(), "FrontCodedStringVector exceeds maximum size.");
+    _block_offsets.push_back(static_cast<uint32_t>(_data.size()));
+    append_length(_data, value.size());
+    _data.insert(_data.end(), value.begin(), value.end());
+  } else {
+    const auto max_prefix_length = std::min(value.size(), previous_value.size());
+    const auto prefix_length = static_cast<size_t>(
+        std::mismatch(value.begin(), value.begin() + max_prefix_length, previous_value.begin()).first - value.begin());
+    append_length(_data, prefix_length);
+    append_length(_data, value.size() - prefix_length);
+    _data.insert(_data.end(), value.begin() + prefix_length, value.end());
+  }
+  ++_size;
+}
+
+std::string_view FrontCodedStringVector::_block_head(const size_t block_id) const {
+  auto offset = size_t{_block_offsets[block_id]};
+  const auto length = read_length(_data, offset);
+  return std::string_view{_data.data() + offset, length};
+}
+
+size_t FrontCodedStringVector::_decode_entry(const size_t entry_offset, const bool is_block_head,
+                                             pmr_string& value) const {
+  auto offset = entry_offset;
+  const auto prefix_length = is_block_head ? size_t{0} : read_length(_data, offset);
+  const auto suffix_length = read_length(_data, offset);
+
+  DebugAssert(prefix_length <= value.size(), "Invalid shared prefix length.");
+  value.resize(prefix_length);
+  value.append(_data.data() + offset, suffix_length);
+
+  return offset + suffix_length;
+}
+
+template <typename Predicate>
+size_t FrontCodedStringVector::_bound(const std::string_view value, const Predicate& predicate) const {
+  // Find the first block whose head does not satisfy the predicate. The result is either this block head or one of
+  // the entries of the preceding block.
+  auto first_block = size_t{0};
+  auto block_count = _block_offsets.size();
+  while (block_count > 0) {
+    const auto step = block_count / 2;
+    const auto block_id = first_block + step;
+    if (predicate(_block_head(block_id), value)) {
+      first_block = block_id + 1;
+      block_count -= step + 1;
+    } else {
+      block_count = step;
+    }
+  }
+
+  if (first_block == 0) return 0;
+
+  const auto block_begin = (first_block - 1) * BLOCK_SIZE;
+  const auto block_end = std::min(first_block * BLOCK_SIZE, _size);
+
+  auto decoded_value = pmr_string{};
+  auto offset = _decode_entry(_block_offsets[first_block - 1], true, decoded_value);
+  for (auto pos = block_begin + 1; pos < block_end; ++pos) {
+    offset = _decode_entry(offset, false, decoded_value);
+    if (!predicate(decoded_value, value)) return pos;
+  }
+
+  return block_end;
+}
+
+}  // namespace opossum
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <limits>
+#include <string_view>
+#include <utility>
+
+#include <boost/iterator/iterator_facade.hpp>
+
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+class FrontCodedStringVector;
+
+// Random access iterator over a FrontCodedStringVector. When iterating sequentially, the next string is derived from
+// the previously decoded one so that each step only needs to decode a single entry.
+class FrontCodedStringIterator
+    : public boost::iterator_facade<FrontCodedStringIterator, const pmr_string, std::random_access_iterator_tag,
+                                    const pmr_string> {
+ public:
+  FrontCodedStringIterator(const FrontCodedStringVector* vector, size_t pos) : _vector{vector}, _pos{pos} {}
+
+ private:
+  friend class boost::iterator_core_access;
+
+  bool equal(const FrontCodedStringIterator& other) const {  // NOLINT
+    return _vector == other._vector && _pos == other._pos;
+  }
+
+  std::ptrdiff_t distance_to(const FrontCodedStringIterator& other) const {  // NOLINT
+    return static_cast<std::ptrdiff_t>(other._pos) - static_cast<std::ptrdiff_t>(_pos);
+  }
+
+  void advance(std::ptrdiff_t n) { _pos += n; }  // NOLINT
+
+  void increment() { ++_pos; }  // NOLINT
+
+  void decrement() { --_pos; }  // NOLINT
+
+  const pmr_string dereference() const;  // NOLINT
+
+  const FrontCodedStringVector* _vector;
+  size_t _pos;
+
+  // Cache of the most recently decoded string, its position and the byte offset of the following entry
+  mutable pmr_string _decoded_value;
+  mutable size_t _decoded_pos = std::numeric_limits<size_t>::max();
+  mutable size_t _next_entry_offset = 0;
+};
+
+/**
+ * FrontCodedStringVector stores a sorted sequence of strings in a single contiguous buffer using front coding.
+ *
+ * The strings are split into blocks of BLOCK_SIZE entries. The first string of each block (the block head) is stored
+ * completely. All other strings only store the length of the prefix they share with their predecessor and the
+ * remaining suffix. As sorted strings (e.g., dictionaries) usually share long prefixes with their neighbors, this
+ * saves a lot of memory compared to a vector of pmr_strings, which also needs a separate allocation for every string
+ * that does not fit into the small string buffer.
+ *
+ * Lengths are stored as variable-length integers (seven bits per byte). The byte offsets of the block heads are
+ * stored in a sparse index. Accessing a string decodes at most BLOCK_SIZE entries. lower_bound and upper_bound first
+ * binary search the block heads (without copying them) and then scan a single block.
+ *
+ * Layout of an entry:  block head:   | length | chars... |
+ *                      other entry:  | shared prefix length | suffix length | suffix chars... |
+ */
+class FrontCodedStringVector {
+ public:
+  static constexpr auto BLOCK_SIZE = size_t{16};
+
+  // Create a FrontCodedStringVector from a sorted range of strings
+  template <typename Iter>
+  FrontCodedStringVector(Iter first, Iter last, const PolymorphicAllocator<char>& allocator = {})
+      : _data{allocator}, _block_offsets{allocator} {
+    auto previous_value = std::string_view{};
+    for (; first != last; ++first) {
+      const auto value = std::string_view{*first};
+      DebugAssert(_size == 0 || previous_value <= value, "FrontCodedStringVector expects sorted input.");
+      _append(value, previous_value);
+      previous_value = value;
+    }
+    _data.shrink_to_fit();
+    _block_offsets.shrink_to_fit();
+  }
+
+  // Create a FrontCodedStringVector from existing (already encoded) data
+  FrontCodedStringVector(pmr_vector<char>&& data, pmr_vector<uint32_t>&& block_offsets, const size_t size);
+
+  FrontCodedStringVector(const FrontCodedStringVector& other, const PolymorphicAllocator<char>& allocator = {});
+
+  // Return the (decoded) string at a certain position
+  pmr_string get_string_at(const size_t pos) const;
+
+  // Return the position of the first string that is not less than (lower_bound) or greater than (upper_bound) value,
+  // or size() if there is no such string.
+  size_t lower_bound(const std::string_view value) const;
+  size_t upper_bound(const std::string_view value) const;
+
+  FrontCodedStringIterator begin() const noexcept;
+  FrontCodedStringIterator end() const noexcept;
+  FrontCodedStringIterator cbegin() const noexcept;
+  FrontCodedStringIterator cend() const noexcept;
+
+  // Return the number of strings in the vector
+  size_t size() const;
+
+  // Return the encoded strings and the offsets of the block heads
+  const pmr_vector<char>& data() const;
+  const pmr_vector<uint32_t>& block_offsets() const;
+
+  // Return the calculated size of FrontCodedStringVector in main memory
+  size_t data_size() const;
+
+ protected:
+  friend class FrontCodedStringIterator;
+
+  void _append(const std::string_view value, const std::string_view previous_value);
+
+  // Return the string stored as the head of the given block without copying it
+  std::string_view _block_head(const size_t block_id) const;
+
+  // Decode the entry at the given byte offset on top of the previous string (ignored for block heads). Return the
+  // byte offset of the following entry.
+  size_t _decode_entry(const size_t entry_offset, const bool is_block_head, pmr_string& value) const;
+
+  // Return the position of the first string for which the predicate (applied as predicate(string, value)) is false
+  template <typename Predicate>
+  size_t _bound(const std::string_view value, const Predicate& predicate) const;
+
+  pmr_vector<char> _data;
+  pmr_vector<uint32_t> _block_offsets;
+  size_t _size = 0;
+};
+
+}  // namespace opossum
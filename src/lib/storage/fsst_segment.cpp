@@ -0,0 +1,123 @@
+#include "fsst_segment.hpp"
+
+#include <climits>
+#include <memory>
+#include <string>
+
+#include "resolve_type.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
+#include "storage/vector_compression/base_vector_decompressor.hpp"
+#include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace opossum {
+
+template <typename T>
+FSSTSegment<T>::FSSTSegment(pmr_vector<uint8_t>&& compressed_values,
+                            std::unique_ptr<const BaseCompressedVector>&& offsets,
+                            std::optional<pmr_vector<bool>>&& null_values, FSSTSymbolTable&& symbol_table)
+    : BaseEncodedSegment{data_type_from_type<pmr_string>()},
+      _compressed_values{std::move(compressed_values)},
+      _offsets{std::move(offsets)},
+      _null_values{std::move(null_values)},
+      _symbol_table{std::move(symbol_table)},
+      _offset_decompressor{_offsets->create_base_decompressor()} {
+  Assert(_offsets->size() > 0, "FSSTSegment expects one more offset than rows.");
+  DebugAssert(!_null_values || _null_values->size() + 1 == _offsets->size(), "Null values and offsets do not match.");
+}
+
+template <typename T>
+const pmr_vector<uint8_t>& FSSTSegment<T>::compressed_values() const {
+  return _compressed_values;
+}
+
+template <typename T>
+const BaseCompressedVector& FSSTSegment<T>::offsets() const {
+  return *_offsets;
+}
+
+template <typename T>
+const std::optional<pmr_vector<bool>>& FSSTSegment<T>::null_values() const {
+  return _null_values;
+}
+
+template <typename T>
+const FSSTSymbolTable& FSSTSegment<T>::symbol_table() const {
+  return _symbol_table;
+}
+
+template <typename T>
+pmr_vector<uint8_t> FSSTSegment<T>::compress_value(const std::string_view value) const {
+  auto codes = pmr_vector<uint8_t>{};
+  codes.reserve(value.size());
+  _symbol_table.compress(value, codes);
+  return codes;
+}
+
+template <typename T>
+AllTypeVariant FSSTSegment<T>::operator[](const ChunkOffset chunk_offset) const {
+  PerformanceWarning("operator[] used");
+  DebugAssert(chunk_offset < size(), "Passed chunk offset must be valid.");
+
+  const auto typed_value = get_typed_value(chunk_offset);
+  if (!typed_value) {
+    return NULL_VALUE;
+  }
+  return *typed_value;
+}
+
+template <typename T>
+std::optional<T> FSSTSegment<T>::get_typed_value(const ChunkOffset chunk_offset) const {
+  DebugAssert(chunk_offset < size(), "ChunkOffset out of bounds.");
+
+  if (_null_values && (*_null_values)[chunk_offset]) {
+    return std::nullopt;
+  }
+
+  const auto begin = _offset_decompressor->get(chunk_offset);
+  const auto end = _offset_decompressor->get(chunk_offset + 1);
+  return _symbol_table.decompress(_compressed_values.data() + begin, _compressed_values.data() + end);
+}
+
+template <typename T>
+ChunkOffset FSSTSegment<T>::size() const {
+  return static_cast<ChunkOffset>(_offsets->size() - 1);
+}
+
+template <typename T>
+std::shared_ptr<BaseSegment> FSSTSegment<T>::copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const {
+  auto new_compressed_values = pmr_vector<uint8_t>{_compressed_values, alloc};
+  auto new_offsets = _offsets->copy_using_allocator(alloc);
+  auto new_null_values =
+      _null_values ? std::optional<pmr_vector<bool>>{pmr_vector<bool>{*_null_values, alloc}} : std::nullopt;
+  auto new_symbol_table = FSSTSymbolTable{_symbol_table, alloc};
+
+  auto copy = std::make_shared<FSSTSegment<T>>(std::move(new_compressed_values), std::move(new_offsets),
+                                               std::move(new_null_values), std::move(new_symbol_table));
+
+  copy->access_counter = access_counter;
+
+  return copy;
+}
+
+template <typename T>
+size_t FSSTSegment<T>::memory_usage(const MemoryUsageCalculationMode) const {
+  // MemoryUsageCalculationMode ignored as full calculation is efficient.
+  const auto null_values_size = _null_values ? _null_values->capacity() / CHAR_BIT : size_t{0};
+  return sizeof(*this) + _compressed_values.capacity() + _offsets->data_size() + null_values_size +
+         _symbol_table.data_size();
+}
+
+template <typename T>
+EncodingType FSSTSegment<T>::encoding_type() const {
+  return EncodingType::FSST;
+}
+
+template <typename T>
+std::optional<CompressedVectorType> FSSTSegment<T>::compressed_vector_type() const {
+  return _offsets->type();
+}
+
+template class FSSTSegment<pmr_string>;
+
+}  // namespace opossum
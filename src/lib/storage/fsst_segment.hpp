@@ -0,0 +1,84 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string_view>
+
+#include "base_encoded_segment.hpp"
+#include "fsst_segment/fsst_symbol_table.hpp"
+#include "types.hpp"
+#include "vector_compression/base_compressed_vector.hpp"
+
+namespace opossum {
+
+class BaseCompressedVector;
+class BaseVectorDecompressor;
+
+/**
+ * @brief Segment implementing FSST (Fast Static Symbol Table) compression for strings
+ *
+ * All values are compressed with a per-segment symbol table (see FSSTSymbolTable) and stored back to back in a single
+ * byte vector. Contrary to LZ4, each value can be decompressed individually without touching any other value, which
+ * makes point accesses cheap. Contrary to dictionary encoding, no dictionary of all distinct values is needed, which
+ * makes FSST a good fit for string columns with a high number of distinct values (e.g., URLs or comments).
+ *
+ * Equality predicates can be evaluated on the compressed data by compressing the search value with the same symbol
+ * table and comparing the codes. Prefix predicates (LIKE 'abc%') only decode the codes needed to cover the prefix.
+ *
+ * The offsets into the compressed values are stored in a compressed vector. It has one entry more than the segment
+ * has rows, so that the (exclusive) end of value i is stored at position i + 1. NULL values are stored as empty code
+ * sequences and are marked in the optional null value vector.
+ */
+template <typename T>
+class FSSTSegment : public BaseEncodedSegment {
+ public:
+  explicit FSSTSegment(pmr_vector<uint8_t>&& compressed_values, std::unique_ptr<const BaseCompressedVector>&& offsets,
+                       std::optional<pmr_vector<bool>>&& null_values, FSSTSymbolTable&& symbol_table);
+
+  const pmr_vector<uint8_t>& compressed_values() const;
+  const BaseCompressedVector& offsets() const;
+  const std::optional<pmr_vector<bool>>& null_values() const;
+  const FSSTSymbolTable& symbol_table() const;
+
+  /**
+   * Compresses the given value with this segment's symbol table. As the compression is deterministic, two values are
+   * equal iff their codes are equal. Thus, the result can be compared with the codes of the stored values.
+   */
+  pmr_vector<uint8_t> compress_value(const std::string_view value) const;
+
+  /**
+   * @defgroup BaseSegment interface
+   * @{
+   */
+
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
+
+  std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const;
+
+  ChunkOffset size() const final;
+
+  std::shared_ptr<BaseSegment> copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const final;
+
+  size_t memory_usage(const MemoryUsageCalculationMode mode) const final;
+
+  /**@}*/
+
+  /**
+   * @defgroup BaseEncodedSegment interface
+   * @{
+   */
+
+  EncodingType encoding_type() const final;
+  std::optional<CompressedVectorType> compressed_vector_type() const final;
+
+  /**@}*/
+
+ protected:
+  const pmr_vector<uint8_t> _compressed_values;
+  const std::unique_ptr<const BaseCompressedVector> _offsets;
+  const std::optional<pmr_vector<bool>> _null_values;
+  const FSSTSymbolTable _symbol_table;
+  const std::unique_ptr<BaseVectorDecompressor> _offset_decompressor;
+};
+
+}  // namespace opossum
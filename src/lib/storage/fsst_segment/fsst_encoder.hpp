@@ -0,0 +1,113 @@
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+#include "storage/base_segment_encoder.hpp"
+#include "storage/fsst_segment.hpp"
+#include "storage/fsst_segment/fsst_symbol_table.hpp"
+#include "storage/vector_compression/vector_compression.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "utils/enum_constant.hpp"
+
+namespace opossum {
+
+/**
+ * Encodes a string segment using FSST. First, a symbol table is built from a sample of the segment's values. Then,
+ * every value is compressed with this table and appended to a single byte vector. The offsets into this vector are
+ * compressed using the configured vector compression.
+ */
+class FSSTEncoder : public SegmentEncoder<FSSTEncoder> {
+ public:
+  static constexpr auto _encoding_type = enum_c<EncodingType, EncodingType::FSST>;
+  static constexpr auto _uses_vector_compression = true;
+
+  /**
+   * The symbol table is built from a sample of at most this many bytes. The FSST paper uses 16 KB, which is enough to
+   * find the frequent symbols while keeping the build time low.
+   */
+  static constexpr auto _sample_size = size_t{16384u};
+
+  std::shared_ptr<BaseEncodedSegment> _on_encode(const AnySegmentIterable<pmr_string> segment_iterable,
+                                                 const PolymorphicAllocator<pmr_string>& allocator) {
+    auto values = std::vector<pmr_string>{};
+    auto null_values = pmr_vector<bool>{allocator};
+
+    /**
+     * If the null value vector only contains the value false, then the value segment does not have any row value that
+     * is null. In that case, we don't store the null value vector to reduce the segment's memory footprint.
+     */
+    auto segment_contains_null = false;
+    auto total_length = size_t{0};
+
+    segment_iterable.with_iterators([&](auto it, auto end) {
+      const auto segment_size = static_cast<size_t>(std::distance(it, end));
+      values.resize(segment_size);
+      null_values.resize(segment_size);
+
+      for (auto row_index = size_t{0}; it != end; ++it, ++row_index) {
+        const auto segment_value = *it;
+        const auto contains_null = segment_value.is_null();
+        null_values[row_index] = contains_null;
+        segment_contains_null = segment_contains_null || contains_null;
+        if (!contains_null) {
+          values[row_index] = segment_value.value();
+          total_length += values[row_index].size();
+        }
+      }
+    });
+
+    auto symbol_table = FSSTSymbolTable::build(_sample(values, null_values, total_length), allocator);
+
+    auto compressed_values = pmr_vector<uint8_t>{allocator};
+    compressed_values.reserve(total_length);
+
+    auto offsets = pmr_vector<uint32_t>(values.size() + 1, allocator);
+    for (auto row_index = size_t{0}; row_index < values.size(); ++row_index) {
+      offsets[row_index] = static_cast<uint32_t>(compressed_values.size());
+      if (!null_values[row_index]) {
+        symbol_table.compress(values[row_index], compressed_values);
+      }
+      Assert(compressed_values.size() <= std::numeric_limits<uint32_t>::max(),
+             "Size of compressed values exceeds the maximum of uint32 in FSST encoding.");
+    }
+    offsets.back() = static_cast<uint32_t>(compressed_values.size());
+    compressed_values.shrink_to_fit();
+
+    auto compressed_offsets = compress_vector(offsets, vector_compression_type(), allocator, {offsets.back()});
+
+    auto optional_null_values = segment_contains_null ? std::optional<pmr_vector<bool>>{std::move(null_values)}
+                                                      : std::nullopt;
+
+    return std::make_shared<FSSTSegment<pmr_string>>(std::move(compressed_values), std::move(compressed_offsets),
+                                                     std::move(optional_null_values), std::move(symbol_table));
+  }
+
+ private:
+  /**
+   * Picks values evenly spread across the segment until the sample size is reached. Taking values from the whole
+   * segment (instead of only its beginning) avoids a biased symbol table for sorted or clustered segments.
+   */
+  static std::vector<std::string_view> _sample(const std::vector<pmr_string>& values,
+                                               const pmr_vector<bool>& null_values, const size_t total_length) {
+    auto samples = std::vector<std::string_view>{};
+    if (values.empty() || total_length == 0) return samples;
+
+    const auto stride = std::max(size_t{1}, total_length / _sample_size);
+    auto sampled_length = size_t{0};
+    for (auto row_index = size_t{0}; row_index < values.size() && sampled_length < _sample_size;
+         row_index += stride) {
+      if (null_values[row_index]) continue;
+      samples.emplace_back(values[row_index]);
+      sampled_length += values[row_index].size();
+    }
+
+    return samples;
+  }
+};
+
+}  // namespace opossum
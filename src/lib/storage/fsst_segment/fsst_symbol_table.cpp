@@ -0,0 +1,221 @@
+#include "fsst_symbol_table.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Number of rounds in which the symbol table is refined. The FSST paper reports that five rounds suffice.
+constexpr auto BUILD_ROUND_COUNT = size_t{5};
+
+}  // namespace
+
+FSSTSymbolTable::FSSTSymbolTable(const PolymorphicAllocator<char>& allocator)
+    : _symbols{allocator}, _symbol_lengths{allocator}, _codes_by_first_byte{allocator} {
+  _build_lookup();
+}
+
+FSSTSymbolTable::FSSTSymbolTable(pmr_vector<char>&& symbols, pmr_vector<uint8_t>&& symbol_lengths)
+    : _symbols{std::move(symbols)},
+      _symbol_lengths{std::move(symbol_lengths)},
+      _codes_by_first_byte{_symbols.get_allocator()} {
+  Assert(_symbol_lengths.size() <= MAX_SYMBOL_COUNT, "Too many symbols for FSST symbol table.");
+  Assert(_symbols.size() == _symbol_lengths.size() * MAX_SYMBOL_LENGTH, "Symbols and symbol lengths do not match.");
+  _build_lookup();
+}
+
+FSSTSymbolTable::FSSTSymbolTable(const FSSTSymbolTable& other, const PolymorphicAllocator<char>& allocator)
+    : _symbols{other._symbols, allocator},
+      _symbol_lengths{other._symbol_lengths, allocator},
+      _codes_by_first_byte{other._codes_by_first_byte, allocator},
+      _codes_by_first_byte_offsets{other._codes_by_first_byte_offsets} {}
+
+FSSTSymbolTable FSSTSymbolTable::build(const std::vector<std::string_view>& samples,
+                                       const PolymorphicAllocator<char>& allocator) {
+  auto symbol_table = FSSTSymbolTable{allocator};
+
+  for (auto round = size_t{0}; round < BUILD_ROUND_COUNT; ++round) {
+    // Count how often each symbol of the current table and each pair of consecutive symbols occurs when compressing
+    // the sample. Escaped bytes are counted as single-byte candidate symbols.
+    auto candidate_counts = std::unordered_map<std::string, size_t>{};
+    auto codes = pmr_vector<uint8_t>{};
+
+    for (const auto& sample : samples) {
+      auto position = size_t{0};
+      auto previous_symbol = std::string_view{};
+
+      while (position < sample.size()) {
+        auto symbol_length = size_t{1};
+
+        const auto first_byte = static_cast<uint8_t>(sample[position]);
+        const auto remaining_length = sample.size() - position;
+        for (auto index = symbol_table._codes_by_first_byte_offsets[first_byte];
+             index < symbol_table._codes_by_first_byte_offsets[first_byte + 1]; ++index) {
+          const auto code = symbol_table._codes_by_first_byte[index];
+          const auto length = size_t{symbol_table._symbol_lengths[code]};
+          if (length <= remaining_length &&
+              std::memcmp(&symbol_table._symbols[code * MAX_SYMBOL_LENGTH], &sample[position], length) == 0) {
+            symbol_length = length;
+            break;
+          }
+        }
+
+        const auto symbol = sample.substr(position, symbol_length);
+        ++candidate_counts[std::string{symbol}];
+
+        if (!previous_symbol.empty() && previous_symbol.size() + symbol.size() <= MAX_SYMBOL_LENGTH) {
+          auto concatenation = std::string{previous_symbol};
+          concatenation += symbol;
+          ++candidate_counts[concatenation];
+        }
+
+        previous_symbol = symbol;
+        position += symbol_length;
+      }
+    }
+
+    // Pick the candidates with the highest gain. Ties are broken by the symbol itself so that the result is
+    // deterministic.
+    auto candidates = std::vector<std::pair<size_t, std::string>>{};
+    candidates.reserve(candidate_counts.size());
+    for (auto& [symbol, count] : candidate_counts) {
+      candidates.emplace_back(count * symbol.size(), symbol);
+    }
+
+    const auto selected_count = std::min(candidates.size(), MAX_SYMBOL_COUNT);
+    std::partial_sort(candidates.begin(), candidates.begin() + selected_count, candidates.end(),
+                      [](const auto& lhs, const auto& rhs) {
+                        return lhs.first > rhs.first || (lhs.first == rhs.first && lhs.second < rhs.second);
+                      });
+
+    auto symbols = pmr_vector<char>(selected_count * MAX_SYMBOL_LENGTH, '\0', allocator);
+    auto symbol_lengths = pmr_vector<uint8_t>(selected_count, uint8_t{0}, allocator);
+    for (auto code = size_t{0}; code < selected_count; ++code) {
+      const auto& symbol = candidates[code].second;
+      std::memcpy(&symbols[code * MAX_SYMBOL_LENGTH], symbol.data(), symbol.size());
+      symbol_lengths[code] = static_cast<uint8_t>(symbol.size());
+    }
+
+    symbol_table = FSSTSymbolTable{std::move(symbols), std::move(symbol_lengths)};
+  }
+
+  return symbol_table;
+}
+
+void FSSTSymbolTable::compress(const std::string_view value, pmr_vector<uint8_t>& codes) const {
+  auto position = size_t{0};
+  const auto value_length = value.size();
+
+  while (position < value_length) {
+    const auto first_byte = static_cast<uint8_t>(value[position]);
+    const auto remaining_length = value_length - position;
+
+    auto matched = false;
+    for (auto index = _codes_by_first_byte_offsets[first_byte]; index < _codes_by_first_byte_offsets[first_byte + 1];
+         ++index) {
+      const auto code = _codes_by_first_byte[index];
+      const auto length = size_t{_symbol_lengths[code]};
+      if (length <= remaining_length &&
+          std::memcmp(&_symbols[code * MAX_SYMBOL_LENGTH], &value[position], length) == 0) {
+        codes.push_back(code);
+        position += length;
+        matched = true;
+        break;
+      }
+    }
+
+    if (!matched) {
+      codes.push_back(ESCAPE_CODE);
+      codes.push_back(first_byte);
+      ++position;
+    }
+  }
+}
+
+pmr_string FSSTSymbolTable::decompress(const uint8_t* begin, const uint8_t* end) const {
+  // Each code expands to at most MAX_SYMBOL_LENGTH bytes. We always copy full symbols (including the padding) and
+  // only advance by the actual symbol length, which avoids a branch per symbol. The string is shrunk afterwards.
+  auto value = pmr_string(static_cast<size_t>(end - begin) * MAX_SYMBOL_LENGTH, '\0');
+  auto* output = value.data();
+
+  for (auto code_it = begin; code_it < end; ++code_it) {
+    const auto code = *code_it;
+    if (code == ESCAPE_CODE) {
+      ++code_it;
+      *output = static_cast<char>(*code_it);
+      ++output;
+    } else {
+      std::memcpy(output, &_symbols[code * MAX_SYMBOL_LENGTH], MAX_SYMBOL_LENGTH);
+      output += _symbol_lengths[code];
+    }
+  }
+
+  value.resize(static_cast<size_t>(output - value.data()));
+  return value;
+}
+
+bool FSSTSymbolTable::starts_with(const uint8_t* begin, const uint8_t* end, const std::string_view prefix) const {
+  auto prefix_position = size_t{0};
+  const auto prefix_length = prefix.size();
+
+  for (auto code_it = begin; code_it < end && prefix_position < prefix_length; ++code_it) {
+    const auto code = *code_it;
+    if (code == ESCAPE_CODE) {
+      ++code_it;
+      if (static_cast<char>(*code_it) != prefix[prefix_position]) return false;
+      ++prefix_position;
+    } else {
+      const auto compared_length = std::min(size_t{_symbol_lengths[code]}, prefix_length - prefix_position);
+      if (std::memcmp(&_symbols[code * MAX_SYMBOL_LENGTH], &prefix[prefix_position], compared_length) != 0) {
+        return false;
+      }
+      prefix_position += compared_length;
+    }
+  }
+
+  return prefix_position == prefix_length;
+}
+
+size_t FSSTSymbolTable::symbol_count() const { return _symbol_lengths.size(); }
+
+const pmr_vector<char>& FSSTSymbolTable::symbols() const { return _symbols; }
+
+const pmr_vector<uint8_t>& FSSTSymbolTable::symbol_lengths() const { return _symbol_lengths; }
+
+size_t FSSTSymbolTable::data_size() const {
+  return _symbols.capacity() + _symbol_lengths.capacity() + _codes_by_first_byte.capacity() +
+         sizeof(_codes_by_first_byte_offsets);
+}
+
+void FSSTSymbolTable::_build_lookup() {
+  const auto symbol_count = _symbol_lengths.size();
+
+  _codes_by_first_byte.resize(symbol_count);
+  for (auto code = size_t{0}; code < symbol_count; ++code) {
+    _codes_by_first_byte[code] = static_cast<uint8_t>(code);
+  }
+
+  const auto first_byte = [&](const uint8_t code) { return static_cast<uint8_t>(_symbols[code * MAX_SYMBOL_LENGTH]); };
+  std::sort(_codes_by_first_byte.begin(), _codes_by_first_byte.end(), [&](const uint8_t lhs, const uint8_t rhs) {
+    if (first_byte(lhs) != first_byte(rhs)) return first_byte(lhs) < first_byte(rhs);
+    return _symbol_lengths[lhs] > _symbol_lengths[rhs];
+  });
+
+  _codes_by_first_byte_offsets.fill(0);
+  for (auto code = size_t{0}; code < symbol_count; ++code) {
+    ++_codes_by_first_byte_offsets[first_byte(static_cast<uint8_t>(code)) + 1];
+  }
+  for (auto byte = size_t{1}; byte < _codes_by_first_byte_offsets.size(); ++byte) {
+    _codes_by_first_byte_offsets[byte] += _codes_by_first_byte_offsets[byte - 1];
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * @brief Static symbol table of the Fast Static Symbol Table (FSST) string compression
+ *
+ * FSST replaces frequently occurring substrings of up to eight bytes (symbols) by one-byte codes. Up to 255 symbols
+ * can be stored, the code 255 is reserved as an escape code: the byte following it is a literal byte that is not
+ * covered by any symbol. The symbol table is built once per segment from a sample of its values and is immutable
+ * afterwards.
+ *
+ * As the table is static and values are compressed greedily (always taking the longest matching symbol), equal
+ * strings are always compressed to equal code sequences. This allows comparing a compressed value to a compressed
+ * search value byte-wise without decompressing it. Decompression of a single value only requires a lookup of each code
+ * in the table and is therefore in the order of nanoseconds.
+ *
+ * See Boncz et al., "FSST: Fast Random Access String Compression", VLDB 2020.
+ */
+class FSSTSymbolTable {
+ public:
+  static constexpr auto MAX_SYMBOL_LENGTH = size_t{8};
+  static constexpr auto MAX_SYMBOL_COUNT = size_t{255};
+  static constexpr auto ESCAPE_CODE = uint8_t{255};
+
+  explicit FSSTSymbolTable(const PolymorphicAllocator<char>& allocator = {});
+
+  /**
+   * @param symbols Symbol bytes, MAX_SYMBOL_LENGTH bytes per symbol. Symbols shorter than MAX_SYMBOL_LENGTH are padded
+   *                with zeros.
+   * @param symbol_lengths The length of each symbol (between 1 and MAX_SYMBOL_LENGTH).
+   */
+  FSSTSymbolTable(pmr_vector<char>&& symbols, pmr_vector<uint8_t>&& symbol_lengths);
+
+  FSSTSymbolTable(const FSSTSymbolTable& other, const PolymorphicAllocator<char>& allocator);
+
+  /**
+   * Builds a symbol table for the given sample of values. In each of a small number of rounds, the sample is compressed
+   * with the current table and the symbols (and concatenations of two consecutive symbols) with the highest gain,
+   * i.e., occurrence count times length, are picked for the next table.
+   */
+  static FSSTSymbolTable build(const std::vector<std::string_view>& samples,
+                               const PolymorphicAllocator<char>& allocator = {});
+
+  // Appends the codes of the compressed value to `codes`
+  void compress(const std::string_view value, pmr_vector<uint8_t>& codes) const;
+
+  pmr_string decompress(const uint8_t* begin, const uint8_t* end) const;
+
+  /**
+   * Checks whether the compressed value starts with the given (uncompressed) prefix. Only the codes that are needed to
+   * cover the prefix are decoded.
+   */
+  bool starts_with(const uint8_t* begin, const uint8_t* end, const std::string_view prefix) const;
+
+  size_t symbol_count() const;
+  const pmr_vector<char>& symbols() const;
+  const pmr_vector<uint8_t>& symbol_lengths() const;
+
+  size_t data_size() const;
+
+ private:
+  pmr_vector<char> _symbols;
+  pmr_vector<uint8_t> _symbol_lengths;
+
+  /**
+   * Lookup structure used for compression: All codes sorted by their first byte and, within the same first byte, by
+   * descending symbol length. The codes starting with byte b are found in
+   * [_codes_by_first_byte_offsets[b], _codes_by_first_byte_offsets[b + 1]).
+   */
+  pmr_vector<uint8_t> _codes_by_first_byte;
+  std::array<uint16_t, 257> _codes_by_first_byte_offsets{};
+
+  void _build_lookup();
+};
+
+}  // namespace opossum
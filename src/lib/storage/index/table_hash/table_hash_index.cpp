@@ -0,0 +1,152 @@
+#include "table_hash_index.hpp"
+
+#include <mutex>
+#include <utility>
+
+#include <boost/functional/hash.hpp>
+
+#include "lossless_cast.hpp"
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+#include "storage/segment_iterate.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+size_t TableHashIndex::KeyHash::operator()(const Key& key) const {
+  auto hash = size_t{0};
+  for (const auto& value : key) {
+    boost::hash_combine(hash, std::hash<AllTypeVariant>{}(value));
+  }
+  return hash;
+}
+
+TableHashIndex::TableHashIndex(const std::vector<ColumnID>& column_ids, const std::vector<DataType>& data_types,
+                               const std::string& name)
+    : _column_ids{column_ids}, _data_types{data_types}, _name{name} {
+  Assert(!_column_ids.empty(), "TableHashIndex requires at least one column.");
+  Assert(_column_ids.size() == _data_types.size(), "Expected one data type per column.");
+}
+
+const std::vector<ColumnID>& TableHashIndex::column_ids() const { return _column_ids; }
+
+const std::string& TableHashIndex::name() const { return _name; }
+
+void TableHashIndex::insert_rows(const Chunk& chunk, const ChunkID chunk_id, const ChunkOffset begin_chunk_offset,
+                                 const ChunkOffset end_chunk_offset) {
+  auto keys = materialize_keys(chunk, begin_chunk_offset, end_chunk_offset);
+
+  for (auto chunk_offset = begin_chunk_offset; chunk_offset < end_chunk_offset; ++chunk_offset) {
+    auto& key = keys[chunk_offset - begin_chunk_offset];
+    if (!key) continue;
+
+    const auto hash = KeyHash{}(*key);
+    auto& shard = _shard(hash);
+    const auto lock = std::unique_lock{shard.mutex};
+    shard.entries.emplace(std::move(*key), RowID{chunk_id, chunk_offset});
+  }
+}
+
+void TableHashIndex::remove_rows(const Chunk& chunk, const ChunkID chunk_id, const ChunkOffset begin_chunk_offset,
+                                 const ChunkOffset end_chunk_offset) {
+  const auto keys = materialize_keys(chunk, begin_chunk_offset, end_chunk_offset);
+
+  for (auto chunk_offset = begin_chunk_offset; chunk_offset < end_chunk_offset; ++chunk_offset) {
+    const auto& key = keys[chunk_offset - begin_chunk_offset];
+    if (!key) continue;
+
+    auto& shard = _shard(KeyHash{}(*key));
+    const auto lock = std::unique_lock{shard.mutex};
+    const auto [range_begin, range_end] = shard.entries.equal_range(*key);
+    for (auto iter = range_begin; iter != range_end; ++iter) {
+      if (iter->second == RowID{chunk_id, chunk_offset}) {
+        shard.entries.erase(iter);
+        break;
+      }
+    }
+  }
+}
+
+std::vector<RowID> TableHashIndex::lookup(const std::vector<AllTypeVariant>& values) const {
+  Assert(values.size() == _column_ids.size(), "Expected one value per indexed column.");
+
+  // Bring the values into the representation used by the index (e.g., 5 for a long column is stored as int64_t)
+  auto key = Key{};
+  key.reserve(values.size());
+  for (auto value_index = size_t{0}; value_index < values.size(); ++value_index) {
+    if (variant_is_null(values[value_index])) return {};
+
+    const auto cast_value = lossless_variant_cast(values[value_index], _data_types[value_index]);
+    if (!cast_value) return {};
+    key.emplace_back(*cast_value);
+  }
+
+  const auto& shard = _shard(KeyHash{}(key));
+  const auto lock = std::shared_lock{shard.mutex};
+  const auto [range_begin, range_end] = shard.entries.equal_range(key);
+
+  auto row_ids = std::vector<RowID>{};
+  for (auto iter = range_begin; iter != range_end; ++iter) {
+    row_ids.emplace_back(iter->second);
+  }
+  return row_ids;
+}
+
+size_t TableHashIndex::size() const {
+  auto size = size_t{0};
+  for (const auto& shard : _shards) {
+    const auto lock = std::shared_lock{shard.mutex};
+    size += shard.entries.size();
+  }
+  return size;
+}
+
+size_t TableHashIndex::memory_usage() const {
+  // This is only an estimation, as the memory used by the hash map nodes and non-inlined strings is not known
+  auto memory_usage = sizeof(*this) + _column_ids.capacity() * sizeof(ColumnID);
+  for (const auto& shard : _shards) {
+    const auto lock = std::shared_lock{shard.mutex};
+    memory_usage += shard.entries.bucket_count() * sizeof(void*);
+    memory_usage += shard.entries.size() *
+                    (sizeof(std::pair<const Key, RowID>) + _column_ids.size() * sizeof(AllTypeVariant) + sizeof(void*));
+  }
+  return memory_usage;
+}
+
+std::vector<std::optional<TableHashIndex::Key>> TableHashIndex::materialize_keys(
+    const Chunk& chunk, const ChunkOffset begin_chunk_offset, const ChunkOffset end_chunk_offset) const {
+  DebugAssert(begin_chunk_offset <= end_chunk_offset && end_chunk_offset <= chunk.size(), "Invalid row range.");
+
+  const auto row_count = end_chunk_offset - begin_chunk_offset;
+  auto keys = std::vector<std::optional<Key>>(row_count, Key(_column_ids.size()));
+
+  for (auto key_column_index = size_t{0}; key_column_index < _column_ids.size(); ++key_column_index) {
+    const auto& segment = *chunk.get_segment(_column_ids[key_column_index]);
+
+    resolve_data_type(_data_types[key_column_index], [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      segment_with_iterators<ColumnDataType>(segment, [&](auto segment_begin, const auto /* segment_end */) {
+        auto iter = segment_begin + begin_chunk_offset;
+        for (auto row_index = ChunkOffset{0}; row_index < row_count; ++row_index, ++iter) {
+          auto& key = keys[row_index];
+          if (!key) continue;
+
+          if (iter->is_null()) {
+            key.reset();
+          } else {
+            (*key)[key_column_index] = iter->value();
+          }
+        }
+      });
+    });
+  }
+
+  return keys;
+}
+
+TableHashIndex::Shard& TableHashIndex::_shard(const size_t hash) { return _shards[hash % SHARD_COUNT]; }
+
+const TableHashIndex::Shard& TableHashIndex::_shard(const size_t hash) const { return _shards[hash % SHARD_COUNT]; }
+
+}  // namespace opossum
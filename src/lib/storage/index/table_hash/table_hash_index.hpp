@@ -0,0 +1,86 @@
+#pragma once
+
+#include <array>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+
+/**
+ * The TableHashIndex is a hash index over one or more columns of a data table. In contrast to the chunk indexes (see
+ * AbstractIndex), it spans all chunks of the table, including mutable ones. Thus, a point lookup (e.g., on the primary
+ * key) does not have to visit every chunk.
+ *
+ * The index maps the values of the key columns of a row to its RowID. It is maintained by the Table (when chunks are
+ * appended or removed) and by the Insert operator. Entries are not removed when a row is deleted, as transactions with
+ * an older snapshot might still see that row. They are only removed once the MvccDeletePlugin physically removes the
+ * chunk of the row. As a consequence, a lookup can return RowIDs of rows that are not (or not yet) visible. Callers
+ * have to validate the results, e.g., using the Validate operator. Rows that contain NULL in any of the key columns
+ * are not indexed.
+ *
+ * The entries are partitioned into shards by the hash of their key. Each shard is protected by its own shared_mutex,
+ * so that concurrent inserts and lookups rarely contend with each other.
+ */
+class TableHashIndex : private Noncopyable {
+ public:
+  using Key = std::vector<AllTypeVariant>;
+
+  TableHashIndex(const std::vector<ColumnID>& column_ids, const std::vector<DataType>& data_types,
+                 const std::string& name = "");
+
+  const std::vector<ColumnID>& column_ids() const;
+  const std::string& name() const;
+
+  // Add (or remove) the rows in [begin_chunk_offset, end_chunk_offset) of the chunk with the given ID
+  void insert_rows(const Chunk& chunk, const ChunkID chunk_id, const ChunkOffset begin_chunk_offset,
+                   const ChunkOffset end_chunk_offset);
+  void remove_rows(const Chunk& chunk, const ChunkID chunk_id, const ChunkOffset begin_chunk_offset,
+                   const ChunkOffset end_chunk_offset);
+
+  // Return the RowIDs of all indexed rows whose key columns are equal to the given values. The values are cast to the
+  // data types of the key columns. If this is not possible without loss (e.g., 1.5 for an int column), no row can
+  // match. The RowIDs are not returned in any particular order.
+  std::vector<RowID> lookup(const std::vector<AllTypeVariant>& values) const;
+
+  // Materialize the keys of the rows in [begin_chunk_offset, end_chunk_offset) using typed segment iteration. Keys
+  // that contain NULL are nullopt.
+  std::vector<std::optional<Key>> materialize_keys(const Chunk& chunk, const ChunkOffset begin_chunk_offset,
+                                                   const ChunkOffset end_chunk_offset) const;
+
+  // Return the number of indexed rows
+  size_t size() const;
+
+  size_t memory_usage() const;
+
+ protected:
+  struct KeyHash {
+    size_t operator()(const Key& key) const;
+  };
+
+  struct Shard {
+    mutable std::shared_mutex mutex;
+    std::unordered_multimap<Key, RowID, KeyHash> entries;
+  };
+
+  static constexpr auto SHARD_COUNT = size_t{64};
+
+  Shard& _shard(const size_t hash);
+  const Shard& _shard(const size_t hash) const;
+
+  const std::vector<ColumnID> _column_ids;
+  const std::vector<DataType> _data_types;
+  const std::string _name;
+
+  std::array<Shard, SHARD_COUNT> _shards;
+};
+
+}  // namespace opossum
@@ -2,6 +2,8 @@
 
 #include <lz4.h>
 
+#include <array>
+#include <atomic>
 #include <climits>
 #include <sstream>
 #include <string>
@@ -13,12 +15,34 @@
 #include "utils/assert.hpp"
 #include "utils/performance_warning.hpp"
 
+namespace {
+
+/**
+ * Point accesses (e.g., via get_typed_value()) usually hit the same block several times in a row. To avoid
+ * decompressing it for every access, each thread keeps the most recently decompressed blocks. Entries are identified
+ * by the segment's block cache id, not by its address, as a new segment could be allocated where a deleted one was.
+ */
+struct CachedLZ4Block {
+  size_t segment_id{0};
+  std::optional<size_t> block_index;
+  std::vector<char> data;
+};
+
+constexpr auto BLOCK_CACHE_SIZE = size_t{4};
+thread_local std::array<CachedLZ4Block, BLOCK_CACHE_SIZE> block_cache;
+thread_local size_t next_block_cache_slot{0};
+
+std::atomic<size_t> next_block_cache_id{1};
+
+}  // namespace
+
 namespace opossum {
 
 template <typename T>
 LZ4Segment<T>::LZ4Segment(pmr_vector<pmr_vector<char>>&& lz4_blocks, std::optional<pmr_vector<bool>>&& null_values,
                           pmr_vector<char>&& dictionary, const size_t block_size, const size_t last_block_size,
-                          const size_t compressed_size, const size_t num_elements)
+                          const size_t compressed_size, const size_t num_elements,
+                          std::optional<LZ4BlockStatistics<T>>&& block_statistics)
     : BaseEncodedSegment{data_type_from_type<T>()},
       _lz4_blocks{std::move(lz4_blocks)},
       _null_values{std::move(null_values)},
@@ -27,13 +51,18 @@ LZ4Segment<T>::LZ4Segment(pmr_vector<pmr_vector<char>>&& lz4_blocks, std::option
       _block_size{block_size},
       _last_block_size{last_block_size},
       _compressed_size{compressed_size},
-      _num_elements{num_elements} {}
+      _num_elements{num_elements},
+      _block_statistics{std::move(block_statistics)},
+      _block_cache_id{next_block_cache_id++} {
+  DebugAssert(!_block_statistics || _block_statistics->minima.size() == _lz4_blocks.size(),
+              "Block statistics do not match the number of blocks.");
+}
 
 template <typename T>
 LZ4Segment<T>::LZ4Segment(pmr_vector<pmr_vector<char>>&& lz4_blocks, std::optional<pmr_vector<bool>>&& null_values,
                           pmr_vector<char>&& dictionary, std::unique_ptr<const BaseCompressedVector>&& string_offsets,
                           const size_t block_size, const size_t last_block_size, const size_t compressed_size,
-                          const size_t num_elements)
+                          const size_t num_elements, std::optional<LZ4BlockStatistics<T>>&& block_statistics)
     : BaseEncodedSegment{data_type_from_type<T>()},
       _lz4_blocks{std::move(lz4_blocks)},
       _null_values{std::move(null_values)},
@@ -42,7 +71,12 @@ LZ4Segment<T>::LZ4Segment(pmr_vector<pmr_vector<char>>&& lz4_blocks, std::option
       _block_size{block_size},
       _last_block_size{last_block_size},
       _compressed_size{compressed_size},
-      _num_elements{num_elements} {}
+      _num_elements{num_elements},
+      _block_statistics{std::move(block_statistics)},
+      _block_cache_id{next_block_cache_id++} {
+  DebugAssert(!_block_statistics || _block_statistics->minima.size() == _lz4_blocks.size(),
+              "Block statistics do not match the number of blocks.");
+}
 
 template <typename T>
 AllTypeVariant LZ4Segment<T>::operator[](const ChunkOffset chunk_offset) const {
@@ -109,6 +143,11 @@ const std::optional<std::unique_ptr<const BaseCompressedVector>>& LZ4Segment<T>:
   return _string_offsets;
 }
 
+template <typename T>
+const std::optional<LZ4BlockStatistics<T>>& LZ4Segment<T>::block_statistics() const {
+  return _block_statistics;
+}
+
 template <typename T>
 std::vector<T> LZ4Segment<T>::decompress() const {
   auto decompressed_data = std::vector<T>(size());
@@ -172,6 +211,68 @@ std::vector<pmr_string> LZ4Segment<pmr_string>::decompress() const {
   return decompressed_strings;
 }
 
+template <typename T>
+std::vector<T> LZ4Segment<T>::decompress_block_values(const size_t block_index) const {
+  DebugAssert(_block_statistics, "Rows can only be assigned to blocks if the segment has block statistics.");
+
+  // The rows of a block are exactly the values stored in it
+  const auto decompressed_block_size = block_index + 1 != _lz4_blocks.size() ? _block_size : _last_block_size;
+  auto decompressed_data = std::vector<T>(decompressed_block_size / sizeof(T));
+  _decompress_block(block_index, decompressed_data, 0u);
+  return decompressed_data;
+}
+
+template <>
+std::vector<pmr_string> LZ4Segment<pmr_string>::decompress_block_values(const size_t block_index) const {
+  DebugAssert(_block_statistics, "Rows can only be assigned to blocks if the segment has block statistics.");
+
+  const auto& first_chunk_offsets = _block_statistics->first_chunk_offsets;
+  const auto begin_chunk_offset = first_chunk_offsets[block_index];
+  const auto end_chunk_offset = block_index + 1 < first_chunk_offsets.size() ? first_chunk_offsets[block_index + 1]
+                                                                             : static_cast<ChunkOffset>(_num_elements);
+
+  auto decompressed_strings = std::vector<pmr_string>{};
+  if (begin_chunk_offset == end_chunk_offset) {
+    return decompressed_strings;
+  }
+  decompressed_strings.reserve(end_chunk_offset - begin_chunk_offset);
+
+  // The end of the last string is not stored as an offset but given by the size of the decompressed data.
+  const auto decompressed_size = (_lz4_blocks.size() - 1) * _block_size + _last_block_size;
+  auto offset_decompressor = (*_string_offsets)->create_base_decompressor();
+  const auto char_offset = [&](const ChunkOffset chunk_offset) -> size_t {
+    return chunk_offset < _num_elements ? offset_decompressor->get(chunk_offset) : decompressed_size;
+  };
+
+  /**
+   * The first string of the block starts in the block itself, but the last string can continue in the following
+   * blocks. Decompress all blocks that contain characters of the block's strings into a single buffer.
+   */
+  const auto begin_char_offset = char_offset(begin_chunk_offset);
+  const auto end_char_offset = char_offset(end_chunk_offset);
+  const auto first_block = begin_char_offset / _block_size;
+  auto decompressed_data = std::vector<char>{};
+  if (end_char_offset > begin_char_offset) {
+    const auto last_block = (end_char_offset - 1) / _block_size;
+    decompressed_data.resize((last_block - first_block + 1) * _block_size);
+    for (auto decompressed_block_index = first_block; decompressed_block_index <= last_block;
+         ++decompressed_block_index) {
+      _decompress_block_to_bytes(decompressed_block_index, decompressed_data,
+                                 (decompressed_block_index - first_block) * _block_size);
+    }
+  }
+
+  const auto buffer_begin_char_offset = first_block * _block_size;
+  auto string_begin = begin_char_offset - buffer_begin_char_offset;
+  for (auto chunk_offset = begin_chunk_offset; chunk_offset < end_chunk_offset; ++chunk_offset) {
+    const auto string_end = char_offset(chunk_offset + 1) - buffer_begin_char_offset;
+    decompressed_strings.emplace_back(decompressed_data.data() + string_begin, string_end - string_begin);
+    string_begin = string_end;
+  }
+
+  return decompressed_strings;
+}
+
 template <typename T>
 void LZ4Segment<T>::_decompress_block(const size_t block_index, std::vector<T>& decompressed_data,
                                       const size_t write_offset) const {
@@ -414,8 +515,40 @@ std::pair<pmr_string, size_t> LZ4Segment<pmr_string>::decompress(const ChunkOffs
 
 template <typename T>
 T LZ4Segment<T>::decompress(const ChunkOffset& chunk_offset) const {
-  auto decompressed_block = std::vector<char>(_block_size);
-  return decompress(chunk_offset, std::nullopt, decompressed_block).first;
+  if (_lz4_blocks.empty()) {
+    // Segment with only empty strings (see decompress() above), nothing to cache
+    auto decompressed_block = std::vector<char>{};
+    return decompress(chunk_offset, std::nullopt, decompressed_block).first;
+  }
+
+  const auto block_index = _block_index(chunk_offset);
+  for (auto& cached_block : block_cache) {
+    if (cached_block.segment_id == _block_cache_id && cached_block.block_index == block_index) {
+      // If the value continues in the following blocks, the cached data is replaced by the last decompressed block.
+      auto [value, cached_block_index] = decompress(chunk_offset, cached_block.block_index, cached_block.data);
+      cached_block.block_index = cached_block_index;
+      return value;
+    }
+  }
+
+  // Cache miss: replace the entries in a round-robin fashion
+  auto& cached_block = block_cache[next_block_cache_slot];
+  next_block_cache_slot = (next_block_cache_slot + 1) % BLOCK_CACHE_SIZE;
+
+  auto [value, cached_block_index] = decompress(chunk_offset, std::nullopt, cached_block.data);
+  cached_block.segment_id = _block_cache_id;
+  cached_block.block_index = cached_block_index;
+  return value;
+}
+
+template <typename T>
+size_t LZ4Segment<T>::_block_index(const ChunkOffset chunk_offset) const {
+  return (chunk_offset * sizeof(T)) / _block_size;
+}
+
+template <>
+size_t LZ4Segment<pmr_string>::_block_index(const ChunkOffset chunk_offset) const {
+  return (*_string_offsets)->create_base_decompressor()->get(chunk_offset) / _block_size;
 }
 
 template <typename T>
@@ -429,17 +562,26 @@ std::shared_ptr<BaseSegment> LZ4Segment<T>::copy_using_allocator(const Polymorph
       _null_values ? std::optional<pmr_vector<bool>>{pmr_vector<bool>{*_null_values, alloc}} : std::nullopt;
   auto new_dictionary = pmr_vector<char>{_dictionary, alloc};
 
+  auto new_block_statistics = std::optional<LZ4BlockStatistics<T>>{};
+  if (_block_statistics) {
+    new_block_statistics = LZ4BlockStatistics<T>{pmr_vector<ChunkOffset>{_block_statistics->first_chunk_offsets, alloc},
+                                                 pmr_vector<ChunkOffset>{_block_statistics->null_value_counts, alloc},
+                                                 pmr_vector<T>{_block_statistics->minima, alloc},
+                                                 pmr_vector<T>{_block_statistics->maxima, alloc}};
+  }
+
   auto copy = std::shared_ptr<LZ4Segment<T>>{};
 
   if (_string_offsets) {
     auto new_string_offsets = *_string_offsets ? (*_string_offsets)->copy_using_allocator(alloc) : nullptr;
     copy = std::make_shared<LZ4Segment<T>>(std::move(new_lz4_blocks), std::move(new_null_values),
                                            std::move(new_dictionary), std::move(new_string_offsets), _block_size,
-                                           _last_block_size, _compressed_size, _num_elements);
+                                           _last_block_size, _compressed_size, _num_elements,
+                                           std::move(new_block_statistics));
   } else {
     copy = std::make_shared<LZ4Segment<T>>(std::move(new_lz4_blocks), std::move(new_null_values),
                                            std::move(new_dictionary), _block_size, _last_block_size, _compressed_size,
-                                           _num_elements);
+                                           _num_elements, std::move(new_block_statistics));
   }
 
   copy->access_counter = access_counter;
@@ -469,8 +611,24 @@ size_t LZ4Segment<T>::memory_usage(const MemoryUsageCalculationMode) const {
   if (_string_offsets && *_string_offsets) {
     offset_size = (*_string_offsets)->data_size();
   }
+
+  auto block_statistics_size = size_t{0};
+  if (_block_statistics) {
+    block_statistics_size = _block_statistics->first_chunk_offsets.capacity() * sizeof(ChunkOffset) +
+                            _block_statistics->null_value_counts.capacity() * sizeof(ChunkOffset) +
+                            (_block_statistics->minima.capacity() + _block_statistics->maxima.capacity()) * sizeof(T);
+    if constexpr (std::is_same_v<T, pmr_string>) {
+      for (const auto* values : {&_block_statistics->minima, &_block_statistics->maxima}) {
+        for (const auto& value : *values) {
+          // Strings that fit into the small string buffer do not allocate additional memory
+          if (value.capacity() > pmr_string{}.capacity()) block_statistics_size += value.capacity();
+        }
+      }
+    }
+  }
+
   return sizeof(*this) + _compressed_size + null_value_vector_size + offset_size + _dictionary.size() +
-         block_vector_size;
+         block_vector_size + block_statistics_size;
 }
 
 template <typename T>
@@ -18,6 +18,22 @@ namespace opossum {
 
 class BaseCompressedVector;
 
+/**
+ * Statistics of the rows stored in each LZ4 block. They allow scans to skip blocks that cannot contain matches (or to
+ * accept whole blocks without decompressing them). For non-string segments, a block stores exactly the rows it
+ * contains. For string segments, a row is assigned to the block in which its first character is stored, so that its
+ * characters might continue in the following blocks. In both cases, the rows of a block are the range
+ * [first_chunk_offsets[block_index], first_chunk_offsets[block_index + 1]) (or until the end of the segment for the
+ * last block). If a block does not contain any non-NULL row, its minimum and maximum are default-constructed values.
+ */
+template <typename T>
+struct LZ4BlockStatistics {
+  pmr_vector<ChunkOffset> first_chunk_offsets;
+  pmr_vector<ChunkOffset> null_value_counts;
+  pmr_vector<T> minima;
+  pmr_vector<T> maxima;
+};
+
 template <typename T>
 class LZ4Segment : public BaseEncodedSegment {
  public:
@@ -50,10 +66,12 @@ class LZ4Segment : public BaseEncodedSegment {
    *                     the other variables might not be set or stored to reduce the memory footprint. E.g., a string
    *                     segment with only empty strings as elements would have no other way to know how many rows there
    *                     are.
+   * @param block_statistics Optional min/max and NULL count statistics for each block (see LZ4BlockStatistics).
    */
   explicit LZ4Segment(pmr_vector<pmr_vector<char>>&& lz4_blocks, std::optional<pmr_vector<bool>>&& null_values,
                       pmr_vector<char>&& dictionary, const size_t block_size, const size_t last_block_size,
-                      const size_t compressed_size, const size_t num_elements);
+                      const size_t compressed_size, const size_t num_elements,
+                      std::optional<LZ4BlockStatistics<T>>&& block_statistics = std::nullopt);
 
   /**
    * This constructor is used only for pmr_string segments. In those, the size of each row value varies. This means that
@@ -89,11 +107,13 @@ class LZ4Segment : public BaseEncodedSegment {
    *                     the other variables might not be set or stored to reduce the memory footprint. E.g., a string
    *                     segment with only empty strings as elements would have no other way to know how many rows there
    *                     are.
+   * @param block_statistics Optional min/max and NULL count statistics for each block (see LZ4BlockStatistics).
    */
   explicit LZ4Segment(pmr_vector<pmr_vector<char>>&& lz4_blocks, std::optional<pmr_vector<bool>>&& null_values,
                       pmr_vector<char>&& dictionary, std::unique_ptr<const BaseCompressedVector>&& string_offsets,
                       const size_t block_size, const size_t last_block_size, const size_t compressed_size,
-                      const size_t num_elements);
+                      const size_t num_elements,
+                      std::optional<LZ4BlockStatistics<T>>&& block_statistics = std::nullopt);
 
   const std::optional<pmr_vector<bool>>& null_values() const;
   std::optional<std::unique_ptr<BaseVectorDecompressor>> string_offset_decompressor() const;
@@ -102,6 +122,7 @@ class LZ4Segment : public BaseEncodedSegment {
   size_t block_size() const;
   size_t last_block_size() const;
   const std::optional<std::unique_ptr<const BaseCompressedVector>>& string_offsets() const;
+  const std::optional<LZ4BlockStatistics<T>>& block_statistics() const;
 
   /**
    * @defgroup BaseSegment interface
@@ -122,8 +143,9 @@ class LZ4Segment : public BaseEncodedSegment {
   std::vector<T> decompress() const;
 
   /**
-   * Retrieves a single value by only decompressing the block in resides in. Each call of this method causes the
-   * decompression of a block.
+   * Retrieves a single value by only decompressing the block in resides in. The most recently decompressed blocks are
+   * kept in a small per-thread cache, so that repeated point accesses to the same block (e.g., when materializing the
+   * result of an index scan) do not decompress the block again.
    *
    * @param chunk_offset The chunk offset identifies a single value in the segment.
    * @return The decompressed value.
@@ -153,6 +175,16 @@ class LZ4Segment : public BaseEncodedSegment {
   std::pair<T, size_t> decompress(const ChunkOffset& chunk_offset, const std::optional<size_t> cached_block_index,
                                   std::vector<char>& cached_block) const;
 
+  /**
+   * Decompresses the values of all rows that belong to the given block according to the block statistics. For string
+   * segments, this also decompresses the following blocks if the last string of the block continues in them.
+   * NULL values are returned as default-constructed values.
+   *
+   * @param block_index The index of the block whose rows are decompressed. The segment needs to have block statistics.
+   * @return The values of the rows [first_chunk_offsets[block_index], first_chunk_offsets[block_index + 1]).
+   */
+  std::vector<T> decompress_block_values(const size_t block_index) const;
+
   std::shared_ptr<BaseSegment> copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const final;
 
   size_t memory_usage(const MemoryUsageCalculationMode mode) const final;
@@ -178,6 +210,13 @@ class LZ4Segment : public BaseEncodedSegment {
   const size_t _last_block_size;
   const size_t _compressed_size;
   const size_t _num_elements;
+  const std::optional<LZ4BlockStatistics<T>> _block_statistics;
+
+  // Identifies this segment in the per-thread block cache. Other than the segment's address, it is never reused.
+  const size_t _block_cache_id;
+
+  // Returns the index of the block in which the value at the given chunk offset begins
+  size_t _block_index(const ChunkOffset chunk_offset) const;
 
   /**
    * Decompress a single block into the provided buffer (the vector). This method writes to the buffer with the given
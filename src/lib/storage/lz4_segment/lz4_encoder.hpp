@@ -8,6 +8,7 @@
 #include <limits>
 #include <memory>
 #include <string>
+#include <string_view>
 
 #include "storage/base_segment_encoder.hpp"
 #include "storage/lz4_segment.hpp"
@@ -44,6 +45,9 @@ namespace opossum {
  * these are compressed independently. That means that LZ4 can't use any information redundancy between these blocks and
  * therefore, the compression ratio will suffer.
  * In the case that the input data fits into a single block, this block is compressed without training a dictionary
+ *
+ * For each block, the encoder additionally gathers the minimum, maximum, and number of NULL values of the rows stored
+ * in it (see LZ4BlockStatistics). Scans use these statistics to decompress only blocks that might contain matches.
  */
 class LZ4Encoder : public SegmentEncoder<LZ4Encoder> {
  public:
@@ -116,17 +120,26 @@ class LZ4Encoder : public SegmentEncoder<LZ4Encoder> {
     auto lz4_blocks = pmr_vector<pmr_vector<char>>{allocator};
     auto total_compressed_size = size_t{0u};
     auto last_block_size = size_t{0u};
+    auto block_statistics = std::optional<LZ4BlockStatistics<T>>{};
     if (!values.empty()) {
       _compress(values, lz4_blocks, dictionary);
       last_block_size = input_size % _block_size != 0 ? input_size % _block_size : _block_size;
       for (const auto& compressed_block : lz4_blocks) {
         total_compressed_size += compressed_block.size();
       }
+
+      // Each block stores exactly _block_size / sizeof(T) values.
+      auto first_chunk_offsets = pmr_vector<ChunkOffset>(lz4_blocks.size(), allocator);
+      for (auto block_index = size_t{0u}; block_index < lz4_blocks.size(); ++block_index) {
+        first_chunk_offsets[block_index] = static_cast<ChunkOffset>(block_index * (_block_size / sizeof(T)));
+      }
+      block_statistics = _gather_block_statistics<T>(std::move(first_chunk_offsets), null_values,
+                                                     [&](const size_t row_index) { return values[row_index]; });
     }
 
     return std::make_shared<LZ4Segment<T>>(std::move(lz4_blocks), std::move(optional_null_values),
                                            std::move(dictionary), _block_size, last_block_size, total_compressed_size,
-                                           values.size());
+                                           values.size(), std::move(block_statistics));
   }
 
   std::shared_ptr<BaseEncodedSegment> _on_encode(const AnySegmentIterable<pmr_string> segment_iterable,
@@ -257,15 +270,92 @@ class LZ4Encoder : public SegmentEncoder<LZ4Encoder> {
       total_compressed_size += compressed_block.size();
     }
 
+    /**
+     * A string belongs to the block in which its first character is stored. Strings can span multiple blocks, so that a
+     * block might not contain the beginning of any string. Its row range is empty then.
+     */
+    const auto row_count = offsets.size();
+    auto first_chunk_offsets = pmr_vector<ChunkOffset>(lz4_blocks.size(), allocator);
+    auto next_block_index = size_t{0u};
+    for (auto row_index = size_t{0u}; row_index < row_count; ++row_index) {
+      const auto block_index = std::min(size_t{offsets[row_index]} / _block_size, lz4_blocks.size() - 1);
+      while (next_block_index <= block_index) {
+        first_chunk_offsets[next_block_index++] = static_cast<ChunkOffset>(row_index);
+      }
+    }
+    while (next_block_index < lz4_blocks.size()) {
+      first_chunk_offsets[next_block_index++] = static_cast<ChunkOffset>(row_count);
+    }
+
+    auto block_statistics = _gather_block_statistics<pmr_string>(
+        std::move(first_chunk_offsets), null_values, [&](const size_t row_index) {
+          const auto end_offset = row_index + 1 < row_count ? size_t{offsets[row_index + 1]} : input_size;
+          return std::string_view{values.data() + offsets[row_index], end_offset - offsets[row_index]};
+        });
+
     return std::make_shared<LZ4Segment<pmr_string>>(std::move(lz4_blocks), std::move(optional_null_values),
                                                     std::move(dictionary), std::move(compressed_offsets), _block_size,
-                                                    last_block_size, total_compressed_size, null_values.size());
+                                                    last_block_size, total_compressed_size, null_values.size(),
+                                                    std::move(block_statistics));
   }
 
  private:
   static constexpr auto _minimum_dictionary_size = size_t{1000u};
   static constexpr auto _minimum_value_size = size_t{20000u};
 
+  /**
+   * Computes the minimum, maximum, and number of NULL values for the rows of each block.
+   *
+   * @param first_chunk_offsets The first row of each block. The rows of a block end where the next block's rows begin.
+   * @param null_values The NULL flags of all rows.
+   * @param get_value Returns the (comparable) value of a non-NULL row. For strings, this is a string_view into the
+   *                  uncompressed data to avoid allocating a string for every row.
+   */
+  template <typename T, typename ValueGetter>
+  LZ4BlockStatistics<T> _gather_block_statistics(pmr_vector<ChunkOffset>&& first_chunk_offsets,
+                                                 const pmr_vector<bool>& null_values, const ValueGetter& get_value) {
+    const auto allocator = first_chunk_offsets.get_allocator();
+    const auto block_count = first_chunk_offsets.size();
+    const auto row_count = null_values.size();
+
+    auto statistics = LZ4BlockStatistics<T>{std::move(first_chunk_offsets), pmr_vector<ChunkOffset>(allocator),
+                                            pmr_vector<T>(allocator), pmr_vector<T>(allocator)};
+    statistics.null_value_counts.resize(block_count);
+    statistics.minima.resize(block_count);
+    statistics.maxima.resize(block_count);
+
+    for (auto block_index = size_t{0u}; block_index < block_count; ++block_index) {
+      const auto begin_row = size_t{statistics.first_chunk_offsets[block_index]};
+      const auto end_row =
+          block_index + 1 < block_count ? size_t{statistics.first_chunk_offsets[block_index + 1]} : row_count;
+
+      auto null_value_count = ChunkOffset{0};
+      auto min_max = std::optional<std::pair<decltype(get_value(0)), decltype(get_value(0))>>{};
+      for (auto row_index = begin_row; row_index < end_row; ++row_index) {
+        if (null_values[row_index]) {
+          ++null_value_count;
+          continue;
+        }
+
+        const auto value = get_value(row_index);
+        if (!min_max) {
+          min_max.emplace(value, value);
+        } else {
+          min_max->first = std::min(min_max->first, value);
+          min_max->second = std::max(min_max->second, value);
+        }
+      }
+
+      statistics.null_value_counts[block_index] = null_value_count;
+      if (min_max) {
+        statistics.minima[block_index] = T{min_max->first};
+        statistics.maxima[block_index] = T{min_max->second};
+      }
+    }
+
+    return statistics;
+  }
+
   /**
    * Use the LZ4 high compression stream API to compress the input values. The data is separated into different
    * blocks that are compressed independently. To maintain a high compression ratio and independence of these blocks
@@ -0,0 +1,791 @@
+#include "materialized_view.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/functional/hash.hpp>
+
+#include "expression/aggregate_expression.hpp"
+#include "expression/expression_utils.hpp"
+#include "hyrise.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/lqp_translator.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "logical_query_plan/static_table_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
+#include "lossy_cast.hpp"
+#include "operators/delete.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "optimizer/optimizer.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/operator_task.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+thread_local auto is_maintaining_view = false;
+
+// Marks the current thread as maintaining a materialized view while in scope
+class MaintenanceScope {
+ public:
+  MaintenanceScope() : _was_maintaining(is_maintaining_view) { is_maintaining_view = true; }
+  ~MaintenanceScope() { is_maintaining_view = _was_maintaining; }
+
+ private:
+  const bool _was_maintaining;
+};
+
+std::shared_ptr<const Table> execute_lqp(std::shared_ptr<AbstractLQPNode> lqp,
+                                         const std::shared_ptr<TransactionContext>& transaction_context) {
+  const auto optimized_lqp = Optimizer::create_default_optimizer()->optimize(std::move(lqp));
+  const auto pqp = LQPTranslator{}.translate_node(optimized_lqp);
+  pqp->set_transaction_context_recursively(transaction_context);
+
+  const auto tasks = OperatorTask::make_tasks_from_operator(pqp);
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(tasks);
+
+  return pqp->get_output();
+}
+
+std::shared_ptr<Table> make_reference_table(const std::shared_ptr<const Table>& referenced_table,
+                                            const TableColumnDefinitions& column_definitions,
+                                            const std::vector<RowID>& row_ids) {
+  auto table = std::make_shared<Table>(column_definitions, TableType::References);
+  if (row_ids.empty()) return table;
+
+  const auto pos_list = std::make_shared<RowIDPosList>(row_ids.begin(), row_ids.end());
+  auto segments = Segments{};
+  for (auto column_id = ColumnID{0}; column_id < referenced_table->column_count(); ++column_id) {
+    segments.emplace_back(std::make_shared<ReferenceSegment>(referenced_table, column_id, pos_list));
+  }
+  table->append_chunk(segments);
+
+  return table;
+}
+
+// Plans of select, project, and (inner) join operations on validated stored tables. The deltas of these plans can be
+// computed from the deltas of their inputs.
+bool is_spj_lqp(const std::shared_ptr<AbstractLQPNode>& lqp) {
+  auto is_spj = true;
+
+  visit_lqp(lqp, [&](const auto& node) {
+    switch (node->type) {
+      case LQPNodeType::Alias:
+      case LQPNodeType::Predicate:
+      case LQPNodeType::Projection:
+        break;
+
+      case LQPNodeType::Join: {
+        const auto join_mode = static_cast<const JoinNode&>(*node).join_mode;
+        is_spj &= join_mode == JoinMode::Inner || join_mode == JoinMode::Cross;
+      } break;
+
+      case LQPNodeType::Validate:
+        // Each stored table is replaced by its delta together with its ValidateNode
+        is_spj &= node->left_input()->type == LQPNodeType::StoredTable;
+        return LQPVisitation::DoNotVisitInputs;
+
+      default:
+        is_spj = false;
+    }
+
+    for (const auto& expression : node->node_expressions) {
+      visit_expression(expression, [&](const auto& sub_expression) {
+        is_spj &= sub_expression->type != ExpressionType::LQPSubquery;
+        return ExpressionVisitation::VisitArguments;
+      });
+    }
+
+    return is_spj ? LQPVisitation::VisitInputs : LQPVisitation::DoNotVisitInputs;
+  });
+
+  return is_spj;
+}
+
+}  // namespace
+
+namespace opossum {
+
+MaterializedView::MaterializedView(const std::string& init_name, const std::shared_ptr<LQPView>& init_view)
+    : name(init_name), view(init_view) {
+  const auto& lqp = view->lqp;
+  Assert(lqp_is_validated(lqp), "Materialized views require a validated LQP");
+
+  auto column_definitions = TableColumnDefinitions{};
+  const auto column_expressions = lqp->column_expressions();
+  for (auto column_id = ColumnID{0}; column_id < column_expressions.size(); ++column_id) {
+    const auto column_name_iter = view->column_names.find(column_id);
+    const auto column_name = column_name_iter != view->column_names.end()
+                                 ? column_name_iter->second
+                                 : column_expressions[column_id]->as_column_name();
+    const auto data_type = column_expressions[column_id]->data_type();
+    Assert(data_type != DataType::Null, "Cannot materialize column '" + column_name + "' without a data type");
+
+    column_definitions.emplace_back(column_name, data_type, lqp->is_column_nullable(column_id));
+  }
+  _table = std::make_shared<Table>(column_definitions, TableType::Data, std::nullopt, UseMvcc::Yes);
+
+  _analyze();
+}
+
+const std::shared_ptr<Table>& MaterializedView::table() const { return _table; }
+
+bool MaterializedView::is_incrementally_maintainable() const { return _is_incrementally_maintainable; }
+
+CommitID MaterializedView::maintained_commit_id() const { return _maintained_commit_id; }
+
+bool MaterializedView::is_up_to_date(const CommitID snapshot_commit_id) const {
+  const auto lock = std::unique_lock<std::mutex>{_mutex, std::try_to_lock};
+  if (!lock.owns_lock() || _needs_recomputation) return false;
+
+  // The transaction must see the rows written by the last maintenance, and the base tables must not have been modified
+  // since. Otherwise, the transaction would see the base tables in a different state than the one the view reflects.
+  if (_maintained_commit_id > snapshot_commit_id || _table->last_commit_id() > snapshot_commit_id) return false;
+
+  const auto& storage_manager = Hyrise::get().storage_manager;
+  for (const auto& [table_name, weak_table] : _base_tables) {
+    if (!storage_manager.has_table(table_name)) return false;
+
+    const auto table = storage_manager.get_table(table_name);
+    if (table != weak_table.lock() || table->last_commit_id() > _maintained_commit_id) return false;
+  }
+
+  return true;
+}
+
+void MaterializedView::maintain() {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  const auto& storage_manager = Hyrise::get().storage_manager;
+
+  auto has_changes = _needs_recomputation;
+  auto can_maintain_incrementally = _is_incrementally_maintainable;
+  for (const auto& [table_name, weak_table] : _base_tables) {
+    // The view cannot be maintained while one of its tables is dropped
+    if (!storage_manager.has_table(table_name)) return;
+
+    const auto table = storage_manager.get_table(table_name);
+    if (table != weak_table.lock()) {
+      _needs_recomputation = true;
+      has_changes = true;
+    }
+    has_changes |= table->last_commit_id() > _maintained_commit_id;
+
+    // The values of rows that were updated in place are not reflected by the begin and end CommitIDs
+    can_maintain_incrementally &= !table->allows_in_place_updates();
+  }
+  if (!has_changes) return;
+
+  const auto maintenance_scope = MaintenanceScope{};
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+
+  try {
+    const auto success = can_maintain_incrementally && !_needs_recomputation
+                             ? _maintain_incrementally(transaction_context)
+                             : _recompute(transaction_context);
+
+    _needs_recomputation = !success;
+    if (success) _maintained_commit_id = transaction_context->snapshot_commit_id();
+  } catch (const std::exception& exception) {
+    // The commits that triggered the maintenance have succeeded regardless. Until the view is recomputed, it is not
+    // used.
+    _needs_recomputation = true;
+    if (transaction_context->phase() == TransactionPhase::Active) {
+      transaction_context->rollback(RollbackReason::User);
+    }
+
+    Hyrise::get().log_manager.add_message("MaterializedView",
+                                          "Could not maintain materialized view '" + name + "': " + exception.what(),
+                                          LogLevel::Warning);
+  }
+}
+
+void MaterializedView::schedule_maintenance() {
+  // A scheduled maintenance that has not started yet also applies the changes of the commits since it was scheduled
+  if (_maintenance_scheduled.exchange(true)) return;
+
+  const auto weak_materialized_view = weak_from_this();
+  const auto task = std::make_shared<JobTask>([weak_materialized_view]() {
+    // The view might have been dropped in the meantime
+    const auto materialized_view = weak_materialized_view.lock();
+    if (!materialized_view) return;
+
+    materialized_view->_maintenance_scheduled = false;
+    materialized_view->maintain();
+  });
+  task->schedule();
+}
+
+void MaterializedView::refresh() {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+
+  const auto maintenance_scope = MaintenanceScope{};
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+
+  _needs_recomputation = !_recompute(transaction_context);
+  Assert(!_needs_recomputation, "Could not refresh materialized view '" + name + "' due to a conflicting transaction");
+  _maintained_commit_id = transaction_context->snapshot_commit_id();
+}
+
+bool MaterializedView::is_maintaining() { return is_maintaining_view; }
+
+void MaterializedView::_analyze() {
+  for (const auto& subplan_root : lqp_find_subplan_roots(view->lqp)) {
+    visit_lqp(subplan_root, [&](const auto& node) {
+      if (node->type != LQPNodeType::StoredTable) return LQPVisitation::VisitInputs;
+
+      const auto& table_name = static_cast<const StoredTableNode&>(*node).table_name;
+      const auto base_table_iter = std::find_if(_base_tables.begin(), _base_tables.end(),
+                                                [&](const auto& base_table) { return base_table.first == table_name; });
+      if (base_table_iter == _base_tables.end()) _base_tables.emplace_back(table_name, std::weak_ptr<const Table>{});
+
+      return LQPVisitation::VisitInputs;
+    });
+  }
+
+  auto lqp = view->lqp->deep_copy();
+
+  // Aggregates may only be followed by aliases and projections that select and reorder their output columns
+  auto node = lqp;
+  while (node->type == LQPNodeType::Alias || node->type == LQPNodeType::Projection) {
+    node = node->left_input();
+  }
+
+  if (node->type != LQPNodeType::Aggregate) {
+    if (!is_spj_lqp(lqp)) return;
+    _maintenance_lqp = lqp;
+  } else {
+    const auto aggregate_node = std::static_pointer_cast<AggregateNode>(node);
+    if (!is_spj_lqp(aggregate_node->left_input())) return;
+
+    const auto aggregate_column_expressions = aggregate_node->column_expressions();
+    for (const auto& expression : lqp->column_expressions()) {
+      const auto column_iter =
+          std::find_if(aggregate_column_expressions.begin(), aggregate_column_expressions.end(),
+                       [&](const auto& column_expression) { return *column_expression == *expression; });
+      if (column_iter == aggregate_column_expressions.end()) return;
+
+      _aggregate_output_column_ids.emplace_back(
+          static_cast<ColumnID>(std::distance(aggregate_column_expressions.begin(), column_iter)));
+    }
+
+    // The maintenance plan projects the group-by columns, followed by the arguments of the aggregates
+    const auto group_by_count = aggregate_node->aggregate_expressions_begin_idx;
+    auto projection_expressions = std::vector<std::shared_ptr<AbstractExpression>>{
+        aggregate_node->node_expressions.begin(), aggregate_node->node_expressions.begin() + group_by_count};
+
+    for (auto expression_idx = group_by_count; expression_idx < aggregate_node->node_expressions.size();
+         ++expression_idx) {
+      const auto aggregate_expression =
+          std::static_pointer_cast<AggregateExpression>(aggregate_node->node_expressions[expression_idx]);
+
+      switch (aggregate_expression->aggregate_function) {
+        case AggregateFunction::Min:
+        case AggregateFunction::Max:
+        case AggregateFunction::Sum:
+        case AggregateFunction::Avg:
+        case AggregateFunction::Count:
+          break;
+        default:
+          return;
+      }
+
+      _aggregate_expressions.emplace_back(aggregate_expression);
+      if (AggregateExpression::is_count_star(*aggregate_expression)) {
+        _aggregate_argument_column_ids.emplace_back(std::nullopt);
+        continue;
+      }
+
+      const auto& argument = aggregate_expression->argument();
+      const auto argument_iter =
+          std::find_if(projection_expressions.begin(), projection_expressions.end(),
+                       [&](const auto& projection_expression) { return *projection_expression == *argument; });
+      _aggregate_argument_column_ids.emplace_back(
+          static_cast<ColumnID>(std::distance(projection_expressions.begin(), argument_iter)));
+      if (argument_iter == projection_expressions.end()) projection_expressions.emplace_back(argument);
+    }
+
+    // A projection needs at least one column, e.g., for a view that only contains COUNT(*)
+    if (projection_expressions.empty()) {
+      projection_expressions.emplace_back(aggregate_node->left_input()->column_expressions().at(0));
+    }
+
+    _group_by_count = group_by_count;
+    _maintenance_lqp = ProjectionNode::make(projection_expressions, aggregate_node->left_input());
+  }
+
+  visit_lqp(_maintenance_lqp, [&](const auto& node) {
+    if (node->type == LQPNodeType::Validate) {
+      _base_table_occurrences.emplace_back(
+          BaseTableOccurrence{std::static_pointer_cast<StoredTableNode>(node->left_input()), node});
+    }
+    return LQPVisitation::VisitInputs;
+  });
+
+  _is_incrementally_maintainable = true;
+}
+
+bool MaterializedView::_recompute(const std::shared_ptr<TransactionContext>& transaction_context) {
+  const auto& storage_manager = Hyrise::get().storage_manager;
+  for (auto& [table_name, weak_table] : _base_tables) {
+    weak_table = storage_manager.get_table(table_name);
+  }
+
+  const auto rows_to_delete = execute_lqp(ValidateNode::make(StoredTableNode::make(name)), transaction_context);
+
+  if (!_group_by_count) {
+    const auto rows_to_insert =
+        execute_lqp(_is_incrementally_maintainable ? _maintenance_lqp->deep_copy() : view->lqp->deep_copy(),
+                    transaction_context)
+            ->get_rows();
+
+    const auto row_ids = _write(rows_to_delete, rows_to_insert, transaction_context);
+    if (!row_ids) return false;
+
+    // Only the RowIDs of incrementally maintained views are needed for deleting single rows later on
+    _row_ids.clear();
+    if (_is_incrementally_maintainable) {
+      for (auto row_idx = size_t{0}; row_idx < rows_to_insert.size(); ++row_idx) {
+        _row_ids[rows_to_insert[row_idx]].emplace_back((*row_ids)[row_idx]);
+      }
+    }
+
+    return true;
+  }
+
+  _groups.clear();
+  auto changed_groups = RowSet{};
+  _aggregate(_execute_maintenance_lqp({}, transaction_context)->get_rows(), false, changed_groups);
+
+  // Without GROUP BY, the view has a single row even if there are no input rows
+  if (*_group_by_count == 0) {
+    _groups[Row{}].aggregates.resize(_aggregate_expressions.size());
+  }
+
+  auto rows_to_insert = std::vector<Row>{};
+  auto group_states = std::vector<GroupState*>{};
+  for (auto& [group_key, group_state] : _groups) {
+    rows_to_insert.emplace_back(_group_row(group_key, group_state));
+    group_states.emplace_back(&group_state);
+  }
+
+  const auto row_ids = _write(rows_to_delete, rows_to_insert, transaction_context);
+  if (!row_ids) return false;
+
+  for (auto group_idx = size_t{0}; group_idx < group_states.size(); ++group_idx) {
+    group_states[group_idx]->row_id = (*row_ids)[group_idx];
+  }
+
+  return true;
+}
+
+bool MaterializedView::_maintain_incrementally(const std::shared_ptr<TransactionContext>& transaction_context) {
+  const auto snapshot_commit_id = transaction_context->snapshot_commit_id();
+
+  auto changed_occurrence_ids = std::vector<size_t>{};
+  auto inserted_rows = std::vector<std::shared_ptr<Table>>{};
+  auto deleted_rows = std::vector<std::shared_ptr<Table>>{};
+  for (auto occurrence_idx = size_t{0}; occurrence_idx < _base_table_occurrences.size(); ++occurrence_idx) {
+    auto [inserted, deleted] = _get_delta(occurrence_idx, snapshot_commit_id);
+    if (inserted->row_count() == 0 && deleted->row_count() == 0) continue;
+
+    changed_occurrence_ids.emplace_back(occurrence_idx);
+    inserted_rows.emplace_back(std::move(inserted));
+    deleted_rows.emplace_back(std::move(deleted));
+  }
+
+  // Evaluate the terms of the delta (see class comment): For each non-empty subset of the changed occurrences, the
+  // occurrences in the subset are replaced by their inserted or deleted rows and all others are read as of the new
+  // snapshot. The sign of a term is (-1)^(|subset| + 1), multiplied by -1 for each occurrence replaced by deleted rows.
+  auto row_count_deltas = std::unordered_map<Row, int64_t, RowHash, RowEqual>{};
+  const auto term_count = size_t{1} << changed_occurrence_ids.size();
+  for (auto subset = size_t{1}; subset < term_count; ++subset) {
+    for (auto deletions = size_t{0}; deletions < term_count; ++deletions) {
+      if ((deletions & ~subset) != 0) continue;
+
+      auto deltas = std::unordered_map<size_t, std::shared_ptr<Table>>{};
+      auto sign = int64_t{-1};
+      auto is_empty = false;
+      for (auto changed_idx = size_t{0}; changed_idx < changed_occurrence_ids.size(); ++changed_idx) {
+        const auto mask = size_t{1} << changed_idx;
+        if ((subset & mask) == 0) continue;
+
+        const auto is_deletion = (deletions & mask) != 0;
+        const auto& delta = is_deletion ? deleted_rows[changed_idx] : inserted_rows[changed_idx];
+        sign = is_deletion ? sign : -sign;
+        is_empty |= delta->row_count() == 0;
+        deltas.emplace(changed_occurrence_ids[changed_idx], delta);
+      }
+      if (is_empty) continue;
+
+      for (const auto& row : _execute_maintenance_lqp(deltas, transaction_context)->get_rows()) {
+        row_count_deltas[row] += sign;
+      }
+    }
+  }
+
+  auto rows_to_insert = std::vector<Row>{};
+  auto row_ids_to_delete = std::vector<RowID>{};
+
+  if (!_group_by_count) {
+    for (const auto& [row, row_count_delta] : row_count_deltas) {
+      if (row_count_delta > 0) {
+        rows_to_insert.insert(rows_to_insert.end(), static_cast<size_t>(row_count_delta), row);
+        continue;
+      }
+
+      auto row_ids_iter = _row_ids.find(row);
+      if (row_ids_iter == _row_ids.end() || static_cast<int64_t>(row_ids_iter->second.size()) < -row_count_delta) {
+        // The view does not match its base tables (e.g., because its table was modified), start from scratch
+        return _recompute(transaction_context);
+      }
+
+      auto& row_ids = row_ids_iter->second;
+      row_ids_to_delete.insert(row_ids_to_delete.end(), row_ids.end() + row_count_delta, row_ids.end());
+      row_ids.resize(row_ids.size() + row_count_delta);
+      if (row_ids.empty()) _row_ids.erase(row_ids_iter);
+    }
+
+    const auto row_ids =
+        _write(make_reference_table(_table, _table->column_definitions(), row_ids_to_delete), rows_to_insert,
+               transaction_context);
+    if (!row_ids) return false;
+
+    for (auto row_idx = size_t{0}; row_idx < rows_to_insert.size(); ++row_idx) {
+      _row_ids[rows_to_insert[row_idx]].emplace_back((*row_ids)[row_idx]);
+    }
+
+    return true;
+  }
+
+  auto inserted_aggregate_rows = std::vector<Row>{};
+  auto deleted_aggregate_rows = std::vector<Row>{};
+  for (const auto& [row, row_count_delta] : row_count_deltas) {
+    auto& rows = row_count_delta > 0 ? inserted_aggregate_rows : deleted_aggregate_rows;
+    rows.insert(rows.end(), static_cast<size_t>(std::abs(row_count_delta)), row);
+  }
+
+  if (!deleted_aggregate_rows.empty()) {
+    for (const auto& aggregate_expression : _aggregate_expressions) {
+      if (aggregate_expression->aggregate_function == AggregateFunction::Min ||
+          aggregate_expression->aggregate_function == AggregateFunction::Max) {
+        return _recompute(transaction_context);
+      }
+    }
+  }
+
+  auto changed_groups = RowSet{};
+  _aggregate(inserted_aggregate_rows, false, changed_groups);
+  _aggregate(deleted_aggregate_rows, true, changed_groups);
+
+  auto inserted_group_states = std::vector<GroupState*>{};
+  for (const auto& group_key : changed_groups) {
+    const auto group_iter = _groups.find(group_key);
+    auto& group_state = group_iter->second;
+    DebugAssert(group_state.row_count >= 0, "Group has a negative number of rows");
+
+    if (!group_state.row_id.is_null()) row_ids_to_delete.emplace_back(group_state.row_id);
+
+    if (group_state.row_count == 0 && *_group_by_count > 0) {
+      _groups.erase(group_iter);
+      continue;
+    }
+
+    rows_to_insert.emplace_back(_group_row(group_key, group_state));
+    inserted_group_states.emplace_back(&group_state);
+  }
+
+  const auto row_ids = _write(make_reference_table(_table, _table->column_definitions(), row_ids_to_delete),
+                              rows_to_insert, transaction_context);
+  if (!row_ids) return false;
+
+  for (auto group_idx = size_t{0}; group_idx < inserted_group_states.size(); ++group_idx) {
+    inserted_group_states[group_idx]->row_id = (*row_ids)[group_idx];
+  }
+
+  return true;
+}
+
+std::pair<std::shared_ptr<Table>, std::shared_ptr<Table>> MaterializedView::_get_delta(
+    const size_t occurrence_idx, const CommitID snapshot_commit_id) const {
+  const auto& table_name = _base_table_occurrences[occurrence_idx].stored_table_node->table_name;
+  const auto table = Hyrise::get().storage_manager.get_table(table_name);
+  const auto maintained_commit_id = _maintained_commit_id.load();
+
+  auto inserted_row_ids = std::vector<RowID>{};
+  auto deleted_row_ids = std::vector<RowID>{};
+
+  const auto chunk_count = table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    const auto& mvcc_data = chunk->mvcc_data();
+    if (mvcc_data->last_commit_id() <= maintained_commit_id) continue;
+
+    const auto chunk_size = chunk->size();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      const auto begin_commit_id = mvcc_data->get_begin_cid(chunk_offset);
+      const auto end_commit_id = mvcc_data->get_end_cid(chunk_offset);
+
+      if (begin_commit_id > maintained_commit_id && begin_commit_id <= snapshot_commit_id &&
+          end_commit_id > snapshot_commit_id) {
+        inserted_row_ids.emplace_back(RowID{chunk_id, chunk_offset});
+      } else if (begin_commit_id <= maintained_commit_id && end_commit_id > maintained_commit_id &&
+                 end_commit_id <= snapshot_commit_id) {
+        deleted_row_ids.emplace_back(RowID{chunk_id, chunk_offset});
+      }
+    }
+  }
+
+  // StaticTableNodes are compared by their column definitions. Distinct column names keep the LQPTranslator from
+  // translating the deltas of different occurrences of a table (e.g., in self-joins) to the same operator.
+  const auto make_delta = [&](const std::vector<RowID>& row_ids, const std::string& suffix) {
+    auto column_definitions = table->column_definitions();
+    for (auto& column_definition : column_definitions) {
+      column_definition.name += "_" + std::to_string(occurrence_idx) + suffix;
+    }
+
+    auto delta = make_reference_table(table, column_definitions, row_ids);
+    delta->set_table_statistics(TableStatistics::from_table(*delta));
+    return delta;
+  };
+
+  return {make_delta(inserted_row_ids, "_inserted"), make_delta(deleted_row_ids, "_deleted")};
+}
+
+std::shared_ptr<const Table> MaterializedView::_execute_maintenance_lqp(
+    const std::unordered_map<size_t, std::shared_ptr<Table>>& deltas,
+    const std::shared_ptr<TransactionContext>& transaction_context) const {
+  auto lqp = _maintenance_lqp->deep_copy();
+
+  {
+    const auto node_mapping = lqp_create_node_mapping(_maintenance_lqp, lqp);
+
+    // Replace the occurrences by their deltas and let the expressions refer to the columns of the deltas
+    auto expression_mapping = ExpressionUnorderedMap<std::shared_ptr<AbstractExpression>>{};
+    for (const auto& [occurrence_idx, delta] : deltas) {
+      const auto& occurrence = _base_table_occurrences[occurrence_idx];
+      const auto& stored_table_node = node_mapping.at(occurrence.stored_table_node);
+      const auto& replaced_node = node_mapping.at(occurrence.replaced_node);
+
+      const auto static_table_node = StaticTableNode::make(delta);
+      if (replaced_node == lqp) {
+        lqp = static_table_node;
+      } else {
+        lqp_replace_node(replaced_node, static_table_node);
+      }
+
+      const auto stored_columns = stored_table_node->column_expressions();
+      const auto static_columns = static_table_node->column_expressions();
+      for (auto column_id = ColumnID{0}; column_id < stored_columns.size(); ++column_id) {
+        expression_mapping.emplace(stored_columns[column_id], static_columns[column_id]);
+      }
+    }
+
+    visit_lqp(lqp, [&](const auto& node) {
+      for (auto& expression : node->node_expressions) {
+        expression_deep_replace(expression, expression_mapping);
+      }
+      return LQPVisitation::VisitInputs;
+    });
+  }
+
+  return execute_lqp(std::move(lqp), transaction_context);
+}
+
+void MaterializedView::_aggregate(const std::vector<Row>& rows, const bool is_deletion, RowSet& changed_groups) {
+  const auto group_by_count = *_group_by_count;
+  const auto sign = is_deletion ? int64_t{-1} : int64_t{1};
+
+  for (const auto& row : rows) {
+    auto group_key = Row(row.begin(), row.begin() + group_by_count);
+    auto& group_state = _groups[group_key];
+    group_state.aggregates.resize(_aggregate_expressions.size());
+    group_state.row_count += sign;
+
+    for (auto aggregate_idx = size_t{0}; aggregate_idx < _aggregate_expressions.size(); ++aggregate_idx) {
+      const auto& argument_column_id = _aggregate_argument_column_ids[aggregate_idx];
+      if (!argument_column_id) continue;
+
+      const auto& value = row[*argument_column_id];
+      if (variant_is_null(value)) continue;
+
+      auto& aggregate_state = group_state.aggregates[aggregate_idx];
+      aggregate_state.count += sign;
+
+      const auto& aggregate_expression = *_aggregate_expressions[aggregate_idx];
+      switch (aggregate_expression.aggregate_function) {
+        case AggregateFunction::Sum:
+        case AggregateFunction::Avg: {
+          const auto argument_data_type = aggregate_expression.argument()->data_type();
+          if (argument_data_type == DataType::Int || argument_data_type == DataType::Long) {
+            aggregate_state.integral_sum += sign * *lossy_variant_cast<int64_t>(value);
+          } else {
+            aggregate_state.floating_point_sum += static_cast<double>(sign) * *lossy_variant_cast<double>(value);
+          }
+        } break;
+
+        case AggregateFunction::Min:
+        case AggregateFunction::Max: {
+          DebugAssert(!is_deletion, "MIN and MAX cannot be maintained on deletions");
+          const auto is_min = aggregate_expression.aggregate_function == AggregateFunction::Min;
+          if (variant_is_null(aggregate_state.min_or_max) || (is_min && value < aggregate_state.min_or_max) ||
+              (!is_min && aggregate_state.min_or_max < value)) {
+            aggregate_state.min_or_max = value;
+          }
+        } break;
+
+        default:
+          break;
+      }
+    }
+
+    changed_groups.emplace(std::move(group_key));
+  }
+}
+
+MaterializedView::Row MaterializedView::_group_row(const Row& group_key, const GroupState& group_state) const {
+  auto aggregate_row = group_key;
+
+  for (auto aggregate_idx = size_t{0}; aggregate_idx < _aggregate_expressions.size(); ++aggregate_idx) {
+    const auto& aggregate_expression = *_aggregate_expressions[aggregate_idx];
+    const auto& aggregate_state = group_state.aggregates[aggregate_idx];
+    const auto is_integral = aggregate_expression.data_type() == DataType::Long;
+
+    switch (aggregate_expression.aggregate_function) {
+      case AggregateFunction::Count:
+        aggregate_row.emplace_back(_aggregate_argument_column_ids[aggregate_idx] ? aggregate_state.count
+                                                                                  : group_state.row_count);
+        break;
+
+      case AggregateFunction::Sum:
+        if (aggregate_state.count == 0) {
+          aggregate_row.emplace_back(NULL_VALUE);
+        } else if (is_integral) {
+          aggregate_row.emplace_back(aggregate_state.integral_sum);
+        } else {
+          aggregate_row.emplace_back(aggregate_state.floating_point_sum);
+        }
+        break;
+
+      case AggregateFunction::Avg:
+        if (aggregate_state.count == 0) {
+          aggregate_row.emplace_back(NULL_VALUE);
+        } else {
+          // One of the sums is zero, depending on the type of the argument
+          const auto sum = static_cast<double>(aggregate_state.integral_sum) + aggregate_state.floating_point_sum;
+          aggregate_row.emplace_back(sum / static_cast<double>(aggregate_state.count));
+        }
+        break;
+
+      case AggregateFunction::Min:
+      case AggregateFunction::Max:
+        aggregate_row.emplace_back(aggregate_state.count == 0 ? NULL_VALUE : aggregate_state.min_or_max);
+        break;
+
+      default:
+        Fail("Unexpected aggregate function");
+    }
+  }
+
+  auto row = Row{};
+  row.reserve(_aggregate_output_column_ids.size());
+  for (const auto column_id : _aggregate_output_column_ids) {
+    row.emplace_back(aggregate_row[column_id]);
+  }
+  return row;
+}
+
+std::optional<std::vector<RowID>> MaterializedView::_write(
+    const std::shared_ptr<const Table>& rows_to_delete, const std::vector<Row>& rows_to_insert,
+    const std::shared_ptr<TransactionContext>& transaction_context) {
+  if (rows_to_delete->row_count() > 0) {
+    const auto table_wrapper = std::make_shared<TableWrapper>(rows_to_delete);
+    table_wrapper->execute();
+
+    const auto delete_operator = std::make_shared<Delete>(table_wrapper);
+    delete_operator->set_transaction_context(transaction_context);
+    delete_operator->execute();
+
+    if (delete_operator->execute_failed()) {
+      transaction_context->rollback(RollbackReason::Conflict);
+      return std::nullopt;
+    }
+  }
+
+  // Inserted rows are appended to the last chunk or to new chunks
+  const auto chunk_count_before_insert = _table->chunk_count();
+  const auto first_chunk_id = chunk_count_before_insert > 0 ? ChunkID{chunk_count_before_insert - 1} : ChunkID{0};
+
+  if (!rows_to_insert.empty()) {
+    const auto values_to_insert = std::make_shared<Table>(_table->column_definitions(), TableType::Data);
+    for (const auto& row : rows_to_insert) {
+      values_to_insert->append(row);
+    }
+
+    const auto table_wrapper = std::make_shared<TableWrapper>(values_to_insert);
+    table_wrapper->execute();
+
+    const auto insert = std::make_shared<Insert>(name, table_wrapper);
+    insert->set_transaction_context(transaction_context);
+    insert->execute();
+  }
+
+  transaction_context->commit();
+
+  // Identify the inserted rows by their begin CommitID. Insert keeps the order of its input.
+  auto row_ids = std::vector<RowID>{};
+  if (rows_to_insert.empty()) return row_ids;
+
+  row_ids.reserve(rows_to_insert.size());
+  const auto commit_id = transaction_context->commit_id();
+  const auto chunk_count = _table->chunk_count();
+  for (auto chunk_id = first_chunk_id; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = _table->get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    const auto& mvcc_data = chunk->mvcc_data();
+    const auto chunk_size = chunk->size();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      if (mvcc_data->get_begin_cid(chunk_offset) == commit_id) row_ids.emplace_back(RowID{chunk_id, chunk_offset});
+    }
+  }
+  Assert(row_ids.size() == rows_to_insert.size(), "Could not find all rows inserted into materialized view");
+
+  return row_ids;
+}
+
+size_t MaterializedView::RowHash::operator()(const Row& row) const {
+  auto hash = size_t{0};
+  for (const auto& value : row) {
+    boost::hash_combine(hash, std::hash<AllTypeVariant>{}(value));
+  }
+  return hash;
+}
+
+bool MaterializedView::RowEqual::operator()(const Row& lhs, const Row& rhs) const {
+  if (lhs.size() != rhs.size()) return false;
+
+  for (auto column_id = size_t{0}; column_id < lhs.size(); ++column_id) {
+    const auto lhs_is_null = variant_is_null(lhs[column_id]);
+    const auto rhs_is_null = variant_is_null(rhs[column_id]);
+    if (lhs_is_null != rhs_is_null) return false;
+    if (!lhs_is_null && !(lhs[column_id] == rhs[column_id])) return false;
+  }
+
+  return true;
+}
+
+}  // namespace opossum
@@ -0,0 +1,174 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "lqp_view.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+class AggregateExpression;
+class StoredTableNode;
+class Table;
+class TransactionContext;
+
+/**
+ * A view whose result is stored as a regular table (with the name of the view) in the StorageManager. Queries read it
+ * like any other table and the MaterializedViewRule rewrites queries that contain the view's LQP to read from it.
+ * Create materialized views with StorageManager::add_materialized_view().
+ *
+ * The view is maintained eagerly: after each commit that modified one of its base tables, a maintenance is scheduled
+ * (see StorageManager::maintain_materialized_views()), which runs asynchronously unless the scheduler executes tasks
+ * immediately. Its table is modified with the Insert and Delete operators in an own transaction, so that readers see
+ * consistent contents. Until the maintenance is done, the MaterializedViewRule does not use the view.
+ *
+ * SPJ views (stored tables, validations, predicates, inner and cross joins, projections, and aliases) and aggregates
+ * (SUM, COUNT, AVG, MIN, MAX) on top of an SPJ plan are maintained incrementally. The rows inserted into and deleted
+ * from each base table since the last maintenance are identified by their begin and end CommitIDs in the MvccData.
+ * Chunks that were not modified since the last maintenance (see MvccData::last_commit_id()) are skipped.
+ * The delta of the SPJ plan is computed by replacing base tables with their deltas:
+ *
+ *   R'⋈S' - R⋈S = ΔR⋈S' + R'⋈ΔS - ΔR⋈ΔS, with R = R' - ΔR
+ *
+ * For aggregates, the MaterializedView keeps the running SUM, COUNT, etc. of each group and only rewrites the rows of
+ * groups that changed. MIN and MAX cannot be maintained on deletions - in that case, and for all other views (e.g.,
+ * views with ORDER BY, LIMIT, HAVING, outer joins, or subqueries), the view is recomputed from scratch.
+ */
+class MaterializedView : public std::enable_shared_from_this<MaterializedView>, private Noncopyable {
+ public:
+  // @param init_view must be validated (i.e., translated with MVCC enabled) and unoptimized
+  MaterializedView(const std::string& init_name, const std::shared_ptr<LQPView>& init_view);
+
+  const std::string name;
+  const std::shared_ptr<const LQPView> view;
+
+  // The table holding the contents of the view
+  const std::shared_ptr<Table>& table() const;
+
+  bool is_incrementally_maintainable() const;
+
+  // The contents of the view reflect the base tables as of this CommitID
+  CommitID maintained_commit_id() const;
+
+  // Whether the contents of the view that are visible to a transaction with @param snapshot_commit_id reflect the base
+  // tables as that transaction sees them. False while the view is maintained and after a failed maintenance.
+  bool is_up_to_date(const CommitID snapshot_commit_id) const;
+
+  // Applies all changes committed to the base tables since maintained_commit_id(). Does nothing if there are none. If
+  // the maintenance fails, the error is logged and the view is recomputed by the next maintenance.
+  void maintain();
+
+  // Runs maintain() as a task of the current scheduler, unless a maintenance is already scheduled and not yet started
+  void schedule_maintenance();
+
+  // Recomputes the view from scratch
+  void refresh();
+
+  // True while the current thread maintains a materialized view. Used to prevent the view from being used for its own
+  // maintenance and to prevent recursive maintenance.
+  static bool is_maintaining();
+
+ private:
+  using Row = std::vector<AllTypeVariant>;
+
+  struct RowHash {
+    size_t operator()(const Row& row) const;
+  };
+
+  // NULLs are considered equal here
+  struct RowEqual {
+    bool operator()(const Row& lhs, const Row& rhs) const;
+  };
+
+  // A base table as referenced by a StoredTableNode in the maintenance plan. The same table might occur more than once.
+  struct BaseTableOccurrence {
+    std::shared_ptr<StoredTableNode> stored_table_node;
+
+    // The ValidateNode on top of the stored_table_node, which is replaced when the delta of the table is used
+    std::shared_ptr<AbstractLQPNode> replaced_node;
+  };
+
+  struct AggregateState {
+    // Number of non-NULL values
+    int64_t count{0};
+    int64_t integral_sum{0};
+    double floating_point_sum{0};
+    AllTypeVariant min_or_max{NULL_VALUE};
+  };
+
+  struct GroupState {
+    RowID row_id{NULL_ROW_ID};
+    int64_t row_count{0};
+    std::vector<AggregateState> aggregates;
+  };
+
+  using RowSet = std::unordered_set<Row, RowHash, RowEqual>;
+
+  void _analyze();
+
+  // Return false if the view could not be written because of a conflict
+  bool _recompute(const std::shared_ptr<TransactionContext>& transaction_context);
+  bool _maintain_incrementally(const std::shared_ptr<TransactionContext>& transaction_context);
+
+  // Returns the rows inserted into (first) and deleted from (second) the table of an occurrence since the last
+  // maintenance
+  std::pair<std::shared_ptr<Table>, std::shared_ptr<Table>> _get_delta(const size_t occurrence_idx,
+                                                                       const CommitID snapshot_commit_id) const;
+
+  // Executes the maintenance plan, with the occurrences of base tables in @param deltas replaced by the given tables
+  std::shared_ptr<const Table> _execute_maintenance_lqp(
+      const std::unordered_map<size_t, std::shared_ptr<Table>>& deltas,
+      const std::shared_ptr<TransactionContext>& transaction_context) const;
+
+  // Folds input rows of the aggregate into the group states and adds the keys of the groups to @param changed_groups
+  void _aggregate(const std::vector<Row>& rows, const bool is_deletion, RowSet& changed_groups);
+  Row _group_row(const Row& group_key, const GroupState& group_state) const;
+
+  // Deletes @param rows_to_delete (a reference table on the view's table) and inserts @param rows_to_insert, then
+  // commits. Returns the RowIDs of the inserted rows or std::nullopt if the rows could not be deleted.
+  std::optional<std::vector<RowID>> _write(const std::shared_ptr<const Table>& rows_to_delete,
+                                           const std::vector<Row>& rows_to_insert,
+                                           const std::shared_ptr<TransactionContext>& transaction_context);
+
+  std::shared_ptr<Table> _table;
+
+  bool _is_incrementally_maintainable{false};
+
+  // The plan evaluated for maintenance: For SPJ views, the view's LQP. For aggregate views, a projection of the
+  // group-by expressions and the aggregate arguments on top of the aggregate's input.
+  std::shared_ptr<AbstractLQPNode> _maintenance_lqp;
+  std::vector<BaseTableOccurrence> _base_table_occurrences;
+
+  // For aggregate views
+  std::optional<size_t> _group_by_count;
+  std::vector<std::shared_ptr<AggregateExpression>> _aggregate_expressions;
+  std::vector<std::optional<ColumnID>> _aggregate_argument_column_ids;
+  std::vector<ColumnID> _aggregate_output_column_ids;  // Aggregate output for each column of the view
+  std::unordered_map<Row, GroupState, RowHash, RowEqual> _groups;
+
+  // For SPJ views and recomputed views, the RowIDs of all rows in the table by their values
+  std::unordered_map<Row, std::vector<RowID>, RowHash, RowEqual> _row_ids;
+
+  // The base tables (including those in subqueries) as of the last maintenance. If one of them is replaced, the view
+  // is recomputed.
+  std::vector<std::pair<std::string, std::weak_ptr<const Table>>> _base_tables;
+
+  // Set if the last maintenance failed or no maintenance happened yet
+  bool _needs_recomputation{true};
+
+  std::atomic<CommitID> _maintained_commit_id{0};
+  std::atomic_bool _maintenance_scheduled{false};
+  mutable std::mutex _mutex;
+};
+
+}  // namespace opossum
@@ -68,12 +68,21 @@ bool MvccData::compare_exchange_tid(const ChunkOffset offset, TransactionID expe
   return _tids[offset].compare_exchange_strong(expected_transaction_id, new_transaction_id);
 }
 
+CommitID MvccData::last_commit_id() const { return _last_commit_id.load(); }
+
+void MvccData::update_last_commit_id(const CommitID commit_id) {
+  // Transactions may commit their records out of order, so only ever increase the CommitID
+  auto last_commit_id = _last_commit_id.load();
+  while (last_commit_id < commit_id && !_last_commit_id.compare_exchange_weak(last_commit_id, commit_id)) {}
+}
+
 size_t MvccData::memory_usage() const {
   auto bytes = size_t{0};
   bytes += sizeof(_tids) + sizeof(_begin_cids) + sizeof(_end_cids);  // NOLINT
   bytes += _tids.size() * sizeof(decltype(_tids)::value_type);
   bytes += _begin_cids.size() * sizeof(decltype(_begin_cids)::value_type);
   bytes += _end_cids.size() * sizeof(decltype(_end_cids)::value_type);
+  bytes += column_versions.memory_usage();
   return bytes;
 }
 
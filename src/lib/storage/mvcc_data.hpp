@@ -3,6 +3,7 @@
 #include <atomic>
 #include <shared_mutex>  // NOLINT lint thinks this is a C header or something
 
+#include "storage/column_version_store.hpp"
 #include "types.hpp"
 #include "utils/copyable_atomic.hpp"
 
@@ -13,6 +14,7 @@ namespace opossum {
  */
 struct MvccData {
   friend class Chunk;
+  friend class Validate;
   friend std::ostream& operator<<(std::ostream& stream, const MvccData& mvcc_data);
 
  public:
@@ -23,6 +25,9 @@ struct MvccData {
   // Validate::_on_execute for further details.
   std::optional<CommitID> max_begin_cid;
 
+  // Values of the chunk that were updated in place, see ColumnVersionStore
+  ColumnVersionStore column_versions;
+
   // Creates MVCC data that supports a maximum of `size` rows. If the underlying chunk has less rows, the extra rows
   // here are ignored. This is to avoid resizing the vectors, which would cause reallocations and require locking.
   explicit MvccData(const size_t size, CommitID begin_commit_id);
@@ -45,6 +50,11 @@ struct MvccData {
   bool compare_exchange_tid(const ChunkOffset offset, TransactionID expected_transaction_id,
                             TransactionID new_transaction_id);
 
+  // The highest CommitID of all commits that modified the begin or end CommitIDs of this chunk. Allows readers that
+  // look for changes since a given commit (e.g., MaterializedView) to skip unchanged chunks.
+  CommitID last_commit_id() const;
+  void update_last_commit_id(const CommitID commit_id);
+
   size_t memory_usage() const;
 
  private:
@@ -52,6 +62,8 @@ struct MvccData {
   pmr_vector<CommitID> _begin_cids;                  // < commit id when record was added
   pmr_vector<CommitID> _end_cids;                    // < commit id when record was deleted
   pmr_vector<copyable_atomic<TransactionID>> _tids;  // < 0 unless locked by a transaction
+
+  std::atomic<CommitID> _last_commit_id{0};
 };
 
 std::ostream& operator<<(std::ostream& stream, const MvccData& mvcc_data);
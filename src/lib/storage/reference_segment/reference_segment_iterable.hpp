@@ -66,12 +66,20 @@ class ReferenceSegmentIterable : public SegmentIterable<ReferenceSegmentIterable
           if constexpr (std::is_same_v<SegmentType, FixedStringDictionarySegment<T>>) return;
 #endif
 
+#ifdef HYRISE_ERASE_FRONTCODEDDICTIONARY
+          if constexpr (std::is_same_v<SegmentType, FrontCodedDictionarySegment<T>>) return;
+#endif
+
 #ifdef HYRISE_ERASE_FRAMEOFREFERENCE
           if constexpr (std::is_same_v<T, int32_t>) {
             if constexpr (std::is_same_v<SegmentType, FrameOfReferenceSegment<T>>) return;
           }
 #endif
 
+#ifdef HYRISE_ERASE_FSST
+          if constexpr (std::is_same_v<SegmentType, FSSTSegment<T>>) return;
+#endif
+
           // Always erase LZ4Segment accessors
           if constexpr (std::is_same_v<SegmentType, LZ4Segment<T>>) return;
 
@@ -28,17 +28,22 @@ std::unique_ptr<AbstractSegmentAccessor<T>> CreateSegmentAccessor<T>::create(
           // virtual method calls later.
           resolve_segment_type<T>(*referenced_segment, [&](const auto& typed_referenced_segment) {
             using ReferencedSegment = std::decay_t<decltype(typed_referenced_segment)>;
-            if constexpr (!std::is_same_v<ReferencedSegment, ReferenceSegment>) {
+            if constexpr (std::is_same_v<ReferencedSegment, ReferenceSegment>) {
+              Fail("Encountered nested ReferenceSegments");
+            } else if constexpr (std::is_same_v<ReferencedSegment, VersionedSegment<T>>) {
+              // The accessor of the VersionedSegment resolves its main segment only once
+              accessor = std::make_unique<MultipleChunkReferenceSegmentAccessor<T>>(typed_segment);
+            } else {
               accessor = std::make_unique<SingleChunkReferenceSegmentAccessor<T, ReferencedSegment>>(
                   pos_list, chunk_id, typed_referenced_segment);
-            } else {
-              Fail("Encountered nested ReferenceSegments");
             }
           });
         }
       } else {
         accessor = std::make_unique<MultipleChunkReferenceSegmentAccessor<T>>(typed_segment);
       }
+    } else if constexpr (std::is_same_v<SegmentType, VersionedSegment<T>>) {
+      accessor = std::make_unique<VersionedSegmentAccessor<T>>(typed_segment);
     } else {
       accessor = std::make_unique<SegmentAccessor<T, SegmentType>>(typed_segment);
     }
@@ -6,6 +6,7 @@
 
 #include "storage/base_segment_accessor.hpp"
 #include "storage/dictionary_segment.hpp"
+#include "storage/versioned_segment.hpp"
 #include "types.hpp"
 #include "utils/performance_warning.hpp"
 
@@ -122,6 +123,27 @@ class SingleChunkReferenceSegmentAccessor final : public AbstractSegmentAccessor
   const Segment& _segment;
 };
 
+// Accessor for VersionedSegments. The main segment is resolved only once by using its accessor for all rows without a
+// patch.
+template <typename T>
+class VersionedSegmentAccessor final : public AbstractSegmentAccessor<T> {
+ public:
+  explicit VersionedSegmentAccessor(const VersionedSegment<T>& segment)
+      : _segment{segment}, _main_segment_accessor{create_segment_accessor<T>(segment.main_segment())} {}
+
+  const std::optional<T> access(ChunkOffset offset) const final {
+    const auto index = _segment.patch_index(offset);
+    if (!index) return _main_segment_accessor->access(offset);
+
+    if (_segment.patched_null_values()[*index]) return std::nullopt;
+    return _segment.patched_values()[*index];
+  }
+
+ protected:
+  const VersionedSegment<T>& _segment;
+  const std::unique_ptr<AbstractSegmentAccessor<T>> _main_segment_accessor;
+};
+
 // Accessor for ReferenceSegments that reference only NULL values
 template <typename T>
 class NullAccessor final : public AbstractSegmentAccessor<T> {
@@ -13,6 +13,7 @@
 #include "scheduler/job_task.hpp"
 #include "statistics/generate_pruning_statistics.hpp"
 #include "statistics/table_statistics.hpp"
+#include "storage/materialized_view.hpp"
 #include "utils/assert.hpp"
 #include "utils/meta_table_manager.hpp"
 
@@ -44,6 +45,8 @@ void StorageManager::add_table(const std::string& name, std::shared_ptr<Table> t
 void StorageManager::drop_table(const std::string& name) {
   const auto table_iter = _tables.find(name);
   Assert(table_iter != _tables.end() && table_iter->second, "Error deleting table. No such table named '" + name + "'");
+  Assert(!has_materialized_view(name),
+         "Cannot delete table " + name + " - it stores a materialized view, drop the view instead");
 
   // The concurrent_unordered_map does not support concurrency-safe erasure. Thus, we simply reset the table pointer.
   _tables[name] = nullptr;
@@ -133,6 +136,74 @@ const tbb::concurrent_unordered_map<std::string, std::shared_ptr<LQPView>>& Stor
   return _views;
 }
 
+void StorageManager::add_materialized_view(const std::string& name, const std::shared_ptr<LQPView>& view) {
+  Assert(!has_materialized_view(name),
+         "Cannot add materialized view " + name + " - a materialized view with the same name already exists");
+
+  const auto materialized_view = std::make_shared<MaterializedView>(name, view);
+
+  // Checks that neither a table nor a view with the same name exist
+  add_table(name, materialized_view->table());
+  _materialized_views[name] = materialized_view;
+
+  materialized_view->refresh();
+  materialized_view->table()->set_table_statistics(TableStatistics::from_table(*materialized_view->table()));
+}
+
+void StorageManager::drop_materialized_view(const std::string& name) {
+  const auto view_iter = _materialized_views.find(name);
+  Assert(view_iter != _materialized_views.end() && view_iter->second,
+         "Error deleting materialized view. No such materialized view named '" + name + "'");
+
+  _materialized_views[name] = nullptr;
+  drop_table(name);
+}
+
+std::shared_ptr<MaterializedView> StorageManager::get_materialized_view(const std::string& name) const {
+  const auto view_iter = _materialized_views.find(name);
+  Assert(view_iter != _materialized_views.end(), "No such materialized view named '" + name + "'");
+
+  const auto materialized_view = view_iter->second;
+  Assert(materialized_view, "Nullptr found when accessing materialized view named '" + name +
+                                "'. This can happen if a dropped materialized view is accessed.");
+
+  return materialized_view;
+}
+
+bool StorageManager::has_materialized_view(const std::string& name) const {
+  const auto view_iter = _materialized_views.find(name);
+  return view_iter != _materialized_views.end() && view_iter->second;
+}
+
+std::vector<std::string> StorageManager::materialized_view_names() const {
+  std::vector<std::string> materialized_view_names;
+  materialized_view_names.reserve(_materialized_views.size());
+
+  for (const auto& materialized_view_item : _materialized_views) {
+    if (!materialized_view_item.second) continue;
+
+    materialized_view_names.emplace_back(materialized_view_item.first);
+  }
+
+  return materialized_view_names;
+}
+
+const tbb::concurrent_unordered_map<std::string, std::shared_ptr<MaterializedView>>&
+StorageManager::materialized_views() const {
+  return _materialized_views;
+}
+
+void StorageManager::maintain_materialized_views() const {
+  // Maintaining a view commits changes to its table, which must not trigger another maintenance
+  if (MaterializedView::is_maintaining()) return;
+
+  for (const auto& [_, materialized_view] : _materialized_views) {
+    if (!materialized_view) continue;
+
+    materialized_view->schedule_maintenance();
+  }
+}
+
 void StorageManager::add_prepared_plan(const std::string& name, const std::shared_ptr<PreparedPlan>& prepared_plan) {
   const auto iter = _prepared_plans.find(name);
   Assert(iter == _prepared_plans.end() || !iter->second,
@@ -213,6 +284,14 @@ std::ostream& operator<<(std::ostream& stream, const StorageManager& storage_man
     stream << std::endl;
   }
 
+  stream << "==================" << std::endl;
+  stream << "= MaterializedViews" << std::endl << std::endl;
+
+  for (auto const& materialized_view : storage_manager.materialized_views()) {
+    stream << "==== materialized view >> " << materialized_view.first << " <<";
+    stream << std::endl;
+  }
+
   stream << "==================" << std::endl;
   stream << "= PreparedPlans ==" << std::endl << std::endl;
 
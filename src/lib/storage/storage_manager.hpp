@@ -17,6 +17,7 @@ namespace opossum {
 
 class Table;
 class AbstractLQPNode;
+class MaterializedView;
 
 // The StorageManager is a class that maintains all tables
 // by mapping table names to table instances.
@@ -46,6 +47,23 @@ class StorageManager : public Noncopyable {
   const tbb::concurrent_unordered_map<std::string, std::shared_ptr<LQPView>>& views() const;
   /** @} */
 
+  /**
+   * @defgroup Manage materialized views, this is only thread-safe for operations on views with different names. The
+   * contents of a materialized view are stored as a table with the name of the view (see MaterializedView).
+   * @{
+   */
+  void add_materialized_view(const std::string& name, const std::shared_ptr<LQPView>& view);
+  void drop_materialized_view(const std::string& name);
+  std::shared_ptr<MaterializedView> get_materialized_view(const std::string& name) const;
+  bool has_materialized_view(const std::string& name) const;
+  std::vector<std::string> materialized_view_names() const;
+  const tbb::concurrent_unordered_map<std::string, std::shared_ptr<MaterializedView>>& materialized_views() const;
+
+  // Schedules the maintenance of all materialized views, see MaterializedView::schedule_maintenance(). Called by
+  // TransactionContext::commit().
+  void maintain_materialized_views() const;
+  /** @} */
+
   /**
    * @defgroup Manage prepared plans - comparable to SQL PREPAREd statements, this is only thread-safe for operations on prepared plans with different names
    * @{
@@ -69,6 +87,8 @@ class StorageManager : public Noncopyable {
 
   tbb::concurrent_unordered_map<std::string, std::shared_ptr<Table>> _tables{_INITIAL_MAP_SIZE};
   tbb::concurrent_unordered_map<std::string, std::shared_ptr<LQPView>> _views{_INITIAL_MAP_SIZE};
+  tbb::concurrent_unordered_map<std::string, std::shared_ptr<MaterializedView>> _materialized_views{
+      _INITIAL_MAP_SIZE};
   tbb::concurrent_unordered_map<std::string, std::shared_ptr<PreparedPlan>> _prepared_plans{_INITIAL_MAP_SIZE};
 };
 
@@ -12,6 +12,7 @@
 #include "resolve_type.hpp"
 #include "statistics/attribute_statistics.hpp"
 #include "statistics/table_statistics.hpp"
+#include "storage/index/table_hash/table_hash_index.hpp"
 #include "storage/segment_iterate.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
@@ -67,6 +68,14 @@ TableType Table::type() const { return _type; }
 
 UseMvcc Table::uses_mvcc() const { return _use_mvcc; }
 
+void Table::set_allow_in_place_updates(const bool allow_in_place_updates) {
+  Assert(!allow_in_place_updates || (_type == TableType::Data && _use_mvcc == UseMvcc::Yes),
+         "In-place updates require a data table with MVCC");
+  _allow_in_place_updates = allow_in_place_updates;
+}
+
+bool Table::allows_in_place_updates() const { return _allow_in_place_updates; }
+
 ColumnCount Table::column_count() const {
   return ColumnCount{static_cast<ColumnCount::base_type>(_column_definitions.size())};
 }
@@ -132,6 +141,10 @@ void Table::append(const std::vector<AllTypeVariant>& values) {
   }
 
   last_chunk->append(values);
+
+  for (const auto& table_hash_index : _table_hash_indexes) {
+    table_hash_index->insert_rows(*last_chunk, ChunkID{chunk_count() - 1}, last_chunk->size() - 1, last_chunk->size());
+  }
 }
 
 void Table::append_mutable_chunk() {
@@ -223,6 +236,14 @@ void Table::remove_chunk(ChunkID chunk_id) {
               }()),
               "Physical delete of chunk prevented: Chunk needs to be fully invalidated before.");
   Assert(_type == TableType::Data, "Removing chunks from other tables than data tables is not intended yet.");
+
+  if (!_table_hash_indexes.empty()) {
+    const auto chunk = get_chunk(chunk_id);
+    for (const auto& table_hash_index : _table_hash_indexes) {
+      table_hash_index->remove_rows(*chunk, chunk_id, ChunkOffset{0}, chunk->size());
+    }
+  }
+
   std::atomic_store(&_chunks[chunk_id], std::shared_ptr<Chunk>(nullptr));
 }
 
@@ -256,7 +277,16 @@ void Table::append_chunk(const Segments& segments, std::shared_ptr<MvccData> mvc
   // making sure that an uninitialized entry compares equal to nullptr and (2) insert the desired chunk atomically.
 
   auto new_chunk_iter = _chunks.push_back(nullptr);
-  std::atomic_store(&*new_chunk_iter, std::make_shared<Chunk>(segments, mvcc_data, alloc));
+  const auto chunk = std::make_shared<Chunk>(segments, mvcc_data, alloc);
+  std::atomic_store(&*new_chunk_iter, chunk);
+
+  // Rows that are added to the chunk later on are indexed by whoever appends them (e.g., the Insert operator)
+  if (!_table_hash_indexes.empty() && chunk->size() > 0) {
+    const auto chunk_id = ChunkID{static_cast<ChunkID::base_type>(std::distance(_chunks.begin(), new_chunk_iter))};
+    for (const auto& table_hash_index : _table_hash_indexes) {
+      table_hash_index->insert_rows(*chunk, chunk_id, ChunkOffset{0}, chunk->size());
+    }
+  }
 }
 
 std::vector<AllTypeVariant> Table::get_row(size_t row_idx) const {
@@ -323,11 +353,91 @@ void Table::set_table_statistics(const std::shared_ptr<TableStatistics>& table_s
 
 std::vector<IndexStatistics> Table::indexes_statistics() const { return _indexes; }
 
-const std::vector<TableConstraintDefinition>& Table::get_soft_unique_constraints() const {
+std::shared_ptr<TableHashIndex> Table::create_table_hash_index(const std::vector<ColumnID>& column_ids,
+                                                               const std::string& name) {
+  Assert(_type == TableType::Data, "TableHashIndexes can only be created on data tables.");
+  Assert(!get_table_hash_index(column_ids), "A TableHashIndex on these columns already exists.");
+
+  auto data_types = std::vector<DataType>{};
+  data_types.reserve(column_ids.size());
+  for (const auto column_id : column_ids) {
+    Assert(column_id < column_count(), "ColumnID out of range");
+    data_types.emplace_back(column_data_type(column_id));
+  }
+
+  const auto table_hash_index = std::make_shared<TableHashIndex>(column_ids, data_types, name);
+
+  const auto chunk_count = _chunks.size();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    table_hash_index->insert_rows(*chunk, chunk_id, ChunkOffset{0}, chunk->size());
+  }
+
+  _table_hash_indexes.emplace_back(table_hash_index);
+  return table_hash_index;
+}
+
+std::shared_ptr<TableHashIndex> Table::get_table_hash_index(const std::vector<ColumnID>& column_ids) const {
+  for (const auto& table_hash_index : _table_hash_indexes) {
+    if (table_hash_index->column_ids() == column_ids) return table_hash_index;
+  }
+  return nullptr;
+}
+
+const std::vector<std::shared_ptr<TableHashIndex>>& Table::table_hash_indexes() const { return _table_hash_indexes; }
+
+const std::vector<TableConstraintDefinition>& Table::get_unique_constraints() const {
   return _constraint_definitions;
 }
 
 void Table::add_soft_unique_constraint(const std::vector<ColumnID>& column_ids, const IsPrimaryKey is_primary_key) {
+  _add_unique_constraint(column_ids, is_primary_key, IsEnforced::No);
+}
+
+void Table::add_unique_constraint(const std::vector<ColumnID>& column_ids, const IsPrimaryKey is_primary_key) {
+  Assert(_use_mvcc == UseMvcc::Yes, "Enforced constraints require MVCC data");
+
+  auto sorted_column_ids = column_ids;
+  std::sort(sorted_column_ids.begin(), sorted_column_ids.end());
+  for (const auto& column_id : sorted_column_ids) {
+    Assert(column_id < column_count(), "ColumnID out of range");
+  }
+
+  auto table_hash_index = get_table_hash_index(sorted_column_ids);
+  if (!table_hash_index) table_hash_index = create_table_hash_index(sorted_column_ids);
+
+  // Make sure that the rows that are not deleted already satisfy the constraint
+  const auto is_deleted = [&](const RowID& row_id) {
+    const auto chunk = get_chunk(row_id.chunk_id);
+    return !chunk || chunk->mvcc_data()->get_end_cid(row_id.chunk_offset) != MvccData::MAX_COMMIT_ID;
+  };
+
+  const auto chunk_count = _chunks.size();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    const auto chunk_size = chunk->size();
+    const auto keys = table_hash_index->materialize_keys(*chunk, ChunkOffset{0}, chunk_size);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      // Rows with NULL values are neither indexed nor constrained
+      const auto& key = keys[chunk_offset];
+      if (!key || is_deleted(RowID{chunk_id, chunk_offset})) continue;
+
+      const auto matches = table_hash_index->lookup(*key);
+      const auto live_match_count = std::count_if(matches.begin(), matches.end(),
+                                                  [&](const auto& match) { return !is_deleted(match); });
+      Assert(live_match_count <= 1, "Existing data violates the unique constraint");
+    }
+  }
+
+  _add_unique_constraint(sorted_column_ids, is_primary_key, IsEnforced::Yes);
+}
+
+void Table::_add_unique_constraint(const std::vector<ColumnID>& column_ids, const IsPrimaryKey is_primary_key,
+                                   const IsEnforced is_enforced) {
   for (const auto& column_id : column_ids) {
     Assert(column_id < column_count(), "ColumnID out of range");
     Assert(is_primary_key == IsPrimaryKey::No || !column_is_nullable(column_id),
@@ -345,7 +455,7 @@ void Table::add_soft_unique_constraint(const std::vector<ColumnID>& column_ids,
 
     auto sorted_columns_ids = column_ids;
     std::sort(sorted_columns_ids.begin(), sorted_columns_ids.end());
-    TableConstraintDefinition new_constraint{sorted_columns_ids, is_primary_key};
+    TableConstraintDefinition new_constraint{sorted_columns_ids, is_primary_key, is_enforced};
 
     Assert(std::find_if(_constraint_definitions.begin(), _constraint_definitions.end(),
                         [&new_constraint](const auto& existing_constraint) {
@@ -372,10 +482,22 @@ size_t Table::memory_usage(const MemoryUsageCalculationMode mode) const {
     bytes += column_definition.name.size();
   }
 
+  for (const auto& table_hash_index : _table_hash_indexes) {
+    bytes += table_hash_index->memory_usage();
+  }
+
   // TODO(anybody) Statistics and Indexes missing from Memory Usage Estimation
   // TODO(anybody) TableLayout missing
 
   return bytes;
 }
 
+CommitID Table::last_commit_id() const { return _last_commit_id.load(); }
+
+void Table::update_last_commit_id(const CommitID commit_id) const {
+  // Transactions may commit their records out of order, so only ever increase the CommitID
+  auto last_commit_id = _last_commit_id.load();
+  while (last_commit_id < commit_id && !_last_commit_id.compare_exchange_weak(last_commit_id, commit_id)) {}
+}
+
 }  // namespace opossum
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -18,6 +19,7 @@
 
 namespace opossum {
 
+class TableHashIndex;
 class TableStatistics;
 
 /**
@@ -65,6 +67,11 @@ class Table : private Noncopyable {
 
   UseMvcc uses_mvcc() const;
 
+  // Allows the Update operator to update fixed-width values in place (see ColumnVersionStore) instead of deleting and
+  // re-inserting the updated rows. Disabled by default.
+  void set_allow_in_place_updates(const bool allow_in_place_updates);
+  bool allows_in_place_updates() const;
+
   // For data tables, returns the target chunk size (i.e., the number of rows pre-allocated in the ValueSegment).
   ChunkOffset target_chunk_size() const;
 
@@ -196,6 +203,18 @@ class Table : private Noncopyable {
     _indexes.emplace_back(index_statistics);
   }
 
+  /**
+   * Create a TableHashIndex over the given columns (in this order) that covers all existing and future rows of this
+   * table. See TableHashIndex for details. Like create_index, this must not be called while the table is modified
+   * concurrently.
+   */
+  std::shared_ptr<TableHashIndex> create_table_hash_index(const std::vector<ColumnID>& column_ids,
+                                                          const std::string& name = "");
+
+  // Returns the TableHashIndex over exactly the given columns (in this order) or nullptr if there is none.
+  std::shared_ptr<TableHashIndex> get_table_hash_index(const std::vector<ColumnID>& column_ids) const;
+  const std::vector<std::shared_ptr<TableHashIndex>>& table_hash_indexes() const;
+
   /**
    * Add a unique constraint. The column IDs can be passed in an arbitrary order, they will be sorted
    * by this method. Constraint column IDs will always be sorted from here on.
@@ -203,14 +222,36 @@ class Table : private Noncopyable {
    * We call them "soft" constraints to draw attention to that.
    */
   void add_soft_unique_constraint(const std::vector<ColumnID>& column_ids, const IsPrimaryKey is_primary_key);
-  const std::vector<TableConstraintDefinition>& get_soft_unique_constraints() const;
+
+  /**
+   * Add an enforced unique constraint. It is backed by a TableHashIndex over the (sorted) columns, which is created if
+   * it does not exist yet. The existing rows have to satisfy the constraint. Afterwards, the Insert operator (and thus
+   * Update) fails the transaction if it would violate the constraint. Like create_table_hash_index, this must not be
+   * called while the table is modified concurrently.
+   */
+  void add_unique_constraint(const std::vector<ColumnID>& column_ids, const IsPrimaryKey is_primary_key);
+
+  // Returns both soft and enforced unique constraints
+  const std::vector<TableConstraintDefinition>& get_unique_constraints() const;
 
   /**
    * For debugging purposes, makes an estimation about the memory used by this Table (including Chunk and Segments)
    */
   size_t memory_usage(const MemoryUsageCalculationMode mode) const;
 
+  /**
+   * The CommitID of the most recent transaction that inserted, deleted, or updated rows of this table, i.e., the
+   * version of the table's data. A result computed in a snapshot that is at least this CommitID is up to date. Rows
+   * appended without a transaction (e.g., via append()) are not tracked.
+   * (update_last_commit_id() is marked as const, as otherwise it could not be called by the Delete operator.)
+   */
+  CommitID last_commit_id() const;
+  void update_last_commit_id(const CommitID commit_id) const;
+
  protected:
+  void _add_unique_constraint(const std::vector<ColumnID>& column_ids, const IsPrimaryKey is_primary_key,
+                              const IsEnforced is_enforced);
+
   const TableColumnDefinitions _column_definitions;
   const TableType _type;
   const UseMvcc _use_mvcc;
@@ -232,9 +273,13 @@ class Table : private Noncopyable {
   std::shared_ptr<TableStatistics> _table_statistics;
   std::unique_ptr<std::mutex> _append_mutex;
   std::vector<IndexStatistics> _indexes;
+  std::vector<std::shared_ptr<TableHashIndex>> _table_hash_indexes;
+  bool _allow_in_place_updates = false;
 
   // For tables with _type==Reference, the row count will not vary. As such, there is no need to iterate over all
   // chunks more than once.
   mutable std::optional<uint64_t> _cached_row_count;
+
+  mutable std::atomic<CommitID> _last_commit_id{0};
 };
 }  // namespace opossum
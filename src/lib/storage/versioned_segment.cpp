@@ -0,0 +1,113 @@
+#include "versioned_segment.hpp"
+
+#include <climits>
+#include <memory>
+#include <optional>
+#include <utility>
+
+#include "resolve_type.hpp"
+#include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
+#include "utils/size_estimation_utils.hpp"
+
+namespace opossum {
+
+template <typename T>
+VersionedSegment<T>::VersionedSegment(const std::shared_ptr<const BaseSegment>& main_segment,
+                                      pmr_vector<ChunkOffset>&& patched_offsets, pmr_vector<T>&& patched_values,
+                                      pmr_vector<bool>&& patched_null_values)
+    : BaseSegment(data_type_from_type<T>()),
+      _main_segment(main_segment),
+      _patched_offsets(std::move(patched_offsets)),
+      _patched_values(std::move(patched_values)),
+      _patched_null_values(std::move(patched_null_values)) {
+  Assert(_main_segment->data_type() == data_type(), "Main segment has a different data type");
+  Assert(!std::dynamic_pointer_cast<const ReferenceSegment>(_main_segment) &&
+             !std::dynamic_pointer_cast<const VersionedSegment<T>>(_main_segment),
+         "Main segment must be a segment of a stored table");
+  Assert(_patched_offsets.size() == _patched_values.size() && _patched_offsets.size() == _patched_null_values.size(),
+         "Expected a value and a NULL flag for each patched offset");
+  DebugAssert(std::adjacent_find(_patched_offsets.cbegin(), _patched_offsets.cend(),
+                                 std::greater_equal<ChunkOffset>{}) == _patched_offsets.cend(),
+              "Expected sorted and unique patched offsets");
+}
+
+template <typename T>
+const std::shared_ptr<const BaseSegment>& VersionedSegment<T>::main_segment() const {
+  return _main_segment;
+}
+
+template <typename T>
+const pmr_vector<ChunkOffset>& VersionedSegment<T>::patched_offsets() const {
+  return _patched_offsets;
+}
+
+template <typename T>
+const pmr_vector<T>& VersionedSegment<T>::patched_values() const {
+  return _patched_values;
+}
+
+template <typename T>
+const pmr_vector<bool>& VersionedSegment<T>::patched_null_values() const {
+  return _patched_null_values;
+}
+
+template <typename T>
+AllTypeVariant VersionedSegment<T>::operator[](const ChunkOffset chunk_offset) const {
+  PerformanceWarning("operator[] used");
+
+  const auto index = patch_index(chunk_offset);
+  if (!index) return (*_main_segment)[chunk_offset];
+
+  if (_patched_null_values[*index]) return NULL_VALUE;
+  return _patched_values[*index];
+}
+
+template <typename T>
+std::optional<T> VersionedSegment<T>::get_typed_value(const ChunkOffset chunk_offset) const {
+  const auto index = patch_index(chunk_offset);
+  if (index) {
+    if (_patched_null_values[*index]) return std::nullopt;
+    return _patched_values[*index];
+  }
+
+  auto value = std::optional<T>{};
+  resolve_segment_type<T>(*_main_segment, [&](const auto& typed_segment) {
+    using SegmentType = std::decay_t<decltype(typed_segment)>;
+    if constexpr (std::is_same_v<SegmentType, ReferenceSegment>) {
+      Fail("Main segment must be a segment of a stored table");
+    } else {
+      value = typed_segment.get_typed_value(chunk_offset);
+    }
+  });
+  return value;
+}
+
+template <typename T>
+ChunkOffset VersionedSegment<T>::size() const {
+  return _main_segment->size();
+}
+
+template <typename T>
+std::shared_ptr<BaseSegment> VersionedSegment<T>::copy_using_allocator(
+    const PolymorphicAllocator<size_t>& alloc) const {
+  // Like ReferenceSegments, VersionedSegments are intermediate data structures and are therefore not subject to
+  // NUMA-aware chunk migrations.
+  Fail("Cannot migrate a VersionedSegment");
+}
+
+template <typename T>
+size_t VersionedSegment<T>::memory_usage(const MemoryUsageCalculationMode mode) const {
+  auto bytes = sizeof(*this) + _patched_offsets.capacity() * sizeof(ChunkOffset) +
+               _patched_null_values.capacity() / CHAR_BIT;
+
+  if constexpr (std::is_same_v<T, pmr_string>) {  // NOLINT
+    return bytes + string_vector_memory_usage(_patched_values, mode);
+  }
+
+  return bytes + _patched_values.capacity() * sizeof(T);
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(VersionedSegment);
+
+}  // namespace opossum
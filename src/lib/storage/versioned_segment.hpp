@@ -0,0 +1,61 @@
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+
+#include "base_segment.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * A VersionedSegment is the view of a transaction on a segment with values that were updated in place (see
+ * ColumnVersionStore). It overlays the values that are visible to the transaction (the patches) on the main segment of
+ * the stored chunk. Neither the main segment nor its encoding is copied, so reading a few updated rows of an encoded
+ * segment remains cheap. VersionedSegments are created by GetTable and, like ReferenceSegments, are only part of
+ * intermediate tables.
+ */
+template <typename T>
+class VersionedSegment : public BaseSegment {
+ public:
+  // The patched offsets must be sorted and unique. If a patched value is NULL, the corresponding entry in
+  // patched_values is ignored.
+  VersionedSegment(const std::shared_ptr<const BaseSegment>& main_segment, pmr_vector<ChunkOffset>&& patched_offsets,
+                   pmr_vector<T>&& patched_values, pmr_vector<bool>&& patched_null_values);
+
+  const std::shared_ptr<const BaseSegment>& main_segment() const;
+  const pmr_vector<ChunkOffset>& patched_offsets() const;
+  const pmr_vector<T>& patched_values() const;
+  const pmr_vector<bool>& patched_null_values() const;
+
+  // Returns the index of the patch for the given offset in the main segment or std::nullopt if the offset has none
+  std::optional<size_t> patch_index(const ChunkOffset chunk_offset) const {
+    // performance critical - not in cpp to help with inlining
+    const auto patched_offsets_iter =
+        std::lower_bound(_patched_offsets.cbegin(), _patched_offsets.cend(), chunk_offset);
+    if (patched_offsets_iter == _patched_offsets.cend() || *patched_offsets_iter != chunk_offset) return std::nullopt;
+    return std::distance(_patched_offsets.cbegin(), patched_offsets_iter);
+  }
+
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
+
+  // Resolves the main segment for each access. Use a SegmentAccessor (see create_segment_accessor) instead for
+  // repeated accesses.
+  std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const;
+
+  ChunkOffset size() const final;
+
+  std::shared_ptr<BaseSegment> copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const final;
+
+  // Only the patches are accounted for, as the main segment belongs to the stored table
+  size_t memory_usage(const MemoryUsageCalculationMode mode) const final;
+
+ protected:
+  const std::shared_ptr<const BaseSegment> _main_segment;
+  const pmr_vector<ChunkOffset> _patched_offsets;
+  const pmr_vector<T> _patched_values;
+  const pmr_vector<bool> _patched_null_values;
+};
+
+}  // namespace opossum
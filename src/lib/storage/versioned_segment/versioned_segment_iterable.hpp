@@ -0,0 +1,104 @@
+#pragma once
+
+#include <memory>
+#include <type_traits>
+
+#include "storage/segment_iterables.hpp"
+#include "storage/segment_iterables/any_segment_iterable.hpp"
+
+#include "storage/versioned_segment.hpp"
+
+namespace opossum {
+
+/**
+ * Iterates over the main segment of a VersionedSegment and replaces the values of the patched rows. The main segment
+ * is iterated through an AnySegmentIterable, as VersionedSegments only exist for the few chunks with updated rows and
+ * resolving the main segment's iterable in here would multiply the number of template instantiations.
+ */
+template <typename T>
+class VersionedSegmentIterable : public PointAccessibleSegmentIterable<VersionedSegmentIterable<T>> {
+ public:
+  using ValueType = T;
+
+  explicit VersionedSegmentIterable(const VersionedSegment<T>& segment) : _segment{segment} {}
+
+  template <typename Functor>
+  void _on_with_iterators(const Functor& functor) const {
+    // The accesses are counted by the main segment's iterable
+    const auto main_iterable = create_any_segment_iterable<T>(*_segment.main_segment());
+    main_iterable.with_iterators([&](auto main_begin, auto main_end) {
+      using MainIterator = decltype(main_begin);
+
+      auto begin = Iterator<MainIterator>{_segment, std::move(main_begin), nullptr};
+      auto end = Iterator<MainIterator>{_segment, std::move(main_end), nullptr};
+      functor(begin, end);
+    });
+  }
+
+  template <typename Functor, typename PosListType>
+  void _on_with_iterators(const std::shared_ptr<PosListType>& position_filter, const Functor& functor) const {
+    const auto main_iterable = create_any_segment_iterable<T>(*_segment.main_segment());
+    main_iterable.with_iterators(position_filter, [&](auto main_begin, auto main_end) {
+      using MainIterator = decltype(main_begin);
+
+      auto begin = Iterator<MainIterator, PosListType>{_segment, std::move(main_begin), position_filter.get()};
+      auto end = Iterator<MainIterator, PosListType>{_segment, std::move(main_end), position_filter.get()};
+      functor(begin, end);
+    });
+  }
+
+  size_t _on_size() const { return _segment.size(); }
+
+ private:
+  const VersionedSegment<T>& _segment;
+
+ private:
+  // For point access, PosListType is the type of the position filter. The main iterator then yields the offsets in the
+  // position filter, which are translated into offsets in the main segment before looking up the patches.
+  template <typename MainIterator, typename PosListType = void>
+  class Iterator : public BaseSegmentIterator<Iterator<MainIterator, PosListType>, SegmentPosition<T>> {
+   public:
+    using ValueType = T;
+    using IterableType = VersionedSegmentIterable<T>;
+
+   public:
+    explicit Iterator(const VersionedSegment<T>& segment, MainIterator main_iterator,
+                      const PosListType* position_filter)
+        : _segment{&segment}, _main_iterator{std::move(main_iterator)}, _position_filter{position_filter} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    void increment() { ++_main_iterator; }
+
+    void decrement() { --_main_iterator; }
+
+    void advance(std::ptrdiff_t n) { _main_iterator += n; }
+
+    bool equal(const Iterator& other) const { return _main_iterator == other._main_iterator; }
+
+    std::ptrdiff_t distance_to(const Iterator& other) const { return other._main_iterator - _main_iterator; }
+
+    SegmentPosition<T> dereference() const {
+      const auto& position = *_main_iterator;
+
+      auto chunk_offset = position.chunk_offset();
+      if constexpr (!std::is_void_v<PosListType>) {
+        chunk_offset = (*_position_filter)[chunk_offset].chunk_offset;
+      }
+
+      const auto index = _segment->patch_index(chunk_offset);
+      if (!index) return SegmentPosition<T>{position.value(), position.is_null(), position.chunk_offset()};
+
+      return SegmentPosition<T>{_segment->patched_values()[*index], _segment->patched_null_values()[*index],
+                                position.chunk_offset()};
+    }
+
+   private:
+    const VersionedSegment<T>* _segment;
+    MainIterator _main_iterator;
+    const PosListType* _position_filter;
+  };
+};
+
+}  // namespace opossum
@@ -221,7 +221,8 @@ enum class DescriptionMode { SingleLine, MultiLine };
 
 enum class UseMvcc : bool { Yes = true, No = false };
 
-enum class RollbackReason : bool { User, Conflict };
+// OutOfMemory: A statement exceeded its memory limit (see MemoryTracker). Like conflicts, it is considered a failure.
+enum class RollbackReason : uint8_t { User, Conflict, OutOfMemory };
 
 enum class MemoryUsageCalculationMode { Sampled, Full };
 
@@ -0,0 +1,192 @@
+#include "hardware_counters.hpp"
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <iomanip>
+#include <utility>
+#include <vector>
+
+namespace opossum {
+
+namespace {
+
+std::atomic_bool counting_enabled{false};
+
+thread_local HardwareCounterScope* current_scope = nullptr;  // NOLINT
+
+#ifdef __linux__
+
+// The counters of the calling thread. They are opened as a group so that they are scheduled on the PMU together.
+class PerfEventGroup : private Noncopyable {
+ public:
+  PerfEventGroup() {
+    // PERF_COUNT_HW_CACHE_MISSES usually denotes last-level cache misses
+    const auto events = std::array<std::pair<uint64_t, uint64_t HardwareCounters::*>, 4>{
+        {{PERF_COUNT_HW_CPU_CYCLES, &HardwareCounters::cycles},
+         {PERF_COUNT_HW_INSTRUCTIONS, &HardwareCounters::instructions},
+         {PERF_COUNT_HW_CACHE_MISSES, &HardwareCounters::llc_misses},
+         {PERF_COUNT_HW_BRANCH_MISSES, &HardwareCounters::branch_misses}}};
+
+    for (const auto& [config, member] : events) {
+      auto attributes = perf_event_attr{};
+      attributes.size = sizeof(perf_event_attr);
+      attributes.type = PERF_TYPE_HARDWARE;
+      attributes.config = config;
+      attributes.exclude_kernel = 1;
+      attributes.exclude_hv = 1;
+      attributes.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+      // Measure the calling thread (pid 0) on any CPU (-1)
+      const auto group_fd = _fds.empty() ? -1 : _fds.front();
+      const auto fd = static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, group_fd, 0));
+      if (fd == -1) {
+        // Without the group leader (cycles), nothing can be measured
+        if (_fds.empty()) return;
+        continue;
+      }
+
+      _fds.emplace_back(fd);
+      _members.emplace_back(member);
+    }
+  }
+
+  ~PerfEventGroup() {
+    for (const auto fd : _fds) {
+      close(fd);
+    }
+  }
+
+  std::optional<HardwareCounters> read() const {
+    if (_fds.empty()) return std::nullopt;
+
+    // Layout for PERF_FORMAT_GROUP with both time fields: nr, time_enabled, time_running, values[nr]
+    auto buffer = std::array<uint64_t, 3 + 4>{};
+    const auto expected_size = static_cast<ssize_t>((3 + _members.size()) * sizeof(uint64_t));
+    if (::read(_fds.front(), buffer.data(), sizeof(buffer)) != expected_size) return std::nullopt;
+
+    // If more events are open than the PMU can count, the kernel multiplexes them. Extrapolate to the full time.
+    const auto time_enabled = buffer[1];
+    const auto time_running = buffer[2];
+    const auto scale = time_running > 0 && time_running < time_enabled
+                           ? static_cast<double>(time_enabled) / static_cast<double>(time_running)
+                           : 1.0;
+
+    auto counters = HardwareCounters{};
+    for (auto member_index = size_t{0}; member_index < _members.size(); ++member_index) {
+      counters.*_members[member_index] = static_cast<uint64_t>(static_cast<double>(buffer[3 + member_index]) * scale);
+    }
+    return counters;
+  }
+
+ private:
+  std::vector<int> _fds;
+  // The counter that each opened event is stored in, in the order of _fds
+  std::vector<uint64_t HardwareCounters::*> _members;
+};
+
+#endif
+
+}  // namespace
+
+HardwareCounters& HardwareCounters::operator+=(const HardwareCounters& rhs) {
+  cycles += rhs.cycles;
+  instructions += rhs.instructions;
+  llc_misses += rhs.llc_misses;
+  branch_misses += rhs.branch_misses;
+  return *this;
+}
+
+HardwareCounters HardwareCounters::operator-(const HardwareCounters& rhs) const {
+  // Counters only grow, but extrapolated values of multiplexed counters might not. Saturate instead of wrapping around.
+  const auto saturating_subtract = [](const uint64_t lhs, const uint64_t rhs) { return lhs > rhs ? lhs - rhs : 0; };
+
+  return HardwareCounters{saturating_subtract(cycles, rhs.cycles), saturating_subtract(instructions, rhs.instructions),
+                          saturating_subtract(llc_misses, rhs.llc_misses),
+                          saturating_subtract(branch_misses, rhs.branch_misses)};
+}
+
+bool HardwareCounters::operator==(const HardwareCounters& rhs) const {
+  return cycles == rhs.cycles && instructions == rhs.instructions && llc_misses == rhs.llc_misses &&
+         branch_misses == rhs.branch_misses;
+}
+
+double HardwareCounters::instructions_per_cycle() const {
+  if (cycles == 0) return 0.0;
+  return static_cast<double>(instructions) / static_cast<double>(cycles);
+}
+
+bool HardwareCounters::is_enabled() { return counting_enabled.load(std::memory_order_relaxed); }
+
+void HardwareCounters::set_enabled(const bool enabled) { counting_enabled = enabled; }
+
+std::optional<HardwareCounters> HardwareCounters::read() {
+#ifdef __linux__
+  thread_local const PerfEventGroup perf_event_group;
+  return perf_event_group.read();
+#else
+  return std::nullopt;
+#endif
+}
+
+std::ostream& operator<<(std::ostream& stream, const HardwareCounters& counters) {
+  const auto flags = stream.flags();
+  const auto precision = stream.precision();
+
+  stream << counters.cycles << " cycles, " << counters.instructions << " instructions (" << std::fixed
+         << std::setprecision(2) << counters.instructions_per_cycle() << " IPC), " << counters.llc_misses
+         << " LLC misses, " << counters.branch_misses << " branch misses";
+
+  stream.flags(flags);
+  stream.precision(precision);
+  return stream;
+}
+
+void HardwareCounterAccumulator::add(const HardwareCounters& counters) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (!_counters) _counters = HardwareCounters{};
+  *_counters += counters;
+}
+
+std::optional<HardwareCounters> HardwareCounterAccumulator::counters() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _counters;
+}
+
+HardwareCounterScope::HardwareCounterScope(const std::shared_ptr<HardwareCounterAccumulator>& accumulator) {
+  if (!accumulator || !HardwareCounters::is_enabled()) return;
+
+  const auto begin = HardwareCounters::read();
+  if (!begin) return;
+
+  _accumulator = accumulator;
+  _begin = *begin;
+  _parent = current_scope;
+  current_scope = this;
+}
+
+HardwareCounterScope::~HardwareCounterScope() {
+  if (!_accumulator) return;
+
+  current_scope = _parent;
+
+  // The counters of this thread were readable in the constructor and stay open
+  const auto end = HardwareCounters::read();
+  if (!end) return;
+
+  const auto total = *end - _begin;
+  _accumulator->add(total - _nested);
+  if (_parent) _parent->_nested += total;
+}
+
+std::shared_ptr<HardwareCounterAccumulator> HardwareCounterScope::current_accumulator() {
+  return current_scope ? current_scope->_accumulator : nullptr;
+}
+
+}  // namespace opossum
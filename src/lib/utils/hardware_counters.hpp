@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <ostream>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Hardware performance counters as measured by Linux' perf_event_open (user space only). Comparing instructions per
+ * cycle and the number of last-level cache misses helps to tell memory-bound from compute-bound operators.
+ *
+ * Counting is disabled by default. Once enabled via set_enabled(true), each thread lazily opens its counters the first
+ * time it measures something. If the counters cannot be opened (e.g., on non-Linux systems, in containers without
+ * access to the PMU, or due to /proc/sys/kernel/perf_event_paranoid), read() returns std::nullopt and nothing is
+ * attributed. Counters that are unsupported by the hardware (often LLC misses in VMs) remain 0.
+ */
+struct HardwareCounters {
+  uint64_t cycles{0};
+  uint64_t instructions{0};
+  uint64_t llc_misses{0};
+  uint64_t branch_misses{0};
+
+  HardwareCounters& operator+=(const HardwareCounters& rhs);
+  HardwareCounters operator-(const HardwareCounters& rhs) const;
+  bool operator==(const HardwareCounters& rhs) const;
+
+  // Instructions per cycle, 0 if no cycles were counted
+  double instructions_per_cycle() const;
+
+  static bool is_enabled();
+  static void set_enabled(const bool enabled);
+
+  // Returns the counters of the calling thread since it first opened them
+  static std::optional<HardwareCounters> read();
+};
+
+std::ostream& operator<<(std::ostream& stream, const HardwareCounters& counters);
+
+// Sums up the counters measured for one target (e.g., an operator) by potentially multiple threads
+class HardwareCounterAccumulator : private Noncopyable {
+ public:
+  void add(const HardwareCounters& counters);
+
+  // Returns std::nullopt if nothing was measured
+  std::optional<HardwareCounters> counters() const;
+
+ private:
+  mutable std::mutex _mutex;
+  std::optional<HardwareCounters> _counters;
+};
+
+/**
+ * Measures the counters of the calling thread during its lifetime and adds them to the given accumulator. Scopes
+ * nest: If a thread starts a new scope while another one is active (e.g., because a worker executes a JobTask of
+ * another operator while waiting), the counters of the inner scope are attributed to the inner accumulator only.
+ * Without an accumulator or if counting is disabled, the scope does nothing.
+ */
+class HardwareCounterScope : private Noncopyable {
+ public:
+  explicit HardwareCounterScope(const std::shared_ptr<HardwareCounterAccumulator>& accumulator);
+  ~HardwareCounterScope();
+
+  // The accumulator of the innermost active scope of the calling thread, if any. Used to attribute JobTasks to the
+  // operator that spawned them.
+  static std::shared_ptr<HardwareCounterAccumulator> current_accumulator();
+
+ private:
+  std::shared_ptr<HardwareCounterAccumulator> _accumulator;
+  HardwareCounterScope* _parent{nullptr};
+  HardwareCounters _begin;
+  HardwareCounters _nested;
+};
+
+}  // namespace opossum
@@ -1,10 +1,12 @@
 #include "meta_table_manager.hpp"
 
+#include "utils/meta_tables/meta_cardinality_feedback_table.hpp"
 #include "utils/meta_tables/meta_chunk_sort_orders_table.hpp"
 #include "utils/meta_tables/meta_chunks_table.hpp"
 #include "utils/meta_tables/meta_columns_table.hpp"
 #include "utils/meta_tables/meta_log_table.hpp"
 #include "utils/meta_tables/meta_plugins_table.hpp"
+#include "utils/meta_tables/meta_query_statistics_table.hpp"
 #include "utils/meta_tables/meta_segments_accurate_table.hpp"
 #include "utils/meta_tables/meta_segments_table.hpp"
 #include "utils/meta_tables/meta_settings_table.hpp"
@@ -25,7 +27,9 @@ MetaTableManager::MetaTableManager() {
                                                                        std::make_shared<MetaPluginsTable>(),
                                                                        std::make_shared<MetaSettingsTable>(),
                                                                        std::make_shared<MetaSystemInformationTable>(),
-                                                                       std::make_shared<MetaSystemUtilizationTable>()};
+                                                                       std::make_shared<MetaSystemUtilizationTable>(),
+                                                                       std::make_shared<MetaCardinalityFeedbackTable>(),
+                                                                       std::make_shared<MetaQueryStatisticsTable>()};
 
   _table_names.reserve(_meta_tables.size());
   for (const auto& table : meta_tables) {
@@ -0,0 +1,42 @@
+#include "meta_cardinality_feedback_table.hpp"
+
+#include <algorithm>
+
+#include "hyrise.hpp"
+#include "statistics/cardinality_feedback_store.hpp"
+
+namespace opossum {
+
+MetaCardinalityFeedbackTable::MetaCardinalityFeedbackTable()
+    : AbstractMetaTable(TableColumnDefinitions{{"signature", DataType::String, false},
+                                               {"observation_count", DataType::Long, false},
+                                               {"input_row_count", DataType::Long, false},
+                                               {"estimated_selectivity", DataType::Float, false},
+                                               {"actual_selectivity", DataType::Float, false},
+                                               {"q_error", DataType::Float, false}}) {}
+
+const std::string& MetaCardinalityFeedbackTable::name() const {
+  static const auto name = std::string{"cardinality_feedback"};
+  return name;
+}
+
+std::shared_ptr<Table> MetaCardinalityFeedbackTable::_on_generate() const {
+  auto output_table = std::make_shared<Table>(_column_definitions, TableType::Data, std::nullopt, UseMvcc::Yes);
+
+  const auto& cardinality_feedback_store = Hyrise::get().default_cardinality_feedback_store;
+  if (!cardinality_feedback_store) return output_table;
+
+  auto entries = cardinality_feedback_store->entries();
+  std::stable_sort(entries.begin(), entries.end(),
+                   [](const auto& lhs, const auto& rhs) { return lhs.q_error() > rhs.q_error(); });
+
+  for (const auto& entry : entries) {
+    output_table->append({pmr_string{entry.signature}, static_cast<int64_t>(entry.observation_count),
+                          static_cast<int64_t>(entry.input_cardinality), entry.estimated_selectivity,
+                          entry.actual_selectivity, entry.q_error()});
+  }
+
+  return output_table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "utils/meta_tables/abstract_meta_table.hpp"
+
+namespace opossum {
+
+/**
+ * This is a class for showing the selectivities recorded by the CardinalityFeedbackStore, together with the
+ * histogram-based estimations. The worst misestimations (i.e., the highest q-errors) come first.
+ */
+class MetaCardinalityFeedbackTable : public AbstractMetaTable {
+ public:
+  MetaCardinalityFeedbackTable();
+
+  const std::string& name() const final;
+
+ protected:
+  friend class MetaCardinalityFeedbackTest;
+  std::shared_ptr<Table> _on_generate() const final;
+};
+
+}  // namespace opossum
@@ -0,0 +1,69 @@
+#include "meta_query_statistics_table.hpp"
+
+#include <algorithm>
+
+#include "hyrise.hpp"
+#include "sql/query_statistics_store.hpp"
+
+namespace opossum {
+
+MetaQueryStatisticsTable::MetaQueryStatisticsTable()
+    : AbstractMetaTable(TableColumnDefinitions{{"normalized_sql", DataType::String, false},
+                                               {"calls", DataType::Long, false},
+                                               {"total_latency", DataType::Long, false},
+                                               {"mean_latency", DataType::Long, false},
+                                               {"max_latency", DataType::Long, false},
+                                               {"total_sql_translation", DataType::Long, false},
+                                               {"mean_sql_translation", DataType::Long, false},
+                                               {"max_sql_translation", DataType::Long, false},
+                                               {"total_optimization", DataType::Long, false},
+                                               {"mean_optimization", DataType::Long, false},
+                                               {"max_optimization", DataType::Long, false},
+                                               {"total_lqp_translation", DataType::Long, false},
+                                               {"mean_lqp_translation", DataType::Long, false},
+                                               {"max_lqp_translation", DataType::Long, false},
+                                               {"total_plan_execution", DataType::Long, false},
+                                               {"mean_plan_execution", DataType::Long, false},
+                                               {"max_plan_execution", DataType::Long, false},
+                                               {"rows_returned", DataType::Long, false},
+                                               {"query_plan_cache_hit_ratio", DataType::Float, false},
+                                               {"peak_intermediate_memory", DataType::Long, false}}) {}
+
+const std::string& MetaQueryStatisticsTable::name() const {
+  static const auto name = std::string{"query_statistics"};
+  return name;
+}
+
+std::shared_ptr<Table> MetaQueryStatisticsTable::_on_generate() const {
+  auto output_table = std::make_shared<Table>(_column_definitions, TableType::Data, std::nullopt, UseMvcc::Yes);
+
+  const auto& query_statistics_store = Hyrise::get().default_query_statistics_store;
+  if (!query_statistics_store) return output_table;
+
+  auto statistics = query_statistics_store->statistics();
+  std::sort(statistics.begin(), statistics.end(), [](const auto& lhs, const auto& rhs) {
+    return lhs.latency.total > rhs.latency.total ||
+           (lhs.latency.total == rhs.latency.total && lhs.normalized_sql < rhs.normalized_sql);
+  });
+
+  for (const auto& entry : statistics) {
+    auto values = std::vector<AllTypeVariant>{pmr_string{entry.normalized_sql}, static_cast<int64_t>(entry.calls)};
+    for (const auto* durations : {&entry.latency, &entry.sql_translation, &entry.optimization, &entry.lqp_translation,
+                                  &entry.plan_execution}) {
+      // Total, mean, and max of each phase
+      const auto total = static_cast<int64_t>(durations->total.count());
+      values.emplace_back(total);
+      values.emplace_back(total / static_cast<int64_t>(std::max(entry.calls, uint64_t{1})));
+      values.emplace_back(static_cast<int64_t>(durations->max.count()));
+    }
+    values.emplace_back(static_cast<int64_t>(entry.rows_returned));
+    values.emplace_back(entry.query_plan_cache_hit_ratio());
+    values.emplace_back(static_cast<int64_t>(entry.peak_intermediate_memory));
+
+    output_table->append(values);
+  }
+
+  return output_table;
+}
+
+}  // namespace opossum
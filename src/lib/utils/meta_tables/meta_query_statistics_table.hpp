@@ -0,0 +1,22 @@
+#pragma once
+
+#include "utils/meta_tables/abstract_meta_table.hpp"
+
+namespace opossum {
+
+/**
+ * This is a class for showing the execution statistics that the QueryStatisticsStore aggregated per normalized SQL
+ * string. Durations are given in nanoseconds. The statements with the highest total latency come first.
+ */
+class MetaQueryStatisticsTable : public AbstractMetaTable {
+ public:
+  MetaQueryStatisticsTable();
+
+  const std::string& name() const final;
+
+ protected:
+  friend class MetaQueryStatisticsTest;
+  std::shared_ptr<Table> _on_generate() const final;
+};
+
+}  // namespace opossum
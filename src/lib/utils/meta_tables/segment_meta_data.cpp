@@ -6,6 +6,7 @@
 #include "storage/create_iterable_from_segment.hpp"
 #include "storage/dictionary_segment.hpp"
 #include "storage/fixed_string_dictionary_segment.hpp"
+#include "storage/front_coded_dictionary_segment.hpp"
 
 namespace opossum {
 
@@ -69,6 +70,10 @@ size_t get_distinct_value_count(const std::shared_ptr<BaseSegment>& segment) {
                    std::dynamic_pointer_cast<const FixedStringDictionarySegment<pmr_string>>(segment)) {
       distinct_value_count = fs_dictionary_segment->fixed_string_dictionary()->size();
       return;
+    } else if (const auto fc_dictionary_segment =
+                   std::dynamic_pointer_cast<const FrontCodedDictionarySegment<pmr_string>>(segment)) {
+      distinct_value_count = fc_dictionary_segment->front_coded_dictionary()->size();
+      return;
     }
 
     std::unordered_set<ColumnDataType> distinct_values;
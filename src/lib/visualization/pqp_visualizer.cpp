@@ -173,6 +173,12 @@ void PQPVisualizer::_add_operator(const std::shared_ptr<const AbstractOperator>&
     auto total = performance_data.walltime;
     label += "\n\n" + format_duration(total);
     info.pen_width = static_cast<double>(total.count());
+
+    if (performance_data.hardware_counters) {
+      std::stringstream stream;
+      stream << *performance_data.hardware_counters;
+      label += "\n" + stream.str();
+    }
   } else {
     info.pen_width = 1.0;
   }
@@ -36,6 +36,8 @@ void MvccDeletePlugin::_logical_delete_loop() {
   // Check all tables
   for (auto& [table_name, table] : Hyrise::get().storage_manager.tables()) {
     if (table->empty() || table->uses_mvcc() != UseMvcc::Yes) continue;
+    _merge_column_versions(*table);
+
     size_t saved_memory = 0;
     size_t num_chunks = 0;
 
@@ -125,6 +127,24 @@ void MvccDeletePlugin::_physical_delete_loop() {
   }
 }
 
+size_t MvccDeletePlugin::_merge_column_versions(Table& table) {
+  // Versions committed up to this commit id are visible to all active and future transactions
+  const auto lowest_snapshot_commit_id = Hyrise::get().transaction_manager.get_lowest_snapshot_commit_id();
+
+  auto merged_version_count = size_t{0};
+  const auto chunk_count = table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    // Mutable chunks might still be written to by Insert, so their versions are only merged once they are finalized
+    if (!chunk || chunk->is_mutable() || !chunk->mvcc_data()->column_versions.has_versions()) continue;
+
+    merged_version_count +=
+        chunk->mvcc_data()->column_versions.merge(*chunk, table.column_data_types(), lowest_snapshot_commit_id);
+  }
+
+  return merged_version_count;
+}
+
 bool MvccDeletePlugin::_try_logical_delete(const std::string& table_name, const ChunkID chunk_id,
                                            std::shared_ptr<TransactionContext> transaction_context) {
   const auto& table = Hyrise::get().storage_manager.get_table(table_name);
@@ -26,6 +26,8 @@ namespace opossum {
  * recognizing chunks with high numbers of invalidated rows and fully invalidates them.
  * The physical delete checks if chunks are not visible anymore for other transactions and
  * removes the chunk from the table completely.
+ * Additionally, the logical delete loop merges values that were updated in place (see
+ * ColumnVersionStore) and are visible to all transactions back into the main segments.
  */
 class MvccDeletePlugin : public AbstractPlugin {
   friend class MvccDeletePluginTest;
@@ -60,6 +62,7 @@ class MvccDeletePlugin : public AbstractPlugin {
   static bool _try_logical_delete(const std::string& table_name, ChunkID chunk_id,
                                   std::shared_ptr<TransactionContext> transaction_context);
   static void _delete_chunk_physically(const std::shared_ptr<Table>& table, ChunkID chunk_id);
+  static size_t _merge_column_versions(Table& table);
 
   std::unique_ptr<PausableLoopThread> _loop_thread_logical_delete, _loop_thread_physical_delete;
 
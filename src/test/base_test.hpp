@@ -94,7 +94,10 @@ const SegmentEncodingSpec all_segment_encoding_specs[]{
     {EncodingType::Dictionary, VectorCompressionType::SimdBp128},
     {EncodingType::FixedStringDictionary, VectorCompressionType::FixedSizeByteAligned},
     {EncodingType::FixedStringDictionary, VectorCompressionType::SimdBp128},
+    {EncodingType::FrontCodedDictionary, VectorCompressionType::FixedSizeByteAligned},
+    {EncodingType::FrontCodedDictionary, VectorCompressionType::SimdBp128},
     {EncodingType::FrameOfReference},
     {EncodingType::LZ4},
-    {EncodingType::RunLength}};
+    {EncodingType::RunLength},
+    {EncodingType::FSST}};
 }  // namespace opossum
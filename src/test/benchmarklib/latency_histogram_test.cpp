@@ -0,0 +1,127 @@
+#include <thread>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "latency_histogram.hpp"
+
+namespace opossum {
+
+class LatencyHistogramTest : public BaseTest {};
+
+TEST_F(LatencyHistogramTest, Empty) {
+  const auto histogram = LatencyHistogram{};
+
+  EXPECT_EQ(histogram.count(), 0u);
+  EXPECT_EQ(histogram.mean(), Duration{0});
+  EXPECT_EQ(histogram.max(), Duration{0});
+  EXPECT_EQ(histogram.percentile(0.0), Duration{0});
+  EXPECT_EQ(histogram.percentile(99.9), Duration{0});
+  EXPECT_EQ(histogram.to_json()["count"], 0);
+  EXPECT_EQ(histogram.to_json()["p99"], 0);
+}
+
+TEST_F(LatencyHistogramTest, SmallValuesAreExact) {
+  auto histogram = LatencyHistogram{};
+  for (auto value = 1; value <= 100; ++value) {
+    histogram.record(std::chrono::nanoseconds{value});
+  }
+
+  EXPECT_EQ(histogram.count(), 100u);
+  EXPECT_EQ(histogram.mean(), std::chrono::nanoseconds{50});
+  EXPECT_EQ(histogram.max(), std::chrono::nanoseconds{100});
+  EXPECT_EQ(histogram.percentile(0.0), std::chrono::nanoseconds{1});
+  EXPECT_EQ(histogram.percentile(1.0), std::chrono::nanoseconds{1});
+  EXPECT_EQ(histogram.percentile(50.0), std::chrono::nanoseconds{50});
+  EXPECT_EQ(histogram.percentile(50.5), std::chrono::nanoseconds{51});
+  EXPECT_EQ(histogram.percentile(99.0), std::chrono::nanoseconds{99});
+  EXPECT_EQ(histogram.percentile(100.0), std::chrono::nanoseconds{100});
+
+  // Negative latencies are recorded as 0
+  histogram.record(std::chrono::nanoseconds{-5});
+  EXPECT_EQ(histogram.percentile(0.0), std::chrono::nanoseconds{0});
+
+  EXPECT_THROW(histogram.percentile(-1.0), std::logic_error);
+  EXPECT_THROW(histogram.percentile(100.1), std::logic_error);
+}
+
+TEST_F(LatencyHistogramTest, BucketBoundaries) {
+  auto histogram = LatencyHistogram{};
+
+  // 127 ns is the largest exactly stored value, 128 ns the first value in a logarithmic bucket
+  histogram.record(std::chrono::nanoseconds{127});
+  histogram.record(std::chrono::nanoseconds{128});
+  EXPECT_EQ(histogram.percentile(50.0), std::chrono::nanoseconds{127});
+  EXPECT_EQ(histogram.percentile(100.0), std::chrono::nanoseconds{128});
+
+  // Larger values are reported as the upper bound of their bucket, which is at most 1/64 above the value. The maximum
+  // is reported exactly.
+  for (const auto value : {1'000, 1'000'000, 123'456'789}) {
+    histogram.clear();
+    histogram.record(std::chrono::nanoseconds{value});
+    histogram.record(std::chrono::nanoseconds{2 * value});
+
+    const auto median = histogram.percentile(50.0);
+    EXPECT_GE(median, std::chrono::nanoseconds{value});
+    EXPECT_LE(median, std::chrono::nanoseconds{value + value / 64});
+    EXPECT_EQ(histogram.percentile(100.0), std::chrono::nanoseconds{2 * value});
+    EXPECT_EQ(histogram.max(), std::chrono::nanoseconds{2 * value});
+  }
+
+  // The largest representable latency falls into the last bucket
+  histogram.clear();
+  histogram.record(Duration::max());
+  EXPECT_EQ(histogram.count(), 1u);
+  EXPECT_EQ(histogram.percentile(50.0), Duration::max());
+}
+
+TEST_F(LatencyHistogramTest, Add) {
+  auto histogram = LatencyHistogram{};
+  histogram.record(std::chrono::nanoseconds{10});
+  histogram.record(std::chrono::nanoseconds{20});
+
+  auto other_histogram = LatencyHistogram{};
+  other_histogram.record(std::chrono::nanoseconds{30});
+  other_histogram.record(std::chrono::nanoseconds{1'000'000});
+
+  histogram.add(other_histogram);
+  EXPECT_EQ(histogram.count(), 4u);
+  EXPECT_EQ(histogram.mean(), std::chrono::nanoseconds{250'015});
+  EXPECT_EQ(histogram.max(), std::chrono::nanoseconds{1'000'000});
+  EXPECT_EQ(histogram.percentile(50.0), std::chrono::nanoseconds{20});
+  EXPECT_EQ(histogram.percentile(75.0), std::chrono::nanoseconds{30});
+  EXPECT_EQ(histogram.percentile(100.0), std::chrono::nanoseconds{1'000'000});
+
+  // The other histogram is unchanged
+  EXPECT_EQ(other_histogram.count(), 2u);
+
+  // Adding an empty histogram changes nothing
+  histogram.add(LatencyHistogram{});
+  EXPECT_EQ(histogram.count(), 4u);
+  EXPECT_EQ(histogram.max(), std::chrono::nanoseconds{1'000'000});
+}
+
+TEST_F(LatencyHistogramTest, ConcurrentRecord) {
+  auto histogram = LatencyHistogram{};
+
+  constexpr auto THREAD_COUNT = 4;
+  constexpr auto RECORDS_PER_THREAD = 1'000;
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_id = 0; thread_id < THREAD_COUNT; ++thread_id) {
+    threads.emplace_back([&histogram, thread_id]() {
+      for (auto record_id = 0; record_id < RECORDS_PER_THREAD; ++record_id) {
+        histogram.record(std::chrono::nanoseconds{thread_id + 1});
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(histogram.count(), size_t{THREAD_COUNT * RECORDS_PER_THREAD});
+  EXPECT_EQ(histogram.max(), std::chrono::nanoseconds{THREAD_COUNT});
+  EXPECT_EQ(histogram.percentile(25.0), std::chrono::nanoseconds{1});
+  EXPECT_EQ(histogram.percentile(100.0), std::chrono::nanoseconds{THREAD_COUNT});
+}
+
+}  // namespace opossum
@@ -257,6 +257,21 @@ TEST_F(CachePolicyTest, Iterators) {
   ASSERT_EQ(value_sum, 200);
 }
 
+TEST_F(CachePolicyTest, EraseIf) {
+  auto cache = Cache<int, int>{4};
+
+  cache.set(1, 2);
+  cache.set(2, 4);
+  cache.set(3, 6);
+
+  cache.erase_if([](const auto key, const auto value) { return key == 1 || value == 6; });
+
+  ASSERT_EQ(cache.size(), 1u);
+  ASSERT_FALSE(cache.has(1));
+  ASSERT_TRUE(cache.has(2));
+  ASSERT_FALSE(cache.has(3));
+}
+
 template <typename T>
 class CacheTest : public BaseTest {};
 
@@ -291,6 +306,31 @@ TYPED_TEST(CacheTest, Clear) {
   ASSERT_FALSE(cache.has(2));
 }
 
+TYPED_TEST(CacheTest, Erase) {
+  TypeParam cache(3);
+
+  cache.set(1, 2);
+  cache.set(2, 4);
+  cache.set(3, 6);
+
+  cache.erase(2);
+  cache.erase(4);
+
+  ASSERT_EQ(cache.size(), 2u);
+  ASSERT_TRUE(cache.has(1));
+  ASSERT_FALSE(cache.has(2));
+  ASSERT_TRUE(cache.has(3));
+  ASSERT_EQ(cache.get(1), 2);
+  ASSERT_EQ(cache.get(3), 6);
+
+  // The freed slot can be used again without evicting other entries
+  cache.set(4, 8);
+  ASSERT_EQ(cache.size(), 3u);
+  ASSERT_TRUE(cache.has(1));
+  ASSERT_TRUE(cache.has(3));
+  ASSERT_EQ(cache.get(4), 8);
+}
+
 TYPED_TEST(CacheTest, ResizeGrow) {
   TypeParam cache(3);
 
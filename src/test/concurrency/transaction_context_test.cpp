@@ -157,4 +157,17 @@ TEST_F(TransactionContextTest, CommitWithFailedOperator) {
   EXPECT_ANY_THROW(context->commit());
 }
 
+TEST_F(TransactionContextTest, RollbackReason) {
+  auto user_context = manager().new_transaction_context(AutoCommit::No);
+  EXPECT_EQ(user_context->rollback_reason(), std::nullopt);
+  user_context->rollback(RollbackReason::User);
+  EXPECT_EQ(user_context->phase(), TransactionPhase::RolledBackByUser);
+  EXPECT_EQ(user_context->rollback_reason(), RollbackReason::User);
+
+  auto out_of_memory_context = manager().new_transaction_context(AutoCommit::No);
+  out_of_memory_context->rollback(RollbackReason::OutOfMemory);
+  EXPECT_EQ(out_of_memory_context->phase(), TransactionPhase::RolledBackAfterConflict);
+  EXPECT_EQ(out_of_memory_context->rollback_reason(), RollbackReason::OutOfMemory);
+}
+
 }  // namespace opossum
@@ -1,4 +1,8 @@
 #include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
 #include <vector>
 
 #include "base_test.hpp"
@@ -12,23 +16,32 @@ class TransactionManagerTest : public BaseTest {
  protected:
   void SetUp() override {}
 
-  static std::unordered_multiset<CommitID>& get_active_snapshot_commit_ids() {
-    return Hyrise::get().transaction_manager._active_snapshot_commit_ids;
+  static std::unordered_multiset<CommitID> get_active_snapshot_commit_ids() {
+    return Hyrise::get().transaction_manager._active_snapshot_commit_ids();
   }
 
-  static void register_transaction(CommitID snapshot_commit_id) {
-    Hyrise::get().transaction_manager._register_transaction(snapshot_commit_id);
+  using SnapshotSlot = TransactionManager::SnapshotSlot;
+
+  static SnapshotSlot& register_transaction(CommitID snapshot_commit_id) {
+    return Hyrise::get().transaction_manager._register_transaction(snapshot_commit_id);
+  }
+  static void deregister_transaction(SnapshotSlot& slot) {
+    auto& manager = Hyrise::get().transaction_manager;
+    manager._deregister_transaction(slot, manager._snapshot_slot_epoch());
   }
-  static void deregister_transaction(CommitID snapshot_commit_id) {
-    Hyrise::get().transaction_manager._deregister_transaction(snapshot_commit_id);
+  static constexpr auto SNAPSHOT_SLOTS_PER_BLOCK = TransactionManager::SNAPSHOT_SLOTS_PER_BLOCK;
+
+  static CommitID new_commit_id() { return Hyrise::get().transaction_manager._new_commit_id(); }
+  static void publish_commit(const CommitID commit_id, const std::function<void()>& callback) {
+    Hyrise::get().transaction_manager._publish_commit(commit_id, callback);
   }
+  static constexpr auto COMMIT_SLOT_COUNT = TransactionManager::COMMIT_SLOT_COUNT;
 };
 
 /** Check if all active snapshot commit ids of uncommitted
  * transaction contexts are tracked correctly.
- * Normally, deregister_transaction() is called in the
- * destructor of the transaction context but is called
- * manually for this test.
+ * The transaction contexts deregister themselves in their
+ * destructor.
  */
 TEST_F(TransactionManagerTest, TrackActiveCommitIDs) {
   auto& manager = Hyrise::get().transaction_manager;
@@ -36,52 +49,198 @@ TEST_F(TransactionManagerTest, TrackActiveCommitIDs) {
   EXPECT_EQ(get_active_snapshot_commit_ids().size(), 0);
   EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), std::nullopt);
 
-  const auto t1_context = manager.new_transaction_context(AutoCommit::No);
-  const auto t2_context = manager.new_transaction_context(AutoCommit::No);
-  const auto t3_context = manager.new_transaction_context(AutoCommit::No);
+  auto t1_context = manager.new_transaction_context(AutoCommit::No);
+  auto t2_context = manager.new_transaction_context(AutoCommit::No);
+
+  // Committing a transaction increases the last commit id so that t3 gets a newer snapshot
+  manager.new_transaction_context(AutoCommit::No)->commit();
+  auto t3_context = manager.new_transaction_context(AutoCommit::No);
 
   const CommitID t1_snapshot_commit_id = t1_context->snapshot_commit_id();
-  const CommitID t2_snapshot_commit_id = t2_context->snapshot_commit_id();
   const CommitID t3_snapshot_commit_id = t3_context->snapshot_commit_id();
-  const auto vec = std::vector<CommitID>{t1_snapshot_commit_id, t2_snapshot_commit_id, t3_snapshot_commit_id};
+  EXPECT_EQ(t2_context->snapshot_commit_id(), t1_snapshot_commit_id);
+  EXPECT_LT(t1_snapshot_commit_id, t3_snapshot_commit_id);
 
-  EXPECT_EQ(get_active_snapshot_commit_ids().size(), 3);
-  EXPECT_TRUE(std::find(get_active_snapshot_commit_ids().cbegin(), get_active_snapshot_commit_ids().cend(),
-                        t1_snapshot_commit_id) != get_active_snapshot_commit_ids().cend());
-  EXPECT_TRUE(std::find(get_active_snapshot_commit_ids().cbegin(), get_active_snapshot_commit_ids().cend(),
-                        t2_snapshot_commit_id) != get_active_snapshot_commit_ids().cend());
-  EXPECT_TRUE(std::find(get_active_snapshot_commit_ids().cbegin(), get_active_snapshot_commit_ids().cend(),
-                        t3_snapshot_commit_id) != get_active_snapshot_commit_ids().cend());
-  EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), *std::min_element(vec.cbegin(), vec.cend()));
+  EXPECT_EQ(get_active_snapshot_commit_ids(),
+            (std::unordered_multiset<CommitID>{t1_snapshot_commit_id, t1_snapshot_commit_id, t3_snapshot_commit_id}));
+  EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), t1_snapshot_commit_id);
 
   t1_context->commit();
-  deregister_transaction(t1_context->snapshot_commit_id());
+  t1_context = nullptr;
+
+  EXPECT_EQ(get_active_snapshot_commit_ids(),
+            (std::unordered_multiset<CommitID>{t1_snapshot_commit_id, t3_snapshot_commit_id}));
+  EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), t1_snapshot_commit_id);
+
+  t2_context->commit();
+  t2_context = nullptr;
 
-  EXPECT_EQ(get_active_snapshot_commit_ids().size(), 2);
-  EXPECT_TRUE(std::find(get_active_snapshot_commit_ids().cbegin(), get_active_snapshot_commit_ids().cend(),
-                        t1_context->snapshot_commit_id()) != get_active_snapshot_commit_ids().cend());
-  EXPECT_TRUE(std::find(get_active_snapshot_commit_ids().cbegin(), get_active_snapshot_commit_ids().cend(),
-                        t3_context->snapshot_commit_id()) != get_active_snapshot_commit_ids().cend());
-  EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), t2_context->snapshot_commit_id());
+  EXPECT_EQ(get_active_snapshot_commit_ids(), (std::unordered_multiset<CommitID>{t3_snapshot_commit_id}));
+  EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), t3_snapshot_commit_id);
 
   t3_context->commit();
-  deregister_transaction(t3_context->snapshot_commit_id());
+  t3_context = nullptr;
 
-  EXPECT_EQ(get_active_snapshot_commit_ids().size(), 1);
-  EXPECT_TRUE(std::find(get_active_snapshot_commit_ids().cbegin(), get_active_snapshot_commit_ids().cend(),
-                        t2_context->snapshot_commit_id()) != get_active_snapshot_commit_ids().cend());
-  EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), t2_context->snapshot_commit_id());
+  EXPECT_EQ(get_active_snapshot_commit_ids().size(), 0);
+  EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), std::nullopt);
+}
 
-  t2_context->commit();
-  deregister_transaction(t2_context->snapshot_commit_id());
+TEST_F(TransactionManagerTest, LowestSnapshotCommitID) {
+  auto& manager = Hyrise::get().transaction_manager;
+
+  // Without active transactions, new transactions get the last commit id as their snapshot
+  manager.new_transaction_context(AutoCommit::No)->commit();
+  EXPECT_EQ(manager.get_lowest_snapshot_commit_id(), manager.last_commit_id());
+
+  const auto context = manager.new_transaction_context(AutoCommit::No);
+  manager.new_transaction_context(AutoCommit::No)->commit();
+  EXPECT_EQ(manager.get_lowest_snapshot_commit_id(), context->snapshot_commit_id());
+  EXPECT_LT(manager.get_lowest_snapshot_commit_id(), manager.last_commit_id());
+
+  context->commit();
+}
+
+TEST_F(TransactionManagerTest, MoreActiveTransactionsThanSlotsPerBlock) {
+  auto& manager = Hyrise::get().transaction_manager;
+
+  // Occupy all slots of the first block and some of an appended block
+  auto slots = std::vector<SnapshotSlot*>{};
+  for (auto snapshot_commit_id = CommitID{1}; snapshot_commit_id <= SNAPSHOT_SLOTS_PER_BLOCK + 10;
+       ++snapshot_commit_id) {
+    slots.emplace_back(&register_transaction(snapshot_commit_id));
+  }
+
+  EXPECT_EQ(get_active_snapshot_commit_ids().size(), SNAPSHOT_SLOTS_PER_BLOCK + 10);
+  EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), CommitID{1});
+
+  // Release the slots with the lowest ids, which are in the first block
+  for (auto slot_id = size_t{0}; slot_id < 20; ++slot_id) {
+    deregister_transaction(*slots[slot_id]);
+  }
+  EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), CommitID{21});
+
+  // Released slots are reused
+  auto& reused_slot = register_transaction(CommitID{5});
+  EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), CommitID{5});
+  EXPECT_NE(std::find(slots.begin(), slots.begin() + 20, &reused_slot), slots.begin() + 20);
+  deregister_transaction(reused_slot);
+
+  for (auto slot_id = size_t{20}; slot_id < slots.size(); ++slot_id) {
+    deregister_transaction(*slots[slot_id]);
+  }
+  EXPECT_EQ(get_active_snapshot_commit_ids().size(), 0);
+  EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), std::nullopt);
+}
+
+TEST_F(TransactionManagerTest, ContextOutlivingResetDoesNotFreeForeignSlot) {
+  auto old_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  Hyrise::reset();
+  EXPECT_EQ(get_active_snapshot_commit_ids().size(), 0);
+
+  // Registering transactions from the same thread claims the slot that old_context occupied before the reset
+  auto& manager = Hyrise::get().transaction_manager;
+  auto new_contexts = std::vector<std::shared_ptr<TransactionContext>>{};
+  for (auto context_id = size_t{0}; context_id < 5; ++context_id) {
+    new_contexts.emplace_back(manager.new_transaction_context(AutoCommit::No));
+  }
+  EXPECT_EQ(get_active_snapshot_commit_ids().size(), 5);
+
+  old_context = nullptr;
+  EXPECT_EQ(get_active_snapshot_commit_ids().size(), 5);
+
+  new_contexts.clear();
+  EXPECT_EQ(get_active_snapshot_commit_ids().size(), 0);
+}
+
+TEST_F(TransactionManagerTest, ConcurrentTransactions) {
+  auto& manager = Hyrise::get().transaction_manager;
+
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_id = 0; thread_id < 8; ++thread_id) {
+    threads.emplace_back([&]() {
+      for (auto transaction_id = 0; transaction_id < 1000; ++transaction_id) {
+        const auto context = manager.new_transaction_context(AutoCommit::No);
+        const auto lowest_snapshot_commit_id = manager.get_lowest_active_snapshot_commit_id();
+        ASSERT_TRUE(lowest_snapshot_commit_id);
+        EXPECT_LE(*lowest_snapshot_commit_id, context->snapshot_commit_id());
+        context->commit();
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
 
   EXPECT_EQ(get_active_snapshot_commit_ids().size(), 0);
   EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), std::nullopt);
+}
 
-  // To prevent exceptions in TransactionContext destructor
-  register_transaction(t1_snapshot_commit_id);
-  register_transaction(t2_snapshot_commit_id);
-  register_transaction(t3_snapshot_commit_id);
+TEST_F(TransactionManagerTest, CommitsArePublishedInOrder) {
+  auto& manager = Hyrise::get().transaction_manager;
+  const auto initial_last_commit_id = manager.last_commit_id();
+
+  const auto commit_id_1 = new_commit_id();
+  const auto commit_id_2 = new_commit_id();
+  const auto commit_id_3 = new_commit_id();
+
+  auto published_commit_ids = std::vector<CommitID>{};
+  const auto callback = [&](const CommitID commit_id) {
+    return [&, commit_id]() { published_commit_ids.emplace_back(commit_id); };
+  };
+
+  // Later commits are only published once all earlier ones are ready
+  publish_commit(commit_id_3, callback(commit_id_3));
+  publish_commit(commit_id_2, callback(commit_id_2));
+  EXPECT_EQ(manager.last_commit_id(), initial_last_commit_id);
+  EXPECT_TRUE(published_commit_ids.empty());
+
+  publish_commit(commit_id_1, callback(commit_id_1));
+  EXPECT_EQ(manager.last_commit_id(), commit_id_3);
+  EXPECT_EQ(published_commit_ids, (std::vector<CommitID>{commit_id_1, commit_id_2, commit_id_3}));
+}
+
+TEST_F(TransactionManagerTest, ConcurrentCommits) {
+  auto& manager = Hyrise::get().transaction_manager;
+  const auto initial_last_commit_id = manager.last_commit_id();
+
+  // More commits than there are commit slots, so that the slots are reused
+  constexpr auto THREAD_COUNT = 8;
+  constexpr auto COMMITS_PER_THREAD = COMMIT_SLOT_COUNT / 2;
+
+  auto published_commit_ids = std::vector<CommitID>{};
+  auto published_commit_ids_mutex = std::mutex{};
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_id = 0; thread_id < THREAD_COUNT; ++thread_id) {
+    threads.emplace_back([&]() {
+      for (auto commit_count = size_t{0}; commit_count < COMMITS_PER_THREAD; ++commit_count) {
+        const auto commit_id = new_commit_id();
+        auto published = std::atomic_bool{false};
+        publish_commit(commit_id, [&, commit_id]() {
+          EXPECT_GE(manager.last_commit_id(), commit_id);
+          const auto lock = std::lock_guard<std::mutex>{published_commit_ids_mutex};
+          published_commit_ids.emplace_back(commit_id);
+          published = true;
+        });
+
+        // publish_commit returns early if an earlier commit is still pending. Its thread then publishes our commit.
+        while (!published) {
+          std::this_thread::yield();
+        }
+        EXPECT_GE(manager.last_commit_id(), commit_id);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  const auto commit_count = THREAD_COUNT * COMMITS_PER_THREAD;
+  EXPECT_EQ(manager.last_commit_id(), initial_last_commit_id + commit_count);
+  ASSERT_EQ(published_commit_ids.size(), commit_count);
+  std::sort(published_commit_ids.begin(), published_commit_ids.end());
+  for (auto commit_id_offset = size_t{0}; commit_id_offset < commit_count; ++commit_id_offset) {
+    EXPECT_EQ(published_commit_ids[commit_id_offset], initial_last_commit_id + 1 + commit_id_offset);
+  }
 }
 
 }  // namespace opossum
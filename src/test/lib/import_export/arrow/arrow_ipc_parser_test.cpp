@@ -0,0 +1,96 @@
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+
+#include "import_export/arrow/arrow_ipc_parser.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class ArrowIpcParserTest : public BaseTest {
+ protected:
+  void TearDown() override { std::remove(filename.c_str()); }
+
+  const std::string reference_filepath = "resources/test_data/arrow/";
+  const std::string filename = test_data_path + "arrow_parser_test.arrow";
+};
+
+TEST_F(ArrowIpcParserTest, SingleFloatColumn) {
+  auto expected_table =
+      std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Float, false}}, TableType::Data, 5);
+  expected_table->append({1.1f});
+  expected_table->append({2.2f});
+  expected_table->append({3.3f});
+  expected_table->append({4.4f});
+
+  const auto table = ArrowIpcParser::parse(reference_filepath + "float.arrow");
+
+  EXPECT_TABLE_EQ_ORDERED(table, expected_table);
+  EXPECT_EQ(table->target_chunk_size(), Chunk::DEFAULT_SIZE);
+  EXPECT_TRUE(table->get_chunk(ChunkID{0})->has_mvcc_data());
+  EXPECT_FALSE(table->get_chunk(ChunkID{0})->is_mutable());
+}
+
+// The file was written by pyarrow with write_feather(table, compression="uncompressed", chunksize=3)
+TEST_F(ArrowIpcParserTest, PyArrowTypes) {
+  const auto table = ArrowIpcParser::parse(reference_filepath + "pyarrow_types.arrow");
+
+  // int8 -> int, uint32 -> long, int64 -> long, float64 -> double, string/large_string/dictionary -> string
+  const auto column_definitions = TableColumnDefinitions{
+      {"a", DataType::Int, true},    {"b", DataType::Long, false},  {"c", DataType::Long, true},
+      {"d", DataType::Double, true}, {"e", DataType::String, true}, {"f", DataType::String, true},
+      {"g", DataType::String, true}};
+  auto expected_table = std::make_shared<Table>(column_definitions, TableType::Data, 3);
+  expected_table->append({1, int64_t{1}, int64_t{10'000'000'000}, 1.5, "one", "A", "z"});
+  expected_table->append({NULL_VALUE, int64_t{2}, int64_t{2}, 2.5, NULL_VALUE, "B", "x"});
+  expected_table->append({3, int64_t{3}, int64_t{3}, NULL_VALUE, "", "C", NULL_VALUE});
+  expected_table->append({4, int64_t{4}, int64_t{4}, 4.5, "four", "D", "x"});
+  expected_table->append({5, int64_t{5}, int64_t{5}, 5.5, "five", "E", "y"});
+  expected_table->append({-6, int64_t{6}, int64_t{6}, 6.5, "six", "F", "z"});
+
+  EXPECT_TABLE_EQ_ORDERED(table, expected_table);
+
+  // Each record batch becomes a chunk
+  ASSERT_EQ(table->chunk_count(), ChunkID{2});
+  EXPECT_EQ(table->get_chunk(ChunkID{0})->size(), 3u);
+  EXPECT_TRUE(std::dynamic_pointer_cast<ValueSegment<int32_t>>(table->get_chunk(ChunkID{0})->get_segment(ColumnID{0})));
+
+  // Dictionary arrays become DictionarySegments that contain only the values used in the chunk, in sorted order
+  const auto first_dictionary_segment = std::dynamic_pointer_cast<DictionarySegment<pmr_string>>(
+      table->get_chunk(ChunkID{0})->get_segment(ColumnID{6}));
+  ASSERT_TRUE(first_dictionary_segment);
+  EXPECT_EQ(*first_dictionary_segment->dictionary(), pmr_vector<pmr_string>({"x", "z"}));
+  const auto second_dictionary_segment = std::dynamic_pointer_cast<DictionarySegment<pmr_string>>(
+      table->get_chunk(ChunkID{1})->get_segment(ColumnID{6}));
+  ASSERT_TRUE(second_dictionary_segment);
+  EXPECT_EQ(*second_dictionary_segment->dictionary(), pmr_vector<pmr_string>({"x", "y", "z"}));
+}
+
+TEST_F(ArrowIpcParserTest, CompressedFile) {
+  EXPECT_THROW(ArrowIpcParser::parse(reference_filepath + "pyarrow_compressed.arrow"), InvalidInputException);
+}
+
+TEST_F(ArrowIpcParserTest, NotAnArrowFile) {
+  EXPECT_THROW(ArrowIpcParser::parse("resources/test_data/csv/float.csv"), InvalidInputException);
+}
+
+TEST_F(ArrowIpcParserTest, TruncatedFile) {
+  auto reference_file = std::ifstream{reference_filepath + "pyarrow_types.arrow", std::ios::binary};
+  const auto content = std::string{std::istreambuf_iterator<char>(reference_file), std::istreambuf_iterator<char>()};
+
+  // Remove the middle of the file, so that the magic and the footer are intact but the messages are cut off
+  {
+    auto file = std::ofstream{filename, std::ios::binary};
+    file << content.substr(0, 64) << content.substr(content.size() / 2);
+  }
+
+  EXPECT_THROW(ArrowIpcParser::parse(filename), InvalidInputException);
+}
+
+}  // namespace opossum
@@ -0,0 +1,112 @@
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "import_export/arrow/arrow_ipc_parser.hpp"
+#include "import_export/arrow/arrow_ipc_writer.hpp"
+#include "storage/base_dictionary_segment.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class ArrowIpcWriterTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    std::remove(filename.c_str());
+
+    const auto column_definitions = TableColumnDefinitions{
+        {"a", DataType::Int, false},   {"b", DataType::Long, true},   {"c", DataType::Float, false},
+        {"d", DataType::Double, true}, {"e", DataType::String, true}};
+    table = std::make_shared<Table>(column_definitions, TableType::Data, 3);
+    table->append({1, int64_t{100}, 1.5f, 1.25, "one"});
+    table->append({2, NULL_VALUE, 2.5f, NULL_VALUE, NULL_VALUE});
+    table->append({3, int64_t{300}, 3.5f, 3.25, ""});
+    table->append({2, int64_t{400}, 4.5f, 4.25, "four"});
+    table->append({1, int64_t{100}, 5.5f, 5.25, "one"});
+    table->last_chunk()->finalize();
+  }
+
+  void TearDown() override { std::remove(filename.c_str()); }
+
+  std::shared_ptr<Table> table;
+  const std::string filename = test_data_path + "arrow_writer_test.arrow";
+  const std::string reference_filepath = "resources/test_data/arrow/";
+};
+
+TEST_F(ArrowIpcWriterTest, SingleFloatColumn) {
+  auto float_table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Float, false}}, TableType::Data, 5);
+  float_table->append({1.1f});
+  float_table->append({2.2f});
+  float_table->append({3.3f});
+  float_table->append({4.4f});
+
+  ArrowIpcWriter::write(*float_table, filename);
+
+  EXPECT_TRUE(file_exists(filename));
+  EXPECT_TRUE(compare_files(reference_filepath + "float.arrow", filename));
+}
+
+TEST_F(ArrowIpcWriterTest, RoundTripValueSegments) {
+  ArrowIpcWriter::write(*table, filename);
+  const auto parsed_table = ArrowIpcParser::parse(filename);
+
+  EXPECT_TABLE_EQ_ORDERED(parsed_table, table);
+  ASSERT_EQ(parsed_table->chunk_count(), ChunkID{2});
+  EXPECT_EQ(parsed_table->get_chunk(ChunkID{0})->size(), 3u);
+  EXPECT_EQ(parsed_table->get_chunk(ChunkID{1})->size(), 2u);
+  for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+    EXPECT_FALSE(std::dynamic_pointer_cast<BaseDictionarySegment>(
+        parsed_table->get_chunk(ChunkID{0})->get_segment(column_id)));
+  }
+}
+
+TEST_F(ArrowIpcWriterTest, RoundTripDictionarySegments) {
+  ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{EncodingType::Dictionary});
+
+  ArrowIpcWriter::write(*table, filename);
+  const auto parsed_table = ArrowIpcParser::parse(filename);
+
+  EXPECT_TABLE_EQ_ORDERED(parsed_table, table);
+
+  // The file contains the union of the chunks' dictionaries, the parsed segments only contain the values of their chunk
+  const auto dictionary_segment = std::dynamic_pointer_cast<DictionarySegment<int32_t>>(
+      parsed_table->get_chunk(ChunkID{1})->get_segment(ColumnID{0}));
+  ASSERT_TRUE(dictionary_segment);
+  EXPECT_EQ(*dictionary_segment->dictionary(), pmr_vector<int32_t>({1, 2}));
+
+  const auto string_segment = std::dynamic_pointer_cast<DictionarySegment<pmr_string>>(
+      parsed_table->get_chunk(ChunkID{0})->get_segment(ColumnID{4}));
+  ASSERT_TRUE(string_segment);
+  EXPECT_EQ(*string_segment->dictionary(), pmr_vector<pmr_string>({"", "one"}));
+}
+
+TEST_F(ArrowIpcWriterTest, RoundTripMixedEncodings) {
+  // Columns whose segments are not all dictionary-encoded are written as plain arrays
+  ChunkEncoder::encode_chunks(table, {ChunkID{0}}, SegmentEncodingSpec{EncodingType::Dictionary});
+  ChunkEncoder::encode_chunks(table, {ChunkID{1}}, SegmentEncodingSpec{EncodingType::RunLength});
+
+  ArrowIpcWriter::write(*table, filename);
+  const auto parsed_table = ArrowIpcParser::parse(filename);
+
+  EXPECT_TABLE_EQ_ORDERED(parsed_table, table);
+  EXPECT_TRUE(
+      std::dynamic_pointer_cast<ValueSegment<int32_t>>(parsed_table->get_chunk(ChunkID{0})->get_segment(ColumnID{0})));
+}
+
+TEST_F(ArrowIpcWriterTest, EmptyTable) {
+  const auto empty_table = std::make_shared<Table>(table->column_definitions(), TableType::Data, 3);
+
+  ArrowIpcWriter::write(*empty_table, filename);
+  const auto parsed_table = ArrowIpcParser::parse(filename);
+
+  EXPECT_EQ(parsed_table->column_definitions(), table->column_definitions());
+  EXPECT_EQ(parsed_table->chunk_count(), ChunkID{0});
+}
+
+}  // namespace opossum
@@ -1,3 +1,6 @@
+#include <cstdio>
+#include <fstream>
+#include <iterator>
 #include <memory>
 #include <string>
 #include <vector>
@@ -14,7 +17,10 @@ namespace opossum {
 
 class BinaryParserTest : public BaseTest {
  protected:
+  void TearDown() override { std::remove(_filename.c_str()); }
+
   const std::string _reference_filepath = "resources/test_data/bin/";
+  const std::string _filename = test_data_path + "binary_parser_test.bin";
 };
 
 class BinaryParserMultiEncodingTest : public BinaryParserTest, public ::testing::WithParamInterface<EncodingType> {};
@@ -385,4 +391,61 @@ TEST_F(BinaryParserTest, TwoColumnsNoValues) {
   EXPECT_TABLE_EQ_ORDERED(table, expected_table);
 }
 
+TEST_F(BinaryParserTest, ColumnSubset) {
+  const auto column_definitions = TableColumnDefinitions{
+      {"a", DataType::Int, false}, {"b", DataType::String, true}, {"c", DataType::Double, false}};
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data, 2);
+  table->append({1, "one", 1.5});
+  table->append({2, NULL_VALUE, 2.5});
+  table->append({3, "three", 3.5});
+  table->last_chunk()->finalize();
+  ChunkEncoder::encode_chunks(table, {ChunkID{0}}, SegmentEncodingSpec{EncodingType::Dictionary});
+  BinaryWriter::write(*table, _filename);
+
+  // Only the selected segments are read, in the requested order
+  auto expected_table = std::make_shared<Table>(
+      TableColumnDefinitions{{"c", DataType::Double, false}, {"a", DataType::Int, false}}, TableType::Data, 2);
+  expected_table->append({1.5, 1});
+  expected_table->append({2.5, 2});
+  expected_table->append({3.5, 3});
+
+  const auto parsed_table = BinaryParser::parse(_filename, std::vector<ColumnID>{ColumnID{2}, ColumnID{0}});
+
+  EXPECT_TABLE_EQ_ORDERED(parsed_table, expected_table);
+  EXPECT_EQ(parsed_table->chunk_count(), ChunkID{2});
+  EXPECT_EQ(parsed_table->target_chunk_size(), 2u);
+  EXPECT_TRUE(parsed_table->get_chunk(ChunkID{0})->has_mvcc_data());
+
+  EXPECT_THROW(BinaryParser::parse(_filename, std::vector<ColumnID>{ColumnID{3}}), std::exception);
+  EXPECT_THROW(BinaryParser::parse(_filename, std::vector<ColumnID>{}), std::exception);
+}
+
+TEST_F(BinaryParserTest, OutdatedFormat) {
+  auto reference_file = std::ifstream{_reference_filepath + "float.bin", std::ios::binary};
+  const auto content = std::string{std::istreambuf_iterator<char>(reference_file), std::istreambuf_iterator<char>()};
+  EXPECT_TRUE(BinaryParser::has_current_format(_reference_filepath + "float.bin"));
+
+  // Files written before the chunk directory was introduced do not start with the magic
+  {
+    auto file = std::ofstream{_filename, std::ios::binary};
+    file << content.substr(BinaryWriter::MAGIC.size());
+  }
+
+  EXPECT_FALSE(BinaryParser::has_current_format(_filename));
+  EXPECT_FALSE(BinaryParser::has_current_format("not_existing_file"));
+  EXPECT_THROW(BinaryParser::parse(_filename), std::exception);
+}
+
+TEST_F(BinaryParserTest, TruncatedFile) {
+  auto reference_file = std::ifstream{_reference_filepath + "LZ4MultipleBlocks.bin", std::ios::binary};
+  const auto content = std::string{std::istreambuf_iterator<char>(reference_file), std::istreambuf_iterator<char>()};
+
+  {
+    auto file = std::ofstream{_filename, std::ios::binary};
+    file << content.substr(0, content.size() / 2);
+  }
+
+  EXPECT_THROW(BinaryParser::parse(_filename), std::exception);
+}
+
 }  // namespace opossum
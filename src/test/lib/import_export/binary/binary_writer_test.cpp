@@ -7,9 +7,12 @@
 
 #include "base_test.hpp"
 
+#include "hyrise.hpp"
+#include "import_export/binary/binary_parser.hpp"
 #include "import_export/binary/binary_writer.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/encoding_type.hpp"
 #include "storage/table.hpp"
@@ -491,4 +494,35 @@ TEST_P(BinaryWriterMultiEncodingTest, RunNullValues) {
   EXPECT_TRUE(compare_files(reference_filename, filename));
 }
 
+TEST_F(BinaryWriterTest, ManyChunksWithScheduler) {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int, false);
+  column_definitions.emplace_back("b", DataType::String, true);
+
+  // More chunks than are serialized concurrently, so that the writer has to wait for the oldest ones
+  const auto chunk_count = BinaryWriter::MAX_CHUNKS_IN_FLIGHT * 2 + 1;
+  table = std::make_shared<Table>(column_definitions, TableType::Data, 4);
+  for (auto row_id = int32_t{0}; row_id < static_cast<int32_t>(chunk_count * 4 - 1); ++row_id) {
+    const auto value = pmr_string{std::to_string(row_id)};
+    table->append({row_id, row_id % 3 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{value}});
+  }
+  table->last_chunk()->finalize();
+  ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{EncodingType::Dictionary});
+
+  const auto reference_filename = test_data_path + "export_test_reference.bin";
+  BinaryWriter::write(*table, reference_filename);
+
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+  BinaryWriter::write(*table, filename);
+
+  // The file does not depend on the order in which the chunks were serialized
+  EXPECT_TRUE(compare_files(reference_filename, filename));
+  std::remove(reference_filename.c_str());
+
+  const auto parsed_table = BinaryParser::parse(filename);
+  EXPECT_EQ(parsed_table->chunk_count(), ChunkID{static_cast<ChunkID::base_type>(chunk_count)});
+  EXPECT_TABLE_EQ_ORDERED(parsed_table, table);
+}
+
 }  // namespace opossum
@@ -5,11 +5,18 @@
 #include "scheduler/immediate_execution_scheduler.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
 #include "scheduler/operator_task.hpp"
+#include "storage/dictionary_segment.hpp"
 #include "storage/table.hpp"
 
 namespace opossum {
 
-class CsvParserTest : public BaseTest {};
+class CsvParserTest : public BaseTest {
+ protected:
+  static std::shared_ptr<Table> parse_with_buffer_size(const std::string& filename, const ChunkOffset chunk_size,
+                                                       const size_t read_buffer_size) {
+    return CsvParser::_parse(filename, chunk_size, std::nullopt, std::nullopt, read_buffer_size);
+  }
+};
 
 TEST_F(CsvParserTest, SingleFloatColumn) {
   auto table = CsvParser::parse("resources/test_data/csv/float.csv");
@@ -131,6 +138,45 @@ TEST_F(CsvParserTest, TargetChunkSize) {
   EXPECT_TABLE_EQ_ORDERED(table, expected_table);
 }
 
+TEST_F(CsvParserTest, SmallReadBuffers) {
+  // Each buffer holds a few rows, so that rows and chunks are split across buffers
+  const auto table = parse_with_buffer_size("resources/test_data/csv/float_int_large.csv", ChunkOffset{20}, 50);
+
+  TableColumnDefinitions column_definitions{{"b", DataType::Float, false}, {"a", DataType::Int, false}};
+  auto expected_table = std::make_shared<Table>(column_definitions, TableType::Data, 20);
+  for (int i = 0; i < 100; ++i) {
+    expected_table->append({458.7f, 12345});
+  }
+  EXPECT_TABLE_EQ_ORDERED(table, expected_table);
+
+  // Rows are carried over to the next buffer until they fill an entire chunk
+  EXPECT_EQ(table->chunk_count(), ChunkID{5});
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    EXPECT_EQ(table->get_chunk(chunk_id)->size(), 20U);
+    EXPECT_FALSE(table->get_chunk(chunk_id)->is_mutable());
+  }
+}
+
+TEST_F(CsvParserTest, QuotedLinebreaksAcrossReadBuffers) {
+  const auto table = parse_with_buffer_size("resources/test_data/csv/string_escaped.csv", ChunkOffset{3}, 1);
+  const auto expected_table = CsvParser::parse("resources/test_data/csv/string_escaped.csv");
+  EXPECT_TABLE_EQ_ORDERED(table, expected_table);
+  EXPECT_EQ(table->chunk_count(), ChunkID{2});
+}
+
+TEST_F(CsvParserTest, EncodeChunks) {
+  const auto table = CsvParser::parse("resources/test_data/csv/float_int_large.csv", ChunkOffset{20}, std::nullopt,
+                                      SegmentEncodingSpec{EncodingType::Dictionary});
+  const auto expected_table = CsvParser::parse("resources/test_data/csv/float_int_large.csv", ChunkOffset{20});
+  EXPECT_TABLE_EQ_ORDERED(table, expected_table);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<float>>(chunk->get_segment(ColumnID{0})));
+    EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<int32_t>>(chunk->get_segment(ColumnID{1})));
+  }
+}
+
 TEST_F(CsvParserTest, StringEscapingNonRfc) {
   std::string csv_file = "resources/test_data/csv/string_escaped_unsafe.csv";
   auto csv_meta = process_csv_meta_file(csv_file + CsvMeta::META_FILE_EXTENSION);
@@ -87,15 +87,21 @@ TEST_F(StoredTableNodeTest, HashingAndEqualityCheck) {
   const auto different_node_c2 = StoredTableNode::make("t_b");
   different_node_c2->set_pruned_column_ids({ColumnID{1}});
 
+  const auto different_node_d = StoredTableNode::make("t_a");
+  different_node_d->set_pruned_chunk_ids({ChunkID{2}});
+  different_node_d->set_chunk_pruning_column_ids({ColumnID{0}});
+
   EXPECT_NE(*_stored_table_node, *different_node_a);
   EXPECT_NE(*_stored_table_node, *different_node_b);
   EXPECT_NE(*_stored_table_node, *different_node_c);
   EXPECT_EQ(*different_node_c, *different_node_c2);
+  EXPECT_NE(*_stored_table_node, *different_node_d);
 
   EXPECT_NE(_stored_table_node->hash(), different_node_a->hash());
   EXPECT_NE(_stored_table_node->hash(), different_node_b->hash());
   EXPECT_NE(_stored_table_node->hash(), different_node_c->hash());
   EXPECT_EQ(different_node_c->hash(), different_node_c2->hash());
+  EXPECT_NE(_stored_table_node->hash(), different_node_d->hash());
 }
 
 TEST_F(StoredTableNodeTest, Copy) {
@@ -103,7 +109,9 @@ TEST_F(StoredTableNodeTest, Copy) {
 
   _stored_table_node->set_pruned_chunk_ids({ChunkID{2}});
   _stored_table_node->set_pruned_column_ids({ColumnID{1}});
+  _stored_table_node->set_chunk_pruning_column_ids({ColumnID{0}});
   EXPECT_EQ(*_stored_table_node->deep_copy(), *_stored_table_node);
+  EXPECT_EQ(_stored_table_node->deep_copy()->hash(), _stored_table_node->hash());
 }
 
 TEST_F(StoredTableNodeTest, NodeExpressions) { ASSERT_EQ(_stored_table_node->node_expressions.size(), 0u); }
@@ -0,0 +1,195 @@
+#include <memory>
+#include <optional>
+
+#include "base_test.hpp"
+
+#include "memory/memory_tracker.hpp"
+#include "operators/aggregate_hash.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/job_task.hpp"
+
+namespace opossum {
+
+class MemoryTrackerTest : public BaseTest {};
+
+TEST_F(MemoryTrackerTest, UsageAndPeak) {
+  auto tracker = MemoryTracker{};
+  EXPECT_EQ(tracker.current_usage(), 0);
+  EXPECT_EQ(tracker.peak_usage(), 0);
+
+  tracker.allocate(100);
+  tracker.allocate(50);
+  tracker.deallocate(120);
+  EXPECT_EQ(tracker.current_usage(), 30);
+  EXPECT_EQ(tracker.peak_usage(), 150);
+
+  // The usage does not become negative
+  tracker.deallocate(100);
+  EXPECT_EQ(tracker.current_usage(), 0);
+  EXPECT_EQ(tracker.peak_usage(), 150);
+}
+
+TEST_F(MemoryTrackerTest, Hierarchy) {
+  const auto parent = std::make_shared<MemoryTracker>(nullptr, 1000);
+  const auto child = std::make_shared<MemoryTracker>(parent, 300);
+  const auto sibling = std::make_shared<MemoryTracker>(parent);
+
+  EXPECT_EQ(parent->available_memory(), 1000);
+  EXPECT_EQ(child->available_memory(), 300);
+  EXPECT_EQ(sibling->available_memory(), 1000);
+  EXPECT_EQ(MemoryTracker{}.available_memory(), std::nullopt);
+
+  child->allocate(200);
+  sibling->allocate(750);
+  EXPECT_EQ(parent->current_usage(), 950);
+  EXPECT_EQ(child->available_memory(), 50);
+  EXPECT_EQ(sibling->available_memory(), 50);
+  EXPECT_FALSE(parent->limit_exceeded());
+
+  child->allocate(200);
+  EXPECT_EQ(child->available_memory(), 0);
+  EXPECT_TRUE(child->limit_exceeded());
+  EXPECT_TRUE(parent->limit_exceeded());
+  EXPECT_TRUE(sibling->limit_exceeded());
+
+  // The limit was exceeded at some point, even if the memory has been freed since
+  child->deallocate(400);
+  sibling->deallocate(750);
+  EXPECT_EQ(parent->current_usage(), 0);
+  EXPECT_TRUE(parent->limit_exceeded());
+}
+
+TEST_F(MemoryTrackerTest, ReportLimitExceededOnce) {
+  auto tracker = MemoryTracker{nullptr, 10};
+  EXPECT_FALSE(tracker.report_limit_exceeded());
+
+  tracker.allocate(11);
+  EXPECT_TRUE(tracker.report_limit_exceeded());
+  EXPECT_FALSE(tracker.report_limit_exceeded());
+  EXPECT_TRUE(tracker.limit_exceeded());
+}
+
+TEST_F(MemoryTrackerTest, ScopeAttributesDefaultResourceAllocations) {
+  const auto outer_tracker = std::make_shared<MemoryTracker>(nullptr, 1'000);
+  const auto inner_tracker = std::make_shared<MemoryTracker>(outer_tracker);
+
+  EXPECT_EQ(MemoryTrackingScope::current_tracker(), nullptr);
+  EXPECT_FALSE(MemoryTrackingScope::exceeds_available_memory(10'000));
+
+  {
+    const auto outer_scope = MemoryTrackingScope{outer_tracker};
+    EXPECT_EQ(MemoryTrackingScope::current_tracker(), outer_tracker);
+
+    {
+      const auto inner_scope = MemoryTrackingScope{inner_tracker};
+      EXPECT_EQ(MemoryTrackingScope::current_tracker(), inner_tracker);
+
+      auto values = pmr_vector<int32_t>{};
+      values.reserve(100);
+      EXPECT_GE(inner_tracker->current_usage(), 100 * sizeof(int32_t));
+      EXPECT_EQ(outer_tracker->current_usage(), inner_tracker->current_usage());
+      EXPECT_TRUE(MemoryTrackingScope::exceeds_available_memory(1'000));
+    }
+
+    EXPECT_EQ(MemoryTrackingScope::current_tracker(), outer_tracker);
+    EXPECT_EQ(outer_tracker->current_usage(), 0);
+    EXPECT_GE(inner_tracker->peak_usage(), 100 * sizeof(int32_t));
+
+    // An inner scope without a tracker stops the attribution
+    {
+      const auto untracked_scope = MemoryTrackingScope{nullptr};
+      auto values = pmr_vector<int32_t>(100);
+    }
+    EXPECT_EQ(outer_tracker->peak_usage(), inner_tracker->peak_usage());
+  }
+
+  EXPECT_EQ(MemoryTrackingScope::current_tracker(), nullptr);
+}
+
+TEST_F(MemoryTrackerTest, FreesAreCreditedToChargedTracker) {
+  const auto charged_tracker = std::make_shared<MemoryTracker>();
+  const auto other_tracker = std::make_shared<MemoryTracker>();
+
+  auto values = std::optional<pmr_vector<int32_t>>{};
+  {
+    const auto scope = MemoryTrackingScope{charged_tracker};
+    values.emplace(100);
+  }
+  EXPECT_GE(charged_tracker->current_usage(), 100 * sizeof(int32_t));
+
+  {
+    const auto scope = MemoryTrackingScope{other_tracker};
+    values.reset();
+  }
+  EXPECT_EQ(charged_tracker->current_usage(), 0);
+  EXPECT_EQ(other_tracker->peak_usage(), 0);
+
+  // The memory is credited even if the tracker's owners have released it. Its parent is credited as well.
+  const auto parent_tracker = std::make_shared<MemoryTracker>();
+  {
+    const auto scope = MemoryTrackingScope{std::make_shared<MemoryTracker>(parent_tracker)};
+    values.emplace(100);
+  }
+  EXPECT_GE(parent_tracker->current_usage(), 100 * sizeof(int32_t));
+  values.reset();
+  EXPECT_EQ(parent_tracker->current_usage(), 0);
+}
+
+TEST_F(MemoryTrackerTest, OperatorsOfUntrackedStatements) {
+  const auto table_wrapper = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int_int.tbl", 2));
+  table_wrapper->execute();
+
+  const auto create_join_hash = [&]() {
+    return std::make_shared<JoinHash>(table_wrapper, table_wrapper, JoinMode::Inner,
+                                      OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals});
+  };
+
+  const auto join_hash = create_join_hash();
+  join_hash->execute();
+  EXPECT_EQ(join_hash->performance_data().peak_memory_usage, 0);
+
+  const auto tracker = std::make_shared<MemoryTracker>();
+  const auto scope = MemoryTrackingScope{tracker};
+  const auto tracked_join_hash = create_join_hash();
+  tracked_join_hash->execute();
+  EXPECT_GT(tracked_join_hash->performance_data().peak_memory_usage, 0);
+  EXPECT_GE(tracker->peak_usage(), tracked_join_hash->performance_data().peak_memory_usage);
+}
+
+TEST_F(MemoryTrackerTest, JobTaskCapturesTracker) {
+  const auto tracker = std::make_shared<MemoryTracker>();
+
+  auto task = std::shared_ptr<JobTask>{};
+  {
+    const auto scope = MemoryTrackingScope{tracker};
+    task = std::make_shared<JobTask>([&]() {
+      EXPECT_EQ(MemoryTrackingScope::current_tracker(), tracker);
+      auto values = pmr_vector<int32_t>(100);
+    });
+  }
+
+  task->schedule();
+  EXPECT_EQ(MemoryTrackingScope::current_tracker(), nullptr);
+  EXPECT_GE(tracker->peak_usage(), 100 * sizeof(int32_t));
+  EXPECT_EQ(tracker->current_usage(), 0);
+}
+
+TEST_F(MemoryTrackerTest, OperatorsStopWhenLimitIsExceeded) {
+  const auto table_wrapper = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int_int.tbl", 2));
+  table_wrapper->execute();
+
+  // The operators check the limit between their phases and throw instead of finishing with a result
+  const auto scope = MemoryTrackingScope{std::make_shared<MemoryTracker>(nullptr, 1)};
+
+  const auto join_hash =
+      std::make_shared<JoinHash>(table_wrapper, table_wrapper, JoinMode::Inner,
+                                 OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals});
+  EXPECT_THROW(join_hash->execute(), MemoryLimitExceededException);
+
+  const auto aggregate_hash = std::make_shared<AggregateHash>(
+      table_wrapper, std::vector<std::shared_ptr<AggregateExpression>>{}, std::vector<ColumnID>{ColumnID{0}});
+  EXPECT_THROW(aggregate_hash->execute(), MemoryLimitExceededException);
+}
+
+}  // namespace opossum
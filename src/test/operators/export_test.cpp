@@ -40,9 +40,10 @@ class OperatorsExportTest : public BaseTest {
   const std::string test_filename = test_data_path + "export_test";
   const std::string test_meta_filename = test_filename + CsvMeta::META_FILE_EXTENSION;
   const std::string reference_filepath = "resources/test_data/";
-  const std::map<FileType, std::string> reference_filenames{{FileType::Binary, "bin/float.bin"},
-                                                            {FileType::Csv, "csv/float.csv"}};
-  const std::map<FileType, std::string> file_extensions{{FileType::Binary, ".bin"}, {FileType::Csv, ".csv"}};
+  const std::map<FileType, std::string> reference_filenames{
+      {FileType::Binary, "bin/float.bin"}, {FileType::Csv, "csv/float.csv"}, {FileType::Arrow, "arrow/float.arrow"}};
+  const std::map<FileType, std::string> file_extensions{
+      {FileType::Binary, ".bin"}, {FileType::Csv, ".csv"}, {FileType::Arrow, ".arrow"}};
 };
 
 class OperatorsExportMultiFileTypeTest : public OperatorsExportTest, public ::testing::WithParamInterface<FileType> {};
@@ -58,7 +59,7 @@ auto export_test_formatter = [](const ::testing::TestParamInfo<FileType> info) {
 };
 
 INSTANTIATE_TEST_SUITE_P(FileTypes, OperatorsExportMultiFileTypeTest,
-                         ::testing::Values(FileType::Csv, FileType::Binary), export_test_formatter);
+                         ::testing::Values(FileType::Csv, FileType::Binary, FileType::Arrow), export_test_formatter);
 
 TEST_P(OperatorsExportMultiFileTypeTest, ExportWithFileType) {
   auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Float, false}}, TableType::Data, 5);
@@ -16,10 +16,12 @@ namespace opossum {
 class OperatorsImportTest : public BaseTest {
  protected:
   const std::string reference_filepath = "resources/test_data/";
-  const std::map<FileType, std::string> reference_filenames{
-      {FileType::Binary, "bin/float"}, {FileType::Tbl, "tbl/float"}, {FileType::Csv, "csv/float"}};
+  const std::map<FileType, std::string> reference_filenames{{FileType::Binary, "bin/float"},
+                                                            {FileType::Tbl, "tbl/float"},
+                                                            {FileType::Csv, "csv/float"},
+                                                            {FileType::Arrow, "arrow/float"}};
   const std::map<FileType, std::string> file_extensions{
-      {FileType::Binary, ".bin"}, {FileType::Tbl, ".tbl"}, {FileType::Csv, ".csv"}};
+      {FileType::Binary, ".bin"}, {FileType::Tbl, ".tbl"}, {FileType::Csv, ".csv"}, {FileType::Arrow, ".arrow"}};
 };
 
 class OperatorsImportMultiFileTypeTest : public OperatorsImportTest, public ::testing::WithParamInterface<FileType> {};
@@ -35,7 +37,8 @@ auto import_test_formatter = [](const ::testing::TestParamInfo<FileType> info) {
 };
 
 INSTANTIATE_TEST_SUITE_P(FileTypes, OperatorsImportMultiFileTypeTest,
-                         ::testing::Values(FileType::Csv, FileType::Tbl, FileType::Binary), import_test_formatter);
+                         ::testing::Values(FileType::Csv, FileType::Tbl, FileType::Binary, FileType::Arrow),
+                         import_test_formatter);
 
 TEST_P(OperatorsImportMultiFileTypeTest, ImportWithFileType) {
   auto expected_table =
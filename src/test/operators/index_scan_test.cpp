@@ -21,6 +21,8 @@
 #include "storage/index/b_tree/b_tree_index.hpp"
 #include "storage/index/group_key/composite_group_key_index.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
+#include "storage/index/table_hash/table_hash_index.hpp"
+#include "storage/reference_segment.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
 
@@ -308,4 +310,103 @@ TYPED_TEST(OperatorsIndexScanTest, AddedChunk) {
                             load_table("resources/test_data/tbl/int_int_shuffled_appended_and_filtered.tbl", 10));
 }
 
+class OperatorsIndexScanTableHashIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = load_table("resources/test_data/tbl/int_int_shuffled.tbl", 5);
+    ChunkEncoder::encode_chunks(_table, {ChunkID{0}});
+    _table->create_table_hash_index({ColumnID{0}});
+    _table->create_table_hash_index({ColumnID{1}});
+    _table->create_table_hash_index({ColumnID{1}, ColumnID{0}});
+    Hyrise::get().storage_manager.add_table("hash_index_table", _table);
+  }
+
+  std::shared_ptr<const Table> _table_scan(const std::shared_ptr<const AbstractOperator>& input,
+                                           const std::shared_ptr<AbstractExpression>& predicate) {
+    const auto table_scan = std::make_shared<TableScan>(input, predicate);
+    table_scan->execute();
+    return table_scan->get_output();
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(OperatorsIndexScanTableHashIndexTest, SingleColumnLookup) {
+  const auto get_table = std::make_shared<GetTable>("hash_index_table");
+  get_table->execute();
+
+  const auto a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+  for (const auto value : {0, 10, 12, 5}) {
+    const auto index_scan = std::make_shared<IndexScan>(get_table, std::vector<ColumnID>{ColumnID{0}},
+                                                        std::vector<AllTypeVariant>{value});
+    index_scan->execute();
+
+    EXPECT_TABLE_EQ_ORDERED(index_scan->get_output(), _table_scan(get_table, equals_(a, value)));
+  }
+
+  // Values of other types are cast to the column type if possible
+  auto index_scan = std::make_shared<IndexScan>(get_table, std::vector<ColumnID>{ColumnID{0}},
+                                                std::vector<AllTypeVariant>{int64_t{10}});
+  index_scan->execute();
+  EXPECT_EQ(index_scan->get_output()->row_count(), 2u);
+
+  index_scan = std::make_shared<IndexScan>(get_table, std::vector<ColumnID>{ColumnID{0}},
+                                           std::vector<AllTypeVariant>{10.5f});
+  index_scan->execute();
+  EXPECT_EQ(index_scan->get_output()->row_count(), 0u);
+}
+
+TEST_F(OperatorsIndexScanTableHashIndexTest, MultiColumnLookupWithPruning) {
+  // Prune chunk 0, which contains one of the two rows with a = 10
+  const auto get_table =
+      std::make_shared<GetTable>("hash_index_table", std::vector<ChunkID>{ChunkID{0}}, std::vector<ColumnID>{});
+  get_table->execute();
+
+  const auto index_scan = std::make_shared<IndexScan>(get_table, std::vector<ColumnID>{ColumnID{1}, ColumnID{0}},
+                                                      std::vector<AllTypeVariant>{110, 10});
+  index_scan->execute();
+
+  const auto& output = index_scan->get_output();
+  ASSERT_EQ(output->row_count(), 1u);
+  const auto segment =
+      std::dynamic_pointer_cast<const ReferenceSegment>(output->get_chunk(ChunkID{0})->get_segment(ColumnID{0}));
+  ASSERT_TRUE(segment);
+  EXPECT_EQ(segment->referenced_table(), _table);
+  EXPECT_EQ((*segment->pos_list())[0], (RowID{ChunkID{1}, ChunkOffset{1}}));
+
+  const auto pruned_get_table =
+      std::make_shared<GetTable>("hash_index_table", std::vector<ChunkID>{}, std::vector<ColumnID>{ColumnID{0}});
+  pruned_get_table->execute();
+
+  const auto pruned_index_scan = std::make_shared<IndexScan>(pruned_get_table, std::vector<ColumnID>{ColumnID{0}},
+                                                             std::vector<AllTypeVariant>{104});
+  pruned_index_scan->execute();
+  EXPECT_EQ(pruned_index_scan->get_output()->column_count(), 1u);
+  EXPECT_EQ(pruned_index_scan->get_output()->row_count(), 2u);
+  EXPECT_EQ(pruned_index_scan->get_output()->get_value<int32_t>(ColumnID{0}, 0u), 104);
+}
+
+TEST_F(OperatorsIndexScanTableHashIndexTest, LQPTranslation) {
+  const auto stored_table_node = StoredTableNode::make("hash_index_table");
+  const auto a = stored_table_node->get_column("a");
+  const auto b = stored_table_node->get_column("b");
+
+  auto predicate_node = PredicateNode::make(and_(equals_(b, 104), equals_(a, 4)), stored_table_node);
+  predicate_node->scan_type = ScanType::IndexScan;
+
+  const auto pqp = LQPTranslator{}.translate_node(predicate_node);
+  const auto index_scan = std::dynamic_pointer_cast<IndexScan>(pqp);
+  ASSERT_TRUE(index_scan);
+
+  // Rows added after the translation are found as well
+  _table->append({4, 104});
+
+  const auto get_table = std::dynamic_pointer_cast<GetTable>(index_scan->mutable_input_left());
+  ASSERT_TRUE(get_table);
+  get_table->execute();
+  index_scan->execute();
+
+  EXPECT_EQ(index_scan->get_output()->row_count(), 3u);
+}
+
 }  // namespace opossum
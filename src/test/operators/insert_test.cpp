@@ -108,6 +108,11 @@ TEST_F(OperatorsInsertTest, MultipleChunks) {
   EXPECT_EQ(table->get_chunk(ChunkID{1})->size(), 1u);
   EXPECT_EQ(table->get_chunk(ChunkID{6})->size(), 2u);
   EXPECT_EQ(table->row_count(), 13u);
+
+  // Only the modified chunks carry the CommitID of the insert
+  EXPECT_EQ(table->get_chunk(ChunkID{1})->mvcc_data()->last_commit_id(), CommitID{0});
+  EXPECT_EQ(table->get_chunk(ChunkID{2})->mvcc_data()->last_commit_id(), context->commit_id());
+  EXPECT_EQ(table->get_chunk(ChunkID{6})->mvcc_data()->last_commit_id(), context->commit_id());
 }
 
 TEST_F(OperatorsInsertTest, CompressedChunks) {
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <vector>
@@ -7,6 +8,7 @@
 #include "expression/expression_functional.hpp"
 #include "expression/pqp_column_expression.hpp"
 #include "hyrise.hpp"
+#include "operators/delete.hpp"
 #include "operators/get_table.hpp"
 #include "operators/projection.hpp"
 #include "operators/table_scan.hpp"
@@ -14,6 +16,7 @@
 #include "operators/validate.hpp"
 #include "statistics/table_statistics.hpp"
 #include "storage/table.hpp"
+#include "storage/versioned_segment.hpp"
 
 using namespace opossum::expression_functional;  // NOLINT
 
@@ -61,6 +64,36 @@ class OperatorsUpdateTest : public BaseTest {
     EXPECT_TABLE_EQ_UNORDERED(validate->get_output(), load_table(expected_result_path));
   }
 
+  std::shared_ptr<Update> make_update(const std::shared_ptr<AbstractExpression>& where_predicate,
+                                      const std::vector<std::shared_ptr<AbstractExpression>>& update_expressions,
+                                      const std::shared_ptr<TransactionContext>& transaction_context) {
+    const auto get_table = std::make_shared<GetTable>(table_to_update_name);
+    get_table->set_transaction_context(transaction_context);
+    const auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(transaction_context);
+    const auto where_scan = std::make_shared<TableScan>(validate, where_predicate);
+    const auto updated_values_projection = std::make_shared<Projection>(where_scan, update_expressions);
+
+    get_table->execute();
+    validate->execute();
+    where_scan->execute();
+    updated_values_projection->execute();
+
+    const auto update = std::make_shared<Update>(table_to_update_name, where_scan, updated_values_projection);
+    update->set_transaction_context(transaction_context);
+    return update;
+  }
+
+  std::shared_ptr<const Table> validated_table(const std::shared_ptr<TransactionContext>& transaction_context) {
+    const auto get_table = std::make_shared<GetTable>(table_to_update_name);
+    get_table->set_transaction_context(transaction_context);
+    const auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(transaction_context);
+    get_table->execute();
+    validate->execute();
+    return validate->get_output();
+  }
+
   std::string table_to_update_name{"updateTestTable"};
   inline static std::shared_ptr<AbstractExpression> column_a, column_b;
 };
@@ -83,4 +116,125 @@ TEST_F(OperatorsUpdateTest, UpdateNone) {
   helper(greater_than_(column_a, 100'000), expression_vector(1, 1.5f), "resources/test_data/tbl/int_float2.tbl");
 }
 
+TEST_F(OperatorsUpdateTest, InPlaceUpdate) {
+  const auto table = Hyrise::get().storage_manager.get_table(table_to_update_name);
+  table->set_allow_in_place_updates(true);
+
+  const auto old_transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+
+  helper(greater_than_(column_a, 100), expression_vector(column_a, 7.5f),
+         "resources/test_data/tbl/int_float2_updated_0.tbl");
+
+  // The rows were updated in place instead of being deleted and re-inserted
+  EXPECT_EQ(table->row_count(), 4);
+  EXPECT_EQ(table->chunk_count(), 2);
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    EXPECT_EQ(table->get_chunk(chunk_id)->invalid_row_count(), 0);
+    EXPECT_TRUE(table->get_chunk(chunk_id)->mvcc_data()->column_versions.has_versions());
+  }
+
+  // Transactions that started before the update still see the old values
+  EXPECT_TABLE_EQ_UNORDERED(validated_table(old_transaction_context),
+                            load_table("resources/test_data/tbl/int_float2.tbl"));
+}
+
+TEST_F(OperatorsUpdateTest, InPlaceUpdateGetTable) {
+  const auto table = Hyrise::get().storage_manager.get_table(table_to_update_name);
+  table->set_allow_in_place_updates(true);
+
+  helper(greater_than_(column_a, 100), expression_vector(column_a, 7.5f),
+         "resources/test_data/tbl/int_float2_updated_0.tbl");
+
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto get_table = [&](const std::vector<ColumnID>& chunk_pruning_column_ids) {
+    const auto get_table =
+        std::make_shared<GetTable>(table_to_update_name, std::vector<ChunkID>{ChunkID{0}}, std::vector<ColumnID>{},
+                                   chunk_pruning_column_ids);
+    get_table->set_transaction_context(transaction_context);
+    get_table->execute();
+    return get_table->get_output();
+  };
+
+  // Chunks that were pruned using the statistics of the updated column are kept
+  EXPECT_EQ(get_table({ColumnID{0}})->chunk_count(), 1);
+  EXPECT_EQ(get_table({ColumnID{1}})->chunk_count(), 2);
+
+  // The updated values are overlaid on the stored segments instead of copying them
+  const auto output = get_table({ColumnID{1}});
+  const auto segment = std::dynamic_pointer_cast<VersionedSegment<float>>(output->get_chunk(ChunkID{0})->get_segment(
+      ColumnID{1}));
+  ASSERT_TRUE(segment);
+  EXPECT_EQ(segment->main_segment(), table->get_chunk(ChunkID{0})->get_segment(ColumnID{1}));
+  EXPECT_EQ(output->get_chunk(ChunkID{0})->get_segment(ColumnID{0}),
+            table->get_chunk(ChunkID{0})->get_segment(ColumnID{0}));
+}
+
+TEST_F(OperatorsUpdateTest, InPlaceUpdateConflicts) {
+  Hyrise::get().storage_manager.get_table(table_to_update_name)->set_allow_in_place_updates(true);
+
+  const auto transaction_context_1 = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto transaction_context_2 = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto transaction_context_3 = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+
+  const auto update_1 = make_update(equals_(column_a, 123), expression_vector(column_a, 1.5f), transaction_context_1);
+  update_1->execute();
+  EXPECT_FALSE(update_1->execute_failed());
+
+  // A second update of the uncommitted row fails
+  const auto update_2 = make_update(equals_(column_a, 123), expression_vector(column_a, 2.5f), transaction_context_2);
+  update_2->execute();
+  EXPECT_TRUE(update_2->execute_failed());
+  transaction_context_2->rollback(RollbackReason::Conflict);
+
+  // A delete of the uncommitted row fails as well
+  const auto get_table = std::make_shared<GetTable>(table_to_update_name);
+  get_table->set_transaction_context(transaction_context_3);
+  const auto where_scan = std::make_shared<TableScan>(get_table, equals_(column_a, 123));
+  get_table->execute();
+  where_scan->execute();
+  const auto delete_op = std::make_shared<Delete>(where_scan);
+  delete_op->set_transaction_context(transaction_context_3);
+  delete_op->execute();
+  EXPECT_TRUE(delete_op->execute_failed());
+  transaction_context_3->rollback(RollbackReason::Conflict);
+
+  // Transactions whose snapshot does not include the committed update cannot update the row (first updater wins)
+  const auto transaction_context_4 = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  transaction_context_1->commit();
+
+  const auto update_4 = make_update(equals_(column_a, 123), expression_vector(column_a, 3.5f), transaction_context_4);
+  update_4->execute();
+  EXPECT_TRUE(update_4->execute_failed());
+  transaction_context_4->rollback(RollbackReason::Conflict);
+
+  const auto transaction_context_5 = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto update_5 = make_update(equals_(column_a, 123), expression_vector(column_a, 4.5f), transaction_context_5);
+  update_5->execute();
+  EXPECT_FALSE(update_5->execute_failed());
+  transaction_context_5->commit();
+
+  const auto validated = validated_table(Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No));
+  EXPECT_EQ(validated->row_count(), 4);
+  const auto rows = validated->get_rows();
+  EXPECT_NE(std::find(rows.begin(), rows.end(), std::vector<AllTypeVariant>{123, 4.5f}), rows.end());
+}
+
+TEST_F(OperatorsUpdateTest, InPlaceUpdateRollback) {
+  const auto table = Hyrise::get().storage_manager.get_table(table_to_update_name);
+  table->set_allow_in_place_updates(true);
+
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto update = make_update(greater_than_(column_a, 100), expression_vector(column_a, 7.5f), transaction_context);
+  update->execute();
+  EXPECT_TABLE_EQ_UNORDERED(validated_table(transaction_context),
+                            load_table("resources/test_data/tbl/int_float2_updated_0.tbl"));
+  transaction_context->rollback(RollbackReason::User);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    EXPECT_FALSE(table->get_chunk(chunk_id)->mvcc_data()->column_versions.has_versions());
+  }
+  EXPECT_TABLE_EQ_UNORDERED(validated_table(Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No)),
+                            load_table("resources/test_data/tbl/int_float2.tbl"));
+}
+
 }  // namespace opossum
@@ -238,4 +238,82 @@ TEST_F(OperatorsValidateTest, ValidateReferenceSegmentWithMultipleChunks) {
   EXPECT_TABLE_EQ_UNORDERED(validate->get_output(), expected_result);
 }
 
+TEST_F(OperatorsValidateTest, ValidateRowsOfDataChunk) {
+  // Chunk that is large enough to be processed in vectorized batches and a scalar remainder
+  const auto our_tid = TransactionID{5};
+  const auto snapshot_cid = CommitID{3};
+  const auto row_count = ChunkOffset{21};
+
+  auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data,
+                                       ChunkOffset{100}, UseMvcc::Yes);
+  for (auto value = int32_t{0}; value < static_cast<int32_t>(row_count); ++value) {
+    table->append({value});
+  }
+
+  const auto tids = std::vector<TransactionID>{0u, our_tid, 7u};
+  const auto cids = std::vector<CommitID>{0u, 3u, 4u, MvccData::MAX_COMMIT_ID};
+  const auto mvcc_data = table->get_chunk(ChunkID{0})->mvcc_data();
+  auto expected_chunk_offsets = std::vector<ChunkOffset>{};
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+    const auto tid = tids[chunk_offset % tids.size()];
+    const auto begin_cid = cids[chunk_offset % cids.size()];
+    const auto end_cid = cids[(chunk_offset / cids.size() + 1) % cids.size()];
+    mvcc_data->set_tid(chunk_offset, tid);
+    mvcc_data->set_begin_cid(chunk_offset, begin_cid);
+    mvcc_data->set_end_cid(chunk_offset, end_cid);
+    if (Validate::is_row_visible(our_tid, snapshot_cid, tid, begin_cid, end_cid)) {
+      expected_chunk_offsets.emplace_back(chunk_offset);
+    }
+  }
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  const auto validate = std::make_shared<Validate>(table_wrapper);
+  validate->set_transaction_context(std::make_shared<TransactionContext>(our_tid, snapshot_cid, AutoCommit::No));
+  validate->execute();
+
+  const auto& output = validate->get_output();
+  ASSERT_EQ(output->chunk_count(), 1);
+  const auto& pos_list =
+      std::static_pointer_cast<const ReferenceSegment>(output->get_chunk(ChunkID{0})->get_segment(ColumnID{0}))
+          ->pos_list();
+  auto chunk_offsets = std::vector<ChunkOffset>{};
+  for (const auto& row_id : *pos_list) {
+    chunk_offsets.emplace_back(row_id.chunk_offset);
+  }
+  EXPECT_EQ(chunk_offsets, expected_chunk_offsets);
+}
+
+TEST_F(OperatorsValidateTest, ChunkEntirelyVisibleWithDeleteInOtherChunk) {
+  const auto context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto table = Hyrise::get().storage_manager.get_table(_table2_name);
+  ASSERT_GT(table->chunk_count(), 1);
+
+  // Delete a row of the first chunk
+  auto pos_list = std::make_shared<RowIDPosList>();
+  pos_list->emplace_back(RowID{ChunkID{0}, ChunkOffset{0}});
+  auto segments = Segments{};
+  for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+    segments.emplace_back(std::make_shared<ReferenceSegment>(table, column_id, pos_list));
+  }
+  auto reference_table = std::make_shared<Table>(table->column_definitions(), TableType::References);
+  reference_table->append_chunk(segments);
+  const auto table_wrapper = std::make_shared<TableWrapper>(reference_table);
+  table_wrapper->execute();
+
+  const auto delete_op = std::make_shared<Delete>(table_wrapper);
+  delete_op->set_transaction_context(context);
+  delete_op->execute();
+
+  const auto validate = std::make_shared<Validate>(_gt);
+  validate->set_transaction_context(context);
+  validate->execute();
+  EXPECT_EQ(validate->get_output()->row_count(), table->row_count() - 1);
+
+  // Only the chunk with the deleted row needs to be validated row by row
+  EXPECT_FALSE(forward_is_entire_chunk_visible(validate, table->get_chunk(ChunkID{0}), context->snapshot_commit_id()));
+  EXPECT_TRUE(forward_is_entire_chunk_visible(validate, table->get_chunk(ChunkID{1}), context->snapshot_commit_id()));
+  context->commit();
+}
+
 }  // namespace opossum
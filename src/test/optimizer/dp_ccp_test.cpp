@@ -240,4 +240,21 @@ TEST_F(DpCcpTest, UncorrelatedPredicates) {
   EXPECT_LQP_EQ(actual_lqp, expected_lqp);
 }
 
+TEST_F(DpCcpTest, CsgCmpPairBudgetExceeded) {
+  /**
+   * Test that DpCcp gives up without building a plan if the JoinGraph has more CsgCmpPairs than allowed. The triangle
+   * A-B-C has six CsgCmpPairs.
+   */
+
+  const auto join_edge_a_b = JoinGraphEdge{JoinGraphVertexSet{3, 0b011}, expression_vector(equals_(a_a, b_a))};
+  const auto join_edge_a_c = JoinGraphEdge{JoinGraphVertexSet{3, 0b101}, expression_vector(equals_(a_a, c_a))};
+  const auto join_edge_b_c = JoinGraphEdge{JoinGraphVertexSet{3, 0b110}, expression_vector(equals_(b_a, c_a))};
+
+  const auto join_graph = JoinGraph(std::vector<std::shared_ptr<AbstractLQPNode>>({node_a, node_b, node_c}),
+                                    std::vector<JoinGraphEdge>({join_edge_a_b, join_edge_a_c, join_edge_b_c}));
+
+  EXPECT_EQ(DpCcp{5}(join_graph, cost_estimator), nullptr);  // NOLINT
+  EXPECT_NE(DpCcp{6}(join_graph, cost_estimator), nullptr);  // NOLINT
+}
+
 }  // namespace opossum
@@ -164,4 +164,27 @@ TEST_F(EnumerateCcpTest, ArbitraryVertexNumbering) {
   EXPECT_TRUE(equals(pairs[3], std::make_pair(0b101ul, 0b010ul)));
 }
 
+TEST_F(EnumerateCcpTest, Budget) {
+  // The chain has 10 CCPs, see above
+  std::vector<std::pair<size_t, size_t>> chain_edges{{0, 1}, {1, 2}, {2, 3}};
+
+  auto enumerate_ccp_within_budget = EnumerateCcp{4, chain_edges, 10};
+  EXPECT_EQ(enumerate_ccp_within_budget().size(), 10u);
+  EXPECT_FALSE(enumerate_ccp_within_budget.budget_exceeded());
+
+  auto enumerate_ccp_over_budget = EnumerateCcp{4, chain_edges, 9};
+  EXPECT_TRUE(enumerate_ccp_over_budget().empty());
+  EXPECT_TRUE(enumerate_ccp_over_budget.budget_exceeded());
+
+  // A star with 20 vertices has 19 * 2^18 CCPs, the enumeration has to stop long before visiting all of them
+  std::vector<std::pair<size_t, size_t>> star_edges;
+  for (auto vertex_idx = size_t{1}; vertex_idx < 20; ++vertex_idx) {
+    star_edges.emplace_back(0, vertex_idx);
+  }
+
+  auto enumerate_ccp_star = EnumerateCcp{20, star_edges, 1'000};
+  EXPECT_TRUE(enumerate_ccp_star().empty());
+  EXPECT_TRUE(enumerate_ccp_star.budget_exceeded());
+}
+
 }  // namespace opossum
@@ -0,0 +1,153 @@
+#include "base_test.hpp"
+
+#include "cost_estimation/cost_estimator_logical.hpp"
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "optimizer/join_ordering/dp_ccp.hpp"
+#include "optimizer/join_ordering/join_graph.hpp"
+#include "optimizer/join_ordering/linearized_dp.hpp"
+#include "statistics/cardinality_estimator.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class LinearizedDpTest : public BaseTest {
+ public:
+  void SetUp() override {
+    cardinality_estimator = std::make_shared<CardinalityEstimator>();
+    cost_estimator = std::make_shared<CostEstimatorLogical>(cardinality_estimator);
+
+    // All columns have the same statistics, only Table row counts differ
+    const auto single_bin_histogram_a = GenericHistogram<int32_t>::with_single_bin(0, 100, 5'000, 100);
+    const auto single_bin_histogram_b = GenericHistogram<int32_t>::with_single_bin(0, 100, 1'000, 100);
+    const auto single_bin_histogram_c = GenericHistogram<int32_t>::with_single_bin(0, 100, 200, 100);
+    const auto single_bin_histogram_d = GenericHistogram<int32_t>::with_single_bin(0, 100, 500, 100);
+
+    node_a =
+        create_mock_node_with_statistics(MockNode::ColumnDefinitions{{DataType::Int, "a_a"}, {DataType::Int, "a_b"}},
+                                         5'000, {single_bin_histogram_a, single_bin_histogram_a});
+    node_b = create_mock_node_with_statistics(MockNode::ColumnDefinitions{{DataType::Int, "b_a"}}, 1'000,
+                                              {single_bin_histogram_b});
+    node_c = create_mock_node_with_statistics(MockNode::ColumnDefinitions{{DataType::Int, "c_a"}}, 200,
+                                              {single_bin_histogram_c});
+    node_d = create_mock_node_with_statistics(MockNode::ColumnDefinitions{{DataType::Int, "d_a"}}, 500,
+                                              {single_bin_histogram_d});
+
+    a_a = node_a->get_column("a_a");
+    b_a = node_b->get_column("b_a");
+    c_a = node_c->get_column("c_a");
+    d_a = node_d->get_column("d_a");
+  }
+
+  static std::vector<size_t> linearize(const std::vector<float>& cardinalities,
+                                       const std::vector<std::vector<std::pair<size_t, float>>>& tree_edges) {
+    return LinearizedDp::_linearize(cardinalities, tree_edges);
+  }
+
+  std::shared_ptr<MockNode> node_a, node_b, node_c, node_d;
+  std::shared_ptr<LQPColumnExpression> a_a, b_a, c_a, d_a;
+  std::shared_ptr<AbstractCostEstimator> cost_estimator;
+  std::shared_ptr<AbstractCardinalityEstimator> cardinality_estimator;
+};
+
+TEST_F(LinearizedDpTest, NoEdges) {
+  const auto join_graph =
+      JoinGraph{std::vector<std::shared_ptr<AbstractLQPNode>>{node_a}, std::vector<JoinGraphEdge>{}};
+
+  const auto actual_lqp = LinearizedDp{}(join_graph, cost_estimator);  // NOLINT
+  const auto expected_lqp = node_a->deep_copy();
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(LinearizedDpTest, LinearizeChain) {
+  // 0 - 1 - 2: Joining 1 and 2 first is very selective, the large vertex 0 comes last
+  const auto order = linearize({10, 100, 1000}, {{{1, 0.1f}}, {{0, 0.1f}, {2, 0.0001f}}, {{1, 0.0001f}}});
+
+  EXPECT_EQ(order, std::vector<size_t>({1, 2, 0}));
+}
+
+TEST_F(LinearizedDpTest, LinearizeStar) {
+  // Star with center 0: the satellites are ordered by how much they reduce the intermediate result
+  const auto order = linearize({10, 100, 2000, 10}, {{{1, 0.1f}, {2, 0.0001f}, {3, 0.5f}}, {{0, 0.1f}}, {{0, 0.0001f}},
+                                                      {{0, 0.5f}}});
+
+  EXPECT_EQ(order, std::vector<size_t>({0, 2, 3, 1}));
+}
+
+TEST_F(LinearizedDpTest, ChainQuery) {
+  // Same query as in GreedyOperatorOrderingTest. LinearizedDp finds a plan as cheap as the one DpCcp finds.
+
+  const auto edge_a = JoinGraphEdge{JoinGraphVertexSet{4, 0b0001}, expression_vector(greater_than_(a_a, 0))};
+  const auto edge_ab = JoinGraphEdge{JoinGraphVertexSet{4, 0b0011}, expression_vector(equals_(a_a, b_a))};
+  const auto edge_bc = JoinGraphEdge{JoinGraphVertexSet{4, 0b0110}, expression_vector(equals_(b_a, c_a))};
+  const auto edge_cd = JoinGraphEdge{JoinGraphVertexSet{4, 0b1100}, expression_vector(equals_(c_a, d_a))};
+
+  const auto join_graph = JoinGraph{std::vector<std::shared_ptr<AbstractLQPNode>>{node_a, node_b, node_c, node_d},
+                                    std::vector<JoinGraphEdge>{edge_a, edge_ab, edge_bc, edge_cd}};
+
+  const auto actual_lqp = LinearizedDp{}(join_graph, cost_estimator);  // NOLINT
+
+  // clang-format off
+  const auto expected_lqp =
+  JoinNode::make(JoinMode::Inner, equals_(a_a, b_a),
+    JoinNode::make(JoinMode::Inner, equals_(b_a, c_a),
+      JoinNode::make(JoinMode::Inner, equals_(c_a, d_a),
+        node_d,
+        node_c),
+      node_b),
+    PredicateNode::make(greater_than_(a_a, 0),
+      node_a));
+  // clang-format on
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+  EXPECT_EQ(cost_estimator->estimate_plan_cost(actual_lqp),
+            cost_estimator->estimate_plan_cost(DpCcp{}(join_graph, cost_estimator)));  // NOLINT
+}
+
+TEST_F(LinearizedDpTest, LargeStarQuery) {
+  // A star with 16 vertices has too many CsgCmpPairs for DpCcp with a budget, but LinearizedDp handles it
+
+  auto vertices = std::vector<std::shared_ptr<AbstractLQPNode>>{};
+  auto columns = std::vector<std::shared_ptr<LQPColumnExpression>>{};
+  for (auto vertex_idx = size_t{0}; vertex_idx < 16; ++vertex_idx) {
+    const auto row_count = 100 * (vertex_idx + 1);
+    const auto vertex = create_mock_node_with_statistics(
+        MockNode::ColumnDefinitions{{DataType::Int, "a"}}, row_count,
+        {GenericHistogram<int32_t>::with_single_bin(0, 100, static_cast<HistogramCountType>(row_count), 100)});
+    vertices.emplace_back(vertex);
+    columns.emplace_back(vertex->get_column("a"));
+  }
+
+  auto edges = std::vector<JoinGraphEdge>{};
+  for (auto vertex_idx = size_t{1}; vertex_idx < 16; ++vertex_idx) {
+    auto vertex_set = JoinGraphVertexSet{16};
+    vertex_set.set(0);
+    vertex_set.set(vertex_idx);
+    edges.emplace_back(vertex_set, expression_vector(equals_(columns[0], columns[vertex_idx])));
+  }
+
+  const auto join_graph = JoinGraph{vertices, edges};
+
+  EXPECT_EQ(DpCcp{5'000}(join_graph, cost_estimator), nullptr);  // NOLINT
+
+  const auto actual_lqp = LinearizedDp{}(join_graph, cost_estimator);  // NOLINT
+  ASSERT_TRUE(actual_lqp);
+
+  auto join_count = size_t{0};
+  visit_lqp(actual_lqp, [&](const auto& node) {
+    if (node->type == LQPNodeType::Join) {
+      const auto& join_node = static_cast<const JoinNode&>(*node);
+      EXPECT_EQ(join_node.join_mode, JoinMode::Inner);
+      ++join_count;
+    }
+    return LQPVisitation::VisitInputs;
+  });
+  EXPECT_EQ(join_count, 15u);
+}
+
+}  // namespace opossum
@@ -1,3 +1,6 @@
+#include <chrono>
+#include <thread>
+
 #include "base_test.hpp"
 
 #include "expression/expression_functional.hpp"
@@ -9,7 +12,9 @@
 #include "logical_query_plan/predicate_node.hpp"
 #include "logical_query_plan/projection_node.hpp"
 #include "logical_query_plan/sort_node.hpp"
+#include "hyrise.hpp"
 #include "optimizer/optimizer.hpp"
+#include "optimizer/optimizer_rule_statistics.hpp"
 #include "optimizer/strategy/abstract_rule.hpp"
 
 using namespace opossum::expression_functional;  // NOLINT
@@ -110,6 +115,8 @@ TEST_F(OptimizerTest, VerifiesResults) {
     explicit LQPBreakingRule(const std::shared_ptr<AbstractExpression>& init_out_of_plan_expression)
         : out_of_plan_expression(init_out_of_plan_expression) {}
 
+    std::string name() const override { return "LQPBreakingRule"; }
+
     void apply_to(const std::shared_ptr<AbstractLQPNode>& root) const override {
       // Change the `b` expression in the projection to `x`, which is not part of the input LQP
       const auto projection_node = std::dynamic_pointer_cast<ProjectionNode>(root->left_input());
@@ -137,6 +144,8 @@ TEST_F(OptimizerTest, OptimizesSubqueries) {
    public:
     explicit MockRule(std::unordered_set<std::shared_ptr<AbstractLQPNode>>& init_nodes) : nodes(init_nodes) {}
 
+    std::string name() const override { return "MockRule"; }
+
     void apply_to(const std::shared_ptr<AbstractLQPNode>& root) const override {
       nodes.emplace(root);
       _apply_to_inputs(root);
@@ -216,6 +225,8 @@ TEST_F(OptimizerTest, OptimizesSubqueriesExactlyOnce) {
    public:
     explicit MockRule(size_t& init_counter) : counter(init_counter) {}
 
+    std::string name() const override { return "MockRule"; }
+
     void apply_to(const std::shared_ptr<AbstractLQPNode>& root) const override { ++counter; }
 
     size_t& counter;
@@ -260,4 +271,87 @@ TEST_F(OptimizerTest, OptimizesSubqueriesExactlyOnce) {
   }
 }
 
+TEST_F(OptimizerTest, RuleMetricsAndTimeBudget) {
+  // A rule that takes a long time
+  class SlowRule : public AbstractRule {
+   public:
+    std::string name() const override { return "SlowRule"; }
+
+    void apply_to(const std::shared_ptr<AbstractLQPNode>& root) const override {
+      std::this_thread::sleep_for(std::chrono::milliseconds{20});
+    }
+  };
+
+  class MockRule : public AbstractRule {
+   public:
+    explicit MockRule(size_t& init_counter) : counter(init_counter) {}
+
+    std::string name() const override { return "MockRule"; }
+
+    void apply_to(const std::shared_ptr<AbstractLQPNode>& root) const override { ++counter; }
+
+    size_t& counter;
+  };
+
+  auto counter = size_t{0};
+
+  // Without a budget, all rules are applied and their durations are not recorded
+  {
+    Optimizer optimizer{};
+    optimizer.add_rule(std::make_unique<SlowRule>());
+    optimizer.add_rule(std::make_unique<MockRule>(counter));
+
+    auto rule_metrics = std::make_shared<std::vector<OptimizerRuleMetrics>>();
+    optimizer.optimize(node_a->deep_copy(), rule_metrics);
+    EXPECT_EQ(counter, 1u);
+    ASSERT_EQ(rule_metrics->size(), 2u);
+    EXPECT_EQ(rule_metrics->at(0).rule_name, "SlowRule");
+    EXPECT_GE(rule_metrics->at(0).duration, std::chrono::milliseconds{20});
+    EXPECT_FALSE(rule_metrics->at(0).skipped);
+    EXPECT_EQ(rule_metrics->at(1).rule_name, "MockRule");
+    EXPECT_FALSE(rule_metrics->at(1).skipped);
+    EXPECT_FALSE(Hyrise::get().optimizer_rule_statistics->average_duration("SlowRule"));
+  }
+
+  Optimizer optimizer{std::make_shared<CostEstimatorLogical>(std::make_shared<CardinalityEstimator>()),
+                      std::chrono::milliseconds{10}};
+  optimizer.add_rule(std::make_unique<SlowRule>());
+  optimizer.add_rule(std::make_unique<MockRule>(counter));
+
+  // The duration of SlowRule is not known yet, so it is applied. Afterwards, the budget is exhausted.
+  auto rule_metrics = std::make_shared<std::vector<OptimizerRuleMetrics>>();
+  optimizer.optimize(node_a->deep_copy(), rule_metrics);
+  EXPECT_EQ(counter, 1u);
+  ASSERT_EQ(rule_metrics->size(), 2u);
+  EXPECT_FALSE(rule_metrics->at(0).skipped);
+  EXPECT_TRUE(rule_metrics->at(1).skipped);
+
+  // SlowRule is known to take longer than the budget and is skipped
+  rule_metrics->clear();
+  optimizer.optimize(node_a->deep_copy(), rule_metrics);
+  EXPECT_EQ(counter, 2u);
+  ASSERT_EQ(rule_metrics->size(), 2u);
+  EXPECT_TRUE(rule_metrics->at(0).skipped);
+  EXPECT_EQ(rule_metrics->at(0).duration, std::chrono::nanoseconds{0});
+  EXPECT_FALSE(rule_metrics->at(1).skipped);
+
+  // The durations are shared with other Optimizers, e.g., those created for later statements
+  Optimizer other_optimizer{std::make_shared<CostEstimatorLogical>(std::make_shared<CardinalityEstimator>()),
+                            std::chrono::milliseconds{10}};
+  other_optimizer.add_rule(std::make_unique<SlowRule>());
+  other_optimizer.add_rule(std::make_unique<MockRule>(counter));
+
+  rule_metrics->clear();
+  other_optimizer.optimize(node_a->deep_copy(), rule_metrics);
+  EXPECT_EQ(counter, 3u);
+  ASSERT_EQ(rule_metrics->size(), 2u);
+  EXPECT_TRUE(rule_metrics->at(0).skipped);
+  EXPECT_FALSE(rule_metrics->at(1).skipped);
+
+  const auto& rule_statistics = Hyrise::get().optimizer_rule_statistics;
+  ASSERT_TRUE(rule_statistics->average_duration("SlowRule"));
+  EXPECT_GE(*rule_statistics->average_duration("SlowRule"), std::chrono::milliseconds{20});
+  EXPECT_FALSE(rule_statistics->average_duration("UnknownRule"));
+}
+
 }  // namespace opossum
@@ -23,6 +23,7 @@
 #include "statistics/generate_pruning_statistics.hpp"
 #include "storage/chunk.hpp"
 #include "storage/chunk_encoder.hpp"
+#include "storage/mvcc_data.hpp"
 #include "storage/table.hpp"
 
 using namespace opossum::expression_functional;  // NOLINT
@@ -79,6 +80,7 @@ TEST_F(ChunkPruningRuleTest, SimplePruningTest) {
   std::vector<ChunkID> expected_chunk_ids = {ChunkID{1}};
   std::vector<ChunkID> pruned_chunk_ids = stored_table_node->pruned_chunk_ids();
   EXPECT_EQ(pruned_chunk_ids, expected_chunk_ids);
+  EXPECT_EQ(stored_table_node->chunk_pruning_column_ids(), std::vector<ColumnID>{ColumnID{0}});
 
   EXPECT_TRUE(stored_table_node->table_statistics);
 
@@ -337,6 +339,24 @@ TEST_F(ChunkPruningRuleTest, PrunePastNonFilteringNodes) {
   EXPECT_EQ(pruned_chunk_ids, expected_chunk_ids);
 }
 
+TEST_F(ChunkPruningRuleTest, UpdatedColumnsAreNotUsedForPruning) {
+  // The pruning statistics of the first chunk do not reflect a value that was updated in place
+  const auto table = Hyrise::get().storage_manager.get_table("compressed");
+  auto& column_versions = table->get_chunk(ChunkID{1})->mvcc_data()->column_versions;
+  EXPECT_TRUE(column_versions.try_add_versions(ChunkOffset{0}, {{ColumnID{0}, 300}}, TransactionID{5}, CommitID{1}));
+
+  auto stored_table_node = std::make_shared<StoredTableNode>("compressed");
+
+  auto predicate_node =
+      std::make_shared<PredicateNode>(greater_than_(lqp_column_(stored_table_node, ColumnID{0}), 200));
+  predicate_node->set_left_input(stored_table_node);
+
+  StrategyBaseTest::apply_rule(_rule, predicate_node);
+
+  EXPECT_TRUE(stored_table_node->pruned_chunk_ids().empty());
+  EXPECT_TRUE(stored_table_node->chunk_pruning_column_ids().empty());
+}
+
 TEST_F(ChunkPruningRuleTest, ValueOutOfRange) {
   // Filters are not required to handle values out of their data type's range and the ColumnPruningRule currently
   // doesn't convert out-of-range values into the type's range
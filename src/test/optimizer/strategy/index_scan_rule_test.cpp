@@ -13,6 +13,7 @@
 #include "logical_query_plan/mock_node.hpp"
 #include "logical_query_plan/predicate_node.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
 #include "optimizer/strategy/index_scan_rule.hpp"
 #include "optimizer/strategy/strategy_base_test.hpp"
 #include "statistics/attribute_statistics.hpp"
@@ -22,6 +23,7 @@
 #include "storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
 #include "storage/index/group_key/composite_group_key_index.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
+#include "storage/index/table_hash/table_hash_index.hpp"
 
 using namespace opossum::expression_functional;  // NOLINT
 
@@ -177,4 +179,44 @@ TEST_F(IndexScanRuleTest, IndexScanOnlyOnOutputOfStoredTableNode) {
   EXPECT_EQ(predicate_node_1->scan_type, ScanType::TableScan);
 }
 
+TEST_F(IndexScanRuleTest, TableHashIndexLookupMergesKeyPredicates) {
+  table->create_table_hash_index({ColumnID{0}, ColumnID{1}});
+
+  // clang-format off
+  const auto input_lqp =
+  PredicateNode::make(equals_(b, 10),
+    ValidateNode::make(
+      PredicateNode::make(equals_(a, 9),
+        PredicateNode::make(greater_than_(c, 5),
+          stored_table_node))));
+  // clang-format on
+
+  const auto actual_lqp = StrategyBaseTest::apply_rule(rule, input_lqp);
+
+  // clang-format off
+  const auto expected_lqp =
+  ValidateNode::make(
+    PredicateNode::make(greater_than_(c, 5),
+      PredicateNode::make(and_(equals_(a, 9), equals_(b, 10)),
+        stored_table_node)));
+  // clang-format on
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+  const auto lookup_node = std::dynamic_pointer_cast<PredicateNode>(actual_lqp->left_input()->left_input());
+  ASSERT_TRUE(lookup_node);
+  EXPECT_EQ(lookup_node->scan_type, ScanType::IndexScan);
+}
+
+TEST_F(IndexScanRuleTest, NoTableHashIndexLookupWithoutAllKeyColumns) {
+  table->create_table_hash_index({ColumnID{0}, ColumnID{1}});
+
+  auto predicate_node_0 = PredicateNode::make(equals_(a, 9), stored_table_node);
+  auto predicate_node_1 = PredicateNode::make(greater_than_(b, 9), predicate_node_0);
+
+  const auto actual_lqp = StrategyBaseTest::apply_rule(rule, predicate_node_1);
+  EXPECT_EQ(actual_lqp, predicate_node_1);
+  EXPECT_EQ(predicate_node_0->scan_type, ScanType::TableScan);
+  EXPECT_EQ(predicate_node_1->scan_type, ScanType::TableScan);
+}
+
 }  // namespace opossum
@@ -0,0 +1,213 @@
+#include "strategy_base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/alias_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
+#include "optimizer/strategy/materialized_view_rule.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "sql/sql_plan_cache.hpp"
+#include "storage/materialized_view.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class MaterializedViewRuleTest : public StrategyBaseTest {
+ public:
+  void SetUp() override {
+    auto& storage_manager = Hyrise::get().storage_manager;
+    storage_manager.add_table("table_a", load_table("resources/test_data/tbl/int_int2.tbl", 2));
+
+    stored_table_node = StoredTableNode::make("table_a");
+    a = stored_table_node->get_column("a");
+    b = stored_table_node->get_column("b");
+
+    // mv: SELECT a, SUM(b) AS sum_b FROM table_a GROUP BY a
+    const auto view_stored_table_node = StoredTableNode::make("table_a");
+    const auto view_lqp = AggregateNode::make(expression_vector(view_stored_table_node->get_column("a")),
+                                              expression_vector(sum_(view_stored_table_node->get_column("b"))),
+                                              ValidateNode::make(view_stored_table_node));
+    storage_manager.add_materialized_view(
+        "mv", std::make_shared<LQPView>(view_lqp, std::unordered_map<ColumnID, std::string>{{ColumnID{1}, "sum_b"}}));
+
+    view_node = StoredTableNode::make("mv");
+    view_a = view_node->get_column("a");
+    view_sum_b = view_node->get_column("sum_b");
+
+    rule = std::make_shared<MaterializedViewRule>();
+  }
+
+  static bool reads_table(const std::shared_ptr<AbstractLQPNode>& lqp, const std::string& table_name) {
+    auto reads_table = false;
+    visit_lqp(lqp, [&](const auto& node) {
+      if (node->type == LQPNodeType::StoredTable) {
+        reads_table |= static_cast<const StoredTableNode&>(*node).table_name == table_name;
+      }
+      return LQPVisitation::VisitInputs;
+    });
+    return reads_table;
+  }
+
+  std::shared_ptr<StoredTableNode> stored_table_node, view_node;
+  std::shared_ptr<LQPColumnExpression> a, b, view_a, view_sum_b;
+  std::shared_ptr<MaterializedViewRule> rule;
+};
+
+TEST_F(MaterializedViewRuleTest, ReplacesMatchingSubplan) {
+  // clang-format off
+  const auto input_lqp =
+  ProjectionNode::make(expression_vector(sum_(b), a),
+    PredicateNode::make(greater_than_(sum_(b), 10),
+      AggregateNode::make(expression_vector(a), expression_vector(sum_(b)),
+        ValidateNode::make(
+          stored_table_node))));
+
+  const auto expected_lqp =
+  ProjectionNode::make(expression_vector(view_sum_b, view_a),
+    PredicateNode::make(greater_than_(view_sum_b, 10),
+      AliasNode::make(expression_vector(view_a, view_sum_b), std::vector<std::string>{"a", "SUM(b)"},
+        ValidateNode::make(
+          view_node))));
+  // clang-format on
+
+  const auto snapshot_scope = MaterializedViewRule::SnapshotScope{Hyrise::get().transaction_manager.last_commit_id()};
+  const auto actual_lqp = apply_rule(rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+  EXPECT_TRUE(snapshot_scope.used_views());
+}
+
+TEST_F(MaterializedViewRuleTest, RequiresSnapshot) {
+  // clang-format off
+  const auto input_lqp =
+  AggregateNode::make(expression_vector(a), expression_vector(sum_(b)),
+    ValidateNode::make(
+      stored_table_node));
+  // clang-format on
+
+  const auto expected_lqp = input_lqp->deep_copy();
+  const auto actual_lqp = apply_rule(rule, input_lqp);
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(MaterializedViewRuleTest, KeepsOtherPlans) {
+  // clang-format off
+  const auto other_aggregate_lqp =
+  AggregateNode::make(expression_vector(a), expression_vector(max_(b)),
+    ValidateNode::make(
+      stored_table_node));
+
+  const auto other_input_lqp =
+  AggregateNode::make(expression_vector(a), expression_vector(sum_(b)),
+    PredicateNode::make(greater_than_(b, 0),
+      ValidateNode::make(
+        stored_table_node)));
+
+  // Plans that read the stored table without validation are not rewritten either
+  const auto unvalidated_lqp =
+  AggregateNode::make(expression_vector(a), expression_vector(sum_(b)),
+    stored_table_node);
+  // clang-format on
+
+  const auto snapshot_scope = MaterializedViewRule::SnapshotScope{Hyrise::get().transaction_manager.last_commit_id()};
+  for (const auto& input_lqp : {other_aggregate_lqp, other_input_lqp, unvalidated_lqp}) {
+    const auto expected_lqp = input_lqp->deep_copy();
+    const auto actual_lqp = apply_rule(rule, input_lqp);
+    EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+  }
+}
+
+TEST_F(MaterializedViewRuleTest, IgnoresOutdatedViews) {
+  auto& storage_manager = Hyrise::get().storage_manager;
+  storage_manager.drop_table("table_a");
+  storage_manager.add_table("table_a", load_table("resources/test_data/tbl/int_int.tbl", 2));
+  const auto snapshot_commit_id = Hyrise::get().transaction_manager.last_commit_id();
+  EXPECT_FALSE(storage_manager.get_materialized_view("mv")->is_up_to_date(snapshot_commit_id));
+
+  // clang-format off
+  const auto input_lqp =
+  AggregateNode::make(expression_vector(a), expression_vector(sum_(b)),
+    ValidateNode::make(
+      stored_table_node));
+  // clang-format on
+
+  const auto expected_lqp = input_lqp->deep_copy();
+  const auto snapshot_scope = MaterializedViewRule::SnapshotScope{snapshot_commit_id};
+  const auto actual_lqp = apply_rule(rule, input_lqp);
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+  EXPECT_FALSE(snapshot_scope.used_views());
+}
+
+TEST_F(MaterializedViewRuleTest, UsedByDefaultOptimizer) {
+  const auto query = "SELECT a, b FROM table_a WHERE b > 1";
+  const auto view_lqp = SQLPipelineBuilder{query}.create_pipeline().get_unoptimized_logical_plans().at(0);
+  Hyrise::get().storage_manager.add_materialized_view(
+      "mv_b", std::make_shared<LQPView>(view_lqp, std::unordered_map<ColumnID, std::string>{}));
+
+  // Updates are reflected in the view before the next query reads it
+  SQLPipelineBuilder{"INSERT INTO table_a VALUES (3, 4)"}.create_pipeline().get_result_table();
+
+  // Plans that read views are only valid for the snapshot they were optimized for and are not cached
+  const auto lqp_cache = std::make_shared<SQLLogicalPlanCache>();
+  const auto pqp_cache = std::make_shared<SQLPhysicalPlanCache>();
+  const auto read_query = "SELECT a FROM table_a WHERE b > 1";
+  auto pipeline =
+      SQLPipelineBuilder{read_query}.with_lqp_cache(lqp_cache).with_pqp_cache(pqp_cache).create_pipeline();
+  const auto [status, table] = pipeline.get_result_table();
+  EXPECT_EQ(status, SQLPipelineStatus::Success);
+  EXPECT_TRUE(reads_table(pipeline.get_optimized_logical_plans().at(0), "mv_b"));
+  EXPECT_FALSE(lqp_cache->has(read_query));
+  EXPECT_FALSE(pqp_cache->has(read_query));
+
+  EXPECT_EQ(table->row_count(), 4u);
+  EXPECT_EQ(table->column_name(ColumnID{0}), "a");
+}
+
+TEST_F(MaterializedViewRuleTest, IgnoresViewsNewerThanSnapshot) {
+  const auto query = "SELECT a, b FROM table_a WHERE b > 1";
+  const auto view_lqp = SQLPipelineBuilder{query}.create_pipeline().get_unoptimized_logical_plans().at(0);
+  Hyrise::get().storage_manager.add_materialized_view(
+      "mv_b", std::make_shared<LQPView>(view_lqp, std::unordered_map<ColumnID, std::string>{}));
+
+  // The view reflects the insert, which the transaction that started before must not see
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  SQLPipelineBuilder{"INSERT INTO table_a VALUES (3, 4)"}.create_pipeline().get_result_table();
+
+  auto pipeline = SQLPipelineBuilder{query}.with_transaction_context(transaction_context).create_pipeline();
+  const auto [status, table] = pipeline.get_result_table();
+  EXPECT_EQ(status, SQLPipelineStatus::Success);
+  EXPECT_FALSE(reads_table(pipeline.get_optimized_logical_plans().at(0), "mv_b"));
+  EXPECT_EQ(table->row_count(), 3u);
+
+  transaction_context->commit();
+}
+
+TEST_F(MaterializedViewRuleTest, IgnoresViewsInExplicitTransactions) {
+  const auto query = "SELECT a, b FROM table_a WHERE b > 1";
+  const auto view_lqp = SQLPipelineBuilder{query}.create_pipeline().get_unoptimized_logical_plans().at(0);
+  Hyrise::get().storage_manager.add_materialized_view(
+      "mv_b", std::make_shared<LQPView>(view_lqp, std::unordered_map<ColumnID, std::string>{}));
+
+  // The view is up to date for the transaction's snapshot, but it does not contain the transaction's own insert
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  SQLPipelineBuilder{"INSERT INTO table_a VALUES (3, 4)"}
+      .with_transaction_context(transaction_context)
+      .create_pipeline()
+      .get_result_table();
+
+  auto pipeline = SQLPipelineBuilder{query}.with_transaction_context(transaction_context).create_pipeline();
+  const auto [status, table] = pipeline.get_result_table();
+  EXPECT_EQ(status, SQLPipelineStatus::Success);
+  EXPECT_FALSE(reads_table(pipeline.get_optimized_logical_plans().at(0), "mv_b"));
+  EXPECT_EQ(table->row_count(), 4u);
+
+  transaction_context->rollback(RollbackReason::User);
+}
+
+}  // namespace opossum
@@ -0,0 +1,183 @@
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+#include "mock_socket.hpp"
+
+#include "server/copy_data_parser.hpp"
+#include "server/postgres_protocol_handler.hpp"
+#include "server/result_serializer.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class CopyDataParserTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _mocked_socket = std::make_shared<MockSocket>();
+    _protocol_handler =
+        std::make_shared<PostgresProtocolHandler<boost::asio::posix::stream_descriptor>>(_mocked_socket->get_socket());
+  }
+
+  // Sends the table as data of COPY TO STDOUT and returns the concatenated contents of the CopyData messages
+  std::string serialize_table(const std::shared_ptr<const Table>& table, const CopyFormat format) {
+    ResultSerializer::send_copy_data(table, format, _protocol_handler);
+    _protocol_handler->force_flush();
+    const auto file_content = _mocked_socket->read();
+
+    auto data = std::string{};
+    auto position = file_content.cbegin();
+    while (position != file_content.cend()) {
+      EXPECT_EQ(*position, static_cast<char>(PostgresMessageType::CopyData));
+      const auto message_length = NetworkConversionHelper::get_message_length(position + 1);
+      data.append(position + 5, position + 1 + message_length);
+      position += 1 + message_length;
+    }
+    return data;
+  }
+
+  // Passes the data to the parser in pieces of the given size
+  static std::shared_ptr<Table> parse_data(const std::string& data, const TableColumnDefinitions& column_definitions,
+                                           const CopyFormat format, const size_t piece_size,
+                                           const ChunkOffset chunk_size = Chunk::DEFAULT_SIZE) {
+    auto copy_data_parser = CopyDataParser{column_definitions, format, chunk_size};
+    for (auto offset = size_t{0}; offset < data.size(); offset += piece_size) {
+      copy_data_parser.append(data.substr(offset, piece_size));
+    }
+    return copy_data_parser.finish();
+  }
+
+  // Waits for the scheduled tasks and returns the number of bytes that they parsed but did not release
+  static size_t wait_for_unreleased_bytes(CopyDataParser& copy_data_parser) {
+    Hyrise::get().scheduler()->wait_for_tasks(copy_data_parser._tasks);
+
+    auto bytes = size_t{0};
+    for (const auto& data : copy_data_parser._scheduled_data) {
+      bytes += data.size();
+    }
+    return bytes;
+  }
+
+  static std::shared_ptr<Table> create_string_table() {
+    const auto table = std::make_shared<Table>(
+        TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::String, true}}, TableType::Data);
+    table->append({1, "plain"});
+    table->append({2, "with, comma"});
+    table->append({3, "with \"quotes\""});
+    table->append({4, "with\nnewline"});
+    table->append({5, ""});
+    table->append({6, NULL_VALUE});
+    table->append({7, "null"});
+    return table;
+  }
+
+  std::shared_ptr<MockSocket> _mocked_socket;
+  std::shared_ptr<PostgresProtocolHandler<boost::asio::posix::stream_descriptor>> _protocol_handler;
+};
+
+TEST_F(CopyDataParserTest, CsvRoundTrip) {
+  const auto table = load_table("resources/test_data/tbl/all_data_types_sorted.tbl", 2);
+  const auto data = serialize_table(table, CopyFormat::Csv);
+
+  EXPECT_TABLE_EQ_ORDERED(parse_data(data, table->column_definitions(), CopyFormat::Csv, data.size()), table);
+  EXPECT_TABLE_EQ_ORDERED(parse_data(data, table->column_definitions(), CopyFormat::Csv, 7), table);
+}
+
+TEST_F(CopyDataParserTest, CsvQuotingAndNullValues) {
+  const auto table = create_string_table();
+  const auto data = serialize_table(table, CopyFormat::Csv);
+
+  EXPECT_NE(data.find("2,\"with, comma\"\n"), std::string::npos);
+  EXPECT_NE(data.find("3,\"with \"\"quotes\"\"\"\n"), std::string::npos);
+  EXPECT_NE(data.find("5,\"\"\n"), std::string::npos);
+  EXPECT_NE(data.find("6,\n"), std::string::npos);
+
+  // A piece size of one splits the data within every quoted field
+  EXPECT_TABLE_EQ_ORDERED(parse_data(data, table->column_definitions(), CopyFormat::Csv, 1), table);
+}
+
+TEST_F(CopyDataParserTest, CsvWithoutTrailingLinebreak) {
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Float, false}};
+  const auto result = parse_data("1,1.5\n2,2.5", column_definitions, CopyFormat::Csv, 3);
+
+  const auto expected_table = std::make_shared<Table>(column_definitions, TableType::Data);
+  expected_table->append({1, 1.5f});
+  expected_table->append({2, 2.5f});
+  EXPECT_TABLE_EQ_ORDERED(result, expected_table);
+}
+
+TEST_F(CopyDataParserTest, BinaryRoundTrip) {
+  const auto table = load_table("resources/test_data/tbl/all_data_types_sorted.tbl", 2);
+  const auto data = serialize_table(table, CopyFormat::Binary);
+
+  EXPECT_EQ(data.substr(0, 11), std::string("PGCOPY\n\377\r\n\0", 11));
+  EXPECT_EQ(data.substr(data.size() - 2), std::string("\377\377"));
+
+  EXPECT_TABLE_EQ_ORDERED(parse_data(data, table->column_definitions(), CopyFormat::Binary, data.size()), table);
+  EXPECT_TABLE_EQ_ORDERED(parse_data(data, table->column_definitions(), CopyFormat::Binary, 5), table);
+
+  const auto result = parse_data(data, table->column_definitions(), CopyFormat::Binary, 5, ChunkOffset{3});
+  EXPECT_TABLE_EQ_ORDERED(result, table);
+  EXPECT_EQ(result->get_chunk(ChunkID{0})->size(), 3);
+}
+
+TEST_F(CopyDataParserTest, BinaryNullValues) {
+  const auto table = create_string_table();
+  const auto data = serialize_table(table, CopyFormat::Binary);
+
+  EXPECT_TABLE_EQ_ORDERED(parse_data(data, table->column_definitions(), CopyFormat::Binary, 3), table);
+}
+
+TEST_F(CopyDataParserTest, ReleaseParsedData) {
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}};
+  const auto row_count = CopyDataParser::PARSING_TASK_BYTES / 8 + 1;
+  auto data = std::string{};
+  for (auto row_id = size_t{0}; row_id < row_count; ++row_id) {
+    data += "1234567\n";
+  }
+
+  // The rows are parsed once enough data has been received. Afterwards, the data is released although the COPY has
+  // not finished yet.
+  auto csv_parser = CopyDataParser{column_definitions, CopyFormat::Csv};
+  csv_parser.append(data);
+  EXPECT_EQ(wait_for_unreleased_bytes(csv_parser), 0);
+  EXPECT_EQ(csv_parser.finish()->row_count(), row_count);
+
+  // Binary rows are parsed once a chunk is complete
+  const auto table = create_string_table();
+  const auto binary_data = serialize_table(table, CopyFormat::Binary);
+  auto binary_parser = CopyDataParser{table->column_definitions(), CopyFormat::Binary, ChunkOffset{7}};
+  binary_parser.append(binary_data);
+  EXPECT_EQ(wait_for_unreleased_bytes(binary_parser), 0);
+  EXPECT_TABLE_EQ_ORDERED(binary_parser.finish(), table);
+}
+
+TEST_F(CopyDataParserTest, InvalidData) {
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}};
+
+  EXPECT_THROW(parse_data("1\n\"2\n", column_definitions, CopyFormat::Csv, 2), InvalidInputException);
+  EXPECT_THROW(parse_data("1\nx\n", column_definitions, CopyFormat::Csv, 2), std::exception);
+
+  EXPECT_THROW(parse_data(std::string("PGCOPY\n\377\r\n\1\0\0\0\0\0\0\0\0", 19), column_definitions,
+                          CopyFormat::Binary, 19),
+               InvalidInputException);
+  EXPECT_THROW(parse_data(std::string("PGCOPY", 6), column_definitions, CopyFormat::Binary, 6),
+               InvalidInputException);
+
+  // A row with two fields, although the table has a single column
+  const auto header = std::string("PGCOPY\n\377\r\n\0\0\0\0\0\0\0\0\0", 19);
+  EXPECT_THROW(parse_data(header + std::string("\0\2", 2), column_definitions, CopyFormat::Binary, 21),
+               InvalidInputException);
+
+  // A NULL value in a non-nullable column
+  EXPECT_THROW(parse_data(header + std::string("\0\1\377\377\377\377\377\377", 8), column_definitions,
+                          CopyFormat::Binary, 27),
+               InvalidInputException);
+
+  // A negative field length other than -1
+  EXPECT_THROW(parse_data(header + std::string("\0\1\377\377\377\376\377\377", 8), column_definitions,
+                          CopyFormat::Binary, 27),
+               InvalidInputException);
+}
+
+}  // namespace opossum
@@ -30,9 +30,10 @@ TEST_F(PostgresProtocolHandlerTest, ReadStartupMessage) {
   // Server will wait for new message with authentication details. Message contains length (12 B), protocol (0) and
   // body (4 B). No body provided here, since we throw it away anyway.
   _mocked_socket->write(std::string{'\0', '\0', '\0', '\f', '\0', '\0', '\0', '\0'});
-  EXPECT_EQ(_protocol_handler->read_startup_packet_header(), 4);
+  EXPECT_EQ(_protocol_handler->read_startup_packet_header(), std::nullopt);
   const std::string file_content = _mocked_socket->read();
   EXPECT_EQ(file_content.back(), 'N');
+  EXPECT_EQ(_protocol_handler->read_startup_packet_header(), 4);
 }
 
 TEST_F(PostgresProtocolHandlerTest, DiscardStartupPacketBody) {
@@ -261,6 +262,43 @@ TEST_F(PostgresProtocolHandlerTest, ReadExecutePacket) {
   EXPECT_EQ(_protocol_handler->read_execute_packet(), portal_name);
 }
 
+TEST_F(PostgresProtocolHandlerTest, SendCopyInResponse) {
+  _protocol_handler->send_copy_in_response(CopyFormat::Binary, 2);
+  const std::string file_content = _mocked_socket->read();
+
+  // The response is flushed immediately, as the client waits for it before sending data
+  EXPECT_EQ(static_cast<PostgresMessageType>(file_content.front()), PostgresMessageType::CopyInResponse);
+  EXPECT_EQ(NetworkConversionHelper::get_message_length(file_content.cbegin() + 1), file_content.size() - 1);
+  EXPECT_EQ(file_content[5], '\1');
+  EXPECT_EQ(NetworkConversionHelper::get_small_int(file_content.cbegin() + 6), 2);
+  EXPECT_EQ(NetworkConversionHelper::get_small_int(file_content.cbegin() + 8), 1);
+  EXPECT_EQ(NetworkConversionHelper::get_small_int(file_content.cbegin() + 10), 1);
+}
+
+TEST_F(PostgresProtocolHandlerTest, SendCopyData) {
+  const auto data = std::string{"1,a\n\0", 5};
+  _protocol_handler->send_copy_data(data);
+  _protocol_handler->force_flush();
+  const std::string file_content = _mocked_socket->read();
+
+  EXPECT_EQ(static_cast<PostgresMessageType>(file_content.front()), PostgresMessageType::CopyData);
+  EXPECT_EQ(NetworkConversionHelper::get_message_length(file_content.cbegin() + 1), file_content.size() - 1);
+  EXPECT_EQ(file_content.substr(5), data);
+}
+
+TEST_F(PostgresProtocolHandlerTest, ReadCopyPackets) {
+  _mocked_socket->write(std::string{'d', '\0', '\0', '\0', '\x09', '1', ',', 'a', '\n', '\0'});
+  _mocked_socket->write(std::string{'c', '\0', '\0', '\0', '\x04'});
+  _mocked_socket->write(std::string{'f', '\0', '\0', '\0', '\x07', 'e', 'r', '\0'});
+
+  EXPECT_EQ(_protocol_handler->read_packet_type(), PostgresMessageType::CopyData);
+  EXPECT_EQ(_protocol_handler->read_copy_data_packet(), std::string("1,a\n\0", 5));
+  EXPECT_EQ(_protocol_handler->read_packet_type(), PostgresMessageType::CopyDone);
+  _protocol_handler->read_copy_done_packet();
+  EXPECT_EQ(_protocol_handler->read_packet_type(), PostgresMessageType::CopyFail);
+  EXPECT_EQ(_protocol_handler->read_copy_fail_packet(), "er");
+}
+
 TEST_F(PostgresProtocolHandlerTest, SendErrorMessage) {
   const std::string error_description = "error";
   const auto error_message = ErrorMessage{{PostgresMessageType::HumanReadableError, error_description}};
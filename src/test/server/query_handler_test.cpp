@@ -26,17 +26,58 @@ TEST_F(QueryHandlerTest, ExecutePipeline) {
   EXPECT_EQ(execution_information.root_operator_type, OperatorType::Projection);
 }
 
-TEST_F(QueryHandlerTest, CreatePreparedPlan) {
-  QueryHandler::setup_prepared_plan("test_statement", "SELECT * FROM table_a WHERE a > ?");
+TEST_F(QueryHandlerTest, PrepareStatement) {
+  const auto prepared_statement = QueryHandler::prepare_statement("SELECT * FROM table_a WHERE a > ?");
+
+  EXPECT_EQ(prepared_statement->prepared_plan->parameter_ids.size(), 1);
+  EXPECT_FALSE(prepared_statement->physical_plan_template);
+  EXPECT_FALSE(prepared_statement->is_single_row_insert);
+  EXPECT_TRUE(prepared_statement->cacheable);
+  ASSERT_EQ(prepared_statement->tables.size(), 1);
+  EXPECT_EQ(prepared_statement->tables[0].first, "table_a");
+}
+
+TEST_F(QueryHandlerTest, PrepareStatementWithoutParameters) {
+  const auto prepared_statement = QueryHandler::prepare_statement("SELECT * FROM table_a WHERE a > 123");
+  ASSERT_TRUE(prepared_statement->physical_plan_template);
+
+  // Each binding returns a new copy of the template
+  const auto pqp_1 = QueryHandler::bind_prepared_statement(*prepared_statement, {});
+  const auto pqp_2 = QueryHandler::bind_prepared_statement(*prepared_statement, {});
+  EXPECT_NE(pqp_1, prepared_statement->physical_plan_template);
+  EXPECT_NE(pqp_1, pqp_2);
+
+  auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::Yes);
+  pqp_1->set_transaction_context_recursively(transaction_context);
+  EXPECT_EQ(QueryHandler::execute_prepared_plan(pqp_1)->row_count(), 2u);
+
+  EXPECT_THROW(QueryHandler::bind_prepared_statement(*prepared_statement, {123}), InvalidInputException);
+}
+
+TEST_F(QueryHandlerTest, InvalidateStatementOnTableChange) {
+  const auto prepared_statement = QueryHandler::prepare_statement("SELECT * FROM table_a WHERE a < 200");
+  EXPECT_TRUE(QueryHandler::is_valid(*prepared_statement));
+
+  // The template of the statement prunes the second chunk of the initial table. Once the table has been replaced, the
+  // statement has to be prepared again.
+  Hyrise::get().storage_manager.drop_table("table_a");
+  EXPECT_FALSE(QueryHandler::is_valid(*prepared_statement));
+  Hyrise::get().storage_manager.add_table("table_a", load_table("resources/test_data/tbl/int_float2.tbl", 2));
+  EXPECT_FALSE(QueryHandler::is_valid(*prepared_statement));
+
+  const auto prepared_again = QueryHandler::prepare_statement(prepared_statement->query);
+  EXPECT_TRUE(QueryHandler::is_valid(*prepared_again));
 
-  EXPECT_TRUE(Hyrise::get().storage_manager.has_prepared_plan("test_statement"));
+  const auto pqp = QueryHandler::bind_prepared_statement(*prepared_again, {});
+  auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::Yes);
+  pqp->set_transaction_context_recursively(transaction_context);
+  EXPECT_EQ(QueryHandler::execute_prepared_plan(pqp)->row_count(), 2u);
 }
 
 TEST_F(QueryHandlerTest, BindParameters) {
-  QueryHandler::setup_prepared_plan("test_statement", "SELECT * FROM table_a WHERE a = ?");
-  const auto specification = PreparedStatementDetails{"test_statement", "", {12345}};
+  const auto prepared_statement = QueryHandler::prepare_statement("SELECT * FROM table_a WHERE a = ?");
 
-  const auto bound_plan = QueryHandler::bind_prepared_plan(specification);
+  const auto bound_plan = QueryHandler::bind_prepared_statement(*prepared_statement, {12345});
   EXPECT_EQ(bound_plan->type(), OperatorType::Validate);
 
   const auto get_table = std::dynamic_pointer_cast<const GetTable>(bound_plan->input_left()->input_left());
@@ -49,9 +90,8 @@ TEST_F(QueryHandlerTest, BindParameters) {
 }
 
 TEST_F(QueryHandlerTest, ExecutePreparedStatement) {
-  QueryHandler::setup_prepared_plan("test_statement", "SELECT * FROM table_a WHERE a > ?");
-  const auto specification = PreparedStatementDetails{"test_statement", "", {123}};
-  const auto pqp = QueryHandler::bind_prepared_plan(specification);
+  const auto prepared_statement = QueryHandler::prepare_statement("SELECT * FROM table_a WHERE a > ?");
+  const auto pqp = QueryHandler::bind_prepared_statement(*prepared_statement, {123});
 
   auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::Yes);
   pqp->set_transaction_context_recursively(transaction_context);
@@ -61,21 +101,67 @@ TEST_F(QueryHandlerTest, ExecutePreparedStatement) {
   EXPECT_EQ(result_table->column_count(), 2u);
 }
 
-TEST_F(QueryHandlerTest, CorrectlyInvalidateStatements) {
-  QueryHandler::setup_prepared_plan("", "SELECT * FROM table_a WHERE a > ?");
-  const auto old_plan = Hyrise::get().storage_manager.get_prepared_plan("");
+TEST_F(QueryHandlerTest, DetectSingleRowInserts) {
+  EXPECT_TRUE(QueryHandler::prepare_statement("INSERT INTO table_a VALUES (?, ?)")->is_single_row_insert);
+  EXPECT_TRUE(QueryHandler::prepare_statement("INSERT INTO table_a (b, a) VALUES (?, ?)")->is_single_row_insert);
 
-  // New unnamed statement invalidates existing prepared plan
-  QueryHandler::setup_prepared_plan("", "SELECT * FROM table_a WHERE b > ?");
-  const auto new_plan = Hyrise::get().storage_manager.get_prepared_plan("");
+  EXPECT_FALSE(QueryHandler::prepare_statement("INSERT INTO table_a VALUES (1, 2.0)")->is_single_row_insert);
+  EXPECT_FALSE(QueryHandler::prepare_statement("INSERT INTO table_a SELECT * FROM table_a WHERE a > ?")
+                   ->is_single_row_insert);
+  EXPECT_FALSE(
+      QueryHandler::prepare_statement("INSERT INTO table_a VALUES ((SELECT MAX(a) FROM table_a WHERE b > ?), 1.0)")
+          ->is_single_row_insert);
+}
 
-  EXPECT_NE(old_plan->hash(), new_plan->hash());
+TEST_F(QueryHandlerTest, BindSingleRowInserts) {
+  const auto prepared_statement = QueryHandler::prepare_statement("INSERT INTO table_a (b, a) VALUES (?, ?)");
+  const auto parameters = std::vector<std::vector<AllTypeVariant>>{
+      {pmr_string{"1.5"}, pmr_string{"1"}}, {pmr_string{"2.5"}, pmr_string{"2"}}, {pmr_string{"3.5"}, pmr_string{"3"}}};
 
-  // Simple queries invalidate an existing plan as well
-  const std::string query = "SELECT 1;";
-  QueryHandler::execute_pipeline(query, SendExecutionInfo::Yes, nullptr);
+  const auto pqp = QueryHandler::bind_single_row_inserts(*prepared_statement, parameters);
+  EXPECT_EQ(pqp->type(), OperatorType::Insert);
+
+  auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::Yes);
+  pqp->set_transaction_context_recursively(transaction_context);
+  QueryHandler::execute_prepared_plan(pqp);
+
+  const auto table_a = Hyrise::get().storage_manager.get_table("table_a");
+  EXPECT_EQ(table_a->row_count(), 6u);
+  EXPECT_EQ(table_a->get_value<int32_t>(ColumnID{0}, 3u), 1);
+  EXPECT_EQ(table_a->get_value<float>(ColumnID{1}, 3u), 1.5f);
+  EXPECT_EQ(table_a->get_value<int32_t>(ColumnID{0}, 5u), 3);
+  EXPECT_EQ(table_a->get_value<float>(ColumnID{1}, 5u), 3.5f);
+
+  EXPECT_THROW(QueryHandler::bind_single_row_inserts(*prepared_statement, {{pmr_string{"1.5"}}}),
+               InvalidInputException);
+}
 
-  EXPECT_FALSE(Hyrise::get().storage_manager.has_prepared_plan(""));
+TEST_F(QueryHandlerTest, ParseCopyStatement) {
+  EXPECT_FALSE(QueryHandler::parse_copy_statement("SELECT * FROM table_a"));
+  EXPECT_FALSE(QueryHandler::parse_copy_statement("COPY table_a FROM 'file.csv'"));
+
+  const auto copy_from = QueryHandler::parse_copy_statement("copy table_a from stdin with (format csv);");
+  ASSERT_TRUE(copy_from);
+  EXPECT_EQ(copy_from->direction, CopyStatement::Direction::FromStdin);
+  EXPECT_EQ(copy_from->format, CopyFormat::Csv);
+  EXPECT_EQ(copy_from->table_name, "table_a");
+
+  const auto copy_table_to = QueryHandler::parse_copy_statement("COPY table_a TO STDOUT BINARY");
+  ASSERT_TRUE(copy_table_to);
+  EXPECT_EQ(copy_table_to->direction, CopyStatement::Direction::ToStdout);
+  EXPECT_EQ(copy_table_to->format, CopyFormat::Binary);
+  EXPECT_EQ(copy_table_to->query, "SELECT * FROM table_a");
+
+  const auto copy_query_to = QueryHandler::parse_copy_statement("COPY (SELECT a FROM table_a) TO STDOUT FORMAT csv");
+  ASSERT_TRUE(copy_query_to);
+  EXPECT_EQ(copy_query_to->format, CopyFormat::Csv);
+  EXPECT_EQ(copy_query_to->query, "SELECT a FROM table_a");
+
+  // The text format is not supported
+  EXPECT_THROW(QueryHandler::parse_copy_statement("COPY table_a FROM STDIN"), InvalidInputException);
+  EXPECT_THROW(QueryHandler::parse_copy_statement("COPY table_a TO STDOUT (FORMAT text)"), InvalidInputException);
+  EXPECT_THROW(QueryHandler::parse_copy_statement("COPY table_a FROM STDIN (FORMAT csv, HEADER)"),
+               InvalidInputException);
 }
 
 }  // namespace opossum
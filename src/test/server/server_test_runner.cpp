@@ -1,8 +1,14 @@
 #include <pqxx/pqxx>
 
+#include <array>
+#include <cstring>
 #include <fstream>
 #include <future>
+#include <memory>
+#include <optional>
+#include <string>
 #include <thread>
+#include <vector>
 
 #include "base_test.hpp"
 
@@ -59,6 +65,41 @@ class ServerTestRunner : public BaseTest {
   std::unique_ptr<std::thread> _server_thread;
   std::string _connection_string;
 
+  // Builds a message of the PostgreSQL protocol for clients that do not use libpqxx. Startup packets have no type.
+  static std::string _build_message(const std::optional<char> type, const std::string& body) {
+    auto message = std::string{};
+    if (type) message.push_back(*type);
+    const auto length = htonl(static_cast<uint32_t>(sizeof(uint32_t) + body.size()));
+    message.append(reinterpret_cast<const char*>(&length), sizeof(length));
+    return message + body;
+  }
+
+  // Connects a client that does not use libpqxx and waits until the server is ready for queries
+  std::unique_ptr<boost::asio::ip::tcp::socket> _connect_raw_client(boost::asio::io_service& io_service) {
+    auto client = std::make_unique<boost::asio::ip::tcp::socket>(io_service);
+    client->connect({boost::asio::ip::address_v4::loopback(), _server->server_port()});
+    // Protocol version 3.0 and the user name
+    boost::asio::write(*client,
+                       boost::asio::buffer(_build_message(std::nullopt, std::string{"\0\3\0\0user\0hyrise\0\0", 17})));
+    _receive_until_ready_for_query(*client);
+    return client;
+  }
+
+  // Reads the server's messages until it is ready for the next query and returns their types
+  static std::string _receive_until_ready_for_query(boost::asio::ip::tcp::socket& socket) {
+    auto message_types = std::string{};
+    while (message_types.empty() || message_types.back() != 'Z') {
+      auto header = std::array<char, 5>{};
+      boost::asio::read(socket, boost::asio::buffer(header));
+      auto length = uint32_t{0};
+      std::memcpy(&length, header.data() + 1, sizeof(length));
+      auto body = std::string(ntohl(length) - sizeof(length), '\0');
+      boost::asio::read(socket, boost::asio::buffer(body));
+      message_types.push_back(header[0]);
+    }
+    return message_types;
+  }
+
   std::shared_ptr<Table> _table_a;
   const std::string _export_filename = test_data_path + "server_test";
 };
@@ -288,6 +329,54 @@ TEST_F(ServerTestRunner, TestMultipleConnections) {
   EXPECT_EQ(result3.size(), expected_num_rows);
 }
 
+TEST_F(ServerTestRunner, TestManyIdleConnections) {
+  // Sessions do not occupy a thread while waiting for the client. Thus, the number of open connections can exceed the
+  // number of I/O threads and workers by far.
+  auto connections = std::vector<std::unique_ptr<pqxx::connection>>{};
+  for (auto connection_id = 0; connection_id < 200; ++connection_id) {
+    connections.emplace_back(std::make_unique<pqxx::connection>(_connection_string));
+  }
+
+  const auto expected_num_rows = _table_a->row_count();
+  for (auto connection_id = size_t{0}; connection_id < connections.size(); connection_id += 20) {
+    pqxx::nontransaction transaction{*connections[connection_id]};
+    const auto result = transaction.exec("SELECT * FROM table_a;");
+    EXPECT_EQ(result.size(), expected_num_rows);
+  }
+}
+
+TEST_F(ServerTestRunner, TestPartialMessages) {
+  // A session hands a message to a worker only once it has been received completely. Thus, clients that send their
+  // messages in parts (e.g., because of a slow network) do not block the workers, even if there are more of them than
+  // workers.
+  auto io_service = boost::asio::io_service{};
+  const auto sql = std::string{"SELECT * FROM table_a;"};
+  const auto query = _build_message('Q', std::string{sql.c_str(), sql.size() + 1});
+
+  const auto partial_client_count = Hyrise::get().topology.num_cpus() + 1;
+  auto partial_clients = std::vector<std::unique_ptr<boost::asio::ip::tcp::socket>>{};
+  for (auto client_id = size_t{0}; client_id < partial_client_count; ++client_id) {
+    const auto& client = partial_clients.emplace_back(_connect_raw_client(io_service));
+    boost::asio::write(*client, boost::asio::buffer(query.data(), query.size() / 2));
+  }
+
+  const auto expected_num_rows = _table_a->row_count();
+  auto other_client = std::async(std::launch::async, [&]() {
+    pqxx::connection connection{_connection_string};
+    pqxx::nontransaction transaction{connection};
+    return transaction.exec(sql).size();
+  });
+  ASSERT_EQ(other_client.wait_for(std::chrono::seconds(150)), std::future_status::ready);
+  EXPECT_EQ(other_client.get(), expected_num_rows);
+
+  // Once the remainder of their queries arrives, the partial clients receive the RowDescription, the DataRows, the
+  // CommandComplete, and the ReadyForQuery message
+  for (auto& client : partial_clients) {
+    boost::asio::write(*client, boost::asio::buffer(query.data() + query.size() / 2, query.size() - query.size() / 2));
+    EXPECT_EQ(_receive_until_ready_for_query(*client), "T" + std::string(expected_num_rows, 'D') + "CZ");
+  }
+}
+
 TEST_F(ServerTestRunner, TestSimpleInsertSelect) {
   pqxx::connection connection{_connection_string};
   pqxx::nontransaction transaction{connection};
@@ -364,6 +453,152 @@ TEST_F(ServerTestRunner, TestUnnamedPreparedStatement) {
   EXPECT_EQ(result2.size(), 2u);
 }
 
+TEST_F(ServerTestRunner, TestInvalidateUnnamedPreparedStatement) {
+  pqxx::connection connection{_connection_string};
+  pqxx::nontransaction transaction{connection};
+
+  const std::string prepared_name = "";
+  connection.prepare(prepared_name, "SELECT * FROM table_a WHERE a > ?");
+  EXPECT_EQ(transaction.exec_prepared(prepared_name, 1234).size(), 1u);
+
+  // Prepared statements belong to the session that created them
+  {
+    pqxx::connection other_connection{_connection_string};
+    pqxx::nontransaction other_transaction{other_connection};
+    EXPECT_ANY_THROW(other_transaction.exec_prepared(prepared_name, 1234));
+  }
+  EXPECT_EQ(transaction.exec_prepared(prepared_name, 1234).size(), 1u);
+
+  // A simple query invalidates the unnamed statement
+  transaction.exec("SELECT 1;");
+  EXPECT_ANY_THROW(transaction.exec_prepared(prepared_name, 1234));
+
+  // Named statements remain valid
+  connection.prepare("statement1", "SELECT * FROM table_a WHERE a > ?");
+  transaction.exec("SELECT 1;");
+  EXPECT_EQ(transaction.exec_prepared("statement1", 1234).size(), 1u);
+}
+
+TEST_F(ServerTestRunner, TestPreparedInsert) {
+  pqxx::connection connection{_connection_string};
+  connection.prepare("insert", "INSERT INTO table_a (b, a) VALUES (?, ?)");
+  connection.prepare("select", "SELECT * FROM table_a WHERE a >= ?");
+
+  // Single-row inserts are collected by the session until a message other than Bind, Describe, or Execute arrives
+  // (here, the Sync message that libpq sends after each execution)
+  {
+    pqxx::work transaction{connection};
+    for (auto value = 100000; value < 100010; ++value) {
+      transaction.exec_prepared("insert", 1.5, value);
+    }
+    transaction.commit();
+  }
+
+  pqxx::nontransaction transaction{connection};
+  const auto result = transaction.exec_prepared("select", 100000);
+  EXPECT_EQ(result.size(), 10u);
+
+  // Wrong number of parameters
+  EXPECT_ANY_THROW(transaction.exec_prepared("insert", 100010));
+  EXPECT_EQ(transaction.exec_prepared("select", 100000).size(), 10u);
+}
+
+TEST_F(ServerTestRunner, TestPipelinedPreparedInserts) {
+  _table_a->add_unique_constraint({ColumnID{0}}, IsPrimaryKey::No);
+
+  // Drivers like JDBC send the Bind and Execute messages of many inserts before a single Sync message. libpq does not,
+  // so we send the messages ourselves.
+  auto io_service = boost::asio::io_service{};
+  const auto client = _connect_raw_client(io_service);
+
+  const auto sql = std::string{"INSERT INTO table_a (b, a) VALUES (?, ?)"};
+  // Unnamed statement, no parameter types
+  const auto parse = _build_message('P', std::string{"\0", 1} + sql + std::string{"\0\0\0", 3});
+  const auto build_bind = [](const int32_t value) {
+    // Unnamed portal and statement, no parameter format codes, two parameters, no result format codes
+    auto body = std::string{"\0\0\0\0\0\2", 6};
+    for (const auto& parameter : {std::string{"1.5"}, std::to_string(value)}) {
+      const auto length = htonl(static_cast<uint32_t>(parameter.size()));
+      body.append(reinterpret_cast<const char*>(&length), sizeof(length));
+      body += parameter;
+    }
+    return _build_message('B', body + std::string{"\0\0", 2});
+  };
+  // Unnamed portal, no row limit
+  const auto execute = _build_message('E', std::string{"\0\0\0\0\0", 5});
+  const auto sync = _build_message('S', "");
+
+  // The inserts are performed by a single Insert operator once the Sync message arrives. Afterwards, the session
+  // responds to each Bind and Execute message: BindComplete, NoData, and CommandComplete.
+  auto messages = parse;
+  for (auto value = 100000; value < 100010; ++value) {
+    messages += build_bind(value) + execute;
+  }
+  boost::asio::write(*client, boost::asio::buffer(messages + sync));
+
+  auto expected_message_types = std::string{"1"};
+  for (auto row_id = 0; row_id < 10; ++row_id) {
+    expected_message_types += "2nC";
+  }
+  EXPECT_EQ(_receive_until_ready_for_query(*client), expected_message_types + "Z");
+
+  pqxx::connection connection{_connection_string};
+  pqxx::nontransaction transaction{connection};
+  EXPECT_EQ(transaction.exec("SELECT * FROM table_a WHERE a >= 100000").size(), 10u);
+
+  // If one of the rows violates the unique constraint, none of them is inserted. The client receives a single error
+  // instead of the responses to the Bind and Execute messages.
+  messages = parse;
+  for (const auto value : {200000, 200001, 123}) {
+    messages += build_bind(value) + execute;
+  }
+  boost::asio::write(*client, boost::asio::buffer(messages + sync));
+  EXPECT_EQ(_receive_until_ready_for_query(*client), "1EZ");
+  EXPECT_EQ(transaction.exec("SELECT * FROM table_a WHERE a >= 200000").size(), 0u);
+}
+
+TEST_F(ServerTestRunner, TestPreparedStatementAfterTableChange) {
+  pqxx::connection connection{_connection_string};
+  pqxx::nontransaction transaction{connection};
+
+  // The plans of prepared statements refer to the columns of the tables. If a table is replaced, both the session's
+  // cache of statements by their SQL string and the existing statements have to prepare the statement again.
+  const auto sql = std::string{"SELECT * FROM table_a WHERE a > ?"};
+  connection.prepare("statement1", sql);
+  EXPECT_EQ(transaction.exec_prepared("statement1", 1234).size(), 1u);
+
+  transaction.exec("DROP TABLE table_a;");
+  transaction.exec("CREATE TABLE table_a (x FLOAT, a INT);");
+  transaction.exec("INSERT INTO table_a VALUES (1.0, 2000);");
+  transaction.exec("INSERT INTO table_a VALUES (2.0, 3000);");
+  transaction.exec("INSERT INTO table_a VALUES (3.0, 4);");
+
+  connection.prepare("statement2", sql);
+  const auto result = transaction.exec_prepared("statement2", 1234);
+  ASSERT_EQ(result.size(), 2u);
+  EXPECT_STREQ(result[0][1].c_str(), "2000");
+
+  EXPECT_EQ(transaction.exec_prepared("statement1", 1234).size(), 2u);
+}
+
+TEST_F(ServerTestRunner, TestPreparedInsertConflict) {
+  _table_a->add_unique_constraint({ColumnID{0}}, IsPrimaryKey::No);
+
+  pqxx::connection connection{_connection_string};
+  connection.prepare("insert", "INSERT INTO table_a (b, a) VALUES (?, ?)");
+
+  // The collected inserts violate the constraint. No row is reported as inserted and the error is not deferred.
+  {
+    pqxx::work transaction{connection};
+    EXPECT_ANY_THROW(transaction.exec_prepared("insert", 1.5, 123));
+  }
+
+  pqxx::nontransaction transaction{connection};
+  EXPECT_EQ(transaction.exec("SELECT * FROM table_a").size(), 3u);
+  transaction.exec_prepared("insert", 1.5, 100000);
+  EXPECT_EQ(transaction.exec("SELECT * FROM table_a").size(), 4u);
+}
+
 TEST_F(ServerTestRunner, TestInvalidPreparedStatement) {
   pqxx::connection connection{_connection_string};
   pqxx::nontransaction transaction{connection};
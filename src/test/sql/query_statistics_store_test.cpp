@@ -0,0 +1,119 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "hyrise.hpp"
+#include "sql/query_statistics_store.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "sql/sql_pipeline_statement.hpp"
+
+namespace opossum {
+
+class QueryStatisticsStoreTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    Hyrise::get().storage_manager.add_table("table_a", load_table("resources/test_data/tbl/int_float.tbl", 2));
+
+    metrics.sql_translation_duration = std::chrono::nanoseconds{10};
+    metrics.optimization_duration = std::chrono::nanoseconds{20};
+    metrics.lqp_translation_duration = std::chrono::nanoseconds{30};
+    metrics.plan_execution_duration = std::chrono::nanoseconds{40};
+  }
+
+  SQLPipelineStatementMetrics metrics;
+};
+
+TEST_F(QueryStatisticsStoreTest, NormalizeSQL) {
+  EXPECT_EQ(QueryStatisticsStore::normalize_sql("SELECT * FROM t WHERE a = 5"), "SELECT * FROM t WHERE a = ?");
+  EXPECT_EQ(QueryStatisticsStore::normalize_sql("  SELECT *\n FROM  t\tWHERE a = 17.5e-3 ; "),
+            "SELECT * FROM t WHERE a = ? ;");
+  EXPECT_EQ(QueryStatisticsStore::normalize_sql("SELECT a1 FROM t2 WHERE b IN (1, 22, 333)"),
+            "SELECT a1 FROM t2 WHERE b IN (?, ?, ?)");
+  EXPECT_EQ(QueryStatisticsStore::normalize_sql("SELECT 'it''s', \"col 1\" FROM t WHERE c LIKE '%x 5%'"),
+            "SELECT ?, \"col 1\" FROM t WHERE c LIKE ?");
+}
+
+TEST_F(QueryStatisticsStoreTest, AggregatesByNormalizedSQL) {
+  auto store = QueryStatisticsStore{};
+  store.record("SELECT * FROM t WHERE a = 1", metrics, 3, 100);
+
+  metrics.plan_execution_duration = std::chrono::nanoseconds{140};
+  metrics.query_plan_cache_hit = true;
+  store.record("SELECT * FROM t WHERE a =  2", metrics, 5, 50);
+  store.record("SELECT * FROM t", metrics, 7, 10);
+
+  auto statistics = store.statistics();
+  ASSERT_EQ(statistics.size(), 2);
+  std::sort(statistics.begin(), statistics.end(),
+            [](const auto& lhs, const auto& rhs) { return lhs.normalized_sql < rhs.normalized_sql; });
+
+  const auto& entry = statistics[1];
+  EXPECT_EQ(entry.normalized_sql, "SELECT * FROM t WHERE a = ?");
+  EXPECT_EQ(entry.calls, 2);
+  EXPECT_EQ(entry.rows_returned, 8);
+  EXPECT_FLOAT_EQ(entry.query_plan_cache_hit_ratio(), 0.5f);
+  EXPECT_EQ(entry.latency.total, std::chrono::nanoseconds{100 + 200});
+  EXPECT_EQ(entry.latency.max, std::chrono::nanoseconds{200});
+  EXPECT_EQ(entry.sql_translation.total, std::chrono::nanoseconds{20});
+  EXPECT_EQ(entry.plan_execution.total, std::chrono::nanoseconds{180});
+  EXPECT_EQ(entry.plan_execution.max, std::chrono::nanoseconds{140});
+  EXPECT_EQ(entry.peak_intermediate_memory, 100);
+
+  EXPECT_EQ(statistics[0].normalized_sql, "SELECT * FROM t");
+  EXPECT_EQ(statistics[0].calls, 1);
+}
+
+TEST_F(QueryStatisticsStoreTest, MergesThreads) {
+  auto store = QueryStatisticsStore{};
+
+  constexpr auto THREAD_COUNT = 8;
+  constexpr auto CALLS_PER_THREAD = 100;
+
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_id = 0; thread_id < THREAD_COUNT; ++thread_id) {
+    threads.emplace_back([&, thread_id]() {
+      for (auto call_id = 0; call_id < CALLS_PER_THREAD; ++call_id) {
+        store.record("SELECT " + std::to_string(call_id), metrics, 1, thread_id);
+        // Reading concurrently must be safe as well
+        if (call_id % 10 == 0) store.statistics();
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  const auto statistics = store.statistics();
+  ASSERT_EQ(statistics.size(), 1);
+  EXPECT_EQ(statistics[0].calls, THREAD_COUNT * CALLS_PER_THREAD);
+  EXPECT_EQ(statistics[0].rows_returned, THREAD_COUNT * CALLS_PER_THREAD);
+  EXPECT_EQ(statistics[0].latency.total, std::chrono::nanoseconds{100 * THREAD_COUNT * CALLS_PER_THREAD});
+  EXPECT_EQ(statistics[0].peak_intermediate_memory, THREAD_COUNT - 1);
+}
+
+TEST_F(QueryStatisticsStoreTest, DisabledByDefault) {
+  EXPECT_FALSE(Hyrise::get().default_query_statistics_store);
+
+  const auto [status, _] = SQLPipelineBuilder{"SELECT * FROM table_a"}.create_pipeline().get_result_table();
+  EXPECT_EQ(status, SQLPipelineStatus::Success);
+}
+
+TEST_F(QueryStatisticsStoreTest, RecordsExecutedStatements) {
+  Hyrise::get().default_query_statistics_store = std::make_shared<QueryStatisticsStore>();
+  const auto& store = Hyrise::get().default_query_statistics_store;
+
+  SQLPipelineBuilder{"SELECT * FROM table_a WHERE a > 200"}.create_pipeline().get_result_table();
+  SQLPipelineBuilder{"SELECT * FROM table_a WHERE a > 1000000"}.create_pipeline().get_result_table();
+
+  const auto statistics = store->statistics();
+  ASSERT_EQ(statistics.size(), 1);
+  EXPECT_EQ(statistics[0].normalized_sql, "SELECT * FROM table_a WHERE a > ?");
+  EXPECT_EQ(statistics[0].calls, 2);
+  EXPECT_EQ(statistics[0].rows_returned, 2);
+  EXPECT_GT(statistics[0].plan_execution.total.count(), 0);
+  EXPECT_GT(statistics[0].peak_intermediate_memory, 0);
+}
+
+}  // namespace opossum
@@ -1,6 +1,8 @@
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "base_test.hpp"
 
@@ -588,6 +590,74 @@ TEST_F(SQLPipelineStatementTest, GetResultTableTransactionFailureAutoCommit) {
   EXPECT_EQ(table2, nullptr);
 }
 
+TEST_F(SQLPipelineStatementTest, PeakMemoryUsage) {
+  const auto sql = "SELECT a, SUM(b) FROM table_a WHERE a > 200 GROUP BY a";
+
+  // Without a memory limit (and without a query statistics store), the statement's memory is not tracked
+  auto untracked_sql_pipeline = SQLPipelineBuilder{sql}.create_pipeline();
+  auto untracked_statement = get_sql_pipeline_statements(untracked_sql_pipeline).at(0);
+  EXPECT_EQ(untracked_statement->get_result_table().first, SQLPipelineStatus::Success);
+  EXPECT_EQ(untracked_statement->metrics()->peak_memory_usage, 0);
+
+  auto sql_pipeline = SQLPipelineBuilder{sql}.with_memory_limit(1'000'000'000).create_pipeline();
+  auto statement = get_sql_pipeline_statements(sql_pipeline).at(0);
+
+  const auto [pipeline_status, table] = statement->get_result_table();
+  EXPECT_EQ(pipeline_status, SQLPipelineStatus::Success);
+  EXPECT_GT(statement->metrics()->peak_memory_usage, 0);
+  EXPECT_FALSE(statement->metrics()->memory_limit_exceeded);
+
+  // The statement's peak covers the peaks of all of its operators
+  auto max_operator_peak_memory_usage = size_t{0};
+  auto operators = std::vector<std::shared_ptr<const AbstractOperator>>{statement->get_physical_plan()};
+  while (!operators.empty()) {
+    const auto op = operators.back();
+    operators.pop_back();
+    max_operator_peak_memory_usage = std::max(max_operator_peak_memory_usage, op->performance_data().peak_memory_usage);
+    if (op->input_left()) operators.emplace_back(op->input_left());
+    if (op->input_right()) operators.emplace_back(op->input_right());
+  }
+  EXPECT_GT(max_operator_peak_memory_usage, 0);
+  EXPECT_LE(max_operator_peak_memory_usage, statement->metrics()->peak_memory_usage);
+}
+
+TEST_F(SQLPipelineStatementTest, MemoryLimitExceeded) {
+  const auto sql = "SELECT a, SUM(b) FROM table_a WHERE a > 200 GROUP BY a";
+  auto sql_pipeline = SQLPipelineBuilder{sql}.with_memory_limit(1).create_pipeline();
+  auto statement = get_sql_pipeline_statements(sql_pipeline).at(0);
+  EXPECT_EQ(statement->memory_limit, 1);
+
+  const auto [pipeline_status, table] = statement->get_result_table();
+  EXPECT_EQ(pipeline_status, SQLPipelineStatus::Failure);
+  EXPECT_EQ(table, nullptr);
+  EXPECT_TRUE(statement->metrics()->memory_limit_exceeded);
+  EXPECT_TRUE(statement->transaction_context()->aborted());
+  EXPECT_EQ(statement->transaction_context()->rollback_reason(), RollbackReason::OutOfMemory);
+}
+
+TEST_F(SQLPipelineStatementTest, MemoryLimitExceededWithoutMvcc) {
+  const auto sql = "SELECT a, SUM(b) FROM table_a WHERE a > 200 GROUP BY a";
+  auto sql_pipeline = SQLPipelineBuilder{sql}.disable_mvcc().with_memory_limit(1).create_pipeline();
+  auto statement = get_sql_pipeline_statements(sql_pipeline).at(0);
+  EXPECT_EQ(statement->transaction_context(), nullptr);
+
+  const auto [pipeline_status, table] = statement->get_result_table();
+  EXPECT_EQ(pipeline_status, SQLPipelineStatus::Failure);
+  EXPECT_EQ(table, nullptr);
+  EXPECT_TRUE(statement->metrics()->memory_limit_exceeded);
+}
+
+TEST_F(SQLPipelineStatementTest, DefaultMemoryLimit) {
+  Hyrise::get().default_statement_memory_limit = 1'000'000'000;
+
+  auto sql_pipeline = SQLPipelineBuilder{_select_query_a}.create_pipeline();
+  EXPECT_EQ(get_sql_pipeline_statements(sql_pipeline).at(0)->memory_limit, 1'000'000'000);
+
+  const auto [pipeline_status, table] = sql_pipeline.get_result_table();
+  EXPECT_EQ(pipeline_status, SQLPipelineStatus::Success);
+  EXPECT_TABLE_EQ_UNORDERED(table, _table_a);
+}
+
 TEST_F(SQLPipelineStatementTest, GetTimes) {
   auto sql_pipeline = SQLPipelineBuilder{_select_query_a}.create_pipeline();
   auto statement = get_sql_pipeline_statements(sql_pipeline).at(0);
@@ -599,6 +669,7 @@ TEST_F(SQLPipelineStatementTest, GetTimes) {
   EXPECT_EQ(metrics->optimization_duration, zero_duration);
   EXPECT_EQ(metrics->lqp_translation_duration, zero_duration);
   EXPECT_EQ(metrics->plan_execution_duration, zero_duration);
+  EXPECT_TRUE(metrics->optimizer_rule_metrics.empty());
 
   // Run to get times
   statement->get_result_table();
@@ -607,6 +678,10 @@ TEST_F(SQLPipelineStatementTest, GetTimes) {
   EXPECT_GT(metrics->optimization_duration, zero_duration);
   EXPECT_GT(metrics->lqp_translation_duration, zero_duration);
   EXPECT_GT(metrics->plan_execution_duration, zero_duration);
+
+  // One entry per rule of the default optimizer
+  ASSERT_FALSE(metrics->optimizer_rule_metrics.empty());
+  EXPECT_EQ(metrics->optimizer_rule_metrics.front().rule_name, "DependentGroupByReductionRule");
 }
 
 TEST_F(SQLPipelineStatementTest, CacheQueryPlan) {
@@ -0,0 +1,165 @@
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+
+#include "cache/lru_cache.hpp"
+#include "hyrise.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "sql/sql_pipeline_statement.hpp"
+#include "sql/sql_result_cache.hpp"
+
+namespace opossum {
+
+class SQLResultCacheTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    Hyrise::get().storage_manager.add_table("table_a", load_table("resources/test_data/tbl/int_float.tbl", 2));
+    Hyrise::get().storage_manager.add_table("table_b", load_table("resources/test_data/tbl/int_float2.tbl", 2));
+
+    cache = std::make_shared<SQLResultCache>();
+  }
+
+  // Returns the result table and whether it was retrieved from the cache
+  std::pair<std::shared_ptr<const Table>, bool> execute_query(const std::string& query) {
+    auto pipeline = SQLPipelineBuilder{query}.with_result_cache(cache).create_pipeline();
+    const auto [status, table] = pipeline.get_result_table();
+    EXPECT_EQ(status, SQLPipelineStatus::Success);
+
+    return {table, pipeline.metrics().statement_metrics.at(0)->result_cache_hit};
+  }
+
+  const std::string Q1 = "SELECT * FROM table_a WHERE a > 200;";
+  const std::string Q2 = "SELECT table_a.a, table_b.b FROM table_a JOIN table_b ON table_a.a = table_b.a;";
+
+  std::shared_ptr<SQLResultCache> cache;
+};
+
+TEST_F(SQLResultCacheTest, IsCacheable) {
+  EXPECT_TRUE(SQLResultCache::is_cacheable(StoredTableNode::make("table_a")));
+  EXPECT_TRUE(SQLResultCache::is_cacheable(
+      SQLPipelineBuilder{"SELECT * FROM table_a WHERE a IN (SELECT a FROM table_b)"}
+          .create_pipeline()
+          .get_optimized_logical_plans()
+          .at(0)));
+
+  EXPECT_FALSE(SQLResultCache::is_cacheable(
+      SQLPipelineBuilder{"INSERT INTO table_a VALUES (1, 1.0)"}.create_pipeline().get_optimized_logical_plans().at(0)));
+  EXPECT_FALSE(SQLResultCache::is_cacheable(
+      SQLPipelineBuilder{"SELECT * FROM meta_tables"}.create_pipeline().get_optimized_logical_plans().at(0)));
+}
+
+TEST_F(SQLResultCacheTest, HitForSameQuery) {
+  const auto [first_result, first_hit] = execute_query(Q1);
+  EXPECT_FALSE(first_hit);
+  EXPECT_EQ(cache->size(), 1u);
+  EXPECT_GT(cache->memory_usage(), 0u);
+
+  const auto [second_result, second_hit] = execute_query(Q1);
+  EXPECT_TRUE(second_hit);
+  EXPECT_EQ(second_result, first_result);
+
+  // Other literals result in other plans
+  const auto [other_result, other_hit] = execute_query("SELECT * FROM table_a WHERE a > 300;");
+  EXPECT_FALSE(other_hit);
+
+  EXPECT_EQ(cache->hit_count(), 1u);
+  EXPECT_EQ(cache->miss_count(), 2u);
+}
+
+TEST_F(SQLResultCacheTest, InvalidatedByCommits) {
+  execute_query(Q1);
+  execute_query(Q2);
+
+  // Writing to table_b invalidates Q2, but not Q1
+  SQLPipelineBuilder{"INSERT INTO table_b VALUES (12345, 1.0)"}.create_pipeline().get_result_table();
+  EXPECT_TRUE(execute_query(Q1).second);
+
+  const auto [result_after_insert, hit_after_insert] = execute_query(Q2);
+  EXPECT_FALSE(hit_after_insert);
+  EXPECT_EQ(result_after_insert->row_count(), 4u);
+  EXPECT_TRUE(execute_query(Q2).second);
+
+  SQLPipelineBuilder{"UPDATE table_a SET b = 2.0 WHERE a = 12345"}.create_pipeline().get_result_table();
+  EXPECT_FALSE(execute_query(Q1).second);
+  EXPECT_FALSE(execute_query(Q2).second);
+  EXPECT_TRUE(execute_query(Q1).second);
+
+  SQLPipelineBuilder{"DELETE FROM table_a WHERE a = 12345"}.create_pipeline().get_result_table();
+  const auto [result_after_delete, hit_after_delete] = execute_query(Q1);
+  EXPECT_FALSE(hit_after_delete);
+  EXPECT_EQ(result_after_delete->row_count(), 1u);
+
+  // Rolled back writes do not invalidate cached results
+  execute_query(Q1);
+  auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  SQLPipelineBuilder{"DELETE FROM table_a"}
+      .with_transaction_context(transaction_context)
+      .create_pipeline()
+      .get_result_table();
+  transaction_context->rollback(RollbackReason::User);
+  EXPECT_TRUE(execute_query(Q1).second);
+}
+
+TEST_F(SQLResultCacheTest, InvalidatedByReplacedTable) {
+  execute_query(Q1);
+
+  Hyrise::get().storage_manager.drop_table("table_a");
+  Hyrise::get().storage_manager.add_table("table_a", load_table("resources/test_data/tbl/int_float2.tbl", 2));
+
+  const auto [result, hit] = execute_query(Q1);
+  EXPECT_FALSE(hit);
+  EXPECT_EQ(result->row_count(), 2u);
+}
+
+TEST_F(SQLResultCacheTest, NotUsedInTransactions) {
+  execute_query(Q1);
+
+  auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  auto pipeline = SQLPipelineBuilder{Q1}.with_result_cache(cache).with_transaction_context(transaction_context);
+  auto transaction_pipeline = pipeline.create_pipeline();
+  transaction_pipeline.get_result_table();
+  EXPECT_FALSE(transaction_pipeline.metrics().statement_metrics.at(0)->result_cache_hit);
+  transaction_context->commit();
+
+  auto non_mvcc_pipeline = SQLPipelineBuilder{Q2}.with_result_cache(cache).disable_mvcc().create_pipeline();
+  non_mvcc_pipeline.get_result_table();
+  EXPECT_FALSE(non_mvcc_pipeline.metrics().statement_metrics.at(0)->result_cache_hit);
+
+  execute_query("INSERT INTO table_a VALUES (1, 1.0)");
+  EXPECT_EQ(cache->size(), 1u);
+}
+
+TEST_F(SQLResultCacheTest, UsedByDefault) {
+  auto pipeline = SQLPipelineBuilder{Q1}.create_pipeline();
+  pipeline.get_result_table();
+  EXPECT_EQ(pipeline.result_cache, nullptr);
+
+  Hyrise::get().default_result_cache = cache;
+  SQLPipelineBuilder{Q1}.create_pipeline().get_result_table();
+  EXPECT_EQ(cache->size(), 1u);
+}
+
+TEST_F(SQLResultCacheTest, MemoryBudget) {
+  execute_query(Q2);
+  const auto result_memory_usage = cache->memory_usage();
+
+  // Only one of the results fits into the budget
+  cache = std::make_shared<SQLResultCache>(DefaultCacheCapacity, result_memory_usage * 3 / 2);
+  cache->replace_cache_impl<LRUCache<SQLResultCache::LQPKey, std::shared_ptr<SQLResultCache::Entry>>>();
+
+  execute_query(Q2);
+  EXPECT_EQ(cache->size(), 1u);
+  execute_query("SELECT table_a.a, table_b.b FROM table_a JOIN table_b ON table_a.a = table_b.a WHERE table_a.a > 0;");
+  EXPECT_EQ(cache->size(), 1u);
+  EXPECT_LE(cache->memory_usage(), cache->memory_budget());
+  EXPECT_FALSE(execute_query(Q2).second);
+
+  // Results that exceed the budget on their own are not cached
+  cache = std::make_shared<SQLResultCache>(DefaultCacheCapacity, result_memory_usage / 2);
+  execute_query(Q2);
+  EXPECT_EQ(cache->size(), 0u);
+}
+
+}  // namespace opossum
@@ -0,0 +1,198 @@
+#include "base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "statistics/cardinality_estimator.hpp"
+#include "statistics/cardinality_feedback_store.hpp"
+#include "statistics/subplan_statistics_cache.hpp"
+#include "statistics/table_statistics.hpp"
+#include "utils/load_table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class CardinalityFeedbackStoreTest : public BaseTest {
+ public:
+  void SetUp() override {
+    Hyrise::get().default_cardinality_feedback_store = std::make_shared<CardinalityFeedbackStore>();
+    Hyrise::get().default_subplan_statistics_cache = std::make_shared<SubplanStatisticsCache>();
+    Hyrise::get().storage_manager.add_table("int_float", load_table("resources/test_data/tbl/int_float.tbl"));
+    Hyrise::get().storage_manager.add_table("int_int", load_table("resources/test_data/tbl/int_int.tbl"));
+
+    int_float_node = StoredTableNode::make("int_float");
+    int_int_node = StoredTableNode::make("int_int");
+    a = int_float_node->get_column("a");
+    b = int_int_node->get_column("a");
+  }
+
+  std::shared_ptr<StoredTableNode> int_float_node, int_int_node;
+  std::shared_ptr<LQPColumnExpression> a, b;
+};
+
+TEST_F(CardinalityFeedbackStoreTest, Signature) {
+  const auto predicate_node = PredicateNode::make(greater_than_(a, 200), int_float_node);
+  const auto signature = CardinalityFeedbackStore::signature(*predicate_node);
+  ASSERT_TRUE(signature);
+
+  // Signatures do not depend on the concrete LQP or the order of operands
+  EXPECT_EQ(CardinalityFeedbackStore::signature(
+                *PredicateNode::make(less_than_(value_(200), StoredTableNode::make("int_float")->get_column("a")),
+                                     StoredTableNode::make("int_float"))),
+            signature);
+  EXPECT_NE(CardinalityFeedbackStore::signature(*PredicateNode::make(greater_than_(a, 300), int_float_node)),
+            signature);
+
+  const auto join_node = JoinNode::make(JoinMode::Inner, equals_(a, b), int_float_node, int_int_node);
+  const auto join_signature = CardinalityFeedbackStore::signature(*join_node);
+  ASSERT_TRUE(join_signature);
+  EXPECT_EQ(CardinalityFeedbackStore::signature(
+                *JoinNode::make(JoinMode::Inner, equals_(b, a), int_int_node, int_float_node)),
+            join_signature);
+  EXPECT_NE(CardinalityFeedbackStore::signature(
+                *JoinNode::make(JoinMode::Semi, equals_(a, b), int_float_node, int_int_node)),
+            join_signature);
+
+  // Only PredicateNodes and JoinNodes on stored tables have signatures
+  const auto mock_node = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "a"}});
+  EXPECT_FALSE(CardinalityFeedbackStore::signature(*PredicateNode::make(greater_than_(mock_node->get_column("a"), 200),
+                                                                        mock_node)));
+  EXPECT_FALSE(CardinalityFeedbackStore::signature(*JoinNode::make(JoinMode::Cross, int_float_node, int_int_node)));
+  EXPECT_FALSE(CardinalityFeedbackStore::signature(*int_float_node));
+}
+
+TEST_F(CardinalityFeedbackStoreTest, RecordAndLookup) {
+  auto store = CardinalityFeedbackStore{};
+
+  // New entries are compared to the estimated selectivity, existing ones to the previously observed selectivity
+  EXPECT_TRUE(store.record("x", 0.5f, 0.1f, 100));
+  EXPECT_FALSE(store.record("x", 0.5f, 0.105f, 100));
+  EXPECT_TRUE(store.record("x", 0.5f, 0.2f, 100));
+  EXPECT_TRUE(store.record("y", 0.5f, 0.0f, 100));
+  EXPECT_FALSE(store.record("w", 0.5f, 0.52f, 100));
+  EXPECT_FALSE(store.record("w", 0.1f, 0.52f, 100));
+
+  EXPECT_EQ(store.try_get_selectivity("x"), 0.2f);
+  EXPECT_EQ(store.try_get_selectivity("y"), 0.0f);
+  EXPECT_EQ(store.try_get_selectivity("w"), 0.52f);
+  EXPECT_FALSE(store.try_get_selectivity("z"));
+
+  const auto entries = store.entries();
+  ASSERT_EQ(entries.size(), 3u);
+  EXPECT_EQ(entries[0].signature, "w");
+  EXPECT_EQ(entries[1].signature, "y");
+  EXPECT_EQ(entries[2].signature, "x");
+  EXPECT_EQ(entries[2].observation_count, 3u);
+  EXPECT_FLOAT_EQ(entries[2].q_error(), 2.5f);
+  EXPECT_FLOAT_EQ(entries[1].q_error(), 50.0f);
+}
+
+TEST_F(CardinalityFeedbackStoreTest, EvictsLeastRecentlyObserved) {
+  auto store = CardinalityFeedbackStore{2};
+
+  store.record("x", 0.5f, 0.1f, 100);
+  store.record("y", 0.5f, 0.1f, 100);
+  store.record("x", 0.5f, 0.1f, 100);
+  store.record("z", 0.5f, 0.1f, 100);
+
+  EXPECT_EQ(store.size(), 2u);
+  EXPECT_TRUE(store.try_get_selectivity("x"));
+  EXPECT_FALSE(store.try_get_selectivity("y"));
+  EXPECT_TRUE(store.try_get_selectivity("z"));
+}
+
+TEST_F(CardinalityFeedbackStoreTest, UsedByCardinalityEstimator) {
+  const auto predicate_node = PredicateNode::make(greater_than_(a, 200), int_float_node);
+  const auto join_node = JoinNode::make(JoinMode::Inner, equals_(a, b), int_float_node, int_int_node);
+
+  auto& store = *Hyrise::get().default_cardinality_feedback_store;
+  store.record(*CardinalityFeedbackStore::signature(*predicate_node), 1.0f, 0.5f, 3);
+  store.record(*CardinalityFeedbackStore::signature(*join_node), 1.0f, 0.25f, 9);
+
+  EXPECT_FLOAT_EQ(CardinalityEstimator{}.estimate_cardinality(predicate_node), 1.5f);
+  EXPECT_FLOAT_EQ(CardinalityEstimator{}.estimate_cardinality(join_node), 2.25f);
+
+  // The feedback is applied relative to the estimated input cardinality
+  const auto stacked_predicate_node = PredicateNode::make(greater_than_(a, 200), join_node);
+  EXPECT_FLOAT_EQ(CardinalityEstimator{}.estimate_cardinality(stacked_predicate_node), 1.125f);
+}
+
+TEST_F(CardinalityFeedbackStoreTest, RecordsExecutedPlans) {
+  const auto& store = Hyrise::get().default_cardinality_feedback_store;
+  const auto& subplan_statistics_cache = Hyrise::get().default_subplan_statistics_cache;
+
+  SQLPipelineBuilder{"SELECT * FROM int_float JOIN int_int ON int_float.a = int_int.a"}
+      .create_pipeline()
+      .get_result_table();
+
+  const auto join_node = JoinNode::make(JoinMode::Inner, equals_(a, b), int_float_node, int_int_node);
+  const auto join_signature = CardinalityFeedbackStore::signature(*join_node);
+  ASSERT_TRUE(store->try_get_selectivity(*join_signature));
+  EXPECT_FLOAT_EQ(*store->try_get_selectivity(*join_signature), 1.0f / 3.0f);
+
+  // The histograms estimate `b > 457` to qualify two out of three rows independently of `a > 200`. In fact, both rows
+  // that satisfy `a > 200` satisfy `b > 457`, so the selectivity of whichever predicate is executed second is
+  // corrected. Cached estimations of subplans that contain it are evicted, others are kept.
+  const auto stacked_predicates_lqp =
+      PredicateNode::make(greater_than_(int_float_node->get_column("b"), 457),
+                          PredicateNode::make(greater_than_(a, 200), int_float_node));
+  const auto other_predicate_lqp = PredicateNode::make(greater_than_(a, 300), int_float_node);
+  CardinalityEstimator{}.estimate_statistics(stacked_predicates_lqp);
+  CardinalityEstimator{}.estimate_statistics(other_predicate_lqp);
+  ASSERT_TRUE(subplan_statistics_cache->try_get(stacked_predicates_lqp));
+  ASSERT_TRUE(subplan_statistics_cache->try_get(other_predicate_lqp));
+
+  SQLPipelineBuilder{"SELECT * FROM int_float WHERE a > 200 AND b > 457"}.create_pipeline().get_result_table();
+
+  const auto predicate_signature =
+      CardinalityFeedbackStore::signature(*PredicateNode::make(greater_than_(a, 200), int_float_node));
+  ASSERT_TRUE(store->try_get_selectivity(*predicate_signature));
+  EXPECT_FALSE(subplan_statistics_cache->try_get(stacked_predicates_lqp));
+  EXPECT_TRUE(subplan_statistics_cache->try_get(other_predicate_lqp));
+}
+
+TEST_F(CardinalityFeedbackStoreTest, EvictsCachedPlans) {
+  const auto pqp_cache = std::make_shared<SQLPhysicalPlanCache>();
+  const auto lqp_cache = std::make_shared<SQLLogicalPlanCache>();
+  const auto misestimated_sql = std::string{"SELECT * FROM int_float WHERE a > 200 AND b > 457"};
+  const auto estimated_sql = std::string{"SELECT * FROM int_int WHERE a > 200"};
+
+  const auto execute = [&](const auto& sql) {
+    auto pipeline = SQLPipelineBuilder{sql}.with_pqp_cache(pqp_cache).with_lqp_cache(lqp_cache).create_pipeline();
+    pipeline.get_result_table();
+    return pipeline.metrics().statement_metrics.at(0)->query_plan_cache_hit;
+  };
+
+  // The histograms estimate the selectivity of `a > 200` correctly, so the plan is cached right away
+  EXPECT_FALSE(execute(estimated_sql));
+  EXPECT_TRUE(pqp_cache->has(estimated_sql));
+  EXPECT_TRUE(lqp_cache->has(estimated_sql));
+
+  // The first execution corrects the estimation that the plan was optimized with (see RecordsExecutedPlans). Only
+  // the plans that contain the corrected predicate are evicted.
+  EXPECT_FALSE(execute(misestimated_sql));
+  EXPECT_FALSE(pqp_cache->has(misestimated_sql));
+  EXPECT_FALSE(lqp_cache->has(misestimated_sql));
+  EXPECT_TRUE(pqp_cache->has(estimated_sql));
+  EXPECT_TRUE(lqp_cache->has(estimated_sql));
+
+  // The second execution confirms the estimation, so that the plan remains cached
+  EXPECT_FALSE(execute(misestimated_sql));
+  EXPECT_TRUE(pqp_cache->has(misestimated_sql));
+  EXPECT_TRUE(lqp_cache->has(misestimated_sql));
+
+  EXPECT_TRUE(execute(misestimated_sql));
+  EXPECT_TRUE(execute(estimated_sql));
+}
+
+TEST_F(CardinalityFeedbackStoreTest, DisabledByDefault) {
+  Hyrise::reset();
+  EXPECT_FALSE(Hyrise::get().default_cardinality_feedback_store);
+}
+
+}  // namespace opossum
@@ -0,0 +1,130 @@
+#include "base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "statistics/cardinality_estimator.hpp"
+#include "statistics/subplan_statistics_cache.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/table.hpp"
+#include "utils/load_table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class SubplanStatisticsCacheTest : public BaseTest {
+ public:
+  void SetUp() override {
+    Hyrise::get().storage_manager.add_table("int_float", load_table("resources/test_data/tbl/int_float.tbl"));
+    Hyrise::get().storage_manager.add_table("int_int", load_table("resources/test_data/tbl/int_int.tbl"));
+
+    table_statistics = std::make_shared<TableStatistics>(std::vector<std::shared_ptr<BaseAttributeStatistics>>{}, 42);
+  }
+
+  // Creates a new, but always equal LQP with a literal of @param value
+  static std::shared_ptr<AbstractLQPNode> predicate_lqp(const int32_t value) {
+    const auto stored_table_node = StoredTableNode::make("int_float");
+    return PredicateNode::make(greater_than_(stored_table_node->get_column("a"), value), stored_table_node);
+  }
+
+  std::shared_ptr<TableStatistics> table_statistics;
+};
+
+TEST_F(SubplanStatisticsCacheTest, HitForEqualSubplan) {
+  auto cache = SubplanStatisticsCache{};
+
+  cache.set(predicate_lqp(5), table_statistics);
+  EXPECT_EQ(cache.size(), 1u);
+
+  EXPECT_EQ(cache.try_get(predicate_lqp(5)), table_statistics);
+  EXPECT_EQ(cache.try_get(predicate_lqp(6)), nullptr);
+
+  EXPECT_EQ(cache.hit_count(), 1u);
+  EXPECT_EQ(cache.miss_count(), 1u);
+}
+
+TEST_F(SubplanStatisticsCacheTest, KeyIsNotAffectedByChangesToTheOriginalPlan) {
+  auto cache = SubplanStatisticsCache{};
+
+  const auto lqp = predicate_lqp(5);
+  cache.set(lqp, table_statistics);
+
+  // The optimizer continues to work on the plan after estimating it
+  std::static_pointer_cast<PredicateNode>(lqp)->node_expressions[0] =
+      less_than_(lqp->left_input()->column_expressions()[0], 3);
+
+  EXPECT_EQ(cache.try_get(predicate_lqp(5)), table_statistics);
+}
+
+TEST_F(SubplanStatisticsCacheTest, InvalidatedWhenTableStatisticsChange) {
+  auto cache = SubplanStatisticsCache{};
+
+  const auto stored_table_node_a = StoredTableNode::make("int_float");
+  const auto stored_table_node_b = StoredTableNode::make("int_int");
+  const auto join_predicate = equals_(stored_table_node_a->get_column("a"), stored_table_node_b->get_column("a"));
+  const auto join_lqp = JoinNode::make(JoinMode::Inner, join_predicate, stored_table_node_a, stored_table_node_b);
+
+  cache.set(predicate_lqp(5), table_statistics);
+  cache.set(join_lqp, table_statistics);
+
+  const auto table = Hyrise::get().storage_manager.get_table("int_int");
+  table->set_table_statistics(TableStatistics::from_table(*table));
+
+  // Only entries that use the table are affected
+  EXPECT_EQ(cache.try_get(join_lqp), nullptr);
+  EXPECT_EQ(cache.try_get(predicate_lqp(5)), table_statistics);
+  EXPECT_EQ(cache.size(), 1u);
+
+  // Recreating a table invalidates its entries, too
+  Hyrise::get().storage_manager.drop_table("int_float");
+  Hyrise::get().storage_manager.add_table("int_float", load_table("resources/test_data/tbl/int_float.tbl"));
+  EXPECT_EQ(cache.try_get(predicate_lqp(5)), nullptr);
+  EXPECT_EQ(cache.size(), 0u);
+}
+
+TEST_F(SubplanStatisticsCacheTest, OnlyStoredTablesAreCached) {
+  auto cache = SubplanStatisticsCache{};
+
+  const auto mock_node = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "a"}});
+  cache.set(PredicateNode::make(greater_than_(mock_node->get_column("a"), 5), mock_node), table_statistics);
+  EXPECT_EQ(cache.size(), 0u);
+
+  // Statistics that were modified for the StoredTableNode are not tracked either
+  const auto lqp = predicate_lqp(5);
+  std::static_pointer_cast<StoredTableNode>(lqp->left_input())->table_statistics = table_statistics;
+  cache.set(lqp, table_statistics);
+  EXPECT_EQ(cache.size(), 0u);
+}
+
+TEST_F(SubplanStatisticsCacheTest, EvictsLeastRecentlyUsed) {
+  auto cache = SubplanStatisticsCache{2};
+
+  cache.set(predicate_lqp(1), table_statistics);
+  cache.set(predicate_lqp(2), table_statistics);
+  EXPECT_TRUE(cache.try_get(predicate_lqp(1)));
+
+  cache.set(predicate_lqp(3), table_statistics);
+  EXPECT_EQ(cache.size(), 2u);
+  EXPECT_TRUE(cache.try_get(predicate_lqp(1)));
+  EXPECT_FALSE(cache.try_get(predicate_lqp(2)));
+  EXPECT_TRUE(cache.try_get(predicate_lqp(3)));
+}
+
+TEST_F(SubplanStatisticsCacheTest, UsedByCardinalityEstimator) {
+  // The cache is opt-in
+  EXPECT_FALSE(Hyrise::get().default_subplan_statistics_cache);
+  Hyrise::get().default_subplan_statistics_cache = std::make_shared<SubplanStatisticsCache>();
+  const auto& cache = Hyrise::get().default_subplan_statistics_cache;
+
+  // Different optimizer invocations use different estimators, but share the cache
+  const auto estimated_statistics = CardinalityEstimator{}.estimate_statistics(predicate_lqp(5));
+  EXPECT_EQ(cache->size(), 1u);
+  EXPECT_EQ(CardinalityEstimator{}.estimate_statistics(predicate_lqp(5)), estimated_statistics);
+  EXPECT_EQ(cache->hit_count(), 1u);
+}
+
+}  // namespace opossum
@@ -0,0 +1,189 @@
+#include <memory>
+
+#include "base_test.hpp"
+
+#include "storage/chunk.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/column_version_store.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/mvcc_data.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "storage/versioned_segment.hpp"
+
+namespace opossum {
+
+class ColumnVersionStoreTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = load_table("resources/test_data/tbl/int_float2.tbl", 2);
+    _chunk = _table->get_chunk(ChunkID{0});
+  }
+
+  AllTypeVariant visible_value(const ChunkOffset chunk_offset, const TransactionID transaction_id,
+                               const CommitID snapshot_commit_id) {
+    const auto& column_versions = _chunk->mvcc_data()->column_versions;
+    const auto segment =
+        column_versions.visible_segment(*_chunk, ColumnID{1}, DataType::Float, transaction_id, snapshot_commit_id);
+    return (*segment)[chunk_offset];
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<Chunk> _chunk;
+};
+
+TEST_F(ColumnVersionStoreTest, Visibility) {
+  auto& column_versions = _chunk->mvcc_data()->column_versions;
+  EXPECT_FALSE(column_versions.has_versions());
+  EXPECT_EQ(column_versions.visible_segment(*_chunk, ColumnID{1}, DataType::Float, TransactionID{5}, CommitID{1}),
+            _chunk->get_segment(ColumnID{1}));
+
+  EXPECT_TRUE(column_versions.try_add_versions(ChunkOffset{0}, {{ColumnID{1}, 1.5f}}, TransactionID{5}, CommitID{1}));
+  EXPECT_TRUE(column_versions.has_versions());
+  EXPECT_EQ(column_versions.versioned_column_ids(), std::vector<ColumnID>{ColumnID{1}});
+
+  // Uncommitted versions are only visible to their own transaction
+  EXPECT_EQ(visible_value(ChunkOffset{0}, TransactionID{5}, CommitID{1}), AllTypeVariant{1.5f});
+  EXPECT_EQ(visible_value(ChunkOffset{1}, TransactionID{5}, CommitID{1}), AllTypeVariant{457.7f});
+  EXPECT_EQ(visible_value(ChunkOffset{0}, TransactionID{6}, CommitID{1}), AllTypeVariant{456.7f});
+
+  column_versions.commit_versions(TransactionID{5}, CommitID{3});
+  EXPECT_EQ(visible_value(ChunkOffset{0}, TransactionID{6}, CommitID{2}), AllTypeVariant{456.7f});
+  EXPECT_EQ(visible_value(ChunkOffset{0}, TransactionID{6}, CommitID{3}), AllTypeVariant{1.5f});
+}
+
+TEST_F(ColumnVersionStoreTest, Conflicts) {
+  auto& column_versions = _chunk->mvcc_data()->column_versions;
+
+  EXPECT_TRUE(column_versions.try_add_versions(ChunkOffset{0}, {{ColumnID{1}, 1.5f}}, TransactionID{5}, CommitID{1}));
+  EXPECT_TRUE(column_versions.try_add_versions(ChunkOffset{0}, {{ColumnID{0}, 7}}, TransactionID{5}, CommitID{1}));
+  EXPECT_FALSE(column_versions.try_add_versions(ChunkOffset{0}, {{ColumnID{1}, 2.5f}}, TransactionID{6}, CommitID{1}));
+  EXPECT_TRUE(column_versions.has_conflicting_version(ChunkOffset{0}, TransactionID{6}, CommitID{1}));
+  EXPECT_FALSE(column_versions.has_conflicting_version(ChunkOffset{0}, TransactionID{5}, CommitID{1}));
+  EXPECT_FALSE(column_versions.has_conflicting_version(ChunkOffset{1}, TransactionID{6}, CommitID{1}));
+
+  // After the commit, only transactions whose snapshot includes the versions may add new ones
+  column_versions.commit_versions(TransactionID{5}, CommitID{3});
+  EXPECT_TRUE(column_versions.has_conflicting_version(ChunkOffset{0}, TransactionID{6}, CommitID{2}));
+  EXPECT_FALSE(column_versions.try_add_versions(ChunkOffset{0}, {{ColumnID{1}, 2.5f}}, TransactionID{6}, CommitID{2}));
+  EXPECT_TRUE(column_versions.try_add_versions(ChunkOffset{0}, {{ColumnID{1}, 2.5f}}, TransactionID{7}, CommitID{3}));
+
+  column_versions.rollback_versions(TransactionID{7});
+  EXPECT_EQ(visible_value(ChunkOffset{0}, TransactionID{7}, CommitID{3}), AllTypeVariant{1.5f});
+  EXPECT_FALSE(column_versions.has_conflicting_version(ChunkOffset{0}, TransactionID{8}, CommitID{3}));
+}
+
+TEST_F(ColumnVersionStoreTest, Merge) {
+  ChunkEncoder::encode_chunk(_chunk, _table->column_data_types(), SegmentEncodingSpec{EncodingType::Dictionary});
+  auto& column_versions = _chunk->mvcc_data()->column_versions;
+
+  EXPECT_TRUE(column_versions.try_add_versions(ChunkOffset{0}, {{ColumnID{1}, 1.5f}}, TransactionID{5}, CommitID{1}));
+  column_versions.commit_versions(TransactionID{5}, CommitID{3});
+  EXPECT_TRUE(column_versions.try_add_versions(ChunkOffset{1}, {{ColumnID{1}, 2.5f}}, TransactionID{6}, CommitID{3}));
+  column_versions.commit_versions(TransactionID{6}, CommitID{4});
+
+  // Versions that are not yet visible to all transactions are kept
+  EXPECT_EQ(column_versions.merge(*_chunk, _table->column_data_types(), CommitID{2}), 0);
+  EXPECT_TRUE(_chunk->pruning_statistics().has_value());
+
+  EXPECT_EQ(column_versions.merge(*_chunk, _table->column_data_types(), CommitID{3}), 1);
+  EXPECT_TRUE(column_versions.has_versions());
+
+  // The pruning statistics are kept, but those of the updated column must not be used anymore
+  EXPECT_TRUE(_chunk->pruning_statistics().has_value());
+  EXPECT_FALSE(column_versions.has_stale_pruning_statistics(ColumnID{0}));
+  EXPECT_TRUE(column_versions.has_stale_pruning_statistics(ColumnID{1}));
+
+  // The merged segment keeps its encoding
+  const auto segment = _chunk->get_segment(ColumnID{1});
+  EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<float>>(segment));
+  EXPECT_EQ((*segment)[ChunkOffset{0}], AllTypeVariant{1.5f});
+  EXPECT_EQ((*segment)[ChunkOffset{1}], AllTypeVariant{457.7f});
+  EXPECT_EQ(visible_value(ChunkOffset{0}, TransactionID{7}, CommitID{3}), AllTypeVariant{1.5f});
+
+  EXPECT_EQ(column_versions.merge(*_chunk, _table->column_data_types(), CommitID{4}), 1);
+  EXPECT_FALSE(column_versions.has_versions());
+  EXPECT_EQ((*_chunk->get_segment(ColumnID{1}))[ChunkOffset{1}], AllTypeVariant{2.5f});
+  EXPECT_TRUE(column_versions.has_stale_pruning_statistics(ColumnID{1}));
+}
+
+TEST_F(ColumnVersionStoreTest, VisibleSegmentReferencesMainSegment) {
+  ChunkEncoder::encode_chunk(_chunk, _table->column_data_types(), SegmentEncodingSpec{EncodingType::Dictionary});
+  auto& column_versions = _chunk->mvcc_data()->column_versions;
+
+  EXPECT_TRUE(column_versions.try_add_versions(ChunkOffset{1}, {{ColumnID{1}, 1.5f}}, TransactionID{5}, CommitID{1}));
+
+  // The encoded main segment is not copied, only the visible version is stored
+  const auto segment = std::dynamic_pointer_cast<VersionedSegment<float>>(
+      column_versions.visible_segment(*_chunk, ColumnID{1}, DataType::Float, TransactionID{5}, CommitID{1}));
+  ASSERT_TRUE(segment);
+  EXPECT_EQ(segment->main_segment(), _chunk->get_segment(ColumnID{1}));
+  EXPECT_EQ(segment->patched_offsets(), pmr_vector<ChunkOffset>{ChunkOffset{1}});
+  EXPECT_EQ(segment->patched_values(), pmr_vector<float>{1.5f});
+}
+
+TEST_F(ColumnVersionStoreTest, TryScheduleMerge) {
+  auto& column_versions = _chunk->mvcc_data()->column_versions;
+
+  EXPECT_TRUE(column_versions.try_schedule_merge());
+  EXPECT_FALSE(column_versions.try_schedule_merge());
+  column_versions.finish_scheduled_merge();
+  EXPECT_TRUE(column_versions.try_schedule_merge());
+}
+
+TEST_F(ColumnVersionStoreTest, MergeSortedColumn) {
+  _chunk->set_ordered_by({ColumnID{1}, OrderByMode::Ascending});
+  auto& column_versions = _chunk->mvcc_data()->column_versions;
+
+  // The merged value keeps the column sorted
+  EXPECT_TRUE(column_versions.try_add_versions(ChunkOffset{0}, {{ColumnID{1}, 457.0f}}, TransactionID{5}, CommitID{1}));
+  column_versions.commit_versions(TransactionID{5}, CommitID{2});
+  EXPECT_EQ(column_versions.merge(*_chunk, _table->column_data_types(), CommitID{2}), 1);
+  EXPECT_EQ(_chunk->ordered_by(), std::make_optional(std::make_pair(ColumnID{1}, OrderByMode::Ascending)));
+
+  // The merged value breaks the sort order
+  EXPECT_TRUE(column_versions.try_add_versions(ChunkOffset{1}, {{ColumnID{1}, 1.5f}}, TransactionID{6}, CommitID{2}));
+  column_versions.commit_versions(TransactionID{6}, CommitID{3});
+  EXPECT_EQ(column_versions.merge(*_chunk, _table->column_data_types(), CommitID{3}), 1);
+  EXPECT_FALSE(column_versions.has_versions());
+  EXPECT_FALSE(_chunk->ordered_by());
+  EXPECT_EQ((*_chunk->get_segment(ColumnID{1}))[ChunkOffset{1}], AllTypeVariant{1.5f});
+}
+
+TEST_F(ColumnVersionStoreTest, ShouldMerge) {
+  auto& column_versions = _chunk->mvcc_data()->column_versions;
+  const auto add_versions = [&](const TransactionID transaction_id, const CommitID commit_id) {
+    for (auto version_id = size_t{0}; version_id < ColumnVersionStore::MERGE_THRESHOLD; ++version_id) {
+      const auto value = static_cast<float>(version_id);
+      EXPECT_TRUE(column_versions.try_add_versions(ChunkOffset{0}, {{ColumnID{1}, value}}, transaction_id, commit_id));
+    }
+    column_versions.commit_versions(transaction_id, commit_id + 1);
+  };
+
+  EXPECT_FALSE(column_versions.should_merge());
+  add_versions(TransactionID{5}, CommitID{1});
+  EXPECT_TRUE(column_versions.should_merge());
+
+  // If the versions cannot be merged yet, the next attempt is delayed until their number has doubled
+  EXPECT_EQ(column_versions.merge(*_chunk, _table->column_data_types(), CommitID{1}), 0);
+  EXPECT_FALSE(column_versions.should_merge());
+  add_versions(TransactionID{6}, CommitID{2});
+  EXPECT_TRUE(column_versions.should_merge());
+
+  EXPECT_EQ(column_versions.merge(*_chunk, _table->column_data_types(), CommitID{3}),
+            2 * ColumnVersionStore::MERGE_THRESHOLD);
+  EXPECT_FALSE(column_versions.has_versions());
+  EXPECT_FALSE(column_versions.should_merge());
+}
+
+TEST_F(ColumnVersionStoreTest, MergeIntoMutableChunkFails) {
+  const auto table = load_table("resources/test_data/tbl/int_float2.tbl", 10, FinalizeLastChunk::No);
+  const auto chunk = table->get_chunk(ChunkID{0});
+  auto& column_versions = chunk->mvcc_data()->column_versions;
+
+  EXPECT_TRUE(column_versions.try_add_versions(ChunkOffset{0}, {{ColumnID{1}, 1.5f}}, TransactionID{5}, CommitID{1}));
+  column_versions.commit_versions(TransactionID{5}, CommitID{3});
+  EXPECT_THROW(column_versions.merge(*chunk, table->column_data_types(), CommitID{3}), std::logic_error);
+}
+
+}  // namespace opossum
@@ -12,6 +12,7 @@
 #include "operators/insert.hpp"
 #include "operators/projection.hpp"
 #include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
 #include "operators/update.hpp"
 #include "operators/validate.hpp"
 #include "storage/table.hpp"
@@ -47,6 +48,34 @@ class ConstraintsTest : public BaseTest {
       table->add_soft_unique_constraint({ColumnID{0}}, IsPrimaryKey::No);
     }
   }
+
+  std::shared_ptr<TableWrapper> make_values(const std::vector<std::vector<AllTypeVariant>>& rows) {
+    const auto& column_definitions = Hyrise::get().storage_manager.get_table("table_nullable")->column_definitions();
+    auto values = std::make_shared<Table>(column_definitions, TableType::Data);
+    for (const auto& row : rows) {
+      values->append(row);
+    }
+    auto table_wrapper = std::make_shared<TableWrapper>(values);
+    table_wrapper->execute();
+    return table_wrapper;
+  }
+
+  std::shared_ptr<Insert> insert(const std::shared_ptr<TransactionContext>& context,
+                                 const std::vector<std::vector<AllTypeVariant>>& rows) {
+    auto insert = std::make_shared<Insert>("table_nullable", make_values(rows));
+    insert->set_transaction_context(context);
+    insert->execute();
+    return insert;
+  }
+
+  size_t visible_row_count() {
+    auto get_table = std::make_shared<GetTable>("table_nullable");
+    get_table->execute();
+    auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No));
+    validate->execute();
+    return validate->get_output()->row_count();
+  }
 };
 
 TEST_F(ConstraintsTest, InvalidConstraintAdd) {
@@ -82,4 +111,131 @@ TEST_F(ConstraintsTest, InvalidConstraintAdd) {
   EXPECT_THROW(table->add_soft_unique_constraint({ColumnID{0}, ColumnID{2}}, IsPrimaryKey::Yes), std::logic_error);
 }
 
+TEST_F(ConstraintsTest, AddEnforcedConstraint) {
+  auto table_nullable = Hyrise::get().storage_manager.get_table("table_nullable");
+  table_nullable->append({1, 1});
+  table_nullable->append({2, 1});
+  table_nullable->append({3, NULL_VALUE});
+  table_nullable->append({4, NULL_VALUE});
+
+  // Invalid because the existing data contains duplicates
+  EXPECT_THROW(table_nullable->add_unique_constraint({ColumnID{1}}, IsPrimaryKey::No), std::logic_error);
+
+  // Invalid because a (soft) constraint on the same column already exists
+  EXPECT_THROW(table_nullable->add_unique_constraint({ColumnID{0}}, IsPrimaryKey::No), std::logic_error);
+
+  // NULL values do not violate a unique constraint
+  table_nullable->add_unique_constraint({ColumnID{1}, ColumnID{0}}, IsPrimaryKey::No);
+
+  const auto& constraints = table_nullable->get_unique_constraints();
+  ASSERT_EQ(constraints.size(), 2u);
+  EXPECT_EQ(constraints[1].columns, (std::vector<ColumnID>{ColumnID{0}, ColumnID{1}}));
+  EXPECT_EQ(constraints[1].is_enforced, IsEnforced::Yes);
+  EXPECT_TRUE(table_nullable->get_table_hash_index({ColumnID{0}, ColumnID{1}}));
+}
+
+TEST_F(ConstraintsTest, InsertViolatingEnforcedConstraintFails) {
+  auto table_nullable = Hyrise::get().storage_manager.get_table("table_nullable");
+  table_nullable->add_unique_constraint({ColumnID{1}}, IsPrimaryKey::No);
+
+  auto& transaction_manager = Hyrise::get().transaction_manager;
+
+  auto context = transaction_manager.new_transaction_context(AutoCommit::No);
+  EXPECT_FALSE(insert(context, {{1, 1}, {2, 2}, {3, NULL_VALUE}, {4, NULL_VALUE}})->execute_failed());
+  context->commit();
+
+  // Duplicate of a committed row
+  context = transaction_manager.new_transaction_context(AutoCommit::No);
+  EXPECT_TRUE(insert(context, {{5, 5}, {6, 2}})->execute_failed());
+  context->rollback(RollbackReason::Conflict);
+
+  // Duplicate within the inserted rows
+  context = transaction_manager.new_transaction_context(AutoCommit::No);
+  EXPECT_TRUE(insert(context, {{5, 5}, {6, 5}})->execute_failed());
+  context->rollback(RollbackReason::Conflict);
+
+  // Duplicate of a row inserted by an earlier operator of the same transaction
+  context = transaction_manager.new_transaction_context(AutoCommit::No);
+  EXPECT_FALSE(insert(context, {{5, 5}})->execute_failed());
+  EXPECT_TRUE(insert(context, {{6, 5}})->execute_failed());
+  context->rollback(RollbackReason::Conflict);
+
+  // The rows of rolled back transactions do not conflict
+  context = transaction_manager.new_transaction_context(AutoCommit::No);
+  EXPECT_FALSE(insert(context, {{5, 5}, {6, NULL_VALUE}})->execute_failed());
+  context->commit();
+
+  EXPECT_EQ(visible_row_count(), 6u);
+}
+
+TEST_F(ConstraintsTest, ConcurrentInsertsOfSameKeyConflict) {
+  auto table_nullable = Hyrise::get().storage_manager.get_table("table_nullable");
+  table_nullable->add_unique_constraint({ColumnID{0}, ColumnID{1}}, IsPrimaryKey::No);
+
+  auto& transaction_manager = Hyrise::get().transaction_manager;
+  auto context1 = transaction_manager.new_transaction_context(AutoCommit::No);
+  auto context2 = transaction_manager.new_transaction_context(AutoCommit::No);
+
+  EXPECT_FALSE(insert(context1, {{1, 1}})->execute_failed());
+  EXPECT_FALSE(insert(context2, {{1, 2}})->execute_failed());
+
+  // context1 has not committed yet, but its row might become visible
+  EXPECT_TRUE(insert(context2, {{1, 1}})->execute_failed());
+  context2->rollback(RollbackReason::Conflict);
+  context1->commit();
+
+  EXPECT_EQ(visible_row_count(), 1u);
+}
+
+TEST_F(ConstraintsTest, DeleteAndReinsertKey) {
+  auto table_nullable = Hyrise::get().storage_manager.get_table("table_nullable");
+  table_nullable->add_unique_constraint({ColumnID{1}}, IsPrimaryKey::No);
+
+  auto& transaction_manager = Hyrise::get().transaction_manager;
+  auto context = transaction_manager.new_transaction_context(AutoCommit::No);
+  insert(context, {{1, 1}, {2, 2}});
+  context->commit();
+
+  const auto scan_key = [&](const std::shared_ptr<TransactionContext>& scan_context, const int32_t key) {
+    auto get_table = std::make_shared<GetTable>("table_nullable");
+    get_table->execute();
+    auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(scan_context);
+    validate->execute();
+    const auto column = expression_functional::pqp_column_(ColumnID{1}, DataType::Int, true, "column1");
+    auto table_scan = std::make_shared<TableScan>(validate, expression_functional::equals_(column, key));
+    table_scan->execute();
+    return table_scan;
+  };
+
+  // An Update that keeps the key deletes the old row and re-inserts the key within the same transaction
+  context = transaction_manager.new_transaction_context(AutoCommit::No);
+  auto update = std::make_shared<Update>("table_nullable", scan_key(context, 1), make_values({{10, 1}}));
+  update->set_transaction_context(context);
+  update->execute();
+  EXPECT_FALSE(update->execute_failed());
+  context->commit();
+
+  // An Update to a key that already exists fails
+  context = transaction_manager.new_transaction_context(AutoCommit::No);
+  update = std::make_shared<Update>("table_nullable", scan_key(context, 1), make_values({{10, 2}}));
+  update->set_transaction_context(context);
+  update->execute();
+  EXPECT_TRUE(update->execute_failed());
+  context->rollback(RollbackReason::Conflict);
+
+  // After the deletion was committed, the key can be inserted again
+  context = transaction_manager.new_transaction_context(AutoCommit::No);
+  auto delete_op = std::make_shared<Delete>(scan_key(context, 2));
+  delete_op->set_transaction_context(context);
+  delete_op->execute();
+  context->commit();
+
+  context = transaction_manager.new_transaction_context(AutoCommit::No);
+  EXPECT_FALSE(insert(context, {{20, 2}})->execute_failed());
+  context->commit();
+
+  EXPECT_EQ(visible_row_count(), 2u);
+}
+
 }  // namespace opossum
@@ -0,0 +1,131 @@
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "base_test.hpp"
+
+#include "storage/chunk_encoder.hpp"
+#include "storage/front_coded_dictionary_segment.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageFrontCodedDictionarySegmentTest : public BaseTest {
+ protected:
+  std::shared_ptr<FrontCodedDictionarySegment<pmr_string>> encode(const std::shared_ptr<BaseSegment>& segment) {
+    const auto encoded_segment = ChunkEncoder::encode_segment(segment, DataType::String,
+                                                              SegmentEncodingSpec{EncodingType::FrontCodedDictionary});
+    return std::dynamic_pointer_cast<FrontCodedDictionarySegment<pmr_string>>(encoded_segment);
+  }
+
+  std::shared_ptr<ValueSegment<pmr_string>> vs_str = std::make_shared<ValueSegment<pmr_string>>();
+};
+
+TEST_F(StorageFrontCodedDictionarySegmentTest, CompressSegmentString) {
+  vs_str->append("Bill");
+  vs_str->append("Steve");
+  vs_str->append("Alexander");
+  vs_str->append("Steve");
+  vs_str->append("Hasso");
+  vs_str->append("Bill");
+
+  const auto dict_segment = encode(vs_str);
+  ASSERT_TRUE(dict_segment);
+
+  // Test attribute_vector size
+  EXPECT_EQ(dict_segment->size(), 6u);
+  EXPECT_EQ(dict_segment->attribute_vector()->size(), 6u);
+
+  // Test dictionary size (uniqueness)
+  EXPECT_EQ(dict_segment->unique_values_count(), 4u);
+
+  // Test sorting
+  const auto dict = dict_segment->front_coded_dictionary();
+  EXPECT_EQ(*(dict->begin()), "Alexander");
+  EXPECT_EQ(*(dict->begin() + 1), "Bill");
+  EXPECT_EQ(*(dict->begin() + 2), "Hasso");
+  EXPECT_EQ(*(dict->begin() + 3), "Steve");
+}
+
+TEST_F(StorageFrontCodedDictionarySegmentTest, Decode) {
+  vs_str->append("Bill");
+  vs_str->append("Steve");
+  vs_str->append("Bill");
+
+  const auto dict_segment = encode(vs_str);
+
+  EXPECT_EQ(dict_segment->encoding_type(), EncodingType::FrontCodedDictionary);
+  EXPECT_EQ(dict_segment->compressed_vector_type(), CompressedVectorType::FixedSize1ByteAligned);
+
+  // Decode values
+  EXPECT_EQ((*dict_segment)[0], AllTypeVariant("Bill"));
+  EXPECT_EQ((*dict_segment)[1], AllTypeVariant("Steve"));
+  EXPECT_EQ((*dict_segment)[2], AllTypeVariant("Bill"));
+  EXPECT_EQ(dict_segment->value_of_value_id(ValueID{1}), AllTypeVariant("Steve"));
+}
+
+TEST_F(StorageFrontCodedDictionarySegmentTest, LowerUpperBoundAcrossBlocks) {
+  // Create more values than fit into a single block of the front-coded dictionary
+  const auto value_count = FrontCodedStringVector::BLOCK_SIZE * 3 + 5;
+  for (auto index = size_t{0}; index < value_count; ++index) {
+    // Values are zero-padded so that their lexicographical order equals their numerical order
+    auto number = std::to_string(index * 2);
+    vs_str->append(pmr_string{"value_"} + pmr_string(4 - number.size(), '0') + pmr_string{number});
+  }
+
+  const auto dict_segment = encode(vs_str);
+  ASSERT_EQ(dict_segment->unique_values_count(), value_count);
+
+  EXPECT_EQ(dict_segment->lower_bound(AllTypeVariant{"value_0000"}), ValueID{0});
+  EXPECT_EQ(dict_segment->upper_bound(AllTypeVariant{"value_0000"}), ValueID{1});
+  EXPECT_EQ(dict_segment->lower_bound(AllTypeVariant{"a"}), ValueID{0});
+
+  // value_0034 is the 18th value (i.e., the second one in the second block), value_0035 does not exist
+  EXPECT_EQ(dict_segment->lower_bound(AllTypeVariant{"value_0034"}), ValueID{17});
+  EXPECT_EQ(dict_segment->upper_bound(AllTypeVariant{"value_0034"}), ValueID{18});
+  EXPECT_EQ(dict_segment->lower_bound(AllTypeVariant{"value_0035"}), ValueID{18});
+  EXPECT_EQ(dict_segment->upper_bound(AllTypeVariant{"value_0035"}), ValueID{18});
+
+  // value_0032 is the head of the second block
+  EXPECT_EQ(dict_segment->lower_bound(AllTypeVariant{"value_0032"}), ValueID{16});
+  EXPECT_EQ(dict_segment->lower_bound(AllTypeVariant{"value_0031"}), ValueID{16});
+
+  EXPECT_EQ(dict_segment->lower_bound(AllTypeVariant{"z"}), INVALID_VALUE_ID);
+  EXPECT_EQ(dict_segment->upper_bound(AllTypeVariant{"value_9999"}), INVALID_VALUE_ID);
+
+  for (auto value_id = ValueID{0}; value_id < value_count; ++value_id) {
+    EXPECT_EQ(dict_segment->value_of_value_id(value_id), (*vs_str)[ChunkOffset{value_id}]);
+  }
+}
+
+TEST_F(StorageFrontCodedDictionarySegmentTest, NullValues) {
+  const auto vs_str = std::make_shared<ValueSegment<pmr_string>>(true);
+
+  vs_str->append("A");
+  vs_str->append(NULL_VALUE);
+  vs_str->append("E");
+
+  const auto dict_segment = encode(vs_str);
+
+  EXPECT_EQ(dict_segment->null_value_id(), 2u);
+  EXPECT_TRUE(variant_is_null((*dict_segment)[1]));
+  EXPECT_FALSE(dict_segment->get_typed_value(ChunkOffset{1}));
+  EXPECT_EQ(dict_segment->get_typed_value(ChunkOffset{2}), pmr_string{"E"});
+}
+
+TEST_F(StorageFrontCodedDictionarySegmentTest, SmallerThanDictionarySegment) {
+  for (auto index = size_t{0}; index < 1000; ++index) {
+    vs_str->append(pmr_string{"http://www.example.com/products/category/item?id="} +
+                   pmr_string{std::to_string(index)});
+  }
+
+  const auto front_coded_segment = encode(vs_str);
+  const auto dictionary_segment =
+      ChunkEncoder::encode_segment(vs_str, DataType::String, SegmentEncodingSpec{EncodingType::Dictionary});
+
+  EXPECT_LT(front_coded_segment->memory_usage(MemoryUsageCalculationMode::Full),
+            dictionary_segment->memory_usage(MemoryUsageCalculationMode::Full) / 2);
+}
+
+}  // namespace opossum
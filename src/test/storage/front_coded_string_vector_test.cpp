@@ -0,0 +1,86 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "storage/front_coded_dictionary_segment/front_coded_string_vector.hpp"
+
+namespace opossum {
+
+class FrontCodedStringVectorTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Many strings sharing prefixes, a long string (whose length needs more than one byte to encode), and the empty
+    // string. The number of values is not a multiple of the block size so that the last block is incomplete.
+    values = {"", "a", "aa", "aab", "ab", "abc", "abcd", "b", "ba", "bab"};
+    values.emplace_back(300, 'c');
+    for (auto index = 0; index < 30; ++index) {
+      values.emplace_back(pmr_string{"d"} + pmr_string{std::to_string(index)});
+    }
+    std::sort(values.begin(), values.end());
+
+    vector = std::make_shared<FrontCodedStringVector>(values.cbegin(), values.cend());
+  }
+
+  std::vector<pmr_string> values;
+  std::shared_ptr<FrontCodedStringVector> vector;
+};
+
+TEST_F(FrontCodedStringVectorTest, GetStringAt) {
+  ASSERT_EQ(vector->size(), values.size());
+  EXPECT_EQ(vector->block_offsets().size(),
+            (values.size() + FrontCodedStringVector::BLOCK_SIZE - 1) / FrontCodedStringVector::BLOCK_SIZE);
+
+  for (auto index = size_t{0}; index < values.size(); ++index) {
+    EXPECT_EQ(vector->get_string_at(index), values[index]);
+  }
+}
+
+TEST_F(FrontCodedStringVectorTest, Iterators) {
+  EXPECT_EQ(static_cast<size_t>(std::distance(vector->cbegin(), vector->cend())), values.size());
+  EXPECT_TRUE(std::equal(vector->cbegin(), vector->cend(), values.cbegin(), values.cend()));
+
+  // Random access (including backwards) has to work as well
+  auto it = vector->cend();
+  for (auto index = values.size(); index > 0; --index) {
+    --it;
+    EXPECT_EQ(*it, values[index - 1]);
+  }
+  EXPECT_EQ(*(vector->cbegin() + 17), values[17]);
+}
+
+TEST_F(FrontCodedStringVectorTest, LowerUpperBound) {
+  for (const auto& search_value : {"", "a", "aaa", "ab", "abcde", "c", "cc", "d1", "d15", "d2x", "e"}) {
+    const auto expected_lower_bound = static_cast<size_t>(
+        std::lower_bound(values.cbegin(), values.cend(), pmr_string{search_value}) - values.cbegin());
+    const auto expected_upper_bound = static_cast<size_t>(
+        std::upper_bound(values.cbegin(), values.cend(), pmr_string{search_value}) - values.cbegin());
+
+    EXPECT_EQ(vector->lower_bound(search_value), expected_lower_bound);
+    EXPECT_EQ(vector->upper_bound(search_value), expected_upper_bound);
+  }
+}
+
+TEST_F(FrontCodedStringVectorTest, CopyAndReconstruct) {
+  const auto copy = FrontCodedStringVector{*vector};
+  EXPECT_TRUE(std::equal(copy.cbegin(), copy.cend(), values.cbegin(), values.cend()));
+
+  auto data = vector->data();
+  auto block_offsets = vector->block_offsets();
+  const auto reconstructed = FrontCodedStringVector{std::move(data), std::move(block_offsets), vector->size()};
+  EXPECT_TRUE(std::equal(reconstructed.cbegin(), reconstructed.cend(), values.cbegin(), values.cend()));
+}
+
+TEST_F(FrontCodedStringVectorTest, EmptyVector) {
+  const auto empty_values = std::vector<pmr_string>{};
+  const auto empty_vector = FrontCodedStringVector{empty_values.cbegin(), empty_values.cend()};
+
+  EXPECT_EQ(empty_vector.size(), 0u);
+  EXPECT_EQ(empty_vector.cbegin(), empty_vector.cend());
+  EXPECT_EQ(empty_vector.lower_bound("a"), 0u);
+  EXPECT_EQ(empty_vector.upper_bound("a"), 0u);
+}
+
+}  // namespace opossum
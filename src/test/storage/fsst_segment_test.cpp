@@ -0,0 +1,158 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "all_type_variant.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/fsst_segment.hpp"
+#include "storage/fsst_segment/fsst_encoder.hpp"
+#include "storage/fsst_segment/fsst_symbol_table.hpp"
+#include "storage/value_segment.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class StorageFSSTSegmentTest : public BaseTest {
+ protected:
+  std::shared_ptr<FSSTSegment<pmr_string>> compress(const std::shared_ptr<ValueSegment<pmr_string>>& segment,
+                                                    const VectorCompressionType vector_compression_type =
+                                                        VectorCompressionType::FixedSizeByteAligned) {
+    auto encoded_segment = ChunkEncoder::encode_segment(
+        segment, DataType::String, SegmentEncodingSpec{EncodingType::FSST, vector_compression_type});
+    return std::dynamic_pointer_cast<FSSTSegment<pmr_string>>(encoded_segment);
+  }
+
+  std::shared_ptr<ValueSegment<pmr_string>> vs_str = std::make_shared<ValueSegment<pmr_string>>(true);
+};
+
+TEST_F(StorageFSSTSegmentTest, SymbolTableRoundTrip) {
+  const auto samples = std::vector<std::string_view>{"http://www.hyrise.de", "http://www.hpi.de", "https://github.com"};
+  const auto symbol_table = FSSTSymbolTable::build(samples, PolymorphicAllocator<char>{});
+
+  EXPECT_GT(symbol_table.symbol_count(), 0u);
+  EXPECT_LE(symbol_table.symbol_count(), FSSTSymbolTable::MAX_SYMBOL_COUNT);
+
+  // Values not part of the sample (and bytes not covered by any symbol) have to survive the round trip, too
+  for (const auto value : {"http://www.hyrise.de", "", "http://www.hpi.uni-potsdam.de", "\xff\x01 escaped"}) {
+    auto codes = pmr_vector<uint8_t>{};
+    symbol_table.compress(value, codes);
+    EXPECT_EQ(symbol_table.decompress(codes.data(), codes.data() + codes.size()), value);
+  }
+
+  auto codes = pmr_vector<uint8_t>{};
+  symbol_table.compress("http://www.hyrise.de", codes);
+  EXPECT_LT(codes.size(), std::string{"http://www.hyrise.de"}.size());
+}
+
+TEST_F(StorageFSSTSegmentTest, SymbolTableStartsWith) {
+  const auto samples = std::vector<std::string_view>{"Dampfschifffahrtsgesellschaft", "Dampflokomotive"};
+  const auto symbol_table = FSSTSymbolTable::build(samples, PolymorphicAllocator<char>{});
+
+  auto codes = pmr_vector<uint8_t>{};
+  symbol_table.compress("Dampfschifffahrtsgesellschaft", codes);
+  const auto* begin = codes.data();
+  const auto* end = codes.data() + codes.size();
+
+  EXPECT_TRUE(symbol_table.starts_with(begin, end, ""));
+  EXPECT_TRUE(symbol_table.starts_with(begin, end, "D"));
+  EXPECT_TRUE(symbol_table.starts_with(begin, end, "Dampfsch"));
+  EXPECT_TRUE(symbol_table.starts_with(begin, end, "Dampfschifffahrtsgesellschaft"));
+  EXPECT_FALSE(symbol_table.starts_with(begin, end, "Dampfl"));
+  EXPECT_FALSE(symbol_table.starts_with(begin, end, "Dampfschifffahrtsgesellschaften"));
+  EXPECT_FALSE(symbol_table.starts_with(begin, end, "x"));
+}
+
+TEST_F(StorageFSSTSegmentTest, CompressEmptySegment) {
+  const auto fsst_segment = compress(vs_str);
+  ASSERT_TRUE(fsst_segment);
+
+  EXPECT_EQ(fsst_segment->size(), 0u);
+  EXPECT_FALSE(fsst_segment->null_values());
+  EXPECT_EQ(fsst_segment->encoding_type(), EncodingType::FSST);
+}
+
+TEST_F(StorageFSSTSegmentTest, CompressNullableStringSegment) {
+  vs_str->append("Alex");
+  vs_str->append("Peter");
+  vs_str->append("");
+  vs_str->append(NULL_VALUE);
+  vs_str->append("Anna");
+
+  const auto fsst_segment = compress(vs_str);
+  ASSERT_TRUE(fsst_segment);
+
+  EXPECT_EQ(fsst_segment->size(), 5u);
+  ASSERT_TRUE(fsst_segment->null_values());
+  EXPECT_EQ(*fsst_segment->null_values(), (pmr_vector<bool>{false, false, false, true, false}));
+
+  EXPECT_EQ((*fsst_segment)[ChunkOffset{0}], AllTypeVariant{"Alex"});
+  EXPECT_EQ((*fsst_segment)[ChunkOffset{1}], AllTypeVariant{"Peter"});
+  EXPECT_EQ((*fsst_segment)[ChunkOffset{2}], AllTypeVariant{""});
+  EXPECT_TRUE(variant_is_null((*fsst_segment)[ChunkOffset{3}]));
+  EXPECT_EQ(fsst_segment->get_typed_value(ChunkOffset{4}), pmr_string{"Anna"});
+  EXPECT_FALSE(fsst_segment->get_typed_value(ChunkOffset{3}));
+}
+
+TEST_F(StorageFSSTSegmentTest, CompressNotNullStringSegment) {
+  vs_str->append("Alex");
+  vs_str->append("Peter");
+
+  const auto fsst_segment = compress(vs_str);
+  EXPECT_FALSE(fsst_segment->null_values());
+}
+
+TEST_F(StorageFSSTSegmentTest, CompressionAndVectorCompressionTypes) {
+  const auto row_count = size_t{1000};
+  for (auto index = size_t{0}; index < row_count; ++index) {
+    vs_str->append(pmr_string{"http://www.example.com/index.php?page="} + pmr_string{std::to_string(index)});
+  }
+
+  for (const auto vector_compression_type :
+       {VectorCompressionType::FixedSizeByteAligned, VectorCompressionType::SimdBp128}) {
+    const auto fsst_segment = compress(vs_str, vector_compression_type);
+
+    ASSERT_EQ(fsst_segment->size(), row_count);
+    EXPECT_LT(fsst_segment->compressed_values().size(), vs_str->memory_usage(MemoryUsageCalculationMode::Full) / 2);
+
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+      EXPECT_EQ(fsst_segment->get_typed_value(chunk_offset), vs_str->get_typed_value(chunk_offset));
+    }
+  }
+}
+
+TEST_F(StorageFSSTSegmentTest, CompressValueMatchesStoredCodes) {
+  vs_str->append("Reeperbahn");
+  vs_str->append("Reeperbahnhof");
+  vs_str->append("Reeperbahn");
+
+  const auto fsst_segment = compress(vs_str);
+  const auto search_codes = fsst_segment->compress_value("Reeperbahn");
+
+  // The codes of equal values are equal, so that equality can be checked without decompression
+  const auto& compressed_values = fsst_segment->compressed_values();
+  ASSERT_GE(compressed_values.size(), 2 * search_codes.size());
+  EXPECT_TRUE(std::equal(search_codes.begin(), search_codes.end(), compressed_values.begin()));
+  EXPECT_TRUE(std::equal(search_codes.begin(), search_codes.end(), compressed_values.end() - search_codes.size()));
+}
+
+TEST_F(StorageFSSTSegmentTest, CopyUsingAllocator) {
+  vs_str->append("Alex");
+  vs_str->append(NULL_VALUE);
+  vs_str->append("Anna");
+
+  const auto fsst_segment = compress(vs_str);
+  const auto copied_segment = std::dynamic_pointer_cast<FSSTSegment<pmr_string>>(
+      fsst_segment->copy_using_allocator(PolymorphicAllocator<size_t>{}));
+  ASSERT_TRUE(copied_segment);
+
+  EXPECT_EQ(copied_segment->size(), 3u);
+  EXPECT_EQ((*copied_segment)[ChunkOffset{0}], AllTypeVariant{"Alex"});
+  EXPECT_TRUE(variant_is_null((*copied_segment)[ChunkOffset{1}]));
+  EXPECT_EQ((*copied_segment)[ChunkOffset{2}], AllTypeVariant{"Anna"});
+}
+
+}  // namespace opossum
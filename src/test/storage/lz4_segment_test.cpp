@@ -5,6 +5,8 @@
 #include "base_test.hpp"
 
 #include "all_type_variant.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
 #include "storage/chunk.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/lz4_segment.hpp"
@@ -343,4 +345,153 @@ TEST_F(StorageLZ4SegmentTest, CompressDictionaryIntSegment) {
   EXPECT_EQ(decompressed_data[20124], 40248);
 }
 
+TEST_F(StorageLZ4SegmentTest, BlockStatisticsIntSegment) {
+  const auto values_per_block = LZ4Encoder::_block_size / sizeof(int32_t);
+  for (auto index = size_t{0u}; index < row_count; ++index) {
+    if (index % values_per_block == 7) {
+      vs_int->append(NULL_VALUE);
+    } else {
+      vs_int->append(static_cast<int32_t>(index));
+    }
+  }
+
+  auto lz4_segment = compress(vs_int, DataType::Int);
+  ASSERT_TRUE(lz4_segment->block_statistics());
+
+  const auto& block_statistics = *lz4_segment->block_statistics();
+  const auto block_count = lz4_segment->lz4_blocks().size();
+  ASSERT_EQ(block_statistics.first_chunk_offsets.size(), block_count);
+  ASSERT_EQ(block_statistics.minima.size(), block_count);
+
+  for (auto block_index = size_t{0u}; block_index < block_count; ++block_index) {
+    const auto first_chunk_offset = block_index * values_per_block;
+    EXPECT_EQ(block_statistics.first_chunk_offsets[block_index], first_chunk_offset);
+    EXPECT_EQ(block_statistics.null_value_counts[block_index], 1u);
+    EXPECT_EQ(block_statistics.minima[block_index], static_cast<int32_t>(first_chunk_offset));
+    EXPECT_EQ(block_statistics.maxima[block_index],
+              static_cast<int32_t>(std::min(first_chunk_offset + values_per_block, row_count) - 1));
+  }
+
+  const auto block_values = lz4_segment->decompress_block_values(1u);
+  ASSERT_EQ(block_values.size(), values_per_block);
+  EXPECT_EQ(block_values[0], static_cast<int32_t>(values_per_block));
+  EXPECT_EQ(block_values[100], static_cast<int32_t>(values_per_block + 100));
+
+  // The statistics are kept when copying the segment
+  const auto copied_segment =
+      std::dynamic_pointer_cast<LZ4Segment<int32_t>>(lz4_segment->copy_using_allocator(PolymorphicAllocator<size_t>{}));
+  ASSERT_TRUE(copied_segment->block_statistics());
+  EXPECT_EQ(copied_segment->block_statistics()->maxima, block_statistics.maxima);
+}
+
+TEST_F(StorageLZ4SegmentTest, BlockStatisticsStringSegment) {
+  const auto block_size = LZ4Encoder::_block_size;
+  const auto size_diff = size_t{30u};
+
+  // Starts in the first block.
+  const auto string1 = pmr_string(block_size - size_diff, 'b');
+  vs_str->append(string1);
+  // Starts in the first block, completely fills the second block and reaches the third block.
+  const auto string2 = pmr_string(block_size + (2 * size_diff), 'c');
+  vs_str->append(string2);
+  vs_str->append(NULL_VALUE);
+  // Starts in the third block.
+  const auto string3 = pmr_string(size_diff, 'a');
+  vs_str->append(string3);
+
+  auto lz4_segment = compress(vs_str, DataType::String);
+  ASSERT_EQ(lz4_segment->lz4_blocks().size(), 3u);
+  ASSERT_TRUE(lz4_segment->block_statistics());
+
+  // No string starts in the second block, so it does not have any rows.
+  const auto& block_statistics = *lz4_segment->block_statistics();
+  EXPECT_EQ(block_statistics.first_chunk_offsets, (pmr_vector<ChunkOffset>{0u, 2u, 2u}));
+  EXPECT_EQ(block_statistics.null_value_counts, (pmr_vector<ChunkOffset>{0u, 0u, 1u}));
+  EXPECT_EQ(block_statistics.minima[0], string1);
+  EXPECT_EQ(block_statistics.maxima[0], string2);
+  EXPECT_EQ(block_statistics.minima[2], string3);
+  EXPECT_EQ(block_statistics.maxima[2], string3);
+
+  EXPECT_EQ(lz4_segment->decompress_block_values(0u), (std::vector<pmr_string>{string1, string2}));
+  EXPECT_TRUE(lz4_segment->decompress_block_values(1u).empty());
+  EXPECT_EQ(lz4_segment->decompress_block_values(2u), (std::vector<pmr_string>{"", string3}));
+}
+
+TEST_F(StorageLZ4SegmentTest, PointAccessWithBlockCache) {
+  for (auto index = size_t{0u}; index < row_count; ++index) {
+    vs_int->append(static_cast<int32_t>(index));
+  }
+  const auto lz4_segment = compress(vs_int, DataType::Int);
+
+  // A second segment with different values, so that wrongly shared cache entries would be detected
+  auto other_value_segment = std::make_shared<ValueSegment<int32_t>>(false);
+  for (auto index = size_t{0u}; index < row_count; ++index) {
+    other_value_segment->append(static_cast<int32_t>(index) * -1);
+  }
+  const auto other_lz4_segment = compress(other_value_segment, DataType::Int);
+
+  for (const auto chunk_offset : {ChunkOffset{5u}, ChunkOffset{6u}, ChunkOffset{17000u}, ChunkOffset{5u},
+                                  ChunkOffset{4500u}, ChunkOffset{9000u}, ChunkOffset{13000u}, ChunkOffset{7u}}) {
+    EXPECT_EQ(lz4_segment->get_typed_value(chunk_offset), static_cast<int32_t>(chunk_offset));
+    EXPECT_EQ(other_lz4_segment->get_typed_value(chunk_offset), -static_cast<int32_t>(chunk_offset));
+  }
+}
+
+TEST_F(StorageLZ4SegmentTest, TableScanSkipsBlocks) {
+  auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, true}};
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{100'000});
+
+  // The values are clustered, so that the blocks cover disjoint value ranges
+  const auto table_row_count = 20'000;
+  for (auto index = 0; index < table_row_count; ++index) {
+    if (index % 7 == 0) {
+      table->append({NULL_VALUE});
+    } else {
+      table->append({index / 100});
+    }
+  }
+  table->last_chunk()->finalize();
+  ChunkEncoder::encode_all_chunks(table, EncodingType::LZ4);
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto expected_row_count = [&](const auto& predicate) {
+    auto count = size_t{0};
+    for (auto index = 0; index < table_row_count; ++index) {
+      if (index % 7 != 0 && predicate(index / 100)) ++count;
+    }
+    return count;
+  };
+
+  const auto scan_row_count = [&](const PredicateCondition predicate_condition, const int32_t value,
+                                  const std::optional<int32_t> value2 = std::nullopt) {
+    auto scan = value2 ? create_between_table_scan(table_wrapper, ColumnID{0}, value, *value2, predicate_condition)
+                       : create_table_scan(table_wrapper, ColumnID{0}, predicate_condition, value);
+    scan->execute();
+    return scan->get_output()->row_count();
+  };
+
+  EXPECT_EQ(scan_row_count(PredicateCondition::Equals, 50), expected_row_count([](auto v) { return v == 50; }));
+  EXPECT_EQ(scan_row_count(PredicateCondition::NotEquals, 50), expected_row_count([](auto v) { return v != 50; }));
+  EXPECT_EQ(scan_row_count(PredicateCondition::LessThan, 81), expected_row_count([](auto v) { return v < 81; }));
+  EXPECT_EQ(scan_row_count(PredicateCondition::LessThanEquals, 81),
+            expected_row_count([](auto v) { return v <= 81; }));
+  EXPECT_EQ(scan_row_count(PredicateCondition::GreaterThan, 163), expected_row_count([](auto v) { return v > 163; }));
+  EXPECT_EQ(scan_row_count(PredicateCondition::GreaterThanEquals, 163),
+            expected_row_count([](auto v) { return v >= 163; }));
+  EXPECT_EQ(scan_row_count(PredicateCondition::Equals, 500), 0u);
+  EXPECT_EQ(scan_row_count(PredicateCondition::BetweenInclusive, 40, 90),
+            expected_row_count([](auto v) { return v >= 40 && v <= 90; }));
+  EXPECT_EQ(scan_row_count(PredicateCondition::BetweenExclusive, 40, 90),
+            expected_row_count([](auto v) { return v > 40 && v < 90; }));
+
+  // Only the block containing the value 50 has to be decompressed for the equality scan
+  const auto& segment = *table->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+  segment.access_counter[SegmentAccessCounter::AccessType::Sequential] = 0;
+  scan_row_count(PredicateCondition::Equals, 50);
+  EXPECT_EQ(segment.access_counter[SegmentAccessCounter::AccessType::Sequential],
+            LZ4Encoder::_block_size / sizeof(int32_t));
+}
+
 }  // namespace opossum
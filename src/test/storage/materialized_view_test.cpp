@@ -0,0 +1,196 @@
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+
+#include "hyrise.hpp"
+#include "optimizer/optimizer.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/materialized_view.hpp"
+#include "utils/check_table_equal.hpp"
+
+namespace opossum {
+
+class MaterializedViewTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    Hyrise::get().storage_manager.add_table("table_a", load_table("resources/test_data/tbl/int_int.tbl", 2));
+    Hyrise::get().storage_manager.add_table("table_b", load_table("resources/test_data/tbl/int_int2.tbl", 2));
+  }
+
+  std::shared_ptr<MaterializedView> add_view(const std::string& query) {
+    const auto lqp = SQLPipelineBuilder{query}.create_pipeline().get_unoptimized_logical_plans().at(0);
+    Hyrise::get().storage_manager.add_materialized_view(
+        "mv", std::make_shared<LQPView>(lqp, std::unordered_map<ColumnID, std::string>{}));
+    return Hyrise::get().storage_manager.get_materialized_view("mv");
+  }
+
+  static void execute(const std::string& query,
+                      const std::shared_ptr<TransactionContext>& transaction_context = nullptr) {
+    auto builder = SQLPipelineBuilder{query};
+    if (transaction_context) builder.with_transaction_context(transaction_context);
+    const auto [status, _] = builder.create_pipeline().get_result_table();
+    EXPECT_EQ(status, SQLPipelineStatus::Success);
+  }
+
+  // Compares the visible contents of the view with the result of @param query. The query is not optimized, so that it
+  // does not read the view.
+  static void expect_view_matches(const std::string& query) {
+    const auto [view_status, view_table] = SQLPipelineBuilder{"SELECT * FROM mv"}.create_pipeline().get_result_table();
+    const auto [status, expected_table] =
+        SQLPipelineBuilder{query}.with_optimizer(std::make_shared<Optimizer>()).create_pipeline().get_result_table();
+    ASSERT_EQ(view_status, SQLPipelineStatus::Success);
+    ASSERT_EQ(status, SQLPipelineStatus::Success);
+
+    if (const auto difference = check_table_equal(view_table, expected_table, OrderSensitivity::No,
+                                                  TypeCmpMode::Strict, FloatComparisonMode::AbsoluteDifference,
+                                                  IgnoreNullable::Yes)) {
+      FAIL() << *difference;
+    }
+  }
+};
+
+TEST_F(MaterializedViewTest, AddAndDrop) {
+  const auto query = "SELECT a FROM table_a WHERE b > 1";
+  const auto view = add_view(query);
+
+  auto& storage_manager = Hyrise::get().storage_manager;
+  EXPECT_TRUE(storage_manager.has_materialized_view("mv"));
+  EXPECT_EQ(storage_manager.materialized_view_names(), std::vector<std::string>{"mv"});
+  EXPECT_EQ(storage_manager.get_table("mv"), view->table());
+  EXPECT_TRUE(view->is_up_to_date(Hyrise::get().transaction_manager.last_commit_id()));
+  expect_view_matches(query);
+
+  EXPECT_THROW(storage_manager.add_materialized_view("table_a", view->view->deep_copy()), std::logic_error);
+  EXPECT_THROW(storage_manager.drop_table("mv"), std::logic_error);
+
+  execute("DROP VIEW mv");
+  EXPECT_FALSE(storage_manager.has_materialized_view("mv"));
+  EXPECT_FALSE(storage_manager.has_table("mv"));
+}
+
+TEST_F(MaterializedViewTest, SelectProjectJoin) {
+  const auto query =
+      "SELECT table_a.a, table_b.b FROM table_a JOIN table_b ON table_a.a = table_b.a WHERE table_b.b > 0";
+  const auto view = add_view(query);
+  EXPECT_TRUE(view->is_incrementally_maintainable());
+
+  execute("INSERT INTO table_a VALUES (7, 1)");
+  expect_view_matches(query);
+
+  execute("INSERT INTO table_a VALUES (2, 2)");
+  execute("INSERT INTO table_a VALUES (2, 3)");
+  expect_view_matches(query);
+
+  execute("INSERT INTO table_b VALUES (123, 4)");
+  expect_view_matches(query);
+
+  execute("DELETE FROM table_b WHERE a = 2 AND b = 5");
+  execute("UPDATE table_a SET a = 6 WHERE a = 7");
+  expect_view_matches(query);
+
+  // Modifications of both tables in the same transaction
+  auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  execute("INSERT INTO table_a VALUES (6, 5)", transaction_context);
+  execute("INSERT INTO table_b VALUES (6, 7)", transaction_context);
+  execute("DELETE FROM table_a WHERE a = 123", transaction_context);
+  transaction_context->commit();
+  expect_view_matches(query);
+  EXPECT_TRUE(view->is_up_to_date(Hyrise::get().transaction_manager.last_commit_id()));
+
+  // Rolled back modifications are not visible
+  transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  execute("INSERT INTO table_b VALUES (6, 8)", transaction_context);
+  transaction_context->rollback(RollbackReason::User);
+  expect_view_matches(query);
+}
+
+TEST_F(MaterializedViewTest, OlderSnapshots) {
+  const auto view = add_view("SELECT a FROM table_a WHERE b > 1");
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  EXPECT_TRUE(view->is_up_to_date(transaction_context->snapshot_commit_id()));
+
+  // The view reflects the insert, which the older transaction does not see
+  execute("INSERT INTO table_a VALUES (7, 2)");
+  EXPECT_FALSE(view->is_up_to_date(transaction_context->snapshot_commit_id()));
+  EXPECT_TRUE(view->is_up_to_date(Hyrise::get().transaction_manager.last_commit_id()));
+
+  transaction_context->commit();
+}
+
+TEST_F(MaterializedViewTest, SelfJoin) {
+  const auto query = "SELECT t1.a, t2.b FROM table_b AS t1, table_b AS t2 WHERE t1.a = t2.a";
+  const auto view = add_view(query);
+  EXPECT_TRUE(view->is_incrementally_maintainable());
+
+  execute("INSERT INTO table_b VALUES (2, 1)");
+  expect_view_matches(query);
+
+  execute("DELETE FROM table_b WHERE b = 5");
+  expect_view_matches(query);
+}
+
+TEST_F(MaterializedViewTest, Aggregates) {
+  const auto query = "SELECT a, SUM(b), COUNT(*), COUNT(b), AVG(b) FROM table_b GROUP BY a";
+  const auto view = add_view(query);
+  EXPECT_TRUE(view->is_incrementally_maintainable());
+
+  execute("INSERT INTO table_b VALUES (7, 3)");
+  execute("INSERT INTO table_b VALUES (8, 3)");
+  expect_view_matches(query);
+
+  // Removes the group of a = 2
+  execute("DELETE FROM table_b WHERE a = 2");
+  expect_view_matches(query);
+
+  execute("UPDATE table_b SET b = 10 WHERE a = 7");
+  expect_view_matches(query);
+}
+
+TEST_F(MaterializedViewTest, AggregatesWithoutGroupBy) {
+  const auto query = "SELECT COUNT(*), SUM(b) FROM table_b WHERE a > 5";
+  const auto view = add_view(query);
+  EXPECT_TRUE(view->is_incrementally_maintainable());
+
+  execute("INSERT INTO table_b VALUES (8, 3)");
+  expect_view_matches(query);
+
+  // The view still has a row without any input rows
+  execute("DELETE FROM table_b WHERE a > 5");
+  expect_view_matches(query);
+}
+
+TEST_F(MaterializedViewTest, MinMax) {
+  const auto query = "SELECT a, MIN(b), MAX(b) FROM table_b GROUP BY a";
+  const auto view = add_view(query);
+  EXPECT_TRUE(view->is_incrementally_maintainable());
+
+  execute("INSERT INTO table_b VALUES (7, 3)");
+  expect_view_matches(query);
+
+  // MIN and MAX are recomputed on deletions
+  execute("DELETE FROM table_b WHERE b = 0");
+  expect_view_matches(query);
+}
+
+TEST_F(MaterializedViewTest, Recomputation) {
+  const auto query = "SELECT a FROM table_b WHERE a IN (SELECT a FROM table_a) ORDER BY a LIMIT 2";
+  const auto view = add_view(query);
+  EXPECT_FALSE(view->is_incrementally_maintainable());
+
+  execute("INSERT INTO table_a VALUES (2, 1)");
+  expect_view_matches(query);
+
+  execute("INSERT INTO table_b VALUES (1, 1)");
+  expect_view_matches(query);
+
+  // Replacing a base table recomputes the view
+  auto& storage_manager = Hyrise::get().storage_manager;
+  storage_manager.drop_table("table_a");
+  storage_manager.add_table("table_a", load_table("resources/test_data/tbl/int_int2.tbl", 2));
+  EXPECT_FALSE(view->is_up_to_date(Hyrise::get().transaction_manager.last_commit_id()));
+  view->maintain();
+  expect_view_matches(query);
+}
+
+}  // namespace opossum
@@ -0,0 +1,119 @@
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "concurrency/transaction_context.hpp"
+#include "hyrise.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/value_segment.hpp"
+#include "storage/index/table_hash/table_hash_index.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class TableHashIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    const auto column_definitions = TableColumnDefinitions{
+        {"a", DataType::Int, false}, {"b", DataType::String, true}, {"c", DataType::Long, false}};
+    table = std::make_shared<Table>(column_definitions, TableType::Data, 3, UseMvcc::Yes);
+
+    table->append({1, "one", int64_t{10}});
+    table->append({2, "two", int64_t{20}});
+    table->append({1, NULL_VALUE, int64_t{30}});
+    table->append({3, "three", int64_t{40}});
+  }
+
+  static std::vector<RowID> sorted_lookup(const TableHashIndex& index, const std::vector<AllTypeVariant>& values) {
+    auto row_ids = index.lookup(values);
+    std::sort(row_ids.begin(), row_ids.end());
+    return row_ids;
+  }
+
+  std::shared_ptr<Table> table;
+};
+
+TEST_F(TableHashIndexTest, BuildOverExistingChunks) {
+  ChunkEncoder::encode_chunks(table, {ChunkID{0}}, EncodingType::Dictionary);
+
+  const auto index = table->create_table_hash_index({ColumnID{0}}, "a_index");
+  EXPECT_EQ(index->name(), "a_index");
+  EXPECT_EQ(index->column_ids(), std::vector<ColumnID>{ColumnID{0}});
+  EXPECT_EQ(index->size(), 4u);
+  EXPECT_EQ(table->get_table_hash_index({ColumnID{0}}), index);
+  EXPECT_EQ(table->get_table_hash_index({ColumnID{1}}), nullptr);
+
+  EXPECT_EQ(sorted_lookup(*index, {1}), (std::vector<RowID>{RowID{ChunkID{0}, 0}, RowID{ChunkID{0}, 2}}));
+  EXPECT_EQ(sorted_lookup(*index, {3}), (std::vector<RowID>{RowID{ChunkID{1}, 0}}));
+  EXPECT_TRUE(index->lookup({4}).empty());
+}
+
+TEST_F(TableHashIndexTest, NullValuesAreNotIndexed) {
+  const auto index = table->create_table_hash_index({ColumnID{1}});
+  EXPECT_EQ(index->size(), 3u);
+
+  EXPECT_EQ(sorted_lookup(*index, {"two"}), (std::vector<RowID>{RowID{ChunkID{0}, 1}}));
+  EXPECT_TRUE(index->lookup({NULL_VALUE}).empty());
+}
+
+TEST_F(TableHashIndexTest, MultiColumnKeyAndCasts) {
+  const auto index = table->create_table_hash_index({ColumnID{2}, ColumnID{0}});
+
+  // The values are cast to the column types, if this is possible without loss
+  EXPECT_EQ(sorted_lookup(*index, {int64_t{30}, 1}), (std::vector<RowID>{RowID{ChunkID{0}, 2}}));
+  EXPECT_EQ(sorted_lookup(*index, {30, int64_t{1}}), (std::vector<RowID>{RowID{ChunkID{0}, 2}}));
+  EXPECT_EQ(sorted_lookup(*index, {30.0, 1.0f}), (std::vector<RowID>{RowID{ChunkID{0}, 2}}));
+  EXPECT_TRUE(index->lookup({30.5, 1}).empty());
+  EXPECT_TRUE(index->lookup({30, 2}).empty());
+  EXPECT_THROW(index->lookup({30}), std::logic_error);
+}
+
+TEST_F(TableHashIndexTest, MaintainedByAppendAndRemoveChunk) {
+  const auto index = table->create_table_hash_index({ColumnID{0}});
+
+  table->append({1, "four", int64_t{50}});
+  EXPECT_EQ(sorted_lookup(*index, {1}),
+            (std::vector<RowID>{RowID{ChunkID{0}, 0}, RowID{ChunkID{0}, 2}, RowID{ChunkID{1}, 1}}));
+
+  // Chunks appended as a whole are indexed, too
+  auto segments = Segments{};
+  segments.emplace_back(std::make_shared<ValueSegment<int32_t>>(pmr_vector<int32_t>{1, 7}));
+  segments.emplace_back(std::make_shared<ValueSegment<pmr_string>>(pmr_vector<pmr_string>{"x", "y"}));
+  segments.emplace_back(std::make_shared<ValueSegment<int64_t>>(pmr_vector<int64_t>{60, 70}));
+  table->append_chunk(segments, std::make_shared<MvccData>(2, CommitID{0}));
+  EXPECT_EQ(sorted_lookup(*index, {7}), (std::vector<RowID>{RowID{ChunkID{2}, 1}}));
+
+  // Physically removing a chunk removes its rows from the index
+  const auto chunk = table->get_chunk(ChunkID{0});
+  chunk->increase_invalid_row_count(chunk->size());
+  table->remove_chunk(ChunkID{0});
+  EXPECT_EQ(sorted_lookup(*index, {1}), (std::vector<RowID>{RowID{ChunkID{1}, 1}, RowID{ChunkID{2}, 0}}));
+  EXPECT_EQ(index->size(), 4u);
+}
+
+TEST_F(TableHashIndexTest, MaintainedByInsert) {
+  Hyrise::get().storage_manager.add_table("hash_index_table", table);
+  const auto index = table->create_table_hash_index({ColumnID{0}, ColumnID{1}});
+
+  const auto values = std::make_shared<Table>(table->column_definitions(), TableType::Data);
+  values->append({5, "five", int64_t{50}});
+  values->append({1, "one", int64_t{60}});
+  const auto table_wrapper = std::make_shared<TableWrapper>(values);
+  table_wrapper->execute();
+
+  const auto insert = std::make_shared<Insert>("hash_index_table", table_wrapper);
+  const auto context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  insert->set_transaction_context(context);
+  insert->execute();
+  context->commit();
+
+  EXPECT_EQ(sorted_lookup(*index, {5, "five"}), (std::vector<RowID>{RowID{ChunkID{1}, 1}}));
+  EXPECT_EQ(sorted_lookup(*index, {1, "one"}), (std::vector<RowID>{RowID{ChunkID{0}, 0}, RowID{ChunkID{1}, 2}}));
+}
+
+}  // namespace opossum
@@ -0,0 +1,114 @@
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "storage/chunk_encoder.hpp"
+#include "storage/create_iterable_from_segment.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_accessor.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "storage/versioned_segment.hpp"
+
+namespace opossum {
+
+class VersionedSegmentTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto value_segment = std::make_shared<ValueSegment<int32_t>>(true);
+    for (const auto value : {4, 6, 3, 9}) {
+      value_segment->append(value);
+    }
+    value_segment->append(NULL_VALUE);
+
+    _main_segment =
+        ChunkEncoder::encode_segment(value_segment, DataType::Int, SegmentEncodingSpec{EncodingType::Dictionary});
+
+    // Patches row 1 with 7, row 3 with NULL, and row 4 (NULL in the main segment) with 5
+    _versioned_segment = std::make_shared<VersionedSegment<int32_t>>(
+        _main_segment, pmr_vector<ChunkOffset>{ChunkOffset{1}, ChunkOffset{3}, ChunkOffset{4}},
+        pmr_vector<int32_t>{7, 0, 5}, pmr_vector<bool>{false, true, false});
+  }
+
+  std::shared_ptr<BaseSegment> _main_segment;
+  std::shared_ptr<VersionedSegment<int32_t>> _versioned_segment;
+
+  const std::vector<std::optional<int32_t>> _expected_values{4, 7, 3, std::nullopt, 5};
+};
+
+TEST_F(VersionedSegmentTest, AccessValues) {
+  EXPECT_EQ(_versioned_segment->size(), 5);
+  EXPECT_EQ((*_versioned_segment)[ChunkOffset{0}], AllTypeVariant{4});
+  EXPECT_EQ((*_versioned_segment)[ChunkOffset{1}], AllTypeVariant{7});
+  EXPECT_TRUE(variant_is_null((*_versioned_segment)[ChunkOffset{3}]));
+  EXPECT_EQ((*_versioned_segment)[ChunkOffset{4}], AllTypeVariant{5});
+
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < _expected_values.size(); ++chunk_offset) {
+    EXPECT_EQ(_versioned_segment->get_typed_value(chunk_offset), _expected_values[chunk_offset]);
+  }
+}
+
+TEST_F(VersionedSegmentTest, SequentialIteration) {
+  auto values = std::vector<std::optional<int32_t>>{};
+  segment_iterate<int32_t>(*_versioned_segment, [&](const auto& position) {
+    EXPECT_EQ(position.chunk_offset(), values.size());
+    values.emplace_back(position.is_null() ? std::nullopt : std::optional<int32_t>{position.value()});
+  });
+  EXPECT_EQ(values, _expected_values);
+}
+
+TEST_F(VersionedSegmentTest, PointAccessIteration) {
+  const auto position_filter = std::make_shared<RowIDPosList>(
+      RowIDPosList{RowID{ChunkID{0}, ChunkOffset{4}}, RowID{ChunkID{0}, ChunkOffset{0}},
+                   RowID{ChunkID{0}, ChunkOffset{1}}, RowID{ChunkID{0}, ChunkOffset{3}}});
+  position_filter->guarantee_single_chunk();
+
+  auto values = std::vector<std::optional<int32_t>>{};
+  const auto iterable = create_iterable_from_segment<int32_t>(*_versioned_segment);
+  iterable.for_each(position_filter, [&](const auto& position) {
+    EXPECT_EQ(position.chunk_offset(), values.size());
+    values.emplace_back(position.is_null() ? std::nullopt : std::optional<int32_t>{position.value()});
+  });
+  EXPECT_EQ(values, (std::vector<std::optional<int32_t>>{5, 4, 7, std::nullopt}));
+}
+
+TEST_F(VersionedSegmentTest, Accessors) {
+  const auto accessor = create_segment_accessor<int32_t>(_versioned_segment);
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < _expected_values.size(); ++chunk_offset) {
+    EXPECT_EQ(accessor->access(chunk_offset), _expected_values[chunk_offset]);
+  }
+
+  // ReferenceSegments that point to a VersionedSegment
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true}}, TableType::Data);
+  table->append_chunk({_versioned_segment});
+  const auto pos_list = std::make_shared<RowIDPosList>(
+      RowIDPosList{RowID{ChunkID{0}, ChunkOffset{3}}, RowID{ChunkID{0}, ChunkOffset{1}}});
+  pos_list->guarantee_single_chunk();
+  const auto reference_segment = std::make_shared<ReferenceSegment>(table, ColumnID{0}, pos_list);
+
+  const auto reference_segment_accessor = create_segment_accessor<int32_t>(reference_segment);
+  EXPECT_EQ(reference_segment_accessor->access(ChunkOffset{0}), std::nullopt);
+  EXPECT_EQ(reference_segment_accessor->access(ChunkOffset{1}), 7);
+
+  auto values = std::vector<std::optional<int32_t>>{};
+  segment_iterate<int32_t>(*reference_segment, [&](const auto& position) {
+    values.emplace_back(position.is_null() ? std::nullopt : std::optional<int32_t>{position.value()});
+  });
+  EXPECT_EQ(values, (std::vector<std::optional<int32_t>>{std::nullopt, 7}));
+}
+
+TEST_F(VersionedSegmentTest, InvalidMainSegment) {
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true}}, TableType::Data);
+  table->append_chunk({_main_segment});
+  const auto reference_segment =
+      std::make_shared<ReferenceSegment>(table, ColumnID{0}, std::make_shared<RowIDPosList>());
+
+  EXPECT_THROW(VersionedSegment<int32_t>(reference_segment, {}, {}, {}), std::logic_error);
+  EXPECT_THROW(VersionedSegment<int32_t>(_versioned_segment, {}, {}, {}), std::logic_error);
+}
+
+}  // namespace opossum
@@ -0,0 +1,136 @@
+#include "../base_test.hpp"
+
+#include "hyrise.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/job_task.hpp"
+#include "utils/hardware_counters.hpp"
+
+namespace opossum {
+
+class HardwareCountersTest : public BaseTest {
+ public:
+  void TearDown() override { HardwareCounters::set_enabled(false); }
+
+  // Does some work that retires instructions
+  static void spin() {
+    auto sum = uint64_t{0};
+    for (auto index = uint64_t{0}; index < 100'000; ++index) {
+      sum += index * index;
+      // Prevent the loop from being optimized away
+      asm volatile("" : "+r"(sum));
+    }
+  }
+};
+
+TEST_F(HardwareCountersTest, Arithmetic) {
+  auto counters = HardwareCounters{10, 20, 3, 4};
+  counters += HardwareCounters{1, 2, 3, 4};
+  EXPECT_EQ(counters, (HardwareCounters{11, 22, 6, 8}));
+  EXPECT_DOUBLE_EQ(counters.instructions_per_cycle(), 2.0);
+  EXPECT_DOUBLE_EQ(HardwareCounters{}.instructions_per_cycle(), 0.0);
+
+  // Subtraction saturates at zero
+  EXPECT_EQ(counters - (HardwareCounters{1, 30, 6, 0}), (HardwareCounters{10, 0, 0, 8}));
+}
+
+TEST_F(HardwareCountersTest, Output) {
+  auto stream = std::stringstream{};
+  stream << HardwareCounters{200, 300, 4, 5};
+  EXPECT_EQ(stream.str(), "200 cycles, 300 instructions (1.50 IPC), 4 LLC misses, 5 branch misses");
+}
+
+TEST_F(HardwareCountersTest, Accumulator) {
+  auto accumulator = HardwareCounterAccumulator{};
+  EXPECT_FALSE(accumulator.counters());
+
+  accumulator.add(HardwareCounters{1, 2, 3, 4});
+  accumulator.add(HardwareCounters{1, 2, 3, 4});
+  EXPECT_EQ(accumulator.counters(), (HardwareCounters{2, 4, 6, 8}));
+}
+
+TEST_F(HardwareCountersTest, DisabledByDefault) {
+  EXPECT_FALSE(HardwareCounters::is_enabled());
+
+  const auto accumulator = std::make_shared<HardwareCounterAccumulator>();
+  {
+    const auto scope = HardwareCounterScope{accumulator};
+    EXPECT_EQ(HardwareCounterScope::current_accumulator(), nullptr);
+    spin();
+  }
+  EXPECT_FALSE(accumulator->counters());
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int_float.tbl"));
+  table_wrapper->execute();
+  EXPECT_FALSE(table_wrapper->performance_data().hardware_counters);
+}
+
+TEST_F(HardwareCountersTest, NestedScopes) {
+  HardwareCounters::set_enabled(true);
+  // Hardware counters might not be accessible, e.g., in containers or VMs
+  if (!HardwareCounters::read()) GTEST_SKIP();
+
+  const auto outer_accumulator = std::make_shared<HardwareCounterAccumulator>();
+  const auto inner_accumulator = std::make_shared<HardwareCounterAccumulator>();
+  {
+    const auto outer_scope = HardwareCounterScope{outer_accumulator};
+    EXPECT_EQ(HardwareCounterScope::current_accumulator(), outer_accumulator);
+
+    {
+      const auto inner_scope = HardwareCounterScope{inner_accumulator};
+      EXPECT_EQ(HardwareCounterScope::current_accumulator(), inner_accumulator);
+      for (auto iteration = 0; iteration < 10; ++iteration) {
+        spin();
+      }
+    }
+
+    EXPECT_EQ(HardwareCounterScope::current_accumulator(), outer_accumulator);
+    spin();
+  }
+  EXPECT_EQ(HardwareCounterScope::current_accumulator(), nullptr);
+
+  // The work of the inner scope is not attributed to the outer scope
+  ASSERT_TRUE(outer_accumulator->counters());
+  ASSERT_TRUE(inner_accumulator->counters());
+  EXPECT_GT(inner_accumulator->counters()->instructions, 1'000'000u);
+  EXPECT_LT(outer_accumulator->counters()->instructions, inner_accumulator->counters()->instructions);
+}
+
+TEST_F(HardwareCountersTest, JobTasksAreAttributedToTheirCreator) {
+  HardwareCounters::set_enabled(true);
+  if (!HardwareCounters::read()) GTEST_SKIP();
+
+  const auto accumulator = std::make_shared<HardwareCounterAccumulator>();
+  auto job_task = std::shared_ptr<JobTask>{};
+  {
+    const auto scope = HardwareCounterScope{accumulator};
+    job_task = std::make_shared<JobTask>([]() {
+      for (auto iteration = 0; iteration < 10; ++iteration) {
+        spin();
+      }
+    });
+  }
+
+  const auto counters_before_job = accumulator->counters();
+  ASSERT_TRUE(counters_before_job);
+
+  // The job is executed outside of the scope, but still attributed to the accumulator
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{job_task});
+  EXPECT_GT(accumulator->counters()->instructions, counters_before_job->instructions + 1'000'000u);
+}
+
+TEST_F(HardwareCountersTest, OperatorPerformanceData) {
+  HardwareCounters::set_enabled(true);
+  if (!HardwareCounters::read()) GTEST_SKIP();
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int_float.tbl"));
+  table_wrapper->execute();
+  const auto& performance_data = table_wrapper->performance_data();
+  ASSERT_TRUE(performance_data.hardware_counters);
+  EXPECT_GT(performance_data.hardware_counters->instructions, 0u);
+
+  auto stream = std::stringstream{};
+  stream << performance_data;
+  EXPECT_NE(stream.str().find("IPC"), std::string::npos);
+}
+
+}  // namespace opossum
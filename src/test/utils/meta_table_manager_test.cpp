@@ -5,11 +5,13 @@
 #include "storage/chunk_encoder.hpp"
 #include "utils/load_table.hpp"
 #include "utils/meta_table_manager.hpp"
+#include "utils/meta_tables/meta_cardinality_feedback_table.hpp"
 #include "utils/meta_tables/meta_chunk_sort_orders_table.hpp"
 #include "utils/meta_tables/meta_chunks_table.hpp"
 #include "utils/meta_tables/meta_columns_table.hpp"
 #include "utils/meta_tables/meta_log_table.hpp"
 #include "utils/meta_tables/meta_plugins_table.hpp"
+#include "utils/meta_tables/meta_query_statistics_table.hpp"
 #include "utils/meta_tables/meta_segments_accurate_table.hpp"
 #include "utils/meta_tables/meta_segments_table.hpp"
 #include "utils/meta_tables/meta_settings_table.hpp"
@@ -36,7 +38,9 @@ class MetaTableManagerTest : public BaseTest {
             std::make_shared<MetaSettingsTable>(),
             std::make_shared<MetaLogTable>(),
             std::make_shared<MetaSystemInformationTable>(),
-            std::make_shared<MetaSystemUtilizationTable>()};
+            std::make_shared<MetaSystemUtilizationTable>(),
+            std::make_shared<MetaCardinalityFeedbackTable>(),
+            std::make_shared<MetaQueryStatisticsTable>()};
   }
 
   static MetaTableNames meta_table_names() {
@@ -0,0 +1,49 @@
+#include "base_test.hpp"
+
+#include "hyrise.hpp"
+#include "statistics/cardinality_feedback_store.hpp"
+#include "utils/meta_tables/meta_cardinality_feedback_table.hpp"
+
+namespace opossum {
+
+class MetaCardinalityFeedbackTest : public BaseTest {
+ protected:
+  void SetUp() {
+    meta_cardinality_feedback_table = std::make_shared<MetaCardinalityFeedbackTable>();
+
+    Hyrise::get().default_cardinality_feedback_store = std::make_shared<CardinalityFeedbackStore>();
+    auto& cardinality_feedback_store = *Hyrise::get().default_cardinality_feedback_store;
+    cardinality_feedback_store.record("foo", 0.5f, 0.4f, 100);
+    cardinality_feedback_store.record("bar", 0.5f, 0.05f, 100);
+  }
+
+  void TearDown() { Hyrise::reset(); }
+
+  const std::shared_ptr<Table> generate_meta_table() const { return meta_cardinality_feedback_table->_on_generate(); }
+
+  std::shared_ptr<MetaCardinalityFeedbackTable> meta_cardinality_feedback_table;
+};
+
+TEST_F(MetaCardinalityFeedbackTest, IsImmutable) {
+  EXPECT_FALSE(meta_cardinality_feedback_table->can_insert());
+  EXPECT_FALSE(meta_cardinality_feedback_table->can_update());
+  EXPECT_FALSE(meta_cardinality_feedback_table->can_delete());
+}
+
+TEST_F(MetaCardinalityFeedbackTest, TableGeneration) {
+  const auto meta_table = generate_meta_table();
+  ASSERT_EQ(meta_table->row_count(), 2);
+
+  // The worst misestimation comes first
+  const auto values = meta_table->get_row(0);
+  EXPECT_EQ(values[0], AllTypeVariant{pmr_string{"bar"}});
+  EXPECT_EQ(values[1], AllTypeVariant{int64_t{1}});
+  EXPECT_EQ(values[2], AllTypeVariant{int64_t{100}});
+  EXPECT_EQ(values[3], AllTypeVariant{0.5f});
+  EXPECT_EQ(values[4], AllTypeVariant{0.05f});
+  EXPECT_FLOAT_EQ(boost::get<float>(values[5]), 10.0f);
+
+  EXPECT_EQ(meta_table->get_row(1)[0], AllTypeVariant{pmr_string{"foo"}});
+}
+
+}  // namespace opossum
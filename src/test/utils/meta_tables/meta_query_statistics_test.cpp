@@ -0,0 +1,83 @@
+#include "base_test.hpp"
+
+#include "hyrise.hpp"
+#include "sql/query_statistics_store.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "sql/sql_pipeline_statement.hpp"
+#include "utils/meta_tables/meta_query_statistics_table.hpp"
+
+namespace opossum {
+
+class MetaQueryStatisticsTest : public BaseTest {
+ protected:
+  void SetUp() {
+    meta_query_statistics_table = std::make_shared<MetaQueryStatisticsTable>();
+
+    auto metrics = SQLPipelineStatementMetrics{};
+    metrics.plan_execution_duration = std::chrono::nanoseconds{100};
+
+    Hyrise::get().default_query_statistics_store = std::make_shared<QueryStatisticsStore>();
+    auto& query_statistics_store = *Hyrise::get().default_query_statistics_store;
+    query_statistics_store.record("SELECT 1", metrics, 1, 10);
+
+    metrics.sql_translation_duration = std::chrono::nanoseconds{50};
+    metrics.plan_execution_duration = std::chrono::nanoseconds{200};
+    metrics.query_plan_cache_hit = true;
+    query_statistics_store.record("SELECT * FROM t", metrics, 5, 100);
+    metrics.plan_execution_duration = std::chrono::nanoseconds{400};
+    metrics.query_plan_cache_hit = false;
+    query_statistics_store.record("SELECT * FROM t", metrics, 5, 200);
+  }
+
+  void TearDown() { Hyrise::reset(); }
+
+  const std::shared_ptr<Table> generate_meta_table() const { return meta_query_statistics_table->_on_generate(); }
+
+  std::shared_ptr<MetaQueryStatisticsTable> meta_query_statistics_table;
+};
+
+TEST_F(MetaQueryStatisticsTest, IsImmutable) {
+  EXPECT_FALSE(meta_query_statistics_table->can_insert());
+  EXPECT_FALSE(meta_query_statistics_table->can_update());
+  EXPECT_FALSE(meta_query_statistics_table->can_delete());
+}
+
+TEST_F(MetaQueryStatisticsTest, TableGeneration) {
+  const auto meta_table = generate_meta_table();
+  ASSERT_EQ(meta_table->row_count(), 2);
+
+  // The statement with the highest total latency comes first
+  const auto values = meta_table->get_row(0);
+  EXPECT_EQ(values[0], AllTypeVariant{pmr_string{"SELECT * FROM t"}});
+  EXPECT_EQ(values[1], AllTypeVariant{int64_t{2}});
+
+  // Latency
+  EXPECT_EQ(values[2], AllTypeVariant{int64_t{700}});
+  EXPECT_EQ(values[3], AllTypeVariant{int64_t{350}});
+  EXPECT_EQ(values[4], AllTypeVariant{int64_t{450}});
+
+  // SQL translation
+  EXPECT_EQ(values[5], AllTypeVariant{int64_t{100}});
+  EXPECT_EQ(values[6], AllTypeVariant{int64_t{50}});
+  EXPECT_EQ(values[7], AllTypeVariant{int64_t{50}});
+
+  // Plan execution
+  EXPECT_EQ(values[14], AllTypeVariant{int64_t{600}});
+  EXPECT_EQ(values[15], AllTypeVariant{int64_t{300}});
+  EXPECT_EQ(values[16], AllTypeVariant{int64_t{400}});
+
+  EXPECT_EQ(values[17], AllTypeVariant{int64_t{10}});
+  EXPECT_EQ(values[18], AllTypeVariant{0.5f});
+  EXPECT_EQ(values[19], AllTypeVariant{int64_t{200}});
+
+  EXPECT_EQ(meta_table->get_row(1)[0], AllTypeVariant{pmr_string{"SELECT ?"}});
+}
+
+TEST_F(MetaQueryStatisticsTest, AccessibleViaSQL) {
+  auto pipeline = SQLPipelineBuilder{"SELECT * FROM meta_query_statistics"}.create_pipeline();
+  const auto [status, table] = pipeline.get_result_table();
+  ASSERT_EQ(status, SQLPipelineStatus::Success);
+  EXPECT_GE(table->row_count(), 2);
+}
+
+}  // namespace opossum